@@ -0,0 +1,123 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * arena.cpp
+ *
+ */
+
+#include "arena.h"
+
+#include <stdlib.h>
+#include <stdint.h>
+
+#define ARENA_ALIGNMENT         16
+#define ARENA_DEFAULT_BLOCK     (64 * 1024)
+
+#define ARENA_ROUND(x)          (((x) + (ARENA_ALIGNMENT - 1)) & ~(size_t)(ARENA_ALIGNMENT - 1))
+
+/* the data follows the header, rounded up so it stays aligned */
+struct arena_block
+{
+    struct arena_block *next;
+    size_t size;
+    size_t used;
+};
+
+#define ARENA_BLOCK_HEADER      ARENA_ROUND(sizeof(struct arena_block))
+
+void
+arena_init(struct arena *arena, size_t block_size)
+{
+    arena->blocks = NULL;
+    arena->block_size = block_size ? ARENA_ROUND(block_size) : ARENA_DEFAULT_BLOCK;
+    arena->used = 0;
+    arena->reserved = 0;
+    arena->nr_blocks = 0;
+}
+
+/*
+ * returns 16 bytes aligned memory or NULL if out of memory
+ * requests bigger than the block size get a block of their own
+ */
+void *
+arena_alloc(struct arena *arena, size_t size)
+{
+    size = ARENA_ROUND(size ? size : 1);
+    
+    struct arena_block *block = arena->blocks;
+    if (block == NULL || block->size - block->used < size)
+    {
+        int oversized = size > arena->block_size;
+        size_t block_size = oversized ? size : arena->block_size;
+        block = (struct arena_block*)malloc(ARENA_BLOCK_HEADER + block_size);
+        if (block == NULL)
+        {
+            return NULL;
+        }
+        block->size = block_size;
+        block->used = 0;
+        /* a block of its own goes behind the current one so the rest of that is still used */
+        if (oversized && arena->blocks != NULL)
+        {
+            block->next = arena->blocks->next;
+            arena->blocks->next = block;
+        }
+        else
+        {
+            block->next = arena->blocks;
+            arena->blocks = block;
+        }
+        arena->reserved += block_size;
+        arena->nr_blocks++;
+    }
+    
+    void *ptr = (uint8_t*)block + ARENA_BLOCK_HEADER + block->used;
+    block->used += size;
+    arena->used += size;
+    return ptr;
+}
+
+/*
+ * release every allocation at once
+ */
+void
+arena_free(struct arena *arena)
+{
+    struct arena_block *block = arena->blocks;
+    while (block != NULL)
+    {
+        struct arena_block *tmp = block->next;
+        free(block);
+        block = tmp;
+    }
+    arena_init(arena, arena->block_size);
+}
@@ -0,0 +1,61 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * arena.h
+ *
+ */
+
+#ifndef efi_swiss_knife_arena_h
+#define efi_swiss_knife_arena_h
+
+#include <stddef.h>
+
+struct arena_block;
+
+/*
+ * bump pointer allocator for records that share one lifetime
+ * allocations are never freed individually, arena_free releases everything
+ */
+struct arena
+{
+    struct arena_block *blocks;
+    size_t block_size;
+    size_t used;
+    size_t reserved;
+    int nr_blocks;
+};
+
+void arena_init(struct arena *arena, size_t block_size);
+void * arena_alloc(struct arena *arena, size_t size);
+void arena_free(struct arena *arena);
+
+#endif /* arena_h */
@@ -0,0 +1,589 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * arg_dataflow.cpp
+ *
+ */
+
+#include "arg_dataflow.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "logging.h"
+
+/* RAX to R15, the x86 register numbers */
+#define DATAFLOW_REGS       16
+
+#define REG_RAX             0x0
+#define REG_RCX             0x1
+#define REG_RDX             0x2
+#define REG_R8              0x8
+#define REG_R9              0x9
+#define REG_R10             0xA
+#define REG_R11             0xB
+
+/* bound the fixpoint iterations, the lattice is tiny so this is never hit in practice */
+#define MAX_DATAFLOW_PASSES 64
+
+static const uint16_t g_arg_registers[NR_ARG_REGISTERS] = { REG_RCX, REG_RDX, REG_R8, REG_R9 };
+/* registers a call doesn't preserve */
+static const uint16_t g_volatile_registers[] = { REG_RAX, REG_RCX, REG_RDX, REG_R8, REG_R9, REG_R10, REG_R11 };
+
+struct reg_state
+{
+    struct reg_value regs[DATAFLOW_REGS];
+    /* the pushes since the last call, most recent first */
+    struct reg_value pushed[NR_STACK_ARGS];
+    size_t nr_pushed;
+};
+
+struct basic_block
+{
+    size_t first;
+    size_t last;
+    /* successor basic blocks, -1 if none */
+    long succ[2];
+    int reached;
+    struct reg_state in;
+};
+
+#pragma mark -
+#pragma mark Transfer and meet functions
+#pragma mark -
+
+static void
+set_value(struct reg_value *reg, uint8_t kind, uint64_t value, ea_t def_addr)
+{
+    reg->kind = kind;
+    reg->value = value;
+    reg->def_addr = def_addr;
+}
+
+static int
+is_call(const struct cached_insn *insn)
+{
+    return insn->kind == kInsnCall || insn->kind == kInsnCallIndirect || insn->kind == kInsnJmpIndirect;
+}
+
+/*
+ * a new argument on the stack, whatever was pushed before moves one slot down
+ */
+static void
+push_value(struct reg_state *state, const struct cached_insn *insn)
+{
+    const struct insn_operand *op = &insn->ops[0];
+    memmove(&state->pushed[1], &state->pushed[0], (NR_STACK_ARGS - 1) * sizeof(struct reg_value));
+    if (state->nr_pushed < NR_STACK_ARGS)
+    {
+        state->nr_pushed++;
+    }
+    /* push offset X shows up as an immediate */
+    if (op->type == kOpImm)
+    {
+        set_value(&state->pushed[0], kValueImmediate, op->value, insn->ea);
+    }
+    else if (op->type == kOpReg && op->reg < DATAFLOW_REGS)
+    {
+        state->pushed[0] = state->regs[op->reg];
+    }
+    else
+    {
+        set_value(&state->pushed[0], kValueUnknown, 0, insn->ea);
+    }
+}
+
+/*
+ * update the register state with the effects of one instruction
+ */
+static void
+transfer(struct reg_state *state, const struct cached_insn *insn)
+{
+    const struct insn_operand *dst = &insn->ops[0];
+    const struct insn_operand *src = &insn->ops[1];
+    
+    if (insn->kind == kInsnCall || insn->kind == kInsnCallIndirect)
+    {
+        for (size_t i = 0; i < sizeof(g_volatile_registers) / sizeof(*g_volatile_registers); i++)
+        {
+            set_value(&state->regs[g_volatile_registers[i]], kValueUnknown, 0, insn->ea);
+        }
+        /* the callee or the caller cleans up the arguments, either way they're gone */
+        state->nr_pushed = 0;
+        return;
+    }
+    if (insn->kind == kInsnPush)
+    {
+        push_value(state, insn);
+        return;
+    }
+    if (insn->kind == kInsnPop && state->nr_pushed > 0)
+    {
+        memmove(&state->pushed[0], &state->pushed[1], (NR_STACK_ARGS - 1) * sizeof(struct reg_value));
+        state->nr_pushed--;
+    }
+    if (dst->type != kOpReg || dst->reg >= DATAFLOW_REGS)
+    {
+        return;
+    }
+    
+    struct reg_value *reg = &state->regs[dst->reg];
+    switch (insn->kind)
+    {
+        case kInsnMov:
+            if (src->type == kOpImm)
+            {
+                set_value(reg, kValueImmediate, src->value, insn->ea);
+            }
+            else if (src->type == kOpReg && src->reg < DATAFLOW_REGS)
+            {
+                *reg = state->regs[src->reg];
+            }
+            else
+            {
+                set_value(reg, kValueUnknown, 0, insn->ea);
+            }
+            break;
+        case kInsnLea:
+            /* RIP relative addressing shows up as a memory operand */
+            if (src->type == kOpMem)
+            {
+                set_value(reg, kValueAddress, src->addr, insn->ea);
+            }
+            else
+            {
+                set_value(reg, kValueUnknown, 0, insn->ea);
+            }
+            break;
+        case kInsnXor:
+            if (src->type == kOpReg && src->reg == dst->reg)
+            {
+                set_value(reg, kValueImmediate, 0, insn->ea);
+            }
+            else
+            {
+                set_value(reg, kValueUnknown, 0, insn->ea);
+            }
+            break;
+        default:
+            if (insn->flags & INSN_CHANGES_OP0)
+            {
+                set_value(reg, kValueUnknown, 0, insn->ea);
+            }
+            break;
+    }
+}
+
+static int
+meet_value(struct reg_value *in, const struct reg_value *other)
+{
+    if (in->kind == kValueUnknown || other->kind == kValueNone)
+    {
+        return 0;
+    }
+    if (in->kind == kValueNone)
+    {
+        *in = *other;
+        return 1;
+    }
+    if (in->kind != other->kind || in->value != other->value)
+    {
+        set_value(in, kValueUnknown, 0, BADADDR);
+        return 1;
+    }
+    return 0;
+}
+
+/*
+ * merge a predecessor's out state into a block's in state
+ * only the pushes both paths agree on are kept
+ * returns 1 if the in state changed
+ */
+static int
+meet(struct basic_block *bb, const struct reg_state *out)
+{
+    int changed = !bb->reached;
+    if (!bb->reached)
+    {
+        bb->in = *out;
+        bb->reached = 1;
+        return changed;
+    }
+    for (int i = 0; i < DATAFLOW_REGS; i++)
+    {
+        changed |= meet_value(&bb->in.regs[i], &out->regs[i]);
+    }
+    if (out->nr_pushed < bb->in.nr_pushed)
+    {
+        bb->in.nr_pushed = out->nr_pushed;
+        changed = 1;
+    }
+    for (size_t i = 0; i < bb->in.nr_pushed; i++)
+    {
+        changed |= meet_value(&bb->in.pushed[i], &out->pushed[i]);
+    }
+    return changed;
+}
+
+#pragma mark -
+#pragma mark Control flow graph
+#pragma mark -
+
+/*
+ * split the block into basic blocks at branch targets and after branches
+ * returns the number of basic blocks or 0 on failure
+ */
+static size_t
+build_basic_blocks(struct insn_cache *insns, const struct insn_block *block, struct basic_block **out_bbs, long **out_bb_index)
+{
+    size_t count = block->count;
+    uint8_t *leaders = (uint8_t*)calloc(count, sizeof(uint8_t));
+    long *bb_index = (long*)malloc(count * sizeof(long));
+    if (leaders == NULL || bb_index == NULL)
+    {
+        free(leaders);
+        free(bb_index);
+        return 0;
+    }
+    
+    leaders[0] = 1;
+    for (size_t i = 0; i < count; i++)
+    {
+        const struct cached_insn *insn = cached_insn(insns, block, i);
+        if (insn->kind == kInsnJmp || insn->kind == kInsnJcc)
+        {
+            long target = find_cached_insn(block, insn->ops[0].addr);
+            if (target >= 0)
+            {
+                leaders[target] = 1;
+            }
+        }
+        if ((insn->kind == kInsnJmp || insn->kind == kInsnJcc || insn->kind == kInsnJmpIndirect ||
+             insn->kind == kInsnRet || (insn->flags & INSN_STOPS_FLOW)) && i + 1 < count)
+        {
+            leaders[i + 1] = 1;
+        }
+    }
+    
+    size_t nr_bbs = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        nr_bbs += leaders[i];
+    }
+    struct basic_block *bbs = (struct basic_block*)calloc(nr_bbs, sizeof(struct basic_block));
+    if (bbs == NULL)
+    {
+        free(leaders);
+        free(bb_index);
+        return 0;
+    }
+    
+    long current = -1;
+    for (size_t i = 0; i < count; i++)
+    {
+        if (leaders[i])
+        {
+            current++;
+            bbs[current].first = i;
+        }
+        bbs[current].last = i;
+        bb_index[i] = current;
+    }
+    free(leaders);
+    
+    for (size_t b = 0; b < nr_bbs; b++)
+    {
+        const struct cached_insn *last = &block->insns[bbs[b].last];
+        long fallthrough = bbs[b].last + 1 < count ? (long)b + 1 : -1;
+        long target = -1;
+        if (last->kind == kInsnJmp || last->kind == kInsnJcc)
+        {
+            long target_insn = find_cached_insn(block, last->ops[0].addr);
+            target = target_insn >= 0 ? bb_index[target_insn] : -1;
+        }
+        bbs[b].succ[0] = -1;
+        bbs[b].succ[1] = -1;
+        if (last->kind == kInsnJmp)
+        {
+            bbs[b].succ[0] = target;
+        }
+        else if (last->kind == kInsnJcc)
+        {
+            bbs[b].succ[0] = target;
+            bbs[b].succ[1] = fallthrough;
+        }
+        else if (last->kind != kInsnJmpIndirect && last->kind != kInsnRet && !(last->flags & INSN_STOPS_FLOW))
+        {
+            bbs[b].succ[0] = fallthrough;
+        }
+    }
+    
+    *out_bbs = bbs;
+    *out_bb_index = bb_index;
+    return nr_bbs;
+}
+
+#pragma mark -
+#pragma mark Dataflow solver
+#pragma mark -
+
+static void
+unknown_state(struct reg_state *state)
+{
+    for (int i = 0; i < DATAFLOW_REGS; i++)
+    {
+        set_value(&state->regs[i], kValueUnknown, 0, BADADDR);
+    }
+    state->nr_pushed = 0;
+}
+
+/*
+ * solve the dataflow for one block and collect the argument registers at every call
+ * returns NULL on failure
+ */
+static struct function_args *
+solve_block(struct insn_cache *insns, const struct insn_block *block)
+{
+    struct function_args *function = (struct function_args*)calloc(1, sizeof(struct function_args));
+    if (function == NULL)
+    {
+        return NULL;
+    }
+    function->block = block;
+    if (block->count == 0)
+    {
+        return function;
+    }
+    
+    struct basic_block *bbs = NULL;
+    long *bb_index = NULL;
+    size_t nr_bbs = build_basic_blocks(insns, block, &bbs, &bb_index);
+    if (nr_bbs == 0)
+    {
+        free(function);
+        return NULL;
+    }
+    free(bb_index);
+    
+    /* blocks nobody branches to (entry, code after calls to noreturn functions, jump tables targets)
+     * start with nothing known about the registers
+     */
+    uint8_t *has_preds = (uint8_t*)calloc(nr_bbs, sizeof(uint8_t));
+    if (has_preds == NULL)
+    {
+        free(bbs);
+        free(function);
+        return NULL;
+    }
+    for (size_t b = 0; b < nr_bbs; b++)
+    {
+        for (int s = 0; s < 2; s++)
+        {
+            if (bbs[b].succ[s] >= 0 && bbs[b].succ[s] != (long)b)
+            {
+                has_preds[bbs[b].succ[s]] = 1;
+            }
+        }
+    }
+    for (size_t b = 0; b < nr_bbs; b++)
+    {
+        if (b == 0 || !has_preds[b])
+        {
+            unknown_state(&bbs[b].in);
+            bbs[b].reached = 1;
+        }
+    }
+    free(has_preds);
+    
+    int changed = 1;
+    for (int pass = 0; changed && pass < MAX_DATAFLOW_PASSES; pass++)
+    {
+        changed = 0;
+        for (size_t b = 0; b < nr_bbs; b++)
+        {
+            if (!bbs[b].reached)
+            {
+                continue;
+            }
+            struct reg_state state = bbs[b].in;
+            for (size_t i = bbs[b].first; i <= bbs[b].last; i++)
+            {
+                transfer(&state, cached_insn(insns, block, i));
+            }
+            for (int s = 0; s < 2; s++)
+            {
+                if (bbs[b].succ[s] >= 0 && meet(&bbs[bbs[b].succ[s]], &state))
+                {
+                    changed = 1;
+                }
+            }
+        }
+    }
+    
+    /* final pass to record the argument registers right before each call */
+    size_t capacity = 0;
+    for (size_t b = 0; b < nr_bbs; b++)
+    {
+        struct reg_state state = bbs[b].in;
+        for (size_t i = bbs[b].first; i <= bbs[b].last; i++)
+        {
+            const struct cached_insn *insn = cached_insn(insns, block, i);
+            if (is_call(insn))
+            {
+                if (function->count == capacity)
+                {
+                    size_t new_capacity = capacity ? capacity * 2 : 16;
+                    struct call_args *new_calls = (struct call_args*)realloc(function->calls, new_capacity * sizeof(struct call_args));
+                    if (new_calls == NULL)
+                    {
+                        free(bbs);
+                        free(function->calls);
+                        free(function);
+                        return NULL;
+                    }
+                    function->calls = new_calls;
+                    capacity = new_capacity;
+                }
+                struct call_args *call = &function->calls[function->count++];
+                call->address = insn->ea;
+                for (int a = 0; a < NR_ARG_REGISTERS; a++)
+                {
+                    call->regs[a] = state.regs[g_arg_registers[a]];
+                }
+                for (size_t a = 0; a < NR_STACK_ARGS; a++)
+                {
+                    if (a < state.nr_pushed)
+                    {
+                        call->stack[a] = state.pushed[a];
+                    }
+                    else
+                    {
+                        set_value(&call->stack[a], kValueUnknown, 0, BADADDR);
+                    }
+                }
+            }
+            transfer(&state, insn);
+        }
+    }
+    free(bbs);
+    return function;
+}
+
+#pragma mark -
+#pragma mark Exported functions
+#pragma mark -
+
+/*
+ * argument registers at the call in block, solving the block the first time it's asked for
+ * returns NULL if there's no call at that address or on failure
+ */
+const struct call_args *
+lookup_call_args(struct args_cache *cache, struct insn_cache *insns, const struct insn_block *block, ea_t call_addr)
+{
+    /* functions are kept sorted by block address */
+    size_t low = 0;
+    size_t high = cache->count;
+    while (low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+        if ((uintptr_t)cache->functions[middle]->block < (uintptr_t)block)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    
+    struct function_args *function = NULL;
+    if (low < cache->count && cache->functions[low]->block == block)
+    {
+        function = cache->functions[low];
+    }
+    else
+    {
+        if (cache->count == cache->capacity)
+        {
+            size_t new_capacity = cache->capacity ? cache->capacity * 2 : 64;
+            struct function_args **new_functions = (struct function_args**)realloc(cache->functions, new_capacity * sizeof(struct function_args*));
+            if (new_functions == NULL)
+            {
+                return NULL;
+            }
+            cache->functions = new_functions;
+            cache->capacity = new_capacity;
+        }
+        function = solve_block(insns, block);
+        if (function == NULL)
+        {
+            ERROR_MSG("Failed to solve argument dataflow at 0x%llx.", block->start);
+            return NULL;
+        }
+        memmove(&cache->functions[low + 1], &cache->functions[low], (cache->count - low) * sizeof(struct function_args*));
+        cache->functions[low] = function;
+        cache->count++;
+    }
+    
+    /* calls are recorded per basic block in address order */
+    low = 0;
+    high = function->count;
+    while (low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+        if (function->calls[middle].address < call_addr)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    if (low < function->count && function->calls[low].address == call_addr)
+    {
+        return &function->calls[low];
+    }
+    return NULL;
+}
+
+void
+free_args_cache(struct args_cache *cache)
+{
+    for (size_t i = 0; i < cache->count; i++)
+    {
+        free(cache->functions[i]->calls);
+        free(cache->functions[i]);
+    }
+    free(cache->functions);
+    memset(cache, 0, sizeof(struct args_cache));
+}
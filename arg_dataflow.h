@@ -0,0 +1,112 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * arg_dataflow.h
+ *
+ */
+
+#ifndef efi_swiss_knife_arg_dataflow_h
+#define efi_swiss_knife_arg_dataflow_h
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "binary_view.h"
+
+#include "insn_cache.h"
+
+/*
+ * forward dataflow over a function's control flow graph that finds out
+ * what the argument registers and the pushed arguments hold at every call site
+ */
+
+/* x64 calling convention argument registers, in argument order */
+enum arg_register
+{
+    kArgRCX = 0,
+    kArgRDX,
+    kArgR8,
+    kArgR9,
+    NR_ARG_REGISTERS
+};
+
+/* IA32 arguments are pushed, the most a services call takes */
+#define NR_STACK_ARGS       6
+
+enum reg_value_kind
+{
+    /* no path reaches here yet */
+    kValueNone = 0,
+    /* more than one value or something we don't follow */
+    kValueUnknown,
+    /* lea reg, [address] */
+    kValueAddress,
+    /* mov reg, imm or xor reg, reg */
+    kValueImmediate
+};
+
+struct reg_value
+{
+    uint8_t kind;
+    uint64_t value;
+    /* instruction that set the value, followed through register copies */
+    ea_t def_addr;
+};
+
+/* argument registers and pushed arguments right before a call */
+struct call_args
+{
+    ea_t address;
+    struct reg_value regs[NR_ARG_REGISTERS];
+    /* stack[0] is the last push, the first argument */
+    struct reg_value stack[NR_STACK_ARGS];
+};
+
+struct function_args
+{
+    const struct insn_block *block;
+    struct call_args *calls;
+    size_t count;
+};
+
+/* dataflow results for every analysed block, so each one is only solved once */
+struct args_cache
+{
+    struct function_args **functions;
+    size_t count;
+    size_t capacity;
+};
+
+const struct call_args * lookup_call_args(struct args_cache *cache, struct insn_cache *insns, const struct insn_block *block, ea_t call_addr);
+void free_args_cache(struct args_cache *cache);
+
+#endif /* arg_dataflow_h */
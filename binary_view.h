@@ -0,0 +1,266 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * binary_view.h
+ *
+ */
+
+#ifndef efi_swiss_knife_binary_view_h
+#define efi_swiss_knife_binary_view_h
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * everything the analysis needs from the disassembler: segments, bytes,
+ * decoded instructions, functions, references and annotations
+ *
+ * the IDA plugin and the standalone analyzer each provide one backend and
+ * point g_binary_view to it before running the analysis, nothing else in
+ * the analysis calls the IDA API
+ */
+
+#ifdef EFI_STANDALONE
+/* the few IDA SDK definitions the analysis shares with the standalone build */
+#include <stdio.h>
+#include <string.h>
+#include <limits.h>
+
+typedef uint64_t ea_t;
+
+#define BADADDR             ((ea_t)-1)
+#define MAXNAMELEN          512
+#define QMAXPATH            PATH_MAX
+
+#define qsnprintf           snprintf
+#define qfopen              fopen
+#define qfprintf            fprintf
+#define qvfprintf           vfprintf
+#define qfclose             fclose
+#define msg                 printf
+#define vmsg                vprintf
+
+#ifndef __APPLE__
+static inline size_t
+strlcpy(char *dst, const char *src, size_t size)
+{
+    size_t len = strlen(src);
+    if (size != 0)
+    {
+        size_t copy = len < size - 1 ? len : size - 1;
+        memcpy(dst, src, copy);
+        dst[copy] = '\0';
+    }
+    return len;
+}
+#endif
+#else
+#include <ida.hpp>
+#endif
+
+struct cached_insn;
+
+#define SEGMENT_NAME_SIZE   16
+
+struct binary_segment
+{
+    ea_t start;
+    /* exclusive */
+    ea_t end;
+    char name[SEGMENT_NAME_SIZE];
+};
+
+struct binary_function
+{
+    ea_t start;
+    /* exclusive */
+    ea_t end;
+};
+
+struct binary_view
+{
+    /* "IDA" or "native" */
+    const char *name;
+    /* path of the analysed file */
+    const char *(*input_path)(void);
+    /* FFS file GUID of a module taken out of a firmware volume, NULL otherwise */
+    const char *(*module_guid)(void);
+    int (*is_64bit)(void);
+    /* segments, 0 on success */
+    size_t (*segment_count)(void);
+    int (*segment_at)(size_t index, struct binary_segment *out);
+    int (*segment_by_name)(const char *name, struct binary_segment *out);
+    /* bytes, 0 on success */
+    int (*read_bytes)(ea_t address, void *buffer, size_t size);
+    /* size bytes straight from the backend's memory, NULL if it doesn't have them contiguous */
+    const uint8_t *(*map_bytes)(ea_t address, size_t size);
+    /* code heads, decode returns the instruction size or 0 if there's no instruction */
+    int (*is_code)(ea_t address);
+    ea_t (*next_code)(ea_t address);
+    ea_t (*prev_code)(ea_t address);
+    int (*decode_insn)(ea_t address, struct cached_insn *out);
+    /* functions, 0 on success */
+    size_t (*function_count)(void);
+    int (*function_at)(size_t index, struct binary_function *out);
+    int (*function_containing)(ea_t address, struct binary_function *out);
+    /* references to an address, BADADDR after the last one */
+    ea_t (*first_ref_to)(ea_t address);
+    ea_t (*next_ref_to)(ea_t address, ea_t current);
+    /* annotations, get_name returns 0 if there's a name */
+    int (*get_name)(ea_t address, char *buffer, size_t size);
+    void (*set_name)(ea_t address, const char *name);
+    void (*set_comment)(ea_t address, const char *comment);
+};
+
+extern const struct binary_view *g_binary_view;
+
+static inline const char *
+view_input_path(void)
+{
+    return g_binary_view->input_path();
+}
+
+static inline const char *
+view_module_guid(void)
+{
+    return g_binary_view->module_guid();
+}
+
+static inline int
+view_is_64bit(void)
+{
+    return g_binary_view->is_64bit();
+}
+
+static inline size_t
+view_segment_count(void)
+{
+    return g_binary_view->segment_count();
+}
+
+static inline int
+view_segment_at(size_t index, struct binary_segment *out)
+{
+    return g_binary_view->segment_at(index, out);
+}
+
+static inline int
+view_segment_by_name(const char *name, struct binary_segment *out)
+{
+    return g_binary_view->segment_by_name(name, out);
+}
+
+static inline int
+view_read_bytes(ea_t address, void *buffer, size_t size)
+{
+    return g_binary_view->read_bytes(address, buffer, size);
+}
+
+static inline const uint8_t *
+view_map_bytes(ea_t address, size_t size)
+{
+    return g_binary_view->map_bytes(address, size);
+}
+
+static inline int
+view_is_code(ea_t address)
+{
+    return g_binary_view->is_code(address);
+}
+
+static inline ea_t
+view_next_code(ea_t address)
+{
+    return g_binary_view->next_code(address);
+}
+
+static inline ea_t
+view_prev_code(ea_t address)
+{
+    return g_binary_view->prev_code(address);
+}
+
+static inline int
+view_decode_insn(ea_t address, struct cached_insn *out)
+{
+    return g_binary_view->decode_insn(address, out);
+}
+
+static inline size_t
+view_function_count(void)
+{
+    return g_binary_view->function_count();
+}
+
+static inline int
+view_function_at(size_t index, struct binary_function *out)
+{
+    return g_binary_view->function_at(index, out);
+}
+
+static inline int
+view_function_containing(ea_t address, struct binary_function *out)
+{
+    return g_binary_view->function_containing(address, out);
+}
+
+static inline ea_t
+view_first_ref_to(ea_t address)
+{
+    return g_binary_view->first_ref_to(address);
+}
+
+static inline ea_t
+view_next_ref_to(ea_t address, ea_t current)
+{
+    return g_binary_view->next_ref_to(address, current);
+}
+
+static inline int
+view_get_name(ea_t address, char *buffer, size_t size)
+{
+    return g_binary_view->get_name(address, buffer, size);
+}
+
+static inline void
+view_set_name(ea_t address, const char *name)
+{
+    g_binary_view->set_name(address, name);
+}
+
+static inline void
+view_set_comment(ea_t address, const char *comment)
+{
+    g_binary_view->set_comment(address, comment);
+}
+
+#endif /* binary_view_h */
@@ -0,0 +1,344 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * binary_view_ida.cpp
+ *
+ */
+
+#include "binary_view.h"
+
+#include <idp.hpp>
+#include <loader.hpp>
+#include <allins.hpp>
+#include <bytes.hpp>
+#include <search.hpp>
+#include <segment.hpp>
+#include <funcs.hpp>
+#include <xref.hpp>
+#include <name.hpp>
+
+#include <string.h>
+
+#include "insn_cache.h"
+
+/*
+ * the binary view over the current IDA database
+ * IDA already did the loading and the autoanalysis so this is a thin layer
+ */
+
+static const char *
+ida_input_path(void)
+{
+    return command_line_file;
+}
+
+/* IDA loads one module from a file, its identity comes from the path */
+static const char *
+ida_module_guid(void)
+{
+    return NULL;
+}
+
+static int
+ida_is_64bit(void)
+{
+    return inf.is_64bit();
+}
+
+static void
+convert_segment(segment_t *seg_info, struct binary_segment *out)
+{
+    out->start = seg_info->startEA;
+    out->end = seg_info->endEA;
+    if (get_segm_name(seg_info, out->name, sizeof(out->name)) <= 0)
+    {
+        out->name[0] = '\0';
+    }
+}
+
+static size_t
+ida_segment_count(void)
+{
+    int seg_qty = get_segm_qty();
+    return seg_qty > 0 ? (size_t)seg_qty : 0;
+}
+
+static int
+ida_segment_at(size_t index, struct binary_segment *out)
+{
+    segment_t *seg_info = getnseg((int)index);
+    if (seg_info == NULL)
+    {
+        return 1;
+    }
+    convert_segment(seg_info, out);
+    return 0;
+}
+
+static int
+ida_segment_by_name(const char *name, struct binary_segment *out)
+{
+    segment_t *seg_info = get_segm_by_name(name);
+    if (seg_info == NULL)
+    {
+        return 1;
+    }
+    convert_segment(seg_info, out);
+    return 0;
+}
+
+static int
+ida_read_bytes(ea_t address, void *buffer, size_t size)
+{
+    return get_many_bytes(address, buffer, size) ? 0 : 1;
+}
+
+/* the database bytes are only reachable through get_many_bytes */
+static const uint8_t *
+ida_map_bytes(ea_t /* address */, size_t /* size */)
+{
+    return NULL;
+}
+
+static int
+ida_is_code(ea_t address)
+{
+    return isCode(getFlags(address));
+}
+
+static ea_t
+ida_next_code(ea_t address)
+{
+    return find_code(address, SEARCH_DOWN);
+}
+
+static ea_t
+ida_prev_code(ea_t address)
+{
+    return find_code(address, SEARCH_UP);
+}
+
+#pragma mark -
+#pragma mark Instructions
+#pragma mark -
+
+static void
+convert_operand(const op_t *op, struct insn_operand *out)
+{
+    out->reg = 0;
+    out->addr = 0;
+    out->value = 0;
+    switch (op->type)
+    {
+        case o_void:
+            out->type = kOpNone;
+            break;
+        case o_reg:
+            out->type = kOpReg;
+            out->reg = op->reg;
+            break;
+        case o_mem:
+            out->type = kOpMem;
+            out->addr = op->addr;
+            break;
+        case o_phrase:
+            out->type = kOpPhrase;
+            out->reg = op->phrase;
+            break;
+        case o_displ:
+            out->type = kOpDispl;
+            out->reg = op->phrase;
+            out->addr = op->addr;
+            break;
+        case o_imm:
+            out->type = kOpImm;
+            out->value = op->value;
+            break;
+        case o_near:
+        case o_far:
+            out->type = kOpNear;
+            out->addr = op->addr;
+            break;
+        default:
+            out->type = kOpOther;
+            break;
+    }
+}
+
+static uint16_t
+convert_itype(uint16_t itype, const op_t *op0)
+{
+    switch (itype)
+    {
+        case NN_mov:
+            return kInsnMov;
+        case NN_lea:
+            return kInsnLea;
+        case NN_call:
+            return kInsnCall;
+        case NN_callni:
+            return kInsnCallIndirect;
+        case NN_jmpni:
+            return kInsnJmpIndirect;
+        case NN_jmp:
+        case NN_jmpshort:
+            return op0->type == o_near ? kInsnJmp : kInsnJmpIndirect;
+        case NN_retn:
+        case NN_retf:
+            return kInsnRet;
+        case NN_xor:
+            return kInsnXor;
+        case NN_push:
+            return kInsnPush;
+        case NN_pop:
+            return kInsnPop;
+        case NN_add:
+            return kInsnAdd;
+        case NN_sub:
+            return kInsnSub;
+        default:
+            return op0->type == o_near ? kInsnJcc : kInsnOther;
+    }
+}
+
+static int
+ida_decode_insn(ea_t address, struct cached_insn *out)
+{
+    if (decode_insn(address) <= 0)
+    {
+        return 0;
+    }
+    out->ea = address;
+    out->kind = convert_itype(cmd.itype, &cmd.Operands[0]);
+    out->size = cmd.size;
+    out->flags = InstrIsSet(cmd.itype, CF_CHG1) ? INSN_CHANGES_OP0 : 0;
+    if (InstrIsSet(cmd.itype, CF_STOP))
+    {
+        out->flags |= INSN_STOPS_FLOW;
+    }
+    convert_operand(&cmd.Operands[0], &out->ops[0]);
+    convert_operand(&cmd.Operands[1], &out->ops[1]);
+    return cmd.size;
+}
+
+#pragma mark -
+#pragma mark Functions and references
+#pragma mark -
+
+static size_t
+ida_function_count(void)
+{
+    return get_func_qty();
+}
+
+static int
+ida_function_at(size_t index, struct binary_function *out)
+{
+    func_t *f = getn_func(index);
+    if (f == NULL)
+    {
+        return 1;
+    }
+    out->start = f->startEA;
+    out->end = f->endEA;
+    return 0;
+}
+
+static int
+ida_function_containing(ea_t address, struct binary_function *out)
+{
+    func_t *f = get_func(address);
+    if (f == NULL)
+    {
+        return 1;
+    }
+    out->start = f->startEA;
+    out->end = f->endEA;
+    return 0;
+}
+
+static ea_t
+ida_first_ref_to(ea_t address)
+{
+    return get_first_dref_to(address);
+}
+
+static ea_t
+ida_next_ref_to(ea_t address, ea_t current)
+{
+    return get_next_dref_to(address, current);
+}
+
+static int
+ida_get_name(ea_t address, char *buffer, size_t size)
+{
+    return get_name(BADADDR, address, buffer, size) != NULL ? 0 : 1;
+}
+
+static void
+ida_set_name(ea_t address, const char *name)
+{
+    set_name(address, name, SN_CHECK);
+}
+
+static void
+ida_set_comment(ea_t address, const char *comment)
+{
+    set_cmt(address, comment, 0);
+}
+
+static const struct binary_view g_ida_view =
+{
+    .name = "IDA",
+    .input_path = ida_input_path,
+    .module_guid = ida_module_guid,
+    .is_64bit = ida_is_64bit,
+    .segment_count = ida_segment_count,
+    .segment_at = ida_segment_at,
+    .segment_by_name = ida_segment_by_name,
+    .read_bytes = ida_read_bytes,
+    .map_bytes = ida_map_bytes,
+    .is_code = ida_is_code,
+    .next_code = ida_next_code,
+    .prev_code = ida_prev_code,
+    .decode_insn = ida_decode_insn,
+    .function_count = ida_function_count,
+    .function_at = ida_function_at,
+    .function_containing = ida_function_containing,
+    .first_ref_to = ida_first_ref_to,
+    .next_ref_to = ida_next_ref_to,
+    .get_name = ida_get_name,
+    .set_name = ida_set_name,
+    .set_comment = ida_set_comment
+};
+
+const struct binary_view *g_binary_view = &g_ida_view;
@@ -0,0 +1,337 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * code_patterns.cpp
+ *
+ */
+
+#include "code_patterns.h"
+
+#include "cpu_features.h"
+
+#ifdef HAVE_X86_SIMD
+#include <immintrin.h>
+#endif
+
+#include "config.h"
+#include "guid_scanner.h"
+#include "logging.h"
+
+/*
+ * the opcode bytes of both patterns (8B for the loads, FF for the calls) are
+ * searched a vector at a time and only those positions get the ModRM checks
+ *
+ * x86 code can't be scanned backwards so a candidate is only a hint: the REX
+ * byte in front of the opcode might be the tail of another instruction. this
+ * is fine since the candidates only decide which functions get decoded
+ *
+ * the system table loads depend on the module architecture, x64 loads have a
+ * REX.W prefix and IA32 ones don't, so the displacements come with the scan
+ */
+
+#define OPCODE_MOV_LOAD     0x8B
+#define OPCODE_GROUP5       0xFF
+
+static int
+add_candidate(struct code_candidates *out, size_t offset, uint8_t pattern)
+{
+    if (out->count == out->capacity)
+    {
+        size_t new_capacity = out->capacity ? out->capacity * 2 : 256;
+        struct code_candidate *new_items = (struct code_candidate*)realloc(out->items, new_capacity * sizeof(struct code_candidate));
+        if (new_items == NULL)
+        {
+            ERROR_MSG("Can't allocate memory for code candidates.");
+            return 1;
+        }
+        out->items = new_items;
+        out->capacity = new_capacity;
+    }
+    out->items[out->count].offset = (uint32_t)offset;
+    out->items[out->count].pattern = pattern;
+    out->count++;
+    return 0;
+}
+
+/*
+ * full check of an opcode byte found at offset
+ * returns 1 only if we failed to record a match
+ */
+static inline int
+match_at(const uint8_t *buffer, size_t offset, size_t size, const struct module_arch *arch, struct code_candidates *out)
+{
+    if (offset + 2 >= size)
+    {
+        return 0;
+    }
+    uint8_t modrm = buffer[offset + 1];
+    uint8_t mod = modrm >> 6;
+    uint8_t rm = modrm & 7;
+    
+    if (buffer[offset] == OPCODE_MOV_LOAD)
+    {
+        /* (REX.W) 8B /r with a disp8 or disp32, rsp and r12 based loads have a SIB byte first */
+        if (mod != 1 && mod != 2)
+        {
+            return 0;
+        }
+        size_t disp = offset + 2 + (rm == 4);
+        if (disp + (mod == 1 ? 1 : 4) > size)
+        {
+            return 0;
+        }
+        ea_t field = buffer[disp];
+        if (mod == 2)
+        {
+            field |= (ea_t)buffer[disp + 1] << 8 | (ea_t)buffer[disp + 2] << 16 | (ea_t)buffer[disp + 3] << 24;
+        }
+        size_t start = offset;
+        if (arch->pointer_size == 8)
+        {
+            if (offset == 0 || (buffer[offset - 1] & 0xF8) != 0x48)
+            {
+                return 0;
+            }
+            start--;
+        }
+        if (field == arch->system_table_boot)
+        {
+            return add_candidate(out, start, kPatternBootLoad);
+        }
+        if (field == arch->system_table_runtime)
+        {
+            return add_candidate(out, start, kPatternRuntimeLoad);
+        }
+        return 0;
+    }
+    
+    /* FF /2 call or FF /4 jmp (tail calls) with a disp8 or disp32 */
+    uint8_t reg = (modrm >> 3) & 7;
+    if ((reg != 2 && reg != 4) || (mod != 1 && mod != 2))
+    {
+        return 0;
+    }
+    size_t length = 2 + (rm == 4) + (mod == 1 ? 1 : 4);
+    if (offset + length > size)
+    {
+        return 0;
+    }
+    /* include a REX prefix for r8-r15 */
+    size_t start = offset;
+    if (offset > 0 && (buffer[offset - 1] & 0xF0) == 0x40)
+    {
+        start--;
+    }
+    return add_candidate(out, start, kPatternServiceCall);
+}
+
+static int
+scan_code_scalar(const uint8_t *buffer, size_t start, size_t size, const struct module_arch *arch, struct code_candidates *out)
+{
+    for (size_t offset = start; offset < size; offset++)
+    {
+        if (buffer[offset] == OPCODE_MOV_LOAD || buffer[offset] == OPCODE_GROUP5)
+        {
+            if (match_at(buffer, offset, size, arch, out) != 0)
+            {
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+#ifdef HAVE_X86_SIMD
+
+__attribute__((target("avx2")))
+static int
+scan_code_avx2(const uint8_t *buffer, size_t size, const struct module_arch *arch, size_t *out_offset, struct code_candidates *out)
+{
+    const __m256i mov_load = _mm256_set1_epi8((char)OPCODE_MOV_LOAD);
+    const __m256i group5 = _mm256_set1_epi8((char)OPCODE_GROUP5);
+    size_t offset = 0;
+    for (; offset + 32 <= size; offset += 32)
+    {
+        __m256i bytes = _mm256_loadu_si256((const __m256i*)(buffer + offset));
+        __m256i hits = _mm256_or_si256(_mm256_cmpeq_epi8(bytes, mov_load), _mm256_cmpeq_epi8(bytes, group5));
+        unsigned int mask = (unsigned int)_mm256_movemask_epi8(hits);
+        while (mask != 0)
+        {
+            if (match_at(buffer, offset + __builtin_ctz(mask), size, arch, out) != 0)
+            {
+                return 1;
+            }
+            mask &= mask - 1;
+        }
+    }
+    *out_offset = offset;
+    return 0;
+}
+
+static int
+scan_code_sse2(const uint8_t *buffer, size_t size, const struct module_arch *arch, size_t *out_offset, struct code_candidates *out)
+{
+    const __m128i mov_load = _mm_set1_epi8((char)OPCODE_MOV_LOAD);
+    const __m128i group5 = _mm_set1_epi8((char)OPCODE_GROUP5);
+    size_t offset = 0;
+    for (; offset + 16 <= size; offset += 16)
+    {
+        __m128i bytes = _mm_loadu_si128((const __m128i*)(buffer + offset));
+        __m128i hits = _mm_or_si128(_mm_cmpeq_epi8(bytes, mov_load), _mm_cmpeq_epi8(bytes, group5));
+        unsigned int mask = (unsigned int)_mm_movemask_epi8(hits);
+        while (mask != 0)
+        {
+            if (match_at(buffer, offset + __builtin_ctz(mask), size, arch, out) != 0)
+            {
+                return 1;
+            }
+            mask &= mask - 1;
+        }
+    }
+    *out_offset = offset;
+    return 0;
+}
+
+#endif
+
+/*
+ * find every candidate in a buffer of code loaded at base
+ * returns 0 on success, 1 on failure
+ */
+int
+scan_code_patterns(const uint8_t *buffer, size_t size, ea_t base, const struct module_arch *arch, struct code_candidates *out)
+{
+    if (buffer == NULL || arch == NULL || out == NULL || (uint64_t)size > 0xFFFFFFFF)
+    {
+        return 1;
+    }
+    out->base = base;
+    out->size = size;
+    out->count = 0;
+    
+    size_t offset = 0;
+#ifdef HAVE_X86_SIMD
+    int ret = 0;
+    if (cpu_has_avx2() == 1)
+    {
+        ret = scan_code_avx2(buffer, size, arch, &offset, out);
+    }
+    else
+    {
+        ret = scan_code_sse2(buffer, size, arch, &offset, out);
+    }
+    if (ret != 0)
+    {
+        return 1;
+    }
+#endif
+    /* whatever is left at the end of the buffer */
+    if (scan_code_scalar(buffer, offset, size, arch, out) != 0)
+    {
+        return 1;
+    }
+    out->scanned = 1;
+    return 0;
+}
+
+/*
+ * scan the code segment of the current database
+ * returns 0 on success, 1 on failure
+ */
+int
+find_code_candidates(const struct module_arch *arch, struct code_candidates *out)
+{
+    struct binary_segment seg_info;
+    if (view_segment_by_name(".text", &seg_info) != 0)
+    {
+        ERROR_MSG("Can't find a valid code segment!");
+        return 1;
+    }
+    size_t seg_size = 0;
+    uint8_t *seg_copy = NULL;
+    const uint8_t *seg_bytes = snapshot_segment(&seg_info, &seg_size, &seg_copy);
+    if (seg_bytes == NULL)
+    {
+        return 1;
+    }
+    int ret = scan_code_patterns(seg_bytes, seg_size, seg_info.start, arch, out);
+    free(seg_copy);
+    if (ret == 0)
+    {
+        DEBUG_MSG("Code prefilter: %lu candidates in %lu bytes.", (unsigned long)out->count, (unsigned long)seg_size);
+    }
+    return ret;
+}
+
+/*
+ * is there any candidate of the given patterns inside [start, end)
+ * ranges we didn't scan always have candidates
+ */
+int
+has_code_candidates(const struct code_candidates *candidates, ea_t start, ea_t end, unsigned int patterns)
+{
+    if (candidates->scanned == 0 || start < candidates->base || end > candidates->base + candidates->size)
+    {
+        return 1;
+    }
+    uint32_t start_offset = (uint32_t)(start - candidates->base);
+    uint32_t end_offset = (uint32_t)(end - candidates->base);
+    size_t low = 0;
+    size_t high = candidates->count;
+    while (low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+        if (candidates->items[middle].offset < start_offset)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    for (size_t i = low; i < candidates->count && candidates->items[i].offset < end_offset; i++)
+    {
+        if (candidates->items[i].pattern & patterns)
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+void
+free_code_candidates(struct code_candidates *candidates)
+{
+    free(candidates->items);
+    memset(candidates, 0, sizeof(struct code_candidates));
+}
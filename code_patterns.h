@@ -0,0 +1,88 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * code_patterns.h
+ *
+ */
+
+#ifndef efi_swiss_knife_code_patterns_h
+#define efi_swiss_knife_code_patterns_h
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "binary_view.h"
+
+#include "module_arch.h"
+
+/*
+ * raw byte prefilter over the code segment
+ * finds the encodings the services passes care about so the decoder only
+ * needs to run on the functions that contain them
+ */
+
+
+enum code_pattern
+{
+    /* mov r64, [reg+60h] or mov r32, [reg+3Ch] - loads EFI_SYSTEM_TABLE.BootServices */
+    kPatternBootLoad = 0x1,
+    /* mov r64, [reg+58h] or mov r32, [reg+38h] - loads EFI_SYSTEM_TABLE.RuntimeServices */
+    kPatternRuntimeLoad = 0x2,
+    /* call/jmp [reg+disp8/disp32] - a call through a services table */
+    kPatternServiceCall = 0x4
+};
+
+/* offset is the instruction start relative to the scanned buffer */
+struct code_candidate
+{
+    uint32_t offset;
+    uint8_t pattern;
+};
+
+/* candidates in address order */
+struct code_candidates
+{
+    ea_t base;
+    size_t size;
+    /* 0 if the code couldn't be scanned, every range is then a candidate */
+    int scanned;
+    struct code_candidate *items;
+    size_t count;
+    size_t capacity;
+};
+
+int scan_code_patterns(const uint8_t *buffer, size_t size, ea_t base, const struct module_arch *arch, struct code_candidates *out);
+int find_code_candidates(const struct module_arch *arch, struct code_candidates *out);
+int has_code_candidates(const struct code_candidates *candidates, ea_t start, ea_t end, unsigned int patterns);
+void free_code_candidates(struct code_candidates *candidates);
+
+#endif /* code_patterns_h */
@@ -55,5 +55,7 @@ extern struct config g_config;
 
 #define LOG_FILE    "/Users/CHANGEME/efi_swissknife.log"
 #define DB_FILE     "/Users/CHANGEME/efi_swissknife.db"
+/* optional, built with tools/efi_guid_compiler. the built in GUIDs are used if it doesn't exist */
+#define GUID_DICT_FILE  "/Users/CHANGEME/efi_guids.dict"
 
 #endif /* config_h */
@@ -0,0 +1,121 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * cpu_features.cpp
+ *
+ */
+
+#include "cpu_features.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef HAVE_X86_SIMD
+#include <cpuid.h>
+#endif
+
+/*
+ * runtime detection of the SIMD extensions used by the scanning and formatting
+ * kernels. results are cached since they are queried in hot paths
+ */
+
+#ifdef HAVE_X86_SIMD
+
+static int
+detect_ssse3(void)
+{
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0)
+    {
+        return 0;
+    }
+    return (ecx & (1 << 9)) != 0;
+}
+
+static int
+detect_avx2(void)
+{
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if (__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0)
+    {
+        return 0;
+    }
+    /* AVX and OSXSAVE, then make sure the OS saves the YMM state */
+    if ((ecx & (1 << 27)) == 0 || (ecx & (1 << 28)) == 0)
+    {
+        return 0;
+    }
+    uint32_t xcr0_lo = 0, xcr0_hi = 0;
+    __asm__ volatile ("xgetbv" : "=a" (xcr0_lo), "=d" (xcr0_hi) : "c" (0));
+    if ((xcr0_lo & 0x6) != 0x6)
+    {
+        return 0;
+    }
+    if (__get_cpuid_max(0, NULL) < 7)
+    {
+        return 0;
+    }
+    __cpuid_count(7, 0, eax, ebx, ecx, edx);
+    return (ebx & (1 << 5)) != 0;
+}
+
+#endif
+
+int
+cpu_has_ssse3(void)
+{
+#ifdef HAVE_X86_SIMD
+    static int has_ssse3 = -1;
+    if (has_ssse3 == -1)
+    {
+        has_ssse3 = detect_ssse3();
+    }
+    return has_ssse3;
+#else
+    return 0;
+#endif
+}
+
+int
+cpu_has_avx2(void)
+{
+#ifdef HAVE_X86_SIMD
+    static int has_avx2 = -1;
+    if (has_avx2 == -1)
+    {
+        has_avx2 = detect_avx2();
+    }
+    return has_avx2;
+#else
+    return 0;
+#endif
+}
@@ -36,24 +36,13 @@
 
 #include "database.h"
 
-#include <ida.hpp>
-#include <idp.hpp>
-#include <loader.hpp>
-#include <bytes.hpp>
-#include <kernwin.hpp>
-#include <search.hpp>
-#include <allins.hpp>
-#include <segment.hpp>
 #include <limits.h>
-#include <auto.hpp>
-#include <name.hpp>
-#include <frame.hpp>
-#include <struct.hpp>
-#include <funcs.hpp>
-
+#include <unistd.h>
 #include <sqlite3.h>
 #include <libgen.h>
 
+#include "binary_view.h"
+
 #include "config.h"
 #include "logging.h"
 
@@ -61,6 +50,8 @@ sqlite3 *g_db_connection;
 
 static int set_db_options(void);
 static int init_db(void);
+static int init_pei_tables(void);
+static int init_smm_tables(void);
 
 int
 open_db(void)
@@ -76,6 +67,9 @@ open_db(void)
             return 1;
         }
         set_db_options();
+        /* databases created before PEI and SMM modules were analysed don't have these */
+        init_pei_tables();
+        init_smm_tables();
     }
     /* else we need to create and init it */
     else
@@ -84,6 +78,8 @@ open_db(void)
         {
             set_db_options();
             init_db();
+            init_pei_tables();
+            init_smm_tables();
         }
         else
         {
@@ -262,3 +258,112 @@ init_db(void)
 
     return 0;
 }
+
+static int
+init_pei_tables(void)
+{
+    if (g_db_connection == NULL)
+    {
+        ERROR_MSG("Database handle is invalid.");
+        return 1;
+    }
+    
+    char pei_service_stats_table_sql[] = "CREATE TABLE IF NOT EXISTS pei_service_stats ( \
+    file_guid TEXT NOT NULL, \
+    installppi INTEGER NOT NULL, \
+    reinstallppi INTEGER NOT NULL, \
+    locateppi INTEGER NOT NULL, \
+    notifyppi INTEGER NOT NULL, \
+    getbootmode INTEGER NOT NULL, \
+    setbootmode INTEGER NOT NULL, \
+    gethoblist INTEGER NOT NULL, \
+    createhob INTEGER NOT NULL, \
+    ffsfindnextvolume INTEGER NOT NULL, \
+    ffsfindnextfile INTEGER NOT NULL, \
+    ffsfindsectiondata INTEGER NOT NULL, \
+    installpeimemory INTEGER NOT NULL, \
+    allocatepages INTEGER NOT NULL, \
+    allocatepool INTEGER NOT NULL, \
+    copymem INTEGER NOT NULL, \
+    setmem INTEGER NOT NULL, \
+    reportstatuscode INTEGER NOT NULL, \
+    resetsystem INTEGER NOT NULL, \
+    cpuio INTEGER NOT NULL, \
+    pcicfg INTEGER NOT NULL)";
+    
+    char *error_msg = NULL;
+    if (sqlite3_exec(g_db_connection, pei_service_stats_table_sql, NULL, NULL, &error_msg) != SQLITE_OK)
+    {
+        ERROR_MSG("Unable to create PEI services stats table: %s.", error_msg);
+        return 1;
+    }
+    
+    char ppis_usage_table_sql[] = "CREATE TABLE IF NOT EXISTS ppis_usage ( \
+    file_guid TEXT NOT NULL, \
+    ppi TEXT NOT NULL, \
+    description TEXT NOT NULL, \
+    type INTEGER NOT NULL)";
+    
+    if (sqlite3_exec(g_db_connection, ppis_usage_table_sql, NULL, NULL, &error_msg) != SQLITE_OK)
+    {
+        ERROR_MSG("Unable to create PPIs usage table: %s.", error_msg);
+        return 1;
+    }
+    
+    char installed_ppis_table_sql[] = "CREATE TABLE IF NOT EXISTS installed_ppis ( \
+    file_guid TEXT NOT NULL, \
+    installed TEXT NOT NULL, \
+    type INTEGER NOT NULL)";
+    
+    if (sqlite3_exec(g_db_connection, installed_ppis_table_sql, NULL, NULL, &error_msg) != SQLITE_OK)
+    {
+        ERROR_MSG("Unable to create installed PPIs table: %s.", error_msg);
+        return 1;
+    }
+    
+    return 0;
+}
+
+/*
+ * the SMM protocols share the protocols tables, their type tells them apart
+ */
+static int
+init_smm_tables(void)
+{
+    if (g_db_connection == NULL)
+    {
+        ERROR_MSG("Database handle is invalid.");
+        return 1;
+    }
+    
+    char smm_service_stats_table_sql[] = "CREATE TABLE IF NOT EXISTS smm_service_stats ( \
+    file_guid TEXT NOT NULL, \
+    smminstallconfigurationtable INTEGER NOT NULL, \
+    smmiomemread INTEGER NOT NULL, \
+    smmiomemwrite INTEGER NOT NULL, \
+    smmioioread INTEGER NOT NULL, \
+    smmioiowrite INTEGER NOT NULL, \
+    smmallocatepool INTEGER NOT NULL, \
+    smmfreepool INTEGER NOT NULL, \
+    smmallocatepages INTEGER NOT NULL, \
+    smmfreepages INTEGER NOT NULL, \
+    smmstartupthisap INTEGER NOT NULL, \
+    smminstallprotocolinterface INTEGER NOT NULL, \
+    smmuninstallprotocolinterface INTEGER NOT NULL, \
+    smmhandleprotocol INTEGER NOT NULL, \
+    smmregisterprotocolnotify INTEGER NOT NULL, \
+    smmlocatehandle INTEGER NOT NULL, \
+    smmlocateprotocol INTEGER NOT NULL, \
+    smimanage INTEGER NOT NULL, \
+    smihandlerregister INTEGER NOT NULL, \
+    smihandlerunregister INTEGER NOT NULL)";
+    
+    char *error_msg = NULL;
+    if (sqlite3_exec(g_db_connection, smm_service_stats_table_sql, NULL, NULL, &error_msg) != SQLITE_OK)
+    {
+        ERROR_MSG("Unable to create SMM services stats table: %s.", error_msg);
+        return 1;
+    }
+    
+    return 0;
+}
@@ -34,1647 +34,1637 @@
  *
  */
 
-#ifndef efi_swiss_knife_efi_guids_h
-#define efi_swiss_knife_efi_guids_h
-
-#include <stdint.h>
-
-typedef struct __attribute__ ((__packed__)) {
-    uint32_t Data1;
-    uint16_t Data2;
-    uint16_t Data3;
-    uint8_t  Data4[8];
-} EFI_GUID;
+/*
+ * the known GUIDs list
+ *
+ * there is no include guard on purpose. guid_index.cpp includes this file once
+ * for every table it generates out of it (the dense keys array and the names
+ * string pool) with a different GUID_ENTRY() definition each time
+ *
+ * entry format: GUID_ENTRY(name, Data1, Data2, Data3, Data4[0], ..., Data4[7])
+ */
 
-struct guid_entry
-{
-    char name[1024];
-    EFI_GUID guid;
-};
+#ifndef GUID_ENTRY
+#error "GUID_ENTRY() must be defined before including efi_guids.h"
+#endif
 
 #pragma mark EDK GUIDS
 
-struct guid_entry guid_table[] = {
-    { "ACPI_TABLE_GUID", { 0xeb9d2d30, 0x2d88, 0x11d3, 0x9a, 0x16, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d } },
-    { "APPLE_REMOVABLE_MEDIA_PROTOCOL_GUID", { 0x2ea9743a, 0x23d9, 0x425e, 0x87, 0x2c, 0xf6, 0x15, 0xaa, 0x19, 0x57, 0x88 } },
-    { "ARM_GLOBAL_VARIABLE_PPI_GUID", { 0xab1c1816, 0xd542, 0x4e6f, 0x9b, 0x1e, 0x8e, 0xcd, 0x92, 0x53, 0xe2, 0xe7 } },
-    { "ARM_HOB_GLOBAL_VARIABLE_GUID", { 0xc3253c90, 0xa24f, 0x4599, 0xa6, 0x64, 0x1f, 0x88, 0x13, 0x77, 0x8f, 0xc9 } },
-    { "ARM_MP_CORE_INFO_GUID", { 0xa4ee0728, 0xe5d7, 0x4ac5,  0xb2, 0x1e, 0x65, 0x8e, 0xd8, 0x57, 0xe8, 0x34 } },
-    { "ARM_MP_CORE_INFO_PPI_GUID", { 0x6847cc74, 0xe9ec, 0x4f8f, 0xa2, 0x9d, 0xab, 0x44, 0xe7, 0x54, 0xa8, 0xfc } },
-    { "BDS_LIB_STRING_PACKAGE_GUID", { 0x3b4d9b23, 0x95ac, 0x44f6, 0x9f, 0xcd, 0xe, 0x95, 0x94, 0x58, 0x6c, 0x72 } },
-    { "BLOCKIO_VENDOR_GUID", { 0xcf31fac5, 0xc24e, 0x11d2,  0x85, 0xf3, 0x0, 0xa0, 0xc9, 0x3e, 0xc9, 0x3b } },
-    { "BLOCK_MMIO_PROTOCOL_GUID", { 0x6b558ce3, 0x69e5, 0x4c67, 0xa6, 0x34, 0xf7, 0xfe, 0x72, 0xad, 0xbe, 0x84 } },
-    { "BOOT_MAINT_FORMSET_GUID", { 0x642237c7, 0x35d4, 0x472d, 0x83, 0x65, 0x12, 0xe0, 0xcc, 0xf2, 0x7a, 0x22 } },
-    { "BOOT_MANAGER_FORMSET_GUID", { 0x847bc3fe, 0xb974, 0x446d, 0x94, 0x49, 0x5a, 0xd5, 0x41, 0x2e, 0x99, 0x3b } },
-    { "CONNECT_CONIN_EVENT_GUID", { 0xdb4e8151, 0x57ed, 0x4bed, 0x88, 0x33, 0x67, 0x51, 0xb5, 0xd1, 0xa8, 0xd7 } },
-    { "DEVICE_MANAGER_FORMSET_GUID", { 0x3ebfa8e6, 0x511d, 0x4b5b, 0xa9, 0x5f, 0xfb, 0x38, 0x26, 0xf, 0x1c, 0x27 } },
-    { "DP_HII_GUID", { 0xeb832fd9, 0x9089, 0x4898, 0x83, 0xc9, 0x41, 0x61, 0x8f, 0x5c, 0x48, 0xb9 } },
-    { "DRIVER_HEALTH_FORMSET_GUID", { 0xf76e0a70, 0xb5ed, 0x4c38, 0xac, 0x9a, 0xe5, 0xf5, 0x4b, 0xf1, 0x6e, 0x34 } },
-    { "DRIVER_SAMPLE_FORMSET_GUID", { 0xA04A27f4, 0xDF00, 0x4D42, 0xB5, 0x52, 0x39, 0x51, 0x13, 0x02, 0x11, 0x3D } },
-    { "DRIVER_SAMPLE_INVENTORY_GUID", { 0xb3f56470, 0x6141, 0x4621, 0x8f, 0x19, 0x70, 0x4e, 0x57, 0x7a, 0xa9, 0xe8 } },
-    { "DUET_CONSOLEOUT_CONFIG_GUID", { 0xED150714, 0xDF30, 0x407D, 0xB2, 0x4A, 0x4B, 0x74, 0x2F, 0xD5, 0xCE, 0xA2 } },
-    { "DXE_CORE_FILE_NAME_GUID", { 0xD6A2CB7F, 0x6A18, 0x4e2f, 0xB4, 0x3B, 0x99, 0x20, 0xA7, 0x33, 0x70, 0x0A } },
-    { "DXE_SERVICES_TABLE_GUID", { 0x5ad34ba, 0x6f02, 0x4214, 0x95, 0x2e, 0x4d, 0xa0, 0x39, 0x8e, 0x2b, 0xb9 } },
-    { "EBL_ADD_COMMAND_PROTOCOL_GUID", { 0xaeda2428, 0x9a22, 0x4637, 0x9b, 0x21, 0x54, 0x5e, 0x28, 0xfb, 0xb8, 0x29 } },
-    { "ECP_PEI_PCI_CFG_PPI_GUID", { 0xb0ee53d4, 0xa049, 0x4a79, 0xb2, 0xff, 0x19, 0xd9, 0xfa, 0xef, 0xaa, 0x94 } },
-    { "EFI_ABSOLUTE_POINTER_PROTOCOL_GUID", { 0x8D59D32B, 0xC655, 0x4AE9, 0x9B, 0x15, 0xF2, 0x59, 0x04, 0x99, 0x2A, 0x43 } },
-    { "EFI_ACPI_S3_CONTEXT_GUID", { 0xef98d3a, 0x3e33, 0x497a, 0xa4, 0x1, 0x77, 0xbe, 0x3e, 0xb7, 0x4f, 0x38 } },
-    { "EFI_ACPI_S3_SAVE_GUID", { 0x125f2de1, 0xfb85, 0x440c, 0xa5, 0x4c, 0x4d, 0x99, 0x35, 0x8a, 0x8d, 0x38 } },
-    { "EFI_ACPI_SDT_PROTOCOL_GUID", { 0xeb97088e, 0xcfdf, 0x49c6, 0xbe, 0x4b, 0xd9, 0x6, 0xa5, 0xb2, 0xe, 0x86 } },
-    { "EFI_ACPI_SUPPORT_GUID", { 0xdbff9d55, 0x89b7, 0x46da, 0xbd, 0xdf, 0x67, 0x7d, 0x3d, 0xc0, 0x24, 0x1d } },
-    { "EFI_ACPI_TABLE_GUID", { 0x8868e871, 0xe4f1, 0x11d3, 0xbc, 0x22, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 } },
-    { "EFI_ACPI_TABLE_GUID", { 0xeb9d2d30, 0x2d88, 0x11d3, 0x9a, 0x16, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d } },
-    { "EFI_ACPI_TABLE_PROTOCOL_GUID", { 0xffe06bdd, 0x6107, 0x46a6, 0x7b, 0xb2, 0x5a, 0x9c, 0x7e, 0xc5, 0x27, 0x5c } },
-    { "EFI_ACPI_TABLE_STORAGE_GUID", { 0x7e374e25, 0x8e01, 0x4fee, 0x87, 0xf2, 0x39, 0xc, 0x23, 0xc6, 0x6, 0xcd } },
-    { "EFI_ACPI_VARIABLE_COMPATIBILITY_GUID", { 0xc020489e, 0x6db2, 0x4ef2, 0x9a, 0xa5, 0xca, 0x6, 0xfc, 0x11, 0xd3, 0x6a } },
-    { "EFI_ALTERNATE_FV_BLOCK_GUID", { 0xf496922d, 0x172f, 0x4bbc, 0xa1, 0xeb, 0xe, 0xeb, 0x94, 0x9c, 0x34, 0x86 } },
-    { "EFI_APRIORI_GUID", { 0xfc510ee7, 0xffdc, 0x11d4, 0xbd, 0x41, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 } },
-    { "EFI_ARP_PROTOCOL_GUID", { 0xf4b427bb, 0xba21, 0x4f16, 0xbc, 0x4e, 0x43, 0xe4, 0x16, 0xab, 0x61, 0x9c } },
-    { "EFI_ARP_SERVICE_BINDING_PROTOCOL_GUID", { 0xf44c00ee, 0x1f2c, 0x4a00, 0xaa, 0x9, 0x1c, 0x9f, 0x3e, 0x8, 0x0, 0xa3 } },
-    { "EFI_ATA_PASS_THRU_PROTOCOL_GUID", { 0x1d3de7f0, 0x807, 0x424f, 0xaa, 0x69, 0x11, 0xa5, 0x4e, 0x19, 0xa4, 0x6f } },
-    { "EFI_AUTHENTICATED_VARIABLE_GUID", { 0xaaf32c78, 0x947b, 0x439a, 0xa1, 0x80, 0x2e, 0x14, 0x4e, 0xc3, 0x77, 0x92 } },
-    { "EFI_AUTHENTICATION_CHAP_LOCAL_GUID", { 0xc280c73e, 0x15ca, 0x11da, 0xb0, 0xca, 0x00, 0x10, 0x83, 0xff, 0xca, 0x4d } },
-    { "EFI_AUTHENTICATION_CHAP_RADIUS_GUID", { 0xd6062b50, 0x15ca, 0x11da, 0x92, 0x19, 0x00, 0x10, 0x83, 0xff, 0xca, 0x4d } },
-    { "EFI_AUTHENTICATION_INFO_PROTOCOL_GUID", { 0x7671d9d0, 0x53db, 0x4173, 0xaa, 0x69, 0x23, 0x27, 0xf2, 0x1f, 0x0b, 0xc7 } },
-    { "EFI_BDS_ARCH_PROTOCOL_GUID", { 0x665E3FF6, 0x46CC, 0x11d4, 0x9A, 0x38, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D } },
-    { "EFI_BIS_PROTOCOL_GUID", { 0x0b64aab0, 0x5429, 0x11d4, 0x98, 0x16, 0x00, 0xa0, 0xc9, 0x1f, 0xad, 0xcf } },
-    { "EFI_BLOCK_IO2_PROTOCOL_GUID", { 0xa77b2472, 0xe282, 0x4e9f, 0xa2, 0x45, 0xc2, 0xc0, 0xe2, 0x7b, 0xbc, 0xc1 } },
-    { "EFI_BLOCK_IO_PROTOCOL_GUID", { 0x964e5b21, 0x6459, 0x11d2, 0x8e, 0x39, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b } },
-    { "EFI_BOOT_LOGO_PROTOCOL_GUID", { 0xcdea2bd3, 0xfc25, 0x4c1c, 0xb9, 0x7c, 0xb3, 0x11, 0x86, 0x6, 0x49, 0x90 } },
-    { "EFI_BOOT_SCRIPT_EXECUTOR_CONTEXT_GUID", { 0x79cb58c4, 0xac51, 0x442f, 0xaf, 0xd7, 0x98, 0xe4, 0x7d, 0x2e, 0x99, 0x8 } },
-    { "EFI_BOOT_SCRIPT_EXECUTOR_VARIABLE_GUID", { 0x3079818c, 0x46d4, 0x4a73, 0xae, 0xf3, 0xe3, 0xe4, 0x6c, 0xf1, 0xee, 0xdb } },
-    { "EFI_BOOT_SCRIPT_SAVE_PROTOCOL_GUID", { 0x470e1529, 0xb79e, 0x4e32, 0xa0, 0xfe, 0x6a, 0x15, 0x6d, 0x29, 0xf9, 0xb2 } },
-    { "EFI_BUS_SPECIFIC_DRIVER_OVERRIDE_PROTOCOL_GUID", { 0x3bc1b285, 0x8a15, 0x4a82, 0xaa, 0xbf, 0x4d, 0x7d, 0x13, 0xfb, 0x32, 0x65 } },
-    { "EFI_CACHE_SUBCLASS_GUID", { 0x7f0013a7, 0xdc79, 0x4b22, 0x80, 0x99, 0x11, 0xf7, 0x5f, 0xdc, 0x82, 0x9d } },
-    { "EFI_CAPSULE_ARCH_PROTOCOL_GUID", { 0x5053697e, 0x2cbc, 0x4819, 0x90, 0xd9, 0x05, 0x80, 0xde, 0xee, 0x57, 0x54 } },
-    { "EFI_CAPSULE_ARCH_PROTOCOL_GUID", { 0x5053697e, 0x2cbc, 0x4819, 0x90, 0xd9, 0x5, 0x80, 0xde, 0xee, 0x57, 0x54 } },
-    { "EFI_CAPSULE_GUID", { 0x3B6686BD, 0x0D76, 0x4030, 0xB7, 0x0E, 0xB5, 0x51, 0x9E, 0x2F, 0xC5, 0xA0 } },
-    { "EFI_CAPSULE_INFO_GUID", { 0x8B34EAC7, 0x2690, 0x460B, 0x8B, 0xA5, 0xD5, 0xCF, 0x32, 0x83, 0x17, 0x35 } },
-    { "EFI_CAPSULE_VENDOR_GUID", { 0x711C703F, 0xC285, 0x4B10, 0xA3, 0xB0, 0x36, 0xEC, 0xBD, 0x3C, 0x8B, 0xE2 } },
-    { "EFI_CERT_RSA2048_GUID", { 0x3c5766e8, 0x269c, 0x4e34, 0xaa, 0x14, 0xed, 0x77, 0x6e, 0x85, 0xb3, 0xb6 } },
-    { "EFI_CERT_RSA2048_SHA1_GUID", { 0x67f8444f, 0x8743, 0x48f1, 0xa3, 0x28, 0x1e, 0xaa, 0xb8, 0x73, 0x60, 0x80 } },
-    { "EFI_CERT_RSA2048_SHA256_GUID", { 0xe2b36190, 0x879b, 0x4a3d, 0xad, 0x8d, 0xf2, 0xe7, 0xbb, 0xa3, 0x27, 0x84 } },
-    { "EFI_CERT_SHA1_GUID", { 0x826ca512, 0xcf10, 0x4ac9, 0xb1, 0x87, 0xbe, 0x1, 0x49, 0x66, 0x31, 0xbd } },
-    { "EFI_CERT_SHA224_GUID", { 0xb6e5233, 0xa65c, 0x44c9, 0x94, 0x7, 0xd9, 0xab, 0x83, 0xbf, 0xc8, 0xbd } },
-    { "EFI_CERT_SHA256_GUID", { 0xc1c41626, 0x504c, 0x4092, 0xac, 0xa9, 0x41, 0xf9, 0x36, 0x93, 0x43, 0x28 } },
-    { "EFI_CERT_SHA384_GUID", { 0xff3e5307, 0x9fd0, 0x48c9, 0x85, 0xf1, 0x8a, 0xd5, 0x6c, 0x70, 0x1e, 0x1 } },
-    { "EFI_CERT_SHA512_GUID", { 0x93e0fae, 0xa6c4, 0x4f50, 0x9f, 0x1b, 0xd4, 0x1e, 0x2b, 0x89, 0xc1, 0x9a } },
-    { "EFI_CERT_TYPE_PKCS7_GUID", { 0x4aafd29d, 0x68df, 0x49ee, 0x8a, 0xa9, 0x34, 0x7d, 0x37, 0x56, 0x65, 0xa7 } },
-    { "EFI_CERT_TYPE_RSA2048_SHA256_GUID", { 0xa7717414, 0xc616, 0x4977, 0x94, 0x20, 0x84, 0x47, 0x12, 0xa7, 0x35, 0xbf } },
-    { "EFI_CERT_X509_GUID", { 0xa5c059a1, 0x94e4, 0x4aa7, 0x87, 0xb5, 0xab, 0x15, 0x5c, 0x2b, 0xf0, 0x72 } },
-    { "EFI_COMPATIBLE_MEMORY_TESTED_PROTOCOL_GUID", { 0x64c475ef, 0x344b, 0x492c, 0x93, 0xad, 0xab, 0x9e, 0xb4, 0x39, 0x50, 0x4 } },
-    { "EFI_COMPONENT_NAME2_PROTOCOL_GUID", { 0x6a7a5cff, 0xe8d9, 0x4f70, 0xba, 0xda, 0x75, 0xab, 0x30, 0x25, 0xce, 0x14 } },
-    { "EFI_COMPONENT_NAME_PROTOCOL_GUID", { 0x107a772c, 0xd5e1, 0x11d4, 0x9a, 0x46, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d } },
-    { "EFI_CONFIG_FILE_NAME_GUID", { 0x98B8D59B, 0xE8BA, 0x48EE, 0x98, 0xDD, 0xC2, 0x95, 0x39, 0x2F, 0x1E, 0xDB } },
-    { "EFI_CONSOLE_CONTROL_PROTOCOL_GUID", { 0xf42f7782, 0x12e, 0x4c12, 0x99, 0x56, 0x49, 0xf9, 0x43, 0x4, 0xf7, 0x21 } },
-    { "EFI_CONSOLE_IN_DEVICE_GUID", { 0xd3b36f2b, 0xd551, 0x11d4, 0x9a, 0x46, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d } },
-    { "EFI_CONSOLE_OUT_DEVICE_GUID", { 0xd3b36f2c, 0xd551, 0x11d4, 0x9a, 0x46, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d } },
-    { "EFI_CPU_ARCH_PROTOCOL_GUID", { 0x26baccb1, 0x6f42, 0x11d4, 0xbc, 0xe7, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 } },
-    { "EFI_CPU_IO2_PROTOCOL_GUID", { 0xad61f191, 0xae5f, 0x4c0e, 0xb9, 0xfa, 0xe8, 0x69, 0xd2, 0x88, 0xc6, 0x4f } },
-    { "EFI_CPU_IO_PROTOCOL_GUID", { 0xB0732526, 0x38C8, 0x4b40, 0x88, 0x77, 0x61, 0xC7, 0xB0, 0x6A, 0xAC, 0x45 } },
-    { "EFI_CRC32_GUIDED_SECTION_EXTRACTION_GUID", { 0xFC1BCDB0, 0x7D31, 0x49aa, 0x93, 0x6A, 0xA4, 0x60, 0x0D, 0x9D, 0xD0, 0x83 } },
-    { "EFI_CRC32_GUIDED_SECTION_EXTRACTION_PROTOCOL_GUID", { 0xFC1BCDB0, 0x7D31, 0x49aa, 0x93, 0x6A, 0xA4, 0x60, 0x0D, 0x9D, 0xD0, 0x83 } },
-    { "EFI_CUSTOMIZED_DECOMPRESS_PROTOCOL_GUID", { 0x9a44198e, 0xa4a2, 0x44e6, 0x8a, 0x1f, 0x39, 0xbe, 0xfd, 0xac, 0x89, 0x6f } },
-    { "EFI_DATA_HUB_PROTOCOL_GUID", { 0xae80d021, 0x618e, 0x11d4, 0xbc, 0xd7, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 } },
-    { "EFI_DATA_HUB_STATUS_CODE_RECORD_GUID", { 0xd083e94c, 0x6560, 0x42e4, 0xb6, 0xd4, 0x2d, 0xf7, 0x5a, 0xdf, 0x6a, 0x2a } },
-    { "EFI_DEBUGPORT_PROTOCOL_GUID", { 0xEBA4E8D2, 0x3858, 0x41EC, 0xA2, 0x81, 0x26, 0x47, 0xBA, 0x96, 0x60, 0xD0 } },
-    { "EFI_DEBUG_AGENT_GUID", { 0x865a5a9b, 0xb85d, 0x474c, 0x84, 0x55, 0x65, 0xd1, 0xbe, 0x84, 0x4b, 0xe2 } },
-    { "EFI_DEBUG_ASSERT_PROTOCOL_GUID", { 0xbe499c92, 0x7d4b, 0x11d4, 0xbc, 0xee, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 } },
-    { "EFI_DEBUG_IMAGE_INFO_TABLE_GUID", { 0x49152e77, 0x1ada, 0x4764, 0xb7, 0xa2, 0x7a, 0xfe, 0xfe, 0xd9, 0x5e, 0x8b } },
-    { "EFI_DEBUG_MASK_PROTOCOL_GUID", { 0x4c8a2451, 0xc207, 0x405b, 0x96, 0x94, 0x99, 0xea, 0x13, 0x25, 0x13, 0x41 } },
-    { "EFI_DEBUG_SERIAL_IO_PROTOCOL_GUID", { 0xe683dc4f, 0x9ed, 0x4f22, 0x86, 0x6b, 0x8e, 0x40, 0x46, 0x94, 0x7c, 0x6c } },
-    { "EFI_DEBUG_SUPPORT_PERIODIC_CALLBACK_PROTOCOL_GUID", { 0x9546e07c, 0x2cbb, 0x4c88, 0x98, 0x6c, 0xcd, 0x34, 0x10, 0x86, 0xf0, 0x44 } },
-    { "EFI_DEBUG_SUPPORT_PROTOCOL_GUID", { 0x2755590C, 0x6F3C, 0x42FA, 0x9E, 0xA4, 0xA3, 0xBA, 0x54, 0x3C, 0xDA, 0x25 } },
-    { "EFI_DECOMPRESS_PROTOCOL_GUID", { 0xd8117cfe, 0x94a6, 0x11d4, 0x9a, 0x3a, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d } },
-    { "EFI_DEFAULT_BMP_LOGO_GUID", { 0x7BB28B99,0x61BB,0x11d5,0x9A,0x5D,0x00,0x90,0x27,0x3F,0xC1,0x4D } },
-    { "EFI_DEFERRED_IMAGE_LOAD_PROTOCOL_GUID", { 0x15853d7c, 0x3ddf, 0x43e0, 0xa1, 0xcb, 0xeb, 0xf8, 0x5b, 0x8f, 0x87, 0x2c } },
-    { "EFI_DEVICE_IO_PROTOCOL_GUID", { 0xaf6ac311, 0x84c3, 0x11d2, 0x8e, 0x3c, 0x00, 0xa0, 0xc9, 0x69, 0x72, 0x3b } },
-    { "EFI_DEVICE_PATH_FROM_TEXT_PROTOCOL_GUID", { 0x5c99a21, 0xc70f, 0x4ad2, 0x8a, 0x5f, 0x35, 0xdf, 0x33, 0x43, 0xf5, 0x1e } },
-    { "EFI_DEVICE_PATH_PROTOCOL_GUID", { 0x9576e91, 0x6d3f, 0x11d2, 0x8e, 0x39, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b } },
-    { "EFI_DEVICE_PATH_TO_TEXT_PROTOCOL_GUID", { 0x8b843e20, 0x8132, 0x4852, 0x90, 0xcc, 0x55, 0x1a, 0x4e, 0x4a, 0x7f, 0x1c } },
-    { "EFI_DEVICE_PATH_UTILITIES_PROTOCOL_GUID", { 0x379be4e, 0xd706, 0x437d, 0xb0, 0x37, 0xed, 0xb8, 0x2f, 0xb7, 0x72, 0xa4 } },
-    { "EFI_DHCP4_PROTOCOL_GUID", { 0x8a219718, 0x4ef5, 0x4761, 0x91, 0xc8, 0xc0, 0xf0, 0x4b, 0xda, 0x9e, 0x56 } },
-    { "EFI_DHCP4_SERVICE_BINDING_PROTOCOL_GUID", { 0x9d9a39d8, 0xbd42, 0x4a73, 0xa4, 0xd5, 0x8e, 0xe9, 0x4b, 0xe1, 0x13, 0x80 } },
-    { "EFI_DHCP6_PROTOCOL_GUID", { 0x87c8bad7, 0x595, 0x4053, 0x82, 0x97, 0xde, 0xde, 0x39, 0x5f, 0x5d, 0x5b } },
-    { "EFI_DHCP6_SERVICE_BINDING_PROTOCOL_GUID", { 0x9fb9a8a1, 0x2f4a, 0x43a6, 0x88, 0x9c, 0xd0, 0xf7, 0xb6, 0xc4, 0x7a, 0xd5 } },
-    { "EFI_DISK_INFO_AHCI_INTERFACE_GUID", { 0x9e498932, 0x4abc, 0x45af, 0xa3, 0x4d, 0x2, 0x47, 0x78, 0x7b, 0xe7, 0xc6 } },
-    { "EFI_DISK_INFO_IDE_INTERFACE_GUID", { 0x5e948fe3, 0x26d3, 0x42b5, 0xaf, 0x17, 0x61, 0x2, 0x87, 0x18, 0x8d, 0xec } },
-    { "EFI_DISK_INFO_PROTOCOL_GUID", { 0xd432a67f, 0x14dc, 0x484b, 0xb3, 0xbb, 0x3f, 0x2, 0x91, 0x84, 0x93, 0x27 } },
-    { "EFI_DISK_INFO_SCSI_INTERFACE_GUID", { 0x8f74baa, 0xea36, 0x41d9, 0x95, 0x21, 0x21, 0xa7, 0xf, 0x87, 0x80, 0xbc } },
-    { "EFI_DISK_INFO_USB_INTERFACE_GUID", { 0xcb871572, 0xc11a, 0x47b5, 0xb4, 0x92, 0x67, 0x5e, 0xaf, 0xa7, 0x77, 0x27 } },
-    { "EFI_DISK_IO_PROTOCOL_GUID", { 0xce345171, 0xba0b, 0x11d2, 0x8e, 0x4f, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b } },
-    { "EFI_DPC_PROTOCOL_GUID", { 0x480f8ae9, 0xc46, 0x4aa9, 0xbc, 0x89, 0xdb, 0x9f, 0xba, 0x61, 0x98, 0x6 } },
-    { "EFI_DRIVER_BINDING_PROTOCOL_GUID", { 0x18a031ab, 0xb443, 0x4d1a, 0xa5, 0xc0, 0xc, 0x9, 0x26, 0x1e, 0x9f, 0x71 } },
-    { "EFI_DRIVER_CONFIGURATION2_PROTOCOL_GUID", { 0xbfd7dc1d, 0x24f1, 0x40d9, 0x82, 0xe7, 0x2e, 0x09, 0xbb, 0x6b, 0x4e, 0xbe } },
-    { "EFI_DRIVER_CONFIGURATION_PROTOCOL_GUID", { 0x107a772b, 0xd5e1, 0x11d4, 0x9a, 0x46, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d } },
-    { "EFI_DRIVER_DIAGNOSTICS2_PROTOCOL_GUID", { 0x4d330321, 0x025f, 0x4aac, 0x90, 0xd8, 0x5e, 0xd9, 0x0, 0x17, 0x3b, 0x63 } },
-    { "EFI_DRIVER_DIAGNOSTICS_PROTOCOL_GUID", { 0x0784924f, 0xe296, 0x11d4, 0x9a, 0x49, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d } },
-    { "EFI_DRIVER_FAMILY_OVERRIDE_PROTOCOL_GUID", { 0xb1ee129e, 0xda36, 0x4181, 0x91, 0xf8, 0x4, 0xa4, 0x92, 0x37, 0x66, 0xa7 } },
-    { "EFI_DRIVER_HEALTH_PROTOCOL_GUID", { 0x2a534210, 0x9280, 0x41d8, 0xae, 0x79, 0xca, 0xda, 0x1, 0xa2, 0xb1, 0x27 } },
-    { "EFI_DRIVER_SUPPORTED_EFI_VERSION_PROTOCOL_GUID", { 0x5c198761, 0x16a8, 0x4e69, 0x97, 0x2c, 0x89, 0xd6, 0x79, 0x54, 0xf8, 0x1d } },
-    { "EFI_DXE_IPL_PPI_GUID", { 0xae8ce5d, 0xe448, 0x4437, 0xa8, 0xd7, 0xeb, 0xf5, 0xf1, 0x94, 0xf7, 0x31 } },
-    { "EFI_DXE_SERVICES_TABLE_GUID", { 0x5ad34ba, 0x6f02, 0x4214, 0x95, 0x2e, 0x4d, 0xa0, 0x39, 0x8e, 0x2b, 0xb9 } },
-    { "EFI_DXE_SMM_READY_TO_LOCK_PROTOCOL_GUID", { 0x60ff8964, 0xe906, 0x41d0, 0xaf, 0xed, 0xf2, 0x41, 0xe9, 0x74, 0xe0, 0x8e } },
-    { "EFI_EAP_MANAGEMENT_PROTOCOL_GUID", { 0xbb62e663, 0x625d, 0x40b2, 0xa0, 0x88, 0xbb, 0xe8, 0x36, 0x23, 0xa2, 0x45 } },
-    { "EFI_EAP_PROTOCOL_GUID", { 0x5d9f96db, 0xe731, 0x4caa, 0xa0, 0xd, 0x72, 0xe1, 0x87, 0xcd, 0x77, 0x62 } },
-    { "EFI_EBC_INTERPRETER_PROTOCOL_GUID", { 0x13AC6DD1, 0x73D0, 0x11D4, 0xB0, 0x6B, 0x00, 0xAA, 0x00, 0xBD, 0x6D, 0xE7 } },
-    { "EFI_EBC_SIMPLE_DEBUGGER_PROTOCOL_GUID", { 0x2a72d11e, 0x7376, 0x40f6, 0x9c, 0x68, 0x23, 0xfa, 0x2f, 0xe3, 0x63, 0xf1 } },
-    { "EFI_EBC_VM_TEST_PROTOCOL_GUID", { 0xAAEACCFD, 0xF27B, 0x4C17, 0xB6, 0x10, 0x75, 0xCA, 0x1F, 0x2D, 0xFB, 0x52 } },
-    { "EFI_EBC_VM_TEST_PROTOCOL_GUID", { 0xAAEACCFDL, 0xF27B, 0x4C17, 0xB6, 0x10, 0x75, 0xCA, 0x1F, 0x2D, 0xFB, 0x52 } },
-    { "EFI_EDID_ACTIVE_PROTOCOL_GUID", { 0xbd8c1056, 0x9f36, 0x44ec, 0x92, 0xa8, 0xa6, 0x33, 0x7f, 0x81, 0x79, 0x86 } },
-    { "EFI_EDID_DISCOVERED_PROTOCOL_GUID", { 0x1c0c34f6, 0xd380, 0x41fa, 0xa0, 0x49, 0x8a, 0xd0, 0x6c, 0x1a, 0x66, 0xaa } },
-    { "EFI_EDID_DISCOVERED_PROTOCOL_GUID", { 0x1c0c34f6, 0xd380, 0x41fa, 0xa0, 0x49, 0x8a, 0xd0, 0x6c,0x1a, 0x66, 0xaa } },
-    { "EFI_EDID_OVERRIDE_PROTOCOL_GUID", { 0x48ecb431, 0xfb72, 0x45c0, 0xa9, 0x22, 0xf4, 0x58, 0xfe, 0x4, 0xb, 0xd5 } },
-    { "EFI_EMU_PHYSICAL_DISK_GUID", { 0xf2ba331a, 0x8985, 0x11db, 0xa4, 0x06, 0x00, 0x40, 0xd0, 0x2b, 0x18, 0x35 } },
-    { "EFI_EMU_SYSTEM_CONFIG_GUID", { 0x9C4FB516, 0x3A1E, 0xD847, 0xA1, 0xA1, 0x70, 0x58, 0xB6, 0x98, 0x67, 0x32 } },
-    { "EFI_EMU_VIRTUAL_DISK_GUID", { 0xf2ba331a, 0x8985, 0x11db, 0xa4, 0x06, 0x00, 0x40, 0xd0, 0x2b, 0x18, 0x35 } },
-    { "EFI_END_OF_DXE_EVENT_GROUP_GUID", { 0x2ce967a, 0xdd7e, 0x4ffc, 0x9e, 0xe7, 0x81, 0x0c, 0xf0, 0x47, 0x8, 0x80 } },
-    { "EFI_END_OF_DXE_EVENT_GROUP_GUID", { 0x2ce967a, 0xdd7e, 0x4ffc, 0x9e, 0xe7, 0x81, 0xc, 0xf0, 0x47, 0x8, 0x80 } },
-    { "EFI_ERROR_SECTION_DIRECTED_IO_DMAR_GUID", { 0x71761d37, 0x32b2, 0x45cd, 0xa7, 0xd0, 0xb0, 0xfe, 0xdd, 0x93, 0xe8, 0xcf } },
-    { "EFI_ERROR_SECTION_DMAR_GENERIC_GUID", { 0x5b51fef7, 0xc79d, 0x4434, 0x8f, 0x1b, 0xaa, 0x62, 0xde, 0x3e, 0x2c, 0x64 } },
-    { "EFI_ERROR_SECTION_FW_ERROR_RECORD_GUID", { 0x81212a96, 0x09ed, 0x4996, 0x94, 0x71, 0x8d, 0x72, 0x9c, 0x8e, 0x69, 0xed } },
-    { "EFI_ERROR_SECTION_IOMMU_DMAR_GUID", { 0x036f84e1, 0x7f37, 0x428c, 0xa7, 0x9e, 0x57, 0x5f, 0xdf, 0xaa, 0x84, 0xec } },
-    { "EFI_ERROR_SECTION_PCIE_GUID", { 0xd995e954, 0xbbc1, 0x430f, 0xad, 0x91, 0xb4, 0x4d, 0xcb, 0x3c, 0x6f, 0x35 } },
-    { "EFI_ERROR_SECTION_PCI_DEVICE_GUID", { 0xeb5e4685, 0xca66, 0x4769, 0xb6, 0xa2, 0x26, 0x06, 0x8b, 0x00, 0x13, 0x26 } },
-    { "EFI_ERROR_SECTION_PCI_PCIX_BUS_GUID", { 0xc5753963, 0x3b84, 0x4095, 0xbf, 0x78, 0xed, 0xda, 0xd3, 0xf9, 0xc9, 0xdd } },
-    { "EFI_ERROR_SECTION_PLATFORM_MEMORY_GUID", { 0xa5bc1114, 0x6f64, 0x4ede, 0xb8, 0x63, 0x3e, 0x83, 0xed, 0x7c, 0x83, 0xb1 } },
-    { "EFI_ERROR_SECTION_PROCESSOR_GENERIC_GUID", { 0x9876ccad, 0x47b4, 0x4bdb, 0xb6, 0x5e, 0x16, 0xf1, 0x93, 0xc4, 0xf3, 0xdb } },
-    { "EFI_ERROR_SECTION_PROCESSOR_SPECIFIC_GUID", { 0xdc3ea0b0, 0xa144, 0x4797, 0xb9, 0x5b, 0x53, 0xfa, 0x24, 0x2b, 0x6e, 0x1d } },
-    { "EFI_EVENT_GROUP_DXE_DISPATCH_GUID", { 0x7081e22f, 0xcac6, 0x4053, 0x94, 0x68, 0x67, 0x57, 0x82, 0xcf, 0x88, 0xe5 } },
-    { "EFI_EVENT_LEGACY_BOOT_GUID", { 0x2a571201, 0x4966, 0x47f6, 0x8b, 0x86, 0xf3, 0x1e, 0x41, 0xf3, 0x2f, 0x10 } },
-    { "EFI_EVENT_NOTIFICATION_TYEP_BOOT_GUID", { 0x3D61A466, 0xAB40, 0x409a, 0xA6, 0x98, 0xF3, 0x62, 0xD4, 0x64, 0xB3, 0x8F } },
-    { "EFI_EVENT_NOTIFICATION_TYEP_CMC_GUID", { 0x2DCE8BB1, 0xBDD7, 0x450e, 0xB9, 0xAD, 0x9C, 0xF4, 0xEB, 0xD4, 0xF8, 0x90 } },
-    { "EFI_EVENT_NOTIFICATION_TYEP_CPE_GUID", { 0x4E292F96, 0xD843, 0x4a55, 0xA8, 0xC2, 0xD4, 0x81, 0xF2, 0x7E, 0xBE, 0xEE } },
-    { "EFI_EVENT_NOTIFICATION_TYEP_DMAR_GUID", { 0x667DD791, 0xC6B3, 0x4c27, 0x8A, 0x6B, 0x0F, 0x8E, 0x72, 0x2D, 0xEB, 0x41 } },
-    { "EFI_EVENT_NOTIFICATION_TYEP_INIT_GUID", { 0xCC5263E8, 0x9308, 0x454a, 0x89, 0xD0, 0x34, 0x0B, 0xD3, 0x9B, 0xC9, 0x8E } },
-    { "EFI_EVENT_NOTIFICATION_TYEP_MCE_GUID", { 0xE8F56FFE, 0x919C, 0x4cc5, 0xBA, 0x88, 0x65, 0xAB, 0xE1, 0x49, 0x13, 0xBB } },
-    { "EFI_EVENT_NOTIFICATION_TYEP_NMI_GUID", { 0x5BAD89FF, 0xB7E6, 0x42c9, 0x81, 0x4A, 0xCF, 0x24, 0x85, 0xD6, 0xE9, 0x8A } },
-    { "EFI_EVENT_NOTIFICATION_TYEP_PCIE_GUID", { 0xCF93C01F, 0x1A16, 0x4dfc, 0xB8, 0xBC, 0x9C, 0x4D, 0xAF, 0x67, 0xC1, 0x04 } },
-    { "EFI_EXTENDED_SAL_BASE_IO_SERVICES_PROTOCOL_GUID", { 0x5aea42b5, 0x31e1, 0x4515, 0xbc, 0x31, 0xb8, 0xd5, 0x25, 0x75, 0x65, 0xa6 } },
-    { "EFI_EXTENDED_SAL_BASE_SERVICES_PROTOCOL_GUID", { 0xd9e9fa06, 0x0fe0, 0x41c3, 0x96, 0xfb, 0x83, 0x42, 0x5a, 0x33, 0x94, 0xf8 } },
-    { "EFI_EXTENDED_SAL_CACHE_SERVICES_PROTOCOL_GUID", { 0xedc9494, 0x2743, 0x4ba5, 0x88, 0x18, 0x0a, 0xef, 0x52, 0x13, 0xf1, 0x88 } },
-    { "EFI_EXTENDED_SAL_ELOG_SERVICES_PROTOCOL_GUID", { 0xd5e4ee5f, 0x3e0a, 0x453c, 0xa7, 0x25, 0xb6, 0x92, 0xbb, 0x6, 0x36, 0x5a } },
-    { "EFI_EXTENDED_SAL_FV_BLOCK_SERVICES_PROTOCOL_GUID", { 0xa2271df1, 0xbcbb, 0x4f1d, 0x98, 0xa9, 0x06, 0xbc, 0x17, 0x2f, 0x07, 0x1a } },
-    { "EFI_EXTENDED_SAL_LOCK_SERVICES_PROTOCOL_GUID", { 0x76b75c23, 0xfe4f, 0x4e17, 0xa2, 0xad, 0x1a, 0x65, 0x3d, 0xbb, 0x49, 0x4a } },
-    { "EFI_EXTENDED_SAL_MCA_LOG_SERVICES_PROTOCOL_GUID", { 0xcb3fd86e, 0x38a3, 0x4c03, 0x9a, 0x5c, 0x90, 0xcf, 0xa3, 0xa2, 0xab, 0x7a } },
-    { "EFI_EXTENDED_SAL_MCA_SERVICES_PROTOCOL_GUID", { 0x2a591128, 0x6cc7, 0x42b1, 0x8a, 0xf0, 0x58, 0x93, 0x3b, 0x68, 0x2d, 0xbb } },
-    { "EFI_EXTENDED_SAL_MP_SERVICES_PROTOCOL_GUID", { 0x697d81a2, 0xcf18, 0x4dc0, 0x9e, 0x0d, 0x06, 0x11, 0x3b, 0x61, 0x8a, 0x3f } },
-    { "EFI_EXTENDED_SAL_MTC_SERVICES_PROTOCOL_GUID", { 0x899afd18, 0x75e8, 0x408b, 0xa4, 0x1a, 0x6e, 0x2e, 0x7e, 0xcd, 0xf4, 0x54 } },
-    { "EFI_EXTENDED_SAL_PAL_SERVICES_PROTOCOL_GUID", { 0xe1cd9d21, 0x0fc2, 0x438d, 0x97, 0x03, 0x04, 0xe6, 0x6d, 0x96, 0x1e, 0x57 } },
-    { "EFI_EXTENDED_SAL_PCI_SERVICES_PROTOCOL_GUID", { 0xa46b1a31, 0xad66, 0x4905, 0x92, 0xf6, 0x2b, 0x46, 0x59, 0xdc, 0x30, 0x63 } },
-    { "EFI_EXTENDED_SAL_RESET_SERVICES_PROTOCOL_GUID", { 0x7d019990, 0x8ce1, 0x46f5, 0xa7, 0x76, 0x3c, 0x51, 0x98, 0x67, 0x6a, 0xa0 } },
-    { "EFI_EXTENDED_SAL_RTC_SERVICES_PROTOCOL_GUID", { 0x7e97a470, 0xefdb, 0x4d02, 0x8f, 0xce, 0x61, 0x90, 0xd2, 0x7b, 0xa2, 0x96 } },
-    { "EFI_EXTENDED_SAL_SENSOR_SERVICES_PROTOCOL_GUID", { 0x4a153b6e, 0x85a1, 0x4982, 0x98, 0xf4, 0x6a, 0x8c, 0xfc, 0xa4, 0xab, 0xa1 } },
-    { "EFI_EXTENDED_SAL_SM_COM_LAYER_SERVICES_PROTOCOL_GUID", { 0x4356799, 0x81b7, 0x4e08, 0xa3, 0x8d, 0xd9, 0x78, 0xfa, 0x47, 0xba, 0x42 } },
-    { "EFI_EXTENDED_SAL_SST_GUID", { 0x38802700, 0x868a, 0x4b4e, 0x81, 0xd4, 0x4f, 0x1b, 0xdc, 0xcf, 0xb4, 0x6f } },
-    { "EFI_EXTENDED_SAL_STALL_SERVICES_PROTOCOL_GUID", { 0x53a58d06, 0xac27, 0x4d8c, 0xb5, 0xe9, 0xf0, 0x8a, 0x80, 0x65, 0x41, 0x70 } },
-    { "EFI_EXTENDED_SAL_STATUS_CODE_SERVICES_PROTOCOL_GUID", { 0xdbd91d, 0x55e9, 0x420f, 0x96, 0x39, 0x5e, 0x9f, 0x84, 0x37, 0xb4, 0x4f } },
-    { "EFI_EXTENDED_SAL_VARIABLE_SERVICES_PROTOCOL_GUID", { 0x4ecb6c53, 0xc641, 0x4370, 0x8c, 0xb2, 0x3b, 0x0e, 0x49, 0x6e, 0x83, 0x78 } },
-    { "EFI_EXTENDED_SAL_VIRTUAL_SERVICES_PROTOCOL_GUID", { 0xc1a74056, 0x260e, 0x4871, 0xa0, 0x31, 0xe6, 0x45, 0xa6, 0x5b, 0x6e, 0x11 } },
-    { "EFI_EXT_SCSI_PASS_THRU_PROTOCOL_GUID", { 0x143b7632, 0xb81b, 0x4cb7, 0xab, 0xd3, 0xb6, 0x25, 0xa5, 0xb9, 0xbf, 0xfe } },
-    { "EFI_FAULT_TOLERANT_WRITE_PROTOCOL_GUID", { 0x3ebd9e82, 0x2c78, 0x4de6, 0x97, 0x86, 0x8d, 0x4b, 0xfc, 0xb7, 0xc8, 0x81 } },
-    { "EFI_FFS_VOLUME_TOP_FILE_GUID", { 0x1BA0062E, 0xC779, 0x4582, 0x85, 0x66, 0x33, 0x6A, 0xE8, 0xF7, 0x8F, 0x09 } },
-    { "EFI_FILE_SYSTEM_INFO_ID_GUID", { 0x9576e93, 0x6d3f, 0x11d2, 0x8e, 0x39, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b } },
-    { "EFI_FILE_SYSTEM_VOLUME_LABEL_INFO_ID_GUID", { 0xDB47D7D3, 0xFE81, 0x11d3, 0x9A, 0x35, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D } },
-    { "EFI_FIND_FV_PPI_GUID", { 0x36164812, 0xa023, 0x44e5, 0xbd, 0x85, 0x5, 0xbf, 0x3c, 0x77, 0x0, 0xaa } },
-    { "EFI_FIRMWARE_CONTENTS_SIGNED_GUID", { 0xf9d89e8, 0x9259, 0x4f76, 0xa5, 0xaf, 0xc, 0x89, 0xe3, 0x40, 0x23, 0xdf } },
-    { "EFI_FIRMWARE_FILE_SYSTEM2_GUID", { 0x8c8ce578, 0x8a3d, 0x4f1c, 0x99, 0x35, 0x89, 0x61, 0x85, 0xc3, 0x2d, 0xd3 } },
-    { "EFI_FIRMWARE_FILE_SYSTEM3_GUID", { 0x5473c07a, 0x3dcb, 0x4dca, 0xbd, 0x6f, 0x1e, 0x96, 0x89, 0xe7, 0x34, 0x9a } },
-    { "EFI_FIRMWARE_FILE_SYSTEM_GUID", { 0x7A9354D9, 0x0468, 0x444a, 0x81, 0xCE, 0x0B, 0xF6, 0x17, 0xD8, 0x90, 0xDF } },
-    { "EFI_FIRMWARE_MANAGEMENT_PROTOCOL_GUID", { 0x86c77a67, 0xb97, 0x4633, 0xa1, 0x87, 0x49, 0x10, 0x4d, 0x6, 0x85, 0xc7 } },
-    { "EFI_FIRMWARE_PERFORMANCE_GUID", { 0xc095791a, 0x3001, 0x47b2, 0x80, 0xc9, 0xea, 0xc7, 0x31, 0x9f, 0x2f, 0xa4 } },
-    { "EFI_FIRMWARE_VOLUME2_PROTOCOL_GUID", { 0x220e73b6, 0x6bdb, 0x4413, 0x84, 0x5, 0xb9, 0x74, 0xb1, 0x8, 0x61, 0x9a } },
-    { "EFI_FIRMWARE_VOLUME_BLOCK2_PROTOCOL_GUID", { 0x8f644fa9, 0xe850, 0x4db1, 0x9c, 0xe2, 0xb, 0x44, 0x69, 0x8e, 0x8d, 0xa4 } },
-    { "EFI_FIRMWARE_VOLUME_BLOCK_PROTOCOL_GUID", { 0x8f644fa9, 0xe850, 0x4db1, 0x9c, 0xe2, 0xb, 0x44, 0x69, 0x8e, 0x8d, 0xa4 } },
-    { "EFI_FIRMWARE_VOLUME_DISPATCH_PROTOCOL_GUID", { 0x7aa35a69, 0x506c, 0x444f, 0xa7, 0xaf, 0x69, 0x4b, 0xf5, 0x6f, 0x71, 0xc8 } },
-    { "EFI_FIRMWARE_VOLUME_PROTOCOL_GUID", { 0x389F751F, 0x1838, 0x4388, 0x83, 0x90, 0xCD, 0x81, 0x54, 0xBD, 0x27, 0xF8 } },
-    { "EFI_FORM_BROWSER2_PROTOCOL_GUID", { 0xb9d4c360, 0xbcfb, 0x4f9b, 0x92, 0x98, 0x53, 0xc1, 0x36, 0x98, 0x22, 0x58 } },
-    { "EFI_FORM_BROWSER_COMPATIBILITY_PROTOCOL_GUID", { 0xfb7c852, 0xadca, 0x4853, 0x8d, 0xf, 0xfb, 0xa7, 0x1b, 0x1c, 0xe1, 0x1a } },
-    { "EFI_FORM_BROWSER_PROTOCOL_GUID", { 0xe5a1333e, 0xe1b4, 0x4d55, 0xce, 0xeb, 0x35, 0xc3, 0xef, 0x13, 0x34, 0x43 } },
-    { "EFI_FORM_BROWSER_PROTOCOL_GUID", { 0xfb7c852, 0xadca, 0x4853, 0x8d, 0xf, 0xfb, 0xa7, 0x1b, 0x1c, 0xe1, 0x1a } },
-    { "EFI_FORM_CALLBACK_PROTOCOL_GUID", { 0xf3e4543d, 0xcf35, 0x6cef, 0x35, 0xc4, 0x4f, 0xe6, 0x34, 0x4d, 0xfc, 0x54 } },
-    { "EFI_FRAMEWORK_DEVICE_PATH_GUID", { 0xb7084e63, 0x46b7, 0x4d1a, 0x86, 0x77, 0xe3, 0x0b, 0x53, 0xdb, 0xf0, 0x50 } },
-    { "EFI_FTP4_PROTOCOL_GUID", { 0xeb338826, 0x681b, 0x4295, 0xb3, 0x56, 0x2b, 0x36, 0x4c, 0x75, 0x7b, 0x9 } },
-    { "EFI_FTP4_SERVICE_BINDING_PROTOCOL_GUID", { 0xfaaecb1, 0x226e, 0x4782, 0xaa, 0xce, 0x7d, 0xb9, 0xbc, 0xbf, 0x4d, 0xaf } },
-    { "EFI_FTW_LITE_PROTOCOL_GUID", { 0x3f557189, 0x8dae, 0x45ae, 0xa0, 0xb3, 0x2b, 0x99, 0xca, 0x7a, 0xa7, 0xa0 } },
-    { "EFI_FVB_EXTENSION_PROTOCOL_GUID", { 0x53a4c71b, 0xb581, 0x4170, 0x91, 0xb3, 0x8d, 0xb8, 0x7a, 0x4b, 0x5c, 0x46 } },
-    { "EFI_GENERIC_MEMORY_TEST_PROTOCOL_GUID", { 0x309de7f1, 0x7f5e, 0x4ace, 0xb4, 0x9c, 0x53, 0x1b, 0xe5, 0xaa, 0x95, 0xef } },
-    { "EFI_GENERIC_VARIABLE_GUID", { 0x59d1c24f, 0x50f1, 0x401a, 0xb1, 0x01, 0xf3, 0x3e, 0x0d, 0xae, 0xd4, 0x43 } },
-    { "EFI_GLOBAL_VARIABLE_GUID", { 0x8BE4DF61, 0x93CA, 0x11d2, 0xAA, 0x0D, 0x00, 0xE0, 0x98, 0x03, 0x2B, 0x8C } },
-    { "EFI_GRAPHICS_OUTPUT_PROTOCOL_GUID", { 0x9042a9de, 0x23dc, 0x4a38, 0x96, 0xfb, 0x7a, 0xde, 0xd0, 0x80, 0x51, 0x6a } },
-    { "EFI_HARDWARE_ERROR_VARIABLE_GUID", { 0x414E6BDD, 0xE47B, 0x47cc, 0xB2, 0x44, 0xBB, 0x61, 0x02, 0x0C, 0xF5, 0x16 } },
-    { "EFI_HASH_ALGORITHM_SHA1_GUID", { 0x2ae9d80f, 0x3fb2, 0x4095, 0xb7, 0xb1, 0xe9, 0x31, 0x57, 0xb9, 0x46, 0xb6 } },
-    { "EFI_HASH_ALGORITHM_SHA1_NOPAD_GUID", { 0x24c5dc2f, 0x53e2, 0x40ca, 0x9e, 0xd6, 0xa5, 0xd9, 0xa4, 0x9f, 0x46, 0x3b } },
-    { "EFI_HASH_ALGORITHM_SHA224_GUID", { 0x8df01a06, 0x9bd5, 0x4bf7, 0xb0, 0x21, 0xdb, 0x4f, 0xd9, 0xcc, 0xf4, 0x5b } },
-    { "EFI_HASH_ALGORITHM_SHA256_GUID", { 0x51aa59de, 0xfdf2, 0x4ea3, 0xbc, 0x63, 0x87, 0x5f, 0xb7, 0x84, 0x2e, 0xe9 } },
-    { "EFI_HASH_ALGORITHM_SHA256_NOPAD_GUID", { 0x8628752a, 0x6cb7, 0x4814, 0x96, 0xfc, 0x24, 0xa8, 0x15, 0xac, 0x22, 0x26 } },
-    { "EFI_HASH_ALGORITHM_SHA384_GUID", { 0xefa96432, 0xde33, 0x4dd2, 0xae, 0xe6, 0x32, 0x8c, 0x33, 0xdf, 0x77, 0x7a } },
-    { "EFI_HASH_ALGORITHM_SHA512_GUID", { 0xcaa4381e, 0x750c, 0x4770, 0xb8, 0x70, 0x7a, 0x23, 0xb4, 0xe4, 0x21, 0x30 } },
-    { "EFI_HASH_ALGORTIHM_MD5_GUID", { 0xaf7c79c, 0x65b5, 0x4319, 0xb0, 0xae, 0x44, 0xec, 0x48, 0x4e, 0x4a, 0xd7 } },
-    { "EFI_HASH_PROTOCOL_GUID", { 0xc5184932, 0xdba5, 0x46db, 0xa5, 0xba, 0xcc, 0x0b, 0xda, 0x9c, 0x14, 0x35 } },
-    { "EFI_HASH_SERVICE_BINDING_PROTOCOL_GUID", { 0x42881c98, 0xa4f3, 0x44b0, 0xa3, 0x9d, 0xdf, 0xa1, 0x86, 0x67, 0xd8, 0xcd } },
-    { "EFI_HII_COMPATIBILITY_PROTOCOL_GUID", { 0x5542cce1, 0xdf5c, 0x4d1b, 0xab, 0xca, 0x36, 0x4f, 0x77, 0xd3, 0x99, 0xfb } },
-    { "EFI_HII_CONFIG_ACCESS_PROTOCOL_GUID", { 0x330d4706, 0xf2a0, 0x4e4f, 0xa3, 0x69, 0xb6, 0x6f, 0xa8, 0xd5, 0x43, 0x85 } },
-    { "EFI_HII_CONFIG_ROUTING_PROTOCOL_GUID", { 0x587e72d7, 0xcc50, 0x4f79, 0x82, 0x09, 0xca, 0x29, 0x1f, 0xc1, 0xa1, 0x0f } },
-    { "EFI_HII_DATABASE_PROTOCOL_GUID", { 0xef9fc172, 0xa1b2, 0x4693, 0xb3, 0x27, 0x6d, 0x32, 0xfc, 0x41, 0x60, 0x42 } },
-    { "EFI_HII_DRIVER_HEALTH_FORMSET_GUID", { 0xf22fc20c, 0x8cf4, 0x45eb, 0x8e, 0x6, 0xad, 0x4e, 0x50, 0xb9, 0x5d, 0xd3 } },
-    { "EFI_HII_FONT_PROTOCOL_GUID", { 0xe9ca4775, 0x8657, 0x47fc, 0x97, 0xe7, 0x7e, 0xd6, 0x5a, 0x8, 0x43, 0x24 } },
-    { "EFI_HII_FRONT_PAGE_CLASS_GUID", { 0x94d411b7, 0x7669, 0x45c3, 0xba, 0x3b, 0xf3, 0xa5, 0x8a, 0x71, 0x56, 0x81 } },
-    { "EFI_HII_IMAGE_PROTOCOL_GUID", { 0x31a6406a, 0x6bdf, 0x4e46, 0xb2, 0xa2, 0xeb, 0xaa, 0x89, 0xc4, 0x9, 0x20 } },
-    { "EFI_HII_PACKAGE_LIST_PROTOCOL_GUID", { 0x6a1ee763, 0xd47a, 0x43b4, 0xaa, 0xbe, 0xef, 0x1d, 0xe2, 0xab, 0x56, 0xfc } },
-    { "EFI_HII_PLATFORM_SETUP_FORMSET_GUID", { 0x93039971, 0x8545, 0x4b04, 0xb4, 0x5e, 0x32, 0xeb, 0x83, 0x26, 0x4, 0xe } },
-    { "EFI_HII_PROTOCOL_GUID", { 0x5542cce1, 0xdf5c, 0x4d1b, 0xab, 0xca, 0x36, 0x4f, 0x77, 0xd3, 0x99, 0xfb } },
-    { "EFI_HII_PROTOCOL_GUID", { 0xd7ad636e, 0xb997, 0x459b, 0xbf, 0x3f, 0x88, 0x46, 0x89, 0x79, 0x80, 0xe1 } },
-    { "EFI_HII_SET_KEYBOARD_LAYOUT_EVENT_GUID", { 0x14982a4f, 0xb0ed, 0x45b8, 0xa8, 0x11, 0x5a, 0x7a, 0x9b, 0xc2, 0x32, 0xdf } },
-    { "EFI_HII_STANDARD_FORM_GUID", { 0x3bd2f4ec, 0xe524, 0x46e4, 0xa9, 0xd8, 0x51, 0x1, 0x17, 0x42, 0x55, 0x62 } },
-    { "EFI_HII_STRING_PROTOCOL_GUID", { 0xfd96974, 0x23aa, 0x4cdc, 0xb9, 0xcb, 0x98, 0xd1, 0x77, 0x50, 0x32, 0x2a } },
-    { "EFI_HII_USER_CREDENTIAL_FORMSET_GUID", { 0x337f4407, 0x5aee, 0x4b83, 0xb2, 0xa7, 0x4e, 0xad, 0xca, 0x30, 0x88, 0xcd } },
-    { "EFI_HOB_LIST_GUID", { 0x7739f24c, 0x93d7, 0x11d4, 0x9a, 0x3a, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d } },
-    { "EFI_HOB_MEMORY_ALLOC_BSP_STORE_GUID", { 0x564b33cd, 0xc92a, 0x4593, 0x90, 0xbf, 0x24, 0x73, 0xe4, 0x3c, 0x63, 0x22 } },
-    { "EFI_HOB_MEMORY_ALLOC_STACK_GUID", { 0x4ed4bf27, 0x4092, 0x42e9, 0x80, 0x7d, 0x52, 0x7b, 0x1d, 0x0, 0xc9, 0xbd } },
-    { "EFI_IA32_X64_ERROR_TYPE_BUS_CHECK_GUID", { 0x1CF3F8B3, 0xC5B1, 0x49a2, 0xAA, 0x59, 0x5E, 0xEF, 0x92, 0xFF, 0xA6, 0x3C } },
-    { "EFI_IA32_X64_ERROR_TYPE_CACHE_CHECK_GUID", { 0xA55701F5, 0xE3EF, 0x43de, 0xAC, 0x72, 0x24, 0x9B, 0x57, 0x3F, 0xAD, 0x2C } },
-    { "EFI_IA32_X64_ERROR_TYPE_MS_CHECK_GUID", { 0x48AB7F57, 0xDC34, 0x4f6c, 0xA7, 0xD3, 0xB0, 0xB5, 0xB0, 0xA7, 0x43, 0x14 } },
-    { "EFI_IA32_X64_ERROR_TYPE_TLB_CHECK_GUID", { 0xFC06B535, 0x5E1F, 0x4562, 0x9F, 0x25, 0x0A, 0x3B, 0x9A, 0xDB, 0x63, 0xC3 } },
-    { "EFI_IDE_CONTROLLER_INIT_PROTOCOL_GUID", { 0xa1e37052, 0x80d9, 0x4e65, 0xa3, 0x17, 0x3e, 0x9a, 0x55, 0xc4, 0x3e, 0xc9 } },
-    { "EFI_IFR_FRAMEWORK_GUID", { 0x31ca5d1a, 0xd511, 0x4931, 0xb7, 0x82, 0xae, 0x6b, 0x2b, 0x17, 0x8c, 0xd7 } },
-    { "EFI_IFR_REFRESH_ID_OP_GUID", { 0xF5E655D9, 0x02A6, 0x46f2, 0x9E, 0x76, 0xB8, 0xBE, 0x8E, 0x60, 0xAB, 0x22 } },
-    { "EFI_IFR_TIANO_GUID", { 0xf0b1735, 0x87a0, 0x4193, 0xb2, 0x66, 0x53, 0x8c, 0x38, 0xaf, 0x48, 0xce } },
-    { "EFI_IMAGE_SECURITY_DATABASE_GUID", { 0xd719b2cb, 0x3d3a, 0x4596, 0xa3, 0xbc, 0xda, 0xd0, 0xe, 0x67, 0x65, 0x6f } },
-    { "EFI_INCOMPATIBLE_PCI_DEVICE_SUPPORT_PROTOCOL_GUID", { 0xeb23f55a, 0x7863, 0x4ac2, 0x8d, 0x3d, 0x95, 0x65, 0x35, 0xde, 0x03, 0x75 } },
-    { "EFI_IOBASE_HOB_GUID", { 0xd4a28a3e, 0xdcf2, 0x43cf, 0xa2, 0xb7, 0xf3, 0x57, 0x2a, 0x7c, 0xab, 0x9 } },
-    { "EFI_IP4_CONFIG_PROTOCOL_GUID", { 0x3b95aa31, 0x3793, 0x434b, 0x86, 0x67, 0xc8, 0x07, 0x08, 0x92, 0xe0, 0x5e } },
-    { "EFI_IP4_PROTOCOL_GUID", { 0x41d94cd2, 0x35b6, 0x455a, 0x82, 0x58, 0xd4, 0xe5, 0x13, 0x34, 0xaa, 0xdd } },
-    { "EFI_IP4_SERVICE_BINDING_PROTOCOL_GUID", { 0xc51711e7, 0xb4bf, 0x404a, 0xbf, 0xb8, 0x0a, 0x04, 0x8e, 0xf1, 0xff, 0xe4 } },
-    { "EFI_IP6_CONFIG_PROTOCOL_GUID", { 0x937fe521, 0x95ae, 0x4d1a, 0x89, 0x29, 0x48, 0xbc, 0xd9, 0x0a, 0xd3, 0x1a } },
-    { "EFI_IP6_PROTOCOL_GUID", { 0x2c8759d5, 0x5c2d, 0x66ef, 0x92, 0x5f, 0xb6, 0x6c, 0x10, 0x19, 0x57, 0xe2 } },
-    { "EFI_IP6_SERVICE_BINDING_PROTOCOL_GUID", { 0xec835dd3, 0xfe0f, 0x617b, 0xa6, 0x21, 0xb3, 0x50, 0xc3, 0xe1, 0x33, 0x88 } },
-    { "EFI_IPSEC2_PROTOCOL_GUID", { 0xa3979e64, 0xace8, 0x4ddc, 0xbc, 0x7, 0x4d, 0x66, 0xb8, 0xfd, 0x9, 0x77 } },
-    { "EFI_IPSEC_CONFIG_PROTOCOL_GUID", { 0xce5e5929, 0xc7a3, 0x4602, 0xad, 0x9e, 0xc9, 0xda, 0xf9, 0x4e, 0xbf, 0xcf } },
-    { "EFI_IPSEC_PROTOCOL_GUID", { 0xdfb386f7, 0xe100, 0x43ad, 0x9c, 0x9a, 0xed, 0x90, 0xd0, 0x8a, 0x5e, 0x12 } },
-    { "EFI_ISA_ACPI_PROTOCOL_GUID", { 0x64a892dc, 0x5561, 0x4536, 0x92, 0xc7, 0x79, 0x9b, 0xfc, 0x18, 0x33, 0x55 } },
-    { "EFI_ISA_IO_PROTOCOL_GUID", { 0x7ee2bd44, 0x3da0, 0x11d4, 0x9a, 0x38, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d } },
-    { "EFI_ISCSI_INITIATOR_NAME_PROTOCOL_GUID", { 0x59324945, 0xec44, 0x4c0d, 0xb1, 0xcd, 0x9d, 0xb1, 0x39, 0xdf, 0x7, 0xc } },
-    { "EFI_KMS_FORMAT_AESCBC_128_GUID", { 0xa0e8ee6a, 0x0e92, 0x44d4, 0x86, 0x1b, 0x0e, 0xaa, 0x4a, 0xca, 0x44, 0xa2 } },
-    { "EFI_KMS_FORMAT_AESCBC_256_GUID", { 0xd7e69789, 0x1f68, 0x45e8, 0x96, 0xef, 0x3b, 0x64, 0x07, 0xa5, 0xb2, 0xdc } },
-    { "EFI_KMS_FORMAT_AESXTS_128_GUID", { 0x4776e33f, 0xdb47, 0x479a, 0xa2, 0x5f, 0xa1, 0xcd, 0x0a, 0xfa, 0xb3, 0x8b } },
-    { "EFI_KMS_FORMAT_AESXTS_256_GUID", { 0xdc7e8613, 0xc4bb, 0x4db0, 0x84, 0x62, 0x13, 0x51, 0x13, 0x57, 0xab, 0xe2 } },
-    { "EFI_KMS_FORMAT_GENERIC_1024_GUID", { 0x43be0b44, 0x874b, 0x4ead, 0xb0, 0x9c, 0x24, 0x1a, 0x4f, 0xbd, 0x7e, 0xb3 } },
-    { "EFI_KMS_FORMAT_GENERIC_128_GUID", { 0xec8a3d69, 0x6ddf, 0x4108, 0x94, 0x76, 0x73, 0x37, 0xfc, 0x52, 0x21, 0x36 } },
-    { "EFI_KMS_FORMAT_GENERIC_160_GUID", { 0xa3b3e6f8, 0xefca, 0x4bc1, 0x88, 0xfb, 0xcb, 0x87, 0x33, 0x9b, 0x25, 0x79 } },
-    { "EFI_KMS_FORMAT_GENERIC_2048_GUID", { 0x40093f23, 0x630c, 0x4626, 0x9c, 0x48, 0x40, 0x37, 0x3b, 0x19, 0xcb, 0xbe } },
-    { "EFI_KMS_FORMAT_GENERIC_256_GUID", { 0x70f64793, 0xc323, 0x4261, 0xac, 0x2c, 0xd8, 0x76, 0xf2, 0x7c, 0x53, 0x45 } },
-    { "EFI_KMS_FORMAT_GENERIC_3072_GUID", { 0xb9237513, 0x6c44, 0x4411, 0xa9, 0x90, 0x21, 0xe5, 0x56, 0xe0, 0x5a, 0xde } },
-    { "EFI_KMS_FORMAT_GENERIC_512_GUID", { 0x978fe043, 0xd7af, 0x422e, 0x8a, 0x92, 0x2b, 0x48, 0xe4, 0x63, 0xbd, 0xe6 } },
-    { "EFI_KMS_FORMAT_MD2_128_GUID", { 0x78be11c4, 0xee44, 0x4a22, 0x9f, 0x05, 0x03, 0x85, 0x2e, 0xc5, 0xc9, 0x78 } },
-    { "EFI_KMS_FORMAT_MD4_128_GUID", { 0xd1c17aa1, 0xcac5, 0x400f, 0xbe, 0x17, 0xe2, 0xa2, 0xae, 0x06, 0x67, 0x7c } },
-    { "EFI_KMS_FORMAT_MD5SHA_128_GUID", { 0x1c178237, 0x6897, 0x459e, 0x9d, 0x36, 0x67, 0xce, 0x8e, 0xf9, 0x4f, 0x76 } },
-    { "EFI_KMS_FORMAT_MD5_128_GUID", { 0xdcbc3662, 0x9cda, 0x4b52, 0xa0, 0x4c, 0x82, 0xeb, 0x1d, 0x23, 0x48, 0xc7 } },
-    { "EFI_KMS_FORMAT_MDC2_128_GUID", { 0xf7ad60f8, 0xefa8, 0x44a3, 0x91, 0x13, 0x23, 0x1f, 0x39, 0x9e, 0xb4, 0xc7 } },
-    { "EFI_KMS_FORMAT_MDC4_128_GUID", { 0x3fa4f847, 0xd8eb, 0x4df4, 0xbd, 0x49, 0x10, 0x3a, 0x0a, 0x84, 0x7b, 0xbc } },
-    { "EFI_KMS_FORMAT_RSASHA1_1024_GUID", { 0x56417bed, 0x6bbe, 0x4882, 0x86, 0xa0, 0x3a, 0xe8, 0xbb, 0x17, 0xf8, 0xf9 } },
-    { "EFI_KMS_FORMAT_RSASHA1_2048_GUID", { 0xf66447d4, 0x75a6, 0x463e, 0xa8, 0x19, 0x07, 0x7f, 0x2d, 0xda, 0x05, 0xe9 } },
-    { "EFI_KMS_FORMAT_RSASHA256_2048_GUID", { 0xa477af13, 0x877d, 0x4060, 0xba, 0xa1, 0x25, 0xd1, 0xbe, 0xa0, 0x8a, 0xd3 } },
-    { "EFI_KMS_FORMAT_SHA1_160_GUID", { 0x453c5e5a, 0x482d, 0x43f0, 0x87, 0xc9, 0x59, 0x41, 0xf3, 0xa3, 0x8a, 0xc2 } },
-    { "EFI_KMS_FORMAT_SHA256_256_GUID", { 0x6bb4f5cd, 0x8022, 0x448d, 0xbc, 0x6d, 0x77, 0x1b, 0xae, 0x93, 0x5f, 0xc6 } },
-    { "EFI_KMS_FORMAT_SHA512_512_GUID", { 0x2f240e12, 0xe14d, 0x475c, 0x83, 0xb0, 0xef, 0xff, 0x22, 0xd7, 0x7b, 0xe7 } },
-    { "EFI_KMS_PROTOCOL_GUID", { 0xEC3A978D, 0x7C4E, 0x48FA, 0x9A, 0xBE, 0x6A, 0xD9, 0x1C, 0xC8, 0xF8, 0x11 } },
-    { "EFI_LEGACY_8259_PROTOCOL_GUID", { 0x38321dba, 0x4fe0, 0x4e17, 0x8a, 0xec, 0x41, 0x30, 0x55, 0xea, 0xed, 0xc1 } },
-    { "EFI_LEGACY_BIOS_GUID", { 0x2e3044ac, 0x879f, 0x490f, 0x97, 0x60, 0xbb, 0xdf, 0xaf, 0x69, 0x5f, 0x50 } },
-    { "EFI_LEGACY_BIOS_PLATFORM_PROTOCOL_GUID", { 0x783658a3, 0x4172, 0x4421, 0xa2, 0x99, 0xe0, 0x9, 0x7, 0x9c, 0xc, 0xb4 } },
-    { "EFI_LEGACY_BIOS_PROTOCOL_GUID", { 0xdb9a1e3d, 0x45cb, 0x4abb, 0x85, 0x3b, 0xe5, 0x38, 0x7f, 0xdb, 0x2e, 0x2d } },
-    { "EFI_LEGACY_BIOS_THUNK_PROTOCOL_GUID", { 0x4c51a7ba, 0x7195, 0x442d, 0x87, 0x92, 0xbe, 0xea, 0x6e, 0x2f, 0xf6, 0xec } },
-    { "EFI_LEGACY_DEV_ORDER_VARIABLE_GUID", { 0xa56074db, 0x65fe, 0x45f7, 0xbd, 0x21, 0x2d, 0x2b, 0xdd, 0x8e, 0x96, 0x52 } },
-    { "EFI_LEGACY_INTERRUPT_PROTOCOL_GUID", { 0x31ce593d, 0x108a, 0x485d, 0xad, 0xb2, 0x78, 0xf2, 0x1f, 0x29, 0x66, 0xbe } },
-    { "EFI_LEGACY_REGION2_PROTOCOL_GUID", { 0x70101eaf, 0x85, 0x440c, 0xb3, 0x56, 0x8e, 0xe3, 0x6f, 0xef, 0x24, 0xf0 } },
-    { "EFI_LEGACY_REGION_PROTOCOL_GUID", { 0xfc9013a, 0x568, 0x4ba9, 0x9b, 0x7e, 0xc9, 0xc3, 0x90, 0xa6, 0x60, 0x9b } },
-    { "EFI_LOADED_IMAGE_DEVICE_PATH_PROTOCOL_GUID", { 0xbc62157e, 0x3e33, 0x4fec, 0x99, 0x20, 0x2d, 0x3b, 0x36, 0xd7, 0x50, 0xdf } },
-    { "EFI_LOADED_IMAGE_PROTOCOL_GUID", { 0x5B1B31A1, 0x9562, 0x11d2, 0x8E, 0x3F, 0x00, 0xA0, 0xC9, 0x69, 0x72, 0x3B } },
-    { "EFI_LOAD_FILE2_PROTOCOL_GUID", { 0x4006c0c1, 0xfcb3, 0x403e, 0x99, 0x6d, 0x4a, 0x6c, 0x87, 0x24, 0xe0, 0x6d } },
-    { "EFI_LOAD_FILE_PROTOCOL_GUID", { 0x56EC3091, 0x954C, 0x11d2, 0x8E, 0x3F, 0x00, 0xA0, 0xC9, 0x69, 0x72, 0x3B } },
-    { "EFI_LOAD_FIXED_ADDRESS_CONFIGURATION_TABLE_GUID", { 0x2CA88B53,0xD296,0x4080, 0xA4,0xA5,0xCA,0xD9,0xBA,0xE2,0x4B,0x9 } },
-    { "EFI_LOCK_BOX_PROTOCOL_GUID", { 0xbd445d79, 0xb7ad, 0x4f04, 0x9a, 0xd8, 0x29, 0xbd, 0x20, 0x40, 0xeb, 0x3c } },
-    { "EFI_MANAGED_NETWORK_PROTOCOL_GUID", { 0x7ab33a91, 0xace5, 0x4326, 0xb5, 0x72, 0xe7, 0xee, 0x33, 0xd3, 0x9f, 0x16 } },
-    { "EFI_MANAGED_NETWORK_SERVICE_BINDING_PROTOCOL_GUID", { 0xf36ff770, 0xa7e1, 0x42cf, 0x9e, 0xd2, 0x56, 0xf0, 0xf2, 0x71, 0xf4, 0x4c } },
-    { "EFI_MEASURED_FV_HOB_GUID", { 0xb2360b42, 0x7173, 0x420a, 0x86, 0x96, 0x46, 0xca, 0x6b, 0xab, 0x10, 0x60 } },
-    { "EFI_MEMORY_PRODUCER_GUID", { 0x1d7add6e, 0xb2da, 0x4b0b, 0xb2, 0x9f, 0x49, 0xcb, 0x42, 0xf4, 0x63, 0x56 } },
-    { "EFI_MEMORY_SUBCLASS_GUID", { 0x4E8F4EBB, 0x64B9, 0x4e05, 0x9B, 0x18, 0x4C, 0xFE, 0x49, 0x23, 0x50, 0x97 } },
-    { "EFI_MEMORY_TYPE_INFORMATION_GUID", { 0x4c19049f,0x4137,0x4dd3, 0x9c,0x10,0x8b,0x97,0xa8,0x3f,0xfd,0xfa } },
-    { "EFI_METRONOME_ARCH_PROTOCOL_GUID", { 0x26baccb2, 0x6f42, 0x11d4, 0xbc, 0xe7, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 } },
-    { "EFI_MINI_SHELL_FILE_GUID", { 0x86ad232b, 0xd33a, 0x465c, 0xbf, 0x5f, 0x41, 0x37, 0xb, 0xa9, 0x2f, 0xe2 } },
-    { "EFI_MISC_PRODUCER_GUID", { 0x62512c92, 0x63c4, 0x4d80, 0x82, 0xb1, 0xc1, 0xa4, 0xdc, 0x44, 0x80, 0xe5 } },
-    { "EFI_MISC_SUBCLASS_GUID", { 0x772484B2, 0x7482, 0x4b91, 0x9F, 0x9A, 0xAD, 0x43, 0xF8, 0x1C, 0x58, 0x81 } },
-    { "EFI_MMC_HOST_PROTOCOL_GUID", { 0x3e591c00, 0x9e4a, 0x11df, 0x92, 0x44, 0x00, 0x02, 0xA5, 0xD5, 0xC5, 0x1B } },
-    { "EFI_MONOTONIC_COUNTER_ARCH_PROTOCOL_GUID", { 0x1da97072, 0xbddc, 0x4b30, 0x99, 0xf1, 0x72, 0xa0, 0xb5, 0x6f, 0xff, 0x2a } },
-    { "EFI_MONTONIC_COUNTER_ARCH_PROTOCOL_GUID", { 0x1da97072, 0xbddc, 0x4b30, 0x99, 0xf1, 0x72, 0xa0, 0xb5, 0x6f, 0xff, 0x2a } },
-    { "EFI_MPS_TABLE_GUID", { 0xeb9d2d2f, 0x2d88, 0x11d3, 0x9a, 0x16, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d } },
-    { "EFI_MP_SERVICES_PROTOCOL_GUID", { 0x3fdda605, 0xa76e, 0x4f46, 0xad, 0x29, 0x12, 0xf4, 0x53, 0x1b, 0x3d, 0x08 } },
-    { "EFI_MTFTP4_PROTOCOL_GUID", { 0x78247c57, 0x63db, 0x4708, 0x99, 0xc2, 0xa8, 0xb4, 0xa9, 0xa6, 0x1f, 0x6b } },
-    { "EFI_MTFTP4_SERVICE_BINDING_PROTOCOL_GUID", { 0x2FE800BE, 0x8F01, 0x4aa6, 0x94, 0x6B, 0xD7, 0x13, 0x88, 0xE1, 0x83, 0x3F } },
-    { "EFI_MTFTP6_PROTOCOL_GUID", { 0xbf0a78ba, 0xec29, 0x49cf, 0xa1, 0xc9, 0x7a, 0xe5, 0x4e, 0xab, 0x6a, 0x51 } },
-    { "EFI_MTFTP6_SERVICE_BINDING_PROTOCOL_GUID", { 0xd9760ff3, 0x3cca, 0x4267, 0x80, 0xf9, 0x75, 0x27, 0xfa, 0xfa, 0x42, 0x23 } },
-    { "EFI_NETWORK_INTERFACE_IDENTIFIER_PROTOCOL_GUID", { 0x1ACED566, 0x76ED, 0x4218, 0xBC, 0x81, 0x76, 0x7F, 0x1F, 0x97, 0x7A, 0x89 } },
-    { "EFI_NETWORK_INTERFACE_IDENTIFIER_PROTOCOL_GUID", { 0xE18541CD, 0xF755, 0x4f73, 0x92, 0x8D, 0x64, 0x3C, 0x8A, 0x79, 0xB2, 0x29 } },
-    { "EFI_NIC_IP4_CONFIG_NVDATA_GUID", { 0x9d5b53f, 0xf4b0, 0x4f59, 0xa0, 0xb1, 0x7b, 0x57, 0xd3, 0x5c, 0xe, 0x5 } },
-    { "EFI_NIC_IP4_CONFIG_PROTOCOL_GUID", { 0xdca3d4d, 0x12da, 0x4728, 0xbf, 0x7e, 0x86, 0xce, 0xb9, 0x28, 0xd0, 0x67 } },
-    { "EFI_NIC_IP4_CONFIG_VARIABLE_GUID", { 0xd8944553, 0xc4dd, 0x41f4, 0x9b, 0x30, 0xe1, 0x39, 0x7c, 0xfb, 0x26, 0x7b } },
-    { "EFI_NT_LOAD_AS_DLL_PPI_GUID", { 0xccc53f6b, 0xa03a, 0x4ed8, 0x83, 0x9a, 0x3, 0xd9, 0x9c, 0x2, 0xb4, 0xe3 } },
-    { "EFI_OEM_BADGING_PROTOCOL_GUID", { 0x170e13c0, 0xbf1b, 0x4218, 0x87, 0x1d, 0x2a, 0xbd, 0xc6, 0xf8, 0x87, 0xbc } },
-    { "EFI_PART_TYPE_EFI_SYSTEM_PART_GUID", { 0xc12a7328, 0xf81f, 0x11d2, 0xba, 0x4b, 0x00, 0xa0, 0xc9, 0x3e, 0xc9, 0x3b } },
-    { "EFI_PART_TYPE_LEGACY_MBR_GUID", { 0x024dee41, 0x33e7, 0x11d3, 0x9d, 0x69, 0x00, 0x08, 0xc7, 0x81, 0xf3, 0x9f } },
-    { "EFI_PATH_FILE_NAME_GUID", { 0x7644C181, 0xFA6E, 0x46DA, 0x80, 0xCB, 0x04, 0xB9, 0x90, 0x40, 0x62, 0xE8 } },
-    { "EFI_PCD_PROTOCOL_GUID", { 0x13a3f0f6, 0x264a, 0x3ef0, 0xf2, 0xe0, 0xde, 0xc5, 0x12, 0x34, 0x2f, 0x34 } },
-    { "EFI_PCI_ENUMERATION_COMPLETE_GUID", { 0x30cfe3e7, 0x3de1, 0x4586, 0xbe, 0x20, 0xde, 0xab, 0xa1, 0xb3, 0xb7, 0x93 } },
-    { "EFI_PCI_EXPRESS_BASE_ADDRESS_GUID", { 0x3677d529, 0x326f, 0x4603, 0xa9, 0x26, 0xea, 0xac, 0xe0, 0x1d, 0xcb, 0xb0 } },
-    { "EFI_PCI_HOST_BRIDGE_RESOURCE_ALLOCATION_PROTOCOL_GUID", { 0xCF8034BE, 0x6768, 0x4d8b, 0xB7,0x39,0x7C,0xCE,0x68,0x3A,0x9F,0xBE } },
-    { "EFI_PCI_HOTPLUG_DEVICE_GUID", { 0x0b280816, 0x52e7, 0x4e51, 0xaa, 0x57, 0x11, 0xbd, 0x41, 0xcb, 0xef, 0xc3 } },
-    { "EFI_PCI_HOTPLUG_REQUEST_PROTOCOL_GUID", { 0x19cb87ab, 0x2cb9, 0x4665, 0x83, 0x60, 0xdd, 0xcf, 0x60, 0x54, 0xf7, 0x9d } },
-    { "EFI_PCI_HOT_PLUG_INIT_PROTOCOL_GUID", { 0xaa0e8bc1, 0xdabc, 0x46b0, 0xa8, 0x44, 0x37, 0xb8, 0x16, 0x9b, 0x2b, 0xea } },
-    { "EFI_PCI_IO_PROTOCOL_GUID", { 0x4cf5b200, 0x68b8, 0x4ca5, 0x9e, 0xec, 0xb2, 0x3e, 0x3f, 0x50, 0x2, 0x9a } },
-    { "EFI_PCI_OPTION_ROM_TABLE_GUID", { 0x7462660f, 0x1cbd, 0x48da, 0xad, 0x11, 0x91, 0x71, 0x79, 0x13, 0x83, 0x1c } },
-    { "EFI_PCI_OVERRIDE_GUID", { 0xb5b35764, 0x460c, 0x4a06, 0x99, 0xfc, 0x77, 0xa1, 0x7c, 0x1b, 0x5c, 0xeb } },
-    { "EFI_PCI_PLATFORM_PROTOCOL_GUID", { 0x7d75280, 0x27d4, 0x4d69, 0x90, 0xd0, 0x56, 0x43, 0xe2, 0x38, 0xb3, 0x41 } },
-    { "EFI_PCI_ROOT_BRIDGE_IO_PROTOCOL_GUID", { 0x2f707ebb, 0x4a1a, 0x11d4, 0x9a, 0x38, 0x00, 0x90, 0x27, 0x3f, 0xc1, 0x4d } },
-    { "EFI_PC_ANSI_GUID", { 0xe0c14753, 0xf9be, 0x11d2, 0x9a, 0x0c, 0x00, 0x90, 0x27, 0x3f, 0xc1, 0x4d } },
-    { "EFI_PEI_APRIORI_FILE_NAME_GUID", { 0x1b45cc0a, 0x156a, 0x428a, 0xaf, 0x62, 0x49, 0x86, 0x4d, 0xa0, 0xe6, 0xe6 } },
-    { "EFI_PEI_BOOT_SCRIPT_EXECUTER_PPI_GUID", { 0xabd42895, 0x78cf, 0x4872, 0x84, 0x44, 0x1b, 0x5c, 0x18, 0x0b, 0xfb, 0xff } },
-    { "EFI_PEI_CPU_IO_PPI_INSTALLED_GUID", { 0xe6af1f7b, 0xfc3f, 0x46da, 0xa8, 0x28, 0xa3, 0xb4, 0x57, 0xa4, 0x42, 0x82 } },
-    { "EFI_PEI_DECOMPRESS_PPI_GUID", { 0x1a36e4e7, 0xfab6, 0x476a, 0x8e, 0x75, 0x69, 0x5a, 0x5, 0x76, 0xfd, 0xd7 } },
-    { "EFI_PEI_DEVICE_RECOVERY_MODULE_PPI_GUID", { 0x0DE2CE25, 0x446A, 0x45a7, 0xBF, 0xC9, 0x37, 0xDA, 0x26, 0x34, 0x4B, 0x37 } },
-    { "EFI_PEI_END_OF_PEI_PHASE_PPI_GUID", { 0x605EA650, 0xC65C, 0x42e1, 0xBA, 0x80, 0x91, 0xA5, 0x2A, 0xB6, 0x18, 0xC6 } },
-    { "EFI_PEI_FIND_FV_PPI_GUID", { 0x36164812, 0xa023, 0x44e5, 0xbd, 0x85, 0x5, 0xbf, 0x3c, 0x77, 0x0, 0xaa } },
-    { "EFI_PEI_FIRMWARE_VOLUME_INFO_PPI_GUID", { 0x49edb1c1, 0xbf21, 0x4761, 0xbb, 0x12, 0xeb, 0x0, 0x31, 0xaa, 0xbb, 0x39 } },
-    { "EFI_PEI_FLUSH_INSTRUCTION_CACHE_GUID", { 0xd8117cfc, 0x94a6, 0x11d4, 0x9a, 0x3a, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d } },
-    { "EFI_PEI_LOADED_IMAGE_PPI_GUID", { 0xc1fcd448, 0x6300, 0x4458, 0xb8, 0x64, 0x28, 0xdf, 0x01, 0x53, 0x64, 0xbc } },
-    { "EFI_PEI_LOAD_FILE_GUID", { 0xb9e0abfe, 0x5979, 0x4914, 0x97, 0x7f, 0x6d, 0xee, 0x78, 0xc2, 0x78, 0xa6 } },
-    { "EFI_PEI_LOAD_FILE_PPI_GUID", { 0xb9e0abfe, 0x5979, 0x4914, 0x97, 0x7f, 0x6d, 0xee, 0x78, 0xc2, 0x78, 0xa6 } },
-    { "EFI_PEI_PCD_PPI_GUID", { 0x1f34d25, 0x4de2, 0x23ad, 0x3f, 0xf3, 0x36, 0x35, 0x3f, 0xf3, 0x23, 0xf1 } },
-    { "EFI_PEI_PCI_CFG2_PPI_GUID", { 0x57a449a, 0x1fdc, 0x4c06, 0xbf, 0xc9, 0xf5, 0x3f, 0x6a, 0x99, 0xbb, 0x92 } },
-    { "EFI_PEI_PCI_CFG_PPI_INSTALLED_GUID", { 0xe1f2eba0, 0xf7b9, 0x4a26, 0x86, 0x20, 0x13, 0x12, 0x21, 0x64, 0x2a, 0x90 } },
-    { "EFI_PEI_PERFORMANCE_HOB_GUID", { 0x10f432de, 0xdeec, 0x4631, 0x80, 0xcd, 0x47, 0xf6, 0x5d, 0x8f, 0x80, 0xbb } },
-    { "EFI_PEI_PERMANENT_MEMORY_INSTALLED_PPI_GUID", { 0xf894643d, 0xc449, 0x42d1, 0x8e, 0xa8, 0x85, 0xbd, 0xd8, 0xc6, 0x5b, 0xde } },
-    { "EFI_PEI_PE_COFF_LOADER_GUID", { 0xd8117cff, 0x94a6, 0x11d4, 0x9a, 0x3a, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d } },
-    { "EFI_PEI_READ_ONLY_VARIABLE2_PPI_GUID", { 0x2ab86ef5, 0xecb5, 0x4134, 0xb5, 0x56, 0x38, 0x54, 0xca, 0x1f, 0xe1, 0xb4 } },
-    { "EFI_PEI_READ_ONLY_VARIABLE_ACCESS_PPI_GUID", { 0x3cdc90c6, 0x13fb, 0x4a75, 0x9e, 0x79, 0x59, 0xe9, 0xdd, 0x78, 0xb9, 0xfa } },
-    { "EFI_PEI_RECOVERY_BLOCK_IO_PPI_GUID", { 0x695d8aa1, 0x42ee, 0x4c46, 0x80, 0x5c, 0x6e, 0xa6, 0xbc, 0xe7, 0x99, 0xe3 } },
-    { "EFI_PEI_RECOVERY_MODULE_PPI_GUID", { 0xFB6D9542, 0x612D, 0x4f45, 0x87, 0x2F, 0x5C, 0xFF, 0x52, 0xE9, 0x3D, 0xCF } },
-    { "EFI_PEI_REPORT_PROGRESS_CODE_PPI_GUID", { 0x229832d3, 0x7a30, 0x4b36, 0xb8, 0x27, 0xf4, 0xc, 0xb7, 0xd4, 0x54, 0x36 } },
-    { "EFI_PEI_RESET_PPI_GUID", { 0xef398d58, 0x9dfd, 0x4103, 0xbf, 0x94, 0x78, 0xc6, 0xf4, 0xfe, 0x71, 0x2f } },
-    { "EFI_PEI_RSC_HANDLER_PPI_GUID", { 0x65d394, 0x9951, 0x4144, 0x82, 0xa3, 0xa, 0xfc, 0x85, 0x79, 0xc2, 0x51 } },
-    { "EFI_PEI_S3_RESUME2_PPI_GUID", { 0x6D582DBC, 0xDB85, 0x4514, 0x8F, 0xCC, 0x5A, 0xDF, 0x62, 0x27, 0xB1, 0x47 } },
-    { "EFI_PEI_S3_RESUME_PPI_GUID", { 0x4426CCB2, 0xE684, 0x4a8a, 0xAE, 0x40, 0x20, 0xD4, 0xB0, 0x25, 0xB7, 0x10 } },
-    { "EFI_PEI_SECTION_EXTRACTION_PPI_GUID", { 0x4F89E208, 0xE144, 0x4804, 0x9E, 0xC8, 0x0F, 0x89, 0x4F, 0x7E, 0x36, 0xD7 } },
-    { "EFI_PEI_SECURITY2_PPI_GUID", { 0xdcd0be23, 0x9586, 0x40f4, 0xb6, 0x43, 0x06, 0x52, 0x2c, 0xed, 0x4e, 0xde } },
-    { "EFI_PEI_SECURITY_PPI_GUID", { 0x1388066e, 0x3a57, 0x4efa, 0x98, 0xf3, 0xc1, 0x2f, 0x3a, 0x95, 0x8a, 0x29 } },
-    { "EFI_PEI_SMBUS2_PPI_GUID", { 0x9ca93627, 0xb65b, 0x4324, 0xa2, 0x2, 0xc0, 0xb4, 0x61, 0x76, 0x45, 0x43 } },
-    { "EFI_PEI_SMBUS_PPI_GUID", { 0xabd42895, 0x78cf, 0x4872, 0x84, 0x44, 0x1b, 0x5c, 0x18, 0xb, 0xfb, 0xda } },
-    { "EFI_PEI_SMM_COMMUNICATION_PPI_GUID", { 0xae933e1c, 0xcc47, 0x4e38, 0x8f, 0xe, 0xe2, 0xf6, 0x1d, 0x26, 0x5, 0xdf } },
-    { "EFI_PEI_STALL_PPI_GUID", { 0x1f4c6f90, 0xb06b, 0x48d8, 0xa2, 0x01, 0xba, 0xe5, 0xf1, 0xcd, 0x7d, 0x56 } },
-    { "EFI_PEI_TEMPORARY_RAM_DONE_PPI_GUID", { 0xceab683c, 0xec56, 0x4a2d, 0xa9, 0x06, 0x40, 0x53, 0xfa, 0x4e, 0x9c, 0x16 } },
-    { "EFI_PEI_TEMPORARY_RAM_SUPPORT_PPI_GUID", { 0xdbe23aa9, 0xa345, 0x4b97, 0x85, 0xb6, 0xb2, 0x26, 0xf1, 0x61, 0x73, 0x89 } },
-    { "EFI_PEI_TRANSFER_CONTROL_GUID", { 0xd8117d02, 0x94a6, 0x11d4, 0x9a, 0x3a, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d } },
-    { "EFI_PEI_VECTOR_HANDOFF_INFO_PPI_GUID", { 0x3cd652b4, 0x6d33, 0x4dce, 0x89, 0xdb, 0x83, 0xdf, 0x97, 0x66, 0xfc, 0xca } },
-    { "EFI_PERFORMANCE_PROTOCOL_GUID", { 0xFFECFFFF, 0x923C, 0x14d2, 0x9E, 0x3F, 0x22, 0xA0, 0xC9, 0x69, 0x56, 0x3B } },
-    { "EFI_PHYSICAL_PRESENCE_DATA_GUID", { 0xf6499b1, 0xe9ad, 0x493d, 0xb9, 0xc2, 0x2f, 0x90, 0x81, 0x5c, 0x6c, 0xbc } },
-    { "EFI_PLATFORM_DRIVER_OVERRIDE_PROTOCOL_GUID", { 0x6b30c738, 0xa391, 0x11d4, 0x9a, 0x3b, 0x00, 0x90, 0x27, 0x3f, 0xc1, 0x4d } },
-    { "EFI_PLATFORM_MEMTEST_PROTOCOL_GUID", { 0x859ba18, 0x7dd7, 0x4ed7, 0xa8, 0x8e, 0x10, 0x9c, 0x63, 0x91, 0x7b, 0xdd } },
-    { "EFI_PLATFORM_TO_DRIVER_CONFIGURATION_CLP_GUID", { 0x345ecc0e, 0x0cb6, 0x4b75, 0xbb, 0x57, 0x1b, 0x12, 0x9c, 0x47, 0x33, 0x3e } },
-    { "EFI_PLATFORM_TO_DRIVER_CONFIGURATION_PROTOCOL_GUID", { 0x642cd590, 0x8059, 0x4c0a, 0xa9, 0x58, 0xc5, 0xec, 0x07, 0xd2, 0x3c, 0x4b } },
-    { "EFI_PRIMARY_CONSOLE_IN_DEVICE_GUID", { 0xe451dcbe, 0x96a1, 0x4729, 0xa5, 0xcf, 0x6b, 0x9c, 0x2c, 0xff, 0x47, 0xfd } },
-    { "EFI_PRIMARY_CONSOLE_OUT_DEVICE_GUID", { 0x62bdf38a, 0xe3d5, 0x492c, 0x95, 0xc, 0x23, 0xa7, 0xf6, 0x6e, 0x67, 0x2e } },
-    { "EFI_PRIMARY_STANDARD_ERROR_DEVICE_GUID", { 0x5a68191b, 0x9b97, 0x4752, 0x99, 0x46, 0xe3, 0x6a, 0x5d, 0xa9, 0x42, 0xb1 } },
-    { "EFI_PRINT2_PROTOCOL_GUID", { 0xf05976ef, 0x83f1, 0x4f3d, 0x86, 0x19, 0xf7, 0x59, 0x5d, 0x41, 0xe5, 0x38 } },
-    { "EFI_PRINT_PROTOCOL_GUID", { 0xdf2d868e, 0x32fc, 0x4cf0, 0x8e, 0x6b, 0xff, 0xd9, 0x5d, 0x13, 0x43, 0xd0 } },
-    { "EFI_PROCESSOR_PRODUCER_GUID", { 0x1bf06aea, 0x5bec, 0x4a8d, 0x95, 0x76, 0x74, 0x9b, 0x09, 0x56, 0x2d, 0x30 } },
-    { "EFI_PROCESSOR_SUBCLASS_GUID", { 0x26fdeb7e, 0xb8af, 0x4ccf, 0xaa, 0x97, 0x02, 0x63, 0x3c, 0xe4, 0x8c, 0xa7 } },
-    { "EFI_PS2_POLICY_PROTOCOL_GUID", { 0x4df19259, 0xdc71, 0x4d46, 0xbe, 0xf1, 0x35, 0x7b, 0xb5, 0x78, 0xc4, 0x18 } },
-    { "EFI_PXE_BASE_CODE_CALLBACK_PROTOCOL_GUID", { 0x245dca21, 0xfb7b, 0x11d3, 0x8f, 0x01, 0x00, 0xa0, 0xc9, 0x69, 0x72, 0x3b } },
-    { "EFI_PXE_BASE_CODE_PROTOCOL_GUID", { 0x03c4e603, 0xac28, 0x11d3, 0x9a, 0x2d, 0x00, 0x90, 0x27, 0x3f, 0xc1, 0x4d } },
-    { "EFI_PXE_DHCP4_CALLBACK_PROTOCOL_GUID", { 0xc1544c01, 0x92a4, 0x4198, 0x8a, 0x84, 0x77, 0x85, 0x83, 0xc2, 0x36, 0x21 } },
-    { "EFI_PXE_DHCP4_PROTOCOL_GUID", { 0x03c4e624, 0xac28, 0x11d3, 0x9a, 0x2d, 0x00, 0x90, 0x29, 0x3f, 0xc1, 0x4d } },
-    { "EFI_REAL_TIME_CLOCK_ARCH_PROTOCOL_GUID", { 0x27CFAC87, 0x46CC, 0x11d4, 0x9A, 0x38, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D } },
-    { "EFI_RESET_ARCH_PROTOCOL_GUID", { 0x27CFAC88, 0x46CC, 0x11d4, 0x9A, 0x38, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D } },
-    { "EFI_RSC_HANDLER_PROTOCOL_GUID", { 0x86212936, 0xe76, 0x41c8, 0xa0, 0x3a, 0x2a, 0xf2, 0xfc, 0x1c, 0x39, 0xe2 } },
-    { "EFI_RUNTIME_ARCH_PROTOCOL_GUID", { 0xb7dfb4e1, 0x52f, 0x449f, 0x87, 0xbe, 0x98, 0x18, 0xfc, 0x91, 0xb7, 0x33 } },
-    { "EFI_RUNTIME_CRYPT_PROTOCOL_GUID", { 0xe1475e0c, 0x1746, 0x4802, 0x86, 0x2e, 0x1, 0x1c, 0x2c, 0x2d, 0x9d, 0x86 } },
-    { "EFI_S3_SAVE_STATE_PROTOCOL_GUID", { 0xe857caf6, 0xc046, 0x45dc, 0xbe, 0x3f, 0xee, 0x7, 0x65, 0xfb, 0xa8, 0x87 } },
-    { "EFI_S3_SMM_SAVE_STATE_PROTOCOL_GUID", { 0x320afe62, 0xe593, 0x49cb, 0xa9, 0xf1, 0xd4, 0xc2, 0xf4, 0xaf, 0x1, 0x4c } },
-    { "EFI_SAL_MCA_INIT_PMI_PROTOCOL_GUID", { 0xb60dc6e8, 0x3b6f, 0x11d5, 0xaf, 0x9, 0x0, 0xa0, 0xc9, 0x44, 0xa0, 0x5b } },
-    { "EFI_SAL_SYSTEM_TABLE_GUID", { 0xeb9d2d32, 0x2d88, 0x11d3, 0x9a, 0x16, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d } },
-    { "EFI_SAS_DEVICE_PATH_GUID", { 0xd487ddb4, 0x008b, 0x11d9, 0xaf, 0xdc, 0x00, 0x10, 0x83, 0xff, 0xca, 0x4d } },
-    { "EFI_SCSI_BUS_PROTOCOL_GUID", { 0x5261213D, 0x3A3D, 0x441E, 0xB3, 0xAF, 0x21, 0xD3, 0xF7, 0xA4, 0xCA, 0x17 } },
-    { "EFI_SCSI_IO_PROTOCOL_GUID", { 0x932f47e6, 0x2362, 0x4002, 0x80, 0x3e, 0x3c, 0xd5, 0x4b, 0x13, 0x8f, 0x85 } },
-    { "EFI_SCSI_PASS_THRU_PROTOCOL_GUID", { 0xa59e8fcf, 0xbda0, 0x43bb, 0x90, 0xb1, 0xd3, 0x73, 0x2e, 0xca, 0xa8, 0x77 } },
-    { "EFI_SECTION_EXTRACTION_PROTOCOL_GUID", { 0x448F5DA4, 0x6DD7, 0x4FE1, 0x93, 0x07, 0x69, 0x22, 0x41, 0x92, 0x21, 0x5D } },
-    { "EFI_SECURITY2_ARCH_PROTOCOL_GUID", { 0x94ab2f58, 0x1438, 0x4ef1, 0x91, 0x52, 0x18, 0x94, 0x1a, 0x3a, 0x0e, 0x68 } },
-    { "EFI_SECURITY_ARCH_PROTOCOL_GUID", { 0xA46423E3, 0x4617, 0x49f1, 0xB9, 0xFF, 0xD1, 0xBF, 0xA9, 0x11, 0x58, 0x39 } },
-    { "EFI_SECURITY_POLICY_PROTOCOL_GUID", { 0x78E4D245, 0xCD4D, 0x4a05, 0xA2, 0xBA, 0x47, 0x43, 0xE8, 0x6C, 0xFC, 0xAB } },
-    { "EFI_SEC_PLATFORM_INFORMATION_GUID", { 0x6f8c2b35, 0xfef4, 0x448d, 0x82, 0x56, 0xe1, 0x1b, 0x19, 0xd6, 0x10, 0x77 } },
-    { "EFI_SERIAL_IO_PROTOCOL_GUID", { 0xBB25CF6F, 0xF1D4, 0x11D2, 0x9A, 0x0C, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0xFD } },
-    { "EFI_SE_EXT_SIGNATURE_GUID", { 0xd2c18636, 0x40e5, 0x4eb5, 0xa3, 0x1b, 0x36, 0x69, 0x5f, 0xd4, 0x2c, 0x87 } },
-    { "EFI_SHELLPKG_TOKEN_SPACE_GUID", { 0x171e9188, 0x31d3, 0x40f5, 0xb1, 0xc, 0x53, 0x9b, 0x2d, 0xb9, 0x40, 0xcd } },
-    { "EFI_SHELL_FILE_GUID", { 0xc57ad6b7, 0x0515, 0x40a8, 0x9d, 0x21, 0x55, 0x16, 0x52, 0x85, 0x4e, 0x37 } },
-    { "EFI_SHELL_PARAMETERS_PROTOCOL_GUID", { 0x752f3136, 0x4e16, 0x4fdc, 0xa2, 0x2a, 0xe5, 0xf4, 0x68, 0x12, 0xf4, 0xca } },
-    { "EFI_SHELL_PROTOCOL_GUID", { 0x6302d008, 0x7f9b, 0x4f30, 0x87, 0xac, 0x60, 0xc9, 0xfe, 0xf5, 0xda, 0x4e } },
-    { "EFI_SIMPLE_FILE_SYSTEM_PROTOCOL_GUID", { 0x964e5b22, 0x6459, 0x11d2, 0x8e, 0x39, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b } },
-    { "EFI_SIMPLE_NETWORK_PROTOCOL_GUID", { 0xA19832B9, 0xAC25, 0x11D3, 0x9A, 0x2D, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D } },
-    { "EFI_SIMPLE_POINTER_PROTOCOL_GUID", { 0x31878c87, 0xb75, 0x11d5, 0x9a, 0x4f, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d } },
-    { "EFI_SIMPLE_TEXT_INPUT_EX_PROTOCOL_GUID", { 0xdd9e7534, 0x7762, 0x4698, 0x8c, 0x14, 0xf5, 0x85, 0x17, 0xa6, 0x25, 0xaa } },
-    { "EFI_SIMPLE_TEXT_INPUT_PROTOCOL_GUID", { 0x387477c1, 0x69c7, 0x11d2, 0x8e, 0x39, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b } },
-    { "EFI_SIMPLE_TEXT_IN_PROTOCOL_GUID", { 0x387477c1, 0x69c7, 0x11d2, 0x8e, 0x39, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b } },
-    { "EFI_SIMPLE_TEXT_OUTPUT_PROTOCOL_GUID", { 0x387477c2, 0x69c7, 0x11d2, 0x8e, 0x39, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b } },
-    { "EFI_SIMPLE_TEXT_OUT_PROTOCOL_GUID", { 0x387477c2, 0x69c7, 0x11d2, 0x8e, 0x39, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b } },
-    { "EFI_SIO_PROTOCOL_GUID", { 0x215fdd18, 0xbd50, 0x4feb, 0x89, 0xb, 0x58, 0xca, 0xb, 0x47, 0x39, 0xe9 } },
-    { "EFI_SMBIOS_PROTOCOL_GUID", { 0x3583ff6, 0xcb36, 0x4940, 0x94, 0x7e, 0xb9, 0xb3, 0x9f, 0x4a, 0xfa, 0xf7 } },
-    { "EFI_SMBIOS_TABLE_GUID", { 0xeb9d2d31, 0x2d88, 0x11d3, 0x9a, 0x16, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d } },
-    { "EFI_SMBUS_HC_PROTOCOL_GUID", { 0xe49d33ed, 0x513d, 0x4634, 0xb6, 0x98, 0x6f, 0x55, 0xaa, 0x75, 0x1c, 0x1b } },
-    { "EFI_SMM_ACCESS2_PROTOCOL_GUID", { 0xc2702b74, 0x800c, 0x4131, 0x87, 0x46, 0x8f, 0xb5, 0xb8, 0x9c, 0xe4, 0xac } },
-    { "EFI_SMM_ACCESS_PROTOCOL_GUID", { 0x3792095a, 0xe309, 0x4c1e, 0xaa, 0x01, 0x85, 0xf5, 0x65, 0x5a, 0x17, 0xf1 } },
-    { "EFI_SMM_BASE2_PROTOCOL_GUID", { 0xf4ccbfb7, 0xf6e0, 0x47fd, 0x9d, 0xd4, 0x10, 0xa8, 0xf1, 0x50, 0xc1, 0x91 } },
-    { "EFI_SMM_BASE_HELPER_READY_PROTOCOL_GUID", { 0x910dca07, 0x1f94, 0x4ee7, 0xaf, 0x2f, 0xff, 0x72, 0xf3, 0x15, 0x43, 0x53 } },
-    { "EFI_SMM_BASE_PROTOCOL_GUID", { 0x1390954D, 0xda95, 0x4227, 0x93, 0x28, 0x72, 0x82, 0xc2, 0x17, 0xda, 0xa8 } },
-    { "EFI_SMM_COMMUNICATION_PROTOCOL_GUID", { 0xc68ed8e2, 0x9dc6, 0x4cbd, 0x9d, 0x94, 0xdb, 0x65, 0xac, 0xc5, 0xc3, 0x32 } },
-    { "EFI_SMM_CONFIGURATION_PROTOCOL_GUID", { 0x26eeb3de, 0xb689, 0x492e, 0x80, 0xf0, 0xbe, 0x8b, 0xd7, 0xda, 0x4b, 0xa7 } },
-    { "EFI_SMM_CONTROL2_PROTOCOL_GUID", { 0x843dc720, 0xab1e, 0x42cb, 0x93, 0x57, 0x8a, 0x0, 0x78, 0xf3, 0x56, 0x1b } },
-    { "EFI_SMM_CONTROL_PROTOCOL_GUID", { 0x8d12e231, 0xc667, 0x4fd1, 0x98, 0xf2, 0x24, 0x49, 0xa7, 0xe7, 0xb2, 0xe5 } },
-    { "EFI_SMM_CPU_IO2_PROTOCOL_GUID", { 0x3242A9D8, 0xCE70, 0x4AA0, 0x95, 0x5D, 0x5E, 0x7B, 0x14, 0x0D, 0xE4, 0xD2 } },
-    { "EFI_SMM_CPU_IO_GUID", { 0x5f439a0b, 0x45d8, 0x4682, 0xa4, 0xf4, 0xf0, 0x57, 0x6b, 0x51, 0x34, 0x41 } },
-    { "EFI_SMM_CPU_PROTOCOL_GUID", { 0xeb346b97, 0x975f, 0x4a9f, 0x8b, 0x22, 0xf8, 0xe9, 0x2b, 0xb3, 0xd5, 0x69 } },
-    { "EFI_SMM_CPU_SAVE_STATE_PROTOCOL_GUID", { 0x21f302ad, 0x6e94, 0x471b, 0x84, 0xbc, 0xb1, 0x48, 0x0, 0x40, 0x3a, 0x1d } },
-    { "EFI_SMM_END_OF_DXE_PROTOCOL_GUID", { 0x24e70042, 0xd5c5, 0x4260, 0x8c, 0x39, 0xa, 0xd3, 0xaa, 0x32, 0xe9, 0x3d } },
-    { "EFI_SMM_FAULT_TOLERANT_WRITE_PROTOCOL_GUID", { 0x3868fc3b, 0x7e45, 0x43a7, 0x90, 0x6c, 0x4b, 0xa4, 0x7d, 0xe1, 0x75, 0x4d } },
-    { "EFI_SMM_FIRMWARE_VOLUME_BLOCK_PROTOCOL_GUID", { 0xd326d041, 0xbd31, 0x4c01, 0xb5, 0xa8, 0x62, 0x8b, 0xe8, 0x7f, 0x6, 0x53 } },
-    { "EFI_SMM_GPI_DISPATCH2_PROTOCOL_GUID", { 0x25566b03, 0xb577, 0x4cbf, 0x95, 0x8c, 0xed, 0x66, 0x3e, 0xa2, 0x43, 0x80 } },
-    { "EFI_SMM_GPI_DISPATCH_PROTOCOL_GUID", { 0xe0744b81, 0x9513, 0x49cd, 0x8c, 0xea, 0xe9, 0x24, 0x5e, 0x70, 0x39, 0xda } },
-    { "EFI_SMM_ICHN_DISPATCH_PROTOCOL_GUID", { 0xc50b323e, 0x9075, 0x4f2a, 0xac, 0x8e, 0xd2, 0x59, 0x6a, 0x10, 0x85, 0xcc } },
-    { "EFI_SMM_IO_TRAP_DISPATCH2_PROTOCOL_GUID", { 0x58dc368d, 0x7bfa, 0x4e77, 0xab, 0xbc, 0xe, 0x29, 0x41, 0x8d, 0xf9, 0x30 } },
-    { "EFI_SMM_LOCK_BOX_COMMUNICATION_GUID", { 0x2a3cfebd, 0x27e8, 0x4d0a, 0x8b, 0x79, 0xd6, 0x88, 0xc2, 0xa3, 0xe1, 0xc0 } },
-    { "EFI_SMM_PCI_ROOT_BRIDGE_IO_PROTOCOL_GUID", { 0x8bc1714d, 0xffcb, 0x41c3, 0x89, 0xdc, 0x6c, 0x74, 0xd0, 0x6d, 0x98, 0xea } },
-    { "EFI_SMM_PERIODIC_TIMER_DISPATCH2_PROTOCOL_GUID", { 0x4cec368e, 0x8e8e, 0x4d71, 0x8b, 0xe1, 0x95, 0x8c, 0x45, 0xfc, 0x8a, 0x53 } },
-    { "EFI_SMM_PERIODIC_TIMER_DISPATCH_PROTOCOL_GUID", { 0x9cca03fc, 0x4c9e, 0x4a19, 0x9b, 0x6, 0xed, 0x7b, 0x47, 0x9b, 0xde, 0x55 } },
-    { "EFI_SMM_POWER_BUTTON_DISPATCH2_PROTOCOL_GUID", { 0x1b1183fa, 0x1823, 0x46a7, 0x88, 0x72, 0x9c, 0x57, 0x87, 0x55, 0x40, 0x9d } },
-    { "EFI_SMM_POWER_BUTTON_DISPATCH_PROTOCOL_GUID", { 0xb709efa0, 0x47a6, 0x4b41, 0xb9, 0x31, 0x12, 0xec, 0xe7, 0xa8, 0xee, 0x56 } },
-    { "EFI_SMM_READY_TO_LOCK_PROTOCOL_GUID", { 0x47b7fa8c, 0xf4bd, 0x4af6, 0x82, 0x00, 0x33, 0x30, 0x86, 0xf0, 0xd2, 0xc8 } },
-    { "EFI_SMM_RSC_HANDLER_PROTOCOL_GUID", { 0x2ff29fa7, 0x5e80, 0x4ed9, 0xb3, 0x80, 0x1, 0x7d, 0x3c, 0x55, 0x4f, 0xf4 } },
-    { "EFI_SMM_STANDBY_BUTTON_DISPATCH2_PROTOCOL_GUID", { 0x7300c4a1, 0x43f2, 0x4017, 0xa5, 0x1b, 0xc8, 0x1a, 0x7f, 0x40, 0x58, 0x5b } },
-    { "EFI_SMM_STANDBY_BUTTON_DISPATCH_PROTOCOL_GUID", { 0x78965b98, 0xb0bf, 0x449e, 0x8b, 0x22, 0xd2, 0x91, 0x4e, 0x49, 0x8a, 0x98 } },
-    { "EFI_SMM_STATUS_CODE_PROTOCOL_GUID", { 0x6afd2b77, 0x98c1, 0x4acd, 0xa6, 0xf9, 0x8a, 0x94, 0x39, 0xde, 0xf, 0xb1 } },
-    { "EFI_SMM_SWAP_ADDRESS_RANGE_PROTOCOL_GUID", { 0x67c4f112, 0x3385, 0x4e55, 0x9c, 0x5b, 0xc0, 0x5b, 0x71, 0x7c, 0x42, 0x28 } },
-    { "EFI_SMM_SW_DISPATCH2_PROTOCOL_GUID", { 0x18a3c6dc, 0x5eea, 0x48c8, 0xa1, 0xc1, 0xb5, 0x33, 0x89, 0xf9, 0x89, 0x99 } },
-    { "EFI_SMM_SW_DISPATCH_PROTOCOL_GUID", { 0xe541b773, 0xdd11, 0x420c, 0xb0, 0x26, 0xdf, 0x99, 0x36, 0x53, 0xf8, 0xbf } },
-    { "EFI_SMM_SX_DISPATCH2_PROTOCOL_GUID", { 0x456d2859, 0xa84b, 0x4e47, 0xa2, 0xee, 0x32, 0x76, 0xd8, 0x86, 0x99, 0x7d } },
-    { "EFI_SMM_SX_DISPATCH_PROTOCOL_GUID", { 0x14fc52be, 0x1dc, 0x426c, 0x91, 0xae, 0xa2, 0x3c, 0x3e, 0x22, 0xa, 0xe8 } },
-    { "EFI_SMM_USB_DISPATCH2_PROTOCOL_GUID", { 0xee9b8d90, 0xc5a6, 0x40a2, 0xbd, 0xe2, 0x52, 0x55, 0x8d, 0x33, 0xcc, 0xa1 } },
-    { "EFI_SMM_USB_DISPATCH_PROTOCOL_GUID", { 0xa05b6ffd, 0x87af, 0x4e42, 0x95, 0xc9, 0x62, 0x28, 0xb6, 0x3c, 0xf3, 0xf3 } },
-    { "EFI_SMM_VARIABLE_PROTOCOL_GUID", { 0xed32d533, 0x99e6, 0x4209, 0x9c, 0xc0, 0x2d, 0x72, 0xcd, 0xd9, 0x98, 0xa7 } },
-    { "EFI_SMM_VARIABLE_WRITE_GUID", { 0x93ba1826, 0xdffb, 0x45dd, 0x82, 0xa7, 0xe7, 0xdc, 0xaa, 0x3b, 0xbd, 0xf3 } },
-    { "EFI_STANDARD_CALLER_ID_GUID", { 0xC9DCF469, 0xA7C4, 0x11D5, 0x87, 0xDA, 0x00, 0x06, 0x29, 0x45, 0xC3, 0xB9 } },
-    { "EFI_STANDARD_ERROR_DEVICE_GUID", { 0xd3b36f2d, 0xd551, 0x11d4, 0x9a, 0x46, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d } },
-    { "EFI_STATUS_CODE_DATA_TYPE_ASSERT_GUID", { 0xDA571595, 0x4D99, 0x487C, 0x82, 0x7C, 0x26, 0x22, 0x67, 0x7D, 0x33, 0x07 } },
-    { "EFI_STATUS_CODE_DATA_TYPE_DEBUG_GUID", { 0x9A4E9246, 0xD553, 0x11D5, 0x87, 0xE2, 0x00, 0x06, 0x29, 0x45, 0xC3, 0xb9 } },
-    { "EFI_STATUS_CODE_DATA_TYPE_ERROR_GUID", { 0xAB359CE3, 0x99B3, 0xAE18, 0xC8, 0x9D, 0x95, 0xD3, 0xB0, 0x72, 0xE1, 0x9B } },
-    { "EFI_STATUS_CODE_DATA_TYPE_EXCEPTION_HANDLER_GUID", { 0x3BC2BD12, 0xAD2E, 0x11D5, 0x87, 0xDD, 0x00, 0x06, 0x29, 0x45, 0xC3, 0xB9 } },
-    { "EFI_STATUS_CODE_DATA_TYPE_PROGRESS_CODE_GUID", { 0xA356AB39, 0x35C4, 0x35DA, 0xB3, 0x7A, 0xF8, 0xEA, 0x9E, 0x8B, 0x36, 0xA3 } },
-    { "EFI_STATUS_CODE_DATA_TYPE_STRING_GUID", { 0x92D11080, 0x496F, 0x4D95, 0xBE, 0x7E, 0x03, 0x74, 0x88, 0x38, 0x2B, 0x0A } },
-    { "EFI_STATUS_CODE_GUID", { 0xd083e94c, 0x6560, 0x42e4, 0xb6, 0xd4, 0x2d, 0xf7, 0x5a, 0xdf, 0x6a, 0x2a } },
-    { "EFI_STATUS_CODE_RUNTIME_PROTOCOL_GUID", { 0xd2b2b828, 0x826, 0x48a7, 0xb3, 0xdf, 0x98, 0x3c, 0x0, 0x60, 0x24, 0xf0 } },
-    { "EFI_STATUS_CODE_SPECIFIC_DATA_GUID", { 0x335984bd, 0xe805, 0x409a, 0xb8, 0xf8, 0xd2, 0x7e, 0xce, 0x5f, 0xf7, 0xa6 } },
-    { "EFI_STORAGE_SECURITY_COMMAND_PROTOCOL_GUID", { 0xC88B0B6D, 0x0DFC, 0x49A7, 0x9C, 0xB4, 0x49, 0x07, 0x4B, 0x4C, 0x3A, 0x78 } },
-    { "EFI_SWAP_ADDRESS_RANGE_PROTOCOL_GUID", { 0x1259f60d, 0xb754, 0x468e, 0xa7, 0x89, 0x4d, 0xb8, 0x5d, 0x55, 0xe8, 0x7e } },
-    { "EFI_SYSTEM_NV_DATA_FV_GUID", { 0xfff12b8d, 0x7696, 0x4c8b, 0xa9, 0x85, 0x27, 0x47, 0x7, 0x5b, 0x4f, 0x50 } },
-    { "EFI_SYSTEM_NV_DATA_HOB_GUID", { 0xd6e5092d, 0xc7b2, 0x4872, 0xaf, 0x66, 0xfd, 0xc0, 0xe6, 0xf9, 0x5e, 0x78 } },
-    { "EFI_TAPE_IO_PROTOCOL_GUID", { 0x1e93e633, 0xd65a, 0x459e, 0xab, 0x84, 0x93, 0xd9, 0xec, 0x26, 0x6d, 0x18 } },
-    { "EFI_TCG_EVENT_HOB_GUID", { 0x2e3044ac, 0x879f, 0x490f, 0x97, 0x60, 0xbb, 0xdf, 0xaf, 0x69, 0x5f, 0x50 } },
-    { "EFI_TCG_PLATFORM_PROTOCOL_GUID", { 0x8c4c9a41, 0xbf56, 0x4627, 0x9e, 0xa, 0xc8, 0x38, 0x6d, 0x66, 0x11, 0x5c } },
-    { "EFI_TCG_PROTOCOL_GUID", { 0xf541796d, 0xa62e, 0x4954, 0xa7, 0x75, 0x95, 0x84, 0xf6, 0x1b, 0x9c, 0xdd } },
-    { "EFI_TCP4_PROTOCOL_GUID", { 0x65530BC7, 0xA359, 0x410f, 0xB0, 0x10, 0x5A, 0xAD, 0xC7, 0xEC, 0x2B, 0x62 } },
-    { "EFI_TCP4_SERVICE_BINDING_PROTOCOL_GUID", { 0x00720665, 0x67EB, 0x4a99, 0xBA, 0xF7, 0xD3, 0xC3, 0x3A, 0x1C, 0x7C, 0xC9 } },
-    { "EFI_TCP6_PROTOCOL_GUID", { 0x46e44855, 0xbd60, 0x4ab7, 0xab, 0x0d, 0xa6, 0x79, 0xb9, 0x44, 0x7d, 0x77 } },
-    { "EFI_TCP6_SERVICE_BINDING_PROTOCOL_GUID", { 0xec20eb79, 0x6c1a, 0x4664, 0x9a, 0x0d, 0xd2, 0xe4, 0xcc, 0x16, 0xd6, 0x64 } },
-    { "EFI_TCP_PROTOCOL_GUID", { 0x02b3d5f2, 0xac28, 0x11d3, 0x9a, 0x2d, 0x00, 0x90, 0x27, 0x3f, 0xc1, 0x4d } },
-    { "EFI_TIANO_DECOMPRESS_PROTOCOL_GUID", { 0xe84cf29c, 0x191f, 0x4eae, 0x96, 0xe1, 0xf4, 0x6a, 0xec, 0xea, 0xea, 0x0b } },
-    { "EFI_TIMER_ARCH_PROTOCOL_GUID", { 0x26baccb3, 0x6f42, 0x11d4, 0xbc, 0xe7, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 } },
-    { "EFI_TSC_FREQUENCY_GUID", { 0xdba6a7e3, 0xbb57, 0x4be7, 0x8a, 0xf8, 0xd5, 0x78, 0xdb, 0x7e, 0x56, 0x87 } },
-    { "EFI_UART_DEVICE_PATH_GUID", { 0x37499a9d, 0x542f, 0x4c89, 0xa0, 0x26, 0x35, 0xda, 0x14, 0x20, 0x94, 0xe4 } },
-    { "EFI_UDP4_PROTOCOL_GUID", { 0x3ad9df29, 0x4501, 0x478d, 0xb1, 0xf8, 0x7f, 0x7f, 0xe7, 0x0e, 0x50, 0xf3 } },
-    { "EFI_UDP4_SERVICE_BINDING_PROTOCOL_GUID", { 0x83f01464, 0x99bd, 0x45e5, 0xb3, 0x83, 0xaf, 0x63, 0x05, 0xd8, 0xe9, 0xe6 } },
-    { "EFI_UDP6_PROTOCOL_GUID", { 0x4f948815, 0xb4b9, 0x43cb, 0x8a, 0x33, 0x90, 0xe0, 0x60, 0xb3, 0x49, 0x55 } },
-    { "EFI_UDP6_SERVICE_BINDING_PROTOCOL_GUID", { 0x66ed4721, 0x3c98, 0x4d3e, 0x81, 0xe3, 0xd0, 0x3d, 0xd3, 0x9a, 0x72, 0x54 } },
-    { "EFI_UGA_DRAW_PROTOCOL_GUID", { 0x982c298b, 0xf4fa, 0x41cb, 0xb8, 0x38, 0x77, 0xaa, 0x68, 0x8f, 0xb8, 0x39 } },
-    { "EFI_UGA_IO_PROTOCOL_GUID", { 0x61a4d49e, 0x6f68, 0x4f1b, 0xb9, 0x22, 0xa8, 0x6e, 0xed, 0xb, 0x7, 0xa2 } },
-    { "EFI_UGA_SPLASH_PROTOCOL_GUID", { 0xa45b3a0d, 0x2e55, 0x4c03, 0xad, 0x9c, 0x27, 0xd4, 0x82, 0xb, 0x50, 0x7e } },
-    { "EFI_UNICODE_COLLATION2_PROTOCOL_GUID", { 0xa4c751fc, 0x23ae, 0x4c3e, 0x92, 0xe9, 0x49, 0x64, 0xcf, 0x63, 0xf3, 0x49 } },
-    { "EFI_UNICODE_COLLATION_PROTOCOL2_GUID", { 0xa4c751fc, 0x23ae, 0x4c3e, 0x92, 0xe9, 0x49, 0x64, 0xcf, 0x63, 0xf3, 0x49 } },
-    { "EFI_UNICODE_COLLATION_PROTOCOL_GUID", { 0x1d85cd7f, 0xf43d, 0x11d2, 0x9a, 0xc, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d } },
-    { "EFI_UNIX_CONSOLE_GUID", { 0xf2cc5d06, 0x8985, 0x11db, 0xbb, 0x19, 0x00, 0x40, 0xd0, 0x2b, 0x18, 0x35 } },
-    { "EFI_UNIX_CPU_MODEL_GUID", { 0xf2d3b330, 0x8985, 0x11db, 0x8a, 0xa3, 0x00, 0x40, 0xd0, 0x2b, 0x18, 0x35 } },
-    { "EFI_UNIX_CPU_SPEED_GUID", { 0xf2d74e5a, 0x8985, 0x11db, 0x97, 0x05, 0x00, 0x40, 0xd0, 0x2b, 0x18, 0x35 } },
-    { "EFI_UNIX_FILE_SYSTEM_GUID", { 0xf2c16b9e, 0x8985, 0x11db, 0x92, 0xc8, 0x00, 0x40, 0xd0, 0x2b, 0x18, 0x35 } },
-    { "EFI_UNIX_GOP_GUID", { 0xbace07c2, 0x8987, 0x11db, 0xa5, 0x9a, 0x00, 0x40, 0xd0, 0x2b, 0x18, 0x35 } },
-    { "EFI_UNIX_IO_PROTOCOL_GUID", { 0xf2e23f54, 0x8985, 0x11db, 0xac, 0x79, 0x00, 0x40, 0xd0, 0x2b, 0x18, 0x35 } },
-    { "EFI_UNIX_MEMORY_GUID", { 0xf2d006cc, 0x8985, 0x11db, 0xa4, 0x72, 0x00, 0x40, 0xd0, 0x2b, 0x18, 0x35 } },
-    { "EFI_UNIX_NETWORK_GUID", { 0x081603B4, 0x0F1D, 0x4022, 0xB6, 0xFD, 0x4C, 0xE3, 0x5E, 0x09, 0xA1, 0xA6 } },
-    { "EFI_UNIX_PHYSICAL_DISKS_GUID", { 0xf2bdcc96, 0x8985, 0x11db, 0x87, 0x19, 0x00, 0x40, 0xd0, 0x2b, 0x18, 0x35 } },
-    { "EFI_UNIX_SERIAL_PORT_GUID", { 0x6d3a727d, 0x66c8, 0x4d19, 0x87, 0xe6, 0x2, 0x15, 0x86, 0x14, 0x90, 0xf3 } },
-    { "EFI_UNIX_THUNK_PROTOCOL_GUID", { 0xf2e98868, 0x8985, 0x11db, 0x9a, 0x59, 0x00, 0x40, 0xd0, 0x2b, 0x18, 0x35 } },
-    { "EFI_UNIX_UGA_GUID", { 0xf2c8b80e, 0x8985, 0x11db, 0x93, 0xf1, 0x00, 0x40, 0xd0, 0x2b, 0x18, 0x35 } },
-    { "EFI_UNIX_UGA_IO_PROTOCOL_GUID", { 0xf2e5e2c6, 0x8985, 0x11db, 0xa1, 0x91, 0x00, 0x40, 0xd0, 0x2b, 0x18, 0x35 } },
-    { "EFI_UNIX_VIRTUAL_DISKS_GUID", { 0xf2ba331a, 0x8985, 0x11db, 0xa4, 0x06, 0x00, 0x40, 0xd0, 0x2b, 0x18, 0x35 } },
-    { "EFI_UPDATE_DATA_FILE_GUID", { 0x283fa2ee, 0x532c, 0x484d, 0x93, 0x83, 0x9f, 0x93, 0xb3, 0x6f, 0xb, 0x7e } },
-    { "EFI_USB2_HC_PROTOCOL_GUID", { 0x3e745226, 0x9818, 0x45b6, 0xa2, 0xac, 0xd7, 0xcd, 0xe, 0x8b, 0xa2, 0xbc } },
-    { "EFI_USB_ATAPI_PROTOCOL_GUID", { 0x2B2F68DA, 0x0CD2, 0x44cf, 0x8E, 0x8B, 0xBB, 0xA2, 0x0B, 0x1B, 0x5B, 0x75 } },
-    { "EFI_USB_BUS_PROTOCOL_GUID", { 0x2B2F68CC, 0x0CD2, 0x44cf, 0x8E, 0x8B, 0xBB, 0xA2, 0x0B, 0x1B, 0x5B, 0x75 } },
-    { "EFI_USB_HC_PROTOCOL_GUID", { 0xf5089266, 0x1aa0, 0x4953, 0x97, 0xd8, 0x56, 0x2f, 0x8a, 0x73, 0xb5, 0x19 } },
-    { "EFI_USB_IO_PROTOCOL_GUID", { 0x2B2F68D6, 0x0CD2, 0x44cf, 0x8E, 0x8B, 0xBB, 0xA2, 0x0B, 0x1B, 0x5B, 0x75 } },
-    { "EFI_USER_CREDENTIAL2_PROTOCOL_GUID", { 0xe98adb03, 0xb8b9, 0x4af8, 0xba, 0x20, 0x26, 0xe9, 0x11, 0x4c, 0xbc, 0xe5 } },
-    { "EFI_USER_CREDENTIAL_PROTOCOL_GUID", { 0x71ee5e94, 0x65b9, 0x45d5, 0x82, 0x1a, 0x3a, 0x4d, 0x86, 0xcf, 0xe6, 0xbe } },
-    { "EFI_USER_INFO_ACCESS_SETUP_ADMIN_GUID", { 0x85b75607, 0xf7ce, 0x471e, 0xb7, 0xe4, 0x2a, 0xea, 0x5f, 0x72, 0x32, 0xee } },
-    { "EFI_USER_INFO_ACCESS_SETUP_NORMAL_GUID", { 0x1db29ae0, 0x9dcb, 0x43bc, 0x8d, 0x87, 0x5d, 0xa1, 0x49, 0x64, 0xdd, 0xe2 } },
-    { "EFI_USER_INFO_ACCESS_SETUP_RESTRICTED_GUID", { 0xbdb38125, 0x4d63, 0x49f4, 0x82, 0x12, 0x61, 0xcf, 0x5a, 0x19, 0xa, 0xf8 } },
-    { "EFI_USER_MANAGER_PROTOCOL_GUID", { 0x6fd5b00c, 0xd426, 0x4283, 0x98, 0x87, 0x6c, 0xf5, 0xcf, 0x1c, 0xb1, 0xfe } },
-    { "EFI_UXIX_SYSTEM_CONFIG_GUID", { 0x375ea976, 0x3ccd, 0x4e74, 0xa8, 0x45, 0x26, 0xb9, 0xb3, 0x24, 0xb1, 0x3c } },
-    { "EFI_VARIABLE_ARCH_PROTOCOL_GUID", { 0x1e5668e2, 0x8481, 0x11d4, 0xbc, 0xf1, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 } },
-    { "EFI_VARIABLE_GUID", { 0xddcf3616, 0x3275, 0x4164, 0x98, 0xb6, 0xfe, 0x85, 0x70, 0x7f, 0xfe, 0x7d } },
-    { "EFI_VARIABLE_INDEX_TABLE_GUID", { 0x8cfdb8c8, 0xd6b2, 0x40f3, 0x8e, 0x97, 0x02, 0x30, 0x7c, 0xc9, 0x8b, 0x7c } },
-    { "EFI_VARIABLE_STORE_PROTOCOL_GUID", { 0xf088cd91, 0xa046, 0x11d2, 0x8e, 0x42, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b } },
-    { "EFI_VARIABLE_WRITE_ARCH_PROTOCOL_GUID", { 0x6441f818, 0x6362, 0x4e44, 0xb5, 0x70, 0x7d, 0xba, 0x31, 0xdd, 0x24, 0x53 } },
-    { "EFI_VGA_MINI_PORT_PROTOCOL_GUID", { 0xc7735a2f, 0x88f5, 0x4882, 0xae, 0x63, 0xfa, 0xac, 0x8c, 0x8b, 0x86, 0xb3 } },
-    { "EFI_VIRTUAL_MEMORY_ACCESS_PROTOCOL_GUID", { 0x745d377a, 0xb988, 0x47b2, 0xb1, 0x8f, 0xbb, 0xc8, 0xd, 0xc5, 0x66, 0x98 } },
-    { "EFI_VLAN_CONFIG_PROTOCOL_GUID", { 0x9e23d768, 0xd2f3, 0x4366, 0x9f, 0xc3, 0x3a, 0x7a, 0xba, 0x86, 0x43, 0x74 } },
-    { "EFI_VT_100_GUID", { 0xdfa66065, 0xb419, 0x11d3, 0x9a, 0x2d, 0x00, 0x90, 0x27, 0x3f, 0xc1, 0x4d } },
-    { "EFI_VT_100_PLUS_GUID", { 0x7baec70b, 0x57e0, 0x4c76, 0x8e, 0x87, 0x2f, 0x9e, 0x28, 0x08, 0x83, 0x43 } },
-    { "EFI_VT_UTF8_GUID", { 0xad15a0d6, 0x8bec, 0x4acf, 0xa0, 0x73, 0xd0, 0x1d, 0xe7, 0x7e, 0x2d, 0x88 } },
-    { "EFI_WATCHDOG_TIMER_ARCH_PROTOCOL_GUID", { 0x665E3FF5, 0x46CC, 0x11d4, 0x9A, 0x38, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D } },
-    { "EFI_WIN_NT_CONSOLE_GUID", { 0xba73672c, 0xa5d3, 0x11d4, 0xbd, 0x0, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 } },
-    { "EFI_WIN_NT_CPU_MODEL_GUID", { 0xbee9b6ce, 0x2f8a, 0x11d4, 0xbd, 0xd, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 } },
-    { "EFI_WIN_NT_CPU_SPEED_GUID", { 0xd4f29055, 0xe1fb, 0x11d4, 0xbd, 0xd, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 } },
-    { "EFI_WIN_NT_FILE_SYSTEM_GUID", { 0xc95a935, 0xa006, 0x11d4, 0xbc, 0xfa, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 } },
-    { "EFI_WIN_NT_GOP_GUID", { 0x4e11e955, 0xccca, 0x11d4, 0xbd, 0xd, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 } },
-    { "EFI_WIN_NT_IO_PROTOCOL_GUID", { 0x96eb4ad6, 0xa32a, 0x11d4, 0xbc, 0xfd, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 } },
-    { "EFI_WIN_NT_MEMORY_GUID", { 0x99042912, 0x122a, 0x11d4, 0xbd, 0xd, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 } },
-    { "EFI_WIN_NT_PASS_THROUGH_GUID", { 0xcc664eb8, 0x3c24, 0x4086, 0xb6, 0xf6, 0x34, 0xe8, 0x56, 0xbc, 0xe3, 0x6e } },
-    { "EFI_WIN_NT_PHYSICAL_DISKS_GUID", { 0xc95a92f, 0xa006, 0x11d4, 0xbc, 0xfa, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 } },
-    { "EFI_WIN_NT_SERIAL_PORT_GUID", { 0xc95a93d, 0xa006, 0x11d4, 0xbc, 0xfa, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 } },
-    { "EFI_WIN_NT_SYSTEM_CONFIG_GUID", { 0xb347f047, 0xaf8c, 0x490e, 0xac, 0x07, 0x0a, 0xa9, 0xb7, 0xe5, 0x38, 0x58 } },
-    { "EFI_WIN_NT_THUNK_PROTOCOL_GUID", { 0x58c518b1, 0x76f3, 0x11d4, 0xbc, 0xea, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 } },
-    { "EFI_WIN_NT_UGA_GUID", { 0xab248e99, 0xabe1, 0x11d4, 0xbd, 0xd, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 } },
-    { "EFI_WIN_NT_VIRTUAL_DISKS_GUID", { 0xc95a928, 0xa006, 0x11d4, 0xbc, 0xfa, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 } },
-    { "EFI_XEN_INFO_GUID", { 0xd3b46f3b, 0xd441, 0x1244, 0x9a, 0x12, 0x0, 0x12, 0x27, 0x3f, 0xc1, 0x4d } },
-    { "EMBEDDED_DEVICE_PROTOCOL_GUID", { 0xbf4b9d10, 0x13ec, 0x43dd, 0x88, 0x80, 0xe9, 0xb, 0x71, 0x8f, 0x27, 0xde } },
-    { "EMBEDDED_EXTERNAL_DEVICE_PROTOCOL_GUID", { 0x735F8C64, 0xD696, 0x44D0, 0xBD, 0xF2, 0x44, 0x7F, 0xD0, 0x5A, 0x54, 0x06 } },
-    { "EMU_BLOCK_IO_PROTOCOL_GUID", { 0x6888A4AE, 0xAFCE, 0xE84B, 0x91, 0x02, 0xF7, 0xB9, 0xDA, 0xE6, 0xA0, 0x30 } },
-    { "EMU_GRAPHICS_WINDOW_PROTOCOL_GUID", { 0x30FD316A, 0x6728, 0x2E41, 0xA6, 0x90, 0x0D, 0x13, 0x33, 0xD8, 0xCA, 0xC1 } },
-    { "EMU_IO_THUNK_PROTOCO_GUID", { 0x453368F6, 0x7C85, 0x434A, 0xA9, 0x8A, 0x72, 0xD1, 0xB7, 0xFF, 0xA9, 0x26 } },
-    { "EMU_SNP_PROTOCOL_GUID", { 0xFD5FBE54, 0x8C35, 0xB345, 0x8A, 0x0F, 0x7A, 0xC8, 0xA5, 0xFD, 0x05, 0x21 } },
-    { "EMU_THUNK_PPI_GUID", { 0xB958B78C, 0x1D3E, 0xEE40, 0x8B, 0xF4, 0xF0, 0x63, 0x2D, 0x06, 0x39, 0x16 } },
-    { "EMU_THUNK_PROTOCOL_GUID", { 0x5CF32E0B, 0x8EDF, 0x2E44, 0x9C, 0xDA, 0x93, 0x20, 0x5E, 0x99, 0xEC, 0x1C } },
-    { "EXTENDED_SAL_BOOT_SERVICE_PROTOCOL_GUID", { 0xde0ee9a4, 0x3c7a, 0x44f2, 0xb7, 0x8b, 0xe3, 0xcc, 0xd6, 0x9c, 0x3a, 0xf7 } },
-    { "EXTENDED_SAL_BOOT_SERVICE_PROTOCOL_GUID", { 0xde0ee9a4,0x3c7a,0x44f2,0xb7,0x8b,0xe3,0xcc,0xd6,0x9c,0x3a,0xf7 } },
-    { "FFS_GUID", { 0xac05bf33, 0x995a, 0x4ed4, 0xaa, 0xb8, 0xef, 0x7a, 0xe8, 0xf, 0x5c, 0xb0 } },
-    { "FILE_EXPLORE_FORMSET_GUID", { 0x1f2d63e1, 0xfebd, 0x4dc7, 0x9c, 0xc5, 0xba, 0x2b, 0x1c, 0xef, 0x9c, 0x5b } },
-    { "FILE_GUID", { 0xcbd2e4d5, 0x7068, 0x4ff5, 0xb4, 0x62, 0x98, 0x22, 0xb4, 0xad, 0x8d, 0x60 } },
-    { "FORM_BROWSER_EXTENSION_PROTOCOL_GUID", { 0x1f73b18d, 0x4630, 0x43c1, 0xa1, 0xde, 0x6f, 0x80, 0x85, 0x5d, 0x7d, 0xa4 } },
-    { "FRAMEWORK_BDS_FRONTPAGE_FORMSET_GUID", { 0x9e0c30bc, 0x3f06, 0x4ba6, 0x82, 0x88, 0x9, 0x17, 0x9b, 0x85, 0x5d, 0xbe } },
-    { "FRAMEWORK_EFI_FIRMWARE_VOLUME_BLOCK_PROTOCOL_GUID", { 0xDE28BC59, 0x6228, 0x41BD, 0xBD, 0xF6, 0xA3, 0xB9, 0xAD,0xB5, 0x8D, 0xA1 } },
-    { "FRAMEWORK_EFI_MP_SERVICES_PROTOCOL_GUID", { 0xf33261e7, 0x23cb, 0x11d5, 0xbd, 0x5c, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 } },
-    { "FRONT_PAGE_FORMSET_GUID", { 0x9e0c30bc, 0x3f06, 0x4ba6, 0x82, 0x88, 0x9, 0x17, 0x9b, 0x85, 0x5d, 0xbe } },
-    { "HANDLE_PARSING_HII_GUID", { 0xb8969637, 0x81de, 0x43af, 0xbc, 0x9a, 0x24, 0xd9, 0x89, 0x13, 0xf2, 0xf6 } },
-    { "HD_BOOT_DEVICE_PATH_VARIABLE_GUID", { 0xfab7e9e1, 0x39dd, 0x4f2b, 0x84, 0x8, 0xe2, 0xe, 0x90, 0x6c, 0xb6, 0xde } },
-    { "HII_RESOURCE_SAMPLE_FORM_SET_GUID", { 0x4f4ef7f0, 0xaa29, 0x4ce9, 0xba, 0x41, 0x64, 0x3e, 0x1, 0x23, 0xa9, 0x9f } },
-    { "HOB_LIST_GUID", { 0x7739f24c, 0x93d7, 0x11d4, 0x9a, 0x3a, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d } },
-    { "HOT_PLUG_DEVICE_GUID", { 0x220ac432, 0x1d43, 0x49e5, 0xa7, 0x4f, 0x4c, 0x9d, 0xa6, 0x7a, 0xd2, 0x3b } },
-    { "IDLE_LOOP_EVENT_GUID", { 0x3c8d294c, 0x5fc3, 0x4451, 0xbb, 0x31, 0xc4, 0xc0, 0x32, 0x29, 0x5e, 0x6c } },
-    { "INTEL_FRAMEWORK_MODULEPKG_TOKEN_SPACE_GUID", { 0xD3705011, 0xBC19, 0x4af7, 0xBE, 0x16, 0xF6, 0x80, 0x30, 0x37, 0x8C, 0x15 } },
-    { "IP4_ISCSI_CONFIG_GUID", { 0x6456ed61, 0x3579, 0x41c9, 0x8a, 0x26, 0x0a, 0x0b, 0xd6, 0x2b, 0x78, 0xfc } },
-    { "IP6_CONFIG_NVDATA_GUID", { 0x2eea107, 0x98db, 0x400e, 0x98, 0x30, 0x46, 0xa, 0x15, 0x42, 0xd7, 0x99 } },
-    { "ISCSI_CHAP_AUTH_INFO_GUID", { 0x786ec0ac, 0x65ae, 0x4d1b, 0xb1, 0x37, 0xd, 0x11, 0xa, 0x48, 0x37, 0x97 } },
-    { "ISCSI_CONFIG_GUID", { 0x4b47d616, 0xa8d6, 0x4552, 0x9d, 0x44, 0xcc, 0xad, 0x2e, 0xf, 0x4c, 0xf9 } },
-    { "ISCSI_V4_PRIVATE_GUID", { 0xfa3cde4c, 0x87c2, 0x427d, 0xae, 0xde, 0x7d, 0xd0, 0x96, 0xc8, 0x8c, 0x58 } },
-    { "ISCSI_V6_PRIVATE_GUID", { 0x28be27e5, 0x66cc, 0x4a31, 0xa3, 0x15, 0xdb, 0x14, 0xc3, 0x74, 0x4d, 0x85 } },
-    { "LAST_ENUM_LANGUAGE_GUID", { 0xe8c545b, 0xa2ee, 0x470d, 0x8e, 0x26, 0xbd, 0xa1, 0xa1, 0x3c, 0xa, 0xa3 } },
-    { "LDR_MEMORY_DESCRIPTOR_GUID", { 0x7701d7e5, 0x7d1d, 0x4432, 0xa4, 0x68, 0x67, 0x3d, 0xab, 0x8a, 0xde, 0x60 } },
-    { "LOAD_FILE_PROTOCOL_GUID", { 0x56EC3091, 0x954C, 0x11d2, 0x8E, 0x3F, 0x00, 0xA0, 0xC9, 0x69, 0x72, 0x3B } },
-    { "LOCAL_EFI_WIN_NT_BUS_DRIVER_IO_PROTOCOL_GUID", { 0x96eb4ad6, 0xa32a, 0x11d4, 0xbc, 0xfd, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 } },
-    { "LOCAL_EFI_WIN_NT_SERIAL_PORT_GUID", { 0xc95a93d, 0xa006, 0x11d4, 0xbc, 0xfa, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 } },
-    { "LOCAL_EFI_WIN_NT_THUNK_PROTOCOL_GUID", { 0x58c518b1, 0x76f3, 0x11d4, 0xbc, 0xea, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81 } },
-    { "LZMAF86_CUSTOM_DECOMPRESS_GUID", { 0xD42AE6BD, 0x1352, 0x4bfb, 0x90, 0x9A, 0xCA, 0x72, 0xA6, 0xEA, 0xE8, 0x89 } },
-    { "LZMA_CUSTOM_DECOMPRESS_GUID", { 0xEE4E5898, 0x3914, 0x4259, 0x9D, 0x6E, 0xDC, 0x7B, 0xD7, 0x94, 0x03, 0xCF } },
-    { "MDEMODULEPKG_TOKEN_SPACE_GUID", { 0xA1AFF049, 0xFDEB, 0x442a, 0xB3, 0x20, 0x13, 0xAB, 0x4C, 0xB7, 0x2B, 0xBC } },
-    { "MDEPKG_TOKEN_SPACE_GUID", { 0x914AEBE7, 0x4635, 0x459b, 0xAA, 0x1C, 0x11, 0xE2, 0x19, 0xB0, 0x3A, 0x10 } },
-    { "MEMORY_ONLY_RESET_CONTROL_GUID", { 0xe20939be, 0x32d4, 0x41be, 0xa1, 0x50, 0x89, 0x7f, 0x85, 0xd4, 0x98, 0x29 } },
-    { "MEMORY_STATUS_CODE_RECORD_GUID", { 0x60cc026, 0x4c0d, 0x4dda, 0x8f, 0x41, 0x59, 0x5f, 0xef, 0x0, 0xa5, 0x2 } },
-    { "MTC_VENDOR_GUID", { 0xeb704011, 0x1402, 0x11d3, 0x8e, 0x77, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b } },
-    { "MY_GUID", { 0x12345678, 0xAABB, 0xCCDD, 0xEE, 0xFF, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66 } },
-    { "NT_FWH_PPI_GUID", { 0x4e76928f, 0x50ad, 0x4334, 0xb0, 0x6b, 0xa8, 0x42, 0x13, 0x10, 0x8a, 0x57 } },
-    { "PCATCHIPSET_TOKEN_SPACE_GUID", { 0x326ae723, 0xae32, 0x4589, 0x98, 0xb8, 0xca, 0xc2, 0x3c, 0xdc, 0xc1, 0xb1 } },
-    { "PCD_DATABASE_HOB_GUID", { 0xEA296D92, 0x0B69, 0x423C, 0x8C, 0x28, 0x33, 0xB4, 0xE0, 0xA9, 0x12, 0x68 } },
-    { "PCD_PPI_GUID", { 0x6e81c58, 0x4ad7, 0x44bc, 0x83, 0x90, 0xf1, 0x2, 0x65, 0xf7, 0x24, 0x80 } },
-    { "PCD_PROTOCOL_GUID", { 0x11b34006, 0xd85b, 0x4d0a, 0xa2, 0x90, 0xd5, 0xa5, 0x71, 0x31, 0xe, 0xf7 } },
-    { "PE32_IMAGE_PROTOCOL_GUID", { 0x5cb5c776,0x60d5,0x45ee,0x88,0x3c,0x45,0x27,0x8,0xcd,0x74,0x3f } },
-    { "PEI_ATA_CONTROLLER_PPI_GUID", { 0xa45e60d1, 0xc719, 0x44aa, 0xb0, 0x7a, 0xaa, 0x77, 0x7f, 0x85, 0x90, 0x6d } },
-    { "PEI_BASE_MEMORY_TEST_GUID", { 0xb6ec423c, 0x21d2, 0x490d, 0x85, 0xc6, 0xdd, 0x58, 0x64, 0xea, 0xa6, 0x74 } },
-    { "PEI_BLOCK_IO_PPI_GUID", { 0x695d8aa1, 0x42ee, 0x4c46, 0x80, 0x5c, 0x6e, 0xa6, 0xbc, 0xe7, 0x99, 0xe3 } },
-    { "PEI_BOOT_SCRIPT_EXECUTER_PPI_GUID", { 0xabd42895, 0x78cf, 0x4872, 0x84, 0x44, 0x1b, 0x5c, 0x18, 0x0b, 0xfb, 0xff } },
-    { "PEI_CAPSULE_PPI_GUID", { 0x3acf33ee, 0xd892, 0x40f4, 0xa2, 0xfc, 0x38, 0x54, 0xd2, 0xe1, 0x32, 0x3d } },
-    { "PEI_CPU_IO_PPI_GUID", { 0xe6af1f7b, 0xfc3f, 0x46da, 0xa8, 0x28, 0xa3, 0xb4, 0x57, 0xa4, 0x42, 0x82 } },
-    { "PEI_END_OF_PEI_PHASE_PPI_GUID", { 0x605EA650, 0xC65C, 0x42e1, 0xBA, 0x80, 0x91, 0xA5, 0x2A, 0xB6, 0x18, 0xC6 } },
-    { "PEI_FLASH_MAP_PPI_GUID", { 0xf34c2fa0, 0xde88, 0x4270, 0x84, 0x14, 0x96, 0x12, 0x22, 0xf4, 0x52, 0x1c } },
-    { "PEI_IN_MEMORY_GUID", { 0x643b8786, 0xb417, 0x48d2, 0x8f, 0x5e, 0x78, 0x19, 0x93, 0x1c, 0xae, 0xd8 } },
-    { "PEI_LOCK_PHYSICAL_PRESENCE_PPI_GUID", { 0xef9aefe5, 0x2bd3, 0x4031, 0xaf, 0x7d, 0x5e, 0xfe, 0x5a, 0xbb, 0x9a, 0xd } },
-    { "PEI_NT_THUNK_GUID", { 0x98c281e5, 0xf906, 0x43dd, 0xa9, 0x2b, 0xb0, 0x3, 0xbf, 0x27, 0x65, 0xda } },
-    { "PEI_NT_THUNK_PPI_GUID", { 0x98c281e5, 0xf906, 0x43dd, 0xa9, 0x2b, 0xb0, 0x3, 0xbf, 0x27, 0x65, 0xda } },
-    { "PEI_OPERATOR_PRESENCE_PPI_GUID", { 0x20a7378c, 0xaa83, 0x4ce1, 0x82, 0x1f, 0x47, 0x40, 0xee, 0x1b, 0x3f, 0x9f } },
-    { "PEI_PCI_CFG_PPI_GUID", { 0xe1f2eba0, 0xf7b9, 0x4a26, 0x86, 0x20, 0x13, 0x12, 0x21, 0x64, 0x2a, 0x90 } },
-    { "PEI_PERMANENT_MEMORY_INSTALLED_PPI_GUID", { 0xf894643d, 0xc449, 0x42d1, 0x8e, 0xa8, 0x85, 0xbd, 0xd8, 0xc6, 0x5b, 0xde } },
-    { "PEI_READ_ONLY_VARIABLE_ACCESS_PPI_GUID", { 0x3cdc90c6, 0x13fb, 0x4a75, 0x9e, 0x79, 0x59, 0xe9, 0xdd, 0x78, 0xb9, 0xfa } },
-    { "PEI_RESET_PPI_GUID", { 0xef398d58, 0x9dfd, 0x4103, 0xbf, 0x94, 0x78, 0xc6, 0xf4, 0xfe, 0x71, 0x2f } },
-    { "PEI_S3_RESUME_PPI_GUID", { 0x4426CCB2, 0xE684, 0x4a8a, 0xAE, 0x40, 0x20, 0xD4, 0xB0, 0x25, 0xB7, 0x10 } },
-    { "PEI_SECURITY_PPI_GUID", { 0x1388066e, 0x3a57, 0x4efa, 0x98, 0xf3, 0xc1, 0x2f, 0x3a, 0x95, 0x8a, 0x29 } },
-    { "PEI_SEC_PERFORMANCE_PPI_GUID", { 0x0ecc666b, 0x4662, 0x47f9, 0x9d, 0xd5, 0xd0, 0x96, 0xff, 0x7d, 0xa4, 0x9e } },
-    { "PEI_SMBUS2_PPI_GUID", { 0x9ca93627, 0xb65b, 0x4324, 0xa2, 0x2, 0xc0, 0xb4, 0x61, 0x76, 0x45, 0x43 } },
-    { "PEI_SMBUS_PPI_GUID", { 0xabd42895, 0x78cf, 0x4872, 0x84, 0x44, 0x1b, 0x5c, 0x18, 0xb, 0xfb, 0xda } },
-    { "PEI_SMM_ACCESS_PPI_GUID", { 0x268f33a9, 0xcccd, 0x48be, 0x88, 0x17, 0x86, 0x5, 0x3a, 0xc3, 0x2e, 0xd6 } },
-    { "PEI_SMM_CONTROL_PPI_GUID", { 0x61c68702, 0x4d7e, 0x4f43, 0x8d, 0xef, 0xa7, 0x43, 0x5, 0xce, 0x74, 0xc5 } },
-    { "PEI_STALL_PPI_GUID", { 0x1f4c6f90, 0xb06b, 0x48d8, 0xa2, 0x01, 0xba, 0xe5, 0xf1, 0xcd, 0x7d, 0x56 } },
-    { "PEI_STATUS_CODE_MEMORY_PPI_GUID", { 0x26f8ab01, 0xd3cd, 0x489c, 0x98, 0x4f, 0xdf, 0xde, 0xf7, 0x68, 0x39, 0x5b } },
-    { "PEI_STATUS_CODE_PPI_GUID", { 0x229832d3, 0x7a30, 0x4b36, 0xb8, 0x27, 0xf4, 0xc, 0xb7, 0xd4, 0x54, 0x36 } },
-    { "PEI_TPM_INITIALIZED_PPI_GUID", { 0xe9db0d58, 0xd48d, 0x47f6, 0x9c, 0x6e, 0x6f, 0x40, 0xe8, 0x6c, 0x7b, 0x41 } },
-    { "PEI_UNIX_AUTOSCAN_PPI_GUID", { 0xf2ed3d14, 0x8985, 0x11db, 0xb0, 0x57, 0x00, 0x40, 0xd0, 0x2b, 0x18, 0x35 } },
-    { "PEI_UNIX_THUNK_PPI_GUID", { 0xf2f830f2, 0x8985, 0x11db, 0x80, 0x6b, 0x00, 0x40, 0xd0, 0x2b, 0x18, 0x35 } },
-    { "PEI_USB2_HOST_CONTROLLER_PPI_GUID", { 0xa7d09fe1, 0x74d4, 0x4ba5, 0x84, 0x7c, 0x12, 0xed, 0x5b, 0x19, 0xad, 0xe4 } },
-    { "PEI_USB_CONTROLLER_PPI_GUID", { 0x3bc1f6de, 0x693e, 0x4547,0xa3, 0x0, 0x21, 0x82, 0x3c, 0xa4, 0x20, 0xb2 } },
-    { "PEI_USB_HOST_CONTROLLER_PPI_GUID", { 0x652b38a9, 0x77f4, 0x453f, 0x89, 0xd5, 0xe7, 0xbd, 0xc3, 0x52, 0xfc, 0x53 } },
-    { "PEI_USB_IO_PPI_GUID", { 0x7c29785c, 0x66b9, 0x49fc, 0xb7, 0x97, 0x1c, 0xa5, 0x55, 0xe, 0xf2, 0x83 } },
-    { "PERFORMANCEPKG_TOKEN_SPACE_GUID", { 0x669346ef, 0xFDad, 0x4aeb, 0x08, 0xa6, 0x21, 0x46, 0x2d, 0x3f, 0xef, 0x7d } },
-    { "PERFORMANCE_EX_PROTOCOL_GUID", { 0x1ea81bec, 0xf01a, 0x4d98, 0xa2, 0x1,  0x4a, 0x61, 0xce, 0x2f, 0xc0, 0x22 } },
-    { "PERFORMANCE_PROTOCOL_GUID", { 0x76b6bdfa, 0x2acd, 0x4462, 0x9E, 0x3F, 0xcb, 0x58, 0xC9, 0x69, 0xd9, 0x37 } },
-    { "PE_COFF_LOADER_PROTOCOL_GUID", { 0xB323179B, 0x97FB, 0x477E, 0xB0, 0xFE, 0xD8, 0x85, 0x91, 0xFA, 0x11, 0xAB } },
-    { "PLAT_OVER_MNGR_GUID", { 0x8614567d, 0x35be, 0x4415, 0x8d, 0x88, 0xbd, 0x7d, 0xc, 0x9c, 0x70, 0xc0 } },
-    { "PRE_PI_EXTRACT_GUIDED_SECTION_DATA_GUID", { 0x385A982C, 0x2F49, 0x4043, 0xA5, 0x1E, 0x49, 0x01, 0x02, 0x5C, 0x8B, 0x6B } },
-    { "PWD_CREDENTIAL_PROVIDER_GUID", { 0x78b9ec8b, 0xc000, 0x46c5, 0xac, 0x93, 0x24, 0xa0, 0xc1, 0xbb, 0x0, 0xce } },
-    { "RECOVERY_ON_DATA_CD_GUID", { 0x5cac0099, 0x0dc9, 0x48e5, 0x80, 0x68, 0xbb, 0x95, 0xf5, 0x40, 0x0a, 0x9f } },
-    { "RECOVERY_ON_FAT_FLOPPY_DISK_GUID", { 0x2e3d2e75, 0x9b2e, 0x412d, 0xb4, 0xb1, 0x70, 0x41, 0x6b, 0x87, 0x0, 0xff } },
-    { "RECOVERY_ON_FAT_IDE_DISK_GUID", { 0xb38573b6, 0x6200, 0x4ac5, 0xb5, 0x1d, 0x82, 0xe6, 0x59, 0x38, 0xd7, 0x83 } },
-    { "RECOVERY_ON_FAT_USB_DISK_GUID", { 0x0ffbce19, 0x324c, 0x4690, 0xa0, 0x09, 0x98, 0xc6, 0xae, 0x2e, 0xb1, 0x86 } },
-    { "SAL_SYSTEM_TABLE_GUID", { 0xeb9d2d32, 0x2d88, 0x11d3, 0x9a, 0x16, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d } },
-    { "SECUREBOOT_CONFIG_FORM_SET_GUID", { 0x5daf50a5, 0xea81, 0x4de2, 0x8f, 0x9b, 0xca, 0xbd, 0xa9, 0xcf, 0x5c, 0x14 } },
-    { "SECURITYPKG_TOKEN_SPACE_GUID", { 0xd3fb176, 0x9569, 0x4d51, 0xa3, 0xef, 0x7d, 0x61, 0xc6, 0x4f, 0xea, 0xba } },
-    { "SHELLPKG_SHELL_ENV2_EXT_GUID", { 0xd2c18636, 0x40e5, 0x4eb5, 0xa3, 0x1b, 0x36, 0x69, 0x5f, 0xd4, 0x2c, 0x87 } },
-    { "SHELL_ALIAS_VARIABLE_GUID", { 0x0053d9d6, 0x2659, 0x4599, 0xa2, 0x6b, 0xef, 0x45, 0x36, 0xe6, 0x31, 0xa9 } },
-    { "SHELL_DEBUG1_HII_GUID", { 0x25f200aa, 0xd3cb, 0x470a, 0xbf, 0x51, 0xe7, 0xd1, 0x62, 0xd2, 0x2e, 0x6f } },
-    { "SHELL_DRIVER1_HII_GUID", { 0xaf0b742, 0x63ec, 0x45bd, 0x8d, 0xb6, 0x71, 0xad, 0x7f, 0x2f, 0xe8, 0xe8 } },
-    { "SHELL_ENVIRONMENT_PROTOCOL_GUID", { 0x47c7b221, 0xc42a, 0x11d2, 0x8e, 0x57, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b } },
-    { "SHELL_INSTALL1_HII_GUID", { 0x7d574d54, 0xd364, 0x4d4a, 0x95, 0xe3, 0x49, 0x45, 0xdb, 0x7a, 0xd3, 0xee } },
-    { "SHELL_INTERFACE_PROTOCOL_GUID", { 0x47c7b223, 0xc42a, 0x11d2, 0x8e, 0x57, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b } },
-    { "SHELL_LEVEL1_HII_GUID", { 0xdec5daa4, 0x6781, 0x4820, 0x9c, 0x63, 0xa7, 0xb0, 0xe4, 0xf1, 0xdb, 0x31 } },
-    { "SHELL_LEVEL2_HII_GUID", { 0xf95a7ccc, 0x4c55, 0x4426, 0xa7, 0xb4, 0xdc, 0x89, 0x61, 0x95, 0xb, 0xae } },
-    { "SHELL_LEVEL3_HII_GUID", { 0x4344558d, 0x4ef9, 0x4725, 0xb1, 0xe4, 0x33, 0x76, 0xe8, 0xd6, 0x97, 0x4f } },
-    { "SHELL_MAP_GUID", { 0x51271e13, 0x7de3, 0x43af, 0x8b, 0xc2, 0x71, 0xad, 0x3b, 0x82, 0x43, 0x25 } },
-    { "SHELL_NETWORK1_HII_GUID", { 0xf3d301bb, 0xf4a5, 0x45a8, 0xb0, 0xb7, 0xfa, 0x99, 0x9c, 0x62, 0x37, 0xae } },
-    { "SHELL_VARIABLE_GUID", { 0x158def5a, 0xf656, 0x419c, 0xb0, 0x27, 0x7a, 0x31, 0x92, 0xc0, 0x79, 0xd2 } },
-    { "SMBIOS_TABLE_GUID", { 0xeb9d2d31, 0x2d88, 0x11d3, 0x9a, 0x16, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d } },
-    { "SMM_COMMUNICATE_HEADER_GUID", { 0xf328e36c, 0x23b6, 0x4a95, 0x85, 0x4b, 0x32, 0xe1, 0x95, 0x34, 0xcd, 0x75 } },
-    { "SMM_PERFORMANCE_EX_PROTOCOL_GUID", { 0x931fc048, 0xc71d, 0x4455, 0x89, 0x30, 0x47, 0x6,  0x30, 0xe3, 0xe,  0xe5 } },
-    { "SMM_PERFORMANCE_PROTOCOL_GUID", { 0xf866226a, 0xeaa5, 0x4f5a, 0xa9, 0xa, 0x6c, 0xfb, 0xa5, 0x7c, 0x58, 0x8e } },
-    { "STATUS_CODE_CALLBACK_GUID", { 0xe701458c, 0x4900, 0x4ca5, 0xb7, 0x72, 0x3d, 0x37, 0x94, 0x9f, 0x79, 0x27 } },
-    { "SYSTEM_ROM_FILE_GUID", { 0x1547B4F3, 0x3E8A, 0x4FEF, 0x81, 0xC8, 0x32, 0x8E, 0xD6, 0x47, 0xAB, 0x1A } },
-    { "TCG_CONFIG_FORM_SET_GUID", { 0xb0f901e4, 0xc424, 0x45de, 0x90, 0x81, 0x95, 0xe2, 0xb, 0xde, 0x6f, 0xb5 } },
-    { "TEMPORARY_RAM_SUPPORT_PPI_GUID", { 0xdbe23aa9, 0xa345, 0x4b97, 0x85, 0xb6, 0xb2, 0x26, 0xf1, 0x61, 0x73, 0x89 } },
-    { "TIANO_CUSTOM_DECOMPRESS_GUID", { 0xA31280AD, 0x481E, 0x41B6, 0x95, 0xE8, 0x12, 0x7F, 0x4C, 0x98, 0x47, 0x79 } },
-    { "UNIX_FWH_PPI_GUID", { 0xf2f0dc30, 0x8985, 0x11db, 0xa1, 0x5b, 0x00, 0x40, 0xd0, 0x2b, 0x18, 0x35 } },
-    { "UNIX_PEI_LOAD_FILE_GUID", { 0xf2f48768, 0x8985, 0x11db, 0xb8, 0xda, 0x00, 0x40, 0xd0, 0x2b, 0x18, 0x35 } },
-    { "UNKNOWN_DEVICE_GUID", { 0xcf31fac5, 0xc24e, 0x11d2,  0x85, 0xf3, 0x0, 0xa0, 0xc9, 0x3e, 0xc9, 0x3b } },
-    { "USB_CREDENTIAL_PROVIDER_GUID", { 0xd0849ed1, 0xa88c, 0x4ba6, 0xb1, 0xd6, 0xab, 0x50, 0xe2, 0x80, 0xb7, 0xa9 } },
-    { "USB_KEYBOARD_LAYOUT_PACKAGE_GUID", { 0xc0f3b43, 0x44de, 0x4907, 0xb4, 0x78, 0x22, 0x5f, 0x6f, 0x62, 0x89, 0xdc } },
-    { "USER_IDENTIFY_MANAGER_GUID", { 0x3ccd3dd8, 0x8d45, 0x4fed, 0x96, 0x2d, 0x2b, 0x38, 0xcd, 0x82, 0xb3, 0xc4 } },
-    { "USER_PROFILE_MANAGER_GUID", { 0xc35f272c, 0x97c2, 0x465a, 0xa2, 0x16, 0x69, 0x6b, 0x66, 0x8a, 0x8c, 0xfe } },
-    { "VIRTUAL_UNCACHED_PAGES_PROTOCOL_GUID", { 0xAD651C7D, 0x3C22, 0x4DBF, 0x92, 0xe8, 0x38, 0xa7, 0xcd, 0xae, 0x87, 0xb2 } },
-    { "VLAN_CONFIG_FORM_SET_GUID", { 0xd79df6b0, 0xef44, 0x43bd, 0x97, 0x97, 0x43, 0xe9, 0x3b, 0xcf, 0x5f, 0xa8 } },
+GUID_ENTRY("ACPI_TABLE_GUID", 0xeb9d2d30, 0x2d88, 0x11d3, 0x9a, 0x16, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d)
+GUID_ENTRY("APPLE_REMOVABLE_MEDIA_PROTOCOL_GUID", 0x2ea9743a, 0x23d9, 0x425e, 0x87, 0x2c, 0xf6, 0x15, 0xaa, 0x19, 0x57, 0x88)
+GUID_ENTRY("ARM_GLOBAL_VARIABLE_PPI_GUID", 0xab1c1816, 0xd542, 0x4e6f, 0x9b, 0x1e, 0x8e, 0xcd, 0x92, 0x53, 0xe2, 0xe7)
+GUID_ENTRY("ARM_HOB_GLOBAL_VARIABLE_GUID", 0xc3253c90, 0xa24f, 0x4599, 0xa6, 0x64, 0x1f, 0x88, 0x13, 0x77, 0x8f, 0xc9)
+GUID_ENTRY("ARM_MP_CORE_INFO_GUID", 0xa4ee0728, 0xe5d7, 0x4ac5, 0xb2, 0x1e, 0x65, 0x8e, 0xd8, 0x57, 0xe8, 0x34)
+GUID_ENTRY("ARM_MP_CORE_INFO_PPI_GUID", 0x6847cc74, 0xe9ec, 0x4f8f, 0xa2, 0x9d, 0xab, 0x44, 0xe7, 0x54, 0xa8, 0xfc)
+GUID_ENTRY("BDS_LIB_STRING_PACKAGE_GUID", 0x3b4d9b23, 0x95ac, 0x44f6, 0x9f, 0xcd, 0xe, 0x95, 0x94, 0x58, 0x6c, 0x72)
+GUID_ENTRY("BLOCKIO_VENDOR_GUID", 0xcf31fac5, 0xc24e, 0x11d2, 0x85, 0xf3, 0x0, 0xa0, 0xc9, 0x3e, 0xc9, 0x3b)
+GUID_ENTRY("BLOCK_MMIO_PROTOCOL_GUID", 0x6b558ce3, 0x69e5, 0x4c67, 0xa6, 0x34, 0xf7, 0xfe, 0x72, 0xad, 0xbe, 0x84)
+GUID_ENTRY("BOOT_MAINT_FORMSET_GUID", 0x642237c7, 0x35d4, 0x472d, 0x83, 0x65, 0x12, 0xe0, 0xcc, 0xf2, 0x7a, 0x22)
+GUID_ENTRY("BOOT_MANAGER_FORMSET_GUID", 0x847bc3fe, 0xb974, 0x446d, 0x94, 0x49, 0x5a, 0xd5, 0x41, 0x2e, 0x99, 0x3b)
+GUID_ENTRY("CONNECT_CONIN_EVENT_GUID", 0xdb4e8151, 0x57ed, 0x4bed, 0x88, 0x33, 0x67, 0x51, 0xb5, 0xd1, 0xa8, 0xd7)
+GUID_ENTRY("DEVICE_MANAGER_FORMSET_GUID", 0x3ebfa8e6, 0x511d, 0x4b5b, 0xa9, 0x5f, 0xfb, 0x38, 0x26, 0xf, 0x1c, 0x27)
+GUID_ENTRY("DP_HII_GUID", 0xeb832fd9, 0x9089, 0x4898, 0x83, 0xc9, 0x41, 0x61, 0x8f, 0x5c, 0x48, 0xb9)
+GUID_ENTRY("DRIVER_HEALTH_FORMSET_GUID", 0xf76e0a70, 0xb5ed, 0x4c38, 0xac, 0x9a, 0xe5, 0xf5, 0x4b, 0xf1, 0x6e, 0x34)
+GUID_ENTRY("DRIVER_SAMPLE_FORMSET_GUID", 0xA04A27f4, 0xDF00, 0x4D42, 0xB5, 0x52, 0x39, 0x51, 0x13, 0x02, 0x11, 0x3D)
+GUID_ENTRY("DRIVER_SAMPLE_INVENTORY_GUID", 0xb3f56470, 0x6141, 0x4621, 0x8f, 0x19, 0x70, 0x4e, 0x57, 0x7a, 0xa9, 0xe8)
+GUID_ENTRY("DUET_CONSOLEOUT_CONFIG_GUID", 0xED150714, 0xDF30, 0x407D, 0xB2, 0x4A, 0x4B, 0x74, 0x2F, 0xD5, 0xCE, 0xA2)
+GUID_ENTRY("DXE_CORE_FILE_NAME_GUID", 0xD6A2CB7F, 0x6A18, 0x4e2f, 0xB4, 0x3B, 0x99, 0x20, 0xA7, 0x33, 0x70, 0x0A)
+GUID_ENTRY("DXE_SERVICES_TABLE_GUID", 0x5ad34ba, 0x6f02, 0x4214, 0x95, 0x2e, 0x4d, 0xa0, 0x39, 0x8e, 0x2b, 0xb9)
+GUID_ENTRY("EBL_ADD_COMMAND_PROTOCOL_GUID", 0xaeda2428, 0x9a22, 0x4637, 0x9b, 0x21, 0x54, 0x5e, 0x28, 0xfb, 0xb8, 0x29)
+GUID_ENTRY("ECP_PEI_PCI_CFG_PPI_GUID", 0xb0ee53d4, 0xa049, 0x4a79, 0xb2, 0xff, 0x19, 0xd9, 0xfa, 0xef, 0xaa, 0x94)
+GUID_ENTRY("EFI_ABSOLUTE_POINTER_PROTOCOL_GUID", 0x8D59D32B, 0xC655, 0x4AE9, 0x9B, 0x15, 0xF2, 0x59, 0x04, 0x99, 0x2A, 0x43)
+GUID_ENTRY("EFI_ACPI_S3_CONTEXT_GUID", 0xef98d3a, 0x3e33, 0x497a, 0xa4, 0x1, 0x77, 0xbe, 0x3e, 0xb7, 0x4f, 0x38)
+GUID_ENTRY("EFI_ACPI_S3_SAVE_GUID", 0x125f2de1, 0xfb85, 0x440c, 0xa5, 0x4c, 0x4d, 0x99, 0x35, 0x8a, 0x8d, 0x38)
+GUID_ENTRY("EFI_ACPI_SDT_PROTOCOL_GUID", 0xeb97088e, 0xcfdf, 0x49c6, 0xbe, 0x4b, 0xd9, 0x6, 0xa5, 0xb2, 0xe, 0x86)
+GUID_ENTRY("EFI_ACPI_SUPPORT_GUID", 0xdbff9d55, 0x89b7, 0x46da, 0xbd, 0xdf, 0x67, 0x7d, 0x3d, 0xc0, 0x24, 0x1d)
+GUID_ENTRY("EFI_ACPI_TABLE_GUID", 0x8868e871, 0xe4f1, 0x11d3, 0xbc, 0x22, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81)
+GUID_ENTRY("EFI_ACPI_TABLE_GUID", 0xeb9d2d30, 0x2d88, 0x11d3, 0x9a, 0x16, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d)
+GUID_ENTRY("EFI_ACPI_TABLE_PROTOCOL_GUID", 0xffe06bdd, 0x6107, 0x46a6, 0x7b, 0xb2, 0x5a, 0x9c, 0x7e, 0xc5, 0x27, 0x5c)
+GUID_ENTRY("EFI_ACPI_TABLE_STORAGE_GUID", 0x7e374e25, 0x8e01, 0x4fee, 0x87, 0xf2, 0x39, 0xc, 0x23, 0xc6, 0x6, 0xcd)
+GUID_ENTRY("EFI_ACPI_VARIABLE_COMPATIBILITY_GUID", 0xc020489e, 0x6db2, 0x4ef2, 0x9a, 0xa5, 0xca, 0x6, 0xfc, 0x11, 0xd3, 0x6a)
+GUID_ENTRY("EFI_ALTERNATE_FV_BLOCK_GUID", 0xf496922d, 0x172f, 0x4bbc, 0xa1, 0xeb, 0xe, 0xeb, 0x94, 0x9c, 0x34, 0x86)
+GUID_ENTRY("EFI_APRIORI_GUID", 0xfc510ee7, 0xffdc, 0x11d4, 0xbd, 0x41, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81)
+GUID_ENTRY("EFI_ARP_PROTOCOL_GUID", 0xf4b427bb, 0xba21, 0x4f16, 0xbc, 0x4e, 0x43, 0xe4, 0x16, 0xab, 0x61, 0x9c)
+GUID_ENTRY("EFI_ARP_SERVICE_BINDING_PROTOCOL_GUID", 0xf44c00ee, 0x1f2c, 0x4a00, 0xaa, 0x9, 0x1c, 0x9f, 0x3e, 0x8, 0x0, 0xa3)
+GUID_ENTRY("EFI_ATA_PASS_THRU_PROTOCOL_GUID", 0x1d3de7f0, 0x807, 0x424f, 0xaa, 0x69, 0x11, 0xa5, 0x4e, 0x19, 0xa4, 0x6f)
+GUID_ENTRY("EFI_AUTHENTICATED_VARIABLE_GUID", 0xaaf32c78, 0x947b, 0x439a, 0xa1, 0x80, 0x2e, 0x14, 0x4e, 0xc3, 0x77, 0x92)
+GUID_ENTRY("EFI_AUTHENTICATION_CHAP_LOCAL_GUID", 0xc280c73e, 0x15ca, 0x11da, 0xb0, 0xca, 0x00, 0x10, 0x83, 0xff, 0xca, 0x4d)
+GUID_ENTRY("EFI_AUTHENTICATION_CHAP_RADIUS_GUID", 0xd6062b50, 0x15ca, 0x11da, 0x92, 0x19, 0x00, 0x10, 0x83, 0xff, 0xca, 0x4d)
+GUID_ENTRY("EFI_AUTHENTICATION_INFO_PROTOCOL_GUID", 0x7671d9d0, 0x53db, 0x4173, 0xaa, 0x69, 0x23, 0x27, 0xf2, 0x1f, 0x0b, 0xc7)
+GUID_ENTRY("EFI_BDS_ARCH_PROTOCOL_GUID", 0x665E3FF6, 0x46CC, 0x11d4, 0x9A, 0x38, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D)
+GUID_ENTRY("EFI_BIS_PROTOCOL_GUID", 0x0b64aab0, 0x5429, 0x11d4, 0x98, 0x16, 0x00, 0xa0, 0xc9, 0x1f, 0xad, 0xcf)
+GUID_ENTRY("EFI_BLOCK_IO2_PROTOCOL_GUID", 0xa77b2472, 0xe282, 0x4e9f, 0xa2, 0x45, 0xc2, 0xc0, 0xe2, 0x7b, 0xbc, 0xc1)
+GUID_ENTRY("EFI_BLOCK_IO_PROTOCOL_GUID", 0x964e5b21, 0x6459, 0x11d2, 0x8e, 0x39, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b)
+GUID_ENTRY("EFI_BOOT_LOGO_PROTOCOL_GUID", 0xcdea2bd3, 0xfc25, 0x4c1c, 0xb9, 0x7c, 0xb3, 0x11, 0x86, 0x6, 0x49, 0x90)
+GUID_ENTRY("EFI_BOOT_SCRIPT_EXECUTOR_CONTEXT_GUID", 0x79cb58c4, 0xac51, 0x442f, 0xaf, 0xd7, 0x98, 0xe4, 0x7d, 0x2e, 0x99, 0x8)
+GUID_ENTRY("EFI_BOOT_SCRIPT_EXECUTOR_VARIABLE_GUID", 0x3079818c, 0x46d4, 0x4a73, 0xae, 0xf3, 0xe3, 0xe4, 0x6c, 0xf1, 0xee, 0xdb)
+GUID_ENTRY("EFI_BOOT_SCRIPT_SAVE_PROTOCOL_GUID", 0x470e1529, 0xb79e, 0x4e32, 0xa0, 0xfe, 0x6a, 0x15, 0x6d, 0x29, 0xf9, 0xb2)
+GUID_ENTRY("EFI_BUS_SPECIFIC_DRIVER_OVERRIDE_PROTOCOL_GUID", 0x3bc1b285, 0x8a15, 0x4a82, 0xaa, 0xbf, 0x4d, 0x7d, 0x13, 0xfb, 0x32, 0x65)
+GUID_ENTRY("EFI_CACHE_SUBCLASS_GUID", 0x7f0013a7, 0xdc79, 0x4b22, 0x80, 0x99, 0x11, 0xf7, 0x5f, 0xdc, 0x82, 0x9d)
+GUID_ENTRY("EFI_CAPSULE_ARCH_PROTOCOL_GUID", 0x5053697e, 0x2cbc, 0x4819, 0x90, 0xd9, 0x05, 0x80, 0xde, 0xee, 0x57, 0x54)
+GUID_ENTRY("EFI_CAPSULE_ARCH_PROTOCOL_GUID", 0x5053697e, 0x2cbc, 0x4819, 0x90, 0xd9, 0x5, 0x80, 0xde, 0xee, 0x57, 0x54)
+GUID_ENTRY("EFI_CAPSULE_GUID", 0x3B6686BD, 0x0D76, 0x4030, 0xB7, 0x0E, 0xB5, 0x51, 0x9E, 0x2F, 0xC5, 0xA0)
+GUID_ENTRY("EFI_CAPSULE_INFO_GUID", 0x8B34EAC7, 0x2690, 0x460B, 0x8B, 0xA5, 0xD5, 0xCF, 0x32, 0x83, 0x17, 0x35)
+GUID_ENTRY("EFI_CAPSULE_VENDOR_GUID", 0x711C703F, 0xC285, 0x4B10, 0xA3, 0xB0, 0x36, 0xEC, 0xBD, 0x3C, 0x8B, 0xE2)
+GUID_ENTRY("EFI_CERT_RSA2048_GUID", 0x3c5766e8, 0x269c, 0x4e34, 0xaa, 0x14, 0xed, 0x77, 0x6e, 0x85, 0xb3, 0xb6)
+GUID_ENTRY("EFI_CERT_RSA2048_SHA1_GUID", 0x67f8444f, 0x8743, 0x48f1, 0xa3, 0x28, 0x1e, 0xaa, 0xb8, 0x73, 0x60, 0x80)
+GUID_ENTRY("EFI_CERT_RSA2048_SHA256_GUID", 0xe2b36190, 0x879b, 0x4a3d, 0xad, 0x8d, 0xf2, 0xe7, 0xbb, 0xa3, 0x27, 0x84)
+GUID_ENTRY("EFI_CERT_SHA1_GUID", 0x826ca512, 0xcf10, 0x4ac9, 0xb1, 0x87, 0xbe, 0x1, 0x49, 0x66, 0x31, 0xbd)
+GUID_ENTRY("EFI_CERT_SHA224_GUID", 0xb6e5233, 0xa65c, 0x44c9, 0x94, 0x7, 0xd9, 0xab, 0x83, 0xbf, 0xc8, 0xbd)
+GUID_ENTRY("EFI_CERT_SHA256_GUID", 0xc1c41626, 0x504c, 0x4092, 0xac, 0xa9, 0x41, 0xf9, 0x36, 0x93, 0x43, 0x28)
+GUID_ENTRY("EFI_CERT_SHA384_GUID", 0xff3e5307, 0x9fd0, 0x48c9, 0x85, 0xf1, 0x8a, 0xd5, 0x6c, 0x70, 0x1e, 0x1)
+GUID_ENTRY("EFI_CERT_SHA512_GUID", 0x93e0fae, 0xa6c4, 0x4f50, 0x9f, 0x1b, 0xd4, 0x1e, 0x2b, 0x89, 0xc1, 0x9a)
+GUID_ENTRY("EFI_CERT_TYPE_PKCS7_GUID", 0x4aafd29d, 0x68df, 0x49ee, 0x8a, 0xa9, 0x34, 0x7d, 0x37, 0x56, 0x65, 0xa7)
+GUID_ENTRY("EFI_CERT_TYPE_RSA2048_SHA256_GUID", 0xa7717414, 0xc616, 0x4977, 0x94, 0x20, 0x84, 0x47, 0x12, 0xa7, 0x35, 0xbf)
+GUID_ENTRY("EFI_CERT_X509_GUID", 0xa5c059a1, 0x94e4, 0x4aa7, 0x87, 0xb5, 0xab, 0x15, 0x5c, 0x2b, 0xf0, 0x72)
+GUID_ENTRY("EFI_COMPATIBLE_MEMORY_TESTED_PROTOCOL_GUID", 0x64c475ef, 0x344b, 0x492c, 0x93, 0xad, 0xab, 0x9e, 0xb4, 0x39, 0x50, 0x4)
+GUID_ENTRY("EFI_COMPONENT_NAME2_PROTOCOL_GUID", 0x6a7a5cff, 0xe8d9, 0x4f70, 0xba, 0xda, 0x75, 0xab, 0x30, 0x25, 0xce, 0x14)
+GUID_ENTRY("EFI_COMPONENT_NAME_PROTOCOL_GUID", 0x107a772c, 0xd5e1, 0x11d4, 0x9a, 0x46, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d)
+GUID_ENTRY("EFI_CONFIG_FILE_NAME_GUID", 0x98B8D59B, 0xE8BA, 0x48EE, 0x98, 0xDD, 0xC2, 0x95, 0x39, 0x2F, 0x1E, 0xDB)
+GUID_ENTRY("EFI_CONSOLE_CONTROL_PROTOCOL_GUID", 0xf42f7782, 0x12e, 0x4c12, 0x99, 0x56, 0x49, 0xf9, 0x43, 0x4, 0xf7, 0x21)
+GUID_ENTRY("EFI_CONSOLE_IN_DEVICE_GUID", 0xd3b36f2b, 0xd551, 0x11d4, 0x9a, 0x46, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d)
+GUID_ENTRY("EFI_CONSOLE_OUT_DEVICE_GUID", 0xd3b36f2c, 0xd551, 0x11d4, 0x9a, 0x46, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d)
+GUID_ENTRY("EFI_CPU_ARCH_PROTOCOL_GUID", 0x26baccb1, 0x6f42, 0x11d4, 0xbc, 0xe7, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81)
+GUID_ENTRY("EFI_CPU_IO2_PROTOCOL_GUID", 0xad61f191, 0xae5f, 0x4c0e, 0xb9, 0xfa, 0xe8, 0x69, 0xd2, 0x88, 0xc6, 0x4f)
+GUID_ENTRY("EFI_CPU_IO_PROTOCOL_GUID", 0xB0732526, 0x38C8, 0x4b40, 0x88, 0x77, 0x61, 0xC7, 0xB0, 0x6A, 0xAC, 0x45)
+GUID_ENTRY("EFI_CRC32_GUIDED_SECTION_EXTRACTION_GUID", 0xFC1BCDB0, 0x7D31, 0x49aa, 0x93, 0x6A, 0xA4, 0x60, 0x0D, 0x9D, 0xD0, 0x83)
+GUID_ENTRY("EFI_CRC32_GUIDED_SECTION_EXTRACTION_PROTOCOL_GUID", 0xFC1BCDB0, 0x7D31, 0x49aa, 0x93, 0x6A, 0xA4, 0x60, 0x0D, 0x9D, 0xD0, 0x83)
+GUID_ENTRY("EFI_CUSTOMIZED_DECOMPRESS_PROTOCOL_GUID", 0x9a44198e, 0xa4a2, 0x44e6, 0x8a, 0x1f, 0x39, 0xbe, 0xfd, 0xac, 0x89, 0x6f)
+GUID_ENTRY("EFI_DATA_HUB_PROTOCOL_GUID", 0xae80d021, 0x618e, 0x11d4, 0xbc, 0xd7, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81)
+GUID_ENTRY("EFI_DATA_HUB_STATUS_CODE_RECORD_GUID", 0xd083e94c, 0x6560, 0x42e4, 0xb6, 0xd4, 0x2d, 0xf7, 0x5a, 0xdf, 0x6a, 0x2a)
+GUID_ENTRY("EFI_DEBUGPORT_PROTOCOL_GUID", 0xEBA4E8D2, 0x3858, 0x41EC, 0xA2, 0x81, 0x26, 0x47, 0xBA, 0x96, 0x60, 0xD0)
+GUID_ENTRY("EFI_DEBUG_AGENT_GUID", 0x865a5a9b, 0xb85d, 0x474c, 0x84, 0x55, 0x65, 0xd1, 0xbe, 0x84, 0x4b, 0xe2)
+GUID_ENTRY("EFI_DEBUG_ASSERT_PROTOCOL_GUID", 0xbe499c92, 0x7d4b, 0x11d4, 0xbc, 0xee, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81)
+GUID_ENTRY("EFI_DEBUG_IMAGE_INFO_TABLE_GUID", 0x49152e77, 0x1ada, 0x4764, 0xb7, 0xa2, 0x7a, 0xfe, 0xfe, 0xd9, 0x5e, 0x8b)
+GUID_ENTRY("EFI_DEBUG_MASK_PROTOCOL_GUID", 0x4c8a2451, 0xc207, 0x405b, 0x96, 0x94, 0x99, 0xea, 0x13, 0x25, 0x13, 0x41)
+GUID_ENTRY("EFI_DEBUG_SERIAL_IO_PROTOCOL_GUID", 0xe683dc4f, 0x9ed, 0x4f22, 0x86, 0x6b, 0x8e, 0x40, 0x46, 0x94, 0x7c, 0x6c)
+GUID_ENTRY("EFI_DEBUG_SUPPORT_PERIODIC_CALLBACK_PROTOCOL_GUID", 0x9546e07c, 0x2cbb, 0x4c88, 0x98, 0x6c, 0xcd, 0x34, 0x10, 0x86, 0xf0, 0x44)
+GUID_ENTRY("EFI_DEBUG_SUPPORT_PROTOCOL_GUID", 0x2755590C, 0x6F3C, 0x42FA, 0x9E, 0xA4, 0xA3, 0xBA, 0x54, 0x3C, 0xDA, 0x25)
+GUID_ENTRY("EFI_DECOMPRESS_PROTOCOL_GUID", 0xd8117cfe, 0x94a6, 0x11d4, 0x9a, 0x3a, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d)
+GUID_ENTRY("EFI_DEFAULT_BMP_LOGO_GUID", 0x7BB28B99, 0x61BB, 0x11d5, 0x9A, 0x5D, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D)
+GUID_ENTRY("EFI_DEFERRED_IMAGE_LOAD_PROTOCOL_GUID", 0x15853d7c, 0x3ddf, 0x43e0, 0xa1, 0xcb, 0xeb, 0xf8, 0x5b, 0x8f, 0x87, 0x2c)
+GUID_ENTRY("EFI_DEVICE_IO_PROTOCOL_GUID", 0xaf6ac311, 0x84c3, 0x11d2, 0x8e, 0x3c, 0x00, 0xa0, 0xc9, 0x69, 0x72, 0x3b)
+GUID_ENTRY("EFI_DEVICE_PATH_FROM_TEXT_PROTOCOL_GUID", 0x5c99a21, 0xc70f, 0x4ad2, 0x8a, 0x5f, 0x35, 0xdf, 0x33, 0x43, 0xf5, 0x1e)
+GUID_ENTRY("EFI_DEVICE_PATH_PROTOCOL_GUID", 0x9576e91, 0x6d3f, 0x11d2, 0x8e, 0x39, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b)
+GUID_ENTRY("EFI_DEVICE_PATH_TO_TEXT_PROTOCOL_GUID", 0x8b843e20, 0x8132, 0x4852, 0x90, 0xcc, 0x55, 0x1a, 0x4e, 0x4a, 0x7f, 0x1c)
+GUID_ENTRY("EFI_DEVICE_PATH_UTILITIES_PROTOCOL_GUID", 0x379be4e, 0xd706, 0x437d, 0xb0, 0x37, 0xed, 0xb8, 0x2f, 0xb7, 0x72, 0xa4)
+GUID_ENTRY("EFI_DHCP4_PROTOCOL_GUID", 0x8a219718, 0x4ef5, 0x4761, 0x91, 0xc8, 0xc0, 0xf0, 0x4b, 0xda, 0x9e, 0x56)
+GUID_ENTRY("EFI_DHCP4_SERVICE_BINDING_PROTOCOL_GUID", 0x9d9a39d8, 0xbd42, 0x4a73, 0xa4, 0xd5, 0x8e, 0xe9, 0x4b, 0xe1, 0x13, 0x80)
+GUID_ENTRY("EFI_DHCP6_PROTOCOL_GUID", 0x87c8bad7, 0x595, 0x4053, 0x82, 0x97, 0xde, 0xde, 0x39, 0x5f, 0x5d, 0x5b)
+GUID_ENTRY("EFI_DHCP6_SERVICE_BINDING_PROTOCOL_GUID", 0x9fb9a8a1, 0x2f4a, 0x43a6, 0x88, 0x9c, 0xd0, 0xf7, 0xb6, 0xc4, 0x7a, 0xd5)
+GUID_ENTRY("EFI_DISK_INFO_AHCI_INTERFACE_GUID", 0x9e498932, 0x4abc, 0x45af, 0xa3, 0x4d, 0x2, 0x47, 0x78, 0x7b, 0xe7, 0xc6)
+GUID_ENTRY("EFI_DISK_INFO_IDE_INTERFACE_GUID", 0x5e948fe3, 0x26d3, 0x42b5, 0xaf, 0x17, 0x61, 0x2, 0x87, 0x18, 0x8d, 0xec)
+GUID_ENTRY("EFI_DISK_INFO_PROTOCOL_GUID", 0xd432a67f, 0x14dc, 0x484b, 0xb3, 0xbb, 0x3f, 0x2, 0x91, 0x84, 0x93, 0x27)
+GUID_ENTRY("EFI_DISK_INFO_SCSI_INTERFACE_GUID", 0x8f74baa, 0xea36, 0x41d9, 0x95, 0x21, 0x21, 0xa7, 0xf, 0x87, 0x80, 0xbc)
+GUID_ENTRY("EFI_DISK_INFO_USB_INTERFACE_GUID", 0xcb871572, 0xc11a, 0x47b5, 0xb4, 0x92, 0x67, 0x5e, 0xaf, 0xa7, 0x77, 0x27)
+GUID_ENTRY("EFI_DISK_IO_PROTOCOL_GUID", 0xce345171, 0xba0b, 0x11d2, 0x8e, 0x4f, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b)
+GUID_ENTRY("EFI_DPC_PROTOCOL_GUID", 0x480f8ae9, 0xc46, 0x4aa9, 0xbc, 0x89, 0xdb, 0x9f, 0xba, 0x61, 0x98, 0x6)
+GUID_ENTRY("EFI_DRIVER_BINDING_PROTOCOL_GUID", 0x18a031ab, 0xb443, 0x4d1a, 0xa5, 0xc0, 0xc, 0x9, 0x26, 0x1e, 0x9f, 0x71)
+GUID_ENTRY("EFI_DRIVER_CONFIGURATION2_PROTOCOL_GUID", 0xbfd7dc1d, 0x24f1, 0x40d9, 0x82, 0xe7, 0x2e, 0x09, 0xbb, 0x6b, 0x4e, 0xbe)
+GUID_ENTRY("EFI_DRIVER_CONFIGURATION_PROTOCOL_GUID", 0x107a772b, 0xd5e1, 0x11d4, 0x9a, 0x46, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d)
+GUID_ENTRY("EFI_DRIVER_DIAGNOSTICS2_PROTOCOL_GUID", 0x4d330321, 0x025f, 0x4aac, 0x90, 0xd8, 0x5e, 0xd9, 0x0, 0x17, 0x3b, 0x63)
+GUID_ENTRY("EFI_DRIVER_DIAGNOSTICS_PROTOCOL_GUID", 0x0784924f, 0xe296, 0x11d4, 0x9a, 0x49, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d)
+GUID_ENTRY("EFI_DRIVER_FAMILY_OVERRIDE_PROTOCOL_GUID", 0xb1ee129e, 0xda36, 0x4181, 0x91, 0xf8, 0x4, 0xa4, 0x92, 0x37, 0x66, 0xa7)
+GUID_ENTRY("EFI_DRIVER_HEALTH_PROTOCOL_GUID", 0x2a534210, 0x9280, 0x41d8, 0xae, 0x79, 0xca, 0xda, 0x1, 0xa2, 0xb1, 0x27)
+GUID_ENTRY("EFI_DRIVER_SUPPORTED_EFI_VERSION_PROTOCOL_GUID", 0x5c198761, 0x16a8, 0x4e69, 0x97, 0x2c, 0x89, 0xd6, 0x79, 0x54, 0xf8, 0x1d)
+GUID_ENTRY("EFI_DXE_IPL_PPI_GUID", 0xae8ce5d, 0xe448, 0x4437, 0xa8, 0xd7, 0xeb, 0xf5, 0xf1, 0x94, 0xf7, 0x31)
+GUID_ENTRY("EFI_DXE_SERVICES_TABLE_GUID", 0x5ad34ba, 0x6f02, 0x4214, 0x95, 0x2e, 0x4d, 0xa0, 0x39, 0x8e, 0x2b, 0xb9)
+GUID_ENTRY("EFI_DXE_SMM_READY_TO_LOCK_PROTOCOL_GUID", 0x60ff8964, 0xe906, 0x41d0, 0xaf, 0xed, 0xf2, 0x41, 0xe9, 0x74, 0xe0, 0x8e)
+GUID_ENTRY("EFI_EAP_MANAGEMENT_PROTOCOL_GUID", 0xbb62e663, 0x625d, 0x40b2, 0xa0, 0x88, 0xbb, 0xe8, 0x36, 0x23, 0xa2, 0x45)
+GUID_ENTRY("EFI_EAP_PROTOCOL_GUID", 0x5d9f96db, 0xe731, 0x4caa, 0xa0, 0xd, 0x72, 0xe1, 0x87, 0xcd, 0x77, 0x62)
+GUID_ENTRY("EFI_EBC_INTERPRETER_PROTOCOL_GUID", 0x13AC6DD1, 0x73D0, 0x11D4, 0xB0, 0x6B, 0x00, 0xAA, 0x00, 0xBD, 0x6D, 0xE7)
+GUID_ENTRY("EFI_EBC_SIMPLE_DEBUGGER_PROTOCOL_GUID", 0x2a72d11e, 0x7376, 0x40f6, 0x9c, 0x68, 0x23, 0xfa, 0x2f, 0xe3, 0x63, 0xf1)
+GUID_ENTRY("EFI_EBC_VM_TEST_PROTOCOL_GUID", 0xAAEACCFD, 0xF27B, 0x4C17, 0xB6, 0x10, 0x75, 0xCA, 0x1F, 0x2D, 0xFB, 0x52)
+GUID_ENTRY("EFI_EBC_VM_TEST_PROTOCOL_GUID", 0xAAEACCFDL, 0xF27B, 0x4C17, 0xB6, 0x10, 0x75, 0xCA, 0x1F, 0x2D, 0xFB, 0x52)
+GUID_ENTRY("EFI_EDID_ACTIVE_PROTOCOL_GUID", 0xbd8c1056, 0x9f36, 0x44ec, 0x92, 0xa8, 0xa6, 0x33, 0x7f, 0x81, 0x79, 0x86)
+GUID_ENTRY("EFI_EDID_DISCOVERED_PROTOCOL_GUID", 0x1c0c34f6, 0xd380, 0x41fa, 0xa0, 0x49, 0x8a, 0xd0, 0x6c, 0x1a, 0x66, 0xaa)
+GUID_ENTRY("EFI_EDID_DISCOVERED_PROTOCOL_GUID", 0x1c0c34f6, 0xd380, 0x41fa, 0xa0, 0x49, 0x8a, 0xd0, 0x6c, 0x1a, 0x66, 0xaa)
+GUID_ENTRY("EFI_EDID_OVERRIDE_PROTOCOL_GUID", 0x48ecb431, 0xfb72, 0x45c0, 0xa9, 0x22, 0xf4, 0x58, 0xfe, 0x4, 0xb, 0xd5)
+GUID_ENTRY("EFI_EMU_PHYSICAL_DISK_GUID", 0xf2ba331a, 0x8985, 0x11db, 0xa4, 0x06, 0x00, 0x40, 0xd0, 0x2b, 0x18, 0x35)
+GUID_ENTRY("EFI_EMU_SYSTEM_CONFIG_GUID", 0x9C4FB516, 0x3A1E, 0xD847, 0xA1, 0xA1, 0x70, 0x58, 0xB6, 0x98, 0x67, 0x32)
+GUID_ENTRY("EFI_EMU_VIRTUAL_DISK_GUID", 0xf2ba331a, 0x8985, 0x11db, 0xa4, 0x06, 0x00, 0x40, 0xd0, 0x2b, 0x18, 0x35)
+GUID_ENTRY("EFI_END_OF_DXE_EVENT_GROUP_GUID", 0x2ce967a, 0xdd7e, 0x4ffc, 0x9e, 0xe7, 0x81, 0x0c, 0xf0, 0x47, 0x8, 0x80)
+GUID_ENTRY("EFI_END_OF_DXE_EVENT_GROUP_GUID", 0x2ce967a, 0xdd7e, 0x4ffc, 0x9e, 0xe7, 0x81, 0xc, 0xf0, 0x47, 0x8, 0x80)
+GUID_ENTRY("EFI_ERROR_SECTION_DIRECTED_IO_DMAR_GUID", 0x71761d37, 0x32b2, 0x45cd, 0xa7, 0xd0, 0xb0, 0xfe, 0xdd, 0x93, 0xe8, 0xcf)
+GUID_ENTRY("EFI_ERROR_SECTION_DMAR_GENERIC_GUID", 0x5b51fef7, 0xc79d, 0x4434, 0x8f, 0x1b, 0xaa, 0x62, 0xde, 0x3e, 0x2c, 0x64)
+GUID_ENTRY("EFI_ERROR_SECTION_FW_ERROR_RECORD_GUID", 0x81212a96, 0x09ed, 0x4996, 0x94, 0x71, 0x8d, 0x72, 0x9c, 0x8e, 0x69, 0xed)
+GUID_ENTRY("EFI_ERROR_SECTION_IOMMU_DMAR_GUID", 0x036f84e1, 0x7f37, 0x428c, 0xa7, 0x9e, 0x57, 0x5f, 0xdf, 0xaa, 0x84, 0xec)
+GUID_ENTRY("EFI_ERROR_SECTION_PCIE_GUID", 0xd995e954, 0xbbc1, 0x430f, 0xad, 0x91, 0xb4, 0x4d, 0xcb, 0x3c, 0x6f, 0x35)
+GUID_ENTRY("EFI_ERROR_SECTION_PCI_DEVICE_GUID", 0xeb5e4685, 0xca66, 0x4769, 0xb6, 0xa2, 0x26, 0x06, 0x8b, 0x00, 0x13, 0x26)
+GUID_ENTRY("EFI_ERROR_SECTION_PCI_PCIX_BUS_GUID", 0xc5753963, 0x3b84, 0x4095, 0xbf, 0x78, 0xed, 0xda, 0xd3, 0xf9, 0xc9, 0xdd)
+GUID_ENTRY("EFI_ERROR_SECTION_PLATFORM_MEMORY_GUID", 0xa5bc1114, 0x6f64, 0x4ede, 0xb8, 0x63, 0x3e, 0x83, 0xed, 0x7c, 0x83, 0xb1)
+GUID_ENTRY("EFI_ERROR_SECTION_PROCESSOR_GENERIC_GUID", 0x9876ccad, 0x47b4, 0x4bdb, 0xb6, 0x5e, 0x16, 0xf1, 0x93, 0xc4, 0xf3, 0xdb)
+GUID_ENTRY("EFI_ERROR_SECTION_PROCESSOR_SPECIFIC_GUID", 0xdc3ea0b0, 0xa144, 0x4797, 0xb9, 0x5b, 0x53, 0xfa, 0x24, 0x2b, 0x6e, 0x1d)
+GUID_ENTRY("EFI_EVENT_GROUP_DXE_DISPATCH_GUID", 0x7081e22f, 0xcac6, 0x4053, 0x94, 0x68, 0x67, 0x57, 0x82, 0xcf, 0x88, 0xe5)
+GUID_ENTRY("EFI_EVENT_LEGACY_BOOT_GUID", 0x2a571201, 0x4966, 0x47f6, 0x8b, 0x86, 0xf3, 0x1e, 0x41, 0xf3, 0x2f, 0x10)
+GUID_ENTRY("EFI_EVENT_NOTIFICATION_TYEP_BOOT_GUID", 0x3D61A466, 0xAB40, 0x409a, 0xA6, 0x98, 0xF3, 0x62, 0xD4, 0x64, 0xB3, 0x8F)
+GUID_ENTRY("EFI_EVENT_NOTIFICATION_TYEP_CMC_GUID", 0x2DCE8BB1, 0xBDD7, 0x450e, 0xB9, 0xAD, 0x9C, 0xF4, 0xEB, 0xD4, 0xF8, 0x90)
+GUID_ENTRY("EFI_EVENT_NOTIFICATION_TYEP_CPE_GUID", 0x4E292F96, 0xD843, 0x4a55, 0xA8, 0xC2, 0xD4, 0x81, 0xF2, 0x7E, 0xBE, 0xEE)
+GUID_ENTRY("EFI_EVENT_NOTIFICATION_TYEP_DMAR_GUID", 0x667DD791, 0xC6B3, 0x4c27, 0x8A, 0x6B, 0x0F, 0x8E, 0x72, 0x2D, 0xEB, 0x41)
+GUID_ENTRY("EFI_EVENT_NOTIFICATION_TYEP_INIT_GUID", 0xCC5263E8, 0x9308, 0x454a, 0x89, 0xD0, 0x34, 0x0B, 0xD3, 0x9B, 0xC9, 0x8E)
+GUID_ENTRY("EFI_EVENT_NOTIFICATION_TYEP_MCE_GUID", 0xE8F56FFE, 0x919C, 0x4cc5, 0xBA, 0x88, 0x65, 0xAB, 0xE1, 0x49, 0x13, 0xBB)
+GUID_ENTRY("EFI_EVENT_NOTIFICATION_TYEP_NMI_GUID", 0x5BAD89FF, 0xB7E6, 0x42c9, 0x81, 0x4A, 0xCF, 0x24, 0x85, 0xD6, 0xE9, 0x8A)
+GUID_ENTRY("EFI_EVENT_NOTIFICATION_TYEP_PCIE_GUID", 0xCF93C01F, 0x1A16, 0x4dfc, 0xB8, 0xBC, 0x9C, 0x4D, 0xAF, 0x67, 0xC1, 0x04)
+GUID_ENTRY("EFI_EXTENDED_SAL_BASE_IO_SERVICES_PROTOCOL_GUID", 0x5aea42b5, 0x31e1, 0x4515, 0xbc, 0x31, 0xb8, 0xd5, 0x25, 0x75, 0x65, 0xa6)
+GUID_ENTRY("EFI_EXTENDED_SAL_BASE_SERVICES_PROTOCOL_GUID", 0xd9e9fa06, 0x0fe0, 0x41c3, 0x96, 0xfb, 0x83, 0x42, 0x5a, 0x33, 0x94, 0xf8)
+GUID_ENTRY("EFI_EXTENDED_SAL_CACHE_SERVICES_PROTOCOL_GUID", 0xedc9494, 0x2743, 0x4ba5, 0x88, 0x18, 0x0a, 0xef, 0x52, 0x13, 0xf1, 0x88)
+GUID_ENTRY("EFI_EXTENDED_SAL_ELOG_SERVICES_PROTOCOL_GUID", 0xd5e4ee5f, 0x3e0a, 0x453c, 0xa7, 0x25, 0xb6, 0x92, 0xbb, 0x6, 0x36, 0x5a)
+GUID_ENTRY("EFI_EXTENDED_SAL_FV_BLOCK_SERVICES_PROTOCOL_GUID", 0xa2271df1, 0xbcbb, 0x4f1d, 0x98, 0xa9, 0x06, 0xbc, 0x17, 0x2f, 0x07, 0x1a)
+GUID_ENTRY("EFI_EXTENDED_SAL_LOCK_SERVICES_PROTOCOL_GUID", 0x76b75c23, 0xfe4f, 0x4e17, 0xa2, 0xad, 0x1a, 0x65, 0x3d, 0xbb, 0x49, 0x4a)
+GUID_ENTRY("EFI_EXTENDED_SAL_MCA_LOG_SERVICES_PROTOCOL_GUID", 0xcb3fd86e, 0x38a3, 0x4c03, 0x9a, 0x5c, 0x90, 0xcf, 0xa3, 0xa2, 0xab, 0x7a)
+GUID_ENTRY("EFI_EXTENDED_SAL_MCA_SERVICES_PROTOCOL_GUID", 0x2a591128, 0x6cc7, 0x42b1, 0x8a, 0xf0, 0x58, 0x93, 0x3b, 0x68, 0x2d, 0xbb)
+GUID_ENTRY("EFI_EXTENDED_SAL_MP_SERVICES_PROTOCOL_GUID", 0x697d81a2, 0xcf18, 0x4dc0, 0x9e, 0x0d, 0x06, 0x11, 0x3b, 0x61, 0x8a, 0x3f)
+GUID_ENTRY("EFI_EXTENDED_SAL_MTC_SERVICES_PROTOCOL_GUID", 0x899afd18, 0x75e8, 0x408b, 0xa4, 0x1a, 0x6e, 0x2e, 0x7e, 0xcd, 0xf4, 0x54)
+GUID_ENTRY("EFI_EXTENDED_SAL_PAL_SERVICES_PROTOCOL_GUID", 0xe1cd9d21, 0x0fc2, 0x438d, 0x97, 0x03, 0x04, 0xe6, 0x6d, 0x96, 0x1e, 0x57)
+GUID_ENTRY("EFI_EXTENDED_SAL_PCI_SERVICES_PROTOCOL_GUID", 0xa46b1a31, 0xad66, 0x4905, 0x92, 0xf6, 0x2b, 0x46, 0x59, 0xdc, 0x30, 0x63)
+GUID_ENTRY("EFI_EXTENDED_SAL_RESET_SERVICES_PROTOCOL_GUID", 0x7d019990, 0x8ce1, 0x46f5, 0xa7, 0x76, 0x3c, 0x51, 0x98, 0x67, 0x6a, 0xa0)
+GUID_ENTRY("EFI_EXTENDED_SAL_RTC_SERVICES_PROTOCOL_GUID", 0x7e97a470, 0xefdb, 0x4d02, 0x8f, 0xce, 0x61, 0x90, 0xd2, 0x7b, 0xa2, 0x96)
+GUID_ENTRY("EFI_EXTENDED_SAL_SENSOR_SERVICES_PROTOCOL_GUID", 0x4a153b6e, 0x85a1, 0x4982, 0x98, 0xf4, 0x6a, 0x8c, 0xfc, 0xa4, 0xab, 0xa1)
+GUID_ENTRY("EFI_EXTENDED_SAL_SM_COM_LAYER_SERVICES_PROTOCOL_GUID", 0x4356799, 0x81b7, 0x4e08, 0xa3, 0x8d, 0xd9, 0x78, 0xfa, 0x47, 0xba, 0x42)
+GUID_ENTRY("EFI_EXTENDED_SAL_SST_GUID", 0x38802700, 0x868a, 0x4b4e, 0x81, 0xd4, 0x4f, 0x1b, 0xdc, 0xcf, 0xb4, 0x6f)
+GUID_ENTRY("EFI_EXTENDED_SAL_STALL_SERVICES_PROTOCOL_GUID", 0x53a58d06, 0xac27, 0x4d8c, 0xb5, 0xe9, 0xf0, 0x8a, 0x80, 0x65, 0x41, 0x70)
+GUID_ENTRY("EFI_EXTENDED_SAL_STATUS_CODE_SERVICES_PROTOCOL_GUID", 0xdbd91d, 0x55e9, 0x420f, 0x96, 0x39, 0x5e, 0x9f, 0x84, 0x37, 0xb4, 0x4f)
+GUID_ENTRY("EFI_EXTENDED_SAL_VARIABLE_SERVICES_PROTOCOL_GUID", 0x4ecb6c53, 0xc641, 0x4370, 0x8c, 0xb2, 0x3b, 0x0e, 0x49, 0x6e, 0x83, 0x78)
+GUID_ENTRY("EFI_EXTENDED_SAL_VIRTUAL_SERVICES_PROTOCOL_GUID", 0xc1a74056, 0x260e, 0x4871, 0xa0, 0x31, 0xe6, 0x45, 0xa6, 0x5b, 0x6e, 0x11)
+GUID_ENTRY("EFI_EXT_SCSI_PASS_THRU_PROTOCOL_GUID", 0x143b7632, 0xb81b, 0x4cb7, 0xab, 0xd3, 0xb6, 0x25, 0xa5, 0xb9, 0xbf, 0xfe)
+GUID_ENTRY("EFI_FAULT_TOLERANT_WRITE_PROTOCOL_GUID", 0x3ebd9e82, 0x2c78, 0x4de6, 0x97, 0x86, 0x8d, 0x4b, 0xfc, 0xb7, 0xc8, 0x81)
+GUID_ENTRY("EFI_FFS_VOLUME_TOP_FILE_GUID", 0x1BA0062E, 0xC779, 0x4582, 0x85, 0x66, 0x33, 0x6A, 0xE8, 0xF7, 0x8F, 0x09)
+GUID_ENTRY("EFI_FILE_SYSTEM_INFO_ID_GUID", 0x9576e93, 0x6d3f, 0x11d2, 0x8e, 0x39, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b)
+GUID_ENTRY("EFI_FILE_SYSTEM_VOLUME_LABEL_INFO_ID_GUID", 0xDB47D7D3, 0xFE81, 0x11d3, 0x9A, 0x35, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D)
+GUID_ENTRY("EFI_FIND_FV_PPI_GUID", 0x36164812, 0xa023, 0x44e5, 0xbd, 0x85, 0x5, 0xbf, 0x3c, 0x77, 0x0, 0xaa)
+GUID_ENTRY("EFI_FIRMWARE_CONTENTS_SIGNED_GUID", 0xf9d89e8, 0x9259, 0x4f76, 0xa5, 0xaf, 0xc, 0x89, 0xe3, 0x40, 0x23, 0xdf)
+GUID_ENTRY("EFI_FIRMWARE_FILE_SYSTEM2_GUID", 0x8c8ce578, 0x8a3d, 0x4f1c, 0x99, 0x35, 0x89, 0x61, 0x85, 0xc3, 0x2d, 0xd3)
+GUID_ENTRY("EFI_FIRMWARE_FILE_SYSTEM3_GUID", 0x5473c07a, 0x3dcb, 0x4dca, 0xbd, 0x6f, 0x1e, 0x96, 0x89, 0xe7, 0x34, 0x9a)
+GUID_ENTRY("EFI_FIRMWARE_FILE_SYSTEM_GUID", 0x7A9354D9, 0x0468, 0x444a, 0x81, 0xCE, 0x0B, 0xF6, 0x17, 0xD8, 0x90, 0xDF)
+GUID_ENTRY("EFI_FIRMWARE_MANAGEMENT_PROTOCOL_GUID", 0x86c77a67, 0xb97, 0x4633, 0xa1, 0x87, 0x49, 0x10, 0x4d, 0x6, 0x85, 0xc7)
+GUID_ENTRY("EFI_FIRMWARE_PERFORMANCE_GUID", 0xc095791a, 0x3001, 0x47b2, 0x80, 0xc9, 0xea, 0xc7, 0x31, 0x9f, 0x2f, 0xa4)
+GUID_ENTRY("EFI_FIRMWARE_VOLUME2_PROTOCOL_GUID", 0x220e73b6, 0x6bdb, 0x4413, 0x84, 0x5, 0xb9, 0x74, 0xb1, 0x8, 0x61, 0x9a)
+GUID_ENTRY("EFI_FIRMWARE_VOLUME_BLOCK2_PROTOCOL_GUID", 0x8f644fa9, 0xe850, 0x4db1, 0x9c, 0xe2, 0xb, 0x44, 0x69, 0x8e, 0x8d, 0xa4)
+GUID_ENTRY("EFI_FIRMWARE_VOLUME_BLOCK_PROTOCOL_GUID", 0x8f644fa9, 0xe850, 0x4db1, 0x9c, 0xe2, 0xb, 0x44, 0x69, 0x8e, 0x8d, 0xa4)
+GUID_ENTRY("EFI_FIRMWARE_VOLUME_DISPATCH_PROTOCOL_GUID", 0x7aa35a69, 0x506c, 0x444f, 0xa7, 0xaf, 0x69, 0x4b, 0xf5, 0x6f, 0x71, 0xc8)
+GUID_ENTRY("EFI_FIRMWARE_VOLUME_PROTOCOL_GUID", 0x389F751F, 0x1838, 0x4388, 0x83, 0x90, 0xCD, 0x81, 0x54, 0xBD, 0x27, 0xF8)
+GUID_ENTRY("EFI_FORM_BROWSER2_PROTOCOL_GUID", 0xb9d4c360, 0xbcfb, 0x4f9b, 0x92, 0x98, 0x53, 0xc1, 0x36, 0x98, 0x22, 0x58)
+GUID_ENTRY("EFI_FORM_BROWSER_COMPATIBILITY_PROTOCOL_GUID", 0xfb7c852, 0xadca, 0x4853, 0x8d, 0xf, 0xfb, 0xa7, 0x1b, 0x1c, 0xe1, 0x1a)
+GUID_ENTRY("EFI_FORM_BROWSER_PROTOCOL_GUID", 0xe5a1333e, 0xe1b4, 0x4d55, 0xce, 0xeb, 0x35, 0xc3, 0xef, 0x13, 0x34, 0x43)
+GUID_ENTRY("EFI_FORM_BROWSER_PROTOCOL_GUID", 0xfb7c852, 0xadca, 0x4853, 0x8d, 0xf, 0xfb, 0xa7, 0x1b, 0x1c, 0xe1, 0x1a)
+GUID_ENTRY("EFI_FORM_CALLBACK_PROTOCOL_GUID", 0xf3e4543d, 0xcf35, 0x6cef, 0x35, 0xc4, 0x4f, 0xe6, 0x34, 0x4d, 0xfc, 0x54)
+GUID_ENTRY("EFI_FRAMEWORK_DEVICE_PATH_GUID", 0xb7084e63, 0x46b7, 0x4d1a, 0x86, 0x77, 0xe3, 0x0b, 0x53, 0xdb, 0xf0, 0x50)
+GUID_ENTRY("EFI_FTP4_PROTOCOL_GUID", 0xeb338826, 0x681b, 0x4295, 0xb3, 0x56, 0x2b, 0x36, 0x4c, 0x75, 0x7b, 0x9)
+GUID_ENTRY("EFI_FTP4_SERVICE_BINDING_PROTOCOL_GUID", 0xfaaecb1, 0x226e, 0x4782, 0xaa, 0xce, 0x7d, 0xb9, 0xbc, 0xbf, 0x4d, 0xaf)
+GUID_ENTRY("EFI_FTW_LITE_PROTOCOL_GUID", 0x3f557189, 0x8dae, 0x45ae, 0xa0, 0xb3, 0x2b, 0x99, 0xca, 0x7a, 0xa7, 0xa0)
+GUID_ENTRY("EFI_FVB_EXTENSION_PROTOCOL_GUID", 0x53a4c71b, 0xb581, 0x4170, 0x91, 0xb3, 0x8d, 0xb8, 0x7a, 0x4b, 0x5c, 0x46)
+GUID_ENTRY("EFI_GENERIC_MEMORY_TEST_PROTOCOL_GUID", 0x309de7f1, 0x7f5e, 0x4ace, 0xb4, 0x9c, 0x53, 0x1b, 0xe5, 0xaa, 0x95, 0xef)
+GUID_ENTRY("EFI_GENERIC_VARIABLE_GUID", 0x59d1c24f, 0x50f1, 0x401a, 0xb1, 0x01, 0xf3, 0x3e, 0x0d, 0xae, 0xd4, 0x43)
+GUID_ENTRY("EFI_GLOBAL_VARIABLE_GUID", 0x8BE4DF61, 0x93CA, 0x11d2, 0xAA, 0x0D, 0x00, 0xE0, 0x98, 0x03, 0x2B, 0x8C)
+GUID_ENTRY("EFI_GRAPHICS_OUTPUT_PROTOCOL_GUID", 0x9042a9de, 0x23dc, 0x4a38, 0x96, 0xfb, 0x7a, 0xde, 0xd0, 0x80, 0x51, 0x6a)
+GUID_ENTRY("EFI_HARDWARE_ERROR_VARIABLE_GUID", 0x414E6BDD, 0xE47B, 0x47cc, 0xB2, 0x44, 0xBB, 0x61, 0x02, 0x0C, 0xF5, 0x16)
+GUID_ENTRY("EFI_HASH_ALGORITHM_SHA1_GUID", 0x2ae9d80f, 0x3fb2, 0x4095, 0xb7, 0xb1, 0xe9, 0x31, 0x57, 0xb9, 0x46, 0xb6)
+GUID_ENTRY("EFI_HASH_ALGORITHM_SHA1_NOPAD_GUID", 0x24c5dc2f, 0x53e2, 0x40ca, 0x9e, 0xd6, 0xa5, 0xd9, 0xa4, 0x9f, 0x46, 0x3b)
+GUID_ENTRY("EFI_HASH_ALGORITHM_SHA224_GUID", 0x8df01a06, 0x9bd5, 0x4bf7, 0xb0, 0x21, 0xdb, 0x4f, 0xd9, 0xcc, 0xf4, 0x5b)
+GUID_ENTRY("EFI_HASH_ALGORITHM_SHA256_GUID", 0x51aa59de, 0xfdf2, 0x4ea3, 0xbc, 0x63, 0x87, 0x5f, 0xb7, 0x84, 0x2e, 0xe9)
+GUID_ENTRY("EFI_HASH_ALGORITHM_SHA256_NOPAD_GUID", 0x8628752a, 0x6cb7, 0x4814, 0x96, 0xfc, 0x24, 0xa8, 0x15, 0xac, 0x22, 0x26)
+GUID_ENTRY("EFI_HASH_ALGORITHM_SHA384_GUID", 0xefa96432, 0xde33, 0x4dd2, 0xae, 0xe6, 0x32, 0x8c, 0x33, 0xdf, 0x77, 0x7a)
+GUID_ENTRY("EFI_HASH_ALGORITHM_SHA512_GUID", 0xcaa4381e, 0x750c, 0x4770, 0xb8, 0x70, 0x7a, 0x23, 0xb4, 0xe4, 0x21, 0x30)
+GUID_ENTRY("EFI_HASH_ALGORTIHM_MD5_GUID", 0xaf7c79c, 0x65b5, 0x4319, 0xb0, 0xae, 0x44, 0xec, 0x48, 0x4e, 0x4a, 0xd7)
+GUID_ENTRY("EFI_HASH_PROTOCOL_GUID", 0xc5184932, 0xdba5, 0x46db, 0xa5, 0xba, 0xcc, 0x0b, 0xda, 0x9c, 0x14, 0x35)
+GUID_ENTRY("EFI_HASH_SERVICE_BINDING_PROTOCOL_GUID", 0x42881c98, 0xa4f3, 0x44b0, 0xa3, 0x9d, 0xdf, 0xa1, 0x86, 0x67, 0xd8, 0xcd)
+GUID_ENTRY("EFI_HII_COMPATIBILITY_PROTOCOL_GUID", 0x5542cce1, 0xdf5c, 0x4d1b, 0xab, 0xca, 0x36, 0x4f, 0x77, 0xd3, 0x99, 0xfb)
+GUID_ENTRY("EFI_HII_CONFIG_ACCESS_PROTOCOL_GUID", 0x330d4706, 0xf2a0, 0x4e4f, 0xa3, 0x69, 0xb6, 0x6f, 0xa8, 0xd5, 0x43, 0x85)
+GUID_ENTRY("EFI_HII_CONFIG_ROUTING_PROTOCOL_GUID", 0x587e72d7, 0xcc50, 0x4f79, 0x82, 0x09, 0xca, 0x29, 0x1f, 0xc1, 0xa1, 0x0f)
+GUID_ENTRY("EFI_HII_DATABASE_PROTOCOL_GUID", 0xef9fc172, 0xa1b2, 0x4693, 0xb3, 0x27, 0x6d, 0x32, 0xfc, 0x41, 0x60, 0x42)
+GUID_ENTRY("EFI_HII_DRIVER_HEALTH_FORMSET_GUID", 0xf22fc20c, 0x8cf4, 0x45eb, 0x8e, 0x6, 0xad, 0x4e, 0x50, 0xb9, 0x5d, 0xd3)
+GUID_ENTRY("EFI_HII_FONT_PROTOCOL_GUID", 0xe9ca4775, 0x8657, 0x47fc, 0x97, 0xe7, 0x7e, 0xd6, 0x5a, 0x8, 0x43, 0x24)
+GUID_ENTRY("EFI_HII_FRONT_PAGE_CLASS_GUID", 0x94d411b7, 0x7669, 0x45c3, 0xba, 0x3b, 0xf3, 0xa5, 0x8a, 0x71, 0x56, 0x81)
+GUID_ENTRY("EFI_HII_IMAGE_PROTOCOL_GUID", 0x31a6406a, 0x6bdf, 0x4e46, 0xb2, 0xa2, 0xeb, 0xaa, 0x89, 0xc4, 0x9, 0x20)
+GUID_ENTRY("EFI_HII_PACKAGE_LIST_PROTOCOL_GUID", 0x6a1ee763, 0xd47a, 0x43b4, 0xaa, 0xbe, 0xef, 0x1d, 0xe2, 0xab, 0x56, 0xfc)
+GUID_ENTRY("EFI_HII_PLATFORM_SETUP_FORMSET_GUID", 0x93039971, 0x8545, 0x4b04, 0xb4, 0x5e, 0x32, 0xeb, 0x83, 0x26, 0x4, 0xe)
+GUID_ENTRY("EFI_HII_PROTOCOL_GUID", 0x5542cce1, 0xdf5c, 0x4d1b, 0xab, 0xca, 0x36, 0x4f, 0x77, 0xd3, 0x99, 0xfb)
+GUID_ENTRY("EFI_HII_PROTOCOL_GUID", 0xd7ad636e, 0xb997, 0x459b, 0xbf, 0x3f, 0x88, 0x46, 0x89, 0x79, 0x80, 0xe1)
+GUID_ENTRY("EFI_HII_SET_KEYBOARD_LAYOUT_EVENT_GUID", 0x14982a4f, 0xb0ed, 0x45b8, 0xa8, 0x11, 0x5a, 0x7a, 0x9b, 0xc2, 0x32, 0xdf)
+GUID_ENTRY("EFI_HII_STANDARD_FORM_GUID", 0x3bd2f4ec, 0xe524, 0x46e4, 0xa9, 0xd8, 0x51, 0x1, 0x17, 0x42, 0x55, 0x62)
+GUID_ENTRY("EFI_HII_STRING_PROTOCOL_GUID", 0xfd96974, 0x23aa, 0x4cdc, 0xb9, 0xcb, 0x98, 0xd1, 0x77, 0x50, 0x32, 0x2a)
+GUID_ENTRY("EFI_HII_USER_CREDENTIAL_FORMSET_GUID", 0x337f4407, 0x5aee, 0x4b83, 0xb2, 0xa7, 0x4e, 0xad, 0xca, 0x30, 0x88, 0xcd)
+GUID_ENTRY("EFI_HOB_LIST_GUID", 0x7739f24c, 0x93d7, 0x11d4, 0x9a, 0x3a, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d)
+GUID_ENTRY("EFI_HOB_MEMORY_ALLOC_BSP_STORE_GUID", 0x564b33cd, 0xc92a, 0x4593, 0x90, 0xbf, 0x24, 0x73, 0xe4, 0x3c, 0x63, 0x22)
+GUID_ENTRY("EFI_HOB_MEMORY_ALLOC_STACK_GUID", 0x4ed4bf27, 0x4092, 0x42e9, 0x80, 0x7d, 0x52, 0x7b, 0x1d, 0x0, 0xc9, 0xbd)
+GUID_ENTRY("EFI_IA32_X64_ERROR_TYPE_BUS_CHECK_GUID", 0x1CF3F8B3, 0xC5B1, 0x49a2, 0xAA, 0x59, 0x5E, 0xEF, 0x92, 0xFF, 0xA6, 0x3C)
+GUID_ENTRY("EFI_IA32_X64_ERROR_TYPE_CACHE_CHECK_GUID", 0xA55701F5, 0xE3EF, 0x43de, 0xAC, 0x72, 0x24, 0x9B, 0x57, 0x3F, 0xAD, 0x2C)
+GUID_ENTRY("EFI_IA32_X64_ERROR_TYPE_MS_CHECK_GUID", 0x48AB7F57, 0xDC34, 0x4f6c, 0xA7, 0xD3, 0xB0, 0xB5, 0xB0, 0xA7, 0x43, 0x14)
+GUID_ENTRY("EFI_IA32_X64_ERROR_TYPE_TLB_CHECK_GUID", 0xFC06B535, 0x5E1F, 0x4562, 0x9F, 0x25, 0x0A, 0x3B, 0x9A, 0xDB, 0x63, 0xC3)
+GUID_ENTRY("EFI_IDE_CONTROLLER_INIT_PROTOCOL_GUID", 0xa1e37052, 0x80d9, 0x4e65, 0xa3, 0x17, 0x3e, 0x9a, 0x55, 0xc4, 0x3e, 0xc9)
+GUID_ENTRY("EFI_IFR_FRAMEWORK_GUID", 0x31ca5d1a, 0xd511, 0x4931, 0xb7, 0x82, 0xae, 0x6b, 0x2b, 0x17, 0x8c, 0xd7)
+GUID_ENTRY("EFI_IFR_REFRESH_ID_OP_GUID", 0xF5E655D9, 0x02A6, 0x46f2, 0x9E, 0x76, 0xB8, 0xBE, 0x8E, 0x60, 0xAB, 0x22)
+GUID_ENTRY("EFI_IFR_TIANO_GUID", 0xf0b1735, 0x87a0, 0x4193, 0xb2, 0x66, 0x53, 0x8c, 0x38, 0xaf, 0x48, 0xce)
+GUID_ENTRY("EFI_IMAGE_SECURITY_DATABASE_GUID", 0xd719b2cb, 0x3d3a, 0x4596, 0xa3, 0xbc, 0xda, 0xd0, 0xe, 0x67, 0x65, 0x6f)
+GUID_ENTRY("EFI_INCOMPATIBLE_PCI_DEVICE_SUPPORT_PROTOCOL_GUID", 0xeb23f55a, 0x7863, 0x4ac2, 0x8d, 0x3d, 0x95, 0x65, 0x35, 0xde, 0x03, 0x75)
+GUID_ENTRY("EFI_IOBASE_HOB_GUID", 0xd4a28a3e, 0xdcf2, 0x43cf, 0xa2, 0xb7, 0xf3, 0x57, 0x2a, 0x7c, 0xab, 0x9)
+GUID_ENTRY("EFI_IP4_CONFIG_PROTOCOL_GUID", 0x3b95aa31, 0x3793, 0x434b, 0x86, 0x67, 0xc8, 0x07, 0x08, 0x92, 0xe0, 0x5e)
+GUID_ENTRY("EFI_IP4_PROTOCOL_GUID", 0x41d94cd2, 0x35b6, 0x455a, 0x82, 0x58, 0xd4, 0xe5, 0x13, 0x34, 0xaa, 0xdd)
+GUID_ENTRY("EFI_IP4_SERVICE_BINDING_PROTOCOL_GUID", 0xc51711e7, 0xb4bf, 0x404a, 0xbf, 0xb8, 0x0a, 0x04, 0x8e, 0xf1, 0xff, 0xe4)
+GUID_ENTRY("EFI_IP6_CONFIG_PROTOCOL_GUID", 0x937fe521, 0x95ae, 0x4d1a, 0x89, 0x29, 0x48, 0xbc, 0xd9, 0x0a, 0xd3, 0x1a)
+GUID_ENTRY("EFI_IP6_PROTOCOL_GUID", 0x2c8759d5, 0x5c2d, 0x66ef, 0x92, 0x5f, 0xb6, 0x6c, 0x10, 0x19, 0x57, 0xe2)
+GUID_ENTRY("EFI_IP6_SERVICE_BINDING_PROTOCOL_GUID", 0xec835dd3, 0xfe0f, 0x617b, 0xa6, 0x21, 0xb3, 0x50, 0xc3, 0xe1, 0x33, 0x88)
+GUID_ENTRY("EFI_IPSEC2_PROTOCOL_GUID", 0xa3979e64, 0xace8, 0x4ddc, 0xbc, 0x7, 0x4d, 0x66, 0xb8, 0xfd, 0x9, 0x77)
+GUID_ENTRY("EFI_IPSEC_CONFIG_PROTOCOL_GUID", 0xce5e5929, 0xc7a3, 0x4602, 0xad, 0x9e, 0xc9, 0xda, 0xf9, 0x4e, 0xbf, 0xcf)
+GUID_ENTRY("EFI_IPSEC_PROTOCOL_GUID", 0xdfb386f7, 0xe100, 0x43ad, 0x9c, 0x9a, 0xed, 0x90, 0xd0, 0x8a, 0x5e, 0x12)
+GUID_ENTRY("EFI_ISA_ACPI_PROTOCOL_GUID", 0x64a892dc, 0x5561, 0x4536, 0x92, 0xc7, 0x79, 0x9b, 0xfc, 0x18, 0x33, 0x55)
+GUID_ENTRY("EFI_ISA_IO_PROTOCOL_GUID", 0x7ee2bd44, 0x3da0, 0x11d4, 0x9a, 0x38, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d)
+GUID_ENTRY("EFI_ISCSI_INITIATOR_NAME_PROTOCOL_GUID", 0x59324945, 0xec44, 0x4c0d, 0xb1, 0xcd, 0x9d, 0xb1, 0x39, 0xdf, 0x7, 0xc)
+GUID_ENTRY("EFI_KMS_FORMAT_AESCBC_128_GUID", 0xa0e8ee6a, 0x0e92, 0x44d4, 0x86, 0x1b, 0x0e, 0xaa, 0x4a, 0xca, 0x44, 0xa2)
+GUID_ENTRY("EFI_KMS_FORMAT_AESCBC_256_GUID", 0xd7e69789, 0x1f68, 0x45e8, 0x96, 0xef, 0x3b, 0x64, 0x07, 0xa5, 0xb2, 0xdc)
+GUID_ENTRY("EFI_KMS_FORMAT_AESXTS_128_GUID", 0x4776e33f, 0xdb47, 0x479a, 0xa2, 0x5f, 0xa1, 0xcd, 0x0a, 0xfa, 0xb3, 0x8b)
+GUID_ENTRY("EFI_KMS_FORMAT_AESXTS_256_GUID", 0xdc7e8613, 0xc4bb, 0x4db0, 0x84, 0x62, 0x13, 0x51, 0x13, 0x57, 0xab, 0xe2)
+GUID_ENTRY("EFI_KMS_FORMAT_GENERIC_1024_GUID", 0x43be0b44, 0x874b, 0x4ead, 0xb0, 0x9c, 0x24, 0x1a, 0x4f, 0xbd, 0x7e, 0xb3)
+GUID_ENTRY("EFI_KMS_FORMAT_GENERIC_128_GUID", 0xec8a3d69, 0x6ddf, 0x4108, 0x94, 0x76, 0x73, 0x37, 0xfc, 0x52, 0x21, 0x36)
+GUID_ENTRY("EFI_KMS_FORMAT_GENERIC_160_GUID", 0xa3b3e6f8, 0xefca, 0x4bc1, 0x88, 0xfb, 0xcb, 0x87, 0x33, 0x9b, 0x25, 0x79)
+GUID_ENTRY("EFI_KMS_FORMAT_GENERIC_2048_GUID", 0x40093f23, 0x630c, 0x4626, 0x9c, 0x48, 0x40, 0x37, 0x3b, 0x19, 0xcb, 0xbe)
+GUID_ENTRY("EFI_KMS_FORMAT_GENERIC_256_GUID", 0x70f64793, 0xc323, 0x4261, 0xac, 0x2c, 0xd8, 0x76, 0xf2, 0x7c, 0x53, 0x45)
+GUID_ENTRY("EFI_KMS_FORMAT_GENERIC_3072_GUID", 0xb9237513, 0x6c44, 0x4411, 0xa9, 0x90, 0x21, 0xe5, 0x56, 0xe0, 0x5a, 0xde)
+GUID_ENTRY("EFI_KMS_FORMAT_GENERIC_512_GUID", 0x978fe043, 0xd7af, 0x422e, 0x8a, 0x92, 0x2b, 0x48, 0xe4, 0x63, 0xbd, 0xe6)
+GUID_ENTRY("EFI_KMS_FORMAT_MD2_128_GUID", 0x78be11c4, 0xee44, 0x4a22, 0x9f, 0x05, 0x03, 0x85, 0x2e, 0xc5, 0xc9, 0x78)
+GUID_ENTRY("EFI_KMS_FORMAT_MD4_128_GUID", 0xd1c17aa1, 0xcac5, 0x400f, 0xbe, 0x17, 0xe2, 0xa2, 0xae, 0x06, 0x67, 0x7c)
+GUID_ENTRY("EFI_KMS_FORMAT_MD5SHA_128_GUID", 0x1c178237, 0x6897, 0x459e, 0x9d, 0x36, 0x67, 0xce, 0x8e, 0xf9, 0x4f, 0x76)
+GUID_ENTRY("EFI_KMS_FORMAT_MD5_128_GUID", 0xdcbc3662, 0x9cda, 0x4b52, 0xa0, 0x4c, 0x82, 0xeb, 0x1d, 0x23, 0x48, 0xc7)
+GUID_ENTRY("EFI_KMS_FORMAT_MDC2_128_GUID", 0xf7ad60f8, 0xefa8, 0x44a3, 0x91, 0x13, 0x23, 0x1f, 0x39, 0x9e, 0xb4, 0xc7)
+GUID_ENTRY("EFI_KMS_FORMAT_MDC4_128_GUID", 0x3fa4f847, 0xd8eb, 0x4df4, 0xbd, 0x49, 0x10, 0x3a, 0x0a, 0x84, 0x7b, 0xbc)
+GUID_ENTRY("EFI_KMS_FORMAT_RSASHA1_1024_GUID", 0x56417bed, 0x6bbe, 0x4882, 0x86, 0xa0, 0x3a, 0xe8, 0xbb, 0x17, 0xf8, 0xf9)
+GUID_ENTRY("EFI_KMS_FORMAT_RSASHA1_2048_GUID", 0xf66447d4, 0x75a6, 0x463e, 0xa8, 0x19, 0x07, 0x7f, 0x2d, 0xda, 0x05, 0xe9)
+GUID_ENTRY("EFI_KMS_FORMAT_RSASHA256_2048_GUID", 0xa477af13, 0x877d, 0x4060, 0xba, 0xa1, 0x25, 0xd1, 0xbe, 0xa0, 0x8a, 0xd3)
+GUID_ENTRY("EFI_KMS_FORMAT_SHA1_160_GUID", 0x453c5e5a, 0x482d, 0x43f0, 0x87, 0xc9, 0x59, 0x41, 0xf3, 0xa3, 0x8a, 0xc2)
+GUID_ENTRY("EFI_KMS_FORMAT_SHA256_256_GUID", 0x6bb4f5cd, 0x8022, 0x448d, 0xbc, 0x6d, 0x77, 0x1b, 0xae, 0x93, 0x5f, 0xc6)
+GUID_ENTRY("EFI_KMS_FORMAT_SHA512_512_GUID", 0x2f240e12, 0xe14d, 0x475c, 0x83, 0xb0, 0xef, 0xff, 0x22, 0xd7, 0x7b, 0xe7)
+GUID_ENTRY("EFI_KMS_PROTOCOL_GUID", 0xEC3A978D, 0x7C4E, 0x48FA, 0x9A, 0xBE, 0x6A, 0xD9, 0x1C, 0xC8, 0xF8, 0x11)
+GUID_ENTRY("EFI_LEGACY_8259_PROTOCOL_GUID", 0x38321dba, 0x4fe0, 0x4e17, 0x8a, 0xec, 0x41, 0x30, 0x55, 0xea, 0xed, 0xc1)
+GUID_ENTRY("EFI_LEGACY_BIOS_GUID", 0x2e3044ac, 0x879f, 0x490f, 0x97, 0x60, 0xbb, 0xdf, 0xaf, 0x69, 0x5f, 0x50)
+GUID_ENTRY("EFI_LEGACY_BIOS_PLATFORM_PROTOCOL_GUID", 0x783658a3, 0x4172, 0x4421, 0xa2, 0x99, 0xe0, 0x9, 0x7, 0x9c, 0xc, 0xb4)
+GUID_ENTRY("EFI_LEGACY_BIOS_PROTOCOL_GUID", 0xdb9a1e3d, 0x45cb, 0x4abb, 0x85, 0x3b, 0xe5, 0x38, 0x7f, 0xdb, 0x2e, 0x2d)
+GUID_ENTRY("EFI_LEGACY_BIOS_THUNK_PROTOCOL_GUID", 0x4c51a7ba, 0x7195, 0x442d, 0x87, 0x92, 0xbe, 0xea, 0x6e, 0x2f, 0xf6, 0xec)
+GUID_ENTRY("EFI_LEGACY_DEV_ORDER_VARIABLE_GUID", 0xa56074db, 0x65fe, 0x45f7, 0xbd, 0x21, 0x2d, 0x2b, 0xdd, 0x8e, 0x96, 0x52)
+GUID_ENTRY("EFI_LEGACY_INTERRUPT_PROTOCOL_GUID", 0x31ce593d, 0x108a, 0x485d, 0xad, 0xb2, 0x78, 0xf2, 0x1f, 0x29, 0x66, 0xbe)
+GUID_ENTRY("EFI_LEGACY_REGION2_PROTOCOL_GUID", 0x70101eaf, 0x85, 0x440c, 0xb3, 0x56, 0x8e, 0xe3, 0x6f, 0xef, 0x24, 0xf0)
+GUID_ENTRY("EFI_LEGACY_REGION_PROTOCOL_GUID", 0xfc9013a, 0x568, 0x4ba9, 0x9b, 0x7e, 0xc9, 0xc3, 0x90, 0xa6, 0x60, 0x9b)
+GUID_ENTRY("EFI_LOADED_IMAGE_DEVICE_PATH_PROTOCOL_GUID", 0xbc62157e, 0x3e33, 0x4fec, 0x99, 0x20, 0x2d, 0x3b, 0x36, 0xd7, 0x50, 0xdf)
+GUID_ENTRY("EFI_LOADED_IMAGE_PROTOCOL_GUID", 0x5B1B31A1, 0x9562, 0x11d2, 0x8E, 0x3F, 0x00, 0xA0, 0xC9, 0x69, 0x72, 0x3B)
+GUID_ENTRY("EFI_LOAD_FILE2_PROTOCOL_GUID", 0x4006c0c1, 0xfcb3, 0x403e, 0x99, 0x6d, 0x4a, 0x6c, 0x87, 0x24, 0xe0, 0x6d)
+GUID_ENTRY("EFI_LOAD_FILE_PROTOCOL_GUID", 0x56EC3091, 0x954C, 0x11d2, 0x8E, 0x3F, 0x00, 0xA0, 0xC9, 0x69, 0x72, 0x3B)
+GUID_ENTRY("EFI_LOAD_FIXED_ADDRESS_CONFIGURATION_TABLE_GUID", 0x2CA88B53, 0xD296, 0x4080, 0xA4, 0xA5, 0xCA, 0xD9, 0xBA, 0xE2, 0x4B, 0x9)
+GUID_ENTRY("EFI_LOCK_BOX_PROTOCOL_GUID", 0xbd445d79, 0xb7ad, 0x4f04, 0x9a, 0xd8, 0x29, 0xbd, 0x20, 0x40, 0xeb, 0x3c)
+GUID_ENTRY("EFI_MANAGED_NETWORK_PROTOCOL_GUID", 0x7ab33a91, 0xace5, 0x4326, 0xb5, 0x72, 0xe7, 0xee, 0x33, 0xd3, 0x9f, 0x16)
+GUID_ENTRY("EFI_MANAGED_NETWORK_SERVICE_BINDING_PROTOCOL_GUID", 0xf36ff770, 0xa7e1, 0x42cf, 0x9e, 0xd2, 0x56, 0xf0, 0xf2, 0x71, 0xf4, 0x4c)
+GUID_ENTRY("EFI_MEASURED_FV_HOB_GUID", 0xb2360b42, 0x7173, 0x420a, 0x86, 0x96, 0x46, 0xca, 0x6b, 0xab, 0x10, 0x60)
+GUID_ENTRY("EFI_MEMORY_PRODUCER_GUID", 0x1d7add6e, 0xb2da, 0x4b0b, 0xb2, 0x9f, 0x49, 0xcb, 0x42, 0xf4, 0x63, 0x56)
+GUID_ENTRY("EFI_MEMORY_SUBCLASS_GUID", 0x4E8F4EBB, 0x64B9, 0x4e05, 0x9B, 0x18, 0x4C, 0xFE, 0x49, 0x23, 0x50, 0x97)
+GUID_ENTRY("EFI_MEMORY_TYPE_INFORMATION_GUID", 0x4c19049f, 0x4137, 0x4dd3, 0x9c, 0x10, 0x8b, 0x97, 0xa8, 0x3f, 0xfd, 0xfa)
+GUID_ENTRY("EFI_METRONOME_ARCH_PROTOCOL_GUID", 0x26baccb2, 0x6f42, 0x11d4, 0xbc, 0xe7, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81)
+GUID_ENTRY("EFI_MINI_SHELL_FILE_GUID", 0x86ad232b, 0xd33a, 0x465c, 0xbf, 0x5f, 0x41, 0x37, 0xb, 0xa9, 0x2f, 0xe2)
+GUID_ENTRY("EFI_MISC_PRODUCER_GUID", 0x62512c92, 0x63c4, 0x4d80, 0x82, 0xb1, 0xc1, 0xa4, 0xdc, 0x44, 0x80, 0xe5)
+GUID_ENTRY("EFI_MISC_SUBCLASS_GUID", 0x772484B2, 0x7482, 0x4b91, 0x9F, 0x9A, 0xAD, 0x43, 0xF8, 0x1C, 0x58, 0x81)
+GUID_ENTRY("EFI_MMC_HOST_PROTOCOL_GUID", 0x3e591c00, 0x9e4a, 0x11df, 0x92, 0x44, 0x00, 0x02, 0xA5, 0xD5, 0xC5, 0x1B)
+GUID_ENTRY("EFI_MONOTONIC_COUNTER_ARCH_PROTOCOL_GUID", 0x1da97072, 0xbddc, 0x4b30, 0x99, 0xf1, 0x72, 0xa0, 0xb5, 0x6f, 0xff, 0x2a)
+GUID_ENTRY("EFI_MONTONIC_COUNTER_ARCH_PROTOCOL_GUID", 0x1da97072, 0xbddc, 0x4b30, 0x99, 0xf1, 0x72, 0xa0, 0xb5, 0x6f, 0xff, 0x2a)
+GUID_ENTRY("EFI_MPS_TABLE_GUID", 0xeb9d2d2f, 0x2d88, 0x11d3, 0x9a, 0x16, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d)
+GUID_ENTRY("EFI_MP_SERVICES_PROTOCOL_GUID", 0x3fdda605, 0xa76e, 0x4f46, 0xad, 0x29, 0x12, 0xf4, 0x53, 0x1b, 0x3d, 0x08)
+GUID_ENTRY("EFI_MTFTP4_PROTOCOL_GUID", 0x78247c57, 0x63db, 0x4708, 0x99, 0xc2, 0xa8, 0xb4, 0xa9, 0xa6, 0x1f, 0x6b)
+GUID_ENTRY("EFI_MTFTP4_SERVICE_BINDING_PROTOCOL_GUID", 0x2FE800BE, 0x8F01, 0x4aa6, 0x94, 0x6B, 0xD7, 0x13, 0x88, 0xE1, 0x83, 0x3F)
+GUID_ENTRY("EFI_MTFTP6_PROTOCOL_GUID", 0xbf0a78ba, 0xec29, 0x49cf, 0xa1, 0xc9, 0x7a, 0xe5, 0x4e, 0xab, 0x6a, 0x51)
+GUID_ENTRY("EFI_MTFTP6_SERVICE_BINDING_PROTOCOL_GUID", 0xd9760ff3, 0x3cca, 0x4267, 0x80, 0xf9, 0x75, 0x27, 0xfa, 0xfa, 0x42, 0x23)
+GUID_ENTRY("EFI_NETWORK_INTERFACE_IDENTIFIER_PROTOCOL_GUID", 0x1ACED566, 0x76ED, 0x4218, 0xBC, 0x81, 0x76, 0x7F, 0x1F, 0x97, 0x7A, 0x89)
+GUID_ENTRY("EFI_NETWORK_INTERFACE_IDENTIFIER_PROTOCOL_GUID", 0xE18541CD, 0xF755, 0x4f73, 0x92, 0x8D, 0x64, 0x3C, 0x8A, 0x79, 0xB2, 0x29)
+GUID_ENTRY("EFI_NIC_IP4_CONFIG_NVDATA_GUID", 0x9d5b53f, 0xf4b0, 0x4f59, 0xa0, 0xb1, 0x7b, 0x57, 0xd3, 0x5c, 0xe, 0x5)
+GUID_ENTRY("EFI_NIC_IP4_CONFIG_PROTOCOL_GUID", 0xdca3d4d, 0x12da, 0x4728, 0xbf, 0x7e, 0x86, 0xce, 0xb9, 0x28, 0xd0, 0x67)
+GUID_ENTRY("EFI_NIC_IP4_CONFIG_VARIABLE_GUID", 0xd8944553, 0xc4dd, 0x41f4, 0x9b, 0x30, 0xe1, 0x39, 0x7c, 0xfb, 0x26, 0x7b)
+GUID_ENTRY("EFI_NT_LOAD_AS_DLL_PPI_GUID", 0xccc53f6b, 0xa03a, 0x4ed8, 0x83, 0x9a, 0x3, 0xd9, 0x9c, 0x2, 0xb4, 0xe3)
+GUID_ENTRY("EFI_OEM_BADGING_PROTOCOL_GUID", 0x170e13c0, 0xbf1b, 0x4218, 0x87, 0x1d, 0x2a, 0xbd, 0xc6, 0xf8, 0x87, 0xbc)
+GUID_ENTRY("EFI_PART_TYPE_EFI_SYSTEM_PART_GUID", 0xc12a7328, 0xf81f, 0x11d2, 0xba, 0x4b, 0x00, 0xa0, 0xc9, 0x3e, 0xc9, 0x3b)
+GUID_ENTRY("EFI_PART_TYPE_LEGACY_MBR_GUID", 0x024dee41, 0x33e7, 0x11d3, 0x9d, 0x69, 0x00, 0x08, 0xc7, 0x81, 0xf3, 0x9f)
+GUID_ENTRY("EFI_PATH_FILE_NAME_GUID", 0x7644C181, 0xFA6E, 0x46DA, 0x80, 0xCB, 0x04, 0xB9, 0x90, 0x40, 0x62, 0xE8)
+GUID_ENTRY("EFI_PCD_PROTOCOL_GUID", 0x13a3f0f6, 0x264a, 0x3ef0, 0xf2, 0xe0, 0xde, 0xc5, 0x12, 0x34, 0x2f, 0x34)
+GUID_ENTRY("EFI_PCI_ENUMERATION_COMPLETE_GUID", 0x30cfe3e7, 0x3de1, 0x4586, 0xbe, 0x20, 0xde, 0xab, 0xa1, 0xb3, 0xb7, 0x93)
+GUID_ENTRY("EFI_PCI_EXPRESS_BASE_ADDRESS_GUID", 0x3677d529, 0x326f, 0x4603, 0xa9, 0x26, 0xea, 0xac, 0xe0, 0x1d, 0xcb, 0xb0)
+GUID_ENTRY("EFI_PCI_HOST_BRIDGE_RESOURCE_ALLOCATION_PROTOCOL_GUID", 0xCF8034BE, 0x6768, 0x4d8b, 0xB7, 0x39, 0x7C, 0xCE, 0x68, 0x3A, 0x9F, 0xBE)
+GUID_ENTRY("EFI_PCI_HOTPLUG_DEVICE_GUID", 0x0b280816, 0x52e7, 0x4e51, 0xaa, 0x57, 0x11, 0xbd, 0x41, 0xcb, 0xef, 0xc3)
+GUID_ENTRY("EFI_PCI_HOTPLUG_REQUEST_PROTOCOL_GUID", 0x19cb87ab, 0x2cb9, 0x4665, 0x83, 0x60, 0xdd, 0xcf, 0x60, 0x54, 0xf7, 0x9d)
+GUID_ENTRY("EFI_PCI_HOT_PLUG_INIT_PROTOCOL_GUID", 0xaa0e8bc1, 0xdabc, 0x46b0, 0xa8, 0x44, 0x37, 0xb8, 0x16, 0x9b, 0x2b, 0xea)
+GUID_ENTRY("EFI_PCI_IO_PROTOCOL_GUID", 0x4cf5b200, 0x68b8, 0x4ca5, 0x9e, 0xec, 0xb2, 0x3e, 0x3f, 0x50, 0x2, 0x9a)
+GUID_ENTRY("EFI_PCI_OPTION_ROM_TABLE_GUID", 0x7462660f, 0x1cbd, 0x48da, 0xad, 0x11, 0x91, 0x71, 0x79, 0x13, 0x83, 0x1c)
+GUID_ENTRY("EFI_PCI_OVERRIDE_GUID", 0xb5b35764, 0x460c, 0x4a06, 0x99, 0xfc, 0x77, 0xa1, 0x7c, 0x1b, 0x5c, 0xeb)
+GUID_ENTRY("EFI_PCI_PLATFORM_PROTOCOL_GUID", 0x7d75280, 0x27d4, 0x4d69, 0x90, 0xd0, 0x56, 0x43, 0xe2, 0x38, 0xb3, 0x41)
+GUID_ENTRY("EFI_PCI_ROOT_BRIDGE_IO_PROTOCOL_GUID", 0x2f707ebb, 0x4a1a, 0x11d4, 0x9a, 0x38, 0x00, 0x90, 0x27, 0x3f, 0xc1, 0x4d)
+GUID_ENTRY("EFI_PC_ANSI_GUID", 0xe0c14753, 0xf9be, 0x11d2, 0x9a, 0x0c, 0x00, 0x90, 0x27, 0x3f, 0xc1, 0x4d)
+GUID_ENTRY("EFI_PEI_APRIORI_FILE_NAME_GUID", 0x1b45cc0a, 0x156a, 0x428a, 0xaf, 0x62, 0x49, 0x86, 0x4d, 0xa0, 0xe6, 0xe6)
+GUID_ENTRY("EFI_PEI_BOOT_SCRIPT_EXECUTER_PPI_GUID", 0xabd42895, 0x78cf, 0x4872, 0x84, 0x44, 0x1b, 0x5c, 0x18, 0x0b, 0xfb, 0xff)
+GUID_ENTRY("EFI_PEI_CPU_IO_PPI_INSTALLED_GUID", 0xe6af1f7b, 0xfc3f, 0x46da, 0xa8, 0x28, 0xa3, 0xb4, 0x57, 0xa4, 0x42, 0x82)
+GUID_ENTRY("EFI_PEI_DECOMPRESS_PPI_GUID", 0x1a36e4e7, 0xfab6, 0x476a, 0x8e, 0x75, 0x69, 0x5a, 0x5, 0x76, 0xfd, 0xd7)
+GUID_ENTRY("EFI_PEI_DEVICE_RECOVERY_MODULE_PPI_GUID", 0x0DE2CE25, 0x446A, 0x45a7, 0xBF, 0xC9, 0x37, 0xDA, 0x26, 0x34, 0x4B, 0x37)
+GUID_ENTRY("EFI_PEI_END_OF_PEI_PHASE_PPI_GUID", 0x605EA650, 0xC65C, 0x42e1, 0xBA, 0x80, 0x91, 0xA5, 0x2A, 0xB6, 0x18, 0xC6)
+GUID_ENTRY("EFI_PEI_FIND_FV_PPI_GUID", 0x36164812, 0xa023, 0x44e5, 0xbd, 0x85, 0x5, 0xbf, 0x3c, 0x77, 0x0, 0xaa)
+GUID_ENTRY("EFI_PEI_FIRMWARE_VOLUME_INFO_PPI_GUID", 0x49edb1c1, 0xbf21, 0x4761, 0xbb, 0x12, 0xeb, 0x0, 0x31, 0xaa, 0xbb, 0x39)
+GUID_ENTRY("EFI_PEI_FLUSH_INSTRUCTION_CACHE_GUID", 0xd8117cfc, 0x94a6, 0x11d4, 0x9a, 0x3a, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d)
+GUID_ENTRY("EFI_PEI_LOADED_IMAGE_PPI_GUID", 0xc1fcd448, 0x6300, 0x4458, 0xb8, 0x64, 0x28, 0xdf, 0x01, 0x53, 0x64, 0xbc)
+GUID_ENTRY("EFI_PEI_LOAD_FILE_GUID", 0xb9e0abfe, 0x5979, 0x4914, 0x97, 0x7f, 0x6d, 0xee, 0x78, 0xc2, 0x78, 0xa6)
+GUID_ENTRY("EFI_PEI_LOAD_FILE_PPI_GUID", 0xb9e0abfe, 0x5979, 0x4914, 0x97, 0x7f, 0x6d, 0xee, 0x78, 0xc2, 0x78, 0xa6)
+GUID_ENTRY("EFI_PEI_PCD_PPI_GUID", 0x1f34d25, 0x4de2, 0x23ad, 0x3f, 0xf3, 0x36, 0x35, 0x3f, 0xf3, 0x23, 0xf1)
+GUID_ENTRY("EFI_PEI_PCI_CFG2_PPI_GUID", 0x57a449a, 0x1fdc, 0x4c06, 0xbf, 0xc9, 0xf5, 0x3f, 0x6a, 0x99, 0xbb, 0x92)
+GUID_ENTRY("EFI_PEI_PCI_CFG_PPI_INSTALLED_GUID", 0xe1f2eba0, 0xf7b9, 0x4a26, 0x86, 0x20, 0x13, 0x12, 0x21, 0x64, 0x2a, 0x90)
+GUID_ENTRY("EFI_PEI_PERFORMANCE_HOB_GUID", 0x10f432de, 0xdeec, 0x4631, 0x80, 0xcd, 0x47, 0xf6, 0x5d, 0x8f, 0x80, 0xbb)
+GUID_ENTRY("EFI_PEI_PERMANENT_MEMORY_INSTALLED_PPI_GUID", 0xf894643d, 0xc449, 0x42d1, 0x8e, 0xa8, 0x85, 0xbd, 0xd8, 0xc6, 0x5b, 0xde)
+GUID_ENTRY("EFI_PEI_PE_COFF_LOADER_GUID", 0xd8117cff, 0x94a6, 0x11d4, 0x9a, 0x3a, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d)
+GUID_ENTRY("EFI_PEI_READ_ONLY_VARIABLE2_PPI_GUID", 0x2ab86ef5, 0xecb5, 0x4134, 0xb5, 0x56, 0x38, 0x54, 0xca, 0x1f, 0xe1, 0xb4)
+GUID_ENTRY("EFI_PEI_READ_ONLY_VARIABLE_ACCESS_PPI_GUID", 0x3cdc90c6, 0x13fb, 0x4a75, 0x9e, 0x79, 0x59, 0xe9, 0xdd, 0x78, 0xb9, 0xfa)
+GUID_ENTRY("EFI_PEI_RECOVERY_BLOCK_IO_PPI_GUID", 0x695d8aa1, 0x42ee, 0x4c46, 0x80, 0x5c, 0x6e, 0xa6, 0xbc, 0xe7, 0x99, 0xe3)
+GUID_ENTRY("EFI_PEI_RECOVERY_MODULE_PPI_GUID", 0xFB6D9542, 0x612D, 0x4f45, 0x87, 0x2F, 0x5C, 0xFF, 0x52, 0xE9, 0x3D, 0xCF)
+GUID_ENTRY("EFI_PEI_REPORT_PROGRESS_CODE_PPI_GUID", 0x229832d3, 0x7a30, 0x4b36, 0xb8, 0x27, 0xf4, 0xc, 0xb7, 0xd4, 0x54, 0x36)
+GUID_ENTRY("EFI_PEI_RESET_PPI_GUID", 0xef398d58, 0x9dfd, 0x4103, 0xbf, 0x94, 0x78, 0xc6, 0xf4, 0xfe, 0x71, 0x2f)
+GUID_ENTRY("EFI_PEI_RSC_HANDLER_PPI_GUID", 0x65d394, 0x9951, 0x4144, 0x82, 0xa3, 0xa, 0xfc, 0x85, 0x79, 0xc2, 0x51)
+GUID_ENTRY("EFI_PEI_S3_RESUME2_PPI_GUID", 0x6D582DBC, 0xDB85, 0x4514, 0x8F, 0xCC, 0x5A, 0xDF, 0x62, 0x27, 0xB1, 0x47)
+GUID_ENTRY("EFI_PEI_S3_RESUME_PPI_GUID", 0x4426CCB2, 0xE684, 0x4a8a, 0xAE, 0x40, 0x20, 0xD4, 0xB0, 0x25, 0xB7, 0x10)
+GUID_ENTRY("EFI_PEI_SECTION_EXTRACTION_PPI_GUID", 0x4F89E208, 0xE144, 0x4804, 0x9E, 0xC8, 0x0F, 0x89, 0x4F, 0x7E, 0x36, 0xD7)
+GUID_ENTRY("EFI_PEI_SECURITY2_PPI_GUID", 0xdcd0be23, 0x9586, 0x40f4, 0xb6, 0x43, 0x06, 0x52, 0x2c, 0xed, 0x4e, 0xde)
+GUID_ENTRY("EFI_PEI_SECURITY_PPI_GUID", 0x1388066e, 0x3a57, 0x4efa, 0x98, 0xf3, 0xc1, 0x2f, 0x3a, 0x95, 0x8a, 0x29)
+GUID_ENTRY("EFI_PEI_SMBUS2_PPI_GUID", 0x9ca93627, 0xb65b, 0x4324, 0xa2, 0x2, 0xc0, 0xb4, 0x61, 0x76, 0x45, 0x43)
+GUID_ENTRY("EFI_PEI_SMBUS_PPI_GUID", 0xabd42895, 0x78cf, 0x4872, 0x84, 0x44, 0x1b, 0x5c, 0x18, 0xb, 0xfb, 0xda)
+GUID_ENTRY("EFI_PEI_SMM_COMMUNICATION_PPI_GUID", 0xae933e1c, 0xcc47, 0x4e38, 0x8f, 0xe, 0xe2, 0xf6, 0x1d, 0x26, 0x5, 0xdf)
+GUID_ENTRY("EFI_PEI_STALL_PPI_GUID", 0x1f4c6f90, 0xb06b, 0x48d8, 0xa2, 0x01, 0xba, 0xe5, 0xf1, 0xcd, 0x7d, 0x56)
+GUID_ENTRY("EFI_PEI_TEMPORARY_RAM_DONE_PPI_GUID", 0xceab683c, 0xec56, 0x4a2d, 0xa9, 0x06, 0x40, 0x53, 0xfa, 0x4e, 0x9c, 0x16)
+GUID_ENTRY("EFI_PEI_TEMPORARY_RAM_SUPPORT_PPI_GUID", 0xdbe23aa9, 0xa345, 0x4b97, 0x85, 0xb6, 0xb2, 0x26, 0xf1, 0x61, 0x73, 0x89)
+GUID_ENTRY("EFI_PEI_TRANSFER_CONTROL_GUID", 0xd8117d02, 0x94a6, 0x11d4, 0x9a, 0x3a, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d)
+GUID_ENTRY("EFI_PEI_VECTOR_HANDOFF_INFO_PPI_GUID", 0x3cd652b4, 0x6d33, 0x4dce, 0x89, 0xdb, 0x83, 0xdf, 0x97, 0x66, 0xfc, 0xca)
+GUID_ENTRY("EFI_PERFORMANCE_PROTOCOL_GUID", 0xFFECFFFF, 0x923C, 0x14d2, 0x9E, 0x3F, 0x22, 0xA0, 0xC9, 0x69, 0x56, 0x3B)
+GUID_ENTRY("EFI_PHYSICAL_PRESENCE_DATA_GUID", 0xf6499b1, 0xe9ad, 0x493d, 0xb9, 0xc2, 0x2f, 0x90, 0x81, 0x5c, 0x6c, 0xbc)
+GUID_ENTRY("EFI_PLATFORM_DRIVER_OVERRIDE_PROTOCOL_GUID", 0x6b30c738, 0xa391, 0x11d4, 0x9a, 0x3b, 0x00, 0x90, 0x27, 0x3f, 0xc1, 0x4d)
+GUID_ENTRY("EFI_PLATFORM_MEMTEST_PROTOCOL_GUID", 0x859ba18, 0x7dd7, 0x4ed7, 0xa8, 0x8e, 0x10, 0x9c, 0x63, 0x91, 0x7b, 0xdd)
+GUID_ENTRY("EFI_PLATFORM_TO_DRIVER_CONFIGURATION_CLP_GUID", 0x345ecc0e, 0x0cb6, 0x4b75, 0xbb, 0x57, 0x1b, 0x12, 0x9c, 0x47, 0x33, 0x3e)
+GUID_ENTRY("EFI_PLATFORM_TO_DRIVER_CONFIGURATION_PROTOCOL_GUID", 0x642cd590, 0x8059, 0x4c0a, 0xa9, 0x58, 0xc5, 0xec, 0x07, 0xd2, 0x3c, 0x4b)
+GUID_ENTRY("EFI_PRIMARY_CONSOLE_IN_DEVICE_GUID", 0xe451dcbe, 0x96a1, 0x4729, 0xa5, 0xcf, 0x6b, 0x9c, 0x2c, 0xff, 0x47, 0xfd)
+GUID_ENTRY("EFI_PRIMARY_CONSOLE_OUT_DEVICE_GUID", 0x62bdf38a, 0xe3d5, 0x492c, 0x95, 0xc, 0x23, 0xa7, 0xf6, 0x6e, 0x67, 0x2e)
+GUID_ENTRY("EFI_PRIMARY_STANDARD_ERROR_DEVICE_GUID", 0x5a68191b, 0x9b97, 0x4752, 0x99, 0x46, 0xe3, 0x6a, 0x5d, 0xa9, 0x42, 0xb1)
+GUID_ENTRY("EFI_PRINT2_PROTOCOL_GUID", 0xf05976ef, 0x83f1, 0x4f3d, 0x86, 0x19, 0xf7, 0x59, 0x5d, 0x41, 0xe5, 0x38)
+GUID_ENTRY("EFI_PRINT_PROTOCOL_GUID", 0xdf2d868e, 0x32fc, 0x4cf0, 0x8e, 0x6b, 0xff, 0xd9, 0x5d, 0x13, 0x43, 0xd0)
+GUID_ENTRY("EFI_PROCESSOR_PRODUCER_GUID", 0x1bf06aea, 0x5bec, 0x4a8d, 0x95, 0x76, 0x74, 0x9b, 0x09, 0x56, 0x2d, 0x30)
+GUID_ENTRY("EFI_PROCESSOR_SUBCLASS_GUID", 0x26fdeb7e, 0xb8af, 0x4ccf, 0xaa, 0x97, 0x02, 0x63, 0x3c, 0xe4, 0x8c, 0xa7)
+GUID_ENTRY("EFI_PS2_POLICY_PROTOCOL_GUID", 0x4df19259, 0xdc71, 0x4d46, 0xbe, 0xf1, 0x35, 0x7b, 0xb5, 0x78, 0xc4, 0x18)
+GUID_ENTRY("EFI_PXE_BASE_CODE_CALLBACK_PROTOCOL_GUID", 0x245dca21, 0xfb7b, 0x11d3, 0x8f, 0x01, 0x00, 0xa0, 0xc9, 0x69, 0x72, 0x3b)
+GUID_ENTRY("EFI_PXE_BASE_CODE_PROTOCOL_GUID", 0x03c4e603, 0xac28, 0x11d3, 0x9a, 0x2d, 0x00, 0x90, 0x27, 0x3f, 0xc1, 0x4d)
+GUID_ENTRY("EFI_PXE_DHCP4_CALLBACK_PROTOCOL_GUID", 0xc1544c01, 0x92a4, 0x4198, 0x8a, 0x84, 0x77, 0x85, 0x83, 0xc2, 0x36, 0x21)
+GUID_ENTRY("EFI_PXE_DHCP4_PROTOCOL_GUID", 0x03c4e624, 0xac28, 0x11d3, 0x9a, 0x2d, 0x00, 0x90, 0x29, 0x3f, 0xc1, 0x4d)
+GUID_ENTRY("EFI_REAL_TIME_CLOCK_ARCH_PROTOCOL_GUID", 0x27CFAC87, 0x46CC, 0x11d4, 0x9A, 0x38, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D)
+GUID_ENTRY("EFI_RESET_ARCH_PROTOCOL_GUID", 0x27CFAC88, 0x46CC, 0x11d4, 0x9A, 0x38, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D)
+GUID_ENTRY("EFI_RSC_HANDLER_PROTOCOL_GUID", 0x86212936, 0xe76, 0x41c8, 0xa0, 0x3a, 0x2a, 0xf2, 0xfc, 0x1c, 0x39, 0xe2)
+GUID_ENTRY("EFI_RUNTIME_ARCH_PROTOCOL_GUID", 0xb7dfb4e1, 0x52f, 0x449f, 0x87, 0xbe, 0x98, 0x18, 0xfc, 0x91, 0xb7, 0x33)
+GUID_ENTRY("EFI_RUNTIME_CRYPT_PROTOCOL_GUID", 0xe1475e0c, 0x1746, 0x4802, 0x86, 0x2e, 0x1, 0x1c, 0x2c, 0x2d, 0x9d, 0x86)
+GUID_ENTRY("EFI_S3_SAVE_STATE_PROTOCOL_GUID", 0xe857caf6, 0xc046, 0x45dc, 0xbe, 0x3f, 0xee, 0x7, 0x65, 0xfb, 0xa8, 0x87)
+GUID_ENTRY("EFI_S3_SMM_SAVE_STATE_PROTOCOL_GUID", 0x320afe62, 0xe593, 0x49cb, 0xa9, 0xf1, 0xd4, 0xc2, 0xf4, 0xaf, 0x1, 0x4c)
+GUID_ENTRY("EFI_SAL_MCA_INIT_PMI_PROTOCOL_GUID", 0xb60dc6e8, 0x3b6f, 0x11d5, 0xaf, 0x9, 0x0, 0xa0, 0xc9, 0x44, 0xa0, 0x5b)
+GUID_ENTRY("EFI_SAL_SYSTEM_TABLE_GUID", 0xeb9d2d32, 0x2d88, 0x11d3, 0x9a, 0x16, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d)
+GUID_ENTRY("EFI_SAS_DEVICE_PATH_GUID", 0xd487ddb4, 0x008b, 0x11d9, 0xaf, 0xdc, 0x00, 0x10, 0x83, 0xff, 0xca, 0x4d)
+GUID_ENTRY("EFI_SCSI_BUS_PROTOCOL_GUID", 0x5261213D, 0x3A3D, 0x441E, 0xB3, 0xAF, 0x21, 0xD3, 0xF7, 0xA4, 0xCA, 0x17)
+GUID_ENTRY("EFI_SCSI_IO_PROTOCOL_GUID", 0x932f47e6, 0x2362, 0x4002, 0x80, 0x3e, 0x3c, 0xd5, 0x4b, 0x13, 0x8f, 0x85)
+GUID_ENTRY("EFI_SCSI_PASS_THRU_PROTOCOL_GUID", 0xa59e8fcf, 0xbda0, 0x43bb, 0x90, 0xb1, 0xd3, 0x73, 0x2e, 0xca, 0xa8, 0x77)
+GUID_ENTRY("EFI_SECTION_EXTRACTION_PROTOCOL_GUID", 0x448F5DA4, 0x6DD7, 0x4FE1, 0x93, 0x07, 0x69, 0x22, 0x41, 0x92, 0x21, 0x5D)
+GUID_ENTRY("EFI_SECURITY2_ARCH_PROTOCOL_GUID", 0x94ab2f58, 0x1438, 0x4ef1, 0x91, 0x52, 0x18, 0x94, 0x1a, 0x3a, 0x0e, 0x68)
+GUID_ENTRY("EFI_SECURITY_ARCH_PROTOCOL_GUID", 0xA46423E3, 0x4617, 0x49f1, 0xB9, 0xFF, 0xD1, 0xBF, 0xA9, 0x11, 0x58, 0x39)
+GUID_ENTRY("EFI_SECURITY_POLICY_PROTOCOL_GUID", 0x78E4D245, 0xCD4D, 0x4a05, 0xA2, 0xBA, 0x47, 0x43, 0xE8, 0x6C, 0xFC, 0xAB)
+GUID_ENTRY("EFI_SEC_PLATFORM_INFORMATION_GUID", 0x6f8c2b35, 0xfef4, 0x448d, 0x82, 0x56, 0xe1, 0x1b, 0x19, 0xd6, 0x10, 0x77)
+GUID_ENTRY("EFI_SERIAL_IO_PROTOCOL_GUID", 0xBB25CF6F, 0xF1D4, 0x11D2, 0x9A, 0x0C, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0xFD)
+GUID_ENTRY("EFI_SE_EXT_SIGNATURE_GUID", 0xd2c18636, 0x40e5, 0x4eb5, 0xa3, 0x1b, 0x36, 0x69, 0x5f, 0xd4, 0x2c, 0x87)
+GUID_ENTRY("EFI_SHELLPKG_TOKEN_SPACE_GUID", 0x171e9188, 0x31d3, 0x40f5, 0xb1, 0xc, 0x53, 0x9b, 0x2d, 0xb9, 0x40, 0xcd)
+GUID_ENTRY("EFI_SHELL_FILE_GUID", 0xc57ad6b7, 0x0515, 0x40a8, 0x9d, 0x21, 0x55, 0x16, 0x52, 0x85, 0x4e, 0x37)
+GUID_ENTRY("EFI_SHELL_PARAMETERS_PROTOCOL_GUID", 0x752f3136, 0x4e16, 0x4fdc, 0xa2, 0x2a, 0xe5, 0xf4, 0x68, 0x12, 0xf4, 0xca)
+GUID_ENTRY("EFI_SHELL_PROTOCOL_GUID", 0x6302d008, 0x7f9b, 0x4f30, 0x87, 0xac, 0x60, 0xc9, 0xfe, 0xf5, 0xda, 0x4e)
+GUID_ENTRY("EFI_SIMPLE_FILE_SYSTEM_PROTOCOL_GUID", 0x964e5b22, 0x6459, 0x11d2, 0x8e, 0x39, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b)
+GUID_ENTRY("EFI_SIMPLE_NETWORK_PROTOCOL_GUID", 0xA19832B9, 0xAC25, 0x11D3, 0x9A, 0x2D, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D)
+GUID_ENTRY("EFI_SIMPLE_POINTER_PROTOCOL_GUID", 0x31878c87, 0xb75, 0x11d5, 0x9a, 0x4f, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d)
+GUID_ENTRY("EFI_SIMPLE_TEXT_INPUT_EX_PROTOCOL_GUID", 0xdd9e7534, 0x7762, 0x4698, 0x8c, 0x14, 0xf5, 0x85, 0x17, 0xa6, 0x25, 0xaa)
+GUID_ENTRY("EFI_SIMPLE_TEXT_INPUT_PROTOCOL_GUID", 0x387477c1, 0x69c7, 0x11d2, 0x8e, 0x39, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b)
+GUID_ENTRY("EFI_SIMPLE_TEXT_IN_PROTOCOL_GUID", 0x387477c1, 0x69c7, 0x11d2, 0x8e, 0x39, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b)
+GUID_ENTRY("EFI_SIMPLE_TEXT_OUTPUT_PROTOCOL_GUID", 0x387477c2, 0x69c7, 0x11d2, 0x8e, 0x39, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b)
+GUID_ENTRY("EFI_SIMPLE_TEXT_OUT_PROTOCOL_GUID", 0x387477c2, 0x69c7, 0x11d2, 0x8e, 0x39, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b)
+GUID_ENTRY("EFI_SIO_PROTOCOL_GUID", 0x215fdd18, 0xbd50, 0x4feb, 0x89, 0xb, 0x58, 0xca, 0xb, 0x47, 0x39, 0xe9)
+GUID_ENTRY("EFI_SMBIOS_PROTOCOL_GUID", 0x3583ff6, 0xcb36, 0x4940, 0x94, 0x7e, 0xb9, 0xb3, 0x9f, 0x4a, 0xfa, 0xf7)
+GUID_ENTRY("EFI_SMBIOS_TABLE_GUID", 0xeb9d2d31, 0x2d88, 0x11d3, 0x9a, 0x16, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d)
+GUID_ENTRY("EFI_SMBUS_HC_PROTOCOL_GUID", 0xe49d33ed, 0x513d, 0x4634, 0xb6, 0x98, 0x6f, 0x55, 0xaa, 0x75, 0x1c, 0x1b)
+GUID_ENTRY("EFI_SMM_ACCESS2_PROTOCOL_GUID", 0xc2702b74, 0x800c, 0x4131, 0x87, 0x46, 0x8f, 0xb5, 0xb8, 0x9c, 0xe4, 0xac)
+GUID_ENTRY("EFI_SMM_ACCESS_PROTOCOL_GUID", 0x3792095a, 0xe309, 0x4c1e, 0xaa, 0x01, 0x85, 0xf5, 0x65, 0x5a, 0x17, 0xf1)
+GUID_ENTRY("EFI_SMM_BASE2_PROTOCOL_GUID", 0xf4ccbfb7, 0xf6e0, 0x47fd, 0x9d, 0xd4, 0x10, 0xa8, 0xf1, 0x50, 0xc1, 0x91)
+GUID_ENTRY("EFI_SMM_BASE_HELPER_READY_PROTOCOL_GUID", 0x910dca07, 0x1f94, 0x4ee7, 0xaf, 0x2f, 0xff, 0x72, 0xf3, 0x15, 0x43, 0x53)
+GUID_ENTRY("EFI_SMM_BASE_PROTOCOL_GUID", 0x1390954D, 0xda95, 0x4227, 0x93, 0x28, 0x72, 0x82, 0xc2, 0x17, 0xda, 0xa8)
+GUID_ENTRY("EFI_SMM_COMMUNICATION_PROTOCOL_GUID", 0xc68ed8e2, 0x9dc6, 0x4cbd, 0x9d, 0x94, 0xdb, 0x65, 0xac, 0xc5, 0xc3, 0x32)
+GUID_ENTRY("EFI_SMM_CONFIGURATION_PROTOCOL_GUID", 0x26eeb3de, 0xb689, 0x492e, 0x80, 0xf0, 0xbe, 0x8b, 0xd7, 0xda, 0x4b, 0xa7)
+GUID_ENTRY("EFI_SMM_CONTROL2_PROTOCOL_GUID", 0x843dc720, 0xab1e, 0x42cb, 0x93, 0x57, 0x8a, 0x0, 0x78, 0xf3, 0x56, 0x1b)
+GUID_ENTRY("EFI_SMM_CONTROL_PROTOCOL_GUID", 0x8d12e231, 0xc667, 0x4fd1, 0x98, 0xf2, 0x24, 0x49, 0xa7, 0xe7, 0xb2, 0xe5)
+GUID_ENTRY("EFI_SMM_CPU_IO2_PROTOCOL_GUID", 0x3242A9D8, 0xCE70, 0x4AA0, 0x95, 0x5D, 0x5E, 0x7B, 0x14, 0x0D, 0xE4, 0xD2)
+GUID_ENTRY("EFI_SMM_CPU_IO_GUID", 0x5f439a0b, 0x45d8, 0x4682, 0xa4, 0xf4, 0xf0, 0x57, 0x6b, 0x51, 0x34, 0x41)
+GUID_ENTRY("EFI_SMM_CPU_PROTOCOL_GUID", 0xeb346b97, 0x975f, 0x4a9f, 0x8b, 0x22, 0xf8, 0xe9, 0x2b, 0xb3, 0xd5, 0x69)
+GUID_ENTRY("EFI_SMM_CPU_SAVE_STATE_PROTOCOL_GUID", 0x21f302ad, 0x6e94, 0x471b, 0x84, 0xbc, 0xb1, 0x48, 0x0, 0x40, 0x3a, 0x1d)
+GUID_ENTRY("EFI_SMM_END_OF_DXE_PROTOCOL_GUID", 0x24e70042, 0xd5c5, 0x4260, 0x8c, 0x39, 0xa, 0xd3, 0xaa, 0x32, 0xe9, 0x3d)
+GUID_ENTRY("EFI_SMM_FAULT_TOLERANT_WRITE_PROTOCOL_GUID", 0x3868fc3b, 0x7e45, 0x43a7, 0x90, 0x6c, 0x4b, 0xa4, 0x7d, 0xe1, 0x75, 0x4d)
+GUID_ENTRY("EFI_SMM_FIRMWARE_VOLUME_BLOCK_PROTOCOL_GUID", 0xd326d041, 0xbd31, 0x4c01, 0xb5, 0xa8, 0x62, 0x8b, 0xe8, 0x7f, 0x6, 0x53)
+GUID_ENTRY("EFI_SMM_GPI_DISPATCH2_PROTOCOL_GUID", 0x25566b03, 0xb577, 0x4cbf, 0x95, 0x8c, 0xed, 0x66, 0x3e, 0xa2, 0x43, 0x80)
+GUID_ENTRY("EFI_SMM_GPI_DISPATCH_PROTOCOL_GUID", 0xe0744b81, 0x9513, 0x49cd, 0x8c, 0xea, 0xe9, 0x24, 0x5e, 0x70, 0x39, 0xda)
+GUID_ENTRY("EFI_SMM_ICHN_DISPATCH_PROTOCOL_GUID", 0xc50b323e, 0x9075, 0x4f2a, 0xac, 0x8e, 0xd2, 0x59, 0x6a, 0x10, 0x85, 0xcc)
+GUID_ENTRY("EFI_SMM_IO_TRAP_DISPATCH2_PROTOCOL_GUID", 0x58dc368d, 0x7bfa, 0x4e77, 0xab, 0xbc, 0xe, 0x29, 0x41, 0x8d, 0xf9, 0x30)
+GUID_ENTRY("EFI_SMM_LOCK_BOX_COMMUNICATION_GUID", 0x2a3cfebd, 0x27e8, 0x4d0a, 0x8b, 0x79, 0xd6, 0x88, 0xc2, 0xa3, 0xe1, 0xc0)
+GUID_ENTRY("EFI_SMM_PCI_ROOT_BRIDGE_IO_PROTOCOL_GUID", 0x8bc1714d, 0xffcb, 0x41c3, 0x89, 0xdc, 0x6c, 0x74, 0xd0, 0x6d, 0x98, 0xea)
+GUID_ENTRY("EFI_SMM_PERIODIC_TIMER_DISPATCH2_PROTOCOL_GUID", 0x4cec368e, 0x8e8e, 0x4d71, 0x8b, 0xe1, 0x95, 0x8c, 0x45, 0xfc, 0x8a, 0x53)
+GUID_ENTRY("EFI_SMM_PERIODIC_TIMER_DISPATCH_PROTOCOL_GUID", 0x9cca03fc, 0x4c9e, 0x4a19, 0x9b, 0x6, 0xed, 0x7b, 0x47, 0x9b, 0xde, 0x55)
+GUID_ENTRY("EFI_SMM_POWER_BUTTON_DISPATCH2_PROTOCOL_GUID", 0x1b1183fa, 0x1823, 0x46a7, 0x88, 0x72, 0x9c, 0x57, 0x87, 0x55, 0x40, 0x9d)
+GUID_ENTRY("EFI_SMM_POWER_BUTTON_DISPATCH_PROTOCOL_GUID", 0xb709efa0, 0x47a6, 0x4b41, 0xb9, 0x31, 0x12, 0xec, 0xe7, 0xa8, 0xee, 0x56)
+GUID_ENTRY("EFI_SMM_READY_TO_LOCK_PROTOCOL_GUID", 0x47b7fa8c, 0xf4bd, 0x4af6, 0x82, 0x00, 0x33, 0x30, 0x86, 0xf0, 0xd2, 0xc8)
+GUID_ENTRY("EFI_SMM_RSC_HANDLER_PROTOCOL_GUID", 0x2ff29fa7, 0x5e80, 0x4ed9, 0xb3, 0x80, 0x1, 0x7d, 0x3c, 0x55, 0x4f, 0xf4)
+GUID_ENTRY("EFI_SMM_STANDBY_BUTTON_DISPATCH2_PROTOCOL_GUID", 0x7300c4a1, 0x43f2, 0x4017, 0xa5, 0x1b, 0xc8, 0x1a, 0x7f, 0x40, 0x58, 0x5b)
+GUID_ENTRY("EFI_SMM_STANDBY_BUTTON_DISPATCH_PROTOCOL_GUID", 0x78965b98, 0xb0bf, 0x449e, 0x8b, 0x22, 0xd2, 0x91, 0x4e, 0x49, 0x8a, 0x98)
+GUID_ENTRY("EFI_SMM_STATUS_CODE_PROTOCOL_GUID", 0x6afd2b77, 0x98c1, 0x4acd, 0xa6, 0xf9, 0x8a, 0x94, 0x39, 0xde, 0xf, 0xb1)
+GUID_ENTRY("EFI_SMM_SWAP_ADDRESS_RANGE_PROTOCOL_GUID", 0x67c4f112, 0x3385, 0x4e55, 0x9c, 0x5b, 0xc0, 0x5b, 0x71, 0x7c, 0x42, 0x28)
+GUID_ENTRY("EFI_SMM_SW_DISPATCH2_PROTOCOL_GUID", 0x18a3c6dc, 0x5eea, 0x48c8, 0xa1, 0xc1, 0xb5, 0x33, 0x89, 0xf9, 0x89, 0x99)
+GUID_ENTRY("EFI_SMM_SW_DISPATCH_PROTOCOL_GUID", 0xe541b773, 0xdd11, 0x420c, 0xb0, 0x26, 0xdf, 0x99, 0x36, 0x53, 0xf8, 0xbf)
+GUID_ENTRY("EFI_SMM_SX_DISPATCH2_PROTOCOL_GUID", 0x456d2859, 0xa84b, 0x4e47, 0xa2, 0xee, 0x32, 0x76, 0xd8, 0x86, 0x99, 0x7d)
+GUID_ENTRY("EFI_SMM_SX_DISPATCH_PROTOCOL_GUID", 0x14fc52be, 0x1dc, 0x426c, 0x91, 0xae, 0xa2, 0x3c, 0x3e, 0x22, 0xa, 0xe8)
+GUID_ENTRY("EFI_SMM_USB_DISPATCH2_PROTOCOL_GUID", 0xee9b8d90, 0xc5a6, 0x40a2, 0xbd, 0xe2, 0x52, 0x55, 0x8d, 0x33, 0xcc, 0xa1)
+GUID_ENTRY("EFI_SMM_USB_DISPATCH_PROTOCOL_GUID", 0xa05b6ffd, 0x87af, 0x4e42, 0x95, 0xc9, 0x62, 0x28, 0xb6, 0x3c, 0xf3, 0xf3)
+GUID_ENTRY("EFI_SMM_VARIABLE_PROTOCOL_GUID", 0xed32d533, 0x99e6, 0x4209, 0x9c, 0xc0, 0x2d, 0x72, 0xcd, 0xd9, 0x98, 0xa7)
+GUID_ENTRY("EFI_SMM_VARIABLE_WRITE_GUID", 0x93ba1826, 0xdffb, 0x45dd, 0x82, 0xa7, 0xe7, 0xdc, 0xaa, 0x3b, 0xbd, 0xf3)
+GUID_ENTRY("EFI_STANDARD_CALLER_ID_GUID", 0xC9DCF469, 0xA7C4, 0x11D5, 0x87, 0xDA, 0x00, 0x06, 0x29, 0x45, 0xC3, 0xB9)
+GUID_ENTRY("EFI_STANDARD_ERROR_DEVICE_GUID", 0xd3b36f2d, 0xd551, 0x11d4, 0x9a, 0x46, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d)
+GUID_ENTRY("EFI_STATUS_CODE_DATA_TYPE_ASSERT_GUID", 0xDA571595, 0x4D99, 0x487C, 0x82, 0x7C, 0x26, 0x22, 0x67, 0x7D, 0x33, 0x07)
+GUID_ENTRY("EFI_STATUS_CODE_DATA_TYPE_DEBUG_GUID", 0x9A4E9246, 0xD553, 0x11D5, 0x87, 0xE2, 0x00, 0x06, 0x29, 0x45, 0xC3, 0xb9)
+GUID_ENTRY("EFI_STATUS_CODE_DATA_TYPE_ERROR_GUID", 0xAB359CE3, 0x99B3, 0xAE18, 0xC8, 0x9D, 0x95, 0xD3, 0xB0, 0x72, 0xE1, 0x9B)
+GUID_ENTRY("EFI_STATUS_CODE_DATA_TYPE_EXCEPTION_HANDLER_GUID", 0x3BC2BD12, 0xAD2E, 0x11D5, 0x87, 0xDD, 0x00, 0x06, 0x29, 0x45, 0xC3, 0xB9)
+GUID_ENTRY("EFI_STATUS_CODE_DATA_TYPE_PROGRESS_CODE_GUID", 0xA356AB39, 0x35C4, 0x35DA, 0xB3, 0x7A, 0xF8, 0xEA, 0x9E, 0x8B, 0x36, 0xA3)
+GUID_ENTRY("EFI_STATUS_CODE_DATA_TYPE_STRING_GUID", 0x92D11080, 0x496F, 0x4D95, 0xBE, 0x7E, 0x03, 0x74, 0x88, 0x38, 0x2B, 0x0A)
+GUID_ENTRY("EFI_STATUS_CODE_GUID", 0xd083e94c, 0x6560, 0x42e4, 0xb6, 0xd4, 0x2d, 0xf7, 0x5a, 0xdf, 0x6a, 0x2a)
+GUID_ENTRY("EFI_STATUS_CODE_RUNTIME_PROTOCOL_GUID", 0xd2b2b828, 0x826, 0x48a7, 0xb3, 0xdf, 0x98, 0x3c, 0x0, 0x60, 0x24, 0xf0)
+GUID_ENTRY("EFI_STATUS_CODE_SPECIFIC_DATA_GUID", 0x335984bd, 0xe805, 0x409a, 0xb8, 0xf8, 0xd2, 0x7e, 0xce, 0x5f, 0xf7, 0xa6)
+GUID_ENTRY("EFI_STORAGE_SECURITY_COMMAND_PROTOCOL_GUID", 0xC88B0B6D, 0x0DFC, 0x49A7, 0x9C, 0xB4, 0x49, 0x07, 0x4B, 0x4C, 0x3A, 0x78)
+GUID_ENTRY("EFI_SWAP_ADDRESS_RANGE_PROTOCOL_GUID", 0x1259f60d, 0xb754, 0x468e, 0xa7, 0x89, 0x4d, 0xb8, 0x5d, 0x55, 0xe8, 0x7e)
+GUID_ENTRY("EFI_SYSTEM_NV_DATA_FV_GUID", 0xfff12b8d, 0x7696, 0x4c8b, 0xa9, 0x85, 0x27, 0x47, 0x7, 0x5b, 0x4f, 0x50)
+GUID_ENTRY("EFI_SYSTEM_NV_DATA_HOB_GUID", 0xd6e5092d, 0xc7b2, 0x4872, 0xaf, 0x66, 0xfd, 0xc0, 0xe6, 0xf9, 0x5e, 0x78)
+GUID_ENTRY("EFI_TAPE_IO_PROTOCOL_GUID", 0x1e93e633, 0xd65a, 0x459e, 0xab, 0x84, 0x93, 0xd9, 0xec, 0x26, 0x6d, 0x18)
+GUID_ENTRY("EFI_TCG_EVENT_HOB_GUID", 0x2e3044ac, 0x879f, 0x490f, 0x97, 0x60, 0xbb, 0xdf, 0xaf, 0x69, 0x5f, 0x50)
+GUID_ENTRY("EFI_TCG_PLATFORM_PROTOCOL_GUID", 0x8c4c9a41, 0xbf56, 0x4627, 0x9e, 0xa, 0xc8, 0x38, 0x6d, 0x66, 0x11, 0x5c)
+GUID_ENTRY("EFI_TCG_PROTOCOL_GUID", 0xf541796d, 0xa62e, 0x4954, 0xa7, 0x75, 0x95, 0x84, 0xf6, 0x1b, 0x9c, 0xdd)
+GUID_ENTRY("EFI_TCP4_PROTOCOL_GUID", 0x65530BC7, 0xA359, 0x410f, 0xB0, 0x10, 0x5A, 0xAD, 0xC7, 0xEC, 0x2B, 0x62)
+GUID_ENTRY("EFI_TCP4_SERVICE_BINDING_PROTOCOL_GUID", 0x00720665, 0x67EB, 0x4a99, 0xBA, 0xF7, 0xD3, 0xC3, 0x3A, 0x1C, 0x7C, 0xC9)
+GUID_ENTRY("EFI_TCP6_PROTOCOL_GUID", 0x46e44855, 0xbd60, 0x4ab7, 0xab, 0x0d, 0xa6, 0x79, 0xb9, 0x44, 0x7d, 0x77)
+GUID_ENTRY("EFI_TCP6_SERVICE_BINDING_PROTOCOL_GUID", 0xec20eb79, 0x6c1a, 0x4664, 0x9a, 0x0d, 0xd2, 0xe4, 0xcc, 0x16, 0xd6, 0x64)
+GUID_ENTRY("EFI_TCP_PROTOCOL_GUID", 0x02b3d5f2, 0xac28, 0x11d3, 0x9a, 0x2d, 0x00, 0x90, 0x27, 0x3f, 0xc1, 0x4d)
+GUID_ENTRY("EFI_TIANO_DECOMPRESS_PROTOCOL_GUID", 0xe84cf29c, 0x191f, 0x4eae, 0x96, 0xe1, 0xf4, 0x6a, 0xec, 0xea, 0xea, 0x0b)
+GUID_ENTRY("EFI_TIMER_ARCH_PROTOCOL_GUID", 0x26baccb3, 0x6f42, 0x11d4, 0xbc, 0xe7, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81)
+GUID_ENTRY("EFI_TSC_FREQUENCY_GUID", 0xdba6a7e3, 0xbb57, 0x4be7, 0x8a, 0xf8, 0xd5, 0x78, 0xdb, 0x7e, 0x56, 0x87)
+GUID_ENTRY("EFI_UART_DEVICE_PATH_GUID", 0x37499a9d, 0x542f, 0x4c89, 0xa0, 0x26, 0x35, 0xda, 0x14, 0x20, 0x94, 0xe4)
+GUID_ENTRY("EFI_UDP4_PROTOCOL_GUID", 0x3ad9df29, 0x4501, 0x478d, 0xb1, 0xf8, 0x7f, 0x7f, 0xe7, 0x0e, 0x50, 0xf3)
+GUID_ENTRY("EFI_UDP4_SERVICE_BINDING_PROTOCOL_GUID", 0x83f01464, 0x99bd, 0x45e5, 0xb3, 0x83, 0xaf, 0x63, 0x05, 0xd8, 0xe9, 0xe6)
+GUID_ENTRY("EFI_UDP6_PROTOCOL_GUID", 0x4f948815, 0xb4b9, 0x43cb, 0x8a, 0x33, 0x90, 0xe0, 0x60, 0xb3, 0x49, 0x55)
+GUID_ENTRY("EFI_UDP6_SERVICE_BINDING_PROTOCOL_GUID", 0x66ed4721, 0x3c98, 0x4d3e, 0x81, 0xe3, 0xd0, 0x3d, 0xd3, 0x9a, 0x72, 0x54)
+GUID_ENTRY("EFI_UGA_DRAW_PROTOCOL_GUID", 0x982c298b, 0xf4fa, 0x41cb, 0xb8, 0x38, 0x77, 0xaa, 0x68, 0x8f, 0xb8, 0x39)
+GUID_ENTRY("EFI_UGA_IO_PROTOCOL_GUID", 0x61a4d49e, 0x6f68, 0x4f1b, 0xb9, 0x22, 0xa8, 0x6e, 0xed, 0xb, 0x7, 0xa2)
+GUID_ENTRY("EFI_UGA_SPLASH_PROTOCOL_GUID", 0xa45b3a0d, 0x2e55, 0x4c03, 0xad, 0x9c, 0x27, 0xd4, 0x82, 0xb, 0x50, 0x7e)
+GUID_ENTRY("EFI_UNICODE_COLLATION2_PROTOCOL_GUID", 0xa4c751fc, 0x23ae, 0x4c3e, 0x92, 0xe9, 0x49, 0x64, 0xcf, 0x63, 0xf3, 0x49)
+GUID_ENTRY("EFI_UNICODE_COLLATION_PROTOCOL2_GUID", 0xa4c751fc, 0x23ae, 0x4c3e, 0x92, 0xe9, 0x49, 0x64, 0xcf, 0x63, 0xf3, 0x49)
+GUID_ENTRY("EFI_UNICODE_COLLATION_PROTOCOL_GUID", 0x1d85cd7f, 0xf43d, 0x11d2, 0x9a, 0xc, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d)
+GUID_ENTRY("EFI_UNIX_CONSOLE_GUID", 0xf2cc5d06, 0x8985, 0x11db, 0xbb, 0x19, 0x00, 0x40, 0xd0, 0x2b, 0x18, 0x35)
+GUID_ENTRY("EFI_UNIX_CPU_MODEL_GUID", 0xf2d3b330, 0x8985, 0x11db, 0x8a, 0xa3, 0x00, 0x40, 0xd0, 0x2b, 0x18, 0x35)
+GUID_ENTRY("EFI_UNIX_CPU_SPEED_GUID", 0xf2d74e5a, 0x8985, 0x11db, 0x97, 0x05, 0x00, 0x40, 0xd0, 0x2b, 0x18, 0x35)
+GUID_ENTRY("EFI_UNIX_FILE_SYSTEM_GUID", 0xf2c16b9e, 0x8985, 0x11db, 0x92, 0xc8, 0x00, 0x40, 0xd0, 0x2b, 0x18, 0x35)
+GUID_ENTRY("EFI_UNIX_GOP_GUID", 0xbace07c2, 0x8987, 0x11db, 0xa5, 0x9a, 0x00, 0x40, 0xd0, 0x2b, 0x18, 0x35)
+GUID_ENTRY("EFI_UNIX_IO_PROTOCOL_GUID", 0xf2e23f54, 0x8985, 0x11db, 0xac, 0x79, 0x00, 0x40, 0xd0, 0x2b, 0x18, 0x35)
+GUID_ENTRY("EFI_UNIX_MEMORY_GUID", 0xf2d006cc, 0x8985, 0x11db, 0xa4, 0x72, 0x00, 0x40, 0xd0, 0x2b, 0x18, 0x35)
+GUID_ENTRY("EFI_UNIX_NETWORK_GUID", 0x081603B4, 0x0F1D, 0x4022, 0xB6, 0xFD, 0x4C, 0xE3, 0x5E, 0x09, 0xA1, 0xA6)
+GUID_ENTRY("EFI_UNIX_PHYSICAL_DISKS_GUID", 0xf2bdcc96, 0x8985, 0x11db, 0x87, 0x19, 0x00, 0x40, 0xd0, 0x2b, 0x18, 0x35)
+GUID_ENTRY("EFI_UNIX_SERIAL_PORT_GUID", 0x6d3a727d, 0x66c8, 0x4d19, 0x87, 0xe6, 0x2, 0x15, 0x86, 0x14, 0x90, 0xf3)
+GUID_ENTRY("EFI_UNIX_THUNK_PROTOCOL_GUID", 0xf2e98868, 0x8985, 0x11db, 0x9a, 0x59, 0x00, 0x40, 0xd0, 0x2b, 0x18, 0x35)
+GUID_ENTRY("EFI_UNIX_UGA_GUID", 0xf2c8b80e, 0x8985, 0x11db, 0x93, 0xf1, 0x00, 0x40, 0xd0, 0x2b, 0x18, 0x35)
+GUID_ENTRY("EFI_UNIX_UGA_IO_PROTOCOL_GUID", 0xf2e5e2c6, 0x8985, 0x11db, 0xa1, 0x91, 0x00, 0x40, 0xd0, 0x2b, 0x18, 0x35)
+GUID_ENTRY("EFI_UNIX_VIRTUAL_DISKS_GUID", 0xf2ba331a, 0x8985, 0x11db, 0xa4, 0x06, 0x00, 0x40, 0xd0, 0x2b, 0x18, 0x35)
+GUID_ENTRY("EFI_UPDATE_DATA_FILE_GUID", 0x283fa2ee, 0x532c, 0x484d, 0x93, 0x83, 0x9f, 0x93, 0xb3, 0x6f, 0xb, 0x7e)
+GUID_ENTRY("EFI_USB2_HC_PROTOCOL_GUID", 0x3e745226, 0x9818, 0x45b6, 0xa2, 0xac, 0xd7, 0xcd, 0xe, 0x8b, 0xa2, 0xbc)
+GUID_ENTRY("EFI_USB_ATAPI_PROTOCOL_GUID", 0x2B2F68DA, 0x0CD2, 0x44cf, 0x8E, 0x8B, 0xBB, 0xA2, 0x0B, 0x1B, 0x5B, 0x75)
+GUID_ENTRY("EFI_USB_BUS_PROTOCOL_GUID", 0x2B2F68CC, 0x0CD2, 0x44cf, 0x8E, 0x8B, 0xBB, 0xA2, 0x0B, 0x1B, 0x5B, 0x75)
+GUID_ENTRY("EFI_USB_HC_PROTOCOL_GUID", 0xf5089266, 0x1aa0, 0x4953, 0x97, 0xd8, 0x56, 0x2f, 0x8a, 0x73, 0xb5, 0x19)
+GUID_ENTRY("EFI_USB_IO_PROTOCOL_GUID", 0x2B2F68D6, 0x0CD2, 0x44cf, 0x8E, 0x8B, 0xBB, 0xA2, 0x0B, 0x1B, 0x5B, 0x75)
+GUID_ENTRY("EFI_USER_CREDENTIAL2_PROTOCOL_GUID", 0xe98adb03, 0xb8b9, 0x4af8, 0xba, 0x20, 0x26, 0xe9, 0x11, 0x4c, 0xbc, 0xe5)
+GUID_ENTRY("EFI_USER_CREDENTIAL_PROTOCOL_GUID", 0x71ee5e94, 0x65b9, 0x45d5, 0x82, 0x1a, 0x3a, 0x4d, 0x86, 0xcf, 0xe6, 0xbe)
+GUID_ENTRY("EFI_USER_INFO_ACCESS_SETUP_ADMIN_GUID", 0x85b75607, 0xf7ce, 0x471e, 0xb7, 0xe4, 0x2a, 0xea, 0x5f, 0x72, 0x32, 0xee)
+GUID_ENTRY("EFI_USER_INFO_ACCESS_SETUP_NORMAL_GUID", 0x1db29ae0, 0x9dcb, 0x43bc, 0x8d, 0x87, 0x5d, 0xa1, 0x49, 0x64, 0xdd, 0xe2)
+GUID_ENTRY("EFI_USER_INFO_ACCESS_SETUP_RESTRICTED_GUID", 0xbdb38125, 0x4d63, 0x49f4, 0x82, 0x12, 0x61, 0xcf, 0x5a, 0x19, 0xa, 0xf8)
+GUID_ENTRY("EFI_USER_MANAGER_PROTOCOL_GUID", 0x6fd5b00c, 0xd426, 0x4283, 0x98, 0x87, 0x6c, 0xf5, 0xcf, 0x1c, 0xb1, 0xfe)
+GUID_ENTRY("EFI_UXIX_SYSTEM_CONFIG_GUID", 0x375ea976, 0x3ccd, 0x4e74, 0xa8, 0x45, 0x26, 0xb9, 0xb3, 0x24, 0xb1, 0x3c)
+GUID_ENTRY("EFI_VARIABLE_ARCH_PROTOCOL_GUID", 0x1e5668e2, 0x8481, 0x11d4, 0xbc, 0xf1, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81)
+GUID_ENTRY("EFI_VARIABLE_GUID", 0xddcf3616, 0x3275, 0x4164, 0x98, 0xb6, 0xfe, 0x85, 0x70, 0x7f, 0xfe, 0x7d)
+GUID_ENTRY("EFI_VARIABLE_INDEX_TABLE_GUID", 0x8cfdb8c8, 0xd6b2, 0x40f3, 0x8e, 0x97, 0x02, 0x30, 0x7c, 0xc9, 0x8b, 0x7c)
+GUID_ENTRY("EFI_VARIABLE_STORE_PROTOCOL_GUID", 0xf088cd91, 0xa046, 0x11d2, 0x8e, 0x42, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b)
+GUID_ENTRY("EFI_VARIABLE_WRITE_ARCH_PROTOCOL_GUID", 0x6441f818, 0x6362, 0x4e44, 0xb5, 0x70, 0x7d, 0xba, 0x31, 0xdd, 0x24, 0x53)
+GUID_ENTRY("EFI_VGA_MINI_PORT_PROTOCOL_GUID", 0xc7735a2f, 0x88f5, 0x4882, 0xae, 0x63, 0xfa, 0xac, 0x8c, 0x8b, 0x86, 0xb3)
+GUID_ENTRY("EFI_VIRTUAL_MEMORY_ACCESS_PROTOCOL_GUID", 0x745d377a, 0xb988, 0x47b2, 0xb1, 0x8f, 0xbb, 0xc8, 0xd, 0xc5, 0x66, 0x98)
+GUID_ENTRY("EFI_VLAN_CONFIG_PROTOCOL_GUID", 0x9e23d768, 0xd2f3, 0x4366, 0x9f, 0xc3, 0x3a, 0x7a, 0xba, 0x86, 0x43, 0x74)
+GUID_ENTRY("EFI_VT_100_GUID", 0xdfa66065, 0xb419, 0x11d3, 0x9a, 0x2d, 0x00, 0x90, 0x27, 0x3f, 0xc1, 0x4d)
+GUID_ENTRY("EFI_VT_100_PLUS_GUID", 0x7baec70b, 0x57e0, 0x4c76, 0x8e, 0x87, 0x2f, 0x9e, 0x28, 0x08, 0x83, 0x43)
+GUID_ENTRY("EFI_VT_UTF8_GUID", 0xad15a0d6, 0x8bec, 0x4acf, 0xa0, 0x73, 0xd0, 0x1d, 0xe7, 0x7e, 0x2d, 0x88)
+GUID_ENTRY("EFI_WATCHDOG_TIMER_ARCH_PROTOCOL_GUID", 0x665E3FF5, 0x46CC, 0x11d4, 0x9A, 0x38, 0x00, 0x90, 0x27, 0x3F, 0xC1, 0x4D)
+GUID_ENTRY("EFI_WIN_NT_CONSOLE_GUID", 0xba73672c, 0xa5d3, 0x11d4, 0xbd, 0x0, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81)
+GUID_ENTRY("EFI_WIN_NT_CPU_MODEL_GUID", 0xbee9b6ce, 0x2f8a, 0x11d4, 0xbd, 0xd, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81)
+GUID_ENTRY("EFI_WIN_NT_CPU_SPEED_GUID", 0xd4f29055, 0xe1fb, 0x11d4, 0xbd, 0xd, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81)
+GUID_ENTRY("EFI_WIN_NT_FILE_SYSTEM_GUID", 0xc95a935, 0xa006, 0x11d4, 0xbc, 0xfa, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81)
+GUID_ENTRY("EFI_WIN_NT_GOP_GUID", 0x4e11e955, 0xccca, 0x11d4, 0xbd, 0xd, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81)
+GUID_ENTRY("EFI_WIN_NT_IO_PROTOCOL_GUID", 0x96eb4ad6, 0xa32a, 0x11d4, 0xbc, 0xfd, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81)
+GUID_ENTRY("EFI_WIN_NT_MEMORY_GUID", 0x99042912, 0x122a, 0x11d4, 0xbd, 0xd, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81)
+GUID_ENTRY("EFI_WIN_NT_PASS_THROUGH_GUID", 0xcc664eb8, 0x3c24, 0x4086, 0xb6, 0xf6, 0x34, 0xe8, 0x56, 0xbc, 0xe3, 0x6e)
+GUID_ENTRY("EFI_WIN_NT_PHYSICAL_DISKS_GUID", 0xc95a92f, 0xa006, 0x11d4, 0xbc, 0xfa, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81)
+GUID_ENTRY("EFI_WIN_NT_SERIAL_PORT_GUID", 0xc95a93d, 0xa006, 0x11d4, 0xbc, 0xfa, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81)
+GUID_ENTRY("EFI_WIN_NT_SYSTEM_CONFIG_GUID", 0xb347f047, 0xaf8c, 0x490e, 0xac, 0x07, 0x0a, 0xa9, 0xb7, 0xe5, 0x38, 0x58)
+GUID_ENTRY("EFI_WIN_NT_THUNK_PROTOCOL_GUID", 0x58c518b1, 0x76f3, 0x11d4, 0xbc, 0xea, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81)
+GUID_ENTRY("EFI_WIN_NT_UGA_GUID", 0xab248e99, 0xabe1, 0x11d4, 0xbd, 0xd, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81)
+GUID_ENTRY("EFI_WIN_NT_VIRTUAL_DISKS_GUID", 0xc95a928, 0xa006, 0x11d4, 0xbc, 0xfa, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81)
+GUID_ENTRY("EFI_XEN_INFO_GUID", 0xd3b46f3b, 0xd441, 0x1244, 0x9a, 0x12, 0x0, 0x12, 0x27, 0x3f, 0xc1, 0x4d)
+GUID_ENTRY("EMBEDDED_DEVICE_PROTOCOL_GUID", 0xbf4b9d10, 0x13ec, 0x43dd, 0x88, 0x80, 0xe9, 0xb, 0x71, 0x8f, 0x27, 0xde)
+GUID_ENTRY("EMBEDDED_EXTERNAL_DEVICE_PROTOCOL_GUID", 0x735F8C64, 0xD696, 0x44D0, 0xBD, 0xF2, 0x44, 0x7F, 0xD0, 0x5A, 0x54, 0x06)
+GUID_ENTRY("EMU_BLOCK_IO_PROTOCOL_GUID", 0x6888A4AE, 0xAFCE, 0xE84B, 0x91, 0x02, 0xF7, 0xB9, 0xDA, 0xE6, 0xA0, 0x30)
+GUID_ENTRY("EMU_GRAPHICS_WINDOW_PROTOCOL_GUID", 0x30FD316A, 0x6728, 0x2E41, 0xA6, 0x90, 0x0D, 0x13, 0x33, 0xD8, 0xCA, 0xC1)
+GUID_ENTRY("EMU_IO_THUNK_PROTOCO_GUID", 0x453368F6, 0x7C85, 0x434A, 0xA9, 0x8A, 0x72, 0xD1, 0xB7, 0xFF, 0xA9, 0x26)
+GUID_ENTRY("EMU_SNP_PROTOCOL_GUID", 0xFD5FBE54, 0x8C35, 0xB345, 0x8A, 0x0F, 0x7A, 0xC8, 0xA5, 0xFD, 0x05, 0x21)
+GUID_ENTRY("EMU_THUNK_PPI_GUID", 0xB958B78C, 0x1D3E, 0xEE40, 0x8B, 0xF4, 0xF0, 0x63, 0x2D, 0x06, 0x39, 0x16)
+GUID_ENTRY("EMU_THUNK_PROTOCOL_GUID", 0x5CF32E0B, 0x8EDF, 0x2E44, 0x9C, 0xDA, 0x93, 0x20, 0x5E, 0x99, 0xEC, 0x1C)
+GUID_ENTRY("EXTENDED_SAL_BOOT_SERVICE_PROTOCOL_GUID", 0xde0ee9a4, 0x3c7a, 0x44f2, 0xb7, 0x8b, 0xe3, 0xcc, 0xd6, 0x9c, 0x3a, 0xf7)
+GUID_ENTRY("EXTENDED_SAL_BOOT_SERVICE_PROTOCOL_GUID", 0xde0ee9a4, 0x3c7a, 0x44f2, 0xb7, 0x8b, 0xe3, 0xcc, 0xd6, 0x9c, 0x3a, 0xf7)
+GUID_ENTRY("FFS_GUID", 0xac05bf33, 0x995a, 0x4ed4, 0xaa, 0xb8, 0xef, 0x7a, 0xe8, 0xf, 0x5c, 0xb0)
+GUID_ENTRY("FILE_EXPLORE_FORMSET_GUID", 0x1f2d63e1, 0xfebd, 0x4dc7, 0x9c, 0xc5, 0xba, 0x2b, 0x1c, 0xef, 0x9c, 0x5b)
+GUID_ENTRY("FILE_GUID", 0xcbd2e4d5, 0x7068, 0x4ff5, 0xb4, 0x62, 0x98, 0x22, 0xb4, 0xad, 0x8d, 0x60)
+GUID_ENTRY("FORM_BROWSER_EXTENSION_PROTOCOL_GUID", 0x1f73b18d, 0x4630, 0x43c1, 0xa1, 0xde, 0x6f, 0x80, 0x85, 0x5d, 0x7d, 0xa4)
+GUID_ENTRY("FRAMEWORK_BDS_FRONTPAGE_FORMSET_GUID", 0x9e0c30bc, 0x3f06, 0x4ba6, 0x82, 0x88, 0x9, 0x17, 0x9b, 0x85, 0x5d, 0xbe)
+GUID_ENTRY("FRAMEWORK_EFI_FIRMWARE_VOLUME_BLOCK_PROTOCOL_GUID", 0xDE28BC59, 0x6228, 0x41BD, 0xBD, 0xF6, 0xA3, 0xB9, 0xAD, 0xB5, 0x8D, 0xA1)
+GUID_ENTRY("FRAMEWORK_EFI_MP_SERVICES_PROTOCOL_GUID", 0xf33261e7, 0x23cb, 0x11d5, 0xbd, 0x5c, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81)
+GUID_ENTRY("FRONT_PAGE_FORMSET_GUID", 0x9e0c30bc, 0x3f06, 0x4ba6, 0x82, 0x88, 0x9, 0x17, 0x9b, 0x85, 0x5d, 0xbe)
+GUID_ENTRY("HANDLE_PARSING_HII_GUID", 0xb8969637, 0x81de, 0x43af, 0xbc, 0x9a, 0x24, 0xd9, 0x89, 0x13, 0xf2, 0xf6)
+GUID_ENTRY("HD_BOOT_DEVICE_PATH_VARIABLE_GUID", 0xfab7e9e1, 0x39dd, 0x4f2b, 0x84, 0x8, 0xe2, 0xe, 0x90, 0x6c, 0xb6, 0xde)
+GUID_ENTRY("HII_RESOURCE_SAMPLE_FORM_SET_GUID", 0x4f4ef7f0, 0xaa29, 0x4ce9, 0xba, 0x41, 0x64, 0x3e, 0x1, 0x23, 0xa9, 0x9f)
+GUID_ENTRY("HOB_LIST_GUID", 0x7739f24c, 0x93d7, 0x11d4, 0x9a, 0x3a, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d)
+GUID_ENTRY("HOT_PLUG_DEVICE_GUID", 0x220ac432, 0x1d43, 0x49e5, 0xa7, 0x4f, 0x4c, 0x9d, 0xa6, 0x7a, 0xd2, 0x3b)
+GUID_ENTRY("IDLE_LOOP_EVENT_GUID", 0x3c8d294c, 0x5fc3, 0x4451, 0xbb, 0x31, 0xc4, 0xc0, 0x32, 0x29, 0x5e, 0x6c)
+GUID_ENTRY("INTEL_FRAMEWORK_MODULEPKG_TOKEN_SPACE_GUID", 0xD3705011, 0xBC19, 0x4af7, 0xBE, 0x16, 0xF6, 0x80, 0x30, 0x37, 0x8C, 0x15)
+GUID_ENTRY("IP4_ISCSI_CONFIG_GUID", 0x6456ed61, 0x3579, 0x41c9, 0x8a, 0x26, 0x0a, 0x0b, 0xd6, 0x2b, 0x78, 0xfc)
+GUID_ENTRY("IP6_CONFIG_NVDATA_GUID", 0x2eea107, 0x98db, 0x400e, 0x98, 0x30, 0x46, 0xa, 0x15, 0x42, 0xd7, 0x99)
+GUID_ENTRY("ISCSI_CHAP_AUTH_INFO_GUID", 0x786ec0ac, 0x65ae, 0x4d1b, 0xb1, 0x37, 0xd, 0x11, 0xa, 0x48, 0x37, 0x97)
+GUID_ENTRY("ISCSI_CONFIG_GUID", 0x4b47d616, 0xa8d6, 0x4552, 0x9d, 0x44, 0xcc, 0xad, 0x2e, 0xf, 0x4c, 0xf9)
+GUID_ENTRY("ISCSI_V4_PRIVATE_GUID", 0xfa3cde4c, 0x87c2, 0x427d, 0xae, 0xde, 0x7d, 0xd0, 0x96, 0xc8, 0x8c, 0x58)
+GUID_ENTRY("ISCSI_V6_PRIVATE_GUID", 0x28be27e5, 0x66cc, 0x4a31, 0xa3, 0x15, 0xdb, 0x14, 0xc3, 0x74, 0x4d, 0x85)
+GUID_ENTRY("LAST_ENUM_LANGUAGE_GUID", 0xe8c545b, 0xa2ee, 0x470d, 0x8e, 0x26, 0xbd, 0xa1, 0xa1, 0x3c, 0xa, 0xa3)
+GUID_ENTRY("LDR_MEMORY_DESCRIPTOR_GUID", 0x7701d7e5, 0x7d1d, 0x4432, 0xa4, 0x68, 0x67, 0x3d, 0xab, 0x8a, 0xde, 0x60)
+GUID_ENTRY("LOAD_FILE_PROTOCOL_GUID", 0x56EC3091, 0x954C, 0x11d2, 0x8E, 0x3F, 0x00, 0xA0, 0xC9, 0x69, 0x72, 0x3B)
+GUID_ENTRY("LOCAL_EFI_WIN_NT_BUS_DRIVER_IO_PROTOCOL_GUID", 0x96eb4ad6, 0xa32a, 0x11d4, 0xbc, 0xfd, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81)
+GUID_ENTRY("LOCAL_EFI_WIN_NT_SERIAL_PORT_GUID", 0xc95a93d, 0xa006, 0x11d4, 0xbc, 0xfa, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81)
+GUID_ENTRY("LOCAL_EFI_WIN_NT_THUNK_PROTOCOL_GUID", 0x58c518b1, 0x76f3, 0x11d4, 0xbc, 0xea, 0x0, 0x80, 0xc7, 0x3c, 0x88, 0x81)
+GUID_ENTRY("LZMAF86_CUSTOM_DECOMPRESS_GUID", 0xD42AE6BD, 0x1352, 0x4bfb, 0x90, 0x9A, 0xCA, 0x72, 0xA6, 0xEA, 0xE8, 0x89)
+GUID_ENTRY("LZMA_CUSTOM_DECOMPRESS_GUID", 0xEE4E5898, 0x3914, 0x4259, 0x9D, 0x6E, 0xDC, 0x7B, 0xD7, 0x94, 0x03, 0xCF)
+GUID_ENTRY("MDEMODULEPKG_TOKEN_SPACE_GUID", 0xA1AFF049, 0xFDEB, 0x442a, 0xB3, 0x20, 0x13, 0xAB, 0x4C, 0xB7, 0x2B, 0xBC)
+GUID_ENTRY("MDEPKG_TOKEN_SPACE_GUID", 0x914AEBE7, 0x4635, 0x459b, 0xAA, 0x1C, 0x11, 0xE2, 0x19, 0xB0, 0x3A, 0x10)
+GUID_ENTRY("MEMORY_ONLY_RESET_CONTROL_GUID", 0xe20939be, 0x32d4, 0x41be, 0xa1, 0x50, 0x89, 0x7f, 0x85, 0xd4, 0x98, 0x29)
+GUID_ENTRY("MEMORY_STATUS_CODE_RECORD_GUID", 0x60cc026, 0x4c0d, 0x4dda, 0x8f, 0x41, 0x59, 0x5f, 0xef, 0x0, 0xa5, 0x2)
+GUID_ENTRY("MTC_VENDOR_GUID", 0xeb704011, 0x1402, 0x11d3, 0x8e, 0x77, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b)
+GUID_ENTRY("MY_GUID", 0x12345678, 0xAABB, 0xCCDD, 0xEE, 0xFF, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66)
+GUID_ENTRY("NT_FWH_PPI_GUID", 0x4e76928f, 0x50ad, 0x4334, 0xb0, 0x6b, 0xa8, 0x42, 0x13, 0x10, 0x8a, 0x57)
+GUID_ENTRY("PCATCHIPSET_TOKEN_SPACE_GUID", 0x326ae723, 0xae32, 0x4589, 0x98, 0xb8, 0xca, 0xc2, 0x3c, 0xdc, 0xc1, 0xb1)
+GUID_ENTRY("PCD_DATABASE_HOB_GUID", 0xEA296D92, 0x0B69, 0x423C, 0x8C, 0x28, 0x33, 0xB4, 0xE0, 0xA9, 0x12, 0x68)
+GUID_ENTRY("PCD_PPI_GUID", 0x6e81c58, 0x4ad7, 0x44bc, 0x83, 0x90, 0xf1, 0x2, 0x65, 0xf7, 0x24, 0x80)
+GUID_ENTRY("PCD_PROTOCOL_GUID", 0x11b34006, 0xd85b, 0x4d0a, 0xa2, 0x90, 0xd5, 0xa5, 0x71, 0x31, 0xe, 0xf7)
+GUID_ENTRY("PE32_IMAGE_PROTOCOL_GUID", 0x5cb5c776, 0x60d5, 0x45ee, 0x88, 0x3c, 0x45, 0x27, 0x8, 0xcd, 0x74, 0x3f)
+GUID_ENTRY("PEI_ATA_CONTROLLER_PPI_GUID", 0xa45e60d1, 0xc719, 0x44aa, 0xb0, 0x7a, 0xaa, 0x77, 0x7f, 0x85, 0x90, 0x6d)
+GUID_ENTRY("PEI_BASE_MEMORY_TEST_GUID", 0xb6ec423c, 0x21d2, 0x490d, 0x85, 0xc6, 0xdd, 0x58, 0x64, 0xea, 0xa6, 0x74)
+GUID_ENTRY("PEI_BLOCK_IO_PPI_GUID", 0x695d8aa1, 0x42ee, 0x4c46, 0x80, 0x5c, 0x6e, 0xa6, 0xbc, 0xe7, 0x99, 0xe3)
+GUID_ENTRY("PEI_BOOT_SCRIPT_EXECUTER_PPI_GUID", 0xabd42895, 0x78cf, 0x4872, 0x84, 0x44, 0x1b, 0x5c, 0x18, 0x0b, 0xfb, 0xff)
+GUID_ENTRY("PEI_CAPSULE_PPI_GUID", 0x3acf33ee, 0xd892, 0x40f4, 0xa2, 0xfc, 0x38, 0x54, 0xd2, 0xe1, 0x32, 0x3d)
+GUID_ENTRY("PEI_CPU_IO_PPI_GUID", 0xe6af1f7b, 0xfc3f, 0x46da, 0xa8, 0x28, 0xa3, 0xb4, 0x57, 0xa4, 0x42, 0x82)
+GUID_ENTRY("PEI_END_OF_PEI_PHASE_PPI_GUID", 0x605EA650, 0xC65C, 0x42e1, 0xBA, 0x80, 0x91, 0xA5, 0x2A, 0xB6, 0x18, 0xC6)
+GUID_ENTRY("PEI_FLASH_MAP_PPI_GUID", 0xf34c2fa0, 0xde88, 0x4270, 0x84, 0x14, 0x96, 0x12, 0x22, 0xf4, 0x52, 0x1c)
+GUID_ENTRY("PEI_IN_MEMORY_GUID", 0x643b8786, 0xb417, 0x48d2, 0x8f, 0x5e, 0x78, 0x19, 0x93, 0x1c, 0xae, 0xd8)
+GUID_ENTRY("PEI_LOCK_PHYSICAL_PRESENCE_PPI_GUID", 0xef9aefe5, 0x2bd3, 0x4031, 0xaf, 0x7d, 0x5e, 0xfe, 0x5a, 0xbb, 0x9a, 0xd)
+GUID_ENTRY("PEI_NT_THUNK_GUID", 0x98c281e5, 0xf906, 0x43dd, 0xa9, 0x2b, 0xb0, 0x3, 0xbf, 0x27, 0x65, 0xda)
+GUID_ENTRY("PEI_NT_THUNK_PPI_GUID", 0x98c281e5, 0xf906, 0x43dd, 0xa9, 0x2b, 0xb0, 0x3, 0xbf, 0x27, 0x65, 0xda)
+GUID_ENTRY("PEI_OPERATOR_PRESENCE_PPI_GUID", 0x20a7378c, 0xaa83, 0x4ce1, 0x82, 0x1f, 0x47, 0x40, 0xee, 0x1b, 0x3f, 0x9f)
+GUID_ENTRY("PEI_PCI_CFG_PPI_GUID", 0xe1f2eba0, 0xf7b9, 0x4a26, 0x86, 0x20, 0x13, 0x12, 0x21, 0x64, 0x2a, 0x90)
+GUID_ENTRY("PEI_PERMANENT_MEMORY_INSTALLED_PPI_GUID", 0xf894643d, 0xc449, 0x42d1, 0x8e, 0xa8, 0x85, 0xbd, 0xd8, 0xc6, 0x5b, 0xde)
+GUID_ENTRY("PEI_READ_ONLY_VARIABLE_ACCESS_PPI_GUID", 0x3cdc90c6, 0x13fb, 0x4a75, 0x9e, 0x79, 0x59, 0xe9, 0xdd, 0x78, 0xb9, 0xfa)
+GUID_ENTRY("PEI_RESET_PPI_GUID", 0xef398d58, 0x9dfd, 0x4103, 0xbf, 0x94, 0x78, 0xc6, 0xf4, 0xfe, 0x71, 0x2f)
+GUID_ENTRY("PEI_S3_RESUME_PPI_GUID", 0x4426CCB2, 0xE684, 0x4a8a, 0xAE, 0x40, 0x20, 0xD4, 0xB0, 0x25, 0xB7, 0x10)
+GUID_ENTRY("PEI_SECURITY_PPI_GUID", 0x1388066e, 0x3a57, 0x4efa, 0x98, 0xf3, 0xc1, 0x2f, 0x3a, 0x95, 0x8a, 0x29)
+GUID_ENTRY("PEI_SEC_PERFORMANCE_PPI_GUID", 0x0ecc666b, 0x4662, 0x47f9, 0x9d, 0xd5, 0xd0, 0x96, 0xff, 0x7d, 0xa4, 0x9e)
+GUID_ENTRY("PEI_SMBUS2_PPI_GUID", 0x9ca93627, 0xb65b, 0x4324, 0xa2, 0x2, 0xc0, 0xb4, 0x61, 0x76, 0x45, 0x43)
+GUID_ENTRY("PEI_SMBUS_PPI_GUID", 0xabd42895, 0x78cf, 0x4872, 0x84, 0x44, 0x1b, 0x5c, 0x18, 0xb, 0xfb, 0xda)
+GUID_ENTRY("PEI_SMM_ACCESS_PPI_GUID", 0x268f33a9, 0xcccd, 0x48be, 0x88, 0x17, 0x86, 0x5, 0x3a, 0xc3, 0x2e, 0xd6)
+GUID_ENTRY("PEI_SMM_CONTROL_PPI_GUID", 0x61c68702, 0x4d7e, 0x4f43, 0x8d, 0xef, 0xa7, 0x43, 0x5, 0xce, 0x74, 0xc5)
+GUID_ENTRY("PEI_STALL_PPI_GUID", 0x1f4c6f90, 0xb06b, 0x48d8, 0xa2, 0x01, 0xba, 0xe5, 0xf1, 0xcd, 0x7d, 0x56)
+GUID_ENTRY("PEI_STATUS_CODE_MEMORY_PPI_GUID", 0x26f8ab01, 0xd3cd, 0x489c, 0x98, 0x4f, 0xdf, 0xde, 0xf7, 0x68, 0x39, 0x5b)
+GUID_ENTRY("PEI_STATUS_CODE_PPI_GUID", 0x229832d3, 0x7a30, 0x4b36, 0xb8, 0x27, 0xf4, 0xc, 0xb7, 0xd4, 0x54, 0x36)
+GUID_ENTRY("PEI_TPM_INITIALIZED_PPI_GUID", 0xe9db0d58, 0xd48d, 0x47f6, 0x9c, 0x6e, 0x6f, 0x40, 0xe8, 0x6c, 0x7b, 0x41)
+GUID_ENTRY("PEI_UNIX_AUTOSCAN_PPI_GUID", 0xf2ed3d14, 0x8985, 0x11db, 0xb0, 0x57, 0x00, 0x40, 0xd0, 0x2b, 0x18, 0x35)
+GUID_ENTRY("PEI_UNIX_THUNK_PPI_GUID", 0xf2f830f2, 0x8985, 0x11db, 0x80, 0x6b, 0x00, 0x40, 0xd0, 0x2b, 0x18, 0x35)
+GUID_ENTRY("PEI_USB2_HOST_CONTROLLER_PPI_GUID", 0xa7d09fe1, 0x74d4, 0x4ba5, 0x84, 0x7c, 0x12, 0xed, 0x5b, 0x19, 0xad, 0xe4)
+GUID_ENTRY("PEI_USB_CONTROLLER_PPI_GUID", 0x3bc1f6de, 0x693e, 0x4547, 0xa3, 0x0, 0x21, 0x82, 0x3c, 0xa4, 0x20, 0xb2)
+GUID_ENTRY("PEI_USB_HOST_CONTROLLER_PPI_GUID", 0x652b38a9, 0x77f4, 0x453f, 0x89, 0xd5, 0xe7, 0xbd, 0xc3, 0x52, 0xfc, 0x53)
+GUID_ENTRY("PEI_USB_IO_PPI_GUID", 0x7c29785c, 0x66b9, 0x49fc, 0xb7, 0x97, 0x1c, 0xa5, 0x55, 0xe, 0xf2, 0x83)
+GUID_ENTRY("PERFORMANCEPKG_TOKEN_SPACE_GUID", 0x669346ef, 0xFDad, 0x4aeb, 0x08, 0xa6, 0x21, 0x46, 0x2d, 0x3f, 0xef, 0x7d)
+GUID_ENTRY("PERFORMANCE_EX_PROTOCOL_GUID", 0x1ea81bec, 0xf01a, 0x4d98, 0xa2, 0x1, 0x4a, 0x61, 0xce, 0x2f, 0xc0, 0x22)
+GUID_ENTRY("PERFORMANCE_PROTOCOL_GUID", 0x76b6bdfa, 0x2acd, 0x4462, 0x9E, 0x3F, 0xcb, 0x58, 0xC9, 0x69, 0xd9, 0x37)
+GUID_ENTRY("PE_COFF_LOADER_PROTOCOL_GUID", 0xB323179B, 0x97FB, 0x477E, 0xB0, 0xFE, 0xD8, 0x85, 0x91, 0xFA, 0x11, 0xAB)
+GUID_ENTRY("PLAT_OVER_MNGR_GUID", 0x8614567d, 0x35be, 0x4415, 0x8d, 0x88, 0xbd, 0x7d, 0xc, 0x9c, 0x70, 0xc0)
+GUID_ENTRY("PRE_PI_EXTRACT_GUIDED_SECTION_DATA_GUID", 0x385A982C, 0x2F49, 0x4043, 0xA5, 0x1E, 0x49, 0x01, 0x02, 0x5C, 0x8B, 0x6B)
+GUID_ENTRY("PWD_CREDENTIAL_PROVIDER_GUID", 0x78b9ec8b, 0xc000, 0x46c5, 0xac, 0x93, 0x24, 0xa0, 0xc1, 0xbb, 0x0, 0xce)
+GUID_ENTRY("RECOVERY_ON_DATA_CD_GUID", 0x5cac0099, 0x0dc9, 0x48e5, 0x80, 0x68, 0xbb, 0x95, 0xf5, 0x40, 0x0a, 0x9f)
+GUID_ENTRY("RECOVERY_ON_FAT_FLOPPY_DISK_GUID", 0x2e3d2e75, 0x9b2e, 0x412d, 0xb4, 0xb1, 0x70, 0x41, 0x6b, 0x87, 0x0, 0xff)
+GUID_ENTRY("RECOVERY_ON_FAT_IDE_DISK_GUID", 0xb38573b6, 0x6200, 0x4ac5, 0xb5, 0x1d, 0x82, 0xe6, 0x59, 0x38, 0xd7, 0x83)
+GUID_ENTRY("RECOVERY_ON_FAT_USB_DISK_GUID", 0x0ffbce19, 0x324c, 0x4690, 0xa0, 0x09, 0x98, 0xc6, 0xae, 0x2e, 0xb1, 0x86)
+GUID_ENTRY("SAL_SYSTEM_TABLE_GUID", 0xeb9d2d32, 0x2d88, 0x11d3, 0x9a, 0x16, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d)
+GUID_ENTRY("SECUREBOOT_CONFIG_FORM_SET_GUID", 0x5daf50a5, 0xea81, 0x4de2, 0x8f, 0x9b, 0xca, 0xbd, 0xa9, 0xcf, 0x5c, 0x14)
+GUID_ENTRY("SECURITYPKG_TOKEN_SPACE_GUID", 0xd3fb176, 0x9569, 0x4d51, 0xa3, 0xef, 0x7d, 0x61, 0xc6, 0x4f, 0xea, 0xba)
+GUID_ENTRY("SHELLPKG_SHELL_ENV2_EXT_GUID", 0xd2c18636, 0x40e5, 0x4eb5, 0xa3, 0x1b, 0x36, 0x69, 0x5f, 0xd4, 0x2c, 0x87)
+GUID_ENTRY("SHELL_ALIAS_VARIABLE_GUID", 0x0053d9d6, 0x2659, 0x4599, 0xa2, 0x6b, 0xef, 0x45, 0x36, 0xe6, 0x31, 0xa9)
+GUID_ENTRY("SHELL_DEBUG1_HII_GUID", 0x25f200aa, 0xd3cb, 0x470a, 0xbf, 0x51, 0xe7, 0xd1, 0x62, 0xd2, 0x2e, 0x6f)
+GUID_ENTRY("SHELL_DRIVER1_HII_GUID", 0xaf0b742, 0x63ec, 0x45bd, 0x8d, 0xb6, 0x71, 0xad, 0x7f, 0x2f, 0xe8, 0xe8)
+GUID_ENTRY("SHELL_ENVIRONMENT_PROTOCOL_GUID", 0x47c7b221, 0xc42a, 0x11d2, 0x8e, 0x57, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b)
+GUID_ENTRY("SHELL_INSTALL1_HII_GUID", 0x7d574d54, 0xd364, 0x4d4a, 0x95, 0xe3, 0x49, 0x45, 0xdb, 0x7a, 0xd3, 0xee)
+GUID_ENTRY("SHELL_INTERFACE_PROTOCOL_GUID", 0x47c7b223, 0xc42a, 0x11d2, 0x8e, 0x57, 0x0, 0xa0, 0xc9, 0x69, 0x72, 0x3b)
+GUID_ENTRY("SHELL_LEVEL1_HII_GUID", 0xdec5daa4, 0x6781, 0x4820, 0x9c, 0x63, 0xa7, 0xb0, 0xe4, 0xf1, 0xdb, 0x31)
+GUID_ENTRY("SHELL_LEVEL2_HII_GUID", 0xf95a7ccc, 0x4c55, 0x4426, 0xa7, 0xb4, 0xdc, 0x89, 0x61, 0x95, 0xb, 0xae)
+GUID_ENTRY("SHELL_LEVEL3_HII_GUID", 0x4344558d, 0x4ef9, 0x4725, 0xb1, 0xe4, 0x33, 0x76, 0xe8, 0xd6, 0x97, 0x4f)
+GUID_ENTRY("SHELL_MAP_GUID", 0x51271e13, 0x7de3, 0x43af, 0x8b, 0xc2, 0x71, 0xad, 0x3b, 0x82, 0x43, 0x25)
+GUID_ENTRY("SHELL_NETWORK1_HII_GUID", 0xf3d301bb, 0xf4a5, 0x45a8, 0xb0, 0xb7, 0xfa, 0x99, 0x9c, 0x62, 0x37, 0xae)
+GUID_ENTRY("SHELL_VARIABLE_GUID", 0x158def5a, 0xf656, 0x419c, 0xb0, 0x27, 0x7a, 0x31, 0x92, 0xc0, 0x79, 0xd2)
+GUID_ENTRY("SMBIOS_TABLE_GUID", 0xeb9d2d31, 0x2d88, 0x11d3, 0x9a, 0x16, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d)
+GUID_ENTRY("SMM_COMMUNICATE_HEADER_GUID", 0xf328e36c, 0x23b6, 0x4a95, 0x85, 0x4b, 0x32, 0xe1, 0x95, 0x34, 0xcd, 0x75)
+GUID_ENTRY("SMM_PERFORMANCE_EX_PROTOCOL_GUID", 0x931fc048, 0xc71d, 0x4455, 0x89, 0x30, 0x47, 0x6, 0x30, 0xe3, 0xe, 0xe5)
+GUID_ENTRY("SMM_PERFORMANCE_PROTOCOL_GUID", 0xf866226a, 0xeaa5, 0x4f5a, 0xa9, 0xa, 0x6c, 0xfb, 0xa5, 0x7c, 0x58, 0x8e)
+GUID_ENTRY("STATUS_CODE_CALLBACK_GUID", 0xe701458c, 0x4900, 0x4ca5, 0xb7, 0x72, 0x3d, 0x37, 0x94, 0x9f, 0x79, 0x27)
+GUID_ENTRY("SYSTEM_ROM_FILE_GUID", 0x1547B4F3, 0x3E8A, 0x4FEF, 0x81, 0xC8, 0x32, 0x8E, 0xD6, 0x47, 0xAB, 0x1A)
+GUID_ENTRY("TCG_CONFIG_FORM_SET_GUID", 0xb0f901e4, 0xc424, 0x45de, 0x90, 0x81, 0x95, 0xe2, 0xb, 0xde, 0x6f, 0xb5)
+GUID_ENTRY("TEMPORARY_RAM_SUPPORT_PPI_GUID", 0xdbe23aa9, 0xa345, 0x4b97, 0x85, 0xb6, 0xb2, 0x26, 0xf1, 0x61, 0x73, 0x89)
+GUID_ENTRY("TIANO_CUSTOM_DECOMPRESS_GUID", 0xA31280AD, 0x481E, 0x41B6, 0x95, 0xE8, 0x12, 0x7F, 0x4C, 0x98, 0x47, 0x79)
+GUID_ENTRY("UNIX_FWH_PPI_GUID", 0xf2f0dc30, 0x8985, 0x11db, 0xa1, 0x5b, 0x00, 0x40, 0xd0, 0x2b, 0x18, 0x35)
+GUID_ENTRY("UNIX_PEI_LOAD_FILE_GUID", 0xf2f48768, 0x8985, 0x11db, 0xb8, 0xda, 0x00, 0x40, 0xd0, 0x2b, 0x18, 0x35)
+GUID_ENTRY("UNKNOWN_DEVICE_GUID", 0xcf31fac5, 0xc24e, 0x11d2, 0x85, 0xf3, 0x0, 0xa0, 0xc9, 0x3e, 0xc9, 0x3b)
+GUID_ENTRY("USB_CREDENTIAL_PROVIDER_GUID", 0xd0849ed1, 0xa88c, 0x4ba6, 0xb1, 0xd6, 0xab, 0x50, 0xe2, 0x80, 0xb7, 0xa9)
+GUID_ENTRY("USB_KEYBOARD_LAYOUT_PACKAGE_GUID", 0xc0f3b43, 0x44de, 0x4907, 0xb4, 0x78, 0x22, 0x5f, 0x6f, 0x62, 0x89, 0xdc)
+GUID_ENTRY("USER_IDENTIFY_MANAGER_GUID", 0x3ccd3dd8, 0x8d45, 0x4fed, 0x96, 0x2d, 0x2b, 0x38, 0xcd, 0x82, 0xb3, 0xc4)
+GUID_ENTRY("USER_PROFILE_MANAGER_GUID", 0xc35f272c, 0x97c2, 0x465a, 0xa2, 0x16, 0x69, 0x6b, 0x66, 0x8a, 0x8c, 0xfe)
+GUID_ENTRY("VIRTUAL_UNCACHED_PAGES_PROTOCOL_GUID", 0xAD651C7D, 0x3C22, 0x4DBF, 0x92, 0xe8, 0x38, 0xa7, 0xcd, 0xae, 0x87, 0xb2)
+GUID_ENTRY("VLAN_CONFIG_FORM_SET_GUID", 0xd79df6b0, 0xef44, 0x43bd, 0x97, 0x97, 0x43, 0xe9, 0x3b, 0xcf, 0x5f, 0xa8)
+
+/* GUID FROM AMI SOURCE CODE - source Snare files */
 
-    /* GUID FROM AMI SOURCE CODE - source Snare files */
-    
-    { "ACOUSTIC_SETUP_PROTOCOL_GUID", { 0xc1d7859d, 0x5719, 0x46c3, 0xa2, 0x98, 0xd0, 0x71, 0xe3, 0x2, 0x64, 0xd1 } },
-    { "ADD_BOOT_OPTION_GUID", { 0x19d96d3f, 0x6a6a, 0x47d2, 0xb1, 0x95, 0x7b, 0x24, 0x32, 0xda, 0x3b, 0xe2 } },
-    { "ADVANCED_FORM_SET_GUID", { 0xe14f04fa, 0x8706, 0x4353, 0x92, 0xf2, 0x9c, 0x24, 0x24, 0x74, 0x6f, 0x9f } },
-    { "AHCI_BUS_INIT_PROTOCOL_GUID", { 0xB2FA4764, 0x3B6E, 0x43D3, 0x91, 0xDF, 0x87, 0xD1, 0x5A, 0x3E, 0x56, 0x68 } },
-    { "AHCI_SMM_PROTOCOL_GUID", { 0xB2FA5764, 0x3B6E, 0x43D3, 0x91, 0xDF, 0x87, 0xD1, 0x5A, 0x3E, 0x56, 0x68 } },
-    { "AMICSM_PCIBUSNUM_XLAT_PROTOCOL_GUID", { 0xcb5c54c0, 0x230d, 0x43db, 0x92, 0x2c, 0x24, 0xd3, 0x4f, 0x8c, 0x91, 0x5c } },
-    { "AMITSESETUP_GUID", { 0xc811fa38, 0x42c8, 0x4579, 0xa9, 0xbb, 0x60, 0xe9, 0x4e, 0xdd, 0xfb, 0x34 } },
-    { "AMITSE_ADMIN_PASSWORD_VALID_GUID", { 0x541d5a75, 0x95ee, 0x43c7, 0x9e, 0x5d, 0x23, 0x94, 0xdc, 0x48, 0x62, 0x49 } },
-    { "AMITSE_AFTER_FIRST_BOOT_OPTION_GUID", { 0xC48D651C, 0x9D0E, 0x4ce7, 0xAD, 0x39, 0xED, 0xD1, 0xAB, 0x83, 0x6B, 0x30 } },
-    { "AMITSE_BOOT_ORDER_CHANGE_GUID", { 0x1b6bc809, 0xc986, 0x4937, 0x93, 0x4f, 0x1e, 0xa5, 0x86, 0x22, 0xfe, 0x50 } },
-    { "AMITSE_DRIVER_HEALTH_CTRL_GUID", { 0x58279c2d, 0xfb19, 0x466e, 0xb4, 0x2e, 0xcd, 0x43, 0x70, 0x16, 0xdc, 0x25 } },
-    { "AMITSE_DRIVER_HEALTH_ENB_GUID", { 0x885f288, 0x418c, 0x4be1, 0xa6, 0xaf, 0x8b, 0xad, 0x61, 0xda, 0x8, 0xfe } },
-    { "AMITSE_DRIVER_HEALTH_GUID", { 0x7459a7d4, 0x6533, 0x4480, 0xbb, 0xa7, 0x79, 0xe2, 0x5a, 0x44, 0x43, 0xc9 } },
-    { "AMITSE_EVENT_BEFORE_BOOT_GUID", { 0x3677770f, 0xefb2, 0x43b2, 0xb8, 0xae, 0xb3, 0x2, 0xe9, 0x60, 0x48, 0x82 } },
-    { "AMITSE_INVALID_PASSWORD_GUID", { 0xd69240c0, 0xdd40, 0x4f2d, 0x98, 0x63, 0x48, 0x48, 0xda, 0x6e, 0x61, 0x5f } },
-    { "AMITSE_NVRAM_UPDATE_GUID", { 0xd84beff0, 0x159a, 0x4b60, 0x9a, 0xb9, 0xac, 0x5c, 0x47, 0x4b, 0xd3, 0xb1 } },
-    { "AMITSE_PASSWORD_PROMPT_ENTER_GUID", { 0x73e7e01, 0x2611, 0x4e85, 0xb8, 0x96, 0xa3, 0xb6, 0x76, 0x7c, 0xba, 0x0 } },
-    { "AMITSE_PASSWORD_PROMPT_EXIT_GUID", { 0xb9b038b0, 0xe2b6, 0x4aab, 0x94, 0x35, 0x41, 0x65, 0xec, 0xfe, 0xd0, 0x32 } },
-    { "AMITSE_SETUP_ENTER_GUID", { 0x71202EEE, 0x5F53, 0x40d9, 0xAB, 0x3D, 0x9E, 0x0C, 0x26, 0xD9, 0x66, 0x57 } },
-    { "AMITSE_USER_PASSWORD_VALID_GUID", { 0xab1404ca, 0x4801, 0x4208, 0x98, 0xbf, 0x30, 0xd5, 0x21, 0xda, 0xd4, 0xd3 } },
-    { "AMI_APTIO_SIG_OWNER_GUID", { 0x26DC4851, 0x195F, 0x4AE1, 0x9A, 0x19, 0xFB, 0xF8, 0x83, 0xBB, 0xB3, 0x5E } },
-    { "AMI_BBS_DEVICE_PATH_GUID", { 0x1db184ae, 0x81f5, 0x4e72, 0x85, 0x44, 0x2b, 0xab, 0xc, 0x2c, 0xac, 0x5c } },
-    { "AMI_BEFORE_CPU_RC_PROTOCOL_GUID", { 0x1d26adc3, 0xb011, 0xee2c, 0x21, 0x77, 0x89, 0xbb, 0xaa, 0xcc, 0x33, 0x92 } },
-    { "AMI_BIOSPPI_FLAGS_MANAGEMENT_GUID", { 0xe9008d70, 0x2a4e, 0x47ea, 0x8e, 0xc4, 0x72, 0xe2, 0x57, 0x67, 0xe5, 0xef } },
-    { "AMI_BOARD_INFO_PROTOCOL_GUID", { 0x0273146c, 0x96c4, 0x45a1, 0xa7, 0xaf, 0x78, 0xe0, 0x52, 0x4a, 0x0a, 0xe2 } },
-    { "AMI_BOARD_INFO_SECTION_GUID", { 0xE6F4F8F7, 0x4992, 0x47b2, 0x83, 0x02, 0x85, 0x08, 0x74, 0x5E, 0x4A, 0x23 } },
-    { "AMI_CALLBACK_GUID", { 0x9CF0F18E, 0x7C7D, 0x49DE, 0xB5, 0xAA, 0xBB, 0xBA, 0xD6, 0xB2, 0x10, 0x07 } },
-    { "AMI_CAPSULE_HOB_GUID", { 0xbf66fdf7, 0xf64c, 0x4b11, 0x8a, 0xb7, 0xf8, 0x43, 0xaa, 0x2a, 0x8b, 0xea } },
-    { "AMI_CCID_IO_PROTOCOL_GUID", { 0xB167C2F5, 0xE26A, 0x4DFF, 0x8E, 0x1C, 0x08, 0x07, 0xC7, 0xF0, 0x2A, 0x88 } },
-    { "AMI_CCID_PRESENCE_GUID", { 0x5FDEE00D, 0xDA40, 0x405A, 0xB9, 0x2E, 0xCF, 0x4A, 0x80, 0xEA, 0x8F, 0x76 } },
-    { "AMI_CMOS_BAD_FLAG_HOB_GUID", { 0xb098f766, 0xb17a, 0x4005, 0x83, 0x9, 0xeb, 0x23, 0xf1, 0x44, 0x8c, 0x15 } },
-    { "AMI_CPUID_CKSUM_HOB_GUID", { 0xd4ca32b1, 0xb1f2, 0x4ff3, 0xb4, 0x75, 0x66, 0xe7, 0xb8, 0x19, 0x2a, 0x3b } },
-    { "AMI_CPU_INFO_2_PROTOCOL_GUID", { 0xac9cf0a8, 0xe551, 0x4be2, 0xad, 0xa, 0xe1, 0xb5, 0x64, 0xee, 0xa2, 0x73 } },
-    { "AMI_CSM_DRIVER_STARTED_GUID", { 0x3EA824D1, 0x81E3, 0x4FF5, 0xBD, 0x43, 0xBB, 0x9C, 0x65, 0xDF, 0x7C, 0x46 } },
-    { "AMI_CSM_THUNK_PROTOCOL_GUID", { 0x2362ea9c, 0x84e5, 0x4dff, 0x83, 0xbc, 0xb5, 0xac, 0xec, 0xb5, 0x7c, 0xbb } },
-    { "AMI_DDDT_PRESENT_FLAG_HOB_GUID", { 0x4e7af417, 0xc200, 0x400a, 0x9d, 0x18, 0x86, 0x5a, 0xda, 0xd3, 0x8, 0x96 } },
-    { "AMI_DEBUGGER_CPU_PROTOCOL_GUID", { 0xab21acc3, 0xba33, 0xee2c, 0x66, 0xbc, 0x12, 0x56, 0x77, 0x11, 0x1a, 0xb2 } },
-    { "AMI_DEBUGPORT_HOB_GUID", { 0xe894b313, 0x54ca, 0x4bb2, 0x8c, 0xdd, 0x85, 0x1e, 0x8a, 0xc9, 0x2, 0x7c } },
-    { "AMI_DEVICE_NAME_DEVICE_PATH_GUID", { 0x2d6447ef, 0x3bc9, 0x41a0, 0xac, 0x19, 0x4d, 0x51, 0xd0, 0x1b, 0x4c, 0xe6 } },
-    { "AMI_DIGITAL_SIGNATURE_PROTOCOL_GUID", { 0x5f87ba17, 0x957d, 0x433d, 0x9e, 0x15, 0xc0, 0xe7, 0xc8, 0x79, 0x88, 0x99 } },
-    { "AMI_DIMM_SPD_DATA_HOB_GUID", { 0xd4ca32b3, 0xb1fe, 0x4ff7, 0xb0, 0x73, 0x60, 0xed, 0xbb, 0x16, 0x22, 0x33 } },
-    { "AMI_EARLY_BIST_PPI_GUID", { 0xa7e2ce72, 0xdc32, 0x4bc0, 0x9e, 0x35, 0xfe, 0xb3, 0xa, 0xe5, 0xcc, 0x47 } },
-    { "AMI_EFIKEYCODE_PROTOCOL_GUID", { 0x0adfb62d, 0xff74, 0x484c, 0x89, 0x44, 0xf8, 0x5c, 0x4b, 0xea, 0x87, 0xa8 } },
-    { "AMI_FAST_BOOT_PROTOCOL_GUID", { 0x3496a19a, 0x2e99, 0x41ba, 0x83, 0x3e, 0xf, 0xde, 0x2e, 0xbf, 0x2a, 0x55 } },
-    { "AMI_FW_RECOVERY_CAPSULE_GUID", { 0x5e794317, 0xa07e, 0x45df, 0x94, 0xbb, 0x1c, 0x99, 0x7d, 0x62, 0x32, 0xca } },
-    { "AMI_HECI_SMM_GUID", { 0xFC9A50C1, 0x8B3D, 0x40D0, 0x99, 0x12, 0x6E, 0x26, 0xD7, 0x89, 0x6C, 0xBA } },
-    { "AMI_INTERNAL_FACTORY_TDC_TDP_HOB_GUID", { 0x982d8c6f, 0xf6f6, 0x4135, 0xa3, 0x9, 0xa4, 0x59, 0x3e, 0xa5, 0x64, 0x17 } },
-    { "AMI_INTERNAL_UCODE_HOB_GUID", { 0x94567c6f, 0xf7a9, 0x4229, 0x13, 0x30, 0xfe, 0x11, 0xcc, 0xab, 0x3a, 0x11 } },
-    { "AMI_INT_SMM_COMM_PROTOCOL_GUID", { 0xb27dab38, 0x9814, 0x4e06, 0xa5, 0xa2, 0x65, 0xae, 0x9a, 0x14, 0x25, 0x8f } },
-    { "AMI_IRQ_DMA_MASK_VARIABLE_GUID", { 0xfc8be767, 0x89f1, 0x4d6e, 0x80, 0x99, 0x6f, 0x2, 0x1e, 0xbc, 0x87, 0xcc } },
-    { "AMI_ISO9660_MEDIA_GUID", { 0xba7c46d1, 0x9c5e, 0x4fc8, 0x94, 0x3d, 0x1a, 0x49, 0x1f, 0x23, 0xfe, 0x1 } },
-    { "AMI_LOAD_CSM_GUID", { 0x16287ba4, 0x5b9d, 0x4d98, 0x91, 0x9f, 0x7b, 0x7b, 0x78, 0xcb, 0x2b, 0xe0 } },
-    { "AMI_MASKED_DEVICE_PATH_GUID", { 0x99e275e7, 0x75a0, 0x4b37, 0xa2, 0xe6, 0xc5, 0x38, 0x5e, 0x6c, 0x0, 0xcb } },
-    { "AMI_MEASURE_PCIOPROM_GUID", { 0xb3dae700, 0x2a77, 0x4ea4, 0xaf, 0x79, 0x32, 0x97, 0xb4, 0x84, 0xbe, 0x61 } },
-    { "AMI_MEDIA_DEVICE_PATH_GUID", { 0x5023b95c, 0xdb26, 0x429b, 0xa6, 0x48, 0xbd, 0x47, 0x66, 0x4c, 0x80, 0x12 } },
-    { "AMI_MEMORY_ERROR_REPORT_PPI_GUID", { 0x85226559, 0x0def, 0x48d8, 0xa8, 0xc9, 0xb7, 0x46, 0xd6, 0xa4, 0xdf, 0x01 } },
-    { "AMI_MRC_INFO_HOB_GUID", { 0xa6351a87, 0x2965, 0x4718, 0x88, 0xc7, 0x0b, 0x5b, 0x5a, 0xc0, 0xb5, 0xe4 } },
-    { "AMI_NB_MRC_INFO_GUID", { 0x6737934b, 0xa27e, 0x4c05, 0xad, 0x5b, 0x6a, 0xb8, 0x62, 0x73, 0x68, 0x0b } },
-    { "AMI_NVRAM_SPD_MAP_GUID", { 0x717fc150, 0xabd9, 0x4614, 0x80, 0x15, 0xb, 0x33, 0x23, 0xea, 0xb9, 0x5c } },
-    { "AMI_OPROM_POLICY_PROTOCOL_GUID", { 0x542d6248, 0x4198, 0x4960, 0x9f, 0x59, 0x23, 0x84, 0x64, 0x6d, 0x63, 0xb4 } },
-    { "AMI_OS_PPI_CONFIRMATION_OVERRIDE_GUID", { 0x5f171f5f, 0x8385, 0x4086, 0xa6, 0x9b, 0x1f, 0xcf, 0x6, 0xae, 0x4a, 0x3d } },
-    { "AMI_PB_KEY_RSA2048_GUID", { 0x04627B9B, 0x385E, 0x4744, 0x90, 0x21, 0xE6, 0x63, 0x19, 0xF2, 0x03, 0x94 } },
-    { "AMI_PCI_BUS_EXT_PROTOCOL_GUID", { 0xf42a009d, 0x977f, 0x4f08, 0x94, 0x40, 0xbc, 0xa5, 0xa3, 0xbe, 0xd9, 0xaf } },
-    { "AMI_PEIM_HOB_GUID", { 0xf4491ba4, 0x7672, 0x486f, 0xb4, 0xd7, 0x99, 0x89, 0x9d, 0x22, 0xda, 0x57 } },
-    { "AMI_PEIM_LOAD_HOB_GUID", { 0xec9c36fd, 0x1642, 0x4b84, 0x91, 0xfa, 0x91, 0x9c, 0x2d, 0x6, 0x6f, 0xb4 } },
-    { "AMI_PEI_AFTER_MRC_GUID", { 0x64c96700, 0x6b4c, 0x480c, 0xa3, 0xe1, 0xb8, 0xbd, 0xe8, 0xf6, 0x2, 0xb2 } },
-    { "AMI_PEI_CPUINIT_POLICY_PPI_GUID", { 0xf824ccbb, 0xd8e0, 0x4522, 0x8a, 0xa8, 0x65, 0xf0, 0x4b, 0x46, 0x3d, 0xb5 } },
-    { "AMI_PEI_END_MEMORY_DETECT_GUID", { 0x9f58e424, 0xb96b, 0x45a5, 0xad, 0xdc, 0xd2, 0xfe, 0x39, 0x4a, 0x99, 0xd9 } },
-    { "AMI_PEI_END_OF_MRC_GUID", { 0x633194be, 0x1697, 0x11e1, 0xb5, 0xf0, 0x2c, 0xb2, 0x48, 0x24, 0x01, 0x9b } },
-    { "AMI_PEI_MRC_DEFAULT_GUID", { 0xe813e116, 0xc099, 0x4d21, 0x9c, 0x34, 0xa5, 0x52, 0xd5, 0xe9, 0xa5, 0xd0 } },
-    { "AMI_PEI_NBINIT_POLICY_PPI_GUID", { 0x9ce4d938, 0x9c87, 0x41d0, 0x9e, 0x55, 0x34, 0x92, 0x3f, 0xaf, 0x8b, 0x4f } },
-    { "AMI_PEI_NB_CPU_ONLY_RESET_PPI_GUID", { 0x1f0f049e, 0x3a68, 0x4c97, 0x86, 0x5a, 0xbc, 0x5e, 0xed, 0x79, 0x20, 0xe7 } },
-    { "AMI_PEI_NB_CUSTOM_PPI_GUID", { 0x584cc99f, 0x4be8, 0x43d1, 0xa4, 0x5a, 0x93, 0x3d, 0xc3, 0x94, 0x79, 0xfc } },
-    { "AMI_PEI_PCI_TABLE_INIT_PPI_GUID", { 0x97f91e78, 0xea12, 0x4ea6, 0xb7, 0xb3, 0x7b, 0x6, 0x78, 0xc2, 0x86, 0x73 } },
-    { "AMI_PEI_SBINIT_POLICY_PPI_GUID", { 0x95e8152b, 0x1b98, 0x4f11, 0x8a, 0x77, 0xdb, 0x26, 0x58, 0x3e, 0xbc, 0x42 } },
-    { "AMI_PEI_SB_CUSTOM_PPI_GUID", { 0x38965bb5, 0x8097, 0x40f5, 0xb7, 0x42, 0x8c, 0xc1, 0x4a, 0x64, 0x9b, 0x64 } },
-    { "AMI_PEI_SB_OEM_PLATFORM_POLICY_OVERRIDE_PPI_GUID", { 0x61187967, 0x9a77, 0x419d, 0xaa, 0xea, 0x64, 0xdd, 0x56, 0x19, 0x08, 0x15 } },
-    { "AMI_PEI_SET_NB_SUBID_PPI_GUID", { 0x584cc99f, 0x4be8, 0x43d1, 0xa4, 0x5a, 0x93, 0x3d, 0xc3, 0x94, 0x79, 0xfc } },
-    { "AMI_PERF_TUNE_DATA_HOB_GUID", { 0x4d6c0496, 0x8de4, 0x4af2, 0x9a, 0x2e, 0x9b, 0xe5, 0xb9, 0x15, 0x6a, 0xc5 } },
-    { "AMI_PLL_OVER_VOTAGE_FLAG_HOB_GUID", { 0x181e874d, 0xc089, 0x4c99, 0x8e, 0xc2, 0x6d, 0x67, 0x61, 0x34, 0x82, 0x20 } },
-    { "AMI_POST_MANAGER_PROTOCOL_GUID", { 0x8A91B1E1, 0x56C7, 0x4ADC, 0xAB, 0xEB, 0x1C, 0x2C, 0xA1, 0x72, 0x9E, 0xFF } },
-    { "AMI_RECOVERY_IMAGE_HOB_GUID", { 0xdac3cb98, 0x2295, 0x412e, 0x82, 0x6d, 0xfd, 0xee, 0xa3, 0x20, 0xcf, 0x31 } },
-    { "AMI_RESET_TYPE_HOB_GUID", { 0x39e8cda1, 0x6a35, 0x4cdd, 0xa9, 0x2, 0xd1, 0xa7, 0x95, 0xf7, 0x3, 0x80 } },
-    { "AMI_RESET_TYPE_VARIABLE_GUID", { 0x308DD02C, 0x092B, 0x4123, 0xA2, 0xAF, 0x3E, 0xF4, 0x44, 0x0A, 0x6B, 0x4A } },
-    { "AMI_ROM_LAYOUT_HOB_GUID", { 0xd7642443, 0x87b7, 0x4832, 0x96, 0x7, 0xe, 0x1e, 0xa8, 0x1c, 0x1d, 0x86 } },
-    { "AMI_SB_SMI_PROTOCOL_GUID", { 0x589bc616, 0xbb4f, 0x47ed, 0x92, 0xf7, 0x93, 0x39, 0x3c, 0x69, 0x7e, 0x25 } },
-    { "AMI_SETUP_NVRAM_UPDATE_GUID", { 0xd84beff0, 0x159a, 0x4b60, 0x9a, 0xb9, 0xac, 0x5c, 0x47, 0x4b, 0xd3, 0xb1 } },
-    { "AMI_SMBIOS_CPU_INFO_PROTOCOL_GUID", { 0x3d6cdb0a, 0x5b1f, 0x43a3, 0xa4, 0x3b, 0x44, 0x12, 0x67, 0xf9, 0xda, 0xb5 } },
-    { "AMI_SMBIOS_MEMORY_INFO_HOB_GUID", { 0x7d6b8734, 0xb754, 0x443f, 0xb5, 0x88, 0x77, 0x43, 0x84, 0x3a, 0xd3, 0xf1 } },
-    { "AMI_SMBUS_HOB_GUID", { 0x17cb4b7, 0xb80c, 0x4040, 0xb6, 0xc8, 0xea, 0x98, 0x2b, 0xbb, 0x25, 0xb7 } },
-    { "AMI_SMBUS_SMM_PROTOCOL_GUID", { 0x72e40094, 0x2ee1, 0x497a, 0x8f, 0x33, 0x4c, 0x93, 0x4a, 0x9e, 0x9c, 0xc } },
-    { "AMI_SMM_DIGITAL_SIGNATURE_PROTOCOL_GUID", { 0x91ABC830, 0x16FC, 0x4D9E, 0xA1, 0x89, 0x5F, 0xC8, 0xBB, 0x41, 0x14, 0x02 } },
-    { "AMI_SMM_INFO_PROTOCOL_GUID", { 0xeb5198eb, 0xe7f5, 0x45a1, 0x9c, 0xcb, 0xe5, 0x33, 0x64, 0xbb, 0x49, 0x92 } },
-    { "AMI_STANDARD_DEFAULTS_VARIABLE_GUID", { 0x4599d26f, 0x1a11, 0x49b8, 0xb9, 0x1f, 0x85, 0x87, 0x45, 0xcf, 0xf8, 0x24 } },
-    { "AMI_STATUS_CODE_CPU_BIST_DATA_GUID", { 0xcd541d77, 0x6699, 0x4b36, 0xa3, 0x1e, 0x1a, 0xa4, 0xc5, 0xd5, 0xb9, 0x46 } },
-    { "AMI_TCG_CONFIRMATION_FLAGS_GUID", { 0x7d3dceee, 0xcbce, 0x4ea7, 0x87, 0x09, 0x6e, 0x55, 0x2f, 0x1e, 0xdb, 0xde } },
-    { "AMI_TCG_EFI_OS_VARIABLE_GUID", { 0xa8a2093b, 0xfefa, 0x43c1, 0x8e, 0x62, 0xce, 0x52, 0x68, 0x47, 0x26, 0x5e } },
-    { "AMI_TCG_PERM_FLAGS_GUID", { 0x2325f2fc, 0x5683, 0x4648, 0x97, 0xc4, 0x9a, 0x52, 0x0d, 0xfb, 0xe3, 0x25 } },
-    { "AMI_TCG_PLATFORM_PPI_AFTER_MEM_GUID", { 0x890c2cef, 0x43c8, 0x4209, 0xa7, 0x8d, 0xae, 0x14, 0xaa, 0x17, 0x98, 0xb4 } },
-    { "AMI_TCG_PLATFORM_PPI_BEFORE_MEM_GUID", { 0xc1e6791d, 0xf35b, 0x43ef, 0x92, 0xa, 0xbe, 0x6, 0xba, 0x7f, 0x86, 0xa1 } },
-    { "AMI_TCG_PLATFORM_PPI_GUID", { 0x5687f4a, 0x3ca7, 0x4d19, 0x9b, 0xc5, 0xe1, 0x80, 0xce, 0xa3, 0x56, 0x9f } },
-    { "AMI_TCG_PLATFORM_PROTOCOL_GUID", { 0x320bdc39, 0x3fa0, 0x4ba9, 0xbf, 0x2d, 0xb3, 0x3f, 0x72, 0xba, 0x9c, 0xa1 } },
-    { "AMI_TCG_RESETVAR_HOB_GUID", { 0xa8a2093b, 0xfefa, 0x43c1, 0x8e, 0x62, 0xce, 0x52, 0x68, 0x47, 0x26, 0x5e } },
-    { "AMI_USB_SMM_PROTOCOL_GUID", { 0x3ef7500e, 0xcf55, 0x474f, 0x8e, 0x7e, 0x0, 0x9e, 0xe, 0xac, 0xec, 0xd2 } },
-    { "AMT_FORCE_PUSH_PET_HOB_GUID", { 0x4efa0db6, 0x26dc, 0x4bb1, 0xa7, 0x6f, 0x14, 0xbc, 0x63, 0x0c, 0x7b, 0x3c } },
-    { "AMT_FORCE_PUSH_PET_POLICY_GUID", { 0xacc8e1e4, 0x9f9f, 0x4e40, 0xa5, 0x7e, 0xf9, 0x9e, 0x52, 0xf3, 0x4c, 0xa5 } },
-    { "AMT_FORCE_PUSH_PET_VARIABLE_GUID", { 0xd7ac94af, 0xa498, 0x45ec, 0xbf, 0xa2, 0xa5, 0x6e, 0x95, 0x34, 0x61, 0x8b } },
-    { "AMT_INT16_CSM_GUID", { 0x6046e678, 0x24ef, 0x4005, 0xba, 0x39, 0xbd, 0xa1, 0x1f, 0x6d, 0x55, 0x5d } },
-    { "AMT_READY_TO_BOOT_PROTOCOL_GUID", { 0x40b09b5a, 0xf0ef, 0x4627, 0x93, 0xd5, 0x27, 0xf0, 0x4b, 0x75, 0x4d, 0x5 } },
-    { "AOAC_EC_WAKEUP_CUSTOM_PPI_GUID", { 0x82627acf, 0xd92d, 0x416d, 0x8a, 0x6f, 0x78, 0x3c, 0xac, 0xd9, 0x12, 0x23 } },
-    { "AOAC_FFS_TABLE_STORAGE_GUID", { 0xfb045db2, 0x598e, 0x485a, 0xba, 0x30, 0x5d, 0x7b, 0x1b, 0x1b, 0xd5, 0x4d } },
-    { "APTIO_FW_CAPSULE_GUID", { 0x4A3CA68B, 0x7723, 0x48FB, 0x80, 0x3d, 0x57, 0x8c, 0xc1, 0xfe, 0xc4, 0x4d } },
-    { "APTIO_HII_PROTOCOL_GUID", { 0xea816d2c, 0xcee5, 0x4f02, 0x99, 0xb5, 0xd3, 0x90, 0x5c, 0xbb, 0xd0, 0x77 } },
-    { "AUTHVAR_MAILBOX_VARIABLE_GUID", { 0x532B6532, 0x6499, 0x428D, 0xAC, 0xB1, 0xF6, 0xF7, 0x79, 0xC9, 0x4D, 0xF9 } },
-    { "BDS_ALL_DRIVERS_CONNECTED_PROTOCOL_GUID", { 0xdbc9fd21, 0xfad8, 0x45b0, 0x9e, 0x78, 0x27, 0x15, 0x88, 0x67, 0xcc, 0x93 } },
-    { "BDS_CONNECT_DRIVERS_PROTOCOL_GUID", { 0x3aa83745, 0x9454, 0x4f7a, 0xa7, 0xc0, 0x90, 0xdb, 0xd0, 0x2f, 0xab, 0x8e } },
-    { "BLOCK_DEVICE_RECOVERY_CAPSULE_GUID", { 0xba8263c, 0xa8bd, 0x4aad, 0xb4, 0x2, 0x6a, 0x6a, 0xf2, 0xf7, 0xe7, 0x7d } },
-    { "BOOT_FLOW_VARIABLE_GUID", { 0xEF152FB4, 0x7B2F, 0x427D, 0xBD, 0xB4, 0x7E, 0x0A, 0x05, 0x82, 0x6E, 0x64 } },
-    { "BOOT_FORM_SET_GUID", { 0x8b33ffe0, 0xd71c, 0x4f82, 0x9c, 0xeb, 0xc9, 0x70, 0x58, 0xc1, 0x3f, 0x8e } },
-    { "BOOT_MANAGER_GUID", { 0xB4909CF3, 0x7B93, 0x4751, 0x9B, 0xD8, 0x5B, 0xA8, 0x22, 0x0B, 0x9B, 0xB2 } },
-    { "BOOT_NOW_COUNT_GUID", { 0x052e6eb0, 0xf240, 0x42c5, 0x83, 0x09, 0x45, 0x87, 0x45, 0x45, 0xc6, 0xb4 } },
-    { "CHIPSET_FORM_SET_GUID", { 0xadfe34c8, 0x9ae1, 0x4f8f, 0xbe, 0x13, 0xcf, 0x96, 0xa2, 0xcb, 0x2c, 0x5b } },
-    { "CMOS_MANAGER_HOB_GUID", { 0xd5367802, 0xb873, 0x4c0f, 0xb5, 0x44, 0x31, 0xb7, 0xcc, 0xf5, 0xc5, 0x55 } },
-    { "CONSOLE_IN_DEVICES_STARTED_PROTOCOL_GUID", { 0x2df1e051, 0x906d, 0x4eff, 0x86, 0x9d, 0x24, 0xe6, 0x53, 0x78, 0xfb, 0x9e } },
-    { "CONSOLE_OUT_DEVICES_STARTED_PROTOCOL_GUID", { 0xef9a3971, 0xc1a0, 0x4a93, 0xbd, 0x40, 0x5a, 0xa1, 0x65, 0xf2, 0xdc, 0x3a } },
-    { "CPU_MICROCODE_FILE_GUID", { 0x17088572, 0x377F, 0x44ef, 0x8F, 0x4E, 0xB0, 0x9F, 0xFF, 0x46, 0xA0, 0x70 } },
-    { "CPU_WAKE_UP_BUFFER_VARIABLE_GUID", { 0xdf665292, 0x79d7, 0x40e2, 0xba, 0x51, 0xf7, 0xd4, 0x94, 0x62, 0x81, 0x85 } },
-    { "CSM_VIDEO_POLICY_PROTOCOL_GUID", { 0x3a4e4376, 0x4871, 0x4b0e, 0xa0, 0x2f, 0xed, 0x36, 0xf2, 0xae, 0xcd, 0x0 } },
-    { "DCA_HOB_GUID", { 0x6865c455, 0x8626, 0x40d8, 0x90, 0xf4, 0xa6, 0x94, 0x60, 0xa4, 0xab, 0x5a } },
-    { "DEBUGGER_TERMINAL_VAR_GUID", { 0x97ca1a5b, 0xb760, 0x4d1f, 0xa5, 0x4b, 0xd1, 0x90, 0x92, 0x3, 0x2c, 0x90 } },
-    { "DEFINE_GUID_CRBDXEBin_GUID", { 0x16271fca, 0x55d9, 0x4a33, 0x93, 0xfc, 0x5a, 0x3e, 0xb1, 0x28, 0xde, 0xb6 } },
-    { "DEFINE_GUID_CRBSMIBin_GUID", { 0x221f1d4f, 0x034c, 0x4bea, 0xb2, 0xbb, 0xb7, 0xa9, 0x67, 0x2b, 0x06, 0xd7 } },
-    { "DEFINE_GUID_AcpiPlatformPeiBin_GUID", { 0x333bb2a3, 0x4f20, 0x4c8b, 0xac, 0x38, 0x6, 0x72, 0xd7, 0x43, 0x15, 0xf8 } },
-    { "DEFINE_GUID_OEMPEIBin_GUID", { 0x6e59df06, 0x62d3, 0x40b0, 0x82, 0xb5, 0x17, 0x5c, 0xf8, 0x4a, 0x94, 0xe4 } },
-    { "DEFINE_GUID_SBDXEBin_GUID", { 0xb7d19491, 0xe55a, 0x470d, 0x85, 0x8, 0x85, 0xa5, 0xdf, 0xa4, 0x19, 0x74 } },
-    { "DEFINE_GUID_OEMDXEBin_GUID", { 0xbfe205c9, 0x5b17, 0x4f8f, 0x93, 0x75, 0x89, 0x61, 0x4a, 0xf8, 0xe1, 0x99 } },
-    { "DEFINE_GUID_SBPEIBin_GUID", { 0xc1fbd624, 0x27ea, 0x40d1, 0xaa, 0x48, 0x94, 0xc3, 0xdc, 0x5c, 0x7e, 0xd } },
-    { "DEFINE_GUID_CRBPEIBin_GUID", { 0xd1ed2f7, 0xe92b, 0x4562, 0x92, 0xdd, 0x5c, 0x82, 0xec, 0x91, 0x7e, 0xae } },
-    { "DEFINE_GUID_AcpiPlatformSmiBin_GUID", { 0xdfd8d5cc, 0x5aed, 0x4820, 0xa2, 0xb6, 0x5c, 0x55, 0xe4, 0xe6, 0x40, 0xef } },
-    { "DEFINE_GUID_NBPEIBin_GUID", { 0x79aa6086, 0x035a, 0x4ad9, 0xa8, 0x9a, 0xa6, 0xd5, 0xaa, 0x27, 0xf0, 0xe2 } },
-    { "DEFINE_GUID_NBDXEBin_GUID", { 0xe4ecd0b2, 0xe277, 0x4f2b, 0xbe, 0xcb, 0xe4, 0xd7, 0x5c, 0x9a, 0x81, 0x2e } },
-    { "DEFINE_GUID_SBRunBin_GUID", { 0xe23f86e1, 0x056e, 0x4888, 0xb6, 0x85, 0xcf, 0xcd, 0x67, 0xc1, 0x79, 0xd4 } },
-    { "DEL_BOOT_OPTION_GUID", { 0xF6C73719, 0xF34C, 0x479C, 0xB3, 0x2F, 0x27, 0x7F, 0xCB, 0xBC, 0xFE, 0x4F } },
-    { "DIMM_TS_INFO_GUID", { 0xce673a28, 0x800d, 0x4b4a, 0x83, 0x16, 0x26, 0x61, 0xf9, 0xb3, 0xd9, 0xc6 } },
-    { "DXE_CPU_CACHE_PROTOCOL_GUID", { 0x5c6fa2c9, 0x9768, 0x45f6, 0x8e, 0x64, 0x5a, 0xec, 0xca, 0xda, 0xb4, 0x81 } },
-    { "DXE_CPU_INFO_PROTOCOL_GUID", { 0xe223cf65, 0xf6ce, 0x4122, 0xb3, 0xaf, 0x4b, 0xd1, 0x8a, 0xff, 0x40, 0xa1 } },
-    { "DXE_CPU_PLATFORM_POLICY_PROTOCOL_GUID", { 0xbd26cdc9, 0xa092, 0x462a, 0x87, 0x7a, 0x5a, 0xb6, 0xad, 0xce, 0x48, 0x12 } },
-    { "DXE_ENHANCED_SPEEDSTEP_PROTOCOL_GUID", { 0xe98021, 0xf4fe, 0x46cc, 0xab, 0x2d, 0x89, 0x4c, 0x37, 0x3a, 0xfa, 0x1 } },
-    { "DXE_PCH_PLATFORM_POLICY_PROTOCOL_GUID", { 0xe0a31dbe, 0xf20e, 0x4e2a, 0x9f, 0x2b, 0x9f, 0x2, 0xa2, 0x7d, 0x3d, 0x69 } },
-    { "DXE_PLATFORM_AMT_POLICY_GUID", { 0xb2ab115e, 0xc8b6, 0x4036, 0xbf, 0x31, 0xe7, 0x4b, 0xd8, 0x92, 0x6c, 0xce } },
-    { "DXE_PLATFORM_ME_POLICY_GUID", { 0xf8bff014, 0x18fb, 0x4ef9, 0xb1, 0xc, 0xae, 0x22, 0x73, 0x8d, 0xbe, 0xed } },
-    { "DXE_PLATFORM_SA_POLICY_GUID", { 0xCD2333D7, 0x6A0A, 0x4C76, 0x83, 0x50, 0x24, 0xA, 0xDA, 0x36, 0xA2, 0xC7 } },
-    { "DXE_PLATFORM_SG_POLICY_GUID", { 0x6199dc36, 0xe114, 0x4e0d, 0x80, 0x99, 0x99, 0xa0, 0xbd, 0x80, 0xa9, 0x71 } },
-    { "DXE_PLATFORM_TDT_POLICY_GUID", { 0x20daf0fc, 0x5548, 0x44dc, 0xa4, 0x2a, 0x60, 0xea, 0xf0, 0xa2, 0x2e, 0x47 } },
-    { "DXE_TXT_POLICY_PROTOCOL_GUID", { 0x43F66FFD, 0xB288, 0x4139, 0xBA, 0xD5, 0xB8, 0x98, 0x3, 0xE7, 0x30, 0xA2 } },
-    { "DYNAMIC_PAGE_COUNT_GUID", { 0xb63bf800, 0xf267, 0x4f55, 0x92, 0x17, 0xe9, 0x7f, 0xb3, 0xb6, 0x98, 0x46 } },
-    { "EFI_ACPI_VARIABLE_GUID", { 0xaf9ffd67, 0xec10, 0x488a, 0x9d, 0xfc, 0x6c, 0xbf, 0x5e, 0xe2, 0x2c, 0x2e } },
-    { "EFI_ACTIVE_BIOS_PROTOCOL_GUID", { 0xebbe2d1b, 0x1647, 0x4bda, 0xab, 0x9a, 0x78, 0x63, 0xe3, 0x96, 0xd4, 0x1a } },
-    { "EFI_ACTIVE_MANAGEMENT_PROTOCOL_GUID", { 0x8555fd40, 0x140b, 0x4f3c, 0x90, 0x5e, 0x3b, 0xf3, 0x78, 0xa0, 0x99, 0xfa } },
-    { "EFI_AHCI_INT13_INIT_PROTOCOL_GUID", { 0x67820532, 0x7613, 0x4dd3, 0x9e, 0xd7, 0x3d, 0x9b, 0xe3, 0xa7, 0xda, 0x63 } },
-    { "EFI_ALERT_STANDARD_FORMAT_PROTOCOL_GUID", { 0xcc93a70b, 0xec27, 0x49c5, 0x8b, 0x34, 0x13, 0x93, 0x1e, 0xfe, 0xd6, 0xe2 } },
-    { "EFI_AMI_LEGACYBOOT_PROTOCOL_GUID", { 0x120d28aa, 0x6630, 0x46f0, 0x81, 0x57, 0xc0, 0xad, 0xc2, 0x38, 0x3b, 0xf5 } },
-    { "EFI_AUTHORIZATION_PROTOCOL_GUID", { 0x995188b1, 0x9f96, 0x11d4, 0x87, 0xae, 0x00, 0x06, 0x29, 0x2e, 0x8a, 0x3b } },
-    { "EFI_BDAT_ACCESS_GUID", { 0xb979746a, 0x8c1f, 0x4a2b, 0x97, 0xe4, 0x78, 0xe9, 0x3a, 0x71, 0xa7, 0xa } },
-    { "EFI_CACHE_INSTALL_PPI_GUID", { 0xbb628ae0, 0xcd4f, 0x49fe, 0x8d, 0x60, 0x63, 0x18, 0x6f, 0xd1, 0xe0, 0x5b } },
-    { "EFI_CAPSULE_AMI_GUID", { 0xfac2efad, 0x8511, 0x4e34, 0x9c, 0xae, 0x16, 0xa2, 0x57, 0xba, 0x94, 0x88 } },
-    { "EFI_CLP_PROTOCOL_GUID", { 0xcbbee336, 0x2682, 0x4cd6, 0x81, 0x8b, 0xa, 0xd, 0x96, 0x7e, 0x5a, 0x67 } },
-    { "EFI_CMOS_DATA_HOB_INSTALLED_GUID", { 0x5a6a93f4, 0x2907, 0x4a34, 0xbd, 0x11, 0x6c, 0xa8, 0xa0, 0x95, 0x9e, 0x9 } },
-    { "EFI_CONSOLE_LOCK_GUID", { 0x368cda0d, 0xcf31, 0x4b9b, 0x8c, 0xf6, 0xe7, 0xd1, 0xbf, 0xff, 0x15, 0x7e } },
-    { "EFI_CPU_TYPE_FRU_GUID", { 0xf064c91f, 0x188c, 0x4f56, 0xb7, 0xfd, 0x30, 0xa9, 0xb8, 0x6a, 0x29, 0xf3 } },
-    { "EFI_DEBUG_MASK_PPI_GUID", { 0x3bd930fd, 0xf823, 0x4948, 0x86, 0x91, 0x98, 0xe6, 0xfe, 0x36, 0xac, 0xe2 } },
-    { "EFI_DMI_FORMAT_FRU_GUID", { 0x67ef7a73, 0x2594, 0x4a5e, 0x93, 0xa, 0xe1, 0x66, 0xfa, 0xbc, 0xd2, 0xc8 } },
-    { "EFI_DXE_CMOS_ACCESS_GUID", { 0x9851740c, 0x22e0, 0x440d, 0x90, 0x90, 0xef, 0x2d, 0x71, 0xc2, 0x51, 0xc9 } },
-    { "EFI_EMUL6064KBDINPUT_PROTOCOL_GUID", { 0x62ceef5a, 0x1d7c, 0x4943, 0x9b, 0x3a, 0x95, 0xe2, 0x49, 0x4c, 0x89, 0x90 } },
-    { "EFI_EMUL6064MSINPUT_PROTOCOL_GUID", { 0x7578b307, 0xb25b, 0x44f9, 0x89, 0x2e, 0x20, 0x9b, 0x0e, 0x39, 0x93, 0xc6 } },
-    { "EFI_EMUL6064TRAP_PROTOCOL_GUID", { 0x6ea0f71c, 0x614a, 0x437e, 0x8f, 0x49, 0x24, 0x3a, 0xd4, 0xe8, 0x32, 0x68 } },
-    { "EFI_GLOBAL_NVS_AREA_PROTOCOL_GUID", { 0x74e1e48, 0x8132, 0x47a1, 0x8c, 0x2c, 0x3f, 0x14, 0xad, 0x9a, 0x66, 0xdc } },
-    { "EFI_GPIO_PROTOCOL_GUID", { 0xb5d09084, 0x80ad, 0x4759, 0xb5, 0x1c, 0x27, 0x54, 0x8a, 0xfb, 0x8b, 0x8d } },
-    { "EFI_GUID_UNKNOWN", { 0x0f729f33, 0x25c1, 0x41a7, 0x86, 0xb2, 0x23, 0xa7, 0x37, 0xa9, 0x18, 0x23 } },
-    { "EFI_GUID_UNKNOWN1", { 0x142204e2, 0xc7b1, 0x4af9, 0xa7, 0x29, 0x92, 0x37, 0x58, 0xd9, 0x6d, 0x3 } },
-    { "EFI_GUID_UNKNOWN2", { 0x1E753E16, 0xDCEF, 0x47d0, 0x9A, 0x38, 0x7A, 0xDE, 0xCD, 0xB9, 0x83, 0xED } },
-    { "EFI_GUID_UNKNOWN3", { 0x45d68db9, 0x8b4e, 0x48c0, 0x99, 0xe9, 0xf2, 0x1f, 0x26, 0x2d, 0xb6, 0x53 } },
-    { "EFI_GUID_UNKNOWN4", { 0x4eaaaa1, 0x29a1, 0x11d7, 0x88, 0x38, 0x0, 0x50, 0x4, 0x73, 0xd4, 0xeb } },
-    { "EFI_GUID_UNKNOWN5", { 0x6298fe18, 0xd5ef, 0x42b7, 0xbb, 0xc, 0x29, 0x53, 0x28, 0x3f, 0x57, 0x4 } },
-    { "EFI_GUID_UNKNOWN6", { 0x7d113aa9, 0x6280, 0x48c6, 0xba, 0xce, 0xdf, 0xe7, 0x66, 0x8e, 0x83, 0x7 } },
-    { "EFI_GUID_UNKNOWN7", { 0x878AC2CC, 0x5343, 0x46F2, 0xB5, 0x63, 0x51, 0xF8, 0x9D, 0xAF, 0x56, 0xBA } },
-    { "EFI_GUID_UNKNOWN8", { 0x8983fd2d, 0x113c, 0x4e2b, 0x8f, 0x47, 0xa, 0xbf, 0xeb, 0x20, 0xa4, 0x1a } },
-    { "EFI_GUID_UNKNOWN9", { 0x8ff925f1, 0x8624, 0x4d38, 0x9e, 0xd2, 0xf8, 0xf5, 0xaa, 0x94, 0xf8, 0x4a } },
-    { "EFI_GUID_UNKNOWN10", { 0x9cc55d7d, 0xfbff, 0x431c, 0xbc, 0x14, 0x33, 0x4e, 0xae, 0xa6, 0x5, 0x2b } },
-    { "EFI_GUID_UNKNOWN11", { 0x9d7a05e9, 0xf740, 0x44c3, 0x85, 0x8b, 0x75, 0x58, 0x6a, 0x8f, 0x9c, 0x8e } },
-    { "EFI_GUID_UNKNOWN12", { 0x9fe7de69, 0xaea, 0x470a, 0xb5, 0xa, 0x13, 0x98, 0x13, 0x64, 0x91, 0x89 } },
-    { "EFI_GUID_UNKNOWN13", { 0xCC0F8A3F, 0x3DEA,  0x4376, 0x96, 0x79, 0x54, 0x26, 0xba, 0x0a, 0x90, 0x7e } },
-    { "EFI_GUID_UNKNOWN14", { 0xa6a72875, 0x2962, 0x4c18, 0x9f, 0x46, 0x8d, 0xa6, 0x44, 0xcc, 0xfe, 0x00 } },
-    { "EFI_GUID_UNKNOWN15", { 0xaa31bc6, 0x3379, 0x41e8, 0x82, 0x5a, 0x53, 0xf8, 0x2c, 0xc0, 0xf2, 0x54 } },
-    { "EFI_GUID_UNKNOWN16", { 0xabb74f50, 0xfd2d, 0x4072, 0xa3, 0x21, 0xca, 0xfc, 0x72, 0x97, 0x7e, 0xfa } },
-    { "EFI_GUID_UNKNOWN17", { 0xbb2f3c9d, 0xc7a1, 0x4283, 0x8a, 0xe2, 0x4f, 0x43, 0x62, 0x99, 0x0e, 0x2e } },
-    { "EFI_GUID_UNKNOWN18", { 0xc1bdd34e, 0x9ec0, 0x48aa, 0x80, 0x6a, 0x6c, 0x2e, 0xba, 0x0d, 0xc4, 0x45 } },
-    { "EFI_GUID_UNKNOWN19", { 0xedd35e31, 0x7b9,  0x11d2, 0x83, 0xa3, 0x00, 0xa0, 0xc9, 0x1f, 0xad, 0xcf } },
-    { "EFI_GUID_UNKNOWN20", { 0xf8e21975, 0x0899, 0x4f58, 0xa4, 0xbe, 0x55, 0x25, 0xa9, 0xc6, 0xd7, 0x7a } },
-    { "EFI_GUID_UNKNOWN21", { 0xfbf95065, 0x427f, 0x47b3, 0x80, 0x77, 0xd1, 0x3c, 0x60, 0x71, 0x9, 0x98 } },
-    { "EFI_HII_EXT_PROTOCOL_GUID", { 0x2a57ae75, 0x8b7a, 0x4c64, 0x86, 0x56, 0xdb, 0x51, 0xdd, 0xc3, 0x6f, 0x7b } },
-    { "EFI_HII_OLD_PROTOCOL_GUID", { 0xcd361957, 0xafbe, 0x425e, 0xa3, 0x58, 0x5f, 0x58, 0x89, 0xcf, 0xfe, 0x7b } },
-    { "EFI_HOT_KEYS_PROTOCOL_GUID", { 0xf1e48287, 0x3fe1, 0x4535, 0x89, 0xab, 0x48, 0xd6, 0xc3, 0xda, 0x27, 0x59 } },
-    { "EFI_HT_BIST_HOB_GUID", { 0xbe644001, 0xe7d4, 0x48b1, 0xb0, 0x96, 0x8b, 0xa0, 0x47, 0xbc, 0x7a, 0xe7 } },
-    { "EFI_IDER_CONTROLLER_DRIVER_PROTOCOL_GUID", { 0x956a2ed0, 0xa6cf, 0x409a, 0xb8, 0xf5, 0x35, 0xf1, 0x4c, 0x3e, 0x3c, 0x2 } },
-    { "EFI_INTEL_MFG_FORMAT_FRU_GUID", { 0x79e8c9c7, 0x1152, 0x4f00, 0xb8, 0x31, 0x14, 0xf1, 0xc4, 0x4, 0x1a, 0xe0 } },
-    { "EFI_IP_PROTOCOL_GUID", { 0x89DEEF37, 0x31D8, 0x469C, 0x95, 0xB6, 0x01, 0x69, 0xBC, 0x86, 0x6C, 0xFB } },
-    { "EFI_LEGACY_BIOS_EXT_PROTOCOL_GUID", { 0x8e008510, 0x9bb1, 0x457d, 0x9f, 0x70, 0x89, 0x7a, 0xba, 0x86, 0x5d, 0xb9 } },
-    { "EFI_LEGACY_SREDIR_PROTOCOL_GUID", { 0xA062CF1F, 0x8473, 0x4aa3, 0x87, 0x93, 0x60, 0x0B, 0xC4, 0xFF, 0xA9, 0xA9 } },
-    { "EFI_LIGHT_ISA_IO_PROTOCOL_GUID", { 0x7cc7ed80, 0x9a68, 0x4781, 0x80, 0xe4, 0xda, 0x16, 0x99, 0x10, 0x5a, 0xfe } },
-    { "EFI_MEMORY_CONFIG_DATA_GUID", { 0x80dbd530, 0xb74c, 0x4f11, 0x8c, 0x03, 0x41, 0x86, 0x65, 0x53, 0x28, 0x31 } },
-    { "EFI_MEMORY_SUBCLASS_DRIVER_GUID", { 0x1767CEED, 0xDB82, 0x47cd, 0xBF, 0x2B, 0x68, 0x45, 0x8A, 0x8C, 0xCF, 0xFF } },
-    { "EFI_MEMORY_TYPE_FRU_GUID", { 0xd50234f4, 0x6f4b, 0x43e8, 0xa0, 0x13, 0x3c, 0x1e, 0x33, 0xd9, 0xb9, 0xb1 } },
-    { "EFI_ME_BIOS_EXTENSION_SETUP_GUID", { 0x1bad711c, 0xd451, 0x4241, 0xb1, 0xf3, 0x85, 0x37, 0x81, 0x2e, 0xc, 0x70 } },
-    { "EFI_ME_FW_SKU_VARIABLE_GUID", { 0xe1a21d94, 0x4a20, 0x4e0e, 0xae, 0x9, 0xa9, 0xa2, 0x1f, 0x24, 0xbb, 0x9e } },
-    { "EFI_ME_RC_INFO_PROTOCOL_GUID", { 0x11fbfdfb, 0x10d2, 0x43e6, 0xb5, 0xb1, 0xb4, 0x38, 0x6e, 0xdc, 0xcb, 0x9a } },
-    { "EFI_MISC_SUBCLASS_DRIVER_GUID", { 0xF50E702C, 0x8653, 0x4CDE, 0xBB, 0xCE, 0x43, 0xB4, 0xD5, 0x5B, 0x34, 0xB8 } },
-    { "EFI_NB_ERROR_LOG_DISPATCH_PROTOCOL_GUID", { 0xff2d54d4, 0x5c55, 0x4c06, 0x85, 0x49, 0xc3, 0x62, 0x7c, 0xb8, 0xb9, 0x95 } },
-    { "EFI_NB_MRC_INFO_GUID", { 0xd7bd52b0, 0xb2dc, 0x4f08, 0xb4, 0x67, 0xde, 0x50, 0xd7, 0x28, 0xf6, 0xbd } },
-    { "EFI_NONSMMEMUL6064TRAP_PROTOCOL_GUID", { 0x68b81e51, 0x2583, 0x4582, 0x95, 0xdb, 0xc5, 0x72, 0x32, 0x36, 0xc4, 0xf1 } },
-    { "EFI_PCCARD_CS_PROTOCOL_GUID", { 0xca54f443, 0x1ef2, 0x4dab, 0x9e, 0x7e, 0x6d, 0xb7, 0xb7, 0x20, 0xb5, 0x87 } },
-    { "EFI_PCCARD_SS_PROTOCOL_GUID", { 0xc38e6d34, 0x5a7f, 0x4bf9, 0xbe, 0x57, 0x94, 0xdd, 0x30, 0x38, 0x02, 0x76 } },
-    { "EFI_PCH_INFO_PROTOCOL_GUID", { 0x984eb4e9, 0x5a95, 0x41de, 0xaa, 0xd0, 0x53, 0x66, 0x8c, 0xa5, 0x13, 0xc0 } },
-    { "EFI_PCH_S3_IMAGE_GUID", { 0x271dd6f2, 0x54cb, 0x45e6, 0x85, 0x85, 0x8c, 0x92, 0x3c, 0x1a, 0xc7, 0x6 } },
-    { "EFI_PCH_S3_SUPPORT_PROTOCOL_GUID", { 0xe287d20b, 0xd897, 0x4e1e, 0xa5, 0xd9, 0x97, 0x77, 0x63, 0x93, 0x6a, 0x4 } },
-    { "EFI_PCMCIA_REQUEST_PROTOCOL_GUID", { 0xf238f47c, 0x1de9, 0x4e8b, 0x81, 0xb9, 0xcc, 0x92, 0x4e, 0x6b, 0x5b, 0xe5 } },
-    { "EFI_PEI_AMI_KEYCODE_PPI_GUID", { 0x20b0f1c2, 0xb0d8, 0x4c5d, 0xaa, 0xd9, 0xf4, 0x45, 0x80, 0xdf, 0xdf, 0x8b } },
-    { "EFI_PEI_CAPSULE_PPI_GUID", { 0x66785b1, 0xedb8, 0x46dc, 0x84, 0x2f, 0x57, 0x44, 0x4, 0xb8, 0x69, 0x2f } },
-    { "EFI_PEI_CMOS_ACCESS_GUID", { 0xccbf2786, 0xcd6c, 0x4308, 0xbd, 0xfa, 0x62, 0x58, 0x70, 0xce, 0xbf, 0x81 } },
-    { "EFI_PEI_CONSPLIT_AMI_KEYCODE_PPI_GUID", { 0x73ddb5e1, 0x5fb4, 0x4751, 0xaf, 0x1e, 0x83, 0xcf, 0x75, 0xbe, 0xcb, 0xb6 } },
-    { "EFI_PEI_CORE_PRIVATE_GUID", { 0xd641a0f5, 0xcb7c, 0x4846, 0xa3, 0x80, 0x1d, 0x01, 0xb4, 0xd9, 0xe3, 0xb9 } },
-    { "EFI_PEI_LOADED_IMAGE_PPI_GUID", { 0xa62a3fff, 0x97f0, 0x4332, 0x8c, 0xfd, 0x1e, 0x34, 0x3d, 0x36, 0x31, 0xf2 } },
-    { "EFI_PEI_LOADED_IMAGE_PPI_GUID2", { 0xc1fcd448, 0x6300, 0x4458, 0xb8, 0x64, 0x28, 0xdf, 0x01, 0x53, 0x64, 0xbc } },
-    { "EFI_PEI_PLATFORMPEI_EXECUTED_PPI_GUID", { 0x8C72C36E, 0xDACC, 0x4E81, 0x8D, 0x60, 0xFF, 0xA6, 0x1D, 0x88, 0xFF, 0x54 } },
-    { "EFI_PLATFORM_GOP_POLICY_PROTOCOL_GUID", { 0xec2e931b, 0x3281, 0x48a5, 0x81, 0x7, 0xdf, 0x8a, 0x8b, 0xed, 0x3c, 0x5d } },
-    { "EFI_PLATFORM_INFO_PROTOCOL_GUID", { 0xd9035175, 0x8ce2, 0x47de, 0xa8, 0xb8, 0xcc, 0x98, 0xe5, 0xe2, 0xa8, 0x85 } },
-    { "EFI_POWER_ON_HOB_GUID", { 0x468a601, 0xc535, 0x46fd, 0xa9, 0x5d, 0xbb, 0xab, 0x99, 0x1b, 0x17, 0x8c } },
-    { "EFI_PPM_GLOBAL_NVS_AREA_PROTOCOL_GUID", { 0x6c50cdcb, 0x7f46, 0x4dcc, 0x8d, 0xdd, 0xd9, 0xf0, 0xa3, 0xc6, 0x11, 0x28 } },
-    { "EFI_PPM_INFO_PROTOCOL_GUID", { 0xd71db106, 0xe32d, 0x4225, 0xbf, 0xf4, 0xde, 0x6d, 0x77, 0x87, 0x17, 0x61 } },
-    { "EFI_SA_INFO_PROTOCOL_GUID", { 0x493b5bac, 0xbb9e, 0x4bf5, 0x83, 0x79, 0x20, 0xe2, 0xac, 0xa9, 0x85, 0x41 } },
-    { "EFI_SB_PCIE_ERROR_LOG_DISPATCH_PROTOCOL_GUID", { 0xf281fc6e, 0xf4c4, 0x431c, 0x96, 0x2b, 0x2f, 0x13, 0xae, 0x79, 0x84, 0xec } },
-    { "EFI_SEC_SMI_FLASH_GUID", { 0x3bf4af16, 0xab7c, 0x4b43, 0x89, 0x8d, 0xab, 0x26, 0xac, 0x5d, 0xdc, 0x6c } },
-    { "EFI_SERIAL_GPIO_PROTOCOL_GUID", { 0xf52c3858, 0x5ef8, 0x4d41, 0x83, 0x4e, 0xc3, 0x9e, 0xef, 0x8a, 0x45, 0xa3 } },
-    { "EFI_SIMPLE_AUDIO_OUT_PROTOCOL_GUID", { 0xc723f288, 0x52f9, 0x4d80, 0xb6, 0x33, 0xe1, 0x52, 0xf9, 0x30, 0xa0, 0xdc } },
-    { "EFI_SMBIOS_BOARD_PROTOCOL_GUID", { 0x903dd14, 0x2ca0, 0x458a, 0xb5, 0xeb, 0xc, 0xc, 0xa3, 0xd, 0x78, 0x5c } },
-    { "EFI_SMBIOS_DYNAMIC_DATA_GUID", { 0xe380280c, 0x4c35, 0x4aa3, 0xb9, 0x61, 0x7a, 0xe4, 0x89, 0xa2, 0xb9, 0x26 } },
-    { "EFI_SMBIOS_NVRAM_DATA_GUID", { 0x4b3082a3, 0x80c6, 0x4d7e, 0x9c, 0xd0, 0x58, 0x39, 0x17, 0x26, 0x5d, 0xf1 } },
-    { "EFI_SMBIOS_PROTOCOL_GUID", { 0x5e90a50d, 0x6955, 0x4A49, 0x90, 0x32, 0xda, 0x38, 0x12, 0xf8, 0xe8, 0xe5 } },
-    { "EFI_SMBIOS_STATIC_DATA_GUID", { 0xdaf4bf89, 0xce71, 0x4917, 0xb5, 0x22, 0xc8, 0x9d, 0x32, 0xfb, 0xc5, 0x9f } },
-    { "EFI_SMBUS_ARP_MAP_GUID", { 0x707be83e, 0x0bf6, 0x40A5, 0xbe, 0x64, 0x34, 0xc0, 0x3a, 0xa0, 0xb8, 0xe2 } },
-    { "EFI_SMM_BIOS_WRITE_DISPATCH_PROTOCOL_GUID", { 0xe512dfe4, 0xbf44, 0x480D, 0x9b, 0x7a, 0x77, 0x7b, 0x0b, 0xe3, 0x27, 0x75 } },
-    { "EFI_SMM_CMOS_ACCESS_GUID", { 0xe5d3026a, 0x1ca5, 0x40F0, 0x8f, 0xb6, 0x4b, 0x1a, 0xfa, 0x3c, 0x6e, 0xaa } },
-    { "EFI_SMM_ICHN_DISPATCH_EX_PROTOCOL_GUID", { 0x3920405b, 0xc897, 0x44DA, 0x88, 0xf3, 0x4c, 0x49, 0x8a, 0x6f, 0xf7, 0x36 } },
-    { "EFI_SMM_IO_TRAP_DISPATCH2_PROTOCOL_GUID", { 0xf1507845, 0x6494, 0x4377, 0xa1, 0x15, 0x45, 0xdf, 0xe6, 0x5f, 0x5d, 0x71 } },
-    { "EFI_SMM_IO_TRAP_DISPATCH_PROTOCOL_GUID", { 0xbd18369d, 0xc242, 0x45CA, 0x82, 0xad, 0x13, 0x8a, 0xc2, 0xe2, 0x9b, 0xab } },
-    { "EFI_SMM_IO_TRAP_DISPATCH_PROTOCOL_GUID", { 0xdb7f536b, 0xede4, 0x4714, 0xa5, 0xc8, 0xe3, 0x46, 0xeb, 0xaa, 0x20, 0x1d } },
-    { "EFI_SMM_RC_TO_APTIO_BRIDGE_GUID", { 0xfcdf7788, 0x7878, 0x11FF, 0xcc, 0x77, 0x88, 0xcc, 0xcc, 0x77, 0x88, 0xcc } },
-    { "EFI_SMM_RUNTIME_PROTOCOL_GUID", { 0xa56897a1, 0xa77f, 0x4600, 0x84, 0xdb, 0x22, 0xb0, 0xa8, 0x01, 0xfa, 0x9a } },
-    { "EFI_SMM_RUNTIME_SERVICES_TABLE_GUID", { 0x395c33fe, 0x287f, 0x413E, 0xa0, 0x55, 0x80, 0x88, 0xc0, 0xe1, 0xd4, 0x3e } },
-    { "EFI_SMM_SPI_PROTOCOL_GUID", { 0xd9072c35, 0xeb8f, 0x43AD, 0xa2, 0x20, 0x34, 0xd4, 0x0e, 0x2a, 0x82, 0x85 } },
-    { "EFI_SMM_SPI_PROTOCOL_GUID", { 0xaff3be49, 0x6d71, 0x421C, 0x92, 0x77, 0xa0, 0xb1, 0x50, 0x8e, 0x84, 0x7d } },
-    { "EFI_SMM_TCO_DISPATCH_PROTOCOL_GUID", { 0x0e2d6bb1, 0xc624, 0x446D, 0x99, 0x82, 0x69, 0x3c, 0xd1, 0x81, 0xa6, 0x07 } },
-    { "EFI_SMM_THUNK_PROTOCOL_GUID", { 0x2a82fce6, 0x8bb6, 0x413E, 0xb9, 0xeb, 0x45, 0xdf, 0xc0, 0x52, 0x2d, 0xf3 } },
-    { "EFI_SMM_VARIABLE_PROTOCOL_GUID", { 0x3025da01, 0xdc5f, 0x4F59, 0xbc, 0xc3, 0xb3, 0x77, 0xc8, 0x32, 0x5a, 0x4a } },
-    { "EFI_SMRAM_NVS_HEADER_GUID", { 0xec7f4fa1, 0xb217, 0x42FC, 0xa7, 0xf7, 0x02, 0x0c, 0x43, 0x05, 0xd5, 0xba } },
-    { "EFI_SMTP_PROTOCOL_GUID", { 0x5f67d40c, 0x1d06, 0x4E3E, 0x8b, 0x4a, 0xd2, 0x71, 0x3f, 0x46, 0xe1, 0xdc } },
-    { "EFI_SPEAKER_INTERFACE_PROTOCOL_GUID", { 0x400b4476, 0x3081, 0x11D6, 0x87, 0xed, 0x00, 0x06, 0x29, 0x45, 0xc3, 0xb9 } },
-    { "EFI_SPI_PROTOCOL_GUID", { 0x1156efc6, 0xea32, 0x4396, 0xb5, 0xd5, 0x26, 0x93, 0x2e, 0x83, 0xc3, 0x13 } },
-    { "EFI_SPI_PROTOCOL_GUID", { 0x01a660d9, 0x8009, 0x4330, 0xba, 0x89, 0x71, 0xb0, 0x76, 0xcd, 0x5d, 0x0a } },
-    { "EFI_STATUS_CODE_ARCH_PROTOCOL_GUID", { 0xd98e3ea3, 0x6f39, 0x4BE4, 0x82, 0xce, 0x5a, 0x89, 0x0c, 0xcb, 0x2c, 0x95 } },
-    { "EFI_SYSTEM_TYPE_FRU_GUID", { 0xaab16018, 0x679d, 0x4461, 0xba, 0x20, 0xe7, 0x0c, 0xf7, 0x86, 0x6a, 0x9b } },
-    { "EFI_TCG_LOG_HOB_GUID", { 0x5f7d4e0e, 0x3d6d, 0x42BC, 0xa9, 0x42, 0x0e, 0x91, 0xe8, 0x3e, 0x3c, 0x31 } },
-    { "EFI_TCG_WAKE_EVENT_DATA_HOB_GUID", { 0xbbb810bb, 0x5ef0, 0x4E8F, 0xb2, 0x98, 0xad, 0x74, 0xaa, 0x50, 0xef, 0x0a } },
-    { "EFI_TCP_SOCK_PROTOCOL_GUID", { 0x5187359b, 0x790d, 0x425B, 0xa5, 0x93, 0xca, 0x1c, 0xdb, 0x3c, 0xeb, 0xad } },
-    { "EFI_TDT_PROTOCOL_GUID", { 0x0bf70067, 0xd53b, 0x42DF, 0xb7, 0x70, 0xe9, 0x2c, 0x91, 0xc6, 0x14, 0x11 } },
-    { "EFI_TELNET_SERVER_PROTOCOL_GUID", { 0x6d3569d4, 0x85e5, 0x4943, 0xae, 0x46, 0xee, 0x67, 0xa6, 0xe1, 0xab, 0x5a } },
-    { "EFI_TIME_VARIABLE_GUID", { 0x9d0da369, 0x540b, 0x46F8, 0x85, 0xa0, 0x2b, 0x5f, 0x2c, 0x30, 0x1e, 0x15 } },
-    { "EFI_TPM_DEVICE_PROTOCOL_GUID", { 0xde161cfe, 0x1e60, 0x42A1, 0x8c, 0xc3, 0xee, 0x7e, 0xf0, 0x73, 0x52, 0x12 } },
-    { "EFI_TPM_STATE_INIT_HUB_GUID", { 0xa0c6d918, 0x8dee, 0x41BB, 0x9d, 0x92, 0x67, 0x53, 0xa5, 0x72, 0xb6, 0x52 } },
-    { "EFI_TXT_INFO_PROTOCOL_GUID", { 0x601211dc, 0x0b12, 0x4C09, 0xae, 0x27, 0xab, 0x0e, 0xc9, 0x69, 0x24, 0x68 } },
-    { "EFI_UDP_PROTOCOL_GUID", { 0xc56fb1b2, 0x017b, 0x4984, 0xa3, 0xf6, 0x3f, 0x73, 0x4f, 0xfa, 0x9e, 0x33 } },
-    { "EFI_USB_POLICY_PROTOCOL_GUID", { 0x5859cb76, 0x6bef, 0x468A, 0xbe, 0x2d, 0xb3, 0xdd, 0x1a, 0x27, 0xf0, 0x12 } },
-    { "EFI_USB_PROTOCOL_GUID", { 0x2ad8e2d2, 0x2e91, 0x4CD1, 0x95, 0xf5, 0xe7, 0x8f, 0xe5, 0xeb, 0xe3, 0x16 } },
-    { "ERROR_MANAGER_GUID", { 0xaddebf82, 0xa560, 0x46B9, 0xa2, 0x80, 0x78, 0xc6, 0xab, 0x61, 0xae, 0xda } },
-    { "EXIT_FORM_SET_GUID", { 0xa43b03dc, 0xc18a, 0x41B1, 0x91, 0xc8, 0x3f, 0xf9, 0xaa, 0xa2, 0x57, 0x13 } },
-    { "EXIT_PAGE_GUID", { 0xec87d643, 0xeba4, 0x4BB5, 0xa1, 0xe5, 0x3f, 0x3e, 0x36, 0xb2, 0x0d, 0xa9 } },
-    { "FAST_BOOT_TSE_PROTOCOL_GUID", { 0x0fba43b8, 0xacdb, 0x4EE2, 0xab, 0x31, 0x0f, 0xa4, 0xd5, 0xb6, 0xc3, 0xc5 } },
-    { "FAST_BOOT_VARIABLE_GUID", { 0xb540a530, 0x6978, 0x4DA7, 0x91, 0xcb, 0x72, 0x07, 0xd7, 0x64, 0xd2, 0x62 } },
-    { "FID_FFS_SECTION_GUID", { 0x2ebe0275, 0x6458, 0x4AF9, 0x91, 0xed, 0xd3, 0xf4, 0xed, 0xb1, 0x00, 0xaa } },
-    { "FID_TABLE_GUID", { 0x3fd1d3a2, 0x99f7, 0x420B, 0xbc, 0x69, 0x8b, 0xb1, 0xd4, 0x92, 0xa3, 0x32 } },
-    { "FID_TABLE_SECTION_GUID", { 0x2ebe0275, 0x6458, 0x4AF9, 0x91, 0xed, 0xd3, 0xf4, 0xed, 0xb1, 0x00, 0xaa } },
-    { "FIRMWARE_PERFORMANCE_PROTOCOL_GUID", { 0xbc412d75, 0x2729, 0x4C3A, 0xb1, 0x93, 0x5b, 0x9a, 0x58, 0x8f, 0xf6, 0x6f } },
-    { "FLASH_PROTOCOL_GUID", { 0x755b6596, 0x6896, 0x4BA3, 0xb3, 0xdd, 0x1c, 0x62, 0x9f, 0xd1, 0xea, 0x88 } },
-    { "FLASH_SMM_PROTOCOL_GUID", { 0xecb867ab, 0x8df4, 0x492D, 0x81, 0x50, 0xa7, 0xfd, 0x1b, 0x9b, 0x5a, 0x75 } },
-    { "FLASH_UPDATE_GUID", { 0x974231d5, 0xed4b, 0x44D1, 0x88, 0x70, 0xce, 0x51, 0x5c, 0xc1, 0x4d, 0x68 } },
-    { "FONT_FFS_FILE_GUID", { 0xdac2b117, 0xb5fb, 0x4964, 0xa3, 0x12, 0x0d, 0xcc, 0x77, 0x06, 0x1b, 0x9b } },
-    { "FPDT_PERFORMANCE_PROTOCOL_GUID", { 0x444c3203, 0xf8b1, 0x42A7, 0xab, 0xe9, 0x2e, 0x58, 0x02, 0x5b, 0xe1, 0x2a } },
-    { "FW_VERSION_GUID", { 0xb5c59087, 0xfeac, 0x4B41, 0x9d, 0x80, 0x79, 0x0b, 0xa5, 0xaa, 0x07, 0x0f } },
-    { "HDD_SECURITY_END_PROTOCOL_GUID", { 0xad77ae29, 0x4c20, 0x4FDD, 0x85, 0x04, 0x81, 0x76, 0x61, 0x9b, 0x67, 0x6a } },
-    { "HDD_SECURITY_INIT_PROTOCOL_GUID", { 0xce6f86bb, 0xb800, 0x4C71, 0xb2, 0xd1, 0x38, 0x97, 0xa3, 0xbc, 0x1d, 0xae } },
-    { "HDD_SMART_INIT_PROTOCOL_GUID", { 0x9401bd4f, 0x1a00, 0x4990, 0xab, 0x56, 0xda, 0xf0, 0xe4, 0xe3, 0x48, 0xde } },
-    { "HDD_UNLOCKED_GUID", { 0x1fd29be6, 0x70d0, 0x42A4, 0xa6, 0xe7, 0xe5, 0xd1, 0x0e, 0x6a, 0xc3, 0x76 } },
-    { "HECI_PROTOCOL_GUID", { 0xcfb33810, 0x6e87, 0x4284, 0xb2, 0x03, 0xa6, 0x6a, 0xbe, 0x07, 0xf6, 0xe8 } },
-    { "HII_RESOURCES_FFS_SECTION_GUID", { 0x97e409e6, 0x4cc1, 0x11D9, 0x81, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
-    { "ICC_OVERCLOCKING_PROTOCOL_GUID", { 0x8e8cbc58, 0x834c, 0x41E3, 0xb8, 0xca, 0xf0, 0x0c, 0xcf, 0x5a, 0x71, 0x7c } },
-    { "ICC_PERSISTENT_DATA_GUID", { 0x64192dca, 0xd034, 0x49D2, 0xa6, 0xde, 0x65, 0xa8, 0x29, 0xeb, 0x4c, 0x74 } },
-    { "ICC_VOLATILE_SETUP_DATA_GUID", { 0x7b77fb8b, 0x1e0d, 0x4D7E, 0x95, 0x3f, 0x39, 0x80, 0xa2, 0x61, 0xe0, 0x77 } },
-    { "IDE_BUS_DRIVER_BINDING_PROTOCOL_GUID", { 0x8aa67071, 0x8bec, 0x47AB, 0x83, 0xc8, 0xcd, 0x0e, 0xb7, 0x23, 0xd0, 0x72 } },
-    { "IDE_BUS_INIT_PROTOCOL_GUID", { 0xe159a956, 0x3299, 0x4EE9, 0x91, 0x76, 0x65, 0x18, 0x1a, 0x4e, 0x5e, 0x9f } },
-    { "IDE_CONTROLLER_PROTOCOL_GUID", { 0x20e28787, 0xdf32, 0x4BDA, 0xb7, 0xe7, 0xcb, 0xbd, 0xa3, 0x37, 0x1e, 0xf8 } },
-    { "IDE_HPA_INTERFACE_GUID", { 0x51aa65fc, 0x82b6, 0x49E6, 0x95, 0xe2, 0xe6, 0x82, 0x7a, 0x8d, 0x7d, 0xb4 } },
-    { "IDE_POWER_MGMT_INTERFACE_GUID", { 0x67bc3883, 0x7e79, 0x4BC1, 0xa3, 0x3e, 0x3a, 0xf7, 0xd1, 0x75, 0x89, 0xba } },
-    { "IDE_SECURITY_INTERFACE_GUID", { 0xf4f63529, 0x281e, 0x4040, 0xa3, 0x13, 0xc1, 0xd6, 0x76, 0x63, 0x84, 0xbe } },
-    { "IDE_SECURITY_PWNV_GUID", { 0x69967a8c, 0x1159, 0x4522, 0xaa, 0x89, 0x74, 0xcd, 0xc6, 0xe5, 0x99, 0xa0 } },
-    { "IDE_SETUP_PROTOCOL_GUID", { 0x5578ae16, 0xf1c9, 0x4E8F, 0xb1, 0x29, 0xba, 0x07, 0xf8, 0xfc, 0xf8, 0x4a } },
-    { "IDE_SMART_INTERFACE_GUID", { 0xffbd9ad2, 0xf1db, 0x4F92, 0xa6, 0x49, 0xeb, 0x9e, 0xed, 0xea, 0x86, 0xb5 } },
-    { "IFFS_ACPI_TABLE_STORAGE_GUID", { 0x60ac3a8f, 0x4d66, 0x4CD4, 0x89, 0x5a, 0xc3, 0xf0, 0x6e, 0x66, 0x65, 0xee } },
-    { "IFFS_GLOBAL_NVS_AREA_PROTOCOL_GUID", { 0xa5559f06, 0x6415, 0x4759, 0x88, 0x69, 0xde, 0x15, 0xf9, 0xcd, 0x9c, 0x9b } },
-    { "IFFS_GPT_GUID", { 0xd3bfe2de, 0x3daf, 0x11DF, 0xba, 0x40, 0xe3, 0xa5, 0x56, 0xd8, 0x95, 0x93 } },
-    { "IFFS_INFO_PROTOCOL_GUID", { 0xd231db5b, 0x4a9c, 0x4092, 0xa8, 0xc5, 0x9c, 0xa0, 0xbc, 0x7d, 0x6a, 0xa6 } },
-    { "IFFS_PARTITION_STATUS_PROTOCOL_GUID", { 0x65639144, 0xd492, 0x4328, 0xa4, 0x98, 0xf4, 0xb5, 0x54, 0x5e, 0x4a, 0x30 } },
-    { "IFFS_PERSISTENT_DATA_GUID", { 0xf9f0b131, 0xf346, 0x4F16, 0x80, 0xdd, 0xf9, 0x41, 0x07, 0x2b, 0x3a, 0x7d } },
-    { "IFFS_PLATFORM_POLICY_PROTOCOL_GUID", { 0x42bbaca3, 0x7161, 0x4891, 0xac, 0x10, 0xc7, 0x5e, 0x2e, 0x4d, 0xf6, 0x14 } },
-    { "IFFS_PPI_GUID", { 0x3d0e663a, 0xdc72, 0x4489, 0x87, 0xc5, 0xe4, 0x9e, 0xe7, 0x73, 0xa4, 0x52 } },
-    { "IGD_OPREGION_PROTOCOL_GUID", { 0xcdc5dddf, 0xe79d, 0x41EC, 0xa9, 0xb0, 0x65, 0x65, 0x49, 0x0d, 0xb9, 0xd3 } },
-    { "INTEL_MEBX_PROTOCOL_GUID", { 0x01ab1829, 0xcecd, 0x4CFA, 0xa1, 0x8c, 0xea, 0x75, 0xd6, 0x6f, 0x3e, 0x74 } },
-    { "MAIN_FORM_SET_GUID", { 0x985eee91, 0xbcac, 0x4238, 0x87, 0x78, 0x57, 0xef, 0xdc, 0x93, 0xf2, 0x4e } },
-    { "MDES_STATUS_CODE_PROTOCOL_GUID", { 0xe5d0875a, 0xf647, 0x4E16, 0xbe, 0x4d, 0x95, 0x02, 0x40, 0x29, 0xcc, 0x44 } },
-    { "MEBX_FILE_GUID", { 0x7c81c66a, 0x4f11, 0x47AB, 0x82, 0xd3, 0x67, 0xc4, 0xd6, 0x35, 0xae, 0xd1 } },
-    { "MEM_INFO_PROTOCOL_GUID", { 0x6f20f7c8, 0xe5ef, 0x4F21, 0x8d, 0x19, 0xed, 0xc5, 0xf0, 0xc4, 0x96, 0xae } },
-    { "MEUD_ERROR_GUID", { 0x0732bd39, 0xd6b0, 0x4039, 0xb6, 0xc2, 0x96, 0x54, 0x46, 0x6d, 0xe5, 0x25 } },
-    { "MEUD_FILE_GUID", { 0xfeaaa7a6, 0xcb95, 0x4670, 0xb4, 0x99, 0x87, 0x7f, 0xa6, 0xca, 0x6b, 0xae } },
-    { "ME_ALERT_AT_HANDLER_GUID", { 0xb441df87, 0x8d94, 0x4811, 0x85, 0xf7, 0x0f, 0x9a, 0x7b, 0xf8, 0x9d, 0x2a } },
-    { "ME_BIOS_PAYLOAD_DATA_PROTOCOL_GUID", { 0x71a19494, 0x2ab6, 0x4E96, 0x85, 0x81, 0xcf, 0x34, 0x25, 0x42, 0x73, 0xfe } },
-    { "ME_INFO_SETUP_GUID", { 0x78259433, 0x7b6d, 0x4DB3, 0x9a, 0xe8, 0x36, 0xc4, 0xc2, 0xc3, 0xa1, 0x7d } },
-    { "ME_PLATFORM_GET_RESET_TYPE_GUID", { 0xb8cdced7, 0xbdc4, 0x4464, 0x9a, 0x1a, 0xff, 0x3f, 0xbd, 0xf7, 0x48, 0x69 } },
-    { "MICROCODE_LOADER_PPI_GUID", { 0x9b6eecf6, 0xfbdc, 0x4DB6, 0x95, 0x62, 0xd2, 0x5f, 0x40, 0xd5, 0x76, 0x61 } },
-    { "MINI_SETUP_RESOURCE_SECTION_GUID", { 0x97e409e6, 0x4cc1, 0x11D9, 0x81, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } },
-    { "MXM30_PEI_GUID", { 0x2ef1ba1a, 0xc836, 0x4A50, 0xbf, 0x89, 0x52, 0x5f, 0xf2, 0x9f, 0xf7, 0x87 } },
-    { "MXM3_EFI_GUID", { 0x4ea9d4fe, 0xe6f6, 0x410B, 0x90, 0x37, 0x0f, 0x98, 0xb5, 0x96, 0x8b, 0x65 } },
-    { "MXMOEM1_GUID", { 0x6707536e, 0x46af, 0x42D3, 0x8f, 0x6c, 0x15, 0xf2, 0xf2, 0x02, 0xc2, 0x34 } },
-    { "NBCI_EFI_GUID", { 0x4ea9d4fe, 0xe6f6, 0x410B, 0x80, 0x37, 0x0f, 0x98, 0xb5, 0x96, 0x8b, 0x65 } },
-    { "NETWORK_STACK_GUID", { 0xd1405d16, 0x7afc, 0x4695, 0xbb, 0x12, 0x41, 0x45, 0x9d, 0x36, 0x95, 0xa2 } },
-    { "NVRAM_HOB_GUID", { 0xc0ec00fd, 0xc2f8, 0x4E47, 0x90, 0xef, 0x9c, 0x81, 0x55, 0x28, 0x5b, 0xec } },
-    { "NVRAM_MAILBOX_ADDRESS_VARIABLE_GUID", { 0x54913a6d, 0xf4ee, 0x4CDB, 0x84, 0x75, 0x74, 0x06, 0x2b, 0xfc, 0xec, 0xf5 } },
-    { "OEM_RECOVERY_CAPSULE_GUID", { 0x595a6edc, 0x6d2c, 0x474A, 0x90, 0x82, 0x3b, 0x99, 0x28, 0x51, 0xdf, 0xfe } },
-    { "OEM_ROM_HOLE_0_GUID", { 0x05ca01fc, 0x0fc1, 0x11DC, 0x90, 0x11, 0x00, 0x17, 0x31, 0x53, 0xeb, 0xa8 } },
-    { "OEM_ROM_HOLE_1_GUID", { 0x05ca01fd, 0x0fc1, 0x11DC, 0x90, 0x11, 0x00, 0x17, 0x31, 0x53, 0xeb, 0xa8 } },
-    { "OEM_TSE_VAR_GUID", { 0xf4b2c007, 0x94a1, 0x4CD5, 0xa7, 0x10, 0xf4, 0x14, 0x1f, 0xce, 0xbc, 0xa0 } },
-    { "ONBOARD_RAID_GUID", { 0x5d206dd3, 0x516a, 0x47DC, 0xa1, 0xbc, 0x6d, 0xa2, 0x04, 0xaa, 0xbe, 0x08 } },
-    { "OPAL_SEC_INIT_PROTOCOL_GUID", { 0x59af16b0, 0x661d, 0x4865, 0xa3, 0x81, 0x38, 0xde, 0x68, 0x38, 0x5d, 0x8d } },
-    { "OPROM_START_END_PROTOCOL_GUID", { 0xf2a128ff, 0x257b, 0x456E, 0x9d, 0xe8, 0x63, 0xe7, 0xc7, 0xdc, 0xdf, 0xac } },
-    { "PARTITION_VARIABLE_GUID", { 0x8db699cc, 0xbc81, 0x41E2, 0xaa, 0xc6, 0xd8, 0x1d, 0x53, 0x00, 0xd7, 0x59 } },
-    { "PASSWORD_HOB_GUID", { 0x79ce097a, 0x91aa, 0x41FF, 0xb3, 0xa8, 0x53, 0x45, 0x59, 0xb3, 0x0d, 0xb1 } },
-    { "PCH_DMI_TC_VC_PPI_GUID", { 0xed097352, 0x9041, 0x445A, 0x80, 0xb6, 0xb2, 0x9d, 0x50, 0x9e, 0x88, 0x45 } },
-    { "PCH_EFI_RAID_DRIVER_EXECUTION_GUID", { 0x99d5757c, 0xd906, 0x11E0, 0x8d, 0x78, 0x8d, 0xe4, 0x48, 0x24, 0x01, 0x9b } },
-    { "PCH_INIT_PPI_GUID", { 0xe8c7ce14, 0x1eed, 0x48FD, 0x83, 0x47, 0x8e, 0x55, 0x41, 0x10, 0xc0, 0xd9 } },
-    { "PCH_INIT_VARIABLE_GUID", { 0xe6c2f70a, 0xb604, 0x4877, 0x85, 0xba, 0xde, 0xec, 0x89, 0xe1, 0x17, 0xeb } },
-    { "PCH_ME_UMA_PPI_GUID", { 0x8c376010, 0x2400, 0x4D7D, 0xb4, 0x7b, 0x9d, 0x85, 0x1d, 0xf3, 0xc9, 0xd1 } },
-    { "PCH_PLATFORM_POLICY_PPI_GUID", { 0x22074e71, 0xbccc, 0x4517, 0x87, 0x57, 0x79, 0x95, 0xed, 0xfd, 0x80, 0x32 } },
-    { "PCH_RESET_CALLBACK_PROTOCOL_GUID", { 0x3a3300ab, 0xc929, 0x487D, 0xab, 0x34, 0x15, 0x9b, 0xc1, 0x35, 0x62, 0xc0 } },
-    { "PCH_RESET_PROTOCOL_GUID", { 0xdb63592c, 0xb8cc, 0x44C8, 0x91, 0x8c, 0x51, 0xf5, 0x34, 0x59, 0x8a, 0x5a } },
-    { "PCH_SATA_CONTROLLER_DRIVER_GUID", { 0xbb929da9, 0x68f7, 0x4035, 0xb2, 0x2c, 0xa3, 0xbb, 0x3f, 0x23, 0xda, 0x55 } },
-    { "PCH_USB_POLICY_PPI_GUID", { 0xc02b0573, 0x2b4e, 0x4A31, 0xa3, 0x1a, 0x94, 0x56, 0x7b, 0x50, 0x44, 0x2c } },
-    { "PEI_AMT_PLATFORM_POLICY_PPI_GUID", { 0xb4a1208e, 0x4d9a, 0x4EA2, 0x9d, 0x6b, 0xe4, 0x1a, 0x61, 0xe6, 0xc5, 0xac } },
-    { "PEI_AMT_STATUS_CODE_PPI_GUID", { 0x881807d2, 0x98d1, 0x4EC9, 0xaf, 0xa0, 0x77, 0x46, 0xc4, 0x2f, 0x24, 0x49 } },
-    { "PEI_AP_STARTUP_FILE_GUID", { 0xd1e59f50, 0xe8c3, 0x4545, 0xbf, 0x61, 0x11, 0xf0, 0x02, 0x23, 0x3c, 0x97 } },
-    { "PEI_ATA_CONTROLLER_PPI_GUID", { 0xa1e2176f, 0xcbda, 0x4F32, 0x87, 0x56, 0x7d, 0x7a, 0xe5, 0x22, 0xd6, 0x93 } },
-    { "PEI_ATA_POLICY_PPI_GUID", { 0x1b8ddea4, 0xdeb2, 0x4152, 0x91, 0xc2, 0xb7, 0x3c, 0xb1, 0x6c, 0xe4, 0x64 } },
-    { "PEI_BIOS_ACM_FILE_GUID", { 0x2d27c618, 0x7dcd, 0x41F5, 0xbb, 0x10, 0x21, 0x16, 0x6b, 0xe7, 0xe1, 0x43 } },
-    { "PEI_BOOT_SCRIPT_DONE_PPI_GUID", { 0xfd7c4665, 0x34be, 0x426B, 0xb1, 0xf8, 0x3a, 0xb7, 0x53, 0xce, 0x44, 0xb0 } },
-    { "PEI_CACHE_PPI_GUID", { 0x09be4bc2, 0x790e, 0x4DEA, 0x8b, 0xdc, 0x38, 0x05, 0x16, 0x98, 0x39, 0x44 } },
-    { "PEI_CACHE_PPI_GUID", { 0xc153205a, 0xe898, 0x4C24, 0x86, 0x89, 0xa4, 0xb4, 0xbc, 0xc5, 0xc8, 0xa2 } },
-    { "PEI_CPU_PLATFORM_POLICY_PPI_GUID", { 0x7b8ee7a1, 0x4e35, 0x4556, 0xbb, 0x56, 0x67, 0x97, 0xe2, 0x44, 0x45, 0xc2 } },
-    { "PEI_HECI_PPI_GUID", { 0xee0ea811, 0xfbd9, 0x4777, 0xb9, 0x5a, 0xba, 0x4f, 0x71, 0x10, 0x1f, 0x74 } },
-    { "PEI_IDE_RECOVERY_NATIVE_MODE_PPI_GUID", { 0x7e13637a, 0xc3f8, 0x43D1, 0xb0, 0x51, 0xed, 0x19, 0xd7, 0x08, 0xec, 0x7a } },
-    { "PEI_IFFS_TRANSITION_START_PPI_GUID", { 0xde8f2878, 0x36d5, 0x498E, 0xba, 0x59, 0x16, 0x8c, 0x26, 0x47, 0xb3, 0x35 } },
-    { "PEI_ME_PLATFORM_POLICY_PPI_GUID", { 0x7ae3ceb7, 0x2ee2, 0x48FA, 0xaa, 0x49, 0x35, 0x10, 0xbc, 0x83, 0xca, 0xbf } },
-    { "PEI_PLATFORM_MEMORY_RANGE_PPI_GUID", { 0x30eb2979, 0xb0f7, 0x4D60, 0xb2, 0xdc, 0x1a, 0x2c, 0x96, 0xce, 0xb1, 0xf4 } },
-    { "PEI_PLATFORM_MEMORY_SIZE_PPI_GUID", { 0x9a7ef41e, 0xc140, 0x4BD1, 0xb8, 0x84, 0x1e, 0x11, 0x24, 0x0b, 0x4c, 0xe6 } },
-    { "PEI_SMBUS_POLICY_PPI_GUID", { 0x63b6e435, 0x32bc, 0x49C6, 0x81, 0xbd, 0xb7, 0xa1, 0xa0, 0xfe, 0x1a, 0x6c } },
-    { "PEI_SPI_PPI_GUID", { 0x64e42e92, 0xe958, 0x4E99, 0x90, 0xe2, 0xf7, 0xfd, 0x90, 0xa7, 0x6c, 0x59 } },
-    { "PEI_TCG_INTERNAL_FLAGS_GUID", { 0x70fff0ff, 0xa543, 0x45B9, 0x8b, 0xe3, 0x1b, 0xdb, 0x90, 0x41, 0x20, 0x80 } },
-    { "PEI_TCG_PPI_GUID", { 0x177d39d2, 0x43b8, 0x40C8, 0x9a, 0xe1, 0x3c, 0x51, 0x98, 0xd6, 0x94, 0x1e } },
-    { "PEI_TPM_PPI_2_GUID", { 0xca4853f4, 0xe94b, 0x42B4, 0x86, 0x42, 0xcd, 0xe2, 0x8a, 0x7f, 0xac, 0x2d } },
-    { "PEI_TPM_PPI_GUID", { 0xca4853f4, 0xe94b, 0x42B4, 0x86, 0x42, 0xcd, 0xe2, 0x8a, 0x7f, 0xac, 0x2d } },
-    { "PEI_TXT_MEMORY_UNLOCKED_PPI_GUID", { 0x38cdd10b, 0x767d, 0x4F6E, 0xa7, 0x44, 0x67, 0xee, 0x1d, 0xfe, 0x2f, 0xa5 } },
-    { "PERF_TUNE_PPI_GUID", { 0xc49189f3, 0x1d4c, 0x4AD7, 0xa4, 0x39, 0xd0, 0x13, 0xab, 0x72, 0x09, 0x31 } },
-    { "PERF_TUNE_PROTOCOL_GUID", { 0xdd6c613a, 0x5a77, 0x4B4F, 0xa6, 0x1e, 0x3b, 0xdd, 0x2a, 0xe2, 0x1d, 0x81 } },
-    { "PERF_TUNE_WDT_PPI_GUID", { 0xa7c88fae, 0xebec, 0x45ED, 0xa7, 0xc5, 0x5f, 0xa7, 0x55, 0x17, 0x73, 0x06 } },
-    { "PERF_TUNE_WDT_PROTOCOL_GUID", { 0xc0557eed, 0x9a89, 0x4770, 0x96, 0x26, 0xfc, 0xa0, 0x51, 0xf2, 0xba, 0x09 } },
-    { "PKPUB_KEY_GUID", { 0xa6c0e11e, 0x929e, 0x42B3, 0x90, 0xcc, 0x4f, 0x77, 0x8e, 0x03, 0xff, 0x57 } },
-    { "PK_PUB_FFS_FILE_EFI_AUTH_VAR_GUID", { 0x9e625a27, 0x4840, 0x47CC, 0xa6, 0xb5, 0x1e, 0x93, 0x11, 0xcf, 0xc6, 0x0e } },
-    { "PLATFORM_IDE_PROTOCOL_GUID", { 0x6737f69b, 0xb8cc, 0x45BC, 0x93, 0x27, 0xcc, 0xf5, 0xee, 0xf7, 0x0c, 0xde } },
-    { "PLATFORM_ME_HOOK_PPI_GUID", { 0xe806424f, 0xd425, 0x4B1A, 0xbc, 0x26, 0x5f, 0x69, 0x03, 0x89, 0xa1, 0x5a } },
-    { "PLATFORM_ME_HOOK_PROTOCOL_GUID", { 0xbc52476e, 0xf67e, 0x4301, 0xb2, 0x62, 0x36, 0x9c, 0x48, 0x78, 0xaa, 0xc2 } },
-    { "POWER_MANAGEMENT_ACPI_TABLE_STORAGE_GUID", { 0x299141bb, 0x211a, 0x48A5, 0x92, 0xc0, 0x6f, 0x9a, 0x0a, 0x3a, 0x00, 0x6e } },
-    { "PPM_PLATFORM_POLICY_PROTOCOL_GUID", { 0x6f27e990, 0x7bc8, 0x42C9, 0x8f, 0x71, 0x99, 0x80, 0x06, 0x36, 0x93, 0xe9 } },
-    { "PPM_PROCESSOR_SUPPORT_PROTOCOL_3_GUID", { 0xa60c7dcd, 0x512f, 0x4F02, 0xb1, 0x80, 0x52, 0x2e, 0x01, 0x5e, 0x06, 0xb7 } },
-    { "PR_KEY_FFS_FILE_RAW_GUID", { 0x3feec852, 0xf14c, 0x4E7F, 0x97, 0xfd, 0x4c, 0x3a, 0x8c, 0x5b, 0xbe, 0xcc } },
-    { "PR_KEY_GUID", { 0x4e0f9bd4, 0xe338, 0x4B26, 0x84, 0x3e, 0xbd, 0x3a, 0xd9, 0xb2, 0x83, 0x7b } },
-    { "PTID_FFS_TABLE_STORAGE_GUID", { 0x95dfcae5, 0xbb28, 0x4D6B, 0xb1, 0xe2, 0x3a, 0xf3, 0xa6, 0xbf, 0x43, 0x4f } },
-    { "RECOVERY_FORM_SET_GUID", { 0x80e1202e, 0x2697, 0x4264, 0x9c, 0xc9, 0x80, 0x76, 0x2c, 0x3e, 0x58, 0x63 } },
-    { "ROM_CACHE_ENABLE_PPI_GUID", { 0x36e835bb, 0x661d, 0x4D37, 0x8d, 0xe5, 0x88, 0x53, 0x25, 0xda, 0xe9, 0x10 } },
-    { "ROM_IMAGE_ADDRESS_GUID", { 0xdde1bc72, 0xd45e, 0x4209, 0xab, 0x85, 0x14, 0x46, 0x2d, 0x2f, 0x50, 0x74 } },
-    { "ROM_IMAGE_MEMORY_HOB_GUID", { 0xee2f45d2, 0x5ba4, 0x441E, 0x8a, 0x1d, 0xaa, 0x22, 0xdf, 0xa3, 0xb6, 0xc5 } },
-    { "ROM_LAYOUT_FFS_GUID", { 0x0dca793a, 0xea96, 0x42D8, 0xbd, 0x7b, 0xdc, 0x7f, 0x68, 0x4e, 0x38, 0xc1 } },
-    { "ROM_LAYOUT_SECTION_GUID", { 0x88a15a4f, 0x977d, 0x4682, 0xb1, 0x7c, 0xda, 0x1f, 0x31, 0x6c, 0x1f, 0x32 } },
-    { "RSDP_PLUS_PROTOCOL_GUID", { 0xa33319b5, 0x8ee1, 0x45E0, 0x8c, 0x9f, 0x80, 0x9f, 0x5b, 0x09, 0x02, 0xcc } },
-    { "SATA_CONTROLLER_PROTOCOL_GUID", { 0x2acb6627, 0xdf02, 0x4E23, 0xb4, 0xf9, 0x6a, 0x93, 0xfa, 0x6e, 0x9d, 0xa6 } },
-    { "SA_PEG_DATA_HOB_GUID", { 0x5f5d3502, 0x8a4b, 0x40CA, 0x88, 0xa2, 0x23, 0x05, 0x42, 0x7a, 0x13, 0x1a } },
-    { "SA_PEG_DATA_VARIABLE_GUID", { 0xc4975200, 0x64f1, 0x4FB6, 0x97, 0x73, 0xf6, 0xa9, 0xf8, 0x9d, 0x98, 0x5e } },
-    { "SA_PEI_INIT_PPI_GUID", { 0x09ea8911, 0xbe0d, 0x4230, 0xa0, 0x03, 0xed, 0xc6, 0x93, 0xb4, 0x8e, 0x11 } },
-    { "SA_PLATFORM_POLICY_PPI_GUID", { 0x150ce416, 0xee63, 0x46B6, 0x8b, 0xa3, 0x73, 0x22, 0xbb, 0xe0, 0x46, 0x37 } },
-    { "SECURITY_FORM_SET_GUID", { 0x981ceaee, 0x931c, 0x4A17, 0xb9, 0xc8, 0x66, 0xc7, 0xbc, 0xfd, 0x77, 0xe1 } },
-    { "SERIAL_RECOVERY_CAPSULE_GUID", { 0x699add70, 0x8554, 0x4993, 0x83, 0xf6, 0xd2, 0xcd, 0xc0, 0x81, 0xdd, 0x85 } },
-    { "SETUP_DEFAULTS_FFS_GUID", { 0x9221315b, 0x30bb, 0x46B5, 0x81, 0x3e, 0x1b, 0x1b, 0xf4, 0x71, 0x2b, 0xd3 } },
-    { "SETUP_GUID", { 0xec87d643, 0xeba4, 0x4BB5, 0xa1, 0xe5, 0x3f, 0x3e, 0x36, 0xb2, 0x0d, 0xa9 } },
-    { "SGOEM_ACPI_SSDT_GUID", { 0x5b232086, 0x350a, 0x42C7, 0xa7, 0x0e, 0x34, 0x97, 0xb5, 0x76, 0x5d, 0x85 } },
-    { "SGTPV_ACPI_SSDT_GUID", { 0x6a061113, 0xfe54, 0x4A07, 0xa2, 0x8e, 0x0a, 0x69, 0x35, 0x9e, 0xb0, 0x69 } },
-    { "SG_ACPI_TABLE_STORAGE_GUID", { 0xcacb3817, 0x81e6, 0x497E, 0x87, 0xff, 0xc8, 0xfa, 0x8f, 0x24, 0xec, 0x28 } },
-    { "SG_INFO_HOB_GUID", { 0x648ce07b, 0xae5d, 0x4973, 0xbd, 0x3c, 0x8c, 0x91, 0x53, 0xc0, 0x5d, 0xc5 } },
-    { "SG_PEI_INIT_PPI_GUID", { 0xaa40d00e, 0x5b9b, 0x4DAD, 0xa4, 0x87, 0xfc, 0x1b, 0xcb, 0xef, 0x81, 0x70 } },
-    { "SG_PLATFORM_POLICY_PPI_GUID", { 0xa391e822, 0x7044, 0x4CF4, 0xbe, 0x5b, 0x34, 0x5e, 0x44, 0xb8, 0x62, 0x7c } },
-    { "SIO_DEV_STATUS_VAR_GUID", { 0x5820de98, 0xfc8e, 0x4B0B, 0xa4, 0xb9, 0x0a, 0x94, 0x0d, 0x16, 0x2a, 0x7e } },
-    { "SMBIOS_FLASH_DATA_FFS_GUID", { 0xfd44820b, 0xf1ab, 0x41C0, 0xae, 0x4e, 0x0c, 0x55, 0x55, 0x6e, 0xb9, 0xbd } },
-    { "SMM_CHILD_DISPATCHER2_GUID", { 0x950c3a26, 0xe0c2, 0x491C, 0xb6, 0xb2, 0x03, 0x74, 0xf5, 0xc7, 0x3b, 0x96 } },
-    { "SMRAM_CPU_DATA_HEADER_GUID", { 0x5848fd2d, 0xd6af, 0x474B, 0x82, 0x75, 0x95, 0xdd, 0xe7, 0x0a, 0xe8, 0x23 } },
-    { "SMRAM_CPU_DATA_VARIABLE_GUID", { 0x429501d9, 0xe447, 0x40F4, 0x86, 0x7b, 0x75, 0xc9, 0x3a, 0x1d, 0xb5, 0x4e } },
-    { "SM_BUS_CONTROLLER_IDENTIFIER_GUID", { 0x882f2546, 0xef1f, 0x4090, 0x9f, 0x9c, 0x93, 0x84, 0x5a, 0xd7, 0x84, 0x1c } },
-    { "SYSTEM_ACCESS_GUID", { 0xe770bb69, 0xbcb4, 0x4D04, 0x9e, 0x97, 0x23, 0xff, 0x94, 0x56, 0xfe, 0xac } },
-    { "TCG_INTERNAL_FLAGS_GUID", { 0x70fff0ff, 0xa543, 0x45B9, 0x8b, 0xe3, 0x1b, 0xdb, 0x90, 0x41, 0x20, 0x80 } },
-    { "TCG_LOCK_DOWN_VAR_GUID", { 0x6e605536, 0xa30a, 0x4D56, 0x93, 0x9e, 0x1c, 0x37, 0x3f, 0x79, 0x8d, 0x7b } },
-    { "TCG_PLATFORM_SETUP_PEI_POLICY_GUID", { 0xa76b4e22, 0xb50a, 0x401D, 0x8b, 0x35, 0x51, 0x24, 0xb0, 0xba, 0x41, 0x04 } },
-    { "TCG_PLATFORM_SETUP_POLICY_GUID", { 0xbb6cbeff, 0xe072, 0x40D2, 0xa6, 0xeb, 0xba, 0xb7, 0x5b, 0xde, 0x87, 0xe7 } },
-    { "TCG_PPI_SYNC_FLAG_GUID", { 0xf3ed95df, 0x828e, 0x41C7, 0xbc, 0xa0, 0x16, 0xc4, 0x19, 0x65, 0xa6, 0x34 } },
-    { "TDTHI_PROTOCOL_FIXED_GUID", { 0xfa8f55e8, 0xab22, 0x42DD, 0xb9, 0x16, 0x7d, 0xce, 0x39, 0x00, 0x25, 0x74 } },
-    { "TDTHI_PROTOCOL_GUID", { 0x3c4852d6, 0xd47b, 0x4F46, 0xb0, 0x5e, 0xb5, 0xed, 0xc1, 0xaa, 0x43, 0x0a } },
-    { "TDT_VOLATILE_SETUP_DATA_GUID", { 0x7b77fb8b, 0x1e0d, 0x4D7E, 0x95, 0x3f, 0x39, 0x80, 0xa2, 0x61, 0xe0, 0x76 } },
-    { "TERMINAL_VAR_GUID", { 0x560bf58a, 0x1e0d, 0x4D7E, 0x95, 0x3f, 0x29, 0x80, 0xa2, 0x61, 0xe0, 0x31 } },
-    { "TPM_BOOT_FLOW_VARIABLE_GUID", { 0xb6460a49, 0x0ac1, 0x484F, 0xae, 0x58, 0xf1, 0x6e, 0xb2, 0x39, 0xdb, 0x3d } },
-    { "TXT_INFO_HOB_GUID", { 0x2986883f, 0x88e0, 0x48D0, 0x4b, 0x82, 0x20, 0xc2, 0x69, 0x48, 0xdd, 0xac } },
-    { "TXT_ONE_TOUCH_GUID", { 0x3d989471, 0xcfac, 0x46B7, 0x9b, 0x1c, 0x08, 0x43, 0x01, 0x09, 0x40, 0x2d } },
-    { "TXT_ONE_TOUCH_OP_PROTOCOL_GUID", { 0xfa2338ad, 0x80df, 0x49D0, 0x93, 0x96, 0xcf, 0x71, 0x45, 0xd0, 0x3a, 0x76 } },
-    { "USB_TIMING_POLICY_PROTOCOL_GUID", { 0x89e3c1dc, 0xb5e3, 0x4D34, 0xae, 0xad, 0xdd, 0x7e, 0xb2, 0x82, 0x8c, 0x18 } }, 
-    { "USER_DEFAULTS_GUID", { 0xc4cc0de8, 0x0687, 0x4422, 0x99, 0xc1, 0x65, 0x35, 0x1a, 0x5d, 0x5f, 0x95 } }, 
-    { "WDT_APP_PROTOCOL_GUID", { 0x92c7d0bb, 0x679e, 0x479D, 0x87, 0x8d, 0xd4, 0xb8, 0x29, 0x68, 0x57, 0x8b } }, 
-    { "WDT_HOB_GUID", { 0x65675786, 0xacca, 0x4B11, 0x8a, 0xb7, 0xf8, 0x43, 0xaa, 0x2a, 0x8b, 0xea } }, 
-    { "WDT_PERSISTENT_DATA_GUID", { 0x78ce2354, 0xcfbc, 0x4643, 0xae, 0xba, 0x07, 0xa2, 0x7f, 0xa8, 0x92, 0xbf } }, 
-    { "WDT_PPI_GUID", { 0xf38d1338, 0xaf7a, 0x4FB6, 0x91, 0xdb, 0x1a, 0x9c, 0x21, 0x83, 0x57, 0x0d } }, 
-    { "WDT_PROTOCOL_GUID", { 0xb42b8d12, 0x2acb, 0x499A, 0xa9, 0x20, 0xdd, 0x5b, 0xe6, 0xcf, 0x09, 0xb1 } },
-    { "APP_PKG_TOKEN_SPACE", { 0xe7e1efa6, 0x7607, 0x4A78, 0xa7, 0xdd, 0x43, 0xe4, 0xbd, 0x72, 0xc0, 0x99 } },
-    { "ARM_JUNO_TOKEN_SPACE", { 0xa1147a20, 0x3144, 0x4F8D, 0x82, 0x95, 0xb4, 0x83, 0x11, 0xc8, 0xe4, 0xa4 } },
-    { "ARM_TOKEN_SPACE", { 0xbb11ecfe, 0x820f, 0x4968, 0xbb, 0xa6, 0xf7, 0x6a, 0xfe, 0x30, 0x25, 0x96 } },
-    { "ARM_PLATFORM_TOKEN_SPACE", { 0x9c0aaed4, 0x74c5, 0x4043, 0xb4, 0x17, 0xa3, 0x22, 0x38, 0x14, 0xce, 0x76 } },
-    { "ARM_BOOT_MON_FS_FILE_INFO", { 0x41e26b9c, 0xada6, 0x45B3, 0x80, 0x8e, 0x23, 0x57, 0xa3, 0x5b, 0x60, 0xd6 } },
-    { "ARM_PLATFORM_UPDATE_FDT_EVENT", { 0xaffe115b, 0x8589, 0x456D, 0xba, 0xb5, 0x8f, 0x2e, 0xda, 0x53, 0xae, 0xb7 } },
-    { "ARM_REAL_VIEW_EB_PKG_TOKEN_SPACE", { 0x44577a0d, 0x361a, 0x45B2, 0xb3, 0x3d, 0xbb, 0x9e, 0xe6, 0x0d, 0x5a, 0x4f } },
-    { "ARM_VEXPRESS_TOKEN_SPACE", { 0x9c0aaed4, 0x74c5, 0x4043, 0xb4, 0x17, 0xa3, 0x22, 0x38, 0x14, 0xce, 0x76 } },
-    { "ARM_VIRTUALIZATION_TOKEN_SPACE", { 0x0b6f5ca7, 0x4f53, 0x445A, 0xb7, 0x6e, 0x2e, 0x36, 0x5b, 0x80, 0x63, 0x66 } },
-    { "EARLY_PL011_BASE_ADDRESS", { 0xb199dea9, 0xfd5c, 0x4A84, 0x80, 0x82, 0x2f, 0x41, 0x70, 0x78, 0x03, 0x05 } },
-    { "BEAGLE_BOARD_TOKEN_SPACE", { 0x6834fe45, 0x4aee, 0x4FC6, 0xbc, 0xb5, 0xff, 0x45, 0xb7, 0xa8, 0x71, 0xe2 } },
-    { "EFI_ACPI_DESCRIPTION", { 0x3c699197, 0x093c, 0x4C69, 0xb0, 0x6b, 0x12, 0x8a, 0xe3, 0x48, 0x1d, 0xc9 } },
-    { "EFI_FLASH_MAP_HOB", { 0xb091e7d2, 0x05a0, 0x4198, 0x94, 0xf0, 0x74, 0xb7, 0xb8, 0xc5, 0x54, 0x59 } },
-    { "EFI_SMM_BASE_THUNK_COMMUNICATION", { 0x6568a3d6, 0x015f, 0x4B4A, 0x9c, 0x89, 0x1d, 0x14, 0x63, 0x14, 0x13, 0x0a } },
-    { "EFI_BOOT_STATE", { 0x60b5e939, 0x0fcf, 0x4227, 0xba, 0x83, 0x6b, 0xbe, 0xd4, 0x5b, 0xc0, 0xe3 } },
-    { "EFI_EDK_COMPATIBILITY_PKG_TOKEN_SPACE", { 0x2354d320, 0x3eb3, 0x4C81, 0x99, 0xf4, 0xcc, 0x4a, 0xe1, 0x43, 0x46, 0x3e } },
-    { "EMBEDDED_TOKEN_SPACE", { 0xe0d8ca17, 0x4276, 0x4386, 0xbb, 0x79, 0x48, 0xcb, 0x81, 0x3d, 0x3c, 0x4f } },
-    { "FDT_TABLE", { 0xb1b621d5, 0xf19c, 0x41A5, 0x83, 0x0b, 0xd9, 0x15, 0x2c, 0x69, 0xaa, 0xe0 } },
-    { "HARDWARE_INTERRUPT_PROTOCOL", { 0x2890b3ea, 0x053d, 0x1643, 0xad, 0x0c, 0xd6, 0x48, 0x08, 0xda, 0x3f, 0xf1 } },
-    { "EMBEDDED_GPIO_PROTOCOL", { 0x17a0a3d7, 0xc0a5, 0x4635, 0xbb, 0xd5, 0x07, 0x21, 0x87, 0xdf, 0xe2, 0xee } },
-    { "ANDROID_FASTBOOT_TRANSPORT_PROTOCOL", { 0x74bd9fe0, 0x8902, 0x11E3, 0xb9, 0xd3, 0xf7, 0x22, 0x38, 0xfc, 0x9a, 0x31 } },
-    { "ANDROID_FASTBOOT_PLATFORM_PROTOCOL", { 0x524685a0, 0x89a0, 0x11E3, 0x9d, 0x4d, 0xbf, 0xa9, 0xf6, 0xa4, 0x03, 0x08 } },
-    { "USB_DEVICE_PROTOCOL", { 0x021bd2ca, 0x51d2, 0x11E3, 0x8e, 0x56, 0xb7, 0x54, 0x17, 0xc7, 0x0b, 0x44 } },
-    { "EMU_THREAD_THUNK_PROTOCOL", { 0x3b1e4b7c, 0x09d8, 0x944F, 0xa4, 0x08, 0x13, 0x09, 0xeb, 0x8b, 0x44, 0x27 } },
-    { "EMU_THUNK_PPI", { 0xe113f896, 0x75cf, 0xF640, 0x81, 0x7f, 0xc8, 0x5a, 0x79, 0xe8, 0xae, 0x67 } },
-    { "EMULATOR_PKG_TOKEN_SPACE", { 0x4f792e68, 0xe8c8, 0x794E, 0xb1, 0xd8, 0x37, 0x03, 0xf3, 0xf2, 0xd5, 0xa5 } },
-    { "EMU_SYSTEM_CONFIG", { 0xf8626165, 0x6ceb, 0x924A, 0xba, 0xfc, 0xf1, 0x3a, 0xb9, 0xd6, 0x57, 0x28 } },
-    { "EXIT_PM_AUTH_PROTOCOL", { 0xd088a413, 0x0a70, 0x4217, 0xba, 0x55, 0x9a, 0x3c, 0xb6, 0x5c, 0x41, 0xb3 } },
-    { "EFI_SMM_PEI_SMRAM_MEMORY_RESERVE", { 0x6dadf1d1, 0xd4cc, 0x4910, 0xbb, 0x6e, 0x82, 0xb1, 0xfd, 0x80, 0xff, 0x3d } },
-    { "EFI_PEI144_FLOPPY_BLOCK_IO_PPI", { 0xda6855bd, 0x07b7, 0x4C05, 0x9e, 0xd8, 0xe2, 0x59, 0xfd, 0x36, 0x0e, 0x22 } },
-    { "EFI_PEI_FV_FILE_LOADER_PPI", { 0x7e1f0d85, 0x04ff, 0x4BB2, 0x86, 0x6a, 0x31, 0xa2, 0x99, 0x6a, 0x48, 0xa8 } },
-    { "INTEL_FSP_PKG_TOKEN_SPACE", { 0x834c0c5f, 0xadb3, 0x4372, 0xae, 0xeb, 0x03, 0xe4, 0xe9, 0xe6, 0xc5, 0x91 } },
-    { "FSP_HEADER_FILE", { 0x912740be, 0x2284, 0x4734, 0xb9, 0x71, 0x84, 0xb0, 0x27, 0x35, 0x3f, 0x0c } },
-    { "FSP_BOOT_LOADER_TEMPORARY_MEMORY", { 0xbbcff46c, 0xc8d3, 0x4113, 0x89, 0x85, 0xb9, 0xd4, 0xf3, 0xb3, 0xf6, 0x4e } },
-    { "FSP_RESERVED_MEMORY_RESOURCE_HOB", { 0x69a79759, 0x1373, 0x4367, 0xa6, 0xc4, 0xc7, 0xf5, 0x9e, 0xfd, 0x98, 0x6e } },
-    { "FSP_NON_VOLATILE_STORAGE_HOB", { 0x721acf02, 0x4d77, 0x4C2A, 0xb3, 0xdc, 0x27, 0x0b, 0x7b, 0xa9, 0xe4, 0xb0 } },
-    { "FSP_RESERVED_MEMORY_RESOURCE_HOB_TSEG", { 0xd038747c, 0xd00c, 0x4980, 0xb3, 0x19, 0x49, 0x01, 0x99, 0xa4, 0x7d, 0x55 } },
-    { "FSP_RESERVED_MEMORY_RESOURCE_HOB_GFX", { 0x9c7c3aa7, 0x5332, 0x4917, 0x82, 0xb9, 0x56, 0xa5, 0xf3, 0xe6, 0x2a, 0x07 } },
-    { "FSP_RESERVED_MEMORY_RESOURCE_HOB_MISC", { 0x00d6b14b, 0x7dd0, 0x4062, 0x88, 0x21, 0xe5, 0xf9, 0x6a, 0x2a, 0x1b, 0x00 } },
-    { "FSP_WRAPPER_TOKEN_SPACE", { 0x2bc1c74a, 0x122f, 0x40B2, 0xb2, 0x23, 0x08, 0x2b, 0x74, 0x65, 0x22, 0x5d } },
-    { "FSP_INIT_DONE_PPI", { 0xf5ef05e4, 0xd538, 0x4774, 0x8f, 0x1b, 0xe9, 0x77, 0x30, 0x11, 0xe0, 0x38 } },
-    { "TOP_OF_TEMPORARY_RAM_PPI", { 0x2f3962b2, 0x57c5, 0x44EC, 0x9e, 0xfc, 0xa6, 0x9f, 0xd3, 0x02, 0x03, 0x2b } },
-    { "PCD_DATA_BASE_SIGNATURE", { 0x3c7d193c, 0x682c, 0x4C14, 0xa6, 0x8f, 0x55, 0x2d, 0xea, 0x4f, 0x43, 0x7e } },
-    { "EDKII_WORKING_BLOCK_SIGNATURE", { 0x9e58292b, 0x7c68, 0x497D, 0xa0, 0xce, 0x65, 0x00, 0xfd, 0x9f, 0x1b, 0x95 } },
-    { "EDKII_FAULT_TOLERANT_WRITE", { 0x1d3e9cb8, 0x43af, 0x490B, 0x83, 0x0a, 0x35, 0x16, 0xaa, 0x53, 0x20, 0x47 } },
-    { "USB_KEYBOARD_LAYOUT_KEY", { 0x3a4d7a7c, 0x018a, 0x4B42, 0x81, 0xb3, 0xdc, 0x10, 0xe3, 0xb5, 0x91, 0xbd } },
-    { "FIRMWARE_PERFORMANCE_S3_POINTER", { 0x0dc65adc, 0xa973, 0x4130, 0x8d, 0xf0, 0x2a, 0xdb, 0xeb, 0x9e, 0x4a, 0x31 } },
-    { "EVENT_EXIT_BOOT_SERVICES_FAILED", { 0x4f6c5507, 0x232f, 0x4787, 0xb9, 0x5e, 0x72, 0xf8, 0x62, 0x49, 0x0c, 0xb1 } },
-    { "EDKII_STATUS_CODE_DATA_TYPE_VARIABLE", { 0xf6ee6dbb, 0xd67f, 0x4EA0, 0x8b, 0x96, 0x6a, 0x71, 0xb1, 0x9d, 0x84, 0xad } },
-    { "EDKII_MEMORY_PROFILE", { 0x821c9a09, 0x541a, 0x40F6, 0x9f, 0x43, 0x0a, 0xd1, 0x93, 0xa1, 0x2c, 0xfe } },
-    { "EDKII_VAR_ERROR_FLAG", { 0x04b37fe8, 0xf6ae, 0x480B, 0xbd, 0xd5, 0x37, 0xd9, 0x8c, 0x5e, 0x89, 0xaa } },
-    { "PEI_USB2_HOST_CONTROLLER_PPI", { 0xfedd6305, 0xe2d7, 0x4ED5, 0x9f, 0xaa, 0xda, 0x08, 0x0e, 0x33, 0x6c, 0x22 } },
-    { "PEI_POST_SCRIPT_TABLE_PPI", { 0x88c9d306, 0x0900, 0x4EB5, 0x82, 0x60, 0x3e, 0x2d, 0xbe, 0xda, 0x1f, 0x89 } },
-    { "PEI_SERIAL_PORT_PPI", { 0x490e9d85, 0x8aef, 0x4193, 0x8e, 0x56, 0xf7, 0x34, 0xa9, 0xff, 0xac, 0x8b } },
-    { "EDKII_VARIABLE_LOCK_PROTOCOL", { 0xcd3d0a05, 0x9e24, 0x437C, 0xa8, 0x91, 0x1e, 0xe0, 0x53, 0xdb, 0x76, 0x38 } },
-    { "EDKII_VAR_CHECK_PROTOCOL", { 0xaf23b340, 0x97b4, 0x4685, 0x8d, 0x4f, 0xa3, 0xf2, 0x81, 0x69, 0xb2, 0x1d } },
-    { "EDKII_SMM_VAR_CHECK_PROTOCOL", { 0xb0d8f3c1, 0xb7de, 0x4C11, 0xbc, 0x89, 0x2f, 0xb5, 0x62, 0xc8, 0xc4, 0x11 } },
-    { "EDKII_FORM_DISPLAY_ENGINE_PROTOCOL", { 0x9bbe29e9, 0xfda1, 0x41EC, 0xad, 0x52, 0x45, 0x22, 0x13, 0x74, 0x2d, 0x2e } },
-    { "EDKII_FORM_BROWSER_EX2_PROTOCOL", { 0xa770c357, 0xb693, 0x4E6D, 0xa6, 0xcf, 0xd2, 0x1c, 0x72, 0x8e, 0x55, 0x0b } },
-    { "EFI_FILE_INFO", { 0x09576e92, 0x6d3f, 0x11D2, 0x8e, 0x39, 0x00, 0xa0, 0xc9, 0x69, 0x72, 0x3b } },
-    { "EFI_EVENT_READY_TO_BOOT", { 0x7ce88fb3, 0x4bd7, 0x4679, 0x87, 0xa8, 0xa8, 0xd8, 0xde, 0xe5, 0x0d, 0x2b } },
-    { "EFI_EVENT_MEMORY_MAP_CHANGE", { 0x78bee926, 0x692f, 0x48FD, 0x9e, 0xdb, 0x01, 0x42, 0x2e, 0xf0, 0xd7, 0xab } },
-    { "EFI_EVENT_VIRTUAL_ADDRESS_CHANGE", { 0x13fa7698, 0xc831, 0x49C7, 0x87, 0xea, 0x8f, 0x43, 0xfc, 0xc2, 0x51, 0x96 } },
-    { "EFI_EVENT_EXIT_BOOT_SERVICES", { 0x27abf055, 0xb1b8, 0x4C26, 0x80, 0x48, 0x74, 0x8f, 0x37, 0xba, 0xa2, 0xdf } },
-    { "EFI_EVENT_USER_PROFILE_CHANGED", { 0xbaf1e6de, 0x209e, 0x4ADB, 0x8d, 0x96, 0xfd, 0x8b, 0x71, 0xf3, 0xf6, 0x83 } },
-    { "EFI_USER_CREDENTIAL_CLASS_UNKNOWN", { 0x5cf32e68, 0x7660, 0x449B, 0x80, 0xe6, 0x7e, 0xa3, 0x6e, 0x03, 0xf6, 0xa8 } },
-    { "EFI_USER_CREDENTIAL_CLASS_PASSWORD", { 0xf8e5058c, 0xccb6, 0x4714, 0xb2, 0x20, 0x3f, 0x7e, 0x3a, 0x64, 0x0b, 0xd1 } },
-    { "EFI_USER_CREDENTIAL_CLASS_SMART_CARD", { 0x5f03ba33, 0x8c6b, 0x4C24, 0xaa, 0x2e, 0x14, 0xa2, 0x65, 0x7b, 0xd4, 0x54 } },
-    { "EFI_USER_CREDENTIAL_CLASS_FINGERPRINT", { 0x32cba21f, 0xf308, 0x4CBC, 0x9a, 0xb5, 0xf5, 0xa3, 0x69, 0x9f, 0x04, 0x4a } },
-    { "EFI_USER_CREDENTIAL_CLASS_HANDPRINT", { 0x5917ef16, 0xf723, 0x4BB9, 0xa6, 0x4b, 0xd8, 0xc5, 0x32, 0xf4, 0xd8, 0xb5 } },
-    { "EFI_USER_CREDENTIAL_CLASS_SECURE_CARD", { 0x8a6b4a83, 0x42fe, 0x45D2, 0xa2, 0xef, 0x46, 0xf0, 0x6c, 0x7d, 0x98, 0x52 } },
-    { "EFI_KMS_FORMAT_RSASHA2563072", { 0x4e1356c2, 0x0eed, 0x463F, 0x81, 0x47, 0x99, 0x33, 0xab, 0xdb, 0xc7, 0xd5 } },
-    { "EFI_FMP_CAPSULE", { 0x6dcbd5ed, 0xe82d, 0x4C44, 0xbd, 0xa1, 0x71, 0x94, 0x19, 0x9a, 0xd9, 0x2a } },
-    { "EFI_CERT_X509_SHA256", { 0x3bd2a492, 0x96c0, 0x4079, 0xb4, 0x20, 0xfc, 0xf9, 0x8e, 0xf1, 0x03, 0xed } },
-    { "EFI_CERT_X509_SHA384", { 0x7076876e, 0x80c2, 0x4EE6, 0xaa, 0xd2, 0x28, 0xb3, 0x49, 0xa6, 0x86, 0x5b } },
-    { "EFI_CERT_X509_SHA512", { 0x446dbf63, 0x2502, 0x4CDA, 0xbc, 0xfa, 0x24, 0x65, 0xd2, 0xb0, 0xfe, 0x9d } },
-    { "EFI_RNG_ALGORITHM_SP80090_HASH256", { 0xa7af67cb, 0x603b, 0x4D42, 0xba, 0x21, 0x70, 0xbf, 0xb6, 0x29, 0x3f, 0x96 } },
-    { "EFI_RNG_ALGORITHM_SP80090_HMAC256", { 0xc5149b43, 0xae85, 0x4F53, 0x99, 0x82, 0xb9, 0x43, 0x35, 0xd3, 0xa9, 0xe7 } },
-    { "EFI_RNG_ALGORITHM_SP80090_CTR256", { 0x44f0de6e, 0x4d8c, 0x4045, 0xa8, 0xc7, 0x4d, 0xd1, 0x68, 0x85, 0x6b, 0x9e } },
-    { "EFI_RNG_ALGORITHM_X9313_DES", { 0x63c4785a, 0xca34, 0x4012, 0xa3, 0xc8, 0x0b, 0x6a, 0x32, 0x4f, 0x55, 0x46 } },
-    { "EFI_RNG_ALGORITHM_X931_AES", { 0xacd03321, 0x777e, 0x4D3D, 0xb1, 0xc8, 0x20, 0xcf, 0xd8, 0x88, 0x20, 0xc9 } },
-    { "EFI_ADAPTER_INFO_MEDIA_STATE", { 0xd7c74207, 0xa831, 0x4A26, 0xb1, 0xf5, 0xd1, 0x93, 0x06, 0x5c, 0xe8, 0xb6 } },
-    { "EFI_ADAPTER_INFO_NETWORK_BOOT", { 0x1fbd2960, 0x4130, 0x41E5, 0x94, 0xac, 0xd2, 0xcf, 0x03, 0x7f, 0xb3, 0x7c } },
-    { "EFI_ADAPTER_INFO_SAN_MAC_ADDRESS", { 0x114da5ef, 0x2cf1, 0x4E12, 0x9b, 0xbb, 0xc4, 0x70, 0xb5, 0x52, 0x05, 0xd9 } },
-    { "EFI_VECTOR_HANDOFF_TABLE", { 0x996ec11c, 0x5397, 0x4E73, 0xb5, 0x8f, 0x82, 0x7e, 0x52, 0x90, 0x6d, 0xef } },
-    { "ADAPTER_INFO_PLATFORM_SECURITY", { 0x6be272c7, 0x1320, 0x4CCD, 0x90, 0x17, 0xd4, 0x61, 0x2c, 0x01, 0x2b, 0x25 } },
-    { "EFI_PEI_MASTER_BOOT_MODE_PPI", { 0x7408d748, 0xfc8c, 0x4EE6, 0x92, 0x88, 0xc4, 0xbe, 0xc0, 0x92, 0xa4, 0x10 } },
-    { "EFI_PEI_BOOT_IN_RECOVERY_MODE_PPI", { 0x17ee496a, 0xd8e4, 0x4B9A, 0x94, 0xd1, 0xce, 0x82, 0x72, 0x30, 0x08, 0x50 } },
-    { "GET_PCD_INFO_PPI", { 0x4d8b155b, 0xc059, 0x4C8F, 0x89, 0x26, 0x06, 0xfd, 0x43, 0x31, 0xdb, 0x8a } },
-    { "EFI_GET_PCD_INFO_PPI", { 0xa60c6b59, 0xe459, 0x425D, 0x9c, 0x69, 0x0b, 0xcc, 0x9c, 0xb2, 0x7d, 0x81 } },
-    { "EFI_PEI_I2C_MASTER_PPI", { 0xb3bfab9b, 0x9f9c, 0x4E8B, 0xad, 0x37, 0x7f, 0x8c, 0x51, 0xfc, 0x62, 0x80 } },
-    { "EFI_PEI_FIRMWARE_VOLUME_INFO2_PPI", { 0xea7ca24b, 0xded5, 0x4DAD, 0xa3, 0x89, 0xbf, 0x82, 0x7e, 0x8f, 0x9b, 0x38 } },
-    { "GET_PCD_INFO_PROTOCOL", { 0x5be40f57, 0xfa68, 0x4610, 0xbb, 0xbf, 0xe9, 0xc5, 0xfc, 0xda, 0xd3, 0x65 } },
-    { "EFI_GET_PCD_INFO_PROTOCOL", { 0xfd0f4478, 0x0efd, 0x461D, 0xba, 0x2d, 0xe5, 0x8c, 0x45, 0xfd, 0x5f, 0x5e } },
-    { "EFI_I2C_MASTER_PROTOCOL", { 0xcd72881f, 0x45b5, 0x4FEB, 0x98, 0xc8, 0x31, 0x3d, 0xa8, 0x11, 0x74, 0x62 } },
-    { "EFI_I2C_IO_PROTOCOL", { 0xb60a3e6b, 0x18c4, 0x46E5, 0xa2, 0x9a, 0xc9, 0xa1, 0x06, 0x65, 0xa2, 0x8e } },
-    { "EFI_I2C_ENUMERATE_PROTOCOL", { 0xda8cd7c4, 0x1c00, 0x49E2, 0x80, 0x3e, 0x52, 0x14, 0xe7, 0x01, 0x89, 0x4c } },
-    { "EFI_I2C_HOST_PROTOCOL", { 0xa5aab9e3, 0xc727, 0x48CD, 0x8b, 0xbf, 0x42, 0x72, 0x33, 0x85, 0x49, 0x48 } },
-    { "EFI_I2C_BUS_CONFIGURATION_MANAGEMENT_PROTOCOL", { 0x55b71fb5, 0x17c6, 0x410E, 0xb5, 0xbd, 0x5f, 0xa2, 0xe3, 0xd4, 0x46, 0x6b } },
-    { "EFI_TR_EEPROTOCOL", { 0x607f766c, 0x7455, 0x42BE, 0x93, 0x0b, 0xe4, 0xd7, 0x6d, 0xb2, 0x72, 0x0f } },
-    { "EFI_DISK_IO2_PROTOCOL", { 0x151c8eae, 0x7f2c, 0x472C, 0x9e, 0x54, 0x98, 0x28, 0x19, 0x4f, 0x6a, 0x88 } },
-    { "EFI_TIMESTAMP_PROTOCOL", { 0xafbfde41, 0x2e6e, 0x4262, 0xba, 0x65, 0x62, 0xb9, 0x23, 0x6e, 0x54, 0x95 } },
-    { "EFI_RNG_PROTOCOL", { 0x3152bca5, 0xeade, 0x433D, 0x86, 0x2e, 0xc0, 0x1c, 0xdc, 0x29, 0x1f, 0x44 } },
-    { "EFI_ADAPTER_INFORMATION_PROTOCOL", { 0xe5dd1403, 0xd622, 0xC24E, 0x84, 0x88, 0xc7, 0x1b, 0x17, 0xf5, 0xe8, 0x02 } },
-    { "EFI_NETWORK_PKG_TOKEN_SPACE", { 0x40e064b2, 0x0ae0, 0x48B1, 0xa0, 0x7d, 0xf8, 0xcf, 0x1e, 0x1a, 0x23, 0x10 } },
-    { "EFI_NT32_PKG_TOKEN_SPACE", { 0x0d79a645, 0x1d91, 0x40A6, 0xa8, 0x1f, 0x61, 0xe6, 0x98, 0x2b, 0x32, 0xb4 } },
-    { "PEI_NT_AUTO_SCAN_PPI", { 0x0dce384d, 0x007c, 0x4BA5, 0x94, 0xbd, 0x0f, 0x6e, 0xb6, 0x4d, 0x2a, 0xa9 } },
-    { "NT_PEI_LOAD_FILE_PPI", { 0xfd0c65eb, 0x0405, 0x4CD2, 0x8a, 0xee, 0xf4, 0x00, 0xef, 0x13, 0xba, 0xc2 } },
-    { "WIN_NT_BUS_DRIVER", { 0x0419f582, 0x0625, 0x4531, 0x8a, 0x33, 0x85, 0xa9, 0x96, 0x5c, 0x95, 0xbc } },
-    { "OMAP35XX_TOKEN_SPACE", { 0x24b09abe, 0x4e47, 0x481C, 0xa9, 0xad, 0xce, 0xf1, 0x2c, 0x39, 0x23, 0x27 } },
-    { "OPTION_ROM_PKG_TOKEN_SPACE", { 0x1e43298f, 0x3478, 0x41A7, 0xb5, 0x77, 0x86, 0x06, 0x46, 0x35, 0xc7, 0x28 } },
-    { "UEFI_OVMF_PKG_TOKEN_SPACE", { 0x93bb96af, 0xb9f2, 0x4EB8, 0x94, 0x62, 0xe0, 0xba, 0x74, 0x56, 0x42, 0x36 } },
-    { "OVMF_PLATFORM_CONFIG", { 0x7235c51c, 0x0c80, 0x4CAB, 0x87, 0xac, 0x3b, 0x08, 0x4a, 0x63, 0x04, 0xb1 } },
-    { "VIRTIO_MMIO_TRANSPORT", { 0x837dca9e, 0xe874, 0x4D82, 0xb2, 0x9a, 0x23, 0xfe, 0x0e, 0x23, 0xd1, 0xe2 } },
-    { "VIRTIO_DEVICE_PROTOCOL", { 0xfa920010, 0x6785, 0x4941, 0xb6, 0xec, 0x49, 0x8c, 0x57, 0x9f, 0x16, 0x0a } },
-    { "XEN_BUS_PROTOCOL", { 0x3d3ca290, 0xb9a5, 0x11E3, 0xb7, 0x5d, 0xb8, 0xac, 0x6f, 0x7d, 0x65, 0xe6 } },
-    { "DXE_DEBUGPORT_EXT_PROTOCOL", { 0x31a4878f, 0x230d, 0x4FC2, 0x90, 0xbb, 0xda, 0x5f, 0x41, 0xa4, 0x4b, 0x1b } },
-    { "DXE_DEBUG_CMD_PROTOCOL", { 0xca3b3a50, 0x5698, 0x4551, 0x8b, 0x18, 0xce, 0xae, 0xef, 0x91, 0x7d, 0x50 } },
-    { "DXE_DEBUG_DISPATCH_PROTOCOL", { 0x301af449, 0xe0d7, 0x43A3, 0x8b, 0x1b, 0xbc, 0x16, 0x72, 0x5d, 0x37, 0x4b } },
-    { "EFI_TCG_PRIVATE_INTERFACE", { 0x7a28436a, 0xe113, 0x406A, 0xaf, 0xf9, 0x0d, 0xbf, 0x7f, 0x64, 0x3e, 0x02 } },
-    { "PDM_WINDOW_BUTTON", { 0x5f65dfdb, 0xac20, 0x4F43, 0x9b, 0x21, 0x26, 0x9e, 0x81, 0xa0, 0xea, 0x7e } },
-    { "PDM_WINDOW_SPIN", { 0x60b27e1a, 0xd65e, 0x4DB0, 0xb2, 0xbb, 0xc1, 0x6f, 0xa7, 0x1e, 0x44, 0xab } },
-    { "PEI_DEBUG_DISPATCH_PPI", { 0xc9737920, 0xc2ad, 0x41C3, 0xb1, 0x33, 0x0f, 0x9c, 0x25, 0x1b, 0x67, 0x43 } },
-    { "PEI_POST_BOOT_SCRIPT_TABLE_PPI", { 0x88c9d306, 0x0900, 0x4EB5, 0x82, 0x60, 0x3e, 0x2d, 0xbe, 0xda, 0x1f, 0x89 } },
-    { "PHOENIX_DESKTOP_MESSAGE_PROTOCOL", { 0x87dd3539, 0x0667, 0x4BB7, 0x9f, 0xb2, 0x47, 0xd3, 0xc5, 0x0b, 0x02, 0x1b } },
-    { "PHOENIX_DESKTOP_WINDOW_PROTOCOL", { 0x6ffec78d, 0x7dbf, 0x4F8B, 0x96, 0x8d, 0x2f, 0x43, 0xa0, 0x80, 0xc1, 0x3f } },
-    { "PHOENIX_GDI_PROTOCOL", { 0x3f5a74b2, 0xbf80, 0x4850, 0x85, 0x91, 0x4f, 0x2d, 0xf5, 0xf9, 0xcb, 0x2b } },
-    { "PHOENIX_SMM_CORE_SERVICES_PROTOCOL", { 0x177e63c1, 0xaed6, 0x4D88, 0x91, 0x7e, 0x9b, 0x4f, 0xb9, 0xfe, 0x40, 0x92 } },
-    { "PHOENIX_EFI_SMM_SW_SMI_PROTOCOL", { 0xff052503, 0x1af9, 0x4AEB, 0x83, 0xc4, 0xc2, 0xd4, 0xce, 0xb1, 0x0c, 0xa3 } },
-    { "PHOENIX_SMM_WATCHDOG_TIMER_PROTOCOL", { 0x6fde3af8, 0x37ad, 0x43FC, 0xb7, 0x28, 0xf4, 0xd3, 0x41, 0xf3, 0x92, 0x40 } },
-    { "SCT_ISA_HC_PPI", { 0x8d48bd70, 0xc8a3, 0x4C06, 0x90, 0x1b, 0x74, 0x79, 0x46, 0xaa, 0xc3, 0x58 } },
-    { "SCT_ISA_HC_PROTOCOL", { 0x5fac7360, 0xd4f2, 0x4C9E, 0xa7, 0xed, 0xf2, 0x59, 0x5e, 0x67, 0x08, 0x89 } },
-    { "PEI_SPEAKER_INTERFACE_PPI", { 0x30ac275e, 0xbb30, 0x4B84, 0xa1, 0xcd, 0x0a, 0xf1, 0x32, 0x2c, 0x89, 0xc0 } },
-    { "PEI_MFG_MEMORY_TEST_PPI", { 0xab294a92, 0xeaf5, 0x4CF3, 0xab, 0x2b, 0x2d, 0x4b, 0xed, 0x4d, 0xb6, 0x3d } },
-    { "PEI_SHA256_HASH_PPI", { 0x950e191b, 0x8524, 0x4F51, 0x80, 0xa1, 0x5c, 0x4f, 0x1b, 0x03, 0xf3, 0x5c } },
-    { "EFI_PLATFORM_BOOT_MODE", { 0xce845704, 0x1683, 0x4D38, 0xa4, 0xf9, 0x7d, 0x0b, 0x50, 0x77, 0x57, 0x93 } },
-    { "EFI_PLATFORM_INFO", { 0x1e2acc41, 0xe26a, 0x483D, 0xaf, 0xc7, 0xa0, 0x56, 0xc3, 0x4e, 0x08, 0x7b } },
-    { "PLATFORM_MODULE_TOKEN_SPACE", { 0x69d13bf0, 0xaf91, 0x4D96, 0xaa, 0x9f, 0x21, 0x84, 0xc5, 0xce, 0x3b, 0xc0 } },
-    { "EFI_SERIAL_PORT_TOKEN_SPACE", { 0x5fad2389, 0x2bc7, 0x4BD2, 0x83, 0xd3, 0x42, 0x9f, 0xb6, 0xae, 0xa3, 0x3f } },
-    { "EFI_ICH_TOKEN_SPACE", { 0xe38c11e3, 0x968f, 0x47B8, 0xac, 0xef, 0xac, 0xc0, 0x69, 0x3d, 0xb9, 0xff } },
-    { "EFI_PCH_TOKEN_SPACE", { 0x89a1b278, 0xa1a1, 0x4DF7, 0xb1, 0x37, 0xde, 0x5a, 0xd7, 0xc4, 0x79, 0x13 } },
-    { "EFI_PLATFORM_CPU_INFO", { 0xbb9c7ab7, 0xb8d9, 0x4BF3, 0x9c, 0x29, 0x9b, 0xf3, 0x41, 0xe2, 0x17, 0xbc } },
-    { "EFI_BIOS_ID", { 0xc3e36d09, 0x8294, 0x4B97, 0xa8, 0x57, 0xd5, 0x28, 0x8f, 0xe3, 0x3e, 0x28 } },
-    { "EFI_BOARD_FEATURES", { 0x94b9e8ae, 0x8877, 0x479A, 0x98, 0x42, 0xf5, 0x97, 0x4b, 0x82, 0xce, 0xd3 } },
-    { "ITK_DATA_VAR", { 0x3812723d, 0x7e48, 0x4E29, 0xbc, 0x27, 0xf5, 0xa3, 0x9a, 0xc9, 0x4e, 0xf1 } },
-    { "DMI_DATA", { 0x70e56c5e, 0x280c, 0x44B0, 0xa4, 0x97, 0x09, 0x68, 0x1a, 0xbc, 0x37, 0x5e } },
-    { "IDCC_DATA_HUB", { 0x788e1d9f, 0x1eab, 0x47D2, 0xa2, 0xf3, 0x78, 0xca, 0xe8, 0x7d, 0x60, 0x12 } },
-    { "MFG_MODE_VARIABLE", { 0xef14fd78, 0x0793, 0x4E2B, 0xac, 0x6d, 0x06, 0x28, 0x47, 0xe0, 0x17, 0x91 } },
-    { "ACPIOSFRMFG_STRING_VARIABLE", { 0x72234213, 0x0fd7, 0x48A1, 0xa5, 0x9f, 0xb4, 0x1b, 0xc1, 0x07, 0xfb, 0xcd } },
-    { "ACPIOSFRREF_DATA_BLOCK_VARIABLE", { 0x72234213, 0x0fd7, 0x48A1, 0xa5, 0x9f, 0xb4, 0x1b, 0xc1, 0x07, 0xfb, 0xcd } },
-    { "ACPIOSFRMODEL_STRING_VARIABLE", { 0xca1bcad9, 0xe021, 0x4547, 0xa1, 0xb0, 0x5b, 0x22, 0xc7, 0xf6, 0x87, 0xf4 } },
-    { "EFI_PCI_LAN_INFO", { 0x0d9a1427, 0xe02a, 0x437D, 0x92, 0x6b, 0xaa, 0x52, 0x1f, 0xd7, 0x22, 0xba } },
-    { "FIRMWARE_ID", { 0x5e559c23, 0x1faa, 0x4AE1, 0x8d, 0x4a, 0xc6, 0xcf, 0x02, 0x6c, 0x76, 0x6f } },
-    { "OS_SELECTION_VARIABLE", { 0x86843f56, 0x675d, 0x40A5, 0x95, 0x30, 0xbc, 0x85, 0x83, 0x72, 0xf1, 0x03 } },
-    { "DXE_PCH_PLATFORM_POLICY_PROTOCOL", { 0x4b0165a9, 0x61d6, 0x4E23, 0xa0, 0xb5, 0x3e, 0xc7, 0x9c, 0x2e, 0x30, 0xd5 } },
-    { "EFI_LPC_WPCE791_POLICY_PROTOCOL", { 0xab2bee2f, 0xc1a6, 0x4399, 0x85, 0x3d, 0xc0, 0x7c, 0x77, 0x4f, 0xfd, 0x0d } },
-    { "USB_POLICY", { 0xf617b358, 0x12cf, 0x414A, 0xa0, 0x69, 0x60, 0x67, 0x7b, 0xda, 0x13, 0xb4 } },
-    { "DXE_VLV_PLATFORM_POLICY", { 0x5bab88ba, 0xe0e2, 0x4674, 0xb6, 0xad, 0xb8, 0x12, 0xf6, 0x88, 0x1c, 0xd6 } },
-    { "EFI_SMBIOS_SLOT_POPULATION", { 0xef7bf7d6, 0xf8ff, 0x4A76, 0x82, 0x47, 0xc0, 0xd0, 0xd1, 0xcc, 0x49, 0xc0 } },
-    { "OBSERVABLE_PROTOCOL", { 0xe227c522, 0xd5fe, 0x4A53, 0x87, 0xb1, 0x0f, 0xbe, 0x57, 0x0f, 0x98, 0xe9 } },
-    { "EFI_CK505_CLOCK_PLATFORM_INFO", { 0x3c485ea4, 0x449a, 0x46CE, 0xbb, 0x08, 0x2a, 0x33, 0x6e, 0xa9, 0x6b, 0x4e } },
-    { "EFI_LPC_WPC83627_POLICY_PROTOCOL", { 0xd3ecc567, 0x9fd5, 0x44C1, 0x86, 0xcf, 0x5d, 0xa7, 0xa2, 0x4f, 0x4b, 0x5d } },
-    { "EFI_TCO_RESET_PROTOCOL", { 0xa6a79162, 0xe325, 0x4C30, 0xbc, 0xc3, 0x59, 0x37, 0x30, 0x64, 0xef, 0xb3 } },
-    { "EFI_WATCHDOG_TIMER_DRIVER_PROTOCOL", { 0xd5b06d16, 0x2ea1, 0x4DEF, 0x98, 0xd0, 0xa0, 0x5d, 0x40, 0x72, 0x84, 0x17 } },
-    { "EFI_PLATFORM_IDE_INIT_PROTOCOL", { 0x377c66a3, 0x8fe7, 0x4EE8, 0x85, 0xb8, 0xf1, 0xa2, 0x82, 0x56, 0x9e, 0x3b } },
-    { "ENHANCED_SPEEDSTEP_PROTOCOL", { 0x91a1ddcf, 0x5374, 0x4939, 0x89, 0x51, 0xd7, 0x29, 0x3f, 0x1a, 0x78, 0x6f } },
-    { "EFI_GOP_DISPLAY_BRIGHTNESS_PROTOCOL", { 0x6ff23f1d, 0x877c, 0x4B1B, 0x93, 0xfc, 0xf1, 0x42, 0xb2, 0xee, 0xa6, 0xa7 } },
-    { "EFI_USB_KEYBOARD_CONNECT", { 0xad9c4381, 0x1ede, 0x430C, 0x8d, 0x42, 0x23, 0x76, 0x7c, 0x46, 0x5d, 0x52 } },
-    { "EFI_MMIO_DEVICE_PROTOCOL", { 0x24486226, 0xf8c2, 0x41F5, 0xb9, 0xdd, 0x78, 0x3e, 0x9e, 0x56, 0xde, 0xa0 } },
-    { "EFI_I2C_BUS_CONFIGURATION_MANAGEMENT_PROTOCOL2", { 0x75032015, 0xd156, 0x423E, 0xbf, 0xa3, 0x7a, 0x65, 0xab, 0xa4, 0x71, 0x05 } },
-    { "EFI_I2C_ACPI_PROTOCOL", { 0xf30c2915, 0x5782, 0x4E6A, 0xa8, 0x46, 0x05, 0xba, 0xbc, 0xe7, 0xb6, 0xa0 } },
-    { "EFI_I2C_MASTER_PROTOCOL2", { 0x578c315a, 0x68cf, 0x4E81, 0xb5, 0xc6, 0x22, 0xdb, 0x40, 0xd0, 0x10, 0xbc } },
-    { "EFI_I2C_HOST_PROTOCOL2", { 0x70b221af, 0xfdff, 0x4FDE, 0x99, 0x68, 0x1a, 0xf6, 0x23, 0xa9, 0x56, 0xd9 } },
-    { "EFI_I2C_BUS_PROTOCOL", { 0x9fa1b225, 0x3346, 0x461B, 0xa0, 0x69, 0xed, 0x01, 0xb6, 0x73, 0xd2, 0x40 } },
-    { "EFI_I2C_SLAVE_PROTOCOL", { 0xf2c1910e, 0xf5c9, 0x4B72, 0xb2, 0x43, 0x6d, 0x59, 0x09, 0x6a, 0x79, 0xf0 } },
-    { "EFI_SPI_ACPI_PROTOCOL", { 0x9f49a879, 0x3d71, 0x42B3, 0xa0, 0xad, 0xdd, 0xb1, 0xf3, 0x30, 0x10, 0xa3 } },
-    { "EFI_SPI_HOST_PROTOCOL", { 0x951b65e5, 0x8872, 0x41ED, 0xad, 0x1d, 0xd5, 0x68, 0x1f, 0x4a, 0xf0, 0x33 } },
-    { "EFI_SPI_BUS_PROTOCOL", { 0x137b3044, 0xf6d7, 0x473E, 0xa6, 0x25, 0x9f, 0xb9, 0x25, 0x05, 0xc1, 0x80 } },
-    { "LPSS_DUMMY_PROTOCOL", { 0xaf4cc162, 0xd41c, 0x455A, 0xab, 0x45, 0x6d, 0xbc, 0xc1, 0xcd, 0x32, 0xf3 } },
-    { "EFI_GPIO_OPERATION_PROTOCOL", { 0x38ddfe8f, 0x8991, 0x44AA, 0x98, 0x89, 0x83, 0xf4, 0x91, 0x84, 0x65, 0xb0 } },
-    { "EFI_ESRT_OPERATION_PROTOCOL", { 0x4549ab47, 0x6e60, 0x4293, 0xb9, 0x1d, 0x31, 0xb6, 0x10, 0xad, 0x80, 0x56 } },
-    { "EFI_FW_DISPLAY_CAPSULE", { 0x3b8c8162, 0x188c, 0x46A4, 0xae, 0xc9, 0xbe, 0x43, 0xf1, 0xd6, 0x56, 0x97 } },
-    { "EFI_FIRMWARE_CLASS", { 0xb122a262, 0x3551, 0x4F48, 0x88, 0x92, 0x55, 0xf6, 0xc0, 0x61, 0x42, 0x90 } },
-    { "EFI_DFUVER", { 0x0dc73aed, 0xcbf6, 0x4A25, 0xa6, 0x8d, 0x59, 0xc8, 0x0f, 0x44, 0xc7, 0xc3 } },
-    { "EFI_ESRT_TABLE", { 0xb122a263, 0x3661, 0x4F68, 0x99, 0x29, 0x78, 0xf8, 0xb0, 0xd6, 0x21, 0x80 } },
-    { "EFI_CAPSULE_CRASH_LOG_VAR", { 0xf3ff1468, 0x04ba, 0x4966, 0x9f, 0xb2, 0xe4, 0xa7, 0x90, 0x05, 0x46, 0x50 } },
-    { "EFI_CAPSULE_CRASH", { 0x0e1d2972, 0x65af, 0x4AC1, 0xbf, 0xa3, 0xce, 0xf4, 0xab, 0x0c, 0x38, 0xfe } },
-    { "EFI_SECURE_BOOT_ENABLE_DISABLE", { 0xf0a30bc7, 0xaf08, 0x4556, 0x99, 0xc4, 0x00, 0x10, 0x09, 0xc9, 0x3a, 0x44 } },
-    { "EFI_CUSTOM_MODE_ENABLE", { 0xc076ec0c, 0x7028, 0x4399, 0xa0, 0x72, 0x71, 0xee, 0x5c, 0x44, 0x8b, 0x9f } },
-    { "EFI_VENDOR_KEYS_NV", { 0x9073e4e0, 0x60ec, 0x4B6E, 0x99, 0x03, 0x4c, 0x22, 0x3c, 0x26, 0x0f, 0x3c } },
-    { "EFI_CERT_DB", { 0xd9bee56e, 0x75dc, 0x49D9, 0xb4, 0xd7, 0xb5, 0x34, 0x21, 0x0f, 0x63, 0x7a } },
-    { "TCG_EVENT_ENTRY_HOB", { 0x2b9ffb52, 0x1b13, 0x416F, 0xa8, 0x7b, 0xbc, 0x93, 0x0d, 0xef, 0x92, 0xa8 } },
-    { "TPM_ERROR_HOB", { 0xef598499, 0xb25e, 0x473A, 0xbf, 0xaf, 0xe7, 0xe5, 0x7d, 0xce, 0x82, 0xc4 } },
-    { "EFI_TR_EEPHYSICAL_PRESENCE", { 0xf24643c2, 0xc622, 0x494E, 0x8a, 0x0d, 0x46, 0x32, 0x57, 0x9c, 0x2d, 0x5b } },
-    { "EFI_TPM_DEVICE_INSTANCE_TPM12", { 0x8b01e5b6, 0x4f19, 0x46E8, 0xab, 0x93, 0x1c, 0x53, 0x67, 0x1b, 0x90, 0xcc } },
-    { "EFI_TPM_DEVICE_INSTANCE_TPM20_DTPM", { 0x286bf25a, 0xc2c3, 0x408C, 0xb3, 0xb4, 0x25, 0xe6, 0x75, 0x8b, 0x73, 0x17 } },
-    { "EFI_TPM_DEVICE_SELECTED", { 0x7f4158d3, 0x074d, 0x456D, 0x8c, 0xb2, 0x01, 0xf9, 0xc8, 0xf7, 0x9d, 0xaa } },
-    { "TR_EECONFIG_FORM_SET", { 0xc54b425f, 0xaa79, 0x48B4, 0x98, 0x1f, 0x99, 0x8b, 0x3c, 0x4b, 0x64, 0x1c } },
-    { "PEI_TPM_INITIALIZATION_DONE_PPI", { 0xa030d115, 0x54dd, 0x447B, 0x90, 0x64, 0xf2, 0x06, 0x88, 0x3d, 0x7c, 0xcc } },
-    { "EFI_PEI_FIRMWARE_VOLUME_INFO_MEASUREMENT_EXCLUDED_PPI", { 0x6e056ff9, 0xc695, 0x4364, 0x9e, 0x2c, 0x61, 0x26, 0xf5, 0xce, 0xea, 0xae } },
-    { "SHELL_BCFG_HII", { 0x5f5f605d, 0x1583, 0x4A2D, 0xa6, 0xb2, 0xeb, 0x12, 0xda, 0xb4, 0xa2, 0xb6 } },
-    { "EFI_SHELL_DYNAMIC_COMMAND_PROTOCOL", { 0x3c7200e9, 0x005f, 0x4EA4, 0x87, 0xde, 0xa3, 0xdf, 0xac, 0x8a, 0x27, 0xc3 } },
-    { "EFI_SOURCE_LEVEL_DEBUG_PKG_TOKEN_SPACE", { 0x865a5aab, 0xb85d, 0x474C, 0x84, 0x55, 0x65, 0xd1, 0xbe, 0x84, 0x4b, 0xe2 } },
-    { "STD_LIB_TOKEN_SPACE", { 0x447559f0, 0xd02e, 0x4CF1, 0x99, 0xbc, 0xca, 0x11, 0x65, 0x40, 0x54, 0xc2 } },
-    { "EFI_SOCKET_PROTOCOL", { 0x58e6ed63, 0x1694, 0x440B, 0x93, 0x88, 0xe9, 0x8f, 0xed, 0x6b, 0x65, 0xaf } },
-    { "EFI_SOCKET_SERVICE_BINDING_PROTOCOL", { 0x8aaedb2a, 0xa6bb, 0x47C6, 0x94, 0xce, 0x1b, 0x80, 0x96, 0x42, 0x3f, 0x2a } },
-    { "VLV_POLICY_PPI", { 0x7d84b2c2, 0x22a1, 0x4372, 0xb1, 0x2c, 0xeb, 0xb2, 0x32, 0xd3, 0xa6, 0xa3 } },
-    { "VLV_MMIO_POLICY_PPI", { 0xe767bf7f, 0x4db6, 0x5B34, 0x10, 0x11, 0x4f, 0xbe, 0x4c, 0xa7, 0xaf, 0xd2 } },
-    { "SE_CF_TPMPPI", { 0x10e26df1, 0x8775, 0x4EE1, 0xb5, 0x0a, 0x3a, 0xe8, 0x28, 0x93, 0x70, 0x3a } },
-    { "PCH_INIT_PPI", { 0x09ea894a, 0xbe0d, 0x4230, 0xa0, 0x03, 0xed, 0xc6, 0x93, 0xb4, 0x8e, 0x95 } },
-    { "PCH_PLATFORM_POLICY_PPI", { 0x15344673, 0xd365, 0x4BE2, 0x85, 0x13, 0x14, 0x97, 0xcc, 0x07, 0x61, 0x1d } },
-    { "PEI_SPI_PPI", { 0xa38c6898, 0x2b5c, 0x4FF6, 0x93, 0x26, 0x2e, 0x63, 0x21, 0x2e, 0x56, 0xc2 } },
-    { "SE_CUMA_PPI", { 0xcbd86677, 0x362f, 0x4C04, 0x94, 0x59, 0xa7, 0x41, 0x32, 0x6e, 0x05, 0xcf } },
-    { "PEI_SDHC_PPI", { 0xf4ef9d7a, 0x98c5, 0x4C1A, 0xb4, 0xd9, 0xd8, 0xd8, 0x72, 0x65, 0xbe, 0x0c } },
-    { "PEI_BLOCK_IO_PPI", { 0xbc5fa650, 0xedbb, 0x4D0D, 0xb3, 0xa3, 0xd9, 0x89, 0x07, 0xf8, 0x47, 0xdf } },
-    { "SE_CF_TPMPOLICY_PPI", { 0x4fd1ba49, 0x8f90, 0x471A, 0xa2, 0xc9, 0x17, 0x3c, 0x7a, 0x73, 0x2f, 0xd0 } },
-    { "PCH_PEI_INIT_PPI", { 0xacb93b08, 0x5cdc, 0x4A8F, 0x93, 0xd4, 0x06, 0xe3, 0x42, 0xdf, 0x18, 0x2e } },
-    { "PPM_PLATFORM_POLICY_PROTOCOL", { 0xddabfeac, 0xef63, 0x452C, 0x8f, 0x39, 0xed, 0x7f, 0xae, 0xd8, 0x26, 0x5e } },
-    { "EFI_SD_HOST_IO_PROTOCOL", { 0xb63f8ec7, 0xa9c9, 0x4472, 0xa4, 0xc0, 0x4d, 0x8b, 0xf3, 0x65, 0xcc, 0x51 } },
-    { "EFI_PCH_INFO_PROTOCOL", { 0xd31f0400, 0x7d16, 0x4316, 0xbf, 0x88, 0x60, 0x65, 0x88, 0x3b, 0x40, 0x2b } },
-    { "EFI_PCH_EXTENDED_RESET_PROTOCOL", { 0xf0bbfca0, 0x684e, 0x48B3, 0xba, 0xe2, 0x6c, 0x84, 0xb8, 0x9e, 0x53, 0x39 } },
-    { "DXE_ICH_PLATFORM_POLICY_PROTOCOL", { 0xf617b358, 0x12cf, 0x414A, 0xa0, 0x69, 0x60, 0x67, 0x7b, 0xda, 0x13, 0xb3 } },
-    { "EFI_ICH_INFO_PROTOCOL", { 0xd31f0400, 0x7d16, 0x4316, 0xbf, 0x88, 0x60, 0x65, 0x88, 0x3b, 0x40, 0x2b } },
-    { "EFI_EMMC_CARD_INFO_PROTOCOL", { 0x1ebe5ab9, 0x2129, 0x49E7, 0x84, 0xd7, 0xee, 0xb9, 0xfc, 0xe5, 0xde, 0xdd } },
-    { "EFI_TDT_OPERATION_PROTOCOL", { 0xfd301ba4, 0x5e62, 0x4679, 0xa0, 0x6f, 0xe0, 0x9a, 0xab, 0xdd, 0x2a, 0x91 } },
-    { "EFI_DFURESULT", { 0x14a7c46f, 0xbc02, 0x4047, 0x9f, 0x18, 0xa5, 0xd7, 0x25, 0xd8, 0xbd, 0x19 } }, 
-    { "EFI_CPTOKEN_SPACE", { 0x918211ce, 0xa1d2, 0x43A0, 0xa0, 0x4e, 0x75, 0xb5, 0xbf, 0x44, 0x50, 0x0e } }, 
-    { "EFI_VLVTOKEN_SPACE", { 0xca452c68, 0xdf0c, 0x45C9, 0x82, 0xfb, 0xea, 0xe4, 0x2b, 0x31, 0x29, 0x46 } }, 
-    { "DXE_PCH_POLICY_UPDATE_PROTOCOL", { 0x1a819e49, 0xd8ee, 0x48CB, 0x9a, 0x9c, 0x0a, 0xa0, 0xd2, 0x81, 0x0a, 0x38 } }, 
-    { "POWER_MANAGEMENT_ACPI_TABLE_STORAGE", { 0x161be597, 0xe9c5, 0x49DB, 0xae, 0x50, 0xc4, 0x62, 0xab, 0x54, 0xee, 0xda } }, 
-    { "VLV_REF_CODE_PKG_TOKEN_SPACE", { 0x85768e4a, 0x6cdc, 0x444E, 0x93, 0xdf, 0x93, 0x66, 0x85, 0xb5, 0xdf, 0xcc } }, 
-    { "SE_CPLATFORM_READY_TO_BOOT", { 0x03fdf171, 0x1d67, 0x4ACE, 0xa9, 0x04, 0x3e, 0x36, 0xd3, 0x38, 0xfa, 0x74 } }, 
-    { "EFI_VLV2_VARIABLE", { 0x10ba6bbe, 0xa97e, 0x41C3, 0x9a, 0x07, 0x60, 0x7a, 0xd9, 0xbd, 0x60, 0xe5 } },
+GUID_ENTRY("ACOUSTIC_SETUP_PROTOCOL_GUID", 0xc1d7859d, 0x5719, 0x46c3, 0xa2, 0x98, 0xd0, 0x71, 0xe3, 0x2, 0x64, 0xd1)
+GUID_ENTRY("ADD_BOOT_OPTION_GUID", 0x19d96d3f, 0x6a6a, 0x47d2, 0xb1, 0x95, 0x7b, 0x24, 0x32, 0xda, 0x3b, 0xe2)
+GUID_ENTRY("ADVANCED_FORM_SET_GUID", 0xe14f04fa, 0x8706, 0x4353, 0x92, 0xf2, 0x9c, 0x24, 0x24, 0x74, 0x6f, 0x9f)
+GUID_ENTRY("AHCI_BUS_INIT_PROTOCOL_GUID", 0xB2FA4764, 0x3B6E, 0x43D3, 0x91, 0xDF, 0x87, 0xD1, 0x5A, 0x3E, 0x56, 0x68)
+GUID_ENTRY("AHCI_SMM_PROTOCOL_GUID", 0xB2FA5764, 0x3B6E, 0x43D3, 0x91, 0xDF, 0x87, 0xD1, 0x5A, 0x3E, 0x56, 0x68)
+GUID_ENTRY("AMICSM_PCIBUSNUM_XLAT_PROTOCOL_GUID", 0xcb5c54c0, 0x230d, 0x43db, 0x92, 0x2c, 0x24, 0xd3, 0x4f, 0x8c, 0x91, 0x5c)
+GUID_ENTRY("AMITSESETUP_GUID", 0xc811fa38, 0x42c8, 0x4579, 0xa9, 0xbb, 0x60, 0xe9, 0x4e, 0xdd, 0xfb, 0x34)
+GUID_ENTRY("AMITSE_ADMIN_PASSWORD_VALID_GUID", 0x541d5a75, 0x95ee, 0x43c7, 0x9e, 0x5d, 0x23, 0x94, 0xdc, 0x48, 0x62, 0x49)
+GUID_ENTRY("AMITSE_AFTER_FIRST_BOOT_OPTION_GUID", 0xC48D651C, 0x9D0E, 0x4ce7, 0xAD, 0x39, 0xED, 0xD1, 0xAB, 0x83, 0x6B, 0x30)
+GUID_ENTRY("AMITSE_BOOT_ORDER_CHANGE_GUID", 0x1b6bc809, 0xc986, 0x4937, 0x93, 0x4f, 0x1e, 0xa5, 0x86, 0x22, 0xfe, 0x50)
+GUID_ENTRY("AMITSE_DRIVER_HEALTH_CTRL_GUID", 0x58279c2d, 0xfb19, 0x466e, 0xb4, 0x2e, 0xcd, 0x43, 0x70, 0x16, 0xdc, 0x25)
+GUID_ENTRY("AMITSE_DRIVER_HEALTH_ENB_GUID", 0x885f288, 0x418c, 0x4be1, 0xa6, 0xaf, 0x8b, 0xad, 0x61, 0xda, 0x8, 0xfe)
+GUID_ENTRY("AMITSE_DRIVER_HEALTH_GUID", 0x7459a7d4, 0x6533, 0x4480, 0xbb, 0xa7, 0x79, 0xe2, 0x5a, 0x44, 0x43, 0xc9)
+GUID_ENTRY("AMITSE_EVENT_BEFORE_BOOT_GUID", 0x3677770f, 0xefb2, 0x43b2, 0xb8, 0xae, 0xb3, 0x2, 0xe9, 0x60, 0x48, 0x82)
+GUID_ENTRY("AMITSE_INVALID_PASSWORD_GUID", 0xd69240c0, 0xdd40, 0x4f2d, 0x98, 0x63, 0x48, 0x48, 0xda, 0x6e, 0x61, 0x5f)
+GUID_ENTRY("AMITSE_NVRAM_UPDATE_GUID", 0xd84beff0, 0x159a, 0x4b60, 0x9a, 0xb9, 0xac, 0x5c, 0x47, 0x4b, 0xd3, 0xb1)
+GUID_ENTRY("AMITSE_PASSWORD_PROMPT_ENTER_GUID", 0x73e7e01, 0x2611, 0x4e85, 0xb8, 0x96, 0xa3, 0xb6, 0x76, 0x7c, 0xba, 0x0)
+GUID_ENTRY("AMITSE_PASSWORD_PROMPT_EXIT_GUID", 0xb9b038b0, 0xe2b6, 0x4aab, 0x94, 0x35, 0x41, 0x65, 0xec, 0xfe, 0xd0, 0x32)
+GUID_ENTRY("AMITSE_SETUP_ENTER_GUID", 0x71202EEE, 0x5F53, 0x40d9, 0xAB, 0x3D, 0x9E, 0x0C, 0x26, 0xD9, 0x66, 0x57)
+GUID_ENTRY("AMITSE_USER_PASSWORD_VALID_GUID", 0xab1404ca, 0x4801, 0x4208, 0x98, 0xbf, 0x30, 0xd5, 0x21, 0xda, 0xd4, 0xd3)
+GUID_ENTRY("AMI_APTIO_SIG_OWNER_GUID", 0x26DC4851, 0x195F, 0x4AE1, 0x9A, 0x19, 0xFB, 0xF8, 0x83, 0xBB, 0xB3, 0x5E)
+GUID_ENTRY("AMI_BBS_DEVICE_PATH_GUID", 0x1db184ae, 0x81f5, 0x4e72, 0x85, 0x44, 0x2b, 0xab, 0xc, 0x2c, 0xac, 0x5c)
+GUID_ENTRY("AMI_BEFORE_CPU_RC_PROTOCOL_GUID", 0x1d26adc3, 0xb011, 0xee2c, 0x21, 0x77, 0x89, 0xbb, 0xaa, 0xcc, 0x33, 0x92)
+GUID_ENTRY("AMI_BIOSPPI_FLAGS_MANAGEMENT_GUID", 0xe9008d70, 0x2a4e, 0x47ea, 0x8e, 0xc4, 0x72, 0xe2, 0x57, 0x67, 0xe5, 0xef)
+GUID_ENTRY("AMI_BOARD_INFO_PROTOCOL_GUID", 0x0273146c, 0x96c4, 0x45a1, 0xa7, 0xaf, 0x78, 0xe0, 0x52, 0x4a, 0x0a, 0xe2)
+GUID_ENTRY("AMI_BOARD_INFO_SECTION_GUID", 0xE6F4F8F7, 0x4992, 0x47b2, 0x83, 0x02, 0x85, 0x08, 0x74, 0x5E, 0x4A, 0x23)
+GUID_ENTRY("AMI_CALLBACK_GUID", 0x9CF0F18E, 0x7C7D, 0x49DE, 0xB5, 0xAA, 0xBB, 0xBA, 0xD6, 0xB2, 0x10, 0x07)
+GUID_ENTRY("AMI_CAPSULE_HOB_GUID", 0xbf66fdf7, 0xf64c, 0x4b11, 0x8a, 0xb7, 0xf8, 0x43, 0xaa, 0x2a, 0x8b, 0xea)
+GUID_ENTRY("AMI_CCID_IO_PROTOCOL_GUID", 0xB167C2F5, 0xE26A, 0x4DFF, 0x8E, 0x1C, 0x08, 0x07, 0xC7, 0xF0, 0x2A, 0x88)
+GUID_ENTRY("AMI_CCID_PRESENCE_GUID", 0x5FDEE00D, 0xDA40, 0x405A, 0xB9, 0x2E, 0xCF, 0x4A, 0x80, 0xEA, 0x8F, 0x76)
+GUID_ENTRY("AMI_CMOS_BAD_FLAG_HOB_GUID", 0xb098f766, 0xb17a, 0x4005, 0x83, 0x9, 0xeb, 0x23, 0xf1, 0x44, 0x8c, 0x15)
+GUID_ENTRY("AMI_CPUID_CKSUM_HOB_GUID", 0xd4ca32b1, 0xb1f2, 0x4ff3, 0xb4, 0x75, 0x66, 0xe7, 0xb8, 0x19, 0x2a, 0x3b)
+GUID_ENTRY("AMI_CPU_INFO_2_PROTOCOL_GUID", 0xac9cf0a8, 0xe551, 0x4be2, 0xad, 0xa, 0xe1, 0xb5, 0x64, 0xee, 0xa2, 0x73)
+GUID_ENTRY("AMI_CSM_DRIVER_STARTED_GUID", 0x3EA824D1, 0x81E3, 0x4FF5, 0xBD, 0x43, 0xBB, 0x9C, 0x65, 0xDF, 0x7C, 0x46)
+GUID_ENTRY("AMI_CSM_THUNK_PROTOCOL_GUID", 0x2362ea9c, 0x84e5, 0x4dff, 0x83, 0xbc, 0xb5, 0xac, 0xec, 0xb5, 0x7c, 0xbb)
+GUID_ENTRY("AMI_DDDT_PRESENT_FLAG_HOB_GUID", 0x4e7af417, 0xc200, 0x400a, 0x9d, 0x18, 0x86, 0x5a, 0xda, 0xd3, 0x8, 0x96)
+GUID_ENTRY("AMI_DEBUGGER_CPU_PROTOCOL_GUID", 0xab21acc3, 0xba33, 0xee2c, 0x66, 0xbc, 0x12, 0x56, 0x77, 0x11, 0x1a, 0xb2)
+GUID_ENTRY("AMI_DEBUGPORT_HOB_GUID", 0xe894b313, 0x54ca, 0x4bb2, 0x8c, 0xdd, 0x85, 0x1e, 0x8a, 0xc9, 0x2, 0x7c)
+GUID_ENTRY("AMI_DEVICE_NAME_DEVICE_PATH_GUID", 0x2d6447ef, 0x3bc9, 0x41a0, 0xac, 0x19, 0x4d, 0x51, 0xd0, 0x1b, 0x4c, 0xe6)
+GUID_ENTRY("AMI_DIGITAL_SIGNATURE_PROTOCOL_GUID", 0x5f87ba17, 0x957d, 0x433d, 0x9e, 0x15, 0xc0, 0xe7, 0xc8, 0x79, 0x88, 0x99)
+GUID_ENTRY("AMI_DIMM_SPD_DATA_HOB_GUID", 0xd4ca32b3, 0xb1fe, 0x4ff7, 0xb0, 0x73, 0x60, 0xed, 0xbb, 0x16, 0x22, 0x33)
+GUID_ENTRY("AMI_EARLY_BIST_PPI_GUID", 0xa7e2ce72, 0xdc32, 0x4bc0, 0x9e, 0x35, 0xfe, 0xb3, 0xa, 0xe5, 0xcc, 0x47)
+GUID_ENTRY("AMI_EFIKEYCODE_PROTOCOL_GUID", 0x0adfb62d, 0xff74, 0x484c, 0x89, 0x44, 0xf8, 0x5c, 0x4b, 0xea, 0x87, 0xa8)
+GUID_ENTRY("AMI_FAST_BOOT_PROTOCOL_GUID", 0x3496a19a, 0x2e99, 0x41ba, 0x83, 0x3e, 0xf, 0xde, 0x2e, 0xbf, 0x2a, 0x55)
+GUID_ENTRY("AMI_FW_RECOVERY_CAPSULE_GUID", 0x5e794317, 0xa07e, 0x45df, 0x94, 0xbb, 0x1c, 0x99, 0x7d, 0x62, 0x32, 0xca)
+GUID_ENTRY("AMI_HECI_SMM_GUID", 0xFC9A50C1, 0x8B3D, 0x40D0, 0x99, 0x12, 0x6E, 0x26, 0xD7, 0x89, 0x6C, 0xBA)
+GUID_ENTRY("AMI_INTERNAL_FACTORY_TDC_TDP_HOB_GUID", 0x982d8c6f, 0xf6f6, 0x4135, 0xa3, 0x9, 0xa4, 0x59, 0x3e, 0xa5, 0x64, 0x17)
+GUID_ENTRY("AMI_INTERNAL_UCODE_HOB_GUID", 0x94567c6f, 0xf7a9, 0x4229, 0x13, 0x30, 0xfe, 0x11, 0xcc, 0xab, 0x3a, 0x11)
+GUID_ENTRY("AMI_INT_SMM_COMM_PROTOCOL_GUID", 0xb27dab38, 0x9814, 0x4e06, 0xa5, 0xa2, 0x65, 0xae, 0x9a, 0x14, 0x25, 0x8f)
+GUID_ENTRY("AMI_IRQ_DMA_MASK_VARIABLE_GUID", 0xfc8be767, 0x89f1, 0x4d6e, 0x80, 0x99, 0x6f, 0x2, 0x1e, 0xbc, 0x87, 0xcc)
+GUID_ENTRY("AMI_ISO9660_MEDIA_GUID", 0xba7c46d1, 0x9c5e, 0x4fc8, 0x94, 0x3d, 0x1a, 0x49, 0x1f, 0x23, 0xfe, 0x1)
+GUID_ENTRY("AMI_LOAD_CSM_GUID", 0x16287ba4, 0x5b9d, 0x4d98, 0x91, 0x9f, 0x7b, 0x7b, 0x78, 0xcb, 0x2b, 0xe0)
+GUID_ENTRY("AMI_MASKED_DEVICE_PATH_GUID", 0x99e275e7, 0x75a0, 0x4b37, 0xa2, 0xe6, 0xc5, 0x38, 0x5e, 0x6c, 0x0, 0xcb)
+GUID_ENTRY("AMI_MEASURE_PCIOPROM_GUID", 0xb3dae700, 0x2a77, 0x4ea4, 0xaf, 0x79, 0x32, 0x97, 0xb4, 0x84, 0xbe, 0x61)
+GUID_ENTRY("AMI_MEDIA_DEVICE_PATH_GUID", 0x5023b95c, 0xdb26, 0x429b, 0xa6, 0x48, 0xbd, 0x47, 0x66, 0x4c, 0x80, 0x12)
+GUID_ENTRY("AMI_MEMORY_ERROR_REPORT_PPI_GUID", 0x85226559, 0x0def, 0x48d8, 0xa8, 0xc9, 0xb7, 0x46, 0xd6, 0xa4, 0xdf, 0x01)
+GUID_ENTRY("AMI_MRC_INFO_HOB_GUID", 0xa6351a87, 0x2965, 0x4718, 0x88, 0xc7, 0x0b, 0x5b, 0x5a, 0xc0, 0xb5, 0xe4)
+GUID_ENTRY("AMI_NB_MRC_INFO_GUID", 0x6737934b, 0xa27e, 0x4c05, 0xad, 0x5b, 0x6a, 0xb8, 0x62, 0x73, 0x68, 0x0b)
+GUID_ENTRY("AMI_NVRAM_SPD_MAP_GUID", 0x717fc150, 0xabd9, 0x4614, 0x80, 0x15, 0xb, 0x33, 0x23, 0xea, 0xb9, 0x5c)
+GUID_ENTRY("AMI_OPROM_POLICY_PROTOCOL_GUID", 0x542d6248, 0x4198, 0x4960, 0x9f, 0x59, 0x23, 0x84, 0x64, 0x6d, 0x63, 0xb4)
+GUID_ENTRY("AMI_OS_PPI_CONFIRMATION_OVERRIDE_GUID", 0x5f171f5f, 0x8385, 0x4086, 0xa6, 0x9b, 0x1f, 0xcf, 0x6, 0xae, 0x4a, 0x3d)
+GUID_ENTRY("AMI_PB_KEY_RSA2048_GUID", 0x04627B9B, 0x385E, 0x4744, 0x90, 0x21, 0xE6, 0x63, 0x19, 0xF2, 0x03, 0x94)
+GUID_ENTRY("AMI_PCI_BUS_EXT_PROTOCOL_GUID", 0xf42a009d, 0x977f, 0x4f08, 0x94, 0x40, 0xbc, 0xa5, 0xa3, 0xbe, 0xd9, 0xaf)
+GUID_ENTRY("AMI_PEIM_HOB_GUID", 0xf4491ba4, 0x7672, 0x486f, 0xb4, 0xd7, 0x99, 0x89, 0x9d, 0x22, 0xda, 0x57)
+GUID_ENTRY("AMI_PEIM_LOAD_HOB_GUID", 0xec9c36fd, 0x1642, 0x4b84, 0x91, 0xfa, 0x91, 0x9c, 0x2d, 0x6, 0x6f, 0xb4)
+GUID_ENTRY("AMI_PEI_AFTER_MRC_GUID", 0x64c96700, 0x6b4c, 0x480c, 0xa3, 0xe1, 0xb8, 0xbd, 0xe8, 0xf6, 0x2, 0xb2)
+GUID_ENTRY("AMI_PEI_CPUINIT_POLICY_PPI_GUID", 0xf824ccbb, 0xd8e0, 0x4522, 0x8a, 0xa8, 0x65, 0xf0, 0x4b, 0x46, 0x3d, 0xb5)
+GUID_ENTRY("AMI_PEI_END_MEMORY_DETECT_GUID", 0x9f58e424, 0xb96b, 0x45a5, 0xad, 0xdc, 0xd2, 0xfe, 0x39, 0x4a, 0x99, 0xd9)
+GUID_ENTRY("AMI_PEI_END_OF_MRC_GUID", 0x633194be, 0x1697, 0x11e1, 0xb5, 0xf0, 0x2c, 0xb2, 0x48, 0x24, 0x01, 0x9b)
+GUID_ENTRY("AMI_PEI_MRC_DEFAULT_GUID", 0xe813e116, 0xc099, 0x4d21, 0x9c, 0x34, 0xa5, 0x52, 0xd5, 0xe9, 0xa5, 0xd0)
+GUID_ENTRY("AMI_PEI_NBINIT_POLICY_PPI_GUID", 0x9ce4d938, 0x9c87, 0x41d0, 0x9e, 0x55, 0x34, 0x92, 0x3f, 0xaf, 0x8b, 0x4f)
+GUID_ENTRY("AMI_PEI_NB_CPU_ONLY_RESET_PPI_GUID", 0x1f0f049e, 0x3a68, 0x4c97, 0x86, 0x5a, 0xbc, 0x5e, 0xed, 0x79, 0x20, 0xe7)
+GUID_ENTRY("AMI_PEI_NB_CUSTOM_PPI_GUID", 0x584cc99f, 0x4be8, 0x43d1, 0xa4, 0x5a, 0x93, 0x3d, 0xc3, 0x94, 0x79, 0xfc)
+GUID_ENTRY("AMI_PEI_PCI_TABLE_INIT_PPI_GUID", 0x97f91e78, 0xea12, 0x4ea6, 0xb7, 0xb3, 0x7b, 0x6, 0x78, 0xc2, 0x86, 0x73)
+GUID_ENTRY("AMI_PEI_SBINIT_POLICY_PPI_GUID", 0x95e8152b, 0x1b98, 0x4f11, 0x8a, 0x77, 0xdb, 0x26, 0x58, 0x3e, 0xbc, 0x42)
+GUID_ENTRY("AMI_PEI_SB_CUSTOM_PPI_GUID", 0x38965bb5, 0x8097, 0x40f5, 0xb7, 0x42, 0x8c, 0xc1, 0x4a, 0x64, 0x9b, 0x64)
+GUID_ENTRY("AMI_PEI_SB_OEM_PLATFORM_POLICY_OVERRIDE_PPI_GUID", 0x61187967, 0x9a77, 0x419d, 0xaa, 0xea, 0x64, 0xdd, 0x56, 0x19, 0x08, 0x15)
+GUID_ENTRY("AMI_PEI_SET_NB_SUBID_PPI_GUID", 0x584cc99f, 0x4be8, 0x43d1, 0xa4, 0x5a, 0x93, 0x3d, 0xc3, 0x94, 0x79, 0xfc)
+GUID_ENTRY("AMI_PERF_TUNE_DATA_HOB_GUID", 0x4d6c0496, 0x8de4, 0x4af2, 0x9a, 0x2e, 0x9b, 0xe5, 0xb9, 0x15, 0x6a, 0xc5)
+GUID_ENTRY("AMI_PLL_OVER_VOTAGE_FLAG_HOB_GUID", 0x181e874d, 0xc089, 0x4c99, 0x8e, 0xc2, 0x6d, 0x67, 0x61, 0x34, 0x82, 0x20)
+GUID_ENTRY("AMI_POST_MANAGER_PROTOCOL_GUID", 0x8A91B1E1, 0x56C7, 0x4ADC, 0xAB, 0xEB, 0x1C, 0x2C, 0xA1, 0x72, 0x9E, 0xFF)
+GUID_ENTRY("AMI_RECOVERY_IMAGE_HOB_GUID", 0xdac3cb98, 0x2295, 0x412e, 0x82, 0x6d, 0xfd, 0xee, 0xa3, 0x20, 0xcf, 0x31)
+GUID_ENTRY("AMI_RESET_TYPE_HOB_GUID", 0x39e8cda1, 0x6a35, 0x4cdd, 0xa9, 0x2, 0xd1, 0xa7, 0x95, 0xf7, 0x3, 0x80)
+GUID_ENTRY("AMI_RESET_TYPE_VARIABLE_GUID", 0x308DD02C, 0x092B, 0x4123, 0xA2, 0xAF, 0x3E, 0xF4, 0x44, 0x0A, 0x6B, 0x4A)
+GUID_ENTRY("AMI_ROM_LAYOUT_HOB_GUID", 0xd7642443, 0x87b7, 0x4832, 0x96, 0x7, 0xe, 0x1e, 0xa8, 0x1c, 0x1d, 0x86)
+GUID_ENTRY("AMI_SB_SMI_PROTOCOL_GUID", 0x589bc616, 0xbb4f, 0x47ed, 0x92, 0xf7, 0x93, 0x39, 0x3c, 0x69, 0x7e, 0x25)
+GUID_ENTRY("AMI_SETUP_NVRAM_UPDATE_GUID", 0xd84beff0, 0x159a, 0x4b60, 0x9a, 0xb9, 0xac, 0x5c, 0x47, 0x4b, 0xd3, 0xb1)
+GUID_ENTRY("AMI_SMBIOS_CPU_INFO_PROTOCOL_GUID", 0x3d6cdb0a, 0x5b1f, 0x43a3, 0xa4, 0x3b, 0x44, 0x12, 0x67, 0xf9, 0xda, 0xb5)
+GUID_ENTRY("AMI_SMBIOS_MEMORY_INFO_HOB_GUID", 0x7d6b8734, 0xb754, 0x443f, 0xb5, 0x88, 0x77, 0x43, 0x84, 0x3a, 0xd3, 0xf1)
+GUID_ENTRY("AMI_SMBUS_HOB_GUID", 0x17cb4b7, 0xb80c, 0x4040, 0xb6, 0xc8, 0xea, 0x98, 0x2b, 0xbb, 0x25, 0xb7)
+GUID_ENTRY("AMI_SMBUS_SMM_PROTOCOL_GUID", 0x72e40094, 0x2ee1, 0x497a, 0x8f, 0x33, 0x4c, 0x93, 0x4a, 0x9e, 0x9c, 0xc)
+GUID_ENTRY("AMI_SMM_DIGITAL_SIGNATURE_PROTOCOL_GUID", 0x91ABC830, 0x16FC, 0x4D9E, 0xA1, 0x89, 0x5F, 0xC8, 0xBB, 0x41, 0x14, 0x02)
+GUID_ENTRY("AMI_SMM_INFO_PROTOCOL_GUID", 0xeb5198eb, 0xe7f5, 0x45a1, 0x9c, 0xcb, 0xe5, 0x33, 0x64, 0xbb, 0x49, 0x92)
+GUID_ENTRY("AMI_STANDARD_DEFAULTS_VARIABLE_GUID", 0x4599d26f, 0x1a11, 0x49b8, 0xb9, 0x1f, 0x85, 0x87, 0x45, 0xcf, 0xf8, 0x24)
+GUID_ENTRY("AMI_STATUS_CODE_CPU_BIST_DATA_GUID", 0xcd541d77, 0x6699, 0x4b36, 0xa3, 0x1e, 0x1a, 0xa4, 0xc5, 0xd5, 0xb9, 0x46)
+GUID_ENTRY("AMI_TCG_CONFIRMATION_FLAGS_GUID", 0x7d3dceee, 0xcbce, 0x4ea7, 0x87, 0x09, 0x6e, 0x55, 0x2f, 0x1e, 0xdb, 0xde)
+GUID_ENTRY("AMI_TCG_EFI_OS_VARIABLE_GUID", 0xa8a2093b, 0xfefa, 0x43c1, 0x8e, 0x62, 0xce, 0x52, 0x68, 0x47, 0x26, 0x5e)
+GUID_ENTRY("AMI_TCG_PERM_FLAGS_GUID", 0x2325f2fc, 0x5683, 0x4648, 0x97, 0xc4, 0x9a, 0x52, 0x0d, 0xfb, 0xe3, 0x25)
+GUID_ENTRY("AMI_TCG_PLATFORM_PPI_AFTER_MEM_GUID", 0x890c2cef, 0x43c8, 0x4209, 0xa7, 0x8d, 0xae, 0x14, 0xaa, 0x17, 0x98, 0xb4)
+GUID_ENTRY("AMI_TCG_PLATFORM_PPI_BEFORE_MEM_GUID", 0xc1e6791d, 0xf35b, 0x43ef, 0x92, 0xa, 0xbe, 0x6, 0xba, 0x7f, 0x86, 0xa1)
+GUID_ENTRY("AMI_TCG_PLATFORM_PPI_GUID", 0x5687f4a, 0x3ca7, 0x4d19, 0x9b, 0xc5, 0xe1, 0x80, 0xce, 0xa3, 0x56, 0x9f)
+GUID_ENTRY("AMI_TCG_PLATFORM_PROTOCOL_GUID", 0x320bdc39, 0x3fa0, 0x4ba9, 0xbf, 0x2d, 0xb3, 0x3f, 0x72, 0xba, 0x9c, 0xa1)
+GUID_ENTRY("AMI_TCG_RESETVAR_HOB_GUID", 0xa8a2093b, 0xfefa, 0x43c1, 0x8e, 0x62, 0xce, 0x52, 0x68, 0x47, 0x26, 0x5e)
+GUID_ENTRY("AMI_USB_SMM_PROTOCOL_GUID", 0x3ef7500e, 0xcf55, 0x474f, 0x8e, 0x7e, 0x0, 0x9e, 0xe, 0xac, 0xec, 0xd2)
+GUID_ENTRY("AMT_FORCE_PUSH_PET_HOB_GUID", 0x4efa0db6, 0x26dc, 0x4bb1, 0xa7, 0x6f, 0x14, 0xbc, 0x63, 0x0c, 0x7b, 0x3c)
+GUID_ENTRY("AMT_FORCE_PUSH_PET_POLICY_GUID", 0xacc8e1e4, 0x9f9f, 0x4e40, 0xa5, 0x7e, 0xf9, 0x9e, 0x52, 0xf3, 0x4c, 0xa5)
+GUID_ENTRY("AMT_FORCE_PUSH_PET_VARIABLE_GUID", 0xd7ac94af, 0xa498, 0x45ec, 0xbf, 0xa2, 0xa5, 0x6e, 0x95, 0x34, 0x61, 0x8b)
+GUID_ENTRY("AMT_INT16_CSM_GUID", 0x6046e678, 0x24ef, 0x4005, 0xba, 0x39, 0xbd, 0xa1, 0x1f, 0x6d, 0x55, 0x5d)
+GUID_ENTRY("AMT_READY_TO_BOOT_PROTOCOL_GUID", 0x40b09b5a, 0xf0ef, 0x4627, 0x93, 0xd5, 0x27, 0xf0, 0x4b, 0x75, 0x4d, 0x5)
+GUID_ENTRY("AOAC_EC_WAKEUP_CUSTOM_PPI_GUID", 0x82627acf, 0xd92d, 0x416d, 0x8a, 0x6f, 0x78, 0x3c, 0xac, 0xd9, 0x12, 0x23)
+GUID_ENTRY("AOAC_FFS_TABLE_STORAGE_GUID", 0xfb045db2, 0x598e, 0x485a, 0xba, 0x30, 0x5d, 0x7b, 0x1b, 0x1b, 0xd5, 0x4d)
+GUID_ENTRY("APTIO_FW_CAPSULE_GUID", 0x4A3CA68B, 0x7723, 0x48FB, 0x80, 0x3d, 0x57, 0x8c, 0xc1, 0xfe, 0xc4, 0x4d)
+GUID_ENTRY("APTIO_HII_PROTOCOL_GUID", 0xea816d2c, 0xcee5, 0x4f02, 0x99, 0xb5, 0xd3, 0x90, 0x5c, 0xbb, 0xd0, 0x77)
+GUID_ENTRY("AUTHVAR_MAILBOX_VARIABLE_GUID", 0x532B6532, 0x6499, 0x428D, 0xAC, 0xB1, 0xF6, 0xF7, 0x79, 0xC9, 0x4D, 0xF9)
+GUID_ENTRY("BDS_ALL_DRIVERS_CONNECTED_PROTOCOL_GUID", 0xdbc9fd21, 0xfad8, 0x45b0, 0x9e, 0x78, 0x27, 0x15, 0x88, 0x67, 0xcc, 0x93)
+GUID_ENTRY("BDS_CONNECT_DRIVERS_PROTOCOL_GUID", 0x3aa83745, 0x9454, 0x4f7a, 0xa7, 0xc0, 0x90, 0xdb, 0xd0, 0x2f, 0xab, 0x8e)
+GUID_ENTRY("BLOCK_DEVICE_RECOVERY_CAPSULE_GUID", 0xba8263c, 0xa8bd, 0x4aad, 0xb4, 0x2, 0x6a, 0x6a, 0xf2, 0xf7, 0xe7, 0x7d)
+GUID_ENTRY("BOOT_FLOW_VARIABLE_GUID", 0xEF152FB4, 0x7B2F, 0x427D, 0xBD, 0xB4, 0x7E, 0x0A, 0x05, 0x82, 0x6E, 0x64)
+GUID_ENTRY("BOOT_FORM_SET_GUID", 0x8b33ffe0, 0xd71c, 0x4f82, 0x9c, 0xeb, 0xc9, 0x70, 0x58, 0xc1, 0x3f, 0x8e)
+GUID_ENTRY("BOOT_MANAGER_GUID", 0xB4909CF3, 0x7B93, 0x4751, 0x9B, 0xD8, 0x5B, 0xA8, 0x22, 0x0B, 0x9B, 0xB2)
+GUID_ENTRY("BOOT_NOW_COUNT_GUID", 0x052e6eb0, 0xf240, 0x42c5, 0x83, 0x09, 0x45, 0x87, 0x45, 0x45, 0xc6, 0xb4)
+GUID_ENTRY("CHIPSET_FORM_SET_GUID", 0xadfe34c8, 0x9ae1, 0x4f8f, 0xbe, 0x13, 0xcf, 0x96, 0xa2, 0xcb, 0x2c, 0x5b)
+GUID_ENTRY("CMOS_MANAGER_HOB_GUID", 0xd5367802, 0xb873, 0x4c0f, 0xb5, 0x44, 0x31, 0xb7, 0xcc, 0xf5, 0xc5, 0x55)
+GUID_ENTRY("CONSOLE_IN_DEVICES_STARTED_PROTOCOL_GUID", 0x2df1e051, 0x906d, 0x4eff, 0x86, 0x9d, 0x24, 0xe6, 0x53, 0x78, 0xfb, 0x9e)
+GUID_ENTRY("CONSOLE_OUT_DEVICES_STARTED_PROTOCOL_GUID", 0xef9a3971, 0xc1a0, 0x4a93, 0xbd, 0x40, 0x5a, 0xa1, 0x65, 0xf2, 0xdc, 0x3a)
+GUID_ENTRY("CPU_MICROCODE_FILE_GUID", 0x17088572, 0x377F, 0x44ef, 0x8F, 0x4E, 0xB0, 0x9F, 0xFF, 0x46, 0xA0, 0x70)
+GUID_ENTRY("CPU_WAKE_UP_BUFFER_VARIABLE_GUID", 0xdf665292, 0x79d7, 0x40e2, 0xba, 0x51, 0xf7, 0xd4, 0x94, 0x62, 0x81, 0x85)
+GUID_ENTRY("CSM_VIDEO_POLICY_PROTOCOL_GUID", 0x3a4e4376, 0x4871, 0x4b0e, 0xa0, 0x2f, 0xed, 0x36, 0xf2, 0xae, 0xcd, 0x0)
+GUID_ENTRY("DCA_HOB_GUID", 0x6865c455, 0x8626, 0x40d8, 0x90, 0xf4, 0xa6, 0x94, 0x60, 0xa4, 0xab, 0x5a)
+GUID_ENTRY("DEBUGGER_TERMINAL_VAR_GUID", 0x97ca1a5b, 0xb760, 0x4d1f, 0xa5, 0x4b, 0xd1, 0x90, 0x92, 0x3, 0x2c, 0x90)
+GUID_ENTRY("DEFINE_GUID_CRBDXEBin_GUID", 0x16271fca, 0x55d9, 0x4a33, 0x93, 0xfc, 0x5a, 0x3e, 0xb1, 0x28, 0xde, 0xb6)
+GUID_ENTRY("DEFINE_GUID_CRBSMIBin_GUID", 0x221f1d4f, 0x034c, 0x4bea, 0xb2, 0xbb, 0xb7, 0xa9, 0x67, 0x2b, 0x06, 0xd7)
+GUID_ENTRY("DEFINE_GUID_AcpiPlatformPeiBin_GUID", 0x333bb2a3, 0x4f20, 0x4c8b, 0xac, 0x38, 0x6, 0x72, 0xd7, 0x43, 0x15, 0xf8)
+GUID_ENTRY("DEFINE_GUID_OEMPEIBin_GUID", 0x6e59df06, 0x62d3, 0x40b0, 0x82, 0xb5, 0x17, 0x5c, 0xf8, 0x4a, 0x94, 0xe4)
+GUID_ENTRY("DEFINE_GUID_SBDXEBin_GUID", 0xb7d19491, 0xe55a, 0x470d, 0x85, 0x8, 0x85, 0xa5, 0xdf, 0xa4, 0x19, 0x74)
+GUID_ENTRY("DEFINE_GUID_OEMDXEBin_GUID", 0xbfe205c9, 0x5b17, 0x4f8f, 0x93, 0x75, 0x89, 0x61, 0x4a, 0xf8, 0xe1, 0x99)
+GUID_ENTRY("DEFINE_GUID_SBPEIBin_GUID", 0xc1fbd624, 0x27ea, 0x40d1, 0xaa, 0x48, 0x94, 0xc3, 0xdc, 0x5c, 0x7e, 0xd)
+GUID_ENTRY("DEFINE_GUID_CRBPEIBin_GUID", 0xd1ed2f7, 0xe92b, 0x4562, 0x92, 0xdd, 0x5c, 0x82, 0xec, 0x91, 0x7e, 0xae)
+GUID_ENTRY("DEFINE_GUID_AcpiPlatformSmiBin_GUID", 0xdfd8d5cc, 0x5aed, 0x4820, 0xa2, 0xb6, 0x5c, 0x55, 0xe4, 0xe6, 0x40, 0xef)
+GUID_ENTRY("DEFINE_GUID_NBPEIBin_GUID", 0x79aa6086, 0x035a, 0x4ad9, 0xa8, 0x9a, 0xa6, 0xd5, 0xaa, 0x27, 0xf0, 0xe2)
+GUID_ENTRY("DEFINE_GUID_NBDXEBin_GUID", 0xe4ecd0b2, 0xe277, 0x4f2b, 0xbe, 0xcb, 0xe4, 0xd7, 0x5c, 0x9a, 0x81, 0x2e)
+GUID_ENTRY("DEFINE_GUID_SBRunBin_GUID", 0xe23f86e1, 0x056e, 0x4888, 0xb6, 0x85, 0xcf, 0xcd, 0x67, 0xc1, 0x79, 0xd4)
+GUID_ENTRY("DEL_BOOT_OPTION_GUID", 0xF6C73719, 0xF34C, 0x479C, 0xB3, 0x2F, 0x27, 0x7F, 0xCB, 0xBC, 0xFE, 0x4F)
+GUID_ENTRY("DIMM_TS_INFO_GUID", 0xce673a28, 0x800d, 0x4b4a, 0x83, 0x16, 0x26, 0x61, 0xf9, 0xb3, 0xd9, 0xc6)
+GUID_ENTRY("DXE_CPU_CACHE_PROTOCOL_GUID", 0x5c6fa2c9, 0x9768, 0x45f6, 0x8e, 0x64, 0x5a, 0xec, 0xca, 0xda, 0xb4, 0x81)
+GUID_ENTRY("DXE_CPU_INFO_PROTOCOL_GUID", 0xe223cf65, 0xf6ce, 0x4122, 0xb3, 0xaf, 0x4b, 0xd1, 0x8a, 0xff, 0x40, 0xa1)
+GUID_ENTRY("DXE_CPU_PLATFORM_POLICY_PROTOCOL_GUID", 0xbd26cdc9, 0xa092, 0x462a, 0x87, 0x7a, 0x5a, 0xb6, 0xad, 0xce, 0x48, 0x12)
+GUID_ENTRY("DXE_ENHANCED_SPEEDSTEP_PROTOCOL_GUID", 0xe98021, 0xf4fe, 0x46cc, 0xab, 0x2d, 0x89, 0x4c, 0x37, 0x3a, 0xfa, 0x1)
+GUID_ENTRY("DXE_PCH_PLATFORM_POLICY_PROTOCOL_GUID", 0xe0a31dbe, 0xf20e, 0x4e2a, 0x9f, 0x2b, 0x9f, 0x2, 0xa2, 0x7d, 0x3d, 0x69)
+GUID_ENTRY("DXE_PLATFORM_AMT_POLICY_GUID", 0xb2ab115e, 0xc8b6, 0x4036, 0xbf, 0x31, 0xe7, 0x4b, 0xd8, 0x92, 0x6c, 0xce)
+GUID_ENTRY("DXE_PLATFORM_ME_POLICY_GUID", 0xf8bff014, 0x18fb, 0x4ef9, 0xb1, 0xc, 0xae, 0x22, 0x73, 0x8d, 0xbe, 0xed)
+GUID_ENTRY("DXE_PLATFORM_SA_POLICY_GUID", 0xCD2333D7, 0x6A0A, 0x4C76, 0x83, 0x50, 0x24, 0xA, 0xDA, 0x36, 0xA2, 0xC7)
+GUID_ENTRY("DXE_PLATFORM_SG_POLICY_GUID", 0x6199dc36, 0xe114, 0x4e0d, 0x80, 0x99, 0x99, 0xa0, 0xbd, 0x80, 0xa9, 0x71)
+GUID_ENTRY("DXE_PLATFORM_TDT_POLICY_GUID", 0x20daf0fc, 0x5548, 0x44dc, 0xa4, 0x2a, 0x60, 0xea, 0xf0, 0xa2, 0x2e, 0x47)
+GUID_ENTRY("DXE_TXT_POLICY_PROTOCOL_GUID", 0x43F66FFD, 0xB288, 0x4139, 0xBA, 0xD5, 0xB8, 0x98, 0x3, 0xE7, 0x30, 0xA2)
+GUID_ENTRY("DYNAMIC_PAGE_COUNT_GUID", 0xb63bf800, 0xf267, 0x4f55, 0x92, 0x17, 0xe9, 0x7f, 0xb3, 0xb6, 0x98, 0x46)
+GUID_ENTRY("EFI_ACPI_VARIABLE_GUID", 0xaf9ffd67, 0xec10, 0x488a, 0x9d, 0xfc, 0x6c, 0xbf, 0x5e, 0xe2, 0x2c, 0x2e)
+GUID_ENTRY("EFI_ACTIVE_BIOS_PROTOCOL_GUID", 0xebbe2d1b, 0x1647, 0x4bda, 0xab, 0x9a, 0x78, 0x63, 0xe3, 0x96, 0xd4, 0x1a)
+GUID_ENTRY("EFI_ACTIVE_MANAGEMENT_PROTOCOL_GUID", 0x8555fd40, 0x140b, 0x4f3c, 0x90, 0x5e, 0x3b, 0xf3, 0x78, 0xa0, 0x99, 0xfa)
+GUID_ENTRY("EFI_AHCI_INT13_INIT_PROTOCOL_GUID", 0x67820532, 0x7613, 0x4dd3, 0x9e, 0xd7, 0x3d, 0x9b, 0xe3, 0xa7, 0xda, 0x63)
+GUID_ENTRY("EFI_ALERT_STANDARD_FORMAT_PROTOCOL_GUID", 0xcc93a70b, 0xec27, 0x49c5, 0x8b, 0x34, 0x13, 0x93, 0x1e, 0xfe, 0xd6, 0xe2)
+GUID_ENTRY("EFI_AMI_LEGACYBOOT_PROTOCOL_GUID", 0x120d28aa, 0x6630, 0x46f0, 0x81, 0x57, 0xc0, 0xad, 0xc2, 0x38, 0x3b, 0xf5)
+GUID_ENTRY("EFI_AUTHORIZATION_PROTOCOL_GUID", 0x995188b1, 0x9f96, 0x11d4, 0x87, 0xae, 0x00, 0x06, 0x29, 0x2e, 0x8a, 0x3b)
+GUID_ENTRY("EFI_BDAT_ACCESS_GUID", 0xb979746a, 0x8c1f, 0x4a2b, 0x97, 0xe4, 0x78, 0xe9, 0x3a, 0x71, 0xa7, 0xa)
+GUID_ENTRY("EFI_CACHE_INSTALL_PPI_GUID", 0xbb628ae0, 0xcd4f, 0x49fe, 0x8d, 0x60, 0x63, 0x18, 0x6f, 0xd1, 0xe0, 0x5b)
+GUID_ENTRY("EFI_CAPSULE_AMI_GUID", 0xfac2efad, 0x8511, 0x4e34, 0x9c, 0xae, 0x16, 0xa2, 0x57, 0xba, 0x94, 0x88)
+GUID_ENTRY("EFI_CLP_PROTOCOL_GUID", 0xcbbee336, 0x2682, 0x4cd6, 0x81, 0x8b, 0xa, 0xd, 0x96, 0x7e, 0x5a, 0x67)
+GUID_ENTRY("EFI_CMOS_DATA_HOB_INSTALLED_GUID", 0x5a6a93f4, 0x2907, 0x4a34, 0xbd, 0x11, 0x6c, 0xa8, 0xa0, 0x95, 0x9e, 0x9)
+GUID_ENTRY("EFI_CONSOLE_LOCK_GUID", 0x368cda0d, 0xcf31, 0x4b9b, 0x8c, 0xf6, 0xe7, 0xd1, 0xbf, 0xff, 0x15, 0x7e)
+GUID_ENTRY("EFI_CPU_TYPE_FRU_GUID", 0xf064c91f, 0x188c, 0x4f56, 0xb7, 0xfd, 0x30, 0xa9, 0xb8, 0x6a, 0x29, 0xf3)
+GUID_ENTRY("EFI_DEBUG_MASK_PPI_GUID", 0x3bd930fd, 0xf823, 0x4948, 0x86, 0x91, 0x98, 0xe6, 0xfe, 0x36, 0xac, 0xe2)
+GUID_ENTRY("EFI_DMI_FORMAT_FRU_GUID", 0x67ef7a73, 0x2594, 0x4a5e, 0x93, 0xa, 0xe1, 0x66, 0xfa, 0xbc, 0xd2, 0xc8)
+GUID_ENTRY("EFI_DXE_CMOS_ACCESS_GUID", 0x9851740c, 0x22e0, 0x440d, 0x90, 0x90, 0xef, 0x2d, 0x71, 0xc2, 0x51, 0xc9)
+GUID_ENTRY("EFI_EMUL6064KBDINPUT_PROTOCOL_GUID", 0x62ceef5a, 0x1d7c, 0x4943, 0x9b, 0x3a, 0x95, 0xe2, 0x49, 0x4c, 0x89, 0x90)
+GUID_ENTRY("EFI_EMUL6064MSINPUT_PROTOCOL_GUID", 0x7578b307, 0xb25b, 0x44f9, 0x89, 0x2e, 0x20, 0x9b, 0x0e, 0x39, 0x93, 0xc6)
+GUID_ENTRY("EFI_EMUL6064TRAP_PROTOCOL_GUID", 0x6ea0f71c, 0x614a, 0x437e, 0x8f, 0x49, 0x24, 0x3a, 0xd4, 0xe8, 0x32, 0x68)
+GUID_ENTRY("EFI_GLOBAL_NVS_AREA_PROTOCOL_GUID", 0x74e1e48, 0x8132, 0x47a1, 0x8c, 0x2c, 0x3f, 0x14, 0xad, 0x9a, 0x66, 0xdc)
+GUID_ENTRY("EFI_GPIO_PROTOCOL_GUID", 0xb5d09084, 0x80ad, 0x4759, 0xb5, 0x1c, 0x27, 0x54, 0x8a, 0xfb, 0x8b, 0x8d)
+GUID_ENTRY("EFI_GUID_UNKNOWN", 0x0f729f33, 0x25c1, 0x41a7, 0x86, 0xb2, 0x23, 0xa7, 0x37, 0xa9, 0x18, 0x23)
+GUID_ENTRY("EFI_GUID_UNKNOWN1", 0x142204e2, 0xc7b1, 0x4af9, 0xa7, 0x29, 0x92, 0x37, 0x58, 0xd9, 0x6d, 0x3)
+GUID_ENTRY("EFI_GUID_UNKNOWN2", 0x1E753E16, 0xDCEF, 0x47d0, 0x9A, 0x38, 0x7A, 0xDE, 0xCD, 0xB9, 0x83, 0xED)
+GUID_ENTRY("EFI_GUID_UNKNOWN3", 0x45d68db9, 0x8b4e, 0x48c0, 0x99, 0xe9, 0xf2, 0x1f, 0x26, 0x2d, 0xb6, 0x53)
+GUID_ENTRY("EFI_GUID_UNKNOWN4", 0x4eaaaa1, 0x29a1, 0x11d7, 0x88, 0x38, 0x0, 0x50, 0x4, 0x73, 0xd4, 0xeb)
+GUID_ENTRY("EFI_GUID_UNKNOWN5", 0x6298fe18, 0xd5ef, 0x42b7, 0xbb, 0xc, 0x29, 0x53, 0x28, 0x3f, 0x57, 0x4)
+GUID_ENTRY("EFI_GUID_UNKNOWN6", 0x7d113aa9, 0x6280, 0x48c6, 0xba, 0xce, 0xdf, 0xe7, 0x66, 0x8e, 0x83, 0x7)
+GUID_ENTRY("EFI_GUID_UNKNOWN7", 0x878AC2CC, 0x5343, 0x46F2, 0xB5, 0x63, 0x51, 0xF8, 0x9D, 0xAF, 0x56, 0xBA)
+GUID_ENTRY("EFI_GUID_UNKNOWN8", 0x8983fd2d, 0x113c, 0x4e2b, 0x8f, 0x47, 0xa, 0xbf, 0xeb, 0x20, 0xa4, 0x1a)
+GUID_ENTRY("EFI_GUID_UNKNOWN9", 0x8ff925f1, 0x8624, 0x4d38, 0x9e, 0xd2, 0xf8, 0xf5, 0xaa, 0x94, 0xf8, 0x4a)
+GUID_ENTRY("EFI_GUID_UNKNOWN10", 0x9cc55d7d, 0xfbff, 0x431c, 0xbc, 0x14, 0x33, 0x4e, 0xae, 0xa6, 0x5, 0x2b)
+GUID_ENTRY("EFI_GUID_UNKNOWN11", 0x9d7a05e9, 0xf740, 0x44c3, 0x85, 0x8b, 0x75, 0x58, 0x6a, 0x8f, 0x9c, 0x8e)
+GUID_ENTRY("EFI_GUID_UNKNOWN12", 0x9fe7de69, 0xaea, 0x470a, 0xb5, 0xa, 0x13, 0x98, 0x13, 0x64, 0x91, 0x89)
+GUID_ENTRY("EFI_GUID_UNKNOWN13", 0xCC0F8A3F, 0x3DEA, 0x4376, 0x96, 0x79, 0x54, 0x26, 0xba, 0x0a, 0x90, 0x7e)
+GUID_ENTRY("EFI_GUID_UNKNOWN14", 0xa6a72875, 0x2962, 0x4c18, 0x9f, 0x46, 0x8d, 0xa6, 0x44, 0xcc, 0xfe, 0x00)
+GUID_ENTRY("EFI_GUID_UNKNOWN15", 0xaa31bc6, 0x3379, 0x41e8, 0x82, 0x5a, 0x53, 0xf8, 0x2c, 0xc0, 0xf2, 0x54)
+GUID_ENTRY("EFI_GUID_UNKNOWN16", 0xabb74f50, 0xfd2d, 0x4072, 0xa3, 0x21, 0xca, 0xfc, 0x72, 0x97, 0x7e, 0xfa)
+GUID_ENTRY("EFI_GUID_UNKNOWN17", 0xbb2f3c9d, 0xc7a1, 0x4283, 0x8a, 0xe2, 0x4f, 0x43, 0x62, 0x99, 0x0e, 0x2e)
+GUID_ENTRY("EFI_GUID_UNKNOWN18", 0xc1bdd34e, 0x9ec0, 0x48aa, 0x80, 0x6a, 0x6c, 0x2e, 0xba, 0x0d, 0xc4, 0x45)
+GUID_ENTRY("EFI_GUID_UNKNOWN19", 0xedd35e31, 0x7b9, 0x11d2, 0x83, 0xa3, 0x00, 0xa0, 0xc9, 0x1f, 0xad, 0xcf)
+GUID_ENTRY("EFI_GUID_UNKNOWN20", 0xf8e21975, 0x0899, 0x4f58, 0xa4, 0xbe, 0x55, 0x25, 0xa9, 0xc6, 0xd7, 0x7a)
+GUID_ENTRY("EFI_GUID_UNKNOWN21", 0xfbf95065, 0x427f, 0x47b3, 0x80, 0x77, 0xd1, 0x3c, 0x60, 0x71, 0x9, 0x98)
+GUID_ENTRY("EFI_HII_EXT_PROTOCOL_GUID", 0x2a57ae75, 0x8b7a, 0x4c64, 0x86, 0x56, 0xdb, 0x51, 0xdd, 0xc3, 0x6f, 0x7b)
+GUID_ENTRY("EFI_HII_OLD_PROTOCOL_GUID", 0xcd361957, 0xafbe, 0x425e, 0xa3, 0x58, 0x5f, 0x58, 0x89, 0xcf, 0xfe, 0x7b)
+GUID_ENTRY("EFI_HOT_KEYS_PROTOCOL_GUID", 0xf1e48287, 0x3fe1, 0x4535, 0x89, 0xab, 0x48, 0xd6, 0xc3, 0xda, 0x27, 0x59)
+GUID_ENTRY("EFI_HT_BIST_HOB_GUID", 0xbe644001, 0xe7d4, 0x48b1, 0xb0, 0x96, 0x8b, 0xa0, 0x47, 0xbc, 0x7a, 0xe7)
+GUID_ENTRY("EFI_IDER_CONTROLLER_DRIVER_PROTOCOL_GUID", 0x956a2ed0, 0xa6cf, 0x409a, 0xb8, 0xf5, 0x35, 0xf1, 0x4c, 0x3e, 0x3c, 0x2)
+GUID_ENTRY("EFI_INTEL_MFG_FORMAT_FRU_GUID", 0x79e8c9c7, 0x1152, 0x4f00, 0xb8, 0x31, 0x14, 0xf1, 0xc4, 0x4, 0x1a, 0xe0)
+GUID_ENTRY("EFI_IP_PROTOCOL_GUID", 0x89DEEF37, 0x31D8, 0x469C, 0x95, 0xB6, 0x01, 0x69, 0xBC, 0x86, 0x6C, 0xFB)
+GUID_ENTRY("EFI_LEGACY_BIOS_EXT_PROTOCOL_GUID", 0x8e008510, 0x9bb1, 0x457d, 0x9f, 0x70, 0x89, 0x7a, 0xba, 0x86, 0x5d, 0xb9)
+GUID_ENTRY("EFI_LEGACY_SREDIR_PROTOCOL_GUID", 0xA062CF1F, 0x8473, 0x4aa3, 0x87, 0x93, 0x60, 0x0B, 0xC4, 0xFF, 0xA9, 0xA9)
+GUID_ENTRY("EFI_LIGHT_ISA_IO_PROTOCOL_GUID", 0x7cc7ed80, 0x9a68, 0x4781, 0x80, 0xe4, 0xda, 0x16, 0x99, 0x10, 0x5a, 0xfe)
+GUID_ENTRY("EFI_MEMORY_CONFIG_DATA_GUID", 0x80dbd530, 0xb74c, 0x4f11, 0x8c, 0x03, 0x41, 0x86, 0x65, 0x53, 0x28, 0x31)
+GUID_ENTRY("EFI_MEMORY_SUBCLASS_DRIVER_GUID", 0x1767CEED, 0xDB82, 0x47cd, 0xBF, 0x2B, 0x68, 0x45, 0x8A, 0x8C, 0xCF, 0xFF)
+GUID_ENTRY("EFI_MEMORY_TYPE_FRU_GUID", 0xd50234f4, 0x6f4b, 0x43e8, 0xa0, 0x13, 0x3c, 0x1e, 0x33, 0xd9, 0xb9, 0xb1)
+GUID_ENTRY("EFI_ME_BIOS_EXTENSION_SETUP_GUID", 0x1bad711c, 0xd451, 0x4241, 0xb1, 0xf3, 0x85, 0x37, 0x81, 0x2e, 0xc, 0x70)
+GUID_ENTRY("EFI_ME_FW_SKU_VARIABLE_GUID", 0xe1a21d94, 0x4a20, 0x4e0e, 0xae, 0x9, 0xa9, 0xa2, 0x1f, 0x24, 0xbb, 0x9e)
+GUID_ENTRY("EFI_ME_RC_INFO_PROTOCOL_GUID", 0x11fbfdfb, 0x10d2, 0x43e6, 0xb5, 0xb1, 0xb4, 0x38, 0x6e, 0xdc, 0xcb, 0x9a)
+GUID_ENTRY("EFI_MISC_SUBCLASS_DRIVER_GUID", 0xF50E702C, 0x8653, 0x4CDE, 0xBB, 0xCE, 0x43, 0xB4, 0xD5, 0x5B, 0x34, 0xB8)
+GUID_ENTRY("EFI_NB_ERROR_LOG_DISPATCH_PROTOCOL_GUID", 0xff2d54d4, 0x5c55, 0x4c06, 0x85, 0x49, 0xc3, 0x62, 0x7c, 0xb8, 0xb9, 0x95)
+GUID_ENTRY("EFI_NB_MRC_INFO_GUID", 0xd7bd52b0, 0xb2dc, 0x4f08, 0xb4, 0x67, 0xde, 0x50, 0xd7, 0x28, 0xf6, 0xbd)
+GUID_ENTRY("EFI_NONSMMEMUL6064TRAP_PROTOCOL_GUID", 0x68b81e51, 0x2583, 0x4582, 0x95, 0xdb, 0xc5, 0x72, 0x32, 0x36, 0xc4, 0xf1)
+GUID_ENTRY("EFI_PCCARD_CS_PROTOCOL_GUID", 0xca54f443, 0x1ef2, 0x4dab, 0x9e, 0x7e, 0x6d, 0xb7, 0xb7, 0x20, 0xb5, 0x87)
+GUID_ENTRY("EFI_PCCARD_SS_PROTOCOL_GUID", 0xc38e6d34, 0x5a7f, 0x4bf9, 0xbe, 0x57, 0x94, 0xdd, 0x30, 0x38, 0x02, 0x76)
+GUID_ENTRY("EFI_PCH_INFO_PROTOCOL_GUID", 0x984eb4e9, 0x5a95, 0x41de, 0xaa, 0xd0, 0x53, 0x66, 0x8c, 0xa5, 0x13, 0xc0)
+GUID_ENTRY("EFI_PCH_S3_IMAGE_GUID", 0x271dd6f2, 0x54cb, 0x45e6, 0x85, 0x85, 0x8c, 0x92, 0x3c, 0x1a, 0xc7, 0x6)
+GUID_ENTRY("EFI_PCH_S3_SUPPORT_PROTOCOL_GUID", 0xe287d20b, 0xd897, 0x4e1e, 0xa5, 0xd9, 0x97, 0x77, 0x63, 0x93, 0x6a, 0x4)
+GUID_ENTRY("EFI_PCMCIA_REQUEST_PROTOCOL_GUID", 0xf238f47c, 0x1de9, 0x4e8b, 0x81, 0xb9, 0xcc, 0x92, 0x4e, 0x6b, 0x5b, 0xe5)
+GUID_ENTRY("EFI_PEI_AMI_KEYCODE_PPI_GUID", 0x20b0f1c2, 0xb0d8, 0x4c5d, 0xaa, 0xd9, 0xf4, 0x45, 0x80, 0xdf, 0xdf, 0x8b)
+GUID_ENTRY("EFI_PEI_CAPSULE_PPI_GUID", 0x66785b1, 0xedb8, 0x46dc, 0x84, 0x2f, 0x57, 0x44, 0x4, 0xb8, 0x69, 0x2f)
+GUID_ENTRY("EFI_PEI_CMOS_ACCESS_GUID", 0xccbf2786, 0xcd6c, 0x4308, 0xbd, 0xfa, 0x62, 0x58, 0x70, 0xce, 0xbf, 0x81)
+GUID_ENTRY("EFI_PEI_CONSPLIT_AMI_KEYCODE_PPI_GUID", 0x73ddb5e1, 0x5fb4, 0x4751, 0xaf, 0x1e, 0x83, 0xcf, 0x75, 0xbe, 0xcb, 0xb6)
+GUID_ENTRY("EFI_PEI_CORE_PRIVATE_GUID", 0xd641a0f5, 0xcb7c, 0x4846, 0xa3, 0x80, 0x1d, 0x01, 0xb4, 0xd9, 0xe3, 0xb9)
+GUID_ENTRY("EFI_PEI_LOADED_IMAGE_PPI_GUID", 0xa62a3fff, 0x97f0, 0x4332, 0x8c, 0xfd, 0x1e, 0x34, 0x3d, 0x36, 0x31, 0xf2)
+GUID_ENTRY("EFI_PEI_LOADED_IMAGE_PPI_GUID2", 0xc1fcd448, 0x6300, 0x4458, 0xb8, 0x64, 0x28, 0xdf, 0x01, 0x53, 0x64, 0xbc)
+GUID_ENTRY("EFI_PEI_PLATFORMPEI_EXECUTED_PPI_GUID", 0x8C72C36E, 0xDACC, 0x4E81, 0x8D, 0x60, 0xFF, 0xA6, 0x1D, 0x88, 0xFF, 0x54)
+GUID_ENTRY("EFI_PLATFORM_GOP_POLICY_PROTOCOL_GUID", 0xec2e931b, 0x3281, 0x48a5, 0x81, 0x7, 0xdf, 0x8a, 0x8b, 0xed, 0x3c, 0x5d)
+GUID_ENTRY("EFI_PLATFORM_INFO_PROTOCOL_GUID", 0xd9035175, 0x8ce2, 0x47de, 0xa8, 0xb8, 0xcc, 0x98, 0xe5, 0xe2, 0xa8, 0x85)
+GUID_ENTRY("EFI_POWER_ON_HOB_GUID", 0x468a601, 0xc535, 0x46fd, 0xa9, 0x5d, 0xbb, 0xab, 0x99, 0x1b, 0x17, 0x8c)
+GUID_ENTRY("EFI_PPM_GLOBAL_NVS_AREA_PROTOCOL_GUID", 0x6c50cdcb, 0x7f46, 0x4dcc, 0x8d, 0xdd, 0xd9, 0xf0, 0xa3, 0xc6, 0x11, 0x28)
+GUID_ENTRY("EFI_PPM_INFO_PROTOCOL_GUID", 0xd71db106, 0xe32d, 0x4225, 0xbf, 0xf4, 0xde, 0x6d, 0x77, 0x87, 0x17, 0x61)
+GUID_ENTRY("EFI_SA_INFO_PROTOCOL_GUID", 0x493b5bac, 0xbb9e, 0x4bf5, 0x83, 0x79, 0x20, 0xe2, 0xac, 0xa9, 0x85, 0x41)
+GUID_ENTRY("EFI_SB_PCIE_ERROR_LOG_DISPATCH_PROTOCOL_GUID", 0xf281fc6e, 0xf4c4, 0x431c, 0x96, 0x2b, 0x2f, 0x13, 0xae, 0x79, 0x84, 0xec)
+GUID_ENTRY("EFI_SEC_SMI_FLASH_GUID", 0x3bf4af16, 0xab7c, 0x4b43, 0x89, 0x8d, 0xab, 0x26, 0xac, 0x5d, 0xdc, 0x6c)
+GUID_ENTRY("EFI_SERIAL_GPIO_PROTOCOL_GUID", 0xf52c3858, 0x5ef8, 0x4d41, 0x83, 0x4e, 0xc3, 0x9e, 0xef, 0x8a, 0x45, 0xa3)
+GUID_ENTRY("EFI_SIMPLE_AUDIO_OUT_PROTOCOL_GUID", 0xc723f288, 0x52f9, 0x4d80, 0xb6, 0x33, 0xe1, 0x52, 0xf9, 0x30, 0xa0, 0xdc)
+GUID_ENTRY("EFI_SMBIOS_BOARD_PROTOCOL_GUID", 0x903dd14, 0x2ca0, 0x458a, 0xb5, 0xeb, 0xc, 0xc, 0xa3, 0xd, 0x78, 0x5c)
+GUID_ENTRY("EFI_SMBIOS_DYNAMIC_DATA_GUID", 0xe380280c, 0x4c35, 0x4aa3, 0xb9, 0x61, 0x7a, 0xe4, 0x89, 0xa2, 0xb9, 0x26)
+GUID_ENTRY("EFI_SMBIOS_NVRAM_DATA_GUID", 0x4b3082a3, 0x80c6, 0x4d7e, 0x9c, 0xd0, 0x58, 0x39, 0x17, 0x26, 0x5d, 0xf1)
+GUID_ENTRY("EFI_SMBIOS_PROTOCOL_GUID", 0x5e90a50d, 0x6955, 0x4A49, 0x90, 0x32, 0xda, 0x38, 0x12, 0xf8, 0xe8, 0xe5)
+GUID_ENTRY("EFI_SMBIOS_STATIC_DATA_GUID", 0xdaf4bf89, 0xce71, 0x4917, 0xb5, 0x22, 0xc8, 0x9d, 0x32, 0xfb, 0xc5, 0x9f)
+GUID_ENTRY("EFI_SMBUS_ARP_MAP_GUID", 0x707be83e, 0x0bf6, 0x40A5, 0xbe, 0x64, 0x34, 0xc0, 0x3a, 0xa0, 0xb8, 0xe2)
+GUID_ENTRY("EFI_SMM_BIOS_WRITE_DISPATCH_PROTOCOL_GUID", 0xe512dfe4, 0xbf44, 0x480D, 0x9b, 0x7a, 0x77, 0x7b, 0x0b, 0xe3, 0x27, 0x75)
+GUID_ENTRY("EFI_SMM_CMOS_ACCESS_GUID", 0xe5d3026a, 0x1ca5, 0x40F0, 0x8f, 0xb6, 0x4b, 0x1a, 0xfa, 0x3c, 0x6e, 0xaa)
+GUID_ENTRY("EFI_SMM_ICHN_DISPATCH_EX_PROTOCOL_GUID", 0x3920405b, 0xc897, 0x44DA, 0x88, 0xf3, 0x4c, 0x49, 0x8a, 0x6f, 0xf7, 0x36)
+GUID_ENTRY("EFI_SMM_IO_TRAP_DISPATCH2_PROTOCOL_GUID", 0xf1507845, 0x6494, 0x4377, 0xa1, 0x15, 0x45, 0xdf, 0xe6, 0x5f, 0x5d, 0x71)
+GUID_ENTRY("EFI_SMM_IO_TRAP_DISPATCH_PROTOCOL_GUID", 0xbd18369d, 0xc242, 0x45CA, 0x82, 0xad, 0x13, 0x8a, 0xc2, 0xe2, 0x9b, 0xab)
+GUID_ENTRY("EFI_SMM_IO_TRAP_DISPATCH_PROTOCOL_GUID", 0xdb7f536b, 0xede4, 0x4714, 0xa5, 0xc8, 0xe3, 0x46, 0xeb, 0xaa, 0x20, 0x1d)
+GUID_ENTRY("EFI_SMM_RC_TO_APTIO_BRIDGE_GUID", 0xfcdf7788, 0x7878, 0x11FF, 0xcc, 0x77, 0x88, 0xcc, 0xcc, 0x77, 0x88, 0xcc)
+GUID_ENTRY("EFI_SMM_RUNTIME_PROTOCOL_GUID", 0xa56897a1, 0xa77f, 0x4600, 0x84, 0xdb, 0x22, 0xb0, 0xa8, 0x01, 0xfa, 0x9a)
+GUID_ENTRY("EFI_SMM_RUNTIME_SERVICES_TABLE_GUID", 0x395c33fe, 0x287f, 0x413E, 0xa0, 0x55, 0x80, 0x88, 0xc0, 0xe1, 0xd4, 0x3e)
+GUID_ENTRY("EFI_SMM_SPI_PROTOCOL_GUID", 0xd9072c35, 0xeb8f, 0x43AD, 0xa2, 0x20, 0x34, 0xd4, 0x0e, 0x2a, 0x82, 0x85)
+GUID_ENTRY("EFI_SMM_SPI_PROTOCOL_GUID", 0xaff3be49, 0x6d71, 0x421C, 0x92, 0x77, 0xa0, 0xb1, 0x50, 0x8e, 0x84, 0x7d)
+GUID_ENTRY("EFI_SMM_TCO_DISPATCH_PROTOCOL_GUID", 0x0e2d6bb1, 0xc624, 0x446D, 0x99, 0x82, 0x69, 0x3c, 0xd1, 0x81, 0xa6, 0x07)
+GUID_ENTRY("EFI_SMM_THUNK_PROTOCOL_GUID", 0x2a82fce6, 0x8bb6, 0x413E, 0xb9, 0xeb, 0x45, 0xdf, 0xc0, 0x52, 0x2d, 0xf3)
+GUID_ENTRY("EFI_SMM_VARIABLE_PROTOCOL_GUID", 0x3025da01, 0xdc5f, 0x4F59, 0xbc, 0xc3, 0xb3, 0x77, 0xc8, 0x32, 0x5a, 0x4a)
+GUID_ENTRY("EFI_SMRAM_NVS_HEADER_GUID", 0xec7f4fa1, 0xb217, 0x42FC, 0xa7, 0xf7, 0x02, 0x0c, 0x43, 0x05, 0xd5, 0xba)
+GUID_ENTRY("EFI_SMTP_PROTOCOL_GUID", 0x5f67d40c, 0x1d06, 0x4E3E, 0x8b, 0x4a, 0xd2, 0x71, 0x3f, 0x46, 0xe1, 0xdc)
+GUID_ENTRY("EFI_SPEAKER_INTERFACE_PROTOCOL_GUID", 0x400b4476, 0x3081, 0x11D6, 0x87, 0xed, 0x00, 0x06, 0x29, 0x45, 0xc3, 0xb9)
+GUID_ENTRY("EFI_SPI_PROTOCOL_GUID", 0x1156efc6, 0xea32, 0x4396, 0xb5, 0xd5, 0x26, 0x93, 0x2e, 0x83, 0xc3, 0x13)
+GUID_ENTRY("EFI_SPI_PROTOCOL_GUID", 0x01a660d9, 0x8009, 0x4330, 0xba, 0x89, 0x71, 0xb0, 0x76, 0xcd, 0x5d, 0x0a)
+GUID_ENTRY("EFI_STATUS_CODE_ARCH_PROTOCOL_GUID", 0xd98e3ea3, 0x6f39, 0x4BE4, 0x82, 0xce, 0x5a, 0x89, 0x0c, 0xcb, 0x2c, 0x95)
+GUID_ENTRY("EFI_SYSTEM_TYPE_FRU_GUID", 0xaab16018, 0x679d, 0x4461, 0xba, 0x20, 0xe7, 0x0c, 0xf7, 0x86, 0x6a, 0x9b)
+GUID_ENTRY("EFI_TCG_LOG_HOB_GUID", 0x5f7d4e0e, 0x3d6d, 0x42BC, 0xa9, 0x42, 0x0e, 0x91, 0xe8, 0x3e, 0x3c, 0x31)
+GUID_ENTRY("EFI_TCG_WAKE_EVENT_DATA_HOB_GUID", 0xbbb810bb, 0x5ef0, 0x4E8F, 0xb2, 0x98, 0xad, 0x74, 0xaa, 0x50, 0xef, 0x0a)
+GUID_ENTRY("EFI_TCP_SOCK_PROTOCOL_GUID", 0x5187359b, 0x790d, 0x425B, 0xa5, 0x93, 0xca, 0x1c, 0xdb, 0x3c, 0xeb, 0xad)
+GUID_ENTRY("EFI_TDT_PROTOCOL_GUID", 0x0bf70067, 0xd53b, 0x42DF, 0xb7, 0x70, 0xe9, 0x2c, 0x91, 0xc6, 0x14, 0x11)
+GUID_ENTRY("EFI_TELNET_SERVER_PROTOCOL_GUID", 0x6d3569d4, 0x85e5, 0x4943, 0xae, 0x46, 0xee, 0x67, 0xa6, 0xe1, 0xab, 0x5a)
+GUID_ENTRY("EFI_TIME_VARIABLE_GUID", 0x9d0da369, 0x540b, 0x46F8, 0x85, 0xa0, 0x2b, 0x5f, 0x2c, 0x30, 0x1e, 0x15)
+GUID_ENTRY("EFI_TPM_DEVICE_PROTOCOL_GUID", 0xde161cfe, 0x1e60, 0x42A1, 0x8c, 0xc3, 0xee, 0x7e, 0xf0, 0x73, 0x52, 0x12)
+GUID_ENTRY("EFI_TPM_STATE_INIT_HUB_GUID", 0xa0c6d918, 0x8dee, 0x41BB, 0x9d, 0x92, 0x67, 0x53, 0xa5, 0x72, 0xb6, 0x52)
+GUID_ENTRY("EFI_TXT_INFO_PROTOCOL_GUID", 0x601211dc, 0x0b12, 0x4C09, 0xae, 0x27, 0xab, 0x0e, 0xc9, 0x69, 0x24, 0x68)
+GUID_ENTRY("EFI_UDP_PROTOCOL_GUID", 0xc56fb1b2, 0x017b, 0x4984, 0xa3, 0xf6, 0x3f, 0x73, 0x4f, 0xfa, 0x9e, 0x33)
+GUID_ENTRY("EFI_USB_POLICY_PROTOCOL_GUID", 0x5859cb76, 0x6bef, 0x468A, 0xbe, 0x2d, 0xb3, 0xdd, 0x1a, 0x27, 0xf0, 0x12)
+GUID_ENTRY("EFI_USB_PROTOCOL_GUID", 0x2ad8e2d2, 0x2e91, 0x4CD1, 0x95, 0xf5, 0xe7, 0x8f, 0xe5, 0xeb, 0xe3, 0x16)
+GUID_ENTRY("ERROR_MANAGER_GUID", 0xaddebf82, 0xa560, 0x46B9, 0xa2, 0x80, 0x78, 0xc6, 0xab, 0x61, 0xae, 0xda)
+GUID_ENTRY("EXIT_FORM_SET_GUID", 0xa43b03dc, 0xc18a, 0x41B1, 0x91, 0xc8, 0x3f, 0xf9, 0xaa, 0xa2, 0x57, 0x13)
+GUID_ENTRY("EXIT_PAGE_GUID", 0xec87d643, 0xeba4, 0x4BB5, 0xa1, 0xe5, 0x3f, 0x3e, 0x36, 0xb2, 0x0d, 0xa9)
+GUID_ENTRY("FAST_BOOT_TSE_PROTOCOL_GUID", 0x0fba43b8, 0xacdb, 0x4EE2, 0xab, 0x31, 0x0f, 0xa4, 0xd5, 0xb6, 0xc3, 0xc5)
+GUID_ENTRY("FAST_BOOT_VARIABLE_GUID", 0xb540a530, 0x6978, 0x4DA7, 0x91, 0xcb, 0x72, 0x07, 0xd7, 0x64, 0xd2, 0x62)
+GUID_ENTRY("FID_FFS_SECTION_GUID", 0x2ebe0275, 0x6458, 0x4AF9, 0x91, 0xed, 0xd3, 0xf4, 0xed, 0xb1, 0x00, 0xaa)
+GUID_ENTRY("FID_TABLE_GUID", 0x3fd1d3a2, 0x99f7, 0x420B, 0xbc, 0x69, 0x8b, 0xb1, 0xd4, 0x92, 0xa3, 0x32)
+GUID_ENTRY("FID_TABLE_SECTION_GUID", 0x2ebe0275, 0x6458, 0x4AF9, 0x91, 0xed, 0xd3, 0xf4, 0xed, 0xb1, 0x00, 0xaa)
+GUID_ENTRY("FIRMWARE_PERFORMANCE_PROTOCOL_GUID", 0xbc412d75, 0x2729, 0x4C3A, 0xb1, 0x93, 0x5b, 0x9a, 0x58, 0x8f, 0xf6, 0x6f)
+GUID_ENTRY("FLASH_PROTOCOL_GUID", 0x755b6596, 0x6896, 0x4BA3, 0xb3, 0xdd, 0x1c, 0x62, 0x9f, 0xd1, 0xea, 0x88)
+GUID_ENTRY("FLASH_SMM_PROTOCOL_GUID", 0xecb867ab, 0x8df4, 0x492D, 0x81, 0x50, 0xa7, 0xfd, 0x1b, 0x9b, 0x5a, 0x75)
+GUID_ENTRY("FLASH_UPDATE_GUID", 0x974231d5, 0xed4b, 0x44D1, 0x88, 0x70, 0xce, 0x51, 0x5c, 0xc1, 0x4d, 0x68)
+GUID_ENTRY("FONT_FFS_FILE_GUID", 0xdac2b117, 0xb5fb, 0x4964, 0xa3, 0x12, 0x0d, 0xcc, 0x77, 0x06, 0x1b, 0x9b)
+GUID_ENTRY("FPDT_PERFORMANCE_PROTOCOL_GUID", 0x444c3203, 0xf8b1, 0x42A7, 0xab, 0xe9, 0x2e, 0x58, 0x02, 0x5b, 0xe1, 0x2a)
+GUID_ENTRY("FW_VERSION_GUID", 0xb5c59087, 0xfeac, 0x4B41, 0x9d, 0x80, 0x79, 0x0b, 0xa5, 0xaa, 0x07, 0x0f)
+GUID_ENTRY("HDD_SECURITY_END_PROTOCOL_GUID", 0xad77ae29, 0x4c20, 0x4FDD, 0x85, 0x04, 0x81, 0x76, 0x61, 0x9b, 0x67, 0x6a)
+GUID_ENTRY("HDD_SECURITY_INIT_PROTOCOL_GUID", 0xce6f86bb, 0xb800, 0x4C71, 0xb2, 0xd1, 0x38, 0x97, 0xa3, 0xbc, 0x1d, 0xae)
+GUID_ENTRY("HDD_SMART_INIT_PROTOCOL_GUID", 0x9401bd4f, 0x1a00, 0x4990, 0xab, 0x56, 0xda, 0xf0, 0xe4, 0xe3, 0x48, 0xde)
+GUID_ENTRY("HDD_UNLOCKED_GUID", 0x1fd29be6, 0x70d0, 0x42A4, 0xa6, 0xe7, 0xe5, 0xd1, 0x0e, 0x6a, 0xc3, 0x76)
+GUID_ENTRY("HECI_PROTOCOL_GUID", 0xcfb33810, 0x6e87, 0x4284, 0xb2, 0x03, 0xa6, 0x6a, 0xbe, 0x07, 0xf6, 0xe8)
+GUID_ENTRY("HII_RESOURCES_FFS_SECTION_GUID", 0x97e409e6, 0x4cc1, 0x11D9, 0x81, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+GUID_ENTRY("ICC_OVERCLOCKING_PROTOCOL_GUID", 0x8e8cbc58, 0x834c, 0x41E3, 0xb8, 0xca, 0xf0, 0x0c, 0xcf, 0x5a, 0x71, 0x7c)
+GUID_ENTRY("ICC_PERSISTENT_DATA_GUID", 0x64192dca, 0xd034, 0x49D2, 0xa6, 0xde, 0x65, 0xa8, 0x29, 0xeb, 0x4c, 0x74)
+GUID_ENTRY("ICC_VOLATILE_SETUP_DATA_GUID", 0x7b77fb8b, 0x1e0d, 0x4D7E, 0x95, 0x3f, 0x39, 0x80, 0xa2, 0x61, 0xe0, 0x77)
+GUID_ENTRY("IDE_BUS_DRIVER_BINDING_PROTOCOL_GUID", 0x8aa67071, 0x8bec, 0x47AB, 0x83, 0xc8, 0xcd, 0x0e, 0xb7, 0x23, 0xd0, 0x72)
+GUID_ENTRY("IDE_BUS_INIT_PROTOCOL_GUID", 0xe159a956, 0x3299, 0x4EE9, 0x91, 0x76, 0x65, 0x18, 0x1a, 0x4e, 0x5e, 0x9f)
+GUID_ENTRY("IDE_CONTROLLER_PROTOCOL_GUID", 0x20e28787, 0xdf32, 0x4BDA, 0xb7, 0xe7, 0xcb, 0xbd, 0xa3, 0x37, 0x1e, 0xf8)
+GUID_ENTRY("IDE_HPA_INTERFACE_GUID", 0x51aa65fc, 0x82b6, 0x49E6, 0x95, 0xe2, 0xe6, 0x82, 0x7a, 0x8d, 0x7d, 0xb4)
+GUID_ENTRY("IDE_POWER_MGMT_INTERFACE_GUID", 0x67bc3883, 0x7e79, 0x4BC1, 0xa3, 0x3e, 0x3a, 0xf7, 0xd1, 0x75, 0x89, 0xba)
+GUID_ENTRY("IDE_SECURITY_INTERFACE_GUID", 0xf4f63529, 0x281e, 0x4040, 0xa3, 0x13, 0xc1, 0xd6, 0x76, 0x63, 0x84, 0xbe)
+GUID_ENTRY("IDE_SECURITY_PWNV_GUID", 0x69967a8c, 0x1159, 0x4522, 0xaa, 0x89, 0x74, 0xcd, 0xc6, 0xe5, 0x99, 0xa0)
+GUID_ENTRY("IDE_SETUP_PROTOCOL_GUID", 0x5578ae16, 0xf1c9, 0x4E8F, 0xb1, 0x29, 0xba, 0x07, 0xf8, 0xfc, 0xf8, 0x4a)
+GUID_ENTRY("IDE_SMART_INTERFACE_GUID", 0xffbd9ad2, 0xf1db, 0x4F92, 0xa6, 0x49, 0xeb, 0x9e, 0xed, 0xea, 0x86, 0xb5)
+GUID_ENTRY("IFFS_ACPI_TABLE_STORAGE_GUID", 0x60ac3a8f, 0x4d66, 0x4CD4, 0x89, 0x5a, 0xc3, 0xf0, 0x6e, 0x66, 0x65, 0xee)
+GUID_ENTRY("IFFS_GLOBAL_NVS_AREA_PROTOCOL_GUID", 0xa5559f06, 0x6415, 0x4759, 0x88, 0x69, 0xde, 0x15, 0xf9, 0xcd, 0x9c, 0x9b)
+GUID_ENTRY("IFFS_GPT_GUID", 0xd3bfe2de, 0x3daf, 0x11DF, 0xba, 0x40, 0xe3, 0xa5, 0x56, 0xd8, 0x95, 0x93)
+GUID_ENTRY("IFFS_INFO_PROTOCOL_GUID", 0xd231db5b, 0x4a9c, 0x4092, 0xa8, 0xc5, 0x9c, 0xa0, 0xbc, 0x7d, 0x6a, 0xa6)
+GUID_ENTRY("IFFS_PARTITION_STATUS_PROTOCOL_GUID", 0x65639144, 0xd492, 0x4328, 0xa4, 0x98, 0xf4, 0xb5, 0x54, 0x5e, 0x4a, 0x30)
+GUID_ENTRY("IFFS_PERSISTENT_DATA_GUID", 0xf9f0b131, 0xf346, 0x4F16, 0x80, 0xdd, 0xf9, 0x41, 0x07, 0x2b, 0x3a, 0x7d)
+GUID_ENTRY("IFFS_PLATFORM_POLICY_PROTOCOL_GUID", 0x42bbaca3, 0x7161, 0x4891, 0xac, 0x10, 0xc7, 0x5e, 0x2e, 0x4d, 0xf6, 0x14)
+GUID_ENTRY("IFFS_PPI_GUID", 0x3d0e663a, 0xdc72, 0x4489, 0x87, 0xc5, 0xe4, 0x9e, 0xe7, 0x73, 0xa4, 0x52)
+GUID_ENTRY("IGD_OPREGION_PROTOCOL_GUID", 0xcdc5dddf, 0xe79d, 0x41EC, 0xa9, 0xb0, 0x65, 0x65, 0x49, 0x0d, 0xb9, 0xd3)
+GUID_ENTRY("INTEL_MEBX_PROTOCOL_GUID", 0x01ab1829, 0xcecd, 0x4CFA, 0xa1, 0x8c, 0xea, 0x75, 0xd6, 0x6f, 0x3e, 0x74)
+GUID_ENTRY("MAIN_FORM_SET_GUID", 0x985eee91, 0xbcac, 0x4238, 0x87, 0x78, 0x57, 0xef, 0xdc, 0x93, 0xf2, 0x4e)
+GUID_ENTRY("MDES_STATUS_CODE_PROTOCOL_GUID", 0xe5d0875a, 0xf647, 0x4E16, 0xbe, 0x4d, 0x95, 0x02, 0x40, 0x29, 0xcc, 0x44)
+GUID_ENTRY("MEBX_FILE_GUID", 0x7c81c66a, 0x4f11, 0x47AB, 0x82, 0xd3, 0x67, 0xc4, 0xd6, 0x35, 0xae, 0xd1)
+GUID_ENTRY("MEM_INFO_PROTOCOL_GUID", 0x6f20f7c8, 0xe5ef, 0x4F21, 0x8d, 0x19, 0xed, 0xc5, 0xf0, 0xc4, 0x96, 0xae)
+GUID_ENTRY("MEUD_ERROR_GUID", 0x0732bd39, 0xd6b0, 0x4039, 0xb6, 0xc2, 0x96, 0x54, 0x46, 0x6d, 0xe5, 0x25)
+GUID_ENTRY("MEUD_FILE_GUID", 0xfeaaa7a6, 0xcb95, 0x4670, 0xb4, 0x99, 0x87, 0x7f, 0xa6, 0xca, 0x6b, 0xae)
+GUID_ENTRY("ME_ALERT_AT_HANDLER_GUID", 0xb441df87, 0x8d94, 0x4811, 0x85, 0xf7, 0x0f, 0x9a, 0x7b, 0xf8, 0x9d, 0x2a)
+GUID_ENTRY("ME_BIOS_PAYLOAD_DATA_PROTOCOL_GUID", 0x71a19494, 0x2ab6, 0x4E96, 0x85, 0x81, 0xcf, 0x34, 0x25, 0x42, 0x73, 0xfe)
+GUID_ENTRY("ME_INFO_SETUP_GUID", 0x78259433, 0x7b6d, 0x4DB3, 0x9a, 0xe8, 0x36, 0xc4, 0xc2, 0xc3, 0xa1, 0x7d)
+GUID_ENTRY("ME_PLATFORM_GET_RESET_TYPE_GUID", 0xb8cdced7, 0xbdc4, 0x4464, 0x9a, 0x1a, 0xff, 0x3f, 0xbd, 0xf7, 0x48, 0x69)
+GUID_ENTRY("MICROCODE_LOADER_PPI_GUID", 0x9b6eecf6, 0xfbdc, 0x4DB6, 0x95, 0x62, 0xd2, 0x5f, 0x40, 0xd5, 0x76, 0x61)
+GUID_ENTRY("MINI_SETUP_RESOURCE_SECTION_GUID", 0x97e409e6, 0x4cc1, 0x11D9, 0x81, 0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00)
+GUID_ENTRY("MXM30_PEI_GUID", 0x2ef1ba1a, 0xc836, 0x4A50, 0xbf, 0x89, 0x52, 0x5f, 0xf2, 0x9f, 0xf7, 0x87)
+GUID_ENTRY("MXM3_EFI_GUID", 0x4ea9d4fe, 0xe6f6, 0x410B, 0x90, 0x37, 0x0f, 0x98, 0xb5, 0x96, 0x8b, 0x65)
+GUID_ENTRY("MXMOEM1_GUID", 0x6707536e, 0x46af, 0x42D3, 0x8f, 0x6c, 0x15, 0xf2, 0xf2, 0x02, 0xc2, 0x34)
+GUID_ENTRY("NBCI_EFI_GUID", 0x4ea9d4fe, 0xe6f6, 0x410B, 0x80, 0x37, 0x0f, 0x98, 0xb5, 0x96, 0x8b, 0x65)
+GUID_ENTRY("NETWORK_STACK_GUID", 0xd1405d16, 0x7afc, 0x4695, 0xbb, 0x12, 0x41, 0x45, 0x9d, 0x36, 0x95, 0xa2)
+GUID_ENTRY("NVRAM_HOB_GUID", 0xc0ec00fd, 0xc2f8, 0x4E47, 0x90, 0xef, 0x9c, 0x81, 0x55, 0x28, 0x5b, 0xec)
+GUID_ENTRY("NVRAM_MAILBOX_ADDRESS_VARIABLE_GUID", 0x54913a6d, 0xf4ee, 0x4CDB, 0x84, 0x75, 0x74, 0x06, 0x2b, 0xfc, 0xec, 0xf5)
+GUID_ENTRY("OEM_RECOVERY_CAPSULE_GUID", 0x595a6edc, 0x6d2c, 0x474A, 0x90, 0x82, 0x3b, 0x99, 0x28, 0x51, 0xdf, 0xfe)
+GUID_ENTRY("OEM_ROM_HOLE_0_GUID", 0x05ca01fc, 0x0fc1, 0x11DC, 0x90, 0x11, 0x00, 0x17, 0x31, 0x53, 0xeb, 0xa8)
+GUID_ENTRY("OEM_ROM_HOLE_1_GUID", 0x05ca01fd, 0x0fc1, 0x11DC, 0x90, 0x11, 0x00, 0x17, 0x31, 0x53, 0xeb, 0xa8)
+GUID_ENTRY("OEM_TSE_VAR_GUID", 0xf4b2c007, 0x94a1, 0x4CD5, 0xa7, 0x10, 0xf4, 0x14, 0x1f, 0xce, 0xbc, 0xa0)
+GUID_ENTRY("ONBOARD_RAID_GUID", 0x5d206dd3, 0x516a, 0x47DC, 0xa1, 0xbc, 0x6d, 0xa2, 0x04, 0xaa, 0xbe, 0x08)
+GUID_ENTRY("OPAL_SEC_INIT_PROTOCOL_GUID", 0x59af16b0, 0x661d, 0x4865, 0xa3, 0x81, 0x38, 0xde, 0x68, 0x38, 0x5d, 0x8d)
+GUID_ENTRY("OPROM_START_END_PROTOCOL_GUID", 0xf2a128ff, 0x257b, 0x456E, 0x9d, 0xe8, 0x63, 0xe7, 0xc7, 0xdc, 0xdf, 0xac)
+GUID_ENTRY("PARTITION_VARIABLE_GUID", 0x8db699cc, 0xbc81, 0x41E2, 0xaa, 0xc6, 0xd8, 0x1d, 0x53, 0x00, 0xd7, 0x59)
+GUID_ENTRY("PASSWORD_HOB_GUID", 0x79ce097a, 0x91aa, 0x41FF, 0xb3, 0xa8, 0x53, 0x45, 0x59, 0xb3, 0x0d, 0xb1)
+GUID_ENTRY("PCH_DMI_TC_VC_PPI_GUID", 0xed097352, 0x9041, 0x445A, 0x80, 0xb6, 0xb2, 0x9d, 0x50, 0x9e, 0x88, 0x45)
+GUID_ENTRY("PCH_EFI_RAID_DRIVER_EXECUTION_GUID", 0x99d5757c, 0xd906, 0x11E0, 0x8d, 0x78, 0x8d, 0xe4, 0x48, 0x24, 0x01, 0x9b)
+GUID_ENTRY("PCH_INIT_PPI_GUID", 0xe8c7ce14, 0x1eed, 0x48FD, 0x83, 0x47, 0x8e, 0x55, 0x41, 0x10, 0xc0, 0xd9)
+GUID_ENTRY("PCH_INIT_VARIABLE_GUID", 0xe6c2f70a, 0xb604, 0x4877, 0x85, 0xba, 0xde, 0xec, 0x89, 0xe1, 0x17, 0xeb)
+GUID_ENTRY("PCH_ME_UMA_PPI_GUID", 0x8c376010, 0x2400, 0x4D7D, 0xb4, 0x7b, 0x9d, 0x85, 0x1d, 0xf3, 0xc9, 0xd1)
+GUID_ENTRY("PCH_PLATFORM_POLICY_PPI_GUID", 0x22074e71, 0xbccc, 0x4517, 0x87, 0x57, 0x79, 0x95, 0xed, 0xfd, 0x80, 0x32)
+GUID_ENTRY("PCH_RESET_CALLBACK_PROTOCOL_GUID", 0x3a3300ab, 0xc929, 0x487D, 0xab, 0x34, 0x15, 0x9b, 0xc1, 0x35, 0x62, 0xc0)
+GUID_ENTRY("PCH_RESET_PROTOCOL_GUID", 0xdb63592c, 0xb8cc, 0x44C8, 0x91, 0x8c, 0x51, 0xf5, 0x34, 0x59, 0x8a, 0x5a)
+GUID_ENTRY("PCH_SATA_CONTROLLER_DRIVER_GUID", 0xbb929da9, 0x68f7, 0x4035, 0xb2, 0x2c, 0xa3, 0xbb, 0x3f, 0x23, 0xda, 0x55)
+GUID_ENTRY("PCH_USB_POLICY_PPI_GUID", 0xc02b0573, 0x2b4e, 0x4A31, 0xa3, 0x1a, 0x94, 0x56, 0x7b, 0x50, 0x44, 0x2c)
+GUID_ENTRY("PEI_AMT_PLATFORM_POLICY_PPI_GUID", 0xb4a1208e, 0x4d9a, 0x4EA2, 0x9d, 0x6b, 0xe4, 0x1a, 0x61, 0xe6, 0xc5, 0xac)
+GUID_ENTRY("PEI_AMT_STATUS_CODE_PPI_GUID", 0x881807d2, 0x98d1, 0x4EC9, 0xaf, 0xa0, 0x77, 0x46, 0xc4, 0x2f, 0x24, 0x49)
+GUID_ENTRY("PEI_AP_STARTUP_FILE_GUID", 0xd1e59f50, 0xe8c3, 0x4545, 0xbf, 0x61, 0x11, 0xf0, 0x02, 0x23, 0x3c, 0x97)
+GUID_ENTRY("PEI_ATA_CONTROLLER_PPI_GUID", 0xa1e2176f, 0xcbda, 0x4F32, 0x87, 0x56, 0x7d, 0x7a, 0xe5, 0x22, 0xd6, 0x93)
+GUID_ENTRY("PEI_ATA_POLICY_PPI_GUID", 0x1b8ddea4, 0xdeb2, 0x4152, 0x91, 0xc2, 0xb7, 0x3c, 0xb1, 0x6c, 0xe4, 0x64)
+GUID_ENTRY("PEI_BIOS_ACM_FILE_GUID", 0x2d27c618, 0x7dcd, 0x41F5, 0xbb, 0x10, 0x21, 0x16, 0x6b, 0xe7, 0xe1, 0x43)
+GUID_ENTRY("PEI_BOOT_SCRIPT_DONE_PPI_GUID", 0xfd7c4665, 0x34be, 0x426B, 0xb1, 0xf8, 0x3a, 0xb7, 0x53, 0xce, 0x44, 0xb0)
+GUID_ENTRY("PEI_CACHE_PPI_GUID", 0x09be4bc2, 0x790e, 0x4DEA, 0x8b, 0xdc, 0x38, 0x05, 0x16, 0x98, 0x39, 0x44)
+GUID_ENTRY("PEI_CACHE_PPI_GUID", 0xc153205a, 0xe898, 0x4C24, 0x86, 0x89, 0xa4, 0xb4, 0xbc, 0xc5, 0xc8, 0xa2)
+GUID_ENTRY("PEI_CPU_PLATFORM_POLICY_PPI_GUID", 0x7b8ee7a1, 0x4e35, 0x4556, 0xbb, 0x56, 0x67, 0x97, 0xe2, 0x44, 0x45, 0xc2)
+GUID_ENTRY("PEI_HECI_PPI_GUID", 0xee0ea811, 0xfbd9, 0x4777, 0xb9, 0x5a, 0xba, 0x4f, 0x71, 0x10, 0x1f, 0x74)
+GUID_ENTRY("PEI_IDE_RECOVERY_NATIVE_MODE_PPI_GUID", 0x7e13637a, 0xc3f8, 0x43D1, 0xb0, 0x51, 0xed, 0x19, 0xd7, 0x08, 0xec, 0x7a)
+GUID_ENTRY("PEI_IFFS_TRANSITION_START_PPI_GUID", 0xde8f2878, 0x36d5, 0x498E, 0xba, 0x59, 0x16, 0x8c, 0x26, 0x47, 0xb3, 0x35)
+GUID_ENTRY("PEI_ME_PLATFORM_POLICY_PPI_GUID", 0x7ae3ceb7, 0x2ee2, 0x48FA, 0xaa, 0x49, 0x35, 0x10, 0xbc, 0x83, 0xca, 0xbf)
+GUID_ENTRY("PEI_PLATFORM_MEMORY_RANGE_PPI_GUID", 0x30eb2979, 0xb0f7, 0x4D60, 0xb2, 0xdc, 0x1a, 0x2c, 0x96, 0xce, 0xb1, 0xf4)
+GUID_ENTRY("PEI_PLATFORM_MEMORY_SIZE_PPI_GUID", 0x9a7ef41e, 0xc140, 0x4BD1, 0xb8, 0x84, 0x1e, 0x11, 0x24, 0x0b, 0x4c, 0xe6)
+GUID_ENTRY("PEI_SMBUS_POLICY_PPI_GUID", 0x63b6e435, 0x32bc, 0x49C6, 0x81, 0xbd, 0xb7, 0xa1, 0xa0, 0xfe, 0x1a, 0x6c)
+GUID_ENTRY("PEI_SPI_PPI_GUID", 0x64e42e92, 0xe958, 0x4E99, 0x90, 0xe2, 0xf7, 0xfd, 0x90, 0xa7, 0x6c, 0x59)
+GUID_ENTRY("PEI_TCG_INTERNAL_FLAGS_GUID", 0x70fff0ff, 0xa543, 0x45B9, 0x8b, 0xe3, 0x1b, 0xdb, 0x90, 0x41, 0x20, 0x80)
+GUID_ENTRY("PEI_TCG_PPI_GUID", 0x177d39d2, 0x43b8, 0x40C8, 0x9a, 0xe1, 0x3c, 0x51, 0x98, 0xd6, 0x94, 0x1e)
+GUID_ENTRY("PEI_TPM_PPI_2_GUID", 0xca4853f4, 0xe94b, 0x42B4, 0x86, 0x42, 0xcd, 0xe2, 0x8a, 0x7f, 0xac, 0x2d)
+GUID_ENTRY("PEI_TPM_PPI_GUID", 0xca4853f4, 0xe94b, 0x42B4, 0x86, 0x42, 0xcd, 0xe2, 0x8a, 0x7f, 0xac, 0x2d)
+GUID_ENTRY("PEI_TXT_MEMORY_UNLOCKED_PPI_GUID", 0x38cdd10b, 0x767d, 0x4F6E, 0xa7, 0x44, 0x67, 0xee, 0x1d, 0xfe, 0x2f, 0xa5)
+GUID_ENTRY("PERF_TUNE_PPI_GUID", 0xc49189f3, 0x1d4c, 0x4AD7, 0xa4, 0x39, 0xd0, 0x13, 0xab, 0x72, 0x09, 0x31)
+GUID_ENTRY("PERF_TUNE_PROTOCOL_GUID", 0xdd6c613a, 0x5a77, 0x4B4F, 0xa6, 0x1e, 0x3b, 0xdd, 0x2a, 0xe2, 0x1d, 0x81)
+GUID_ENTRY("PERF_TUNE_WDT_PPI_GUID", 0xa7c88fae, 0xebec, 0x45ED, 0xa7, 0xc5, 0x5f, 0xa7, 0x55, 0x17, 0x73, 0x06)
+GUID_ENTRY("PERF_TUNE_WDT_PROTOCOL_GUID", 0xc0557eed, 0x9a89, 0x4770, 0x96, 0x26, 0xfc, 0xa0, 0x51, 0xf2, 0xba, 0x09)
+GUID_ENTRY("PKPUB_KEY_GUID", 0xa6c0e11e, 0x929e, 0x42B3, 0x90, 0xcc, 0x4f, 0x77, 0x8e, 0x03, 0xff, 0x57)
+GUID_ENTRY("PK_PUB_FFS_FILE_EFI_AUTH_VAR_GUID", 0x9e625a27, 0x4840, 0x47CC, 0xa6, 0xb5, 0x1e, 0x93, 0x11, 0xcf, 0xc6, 0x0e)
+GUID_ENTRY("PLATFORM_IDE_PROTOCOL_GUID", 0x6737f69b, 0xb8cc, 0x45BC, 0x93, 0x27, 0xcc, 0xf5, 0xee, 0xf7, 0x0c, 0xde)
+GUID_ENTRY("PLATFORM_ME_HOOK_PPI_GUID", 0xe806424f, 0xd425, 0x4B1A, 0xbc, 0x26, 0x5f, 0x69, 0x03, 0x89, 0xa1, 0x5a)
+GUID_ENTRY("PLATFORM_ME_HOOK_PROTOCOL_GUID", 0xbc52476e, 0xf67e, 0x4301, 0xb2, 0x62, 0x36, 0x9c, 0x48, 0x78, 0xaa, 0xc2)
+GUID_ENTRY("POWER_MANAGEMENT_ACPI_TABLE_STORAGE_GUID", 0x299141bb, 0x211a, 0x48A5, 0x92, 0xc0, 0x6f, 0x9a, 0x0a, 0x3a, 0x00, 0x6e)
+GUID_ENTRY("PPM_PLATFORM_POLICY_PROTOCOL_GUID", 0x6f27e990, 0x7bc8, 0x42C9, 0x8f, 0x71, 0x99, 0x80, 0x06, 0x36, 0x93, 0xe9)
+GUID_ENTRY("PPM_PROCESSOR_SUPPORT_PROTOCOL_3_GUID", 0xa60c7dcd, 0x512f, 0x4F02, 0xb1, 0x80, 0x52, 0x2e, 0x01, 0x5e, 0x06, 0xb7)
+GUID_ENTRY("PR_KEY_FFS_FILE_RAW_GUID", 0x3feec852, 0xf14c, 0x4E7F, 0x97, 0xfd, 0x4c, 0x3a, 0x8c, 0x5b, 0xbe, 0xcc)
+GUID_ENTRY("PR_KEY_GUID", 0x4e0f9bd4, 0xe338, 0x4B26, 0x84, 0x3e, 0xbd, 0x3a, 0xd9, 0xb2, 0x83, 0x7b)
+GUID_ENTRY("PTID_FFS_TABLE_STORAGE_GUID", 0x95dfcae5, 0xbb28, 0x4D6B, 0xb1, 0xe2, 0x3a, 0xf3, 0xa6, 0xbf, 0x43, 0x4f)
+GUID_ENTRY("RECOVERY_FORM_SET_GUID", 0x80e1202e, 0x2697, 0x4264, 0x9c, 0xc9, 0x80, 0x76, 0x2c, 0x3e, 0x58, 0x63)
+GUID_ENTRY("ROM_CACHE_ENABLE_PPI_GUID", 0x36e835bb, 0x661d, 0x4D37, 0x8d, 0xe5, 0x88, 0x53, 0x25, 0xda, 0xe9, 0x10)
+GUID_ENTRY("ROM_IMAGE_ADDRESS_GUID", 0xdde1bc72, 0xd45e, 0x4209, 0xab, 0x85, 0x14, 0x46, 0x2d, 0x2f, 0x50, 0x74)
+GUID_ENTRY("ROM_IMAGE_MEMORY_HOB_GUID", 0xee2f45d2, 0x5ba4, 0x441E, 0x8a, 0x1d, 0xaa, 0x22, 0xdf, 0xa3, 0xb6, 0xc5)
+GUID_ENTRY("ROM_LAYOUT_FFS_GUID", 0x0dca793a, 0xea96, 0x42D8, 0xbd, 0x7b, 0xdc, 0x7f, 0x68, 0x4e, 0x38, 0xc1)
+GUID_ENTRY("ROM_LAYOUT_SECTION_GUID", 0x88a15a4f, 0x977d, 0x4682, 0xb1, 0x7c, 0xda, 0x1f, 0x31, 0x6c, 0x1f, 0x32)
+GUID_ENTRY("RSDP_PLUS_PROTOCOL_GUID", 0xa33319b5, 0x8ee1, 0x45E0, 0x8c, 0x9f, 0x80, 0x9f, 0x5b, 0x09, 0x02, 0xcc)
+GUID_ENTRY("SATA_CONTROLLER_PROTOCOL_GUID", 0x2acb6627, 0xdf02, 0x4E23, 0xb4, 0xf9, 0x6a, 0x93, 0xfa, 0x6e, 0x9d, 0xa6)
+GUID_ENTRY("SA_PEG_DATA_HOB_GUID", 0x5f5d3502, 0x8a4b, 0x40CA, 0x88, 0xa2, 0x23, 0x05, 0x42, 0x7a, 0x13, 0x1a)
+GUID_ENTRY("SA_PEG_DATA_VARIABLE_GUID", 0xc4975200, 0x64f1, 0x4FB6, 0x97, 0x73, 0xf6, 0xa9, 0xf8, 0x9d, 0x98, 0x5e)
+GUID_ENTRY("SA_PEI_INIT_PPI_GUID", 0x09ea8911, 0xbe0d, 0x4230, 0xa0, 0x03, 0xed, 0xc6, 0x93, 0xb4, 0x8e, 0x11)
+GUID_ENTRY("SA_PLATFORM_POLICY_PPI_GUID", 0x150ce416, 0xee63, 0x46B6, 0x8b, 0xa3, 0x73, 0x22, 0xbb, 0xe0, 0x46, 0x37)
+GUID_ENTRY("SECURITY_FORM_SET_GUID", 0x981ceaee, 0x931c, 0x4A17, 0xb9, 0xc8, 0x66, 0xc7, 0xbc, 0xfd, 0x77, 0xe1)
+GUID_ENTRY("SERIAL_RECOVERY_CAPSULE_GUID", 0x699add70, 0x8554, 0x4993, 0x83, 0xf6, 0xd2, 0xcd, 0xc0, 0x81, 0xdd, 0x85)
+GUID_ENTRY("SETUP_DEFAULTS_FFS_GUID", 0x9221315b, 0x30bb, 0x46B5, 0x81, 0x3e, 0x1b, 0x1b, 0xf4, 0x71, 0x2b, 0xd3)
+GUID_ENTRY("SETUP_GUID", 0xec87d643, 0xeba4, 0x4BB5, 0xa1, 0xe5, 0x3f, 0x3e, 0x36, 0xb2, 0x0d, 0xa9)
+GUID_ENTRY("SGOEM_ACPI_SSDT_GUID", 0x5b232086, 0x350a, 0x42C7, 0xa7, 0x0e, 0x34, 0x97, 0xb5, 0x76, 0x5d, 0x85)
+GUID_ENTRY("SGTPV_ACPI_SSDT_GUID", 0x6a061113, 0xfe54, 0x4A07, 0xa2, 0x8e, 0x0a, 0x69, 0x35, 0x9e, 0xb0, 0x69)
+GUID_ENTRY("SG_ACPI_TABLE_STORAGE_GUID", 0xcacb3817, 0x81e6, 0x497E, 0x87, 0xff, 0xc8, 0xfa, 0x8f, 0x24, 0xec, 0x28)
+GUID_ENTRY("SG_INFO_HOB_GUID", 0x648ce07b, 0xae5d, 0x4973, 0xbd, 0x3c, 0x8c, 0x91, 0x53, 0xc0, 0x5d, 0xc5)
+GUID_ENTRY("SG_PEI_INIT_PPI_GUID", 0xaa40d00e, 0x5b9b, 0x4DAD, 0xa4, 0x87, 0xfc, 0x1b, 0xcb, 0xef, 0x81, 0x70)
+GUID_ENTRY("SG_PLATFORM_POLICY_PPI_GUID", 0xa391e822, 0x7044, 0x4CF4, 0xbe, 0x5b, 0x34, 0x5e, 0x44, 0xb8, 0x62, 0x7c)
+GUID_ENTRY("SIO_DEV_STATUS_VAR_GUID", 0x5820de98, 0xfc8e, 0x4B0B, 0xa4, 0xb9, 0x0a, 0x94, 0x0d, 0x16, 0x2a, 0x7e)
+GUID_ENTRY("SMBIOS_FLASH_DATA_FFS_GUID", 0xfd44820b, 0xf1ab, 0x41C0, 0xae, 0x4e, 0x0c, 0x55, 0x55, 0x6e, 0xb9, 0xbd)
+GUID_ENTRY("SMM_CHILD_DISPATCHER2_GUID", 0x950c3a26, 0xe0c2, 0x491C, 0xb6, 0xb2, 0x03, 0x74, 0xf5, 0xc7, 0x3b, 0x96)
+GUID_ENTRY("SMRAM_CPU_DATA_HEADER_GUID", 0x5848fd2d, 0xd6af, 0x474B, 0x82, 0x75, 0x95, 0xdd, 0xe7, 0x0a, 0xe8, 0x23)
+GUID_ENTRY("SMRAM_CPU_DATA_VARIABLE_GUID", 0x429501d9, 0xe447, 0x40F4, 0x86, 0x7b, 0x75, 0xc9, 0x3a, 0x1d, 0xb5, 0x4e)
+GUID_ENTRY("SM_BUS_CONTROLLER_IDENTIFIER_GUID", 0x882f2546, 0xef1f, 0x4090, 0x9f, 0x9c, 0x93, 0x84, 0x5a, 0xd7, 0x84, 0x1c)
+GUID_ENTRY("SYSTEM_ACCESS_GUID", 0xe770bb69, 0xbcb4, 0x4D04, 0x9e, 0x97, 0x23, 0xff, 0x94, 0x56, 0xfe, 0xac)
+GUID_ENTRY("TCG_INTERNAL_FLAGS_GUID", 0x70fff0ff, 0xa543, 0x45B9, 0x8b, 0xe3, 0x1b, 0xdb, 0x90, 0x41, 0x20, 0x80)
+GUID_ENTRY("TCG_LOCK_DOWN_VAR_GUID", 0x6e605536, 0xa30a, 0x4D56, 0x93, 0x9e, 0x1c, 0x37, 0x3f, 0x79, 0x8d, 0x7b)
+GUID_ENTRY("TCG_PLATFORM_SETUP_PEI_POLICY_GUID", 0xa76b4e22, 0xb50a, 0x401D, 0x8b, 0x35, 0x51, 0x24, 0xb0, 0xba, 0x41, 0x04)
+GUID_ENTRY("TCG_PLATFORM_SETUP_POLICY_GUID", 0xbb6cbeff, 0xe072, 0x40D2, 0xa6, 0xeb, 0xba, 0xb7, 0x5b, 0xde, 0x87, 0xe7)
+GUID_ENTRY("TCG_PPI_SYNC_FLAG_GUID", 0xf3ed95df, 0x828e, 0x41C7, 0xbc, 0xa0, 0x16, 0xc4, 0x19, 0x65, 0xa6, 0x34)
+GUID_ENTRY("TDTHI_PROTOCOL_FIXED_GUID", 0xfa8f55e8, 0xab22, 0x42DD, 0xb9, 0x16, 0x7d, 0xce, 0x39, 0x00, 0x25, 0x74)
+GUID_ENTRY("TDTHI_PROTOCOL_GUID", 0x3c4852d6, 0xd47b, 0x4F46, 0xb0, 0x5e, 0xb5, 0xed, 0xc1, 0xaa, 0x43, 0x0a)
+GUID_ENTRY("TDT_VOLATILE_SETUP_DATA_GUID", 0x7b77fb8b, 0x1e0d, 0x4D7E, 0x95, 0x3f, 0x39, 0x80, 0xa2, 0x61, 0xe0, 0x76)
+GUID_ENTRY("TERMINAL_VAR_GUID", 0x560bf58a, 0x1e0d, 0x4D7E, 0x95, 0x3f, 0x29, 0x80, 0xa2, 0x61, 0xe0, 0x31)
+GUID_ENTRY("TPM_BOOT_FLOW_VARIABLE_GUID", 0xb6460a49, 0x0ac1, 0x484F, 0xae, 0x58, 0xf1, 0x6e, 0xb2, 0x39, 0xdb, 0x3d)
+GUID_ENTRY("TXT_INFO_HOB_GUID", 0x2986883f, 0x88e0, 0x48D0, 0x4b, 0x82, 0x20, 0xc2, 0x69, 0x48, 0xdd, 0xac)
+GUID_ENTRY("TXT_ONE_TOUCH_GUID", 0x3d989471, 0xcfac, 0x46B7, 0x9b, 0x1c, 0x08, 0x43, 0x01, 0x09, 0x40, 0x2d)
+GUID_ENTRY("TXT_ONE_TOUCH_OP_PROTOCOL_GUID", 0xfa2338ad, 0x80df, 0x49D0, 0x93, 0x96, 0xcf, 0x71, 0x45, 0xd0, 0x3a, 0x76)
+GUID_ENTRY("USB_TIMING_POLICY_PROTOCOL_GUID", 0x89e3c1dc, 0xb5e3, 0x4D34, 0xae, 0xad, 0xdd, 0x7e, 0xb2, 0x82, 0x8c, 0x18)
+GUID_ENTRY("USER_DEFAULTS_GUID", 0xc4cc0de8, 0x0687, 0x4422, 0x99, 0xc1, 0x65, 0x35, 0x1a, 0x5d, 0x5f, 0x95)
+GUID_ENTRY("WDT_APP_PROTOCOL_GUID", 0x92c7d0bb, 0x679e, 0x479D, 0x87, 0x8d, 0xd4, 0xb8, 0x29, 0x68, 0x57, 0x8b)
+GUID_ENTRY("WDT_HOB_GUID", 0x65675786, 0xacca, 0x4B11, 0x8a, 0xb7, 0xf8, 0x43, 0xaa, 0x2a, 0x8b, 0xea)
+GUID_ENTRY("WDT_PERSISTENT_DATA_GUID", 0x78ce2354, 0xcfbc, 0x4643, 0xae, 0xba, 0x07, 0xa2, 0x7f, 0xa8, 0x92, 0xbf)
+GUID_ENTRY("WDT_PPI_GUID", 0xf38d1338, 0xaf7a, 0x4FB6, 0x91, 0xdb, 0x1a, 0x9c, 0x21, 0x83, 0x57, 0x0d)
+GUID_ENTRY("WDT_PROTOCOL_GUID", 0xb42b8d12, 0x2acb, 0x499A, 0xa9, 0x20, 0xdd, 0x5b, 0xe6, 0xcf, 0x09, 0xb1)
+GUID_ENTRY("APP_PKG_TOKEN_SPACE", 0xe7e1efa6, 0x7607, 0x4A78, 0xa7, 0xdd, 0x43, 0xe4, 0xbd, 0x72, 0xc0, 0x99)
+GUID_ENTRY("ARM_JUNO_TOKEN_SPACE", 0xa1147a20, 0x3144, 0x4F8D, 0x82, 0x95, 0xb4, 0x83, 0x11, 0xc8, 0xe4, 0xa4)
+GUID_ENTRY("ARM_TOKEN_SPACE", 0xbb11ecfe, 0x820f, 0x4968, 0xbb, 0xa6, 0xf7, 0x6a, 0xfe, 0x30, 0x25, 0x96)
+GUID_ENTRY("ARM_PLATFORM_TOKEN_SPACE", 0x9c0aaed4, 0x74c5, 0x4043, 0xb4, 0x17, 0xa3, 0x22, 0x38, 0x14, 0xce, 0x76)
+GUID_ENTRY("ARM_BOOT_MON_FS_FILE_INFO", 0x41e26b9c, 0xada6, 0x45B3, 0x80, 0x8e, 0x23, 0x57, 0xa3, 0x5b, 0x60, 0xd6)
+GUID_ENTRY("ARM_PLATFORM_UPDATE_FDT_EVENT", 0xaffe115b, 0x8589, 0x456D, 0xba, 0xb5, 0x8f, 0x2e, 0xda, 0x53, 0xae, 0xb7)
+GUID_ENTRY("ARM_REAL_VIEW_EB_PKG_TOKEN_SPACE", 0x44577a0d, 0x361a, 0x45B2, 0xb3, 0x3d, 0xbb, 0x9e, 0xe6, 0x0d, 0x5a, 0x4f)
+GUID_ENTRY("ARM_VEXPRESS_TOKEN_SPACE", 0x9c0aaed4, 0x74c5, 0x4043, 0xb4, 0x17, 0xa3, 0x22, 0x38, 0x14, 0xce, 0x76)
+GUID_ENTRY("ARM_VIRTUALIZATION_TOKEN_SPACE", 0x0b6f5ca7, 0x4f53, 0x445A, 0xb7, 0x6e, 0x2e, 0x36, 0x5b, 0x80, 0x63, 0x66)
+GUID_ENTRY("EARLY_PL011_BASE_ADDRESS", 0xb199dea9, 0xfd5c, 0x4A84, 0x80, 0x82, 0x2f, 0x41, 0x70, 0x78, 0x03, 0x05)
+GUID_ENTRY("BEAGLE_BOARD_TOKEN_SPACE", 0x6834fe45, 0x4aee, 0x4FC6, 0xbc, 0xb5, 0xff, 0x45, 0xb7, 0xa8, 0x71, 0xe2)
+GUID_ENTRY("EFI_ACPI_DESCRIPTION", 0x3c699197, 0x093c, 0x4C69, 0xb0, 0x6b, 0x12, 0x8a, 0xe3, 0x48, 0x1d, 0xc9)
+GUID_ENTRY("EFI_FLASH_MAP_HOB", 0xb091e7d2, 0x05a0, 0x4198, 0x94, 0xf0, 0x74, 0xb7, 0xb8, 0xc5, 0x54, 0x59)
+GUID_ENTRY("EFI_SMM_BASE_THUNK_COMMUNICATION", 0x6568a3d6, 0x015f, 0x4B4A, 0x9c, 0x89, 0x1d, 0x14, 0x63, 0x14, 0x13, 0x0a)
+GUID_ENTRY("EFI_BOOT_STATE", 0x60b5e939, 0x0fcf, 0x4227, 0xba, 0x83, 0x6b, 0xbe, 0xd4, 0x5b, 0xc0, 0xe3)
+GUID_ENTRY("EFI_EDK_COMPATIBILITY_PKG_TOKEN_SPACE", 0x2354d320, 0x3eb3, 0x4C81, 0x99, 0xf4, 0xcc, 0x4a, 0xe1, 0x43, 0x46, 0x3e)
+GUID_ENTRY("EMBEDDED_TOKEN_SPACE", 0xe0d8ca17, 0x4276, 0x4386, 0xbb, 0x79, 0x48, 0xcb, 0x81, 0x3d, 0x3c, 0x4f)
+GUID_ENTRY("FDT_TABLE", 0xb1b621d5, 0xf19c, 0x41A5, 0x83, 0x0b, 0xd9, 0x15, 0x2c, 0x69, 0xaa, 0xe0)
+GUID_ENTRY("HARDWARE_INTERRUPT_PROTOCOL", 0x2890b3ea, 0x053d, 0x1643, 0xad, 0x0c, 0xd6, 0x48, 0x08, 0xda, 0x3f, 0xf1)
+GUID_ENTRY("EMBEDDED_GPIO_PROTOCOL", 0x17a0a3d7, 0xc0a5, 0x4635, 0xbb, 0xd5, 0x07, 0x21, 0x87, 0xdf, 0xe2, 0xee)
+GUID_ENTRY("ANDROID_FASTBOOT_TRANSPORT_PROTOCOL", 0x74bd9fe0, 0x8902, 0x11E3, 0xb9, 0xd3, 0xf7, 0x22, 0x38, 0xfc, 0x9a, 0x31)
+GUID_ENTRY("ANDROID_FASTBOOT_PLATFORM_PROTOCOL", 0x524685a0, 0x89a0, 0x11E3, 0x9d, 0x4d, 0xbf, 0xa9, 0xf6, 0xa4, 0x03, 0x08)
+GUID_ENTRY("USB_DEVICE_PROTOCOL", 0x021bd2ca, 0x51d2, 0x11E3, 0x8e, 0x56, 0xb7, 0x54, 0x17, 0xc7, 0x0b, 0x44)
+GUID_ENTRY("EMU_THREAD_THUNK_PROTOCOL", 0x3b1e4b7c, 0x09d8, 0x944F, 0xa4, 0x08, 0x13, 0x09, 0xeb, 0x8b, 0x44, 0x27)
+GUID_ENTRY("EMU_THUNK_PPI", 0xe113f896, 0x75cf, 0xF640, 0x81, 0x7f, 0xc8, 0x5a, 0x79, 0xe8, 0xae, 0x67)
+GUID_ENTRY("EMULATOR_PKG_TOKEN_SPACE", 0x4f792e68, 0xe8c8, 0x794E, 0xb1, 0xd8, 0x37, 0x03, 0xf3, 0xf2, 0xd5, 0xa5)
+GUID_ENTRY("EMU_SYSTEM_CONFIG", 0xf8626165, 0x6ceb, 0x924A, 0xba, 0xfc, 0xf1, 0x3a, 0xb9, 0xd6, 0x57, 0x28)
+GUID_ENTRY("EXIT_PM_AUTH_PROTOCOL", 0xd088a413, 0x0a70, 0x4217, 0xba, 0x55, 0x9a, 0x3c, 0xb6, 0x5c, 0x41, 0xb3)
+GUID_ENTRY("EFI_SMM_PEI_SMRAM_MEMORY_RESERVE", 0x6dadf1d1, 0xd4cc, 0x4910, 0xbb, 0x6e, 0x82, 0xb1, 0xfd, 0x80, 0xff, 0x3d)
+GUID_ENTRY("EFI_PEI144_FLOPPY_BLOCK_IO_PPI", 0xda6855bd, 0x07b7, 0x4C05, 0x9e, 0xd8, 0xe2, 0x59, 0xfd, 0x36, 0x0e, 0x22)
+GUID_ENTRY("EFI_PEI_FV_FILE_LOADER_PPI", 0x7e1f0d85, 0x04ff, 0x4BB2, 0x86, 0x6a, 0x31, 0xa2, 0x99, 0x6a, 0x48, 0xa8)
+GUID_ENTRY("INTEL_FSP_PKG_TOKEN_SPACE", 0x834c0c5f, 0xadb3, 0x4372, 0xae, 0xeb, 0x03, 0xe4, 0xe9, 0xe6, 0xc5, 0x91)
+GUID_ENTRY("FSP_HEADER_FILE", 0x912740be, 0x2284, 0x4734, 0xb9, 0x71, 0x84, 0xb0, 0x27, 0x35, 0x3f, 0x0c)
+GUID_ENTRY("FSP_BOOT_LOADER_TEMPORARY_MEMORY", 0xbbcff46c, 0xc8d3, 0x4113, 0x89, 0x85, 0xb9, 0xd4, 0xf3, 0xb3, 0xf6, 0x4e)
+GUID_ENTRY("FSP_RESERVED_MEMORY_RESOURCE_HOB", 0x69a79759, 0x1373, 0x4367, 0xa6, 0xc4, 0xc7, 0xf5, 0x9e, 0xfd, 0x98, 0x6e)
+GUID_ENTRY("FSP_NON_VOLATILE_STORAGE_HOB", 0x721acf02, 0x4d77, 0x4C2A, 0xb3, 0xdc, 0x27, 0x0b, 0x7b, 0xa9, 0xe4, 0xb0)
+GUID_ENTRY("FSP_RESERVED_MEMORY_RESOURCE_HOB_TSEG", 0xd038747c, 0xd00c, 0x4980, 0xb3, 0x19, 0x49, 0x01, 0x99, 0xa4, 0x7d, 0x55)
+GUID_ENTRY("FSP_RESERVED_MEMORY_RESOURCE_HOB_GFX", 0x9c7c3aa7, 0x5332, 0x4917, 0x82, 0xb9, 0x56, 0xa5, 0xf3, 0xe6, 0x2a, 0x07)
+GUID_ENTRY("FSP_RESERVED_MEMORY_RESOURCE_HOB_MISC", 0x00d6b14b, 0x7dd0, 0x4062, 0x88, 0x21, 0xe5, 0xf9, 0x6a, 0x2a, 0x1b, 0x00)
+GUID_ENTRY("FSP_WRAPPER_TOKEN_SPACE", 0x2bc1c74a, 0x122f, 0x40B2, 0xb2, 0x23, 0x08, 0x2b, 0x74, 0x65, 0x22, 0x5d)
+GUID_ENTRY("FSP_INIT_DONE_PPI", 0xf5ef05e4, 0xd538, 0x4774, 0x8f, 0x1b, 0xe9, 0x77, 0x30, 0x11, 0xe0, 0x38)
+GUID_ENTRY("TOP_OF_TEMPORARY_RAM_PPI", 0x2f3962b2, 0x57c5, 0x44EC, 0x9e, 0xfc, 0xa6, 0x9f, 0xd3, 0x02, 0x03, 0x2b)
+GUID_ENTRY("PCD_DATA_BASE_SIGNATURE", 0x3c7d193c, 0x682c, 0x4C14, 0xa6, 0x8f, 0x55, 0x2d, 0xea, 0x4f, 0x43, 0x7e)
+GUID_ENTRY("EDKII_WORKING_BLOCK_SIGNATURE", 0x9e58292b, 0x7c68, 0x497D, 0xa0, 0xce, 0x65, 0x00, 0xfd, 0x9f, 0x1b, 0x95)
+GUID_ENTRY("EDKII_FAULT_TOLERANT_WRITE", 0x1d3e9cb8, 0x43af, 0x490B, 0x83, 0x0a, 0x35, 0x16, 0xaa, 0x53, 0x20, 0x47)
+GUID_ENTRY("USB_KEYBOARD_LAYOUT_KEY", 0x3a4d7a7c, 0x018a, 0x4B42, 0x81, 0xb3, 0xdc, 0x10, 0xe3, 0xb5, 0x91, 0xbd)
+GUID_ENTRY("FIRMWARE_PERFORMANCE_S3_POINTER", 0x0dc65adc, 0xa973, 0x4130, 0x8d, 0xf0, 0x2a, 0xdb, 0xeb, 0x9e, 0x4a, 0x31)
+GUID_ENTRY("EVENT_EXIT_BOOT_SERVICES_FAILED", 0x4f6c5507, 0x232f, 0x4787, 0xb9, 0x5e, 0x72, 0xf8, 0x62, 0x49, 0x0c, 0xb1)
+GUID_ENTRY("EDKII_STATUS_CODE_DATA_TYPE_VARIABLE", 0xf6ee6dbb, 0xd67f, 0x4EA0, 0x8b, 0x96, 0x6a, 0x71, 0xb1, 0x9d, 0x84, 0xad)
+GUID_ENTRY("EDKII_MEMORY_PROFILE", 0x821c9a09, 0x541a, 0x40F6, 0x9f, 0x43, 0x0a, 0xd1, 0x93, 0xa1, 0x2c, 0xfe)
+GUID_ENTRY("EDKII_VAR_ERROR_FLAG", 0x04b37fe8, 0xf6ae, 0x480B, 0xbd, 0xd5, 0x37, 0xd9, 0x8c, 0x5e, 0x89, 0xaa)
+GUID_ENTRY("PEI_USB2_HOST_CONTROLLER_PPI", 0xfedd6305, 0xe2d7, 0x4ED5, 0x9f, 0xaa, 0xda, 0x08, 0x0e, 0x33, 0x6c, 0x22)
+GUID_ENTRY("PEI_POST_SCRIPT_TABLE_PPI", 0x88c9d306, 0x0900, 0x4EB5, 0x82, 0x60, 0x3e, 0x2d, 0xbe, 0xda, 0x1f, 0x89)
+GUID_ENTRY("PEI_SERIAL_PORT_PPI", 0x490e9d85, 0x8aef, 0x4193, 0x8e, 0x56, 0xf7, 0x34, 0xa9, 0xff, 0xac, 0x8b)
+GUID_ENTRY("EDKII_VARIABLE_LOCK_PROTOCOL", 0xcd3d0a05, 0x9e24, 0x437C, 0xa8, 0x91, 0x1e, 0xe0, 0x53, 0xdb, 0x76, 0x38)
+GUID_ENTRY("EDKII_VAR_CHECK_PROTOCOL", 0xaf23b340, 0x97b4, 0x4685, 0x8d, 0x4f, 0xa3, 0xf2, 0x81, 0x69, 0xb2, 0x1d)
+GUID_ENTRY("EDKII_SMM_VAR_CHECK_PROTOCOL", 0xb0d8f3c1, 0xb7de, 0x4C11, 0xbc, 0x89, 0x2f, 0xb5, 0x62, 0xc8, 0xc4, 0x11)
+GUID_ENTRY("EDKII_FORM_DISPLAY_ENGINE_PROTOCOL", 0x9bbe29e9, 0xfda1, 0x41EC, 0xad, 0x52, 0x45, 0x22, 0x13, 0x74, 0x2d, 0x2e)
+GUID_ENTRY("EDKII_FORM_BROWSER_EX2_PROTOCOL", 0xa770c357, 0xb693, 0x4E6D, 0xa6, 0xcf, 0xd2, 0x1c, 0x72, 0x8e, 0x55, 0x0b)
+GUID_ENTRY("EFI_FILE_INFO", 0x09576e92, 0x6d3f, 0x11D2, 0x8e, 0x39, 0x00, 0xa0, 0xc9, 0x69, 0x72, 0x3b)
+GUID_ENTRY("EFI_EVENT_READY_TO_BOOT", 0x7ce88fb3, 0x4bd7, 0x4679, 0x87, 0xa8, 0xa8, 0xd8, 0xde, 0xe5, 0x0d, 0x2b)
+GUID_ENTRY("EFI_EVENT_MEMORY_MAP_CHANGE", 0x78bee926, 0x692f, 0x48FD, 0x9e, 0xdb, 0x01, 0x42, 0x2e, 0xf0, 0xd7, 0xab)
+GUID_ENTRY("EFI_EVENT_VIRTUAL_ADDRESS_CHANGE", 0x13fa7698, 0xc831, 0x49C7, 0x87, 0xea, 0x8f, 0x43, 0xfc, 0xc2, 0x51, 0x96)
+GUID_ENTRY("EFI_EVENT_EXIT_BOOT_SERVICES", 0x27abf055, 0xb1b8, 0x4C26, 0x80, 0x48, 0x74, 0x8f, 0x37, 0xba, 0xa2, 0xdf)
+GUID_ENTRY("EFI_EVENT_USER_PROFILE_CHANGED", 0xbaf1e6de, 0x209e, 0x4ADB, 0x8d, 0x96, 0xfd, 0x8b, 0x71, 0xf3, 0xf6, 0x83)
+GUID_ENTRY("EFI_USER_CREDENTIAL_CLASS_UNKNOWN", 0x5cf32e68, 0x7660, 0x449B, 0x80, 0xe6, 0x7e, 0xa3, 0x6e, 0x03, 0xf6, 0xa8)
+GUID_ENTRY("EFI_USER_CREDENTIAL_CLASS_PASSWORD", 0xf8e5058c, 0xccb6, 0x4714, 0xb2, 0x20, 0x3f, 0x7e, 0x3a, 0x64, 0x0b, 0xd1)
+GUID_ENTRY("EFI_USER_CREDENTIAL_CLASS_SMART_CARD", 0x5f03ba33, 0x8c6b, 0x4C24, 0xaa, 0x2e, 0x14, 0xa2, 0x65, 0x7b, 0xd4, 0x54)
+GUID_ENTRY("EFI_USER_CREDENTIAL_CLASS_FINGERPRINT", 0x32cba21f, 0xf308, 0x4CBC, 0x9a, 0xb5, 0xf5, 0xa3, 0x69, 0x9f, 0x04, 0x4a)
+GUID_ENTRY("EFI_USER_CREDENTIAL_CLASS_HANDPRINT", 0x5917ef16, 0xf723, 0x4BB9, 0xa6, 0x4b, 0xd8, 0xc5, 0x32, 0xf4, 0xd8, 0xb5)
+GUID_ENTRY("EFI_USER_CREDENTIAL_CLASS_SECURE_CARD", 0x8a6b4a83, 0x42fe, 0x45D2, 0xa2, 0xef, 0x46, 0xf0, 0x6c, 0x7d, 0x98, 0x52)
+GUID_ENTRY("EFI_KMS_FORMAT_RSASHA2563072", 0x4e1356c2, 0x0eed, 0x463F, 0x81, 0x47, 0x99, 0x33, 0xab, 0xdb, 0xc7, 0xd5)
+GUID_ENTRY("EFI_FMP_CAPSULE", 0x6dcbd5ed, 0xe82d, 0x4C44, 0xbd, 0xa1, 0x71, 0x94, 0x19, 0x9a, 0xd9, 0x2a)
+GUID_ENTRY("EFI_CERT_X509_SHA256", 0x3bd2a492, 0x96c0, 0x4079, 0xb4, 0x20, 0xfc, 0xf9, 0x8e, 0xf1, 0x03, 0xed)
+GUID_ENTRY("EFI_CERT_X509_SHA384", 0x7076876e, 0x80c2, 0x4EE6, 0xaa, 0xd2, 0x28, 0xb3, 0x49, 0xa6, 0x86, 0x5b)
+GUID_ENTRY("EFI_CERT_X509_SHA512", 0x446dbf63, 0x2502, 0x4CDA, 0xbc, 0xfa, 0x24, 0x65, 0xd2, 0xb0, 0xfe, 0x9d)
+GUID_ENTRY("EFI_RNG_ALGORITHM_SP80090_HASH256", 0xa7af67cb, 0x603b, 0x4D42, 0xba, 0x21, 0x70, 0xbf, 0xb6, 0x29, 0x3f, 0x96)
+GUID_ENTRY("EFI_RNG_ALGORITHM_SP80090_HMAC256", 0xc5149b43, 0xae85, 0x4F53, 0x99, 0x82, 0xb9, 0x43, 0x35, 0xd3, 0xa9, 0xe7)
+GUID_ENTRY("EFI_RNG_ALGORITHM_SP80090_CTR256", 0x44f0de6e, 0x4d8c, 0x4045, 0xa8, 0xc7, 0x4d, 0xd1, 0x68, 0x85, 0x6b, 0x9e)
+GUID_ENTRY("EFI_RNG_ALGORITHM_X9313_DES", 0x63c4785a, 0xca34, 0x4012, 0xa3, 0xc8, 0x0b, 0x6a, 0x32, 0x4f, 0x55, 0x46)
+GUID_ENTRY("EFI_RNG_ALGORITHM_X931_AES", 0xacd03321, 0x777e, 0x4D3D, 0xb1, 0xc8, 0x20, 0xcf, 0xd8, 0x88, 0x20, 0xc9)
+GUID_ENTRY("EFI_ADAPTER_INFO_MEDIA_STATE", 0xd7c74207, 0xa831, 0x4A26, 0xb1, 0xf5, 0xd1, 0x93, 0x06, 0x5c, 0xe8, 0xb6)
+GUID_ENTRY("EFI_ADAPTER_INFO_NETWORK_BOOT", 0x1fbd2960, 0x4130, 0x41E5, 0x94, 0xac, 0xd2, 0xcf, 0x03, 0x7f, 0xb3, 0x7c)
+GUID_ENTRY("EFI_ADAPTER_INFO_SAN_MAC_ADDRESS", 0x114da5ef, 0x2cf1, 0x4E12, 0x9b, 0xbb, 0xc4, 0x70, 0xb5, 0x52, 0x05, 0xd9)
+GUID_ENTRY("EFI_VECTOR_HANDOFF_TABLE", 0x996ec11c, 0x5397, 0x4E73, 0xb5, 0x8f, 0x82, 0x7e, 0x52, 0x90, 0x6d, 0xef)
+GUID_ENTRY("ADAPTER_INFO_PLATFORM_SECURITY", 0x6be272c7, 0x1320, 0x4CCD, 0x90, 0x17, 0xd4, 0x61, 0x2c, 0x01, 0x2b, 0x25)
+GUID_ENTRY("EFI_PEI_MASTER_BOOT_MODE_PPI", 0x7408d748, 0xfc8c, 0x4EE6, 0x92, 0x88, 0xc4, 0xbe, 0xc0, 0x92, 0xa4, 0x10)
+GUID_ENTRY("EFI_PEI_BOOT_IN_RECOVERY_MODE_PPI", 0x17ee496a, 0xd8e4, 0x4B9A, 0x94, 0xd1, 0xce, 0x82, 0x72, 0x30, 0x08, 0x50)
+GUID_ENTRY("GET_PCD_INFO_PPI", 0x4d8b155b, 0xc059, 0x4C8F, 0x89, 0x26, 0x06, 0xfd, 0x43, 0x31, 0xdb, 0x8a)
+GUID_ENTRY("EFI_GET_PCD_INFO_PPI", 0xa60c6b59, 0xe459, 0x425D, 0x9c, 0x69, 0x0b, 0xcc, 0x9c, 0xb2, 0x7d, 0x81)
+GUID_ENTRY("EFI_PEI_I2C_MASTER_PPI", 0xb3bfab9b, 0x9f9c, 0x4E8B, 0xad, 0x37, 0x7f, 0x8c, 0x51, 0xfc, 0x62, 0x80)
+GUID_ENTRY("EFI_PEI_FIRMWARE_VOLUME_INFO2_PPI", 0xea7ca24b, 0xded5, 0x4DAD, 0xa3, 0x89, 0xbf, 0x82, 0x7e, 0x8f, 0x9b, 0x38)
+GUID_ENTRY("GET_PCD_INFO_PROTOCOL", 0x5be40f57, 0xfa68, 0x4610, 0xbb, 0xbf, 0xe9, 0xc5, 0xfc, 0xda, 0xd3, 0x65)
+GUID_ENTRY("EFI_GET_PCD_INFO_PROTOCOL", 0xfd0f4478, 0x0efd, 0x461D, 0xba, 0x2d, 0xe5, 0x8c, 0x45, 0xfd, 0x5f, 0x5e)
+GUID_ENTRY("EFI_I2C_MASTER_PROTOCOL", 0xcd72881f, 0x45b5, 0x4FEB, 0x98, 0xc8, 0x31, 0x3d, 0xa8, 0x11, 0x74, 0x62)
+GUID_ENTRY("EFI_I2C_IO_PROTOCOL", 0xb60a3e6b, 0x18c4, 0x46E5, 0xa2, 0x9a, 0xc9, 0xa1, 0x06, 0x65, 0xa2, 0x8e)
+GUID_ENTRY("EFI_I2C_ENUMERATE_PROTOCOL", 0xda8cd7c4, 0x1c00, 0x49E2, 0x80, 0x3e, 0x52, 0x14, 0xe7, 0x01, 0x89, 0x4c)
+GUID_ENTRY("EFI_I2C_HOST_PROTOCOL", 0xa5aab9e3, 0xc727, 0x48CD, 0x8b, 0xbf, 0x42, 0x72, 0x33, 0x85, 0x49, 0x48)
+GUID_ENTRY("EFI_I2C_BUS_CONFIGURATION_MANAGEMENT_PROTOCOL", 0x55b71fb5, 0x17c6, 0x410E, 0xb5, 0xbd, 0x5f, 0xa2, 0xe3, 0xd4, 0x46, 0x6b)
+GUID_ENTRY("EFI_TR_EEPROTOCOL", 0x607f766c, 0x7455, 0x42BE, 0x93, 0x0b, 0xe4, 0xd7, 0x6d, 0xb2, 0x72, 0x0f)
+GUID_ENTRY("EFI_DISK_IO2_PROTOCOL", 0x151c8eae, 0x7f2c, 0x472C, 0x9e, 0x54, 0x98, 0x28, 0x19, 0x4f, 0x6a, 0x88)
+GUID_ENTRY("EFI_TIMESTAMP_PROTOCOL", 0xafbfde41, 0x2e6e, 0x4262, 0xba, 0x65, 0x62, 0xb9, 0x23, 0x6e, 0x54, 0x95)
+GUID_ENTRY("EFI_RNG_PROTOCOL", 0x3152bca5, 0xeade, 0x433D, 0x86, 0x2e, 0xc0, 0x1c, 0xdc, 0x29, 0x1f, 0x44)
+GUID_ENTRY("EFI_ADAPTER_INFORMATION_PROTOCOL", 0xe5dd1403, 0xd622, 0xC24E, 0x84, 0x88, 0xc7, 0x1b, 0x17, 0xf5, 0xe8, 0x02)
+GUID_ENTRY("EFI_NETWORK_PKG_TOKEN_SPACE", 0x40e064b2, 0x0ae0, 0x48B1, 0xa0, 0x7d, 0xf8, 0xcf, 0x1e, 0x1a, 0x23, 0x10)
+GUID_ENTRY("EFI_NT32_PKG_TOKEN_SPACE", 0x0d79a645, 0x1d91, 0x40A6, 0xa8, 0x1f, 0x61, 0xe6, 0x98, 0x2b, 0x32, 0xb4)
+GUID_ENTRY("PEI_NT_AUTO_SCAN_PPI", 0x0dce384d, 0x007c, 0x4BA5, 0x94, 0xbd, 0x0f, 0x6e, 0xb6, 0x4d, 0x2a, 0xa9)
+GUID_ENTRY("NT_PEI_LOAD_FILE_PPI", 0xfd0c65eb, 0x0405, 0x4CD2, 0x8a, 0xee, 0xf4, 0x00, 0xef, 0x13, 0xba, 0xc2)
+GUID_ENTRY("WIN_NT_BUS_DRIVER", 0x0419f582, 0x0625, 0x4531, 0x8a, 0x33, 0x85, 0xa9, 0x96, 0x5c, 0x95, 0xbc)
+GUID_ENTRY("OMAP35XX_TOKEN_SPACE", 0x24b09abe, 0x4e47, 0x481C, 0xa9, 0xad, 0xce, 0xf1, 0x2c, 0x39, 0x23, 0x27)
+GUID_ENTRY("OPTION_ROM_PKG_TOKEN_SPACE", 0x1e43298f, 0x3478, 0x41A7, 0xb5, 0x77, 0x86, 0x06, 0x46, 0x35, 0xc7, 0x28)
+GUID_ENTRY("UEFI_OVMF_PKG_TOKEN_SPACE", 0x93bb96af, 0xb9f2, 0x4EB8, 0x94, 0x62, 0xe0, 0xba, 0x74, 0x56, 0x42, 0x36)
+GUID_ENTRY("OVMF_PLATFORM_CONFIG", 0x7235c51c, 0x0c80, 0x4CAB, 0x87, 0xac, 0x3b, 0x08, 0x4a, 0x63, 0x04, 0xb1)
+GUID_ENTRY("VIRTIO_MMIO_TRANSPORT", 0x837dca9e, 0xe874, 0x4D82, 0xb2, 0x9a, 0x23, 0xfe, 0x0e, 0x23, 0xd1, 0xe2)
+GUID_ENTRY("VIRTIO_DEVICE_PROTOCOL", 0xfa920010, 0x6785, 0x4941, 0xb6, 0xec, 0x49, 0x8c, 0x57, 0x9f, 0x16, 0x0a)
+GUID_ENTRY("XEN_BUS_PROTOCOL", 0x3d3ca290, 0xb9a5, 0x11E3, 0xb7, 0x5d, 0xb8, 0xac, 0x6f, 0x7d, 0x65, 0xe6)
+GUID_ENTRY("DXE_DEBUGPORT_EXT_PROTOCOL", 0x31a4878f, 0x230d, 0x4FC2, 0x90, 0xbb, 0xda, 0x5f, 0x41, 0xa4, 0x4b, 0x1b)
+GUID_ENTRY("DXE_DEBUG_CMD_PROTOCOL", 0xca3b3a50, 0x5698, 0x4551, 0x8b, 0x18, 0xce, 0xae, 0xef, 0x91, 0x7d, 0x50)
+GUID_ENTRY("DXE_DEBUG_DISPATCH_PROTOCOL", 0x301af449, 0xe0d7, 0x43A3, 0x8b, 0x1b, 0xbc, 0x16, 0x72, 0x5d, 0x37, 0x4b)
+GUID_ENTRY("EFI_TCG_PRIVATE_INTERFACE", 0x7a28436a, 0xe113, 0x406A, 0xaf, 0xf9, 0x0d, 0xbf, 0x7f, 0x64, 0x3e, 0x02)
+GUID_ENTRY("PDM_WINDOW_BUTTON", 0x5f65dfdb, 0xac20, 0x4F43, 0x9b, 0x21, 0x26, 0x9e, 0x81, 0xa0, 0xea, 0x7e)
+GUID_ENTRY("PDM_WINDOW_SPIN", 0x60b27e1a, 0xd65e, 0x4DB0, 0xb2, 0xbb, 0xc1, 0x6f, 0xa7, 0x1e, 0x44, 0xab)
+GUID_ENTRY("PEI_DEBUG_DISPATCH_PPI", 0xc9737920, 0xc2ad, 0x41C3, 0xb1, 0x33, 0x0f, 0x9c, 0x25, 0x1b, 0x67, 0x43)
+GUID_ENTRY("PEI_POST_BOOT_SCRIPT_TABLE_PPI", 0x88c9d306, 0x0900, 0x4EB5, 0x82, 0x60, 0x3e, 0x2d, 0xbe, 0xda, 0x1f, 0x89)
+GUID_ENTRY("PHOENIX_DESKTOP_MESSAGE_PROTOCOL", 0x87dd3539, 0x0667, 0x4BB7, 0x9f, 0xb2, 0x47, 0xd3, 0xc5, 0x0b, 0x02, 0x1b)
+GUID_ENTRY("PHOENIX_DESKTOP_WINDOW_PROTOCOL", 0x6ffec78d, 0x7dbf, 0x4F8B, 0x96, 0x8d, 0x2f, 0x43, 0xa0, 0x80, 0xc1, 0x3f)
+GUID_ENTRY("PHOENIX_GDI_PROTOCOL", 0x3f5a74b2, 0xbf80, 0x4850, 0x85, 0x91, 0x4f, 0x2d, 0xf5, 0xf9, 0xcb, 0x2b)
+GUID_ENTRY("PHOENIX_SMM_CORE_SERVICES_PROTOCOL", 0x177e63c1, 0xaed6, 0x4D88, 0x91, 0x7e, 0x9b, 0x4f, 0xb9, 0xfe, 0x40, 0x92)
+GUID_ENTRY("PHOENIX_EFI_SMM_SW_SMI_PROTOCOL", 0xff052503, 0x1af9, 0x4AEB, 0x83, 0xc4, 0xc2, 0xd4, 0xce, 0xb1, 0x0c, 0xa3)
+GUID_ENTRY("PHOENIX_SMM_WATCHDOG_TIMER_PROTOCOL", 0x6fde3af8, 0x37ad, 0x43FC, 0xb7, 0x28, 0xf4, 0xd3, 0x41, 0xf3, 0x92, 0x40)
+GUID_ENTRY("SCT_ISA_HC_PPI", 0x8d48bd70, 0xc8a3, 0x4C06, 0x90, 0x1b, 0x74, 0x79, 0x46, 0xaa, 0xc3, 0x58)
+GUID_ENTRY("SCT_ISA_HC_PROTOCOL", 0x5fac7360, 0xd4f2, 0x4C9E, 0xa7, 0xed, 0xf2, 0x59, 0x5e, 0x67, 0x08, 0x89)
+GUID_ENTRY("PEI_SPEAKER_INTERFACE_PPI", 0x30ac275e, 0xbb30, 0x4B84, 0xa1, 0xcd, 0x0a, 0xf1, 0x32, 0x2c, 0x89, 0xc0)
+GUID_ENTRY("PEI_MFG_MEMORY_TEST_PPI", 0xab294a92, 0xeaf5, 0x4CF3, 0xab, 0x2b, 0x2d, 0x4b, 0xed, 0x4d, 0xb6, 0x3d)
+GUID_ENTRY("PEI_SHA256_HASH_PPI", 0x950e191b, 0x8524, 0x4F51, 0x80, 0xa1, 0x5c, 0x4f, 0x1b, 0x03, 0xf3, 0x5c)
+GUID_ENTRY("EFI_PLATFORM_BOOT_MODE", 0xce845704, 0x1683, 0x4D38, 0xa4, 0xf9, 0x7d, 0x0b, 0x50, 0x77, 0x57, 0x93)
+GUID_ENTRY("EFI_PLATFORM_INFO", 0x1e2acc41, 0xe26a, 0x483D, 0xaf, 0xc7, 0xa0, 0x56, 0xc3, 0x4e, 0x08, 0x7b)
+GUID_ENTRY("PLATFORM_MODULE_TOKEN_SPACE", 0x69d13bf0, 0xaf91, 0x4D96, 0xaa, 0x9f, 0x21, 0x84, 0xc5, 0xce, 0x3b, 0xc0)
+GUID_ENTRY("EFI_SERIAL_PORT_TOKEN_SPACE", 0x5fad2389, 0x2bc7, 0x4BD2, 0x83, 0xd3, 0x42, 0x9f, 0xb6, 0xae, 0xa3, 0x3f)
+GUID_ENTRY("EFI_ICH_TOKEN_SPACE", 0xe38c11e3, 0x968f, 0x47B8, 0xac, 0xef, 0xac, 0xc0, 0x69, 0x3d, 0xb9, 0xff)
+GUID_ENTRY("EFI_PCH_TOKEN_SPACE", 0x89a1b278, 0xa1a1, 0x4DF7, 0xb1, 0x37, 0xde, 0x5a, 0xd7, 0xc4, 0x79, 0x13)
+GUID_ENTRY("EFI_PLATFORM_CPU_INFO", 0xbb9c7ab7, 0xb8d9, 0x4BF3, 0x9c, 0x29, 0x9b, 0xf3, 0x41, 0xe2, 0x17, 0xbc)
+GUID_ENTRY("EFI_BIOS_ID", 0xc3e36d09, 0x8294, 0x4B97, 0xa8, 0x57, 0xd5, 0x28, 0x8f, 0xe3, 0x3e, 0x28)
+GUID_ENTRY("EFI_BOARD_FEATURES", 0x94b9e8ae, 0x8877, 0x479A, 0x98, 0x42, 0xf5, 0x97, 0x4b, 0x82, 0xce, 0xd3)
+GUID_ENTRY("ITK_DATA_VAR", 0x3812723d, 0x7e48, 0x4E29, 0xbc, 0x27, 0xf5, 0xa3, 0x9a, 0xc9, 0x4e, 0xf1)
+GUID_ENTRY("DMI_DATA", 0x70e56c5e, 0x280c, 0x44B0, 0xa4, 0x97, 0x09, 0x68, 0x1a, 0xbc, 0x37, 0x5e)
+GUID_ENTRY("IDCC_DATA_HUB", 0x788e1d9f, 0x1eab, 0x47D2, 0xa2, 0xf3, 0x78, 0xca, 0xe8, 0x7d, 0x60, 0x12)
+GUID_ENTRY("MFG_MODE_VARIABLE", 0xef14fd78, 0x0793, 0x4E2B, 0xac, 0x6d, 0x06, 0x28, 0x47, 0xe0, 0x17, 0x91)
+GUID_ENTRY("ACPIOSFRMFG_STRING_VARIABLE", 0x72234213, 0x0fd7, 0x48A1, 0xa5, 0x9f, 0xb4, 0x1b, 0xc1, 0x07, 0xfb, 0xcd)
+GUID_ENTRY("ACPIOSFRREF_DATA_BLOCK_VARIABLE", 0x72234213, 0x0fd7, 0x48A1, 0xa5, 0x9f, 0xb4, 0x1b, 0xc1, 0x07, 0xfb, 0xcd)
+GUID_ENTRY("ACPIOSFRMODEL_STRING_VARIABLE", 0xca1bcad9, 0xe021, 0x4547, 0xa1, 0xb0, 0x5b, 0x22, 0xc7, 0xf6, 0x87, 0xf4)
+GUID_ENTRY("EFI_PCI_LAN_INFO", 0x0d9a1427, 0xe02a, 0x437D, 0x92, 0x6b, 0xaa, 0x52, 0x1f, 0xd7, 0x22, 0xba)
+GUID_ENTRY("FIRMWARE_ID", 0x5e559c23, 0x1faa, 0x4AE1, 0x8d, 0x4a, 0xc6, 0xcf, 0x02, 0x6c, 0x76, 0x6f)
+GUID_ENTRY("OS_SELECTION_VARIABLE", 0x86843f56, 0x675d, 0x40A5, 0x95, 0x30, 0xbc, 0x85, 0x83, 0x72, 0xf1, 0x03)
+GUID_ENTRY("DXE_PCH_PLATFORM_POLICY_PROTOCOL", 0x4b0165a9, 0x61d6, 0x4E23, 0xa0, 0xb5, 0x3e, 0xc7, 0x9c, 0x2e, 0x30, 0xd5)
+GUID_ENTRY("EFI_LPC_WPCE791_POLICY_PROTOCOL", 0xab2bee2f, 0xc1a6, 0x4399, 0x85, 0x3d, 0xc0, 0x7c, 0x77, 0x4f, 0xfd, 0x0d)
+GUID_ENTRY("USB_POLICY", 0xf617b358, 0x12cf, 0x414A, 0xa0, 0x69, 0x60, 0x67, 0x7b, 0xda, 0x13, 0xb4)
+GUID_ENTRY("DXE_VLV_PLATFORM_POLICY", 0x5bab88ba, 0xe0e2, 0x4674, 0xb6, 0xad, 0xb8, 0x12, 0xf6, 0x88, 0x1c, 0xd6)
+GUID_ENTRY("EFI_SMBIOS_SLOT_POPULATION", 0xef7bf7d6, 0xf8ff, 0x4A76, 0x82, 0x47, 0xc0, 0xd0, 0xd1, 0xcc, 0x49, 0xc0)
+GUID_ENTRY("OBSERVABLE_PROTOCOL", 0xe227c522, 0xd5fe, 0x4A53, 0x87, 0xb1, 0x0f, 0xbe, 0x57, 0x0f, 0x98, 0xe9)
+GUID_ENTRY("EFI_CK505_CLOCK_PLATFORM_INFO", 0x3c485ea4, 0x449a, 0x46CE, 0xbb, 0x08, 0x2a, 0x33, 0x6e, 0xa9, 0x6b, 0x4e)
+GUID_ENTRY("EFI_LPC_WPC83627_POLICY_PROTOCOL", 0xd3ecc567, 0x9fd5, 0x44C1, 0x86, 0xcf, 0x5d, 0xa7, 0xa2, 0x4f, 0x4b, 0x5d)
+GUID_ENTRY("EFI_TCO_RESET_PROTOCOL", 0xa6a79162, 0xe325, 0x4C30, 0xbc, 0xc3, 0x59, 0x37, 0x30, 0x64, 0xef, 0xb3)
+GUID_ENTRY("EFI_WATCHDOG_TIMER_DRIVER_PROTOCOL", 0xd5b06d16, 0x2ea1, 0x4DEF, 0x98, 0xd0, 0xa0, 0x5d, 0x40, 0x72, 0x84, 0x17)
+GUID_ENTRY("EFI_PLATFORM_IDE_INIT_PROTOCOL", 0x377c66a3, 0x8fe7, 0x4EE8, 0x85, 0xb8, 0xf1, 0xa2, 0x82, 0x56, 0x9e, 0x3b)
+GUID_ENTRY("ENHANCED_SPEEDSTEP_PROTOCOL", 0x91a1ddcf, 0x5374, 0x4939, 0x89, 0x51, 0xd7, 0x29, 0x3f, 0x1a, 0x78, 0x6f)
+GUID_ENTRY("EFI_GOP_DISPLAY_BRIGHTNESS_PROTOCOL", 0x6ff23f1d, 0x877c, 0x4B1B, 0x93, 0xfc, 0xf1, 0x42, 0xb2, 0xee, 0xa6, 0xa7)
+GUID_ENTRY("EFI_USB_KEYBOARD_CONNECT", 0xad9c4381, 0x1ede, 0x430C, 0x8d, 0x42, 0x23, 0x76, 0x7c, 0x46, 0x5d, 0x52)
+GUID_ENTRY("EFI_MMIO_DEVICE_PROTOCOL", 0x24486226, 0xf8c2, 0x41F5, 0xb9, 0xdd, 0x78, 0x3e, 0x9e, 0x56, 0xde, 0xa0)
+GUID_ENTRY("EFI_I2C_BUS_CONFIGURATION_MANAGEMENT_PROTOCOL2", 0x75032015, 0xd156, 0x423E, 0xbf, 0xa3, 0x7a, 0x65, 0xab, 0xa4, 0x71, 0x05)
+GUID_ENTRY("EFI_I2C_ACPI_PROTOCOL", 0xf30c2915, 0x5782, 0x4E6A, 0xa8, 0x46, 0x05, 0xba, 0xbc, 0xe7, 0xb6, 0xa0)
+GUID_ENTRY("EFI_I2C_MASTER_PROTOCOL2", 0x578c315a, 0x68cf, 0x4E81, 0xb5, 0xc6, 0x22, 0xdb, 0x40, 0xd0, 0x10, 0xbc)
+GUID_ENTRY("EFI_I2C_HOST_PROTOCOL2", 0x70b221af, 0xfdff, 0x4FDE, 0x99, 0x68, 0x1a, 0xf6, 0x23, 0xa9, 0x56, 0xd9)
+GUID_ENTRY("EFI_I2C_BUS_PROTOCOL", 0x9fa1b225, 0x3346, 0x461B, 0xa0, 0x69, 0xed, 0x01, 0xb6, 0x73, 0xd2, 0x40)
+GUID_ENTRY("EFI_I2C_SLAVE_PROTOCOL", 0xf2c1910e, 0xf5c9, 0x4B72, 0xb2, 0x43, 0x6d, 0x59, 0x09, 0x6a, 0x79, 0xf0)
+GUID_ENTRY("EFI_SPI_ACPI_PROTOCOL", 0x9f49a879, 0x3d71, 0x42B3, 0xa0, 0xad, 0xdd, 0xb1, 0xf3, 0x30, 0x10, 0xa3)
+GUID_ENTRY("EFI_SPI_HOST_PROTOCOL", 0x951b65e5, 0x8872, 0x41ED, 0xad, 0x1d, 0xd5, 0x68, 0x1f, 0x4a, 0xf0, 0x33)
+GUID_ENTRY("EFI_SPI_BUS_PROTOCOL", 0x137b3044, 0xf6d7, 0x473E, 0xa6, 0x25, 0x9f, 0xb9, 0x25, 0x05, 0xc1, 0x80)
+GUID_ENTRY("LPSS_DUMMY_PROTOCOL", 0xaf4cc162, 0xd41c, 0x455A, 0xab, 0x45, 0x6d, 0xbc, 0xc1, 0xcd, 0x32, 0xf3)
+GUID_ENTRY("EFI_GPIO_OPERATION_PROTOCOL", 0x38ddfe8f, 0x8991, 0x44AA, 0x98, 0x89, 0x83, 0xf4, 0x91, 0x84, 0x65, 0xb0)
+GUID_ENTRY("EFI_ESRT_OPERATION_PROTOCOL", 0x4549ab47, 0x6e60, 0x4293, 0xb9, 0x1d, 0x31, 0xb6, 0x10, 0xad, 0x80, 0x56)
+GUID_ENTRY("EFI_FW_DISPLAY_CAPSULE", 0x3b8c8162, 0x188c, 0x46A4, 0xae, 0xc9, 0xbe, 0x43, 0xf1, 0xd6, 0x56, 0x97)
+GUID_ENTRY("EFI_FIRMWARE_CLASS", 0xb122a262, 0x3551, 0x4F48, 0x88, 0x92, 0x55, 0xf6, 0xc0, 0x61, 0x42, 0x90)
+GUID_ENTRY("EFI_DFUVER", 0x0dc73aed, 0xcbf6, 0x4A25, 0xa6, 0x8d, 0x59, 0xc8, 0x0f, 0x44, 0xc7, 0xc3)
+GUID_ENTRY("EFI_ESRT_TABLE", 0xb122a263, 0x3661, 0x4F68, 0x99, 0x29, 0x78, 0xf8, 0xb0, 0xd6, 0x21, 0x80)
+GUID_ENTRY("EFI_CAPSULE_CRASH_LOG_VAR", 0xf3ff1468, 0x04ba, 0x4966, 0x9f, 0xb2, 0xe4, 0xa7, 0x90, 0x05, 0x46, 0x50)
+GUID_ENTRY("EFI_CAPSULE_CRASH", 0x0e1d2972, 0x65af, 0x4AC1, 0xbf, 0xa3, 0xce, 0xf4, 0xab, 0x0c, 0x38, 0xfe)
+GUID_ENTRY("EFI_SECURE_BOOT_ENABLE_DISABLE", 0xf0a30bc7, 0xaf08, 0x4556, 0x99, 0xc4, 0x00, 0x10, 0x09, 0xc9, 0x3a, 0x44)
+GUID_ENTRY("EFI_CUSTOM_MODE_ENABLE", 0xc076ec0c, 0x7028, 0x4399, 0xa0, 0x72, 0x71, 0xee, 0x5c, 0x44, 0x8b, 0x9f)
+GUID_ENTRY("EFI_VENDOR_KEYS_NV", 0x9073e4e0, 0x60ec, 0x4B6E, 0x99, 0x03, 0x4c, 0x22, 0x3c, 0x26, 0x0f, 0x3c)
+GUID_ENTRY("EFI_CERT_DB", 0xd9bee56e, 0x75dc, 0x49D9, 0xb4, 0xd7, 0xb5, 0x34, 0x21, 0x0f, 0x63, 0x7a)
+GUID_ENTRY("TCG_EVENT_ENTRY_HOB", 0x2b9ffb52, 0x1b13, 0x416F, 0xa8, 0x7b, 0xbc, 0x93, 0x0d, 0xef, 0x92, 0xa8)
+GUID_ENTRY("TPM_ERROR_HOB", 0xef598499, 0xb25e, 0x473A, 0xbf, 0xaf, 0xe7, 0xe5, 0x7d, 0xce, 0x82, 0xc4)
+GUID_ENTRY("EFI_TR_EEPHYSICAL_PRESENCE", 0xf24643c2, 0xc622, 0x494E, 0x8a, 0x0d, 0x46, 0x32, 0x57, 0x9c, 0x2d, 0x5b)
+GUID_ENTRY("EFI_TPM_DEVICE_INSTANCE_TPM12", 0x8b01e5b6, 0x4f19, 0x46E8, 0xab, 0x93, 0x1c, 0x53, 0x67, 0x1b, 0x90, 0xcc)
+GUID_ENTRY("EFI_TPM_DEVICE_INSTANCE_TPM20_DTPM", 0x286bf25a, 0xc2c3, 0x408C, 0xb3, 0xb4, 0x25, 0xe6, 0x75, 0x8b, 0x73, 0x17)
+GUID_ENTRY("EFI_TPM_DEVICE_SELECTED", 0x7f4158d3, 0x074d, 0x456D, 0x8c, 0xb2, 0x01, 0xf9, 0xc8, 0xf7, 0x9d, 0xaa)
+GUID_ENTRY("TR_EECONFIG_FORM_SET", 0xc54b425f, 0xaa79, 0x48B4, 0x98, 0x1f, 0x99, 0x8b, 0x3c, 0x4b, 0x64, 0x1c)
+GUID_ENTRY("PEI_TPM_INITIALIZATION_DONE_PPI", 0xa030d115, 0x54dd, 0x447B, 0x90, 0x64, 0xf2, 0x06, 0x88, 0x3d, 0x7c, 0xcc)
+GUID_ENTRY("EFI_PEI_FIRMWARE_VOLUME_INFO_MEASUREMENT_EXCLUDED_PPI", 0x6e056ff9, 0xc695, 0x4364, 0x9e, 0x2c, 0x61, 0x26, 0xf5, 0xce, 0xea, 0xae)
+GUID_ENTRY("SHELL_BCFG_HII", 0x5f5f605d, 0x1583, 0x4A2D, 0xa6, 0xb2, 0xeb, 0x12, 0xda, 0xb4, 0xa2, 0xb6)
+GUID_ENTRY("EFI_SHELL_DYNAMIC_COMMAND_PROTOCOL", 0x3c7200e9, 0x005f, 0x4EA4, 0x87, 0xde, 0xa3, 0xdf, 0xac, 0x8a, 0x27, 0xc3)
+GUID_ENTRY("EFI_SOURCE_LEVEL_DEBUG_PKG_TOKEN_SPACE", 0x865a5aab, 0xb85d, 0x474C, 0x84, 0x55, 0x65, 0xd1, 0xbe, 0x84, 0x4b, 0xe2)
+GUID_ENTRY("STD_LIB_TOKEN_SPACE", 0x447559f0, 0xd02e, 0x4CF1, 0x99, 0xbc, 0xca, 0x11, 0x65, 0x40, 0x54, 0xc2)
+GUID_ENTRY("EFI_SOCKET_PROTOCOL", 0x58e6ed63, 0x1694, 0x440B, 0x93, 0x88, 0xe9, 0x8f, 0xed, 0x6b, 0x65, 0xaf)
+GUID_ENTRY("EFI_SOCKET_SERVICE_BINDING_PROTOCOL", 0x8aaedb2a, 0xa6bb, 0x47C6, 0x94, 0xce, 0x1b, 0x80, 0x96, 0x42, 0x3f, 0x2a)
+GUID_ENTRY("VLV_POLICY_PPI", 0x7d84b2c2, 0x22a1, 0x4372, 0xb1, 0x2c, 0xeb, 0xb2, 0x32, 0xd3, 0xa6, 0xa3)
+GUID_ENTRY("VLV_MMIO_POLICY_PPI", 0xe767bf7f, 0x4db6, 0x5B34, 0x10, 0x11, 0x4f, 0xbe, 0x4c, 0xa7, 0xaf, 0xd2)
+GUID_ENTRY("SE_CF_TPMPPI", 0x10e26df1, 0x8775, 0x4EE1, 0xb5, 0x0a, 0x3a, 0xe8, 0x28, 0x93, 0x70, 0x3a)
+GUID_ENTRY("PCH_INIT_PPI", 0x09ea894a, 0xbe0d, 0x4230, 0xa0, 0x03, 0xed, 0xc6, 0x93, 0xb4, 0x8e, 0x95)
+GUID_ENTRY("PCH_PLATFORM_POLICY_PPI", 0x15344673, 0xd365, 0x4BE2, 0x85, 0x13, 0x14, 0x97, 0xcc, 0x07, 0x61, 0x1d)
+GUID_ENTRY("PEI_SPI_PPI", 0xa38c6898, 0x2b5c, 0x4FF6, 0x93, 0x26, 0x2e, 0x63, 0x21, 0x2e, 0x56, 0xc2)
+GUID_ENTRY("SE_CUMA_PPI", 0xcbd86677, 0x362f, 0x4C04, 0x94, 0x59, 0xa7, 0x41, 0x32, 0x6e, 0x05, 0xcf)
+GUID_ENTRY("PEI_SDHC_PPI", 0xf4ef9d7a, 0x98c5, 0x4C1A, 0xb4, 0xd9, 0xd8, 0xd8, 0x72, 0x65, 0xbe, 0x0c)
+GUID_ENTRY("PEI_BLOCK_IO_PPI", 0xbc5fa650, 0xedbb, 0x4D0D, 0xb3, 0xa3, 0xd9, 0x89, 0x07, 0xf8, 0x47, 0xdf)
+GUID_ENTRY("SE_CF_TPMPOLICY_PPI", 0x4fd1ba49, 0x8f90, 0x471A, 0xa2, 0xc9, 0x17, 0x3c, 0x7a, 0x73, 0x2f, 0xd0)
+GUID_ENTRY("PCH_PEI_INIT_PPI", 0xacb93b08, 0x5cdc, 0x4A8F, 0x93, 0xd4, 0x06, 0xe3, 0x42, 0xdf, 0x18, 0x2e)
+GUID_ENTRY("PPM_PLATFORM_POLICY_PROTOCOL", 0xddabfeac, 0xef63, 0x452C, 0x8f, 0x39, 0xed, 0x7f, 0xae, 0xd8, 0x26, 0x5e)
+GUID_ENTRY("EFI_SD_HOST_IO_PROTOCOL", 0xb63f8ec7, 0xa9c9, 0x4472, 0xa4, 0xc0, 0x4d, 0x8b, 0xf3, 0x65, 0xcc, 0x51)
+GUID_ENTRY("EFI_PCH_INFO_PROTOCOL", 0xd31f0400, 0x7d16, 0x4316, 0xbf, 0x88, 0x60, 0x65, 0x88, 0x3b, 0x40, 0x2b)
+GUID_ENTRY("EFI_PCH_EXTENDED_RESET_PROTOCOL", 0xf0bbfca0, 0x684e, 0x48B3, 0xba, 0xe2, 0x6c, 0x84, 0xb8, 0x9e, 0x53, 0x39)
+GUID_ENTRY("DXE_ICH_PLATFORM_POLICY_PROTOCOL", 0xf617b358, 0x12cf, 0x414A, 0xa0, 0x69, 0x60, 0x67, 0x7b, 0xda, 0x13, 0xb3)
+GUID_ENTRY("EFI_ICH_INFO_PROTOCOL", 0xd31f0400, 0x7d16, 0x4316, 0xbf, 0x88, 0x60, 0x65, 0x88, 0x3b, 0x40, 0x2b)
+GUID_ENTRY("EFI_EMMC_CARD_INFO_PROTOCOL", 0x1ebe5ab9, 0x2129, 0x49E7, 0x84, 0xd7, 0xee, 0xb9, 0xfc, 0xe5, 0xde, 0xdd)
+GUID_ENTRY("EFI_TDT_OPERATION_PROTOCOL", 0xfd301ba4, 0x5e62, 0x4679, 0xa0, 0x6f, 0xe0, 0x9a, 0xab, 0xdd, 0x2a, 0x91)
+GUID_ENTRY("EFI_DFURESULT", 0x14a7c46f, 0xbc02, 0x4047, 0x9f, 0x18, 0xa5, 0xd7, 0x25, 0xd8, 0xbd, 0x19)
+GUID_ENTRY("EFI_CPTOKEN_SPACE", 0x918211ce, 0xa1d2, 0x43A0, 0xa0, 0x4e, 0x75, 0xb5, 0xbf, 0x44, 0x50, 0x0e)
+GUID_ENTRY("EFI_VLVTOKEN_SPACE", 0xca452c68, 0xdf0c, 0x45C9, 0x82, 0xfb, 0xea, 0xe4, 0x2b, 0x31, 0x29, 0x46)
+GUID_ENTRY("DXE_PCH_POLICY_UPDATE_PROTOCOL", 0x1a819e49, 0xd8ee, 0x48CB, 0x9a, 0x9c, 0x0a, 0xa0, 0xd2, 0x81, 0x0a, 0x38)
+GUID_ENTRY("POWER_MANAGEMENT_ACPI_TABLE_STORAGE", 0x161be597, 0xe9c5, 0x49DB, 0xae, 0x50, 0xc4, 0x62, 0xab, 0x54, 0xee, 0xda)
+GUID_ENTRY("VLV_REF_CODE_PKG_TOKEN_SPACE", 0x85768e4a, 0x6cdc, 0x444E, 0x93, 0xdf, 0x93, 0x66, 0x85, 0xb5, 0xdf, 0xcc)
+GUID_ENTRY("SE_CPLATFORM_READY_TO_BOOT", 0x03fdf171, 0x1d67, 0x4ACE, 0xa9, 0x04, 0x3e, 0x36, 0xd3, 0x38, 0xfa, 0x74)
+GUID_ENTRY("EFI_VLV2_VARIABLE", 0x10ba6bbe, 0xa97e, 0x41C3, 0x9a, 0x07, 0x60, 0x7a, 0xd9, 0xbd, 0x60, 0xe5)
 
-    /* missing GUIDs merged from https://github.com/jethrogb/uefireverse/blob/master/guiddb/efi_guid.c */
-    
-    { "APP_PKG_TOKEN_SPACE", { 0xe7e1efa6, 0x7607, 0x4A78, 0xa7, 0xdd, 0x43, 0xe4, 0xbd, 0x72, 0xc0, 0x99 } },
-    { "ARM_JUNO_TOKEN_SPACE", { 0xa1147a20, 0x3144, 0x4F8D, 0x82, 0x95, 0xb4, 0x83, 0x11, 0xc8, 0xe4, 0xa4 } },
-    { "ARM_TOKEN_SPACE", { 0xbb11ecfe, 0x820f, 0x4968, 0xbb, 0xa6, 0xf7, 0x6a, 0xfe, 0x30, 0x25, 0x96 } },
-    { "ARM_PLATFORM_TOKEN_SPACE", { 0x9c0aaed4, 0x74c5, 0x4043, 0xb4, 0x17, 0xa3, 0x22, 0x38, 0x14, 0xce, 0x76 } },
-    { "ARM_BOOT_MON_FS_FILE_INFO", { 0x41e26b9c, 0xada6, 0x45B3, 0x80, 0x8e, 0x23, 0x57, 0xa3, 0x5b, 0x60, 0xd6 } },
-    { "ARM_PLATFORM_UPDATE_FDT_EVENT", { 0xaffe115b, 0x8589, 0x456D, 0xba, 0xb5, 0x8f, 0x2e, 0xda, 0x53, 0xae, 0xb7 } },
-    { "ARM_REAL_VIEW_EB_PKG_TOKEN_SPACE", { 0x44577a0d, 0x361a, 0x45B2, 0xb3, 0x3d, 0xbb, 0x9e, 0xe6, 0x0d, 0x5a, 0x4f } },
-    { "ARM_VEXPRESS_TOKEN_SPACE", { 0x9c0aaed4, 0x74c5, 0x4043, 0xb4, 0x17, 0xa3, 0x22, 0x38, 0x14, 0xce, 0x76 } },
-    { "ARM_VIRTUALIZATION_TOKEN_SPACE", { 0x0b6f5ca7, 0x4f53, 0x445A, 0xb7, 0x6e, 0x2e, 0x36, 0x5b, 0x80, 0x63, 0x66 } },
-    { "EARLY_PL011_BASE_ADDRESS", { 0xb199dea9, 0xfd5c, 0x4A84, 0x80, 0x82, 0x2f, 0x41, 0x70, 0x78, 0x03, 0x05 } },
-    { "BEAGLE_BOARD_TOKEN_SPACE", { 0x6834fe45, 0x4aee, 0x4FC6, 0xbc, 0xb5, 0xff, 0x45, 0xb7, 0xa8, 0x71, 0xe2 } },
-    { "EFI_ACPI_DESCRIPTION", { 0x3c699197, 0x093c, 0x4C69, 0xb0, 0x6b, 0x12, 0x8a, 0xe3, 0x48, 0x1d, 0xc9 } },
-    { "EFI_FLASH_MAP_HOB", { 0xb091e7d2, 0x05a0, 0x4198, 0x94, 0xf0, 0x74, 0xb7, 0xb8, 0xc5, 0x54, 0x59 } },
-    { "EFI_SMM_BASE_THUNK_COMMUNICATION", { 0x6568a3d6, 0x015f, 0x4B4A, 0x9c, 0x89, 0x1d, 0x14, 0x63, 0x14, 0x13, 0x0a } },
-    { "EFI_BOOT_STATE", { 0x60b5e939, 0x0fcf, 0x4227, 0xba, 0x83, 0x6b, 0xbe, 0xd4, 0x5b, 0xc0, 0xe3 } },
-    { "EFI_EDK_COMPATIBILITY_PKG_TOKEN_SPACE", { 0x2354d320, 0x3eb3, 0x4C81, 0x99, 0xf4, 0xcc, 0x4a, 0xe1, 0x43, 0x46, 0x3e } },
-    { "EMBEDDED_TOKEN_SPACE", { 0xe0d8ca17, 0x4276, 0x4386, 0xbb, 0x79, 0x48, 0xcb, 0x81, 0x3d, 0x3c, 0x4f } },
-    { "FDT_TABLE", { 0xb1b621d5, 0xf19c, 0x41A5, 0x83, 0x0b, 0xd9, 0x15, 0x2c, 0x69, 0xaa, 0xe0 } },
-    { "HARDWARE_INTERRUPT_PROTOCOL", { 0x2890b3ea, 0x053d, 0x1643, 0xad, 0x0c, 0xd6, 0x48, 0x08, 0xda, 0x3f, 0xf1 } },
-    { "EMBEDDED_GPIO_PROTOCOL", { 0x17a0a3d7, 0xc0a5, 0x4635, 0xbb, 0xd5, 0x07, 0x21, 0x87, 0xdf, 0xe2, 0xee } },
-    { "ANDROID_FASTBOOT_TRANSPORT_PROTOCOL", { 0x74bd9fe0, 0x8902, 0x11E3, 0xb9, 0xd3, 0xf7, 0x22, 0x38, 0xfc, 0x9a, 0x31 } },
-    { "ANDROID_FASTBOOT_PLATFORM_PROTOCOL", { 0x524685a0, 0x89a0, 0x11E3, 0x9d, 0x4d, 0xbf, 0xa9, 0xf6, 0xa4, 0x03, 0x08 } },
-    { "USB_DEVICE_PROTOCOL", { 0x021bd2ca, 0x51d2, 0x11E3, 0x8e, 0x56, 0xb7, 0x54, 0x17, 0xc7, 0x0b, 0x44 } },
-    { "EMU_THREAD_THUNK_PROTOCOL", { 0x3b1e4b7c, 0x09d8, 0x944F, 0xa4, 0x08, 0x13, 0x09, 0xeb, 0x8b, 0x44, 0x27 } },
-    { "EMU_THUNK_PPI", { 0xe113f896, 0x75cf, 0xF640, 0x81, 0x7f, 0xc8, 0x5a, 0x79, 0xe8, 0xae, 0x67 } },
-    { "EMULATOR_PKG_TOKEN_SPACE", { 0x4f792e68, 0xe8c8, 0x794E, 0xb1, 0xd8, 0x37, 0x03, 0xf3, 0xf2, 0xd5, 0xa5 } },
-    { "EMU_SYSTEM_CONFIG", { 0xf8626165, 0x6ceb, 0x924A, 0xba, 0xfc, 0xf1, 0x3a, 0xb9, 0xd6, 0x57, 0x28 } },
-    { "EXIT_PM_AUTH_PROTOCOL", { 0xd088a413, 0x0a70, 0x4217, 0xba, 0x55, 0x9a, 0x3c, 0xb6, 0x5c, 0x41, 0xb3 } },
-    { "EFI_SMM_PEI_SMRAM_MEMORY_RESERVE", { 0x6dadf1d1, 0xd4cc, 0x4910, 0xbb, 0x6e, 0x82, 0xb1, 0xfd, 0x80, 0xff, 0x3d } },
-    { "EFI_PEI144_FLOPPY_BLOCK_IO_PPI", { 0xda6855bd, 0x07b7, 0x4C05, 0x9e, 0xd8, 0xe2, 0x59, 0xfd, 0x36, 0x0e, 0x22 } },
-    { "EFI_PEI_FV_FILE_LOADER_PPI", { 0x7e1f0d85, 0x04ff, 0x4BB2, 0x86, 0x6a, 0x31, 0xa2, 0x99, 0x6a, 0x48, 0xa8 } },
-    { "INTEL_FSP_PKG_TOKEN_SPACE", { 0x834c0c5f, 0xadb3, 0x4372, 0xae, 0xeb, 0x03, 0xe4, 0xe9, 0xe6, 0xc5, 0x91 } },
-    { "FSP_HEADER_FILE", { 0x912740be, 0x2284, 0x4734, 0xb9, 0x71, 0x84, 0xb0, 0x27, 0x35, 0x3f, 0x0c } },
-    { "FSP_BOOT_LOADER_TEMPORARY_MEMORY", { 0xbbcff46c, 0xc8d3, 0x4113, 0x89, 0x85, 0xb9, 0xd4, 0xf3, 0xb3, 0xf6, 0x4e } },
-    { "FSP_RESERVED_MEMORY_RESOURCE_HOB", { 0x69a79759, 0x1373, 0x4367, 0xa6, 0xc4, 0xc7, 0xf5, 0x9e, 0xfd, 0x98, 0x6e } },
-    { "FSP_NON_VOLATILE_STORAGE_HOB", { 0x721acf02, 0x4d77, 0x4C2A, 0xb3, 0xdc, 0x27, 0x0b, 0x7b, 0xa9, 0xe4, 0xb0 } },
-    { "FSP_RESERVED_MEMORY_RESOURCE_HOB_TSEG", { 0xd038747c, 0xd00c, 0x4980, 0xb3, 0x19, 0x49, 0x01, 0x99, 0xa4, 0x7d, 0x55 } },
-    { "FSP_RESERVED_MEMORY_RESOURCE_HOB_GFX", { 0x9c7c3aa7, 0x5332, 0x4917, 0x82, 0xb9, 0x56, 0xa5, 0xf3, 0xe6, 0x2a, 0x07 } },
-    { "FSP_RESERVED_MEMORY_RESOURCE_HOB_MISC", { 0x00d6b14b, 0x7dd0, 0x4062, 0x88, 0x21, 0xe5, 0xf9, 0x6a, 0x2a, 0x1b, 0x00 } },
-    { "FSP_WRAPPER_TOKEN_SPACE", { 0x2bc1c74a, 0x122f, 0x40B2, 0xb2, 0x23, 0x08, 0x2b, 0x74, 0x65, 0x22, 0x5d } },
-    { "FSP_INIT_DONE_PPI", { 0xf5ef05e4, 0xd538, 0x4774, 0x8f, 0x1b, 0xe9, 0x77, 0x30, 0x11, 0xe0, 0x38 } },
-    { "TOP_OF_TEMPORARY_RAM_PPI", { 0x2f3962b2, 0x57c5, 0x44EC, 0x9e, 0xfc, 0xa6, 0x9f, 0xd3, 0x02, 0x03, 0x2b } },
-    { "PCD_DATA_BASE_SIGNATURE", { 0x3c7d193c, 0x682c, 0x4C14, 0xa6, 0x8f, 0x55, 0x2d, 0xea, 0x4f, 0x43, 0x7e } },
-    { "EDKII_WORKING_BLOCK_SIGNATURE", { 0x9e58292b, 0x7c68, 0x497D, 0xa0, 0xce, 0x65, 0x00, 0xfd, 0x9f, 0x1b, 0x95 } },
-    { "EDKII_FAULT_TOLERANT_WRITE", { 0x1d3e9cb8, 0x43af, 0x490B, 0x83, 0x0a, 0x35, 0x16, 0xaa, 0x53, 0x20, 0x47 } },
-    { "USB_KEYBOARD_LAYOUT_KEY", { 0x3a4d7a7c, 0x018a, 0x4B42, 0x81, 0xb3, 0xdc, 0x10, 0xe3, 0xb5, 0x91, 0xbd } },
-    { "FIRMWARE_PERFORMANCE_S3_POINTER", { 0x0dc65adc, 0xa973, 0x4130, 0x8d, 0xf0, 0x2a, 0xdb, 0xeb, 0x9e, 0x4a, 0x31 } },
-    { "EVENT_EXIT_BOOT_SERVICES_FAILED", { 0x4f6c5507, 0x232f, 0x4787, 0xb9, 0x5e, 0x72, 0xf8, 0x62, 0x49, 0x0c, 0xb1 } },
-    { "EDKII_STATUS_CODE_DATA_TYPE_VARIABLE", { 0xf6ee6dbb, 0xd67f, 0x4EA0, 0x8b, 0x96, 0x6a, 0x71, 0xb1, 0x9d, 0x84, 0xad } },
-    { "EDKII_MEMORY_PROFILE", { 0x821c9a09, 0x541a, 0x40F6, 0x9f, 0x43, 0x0a, 0xd1, 0x93, 0xa1, 0x2c, 0xfe } },
-    { "EDKII_VAR_ERROR_FLAG", { 0x04b37fe8, 0xf6ae, 0x480B, 0xbd, 0xd5, 0x37, 0xd9, 0x8c, 0x5e, 0x89, 0xaa } },
-    { "PEI_USB2_HOST_CONTROLLER_PPI", { 0xfedd6305, 0xe2d7, 0x4ED5, 0x9f, 0xaa, 0xda, 0x08, 0x0e, 0x33, 0x6c, 0x22 } },
-    { "PEI_POST_SCRIPT_TABLE_PPI", { 0x88c9d306, 0x0900, 0x4EB5, 0x82, 0x60, 0x3e, 0x2d, 0xbe, 0xda, 0x1f, 0x89 } },
-    { "PEI_SERIAL_PORT_PPI", { 0x490e9d85, 0x8aef, 0x4193, 0x8e, 0x56, 0xf7, 0x34, 0xa9, 0xff, 0xac, 0x8b } },
-    { "EDKII_VARIABLE_LOCK_PROTOCOL", { 0xcd3d0a05, 0x9e24, 0x437C, 0xa8, 0x91, 0x1e, 0xe0, 0x53, 0xdb, 0x76, 0x38 } },
-    { "EDKII_VAR_CHECK_PROTOCOL", { 0xaf23b340, 0x97b4, 0x4685, 0x8d, 0x4f, 0xa3, 0xf2, 0x81, 0x69, 0xb2, 0x1d } },
-    { "EDKII_SMM_VAR_CHECK_PROTOCOL", { 0xb0d8f3c1, 0xb7de, 0x4C11, 0xbc, 0x89, 0x2f, 0xb5, 0x62, 0xc8, 0xc4, 0x11 } },
-    { "EDKII_FORM_DISPLAY_ENGINE_PROTOCOL", { 0x9bbe29e9, 0xfda1, 0x41EC, 0xad, 0x52, 0x45, 0x22, 0x13, 0x74, 0x2d, 0x2e } },
-    { "EDKII_FORM_BROWSER_EX2_PROTOCOL", { 0xa770c357, 0xb693, 0x4E6D, 0xa6, 0xcf, 0xd2, 0x1c, 0x72, 0x8e, 0x55, 0x0b } },
-    { "EFI_FILE_INFO", { 0x09576e92, 0x6d3f, 0x11D2, 0x8e, 0x39, 0x00, 0xa0, 0xc9, 0x69, 0x72, 0x3b } },
-    { "EFI_EVENT_READY_TO_BOOT", { 0x7ce88fb3, 0x4bd7, 0x4679, 0x87, 0xa8, 0xa8, 0xd8, 0xde, 0xe5, 0x0d, 0x2b } },
-    { "EFI_EVENT_MEMORY_MAP_CHANGE", { 0x78bee926, 0x692f, 0x48FD, 0x9e, 0xdb, 0x01, 0x42, 0x2e, 0xf0, 0xd7, 0xab } },
-    { "EFI_EVENT_VIRTUAL_ADDRESS_CHANGE", { 0x13fa7698, 0xc831, 0x49C7, 0x87, 0xea, 0x8f, 0x43, 0xfc, 0xc2, 0x51, 0x96 } },
-    { "EFI_EVENT_EXIT_BOOT_SERVICES", { 0x27abf055, 0xb1b8, 0x4C26, 0x80, 0x48, 0x74, 0x8f, 0x37, 0xba, 0xa2, 0xdf } },
-    { "EFI_EVENT_USER_PROFILE_CHANGED", { 0xbaf1e6de, 0x209e, 0x4ADB, 0x8d, 0x96, 0xfd, 0x8b, 0x71, 0xf3, 0xf6, 0x83 } },
-    { "EFI_USER_CREDENTIAL_CLASS_UNKNOWN", { 0x5cf32e68, 0x7660, 0x449B, 0x80, 0xe6, 0x7e, 0xa3, 0x6e, 0x03, 0xf6, 0xa8 } },
-    { "EFI_USER_CREDENTIAL_CLASS_PASSWORD", { 0xf8e5058c, 0xccb6, 0x4714, 0xb2, 0x20, 0x3f, 0x7e, 0x3a, 0x64, 0x0b, 0xd1 } },
-    { "EFI_USER_CREDENTIAL_CLASS_SMART_CARD", { 0x5f03ba33, 0x8c6b, 0x4C24, 0xaa, 0x2e, 0x14, 0xa2, 0x65, 0x7b, 0xd4, 0x54 } },
-    { "EFI_USER_CREDENTIAL_CLASS_FINGERPRINT", { 0x32cba21f, 0xf308, 0x4CBC, 0x9a, 0xb5, 0xf5, 0xa3, 0x69, 0x9f, 0x04, 0x4a } },
-    { "EFI_USER_CREDENTIAL_CLASS_HANDPRINT", { 0x5917ef16, 0xf723, 0x4BB9, 0xa6, 0x4b, 0xd8, 0xc5, 0x32, 0xf4, 0xd8, 0xb5 } },
-    { "EFI_USER_CREDENTIAL_CLASS_SECURE_CARD", { 0x8a6b4a83, 0x42fe, 0x45D2, 0xa2, 0xef, 0x46, 0xf0, 0x6c, 0x7d, 0x98, 0x52 } },
-    { "EFI_KMS_FORMAT_RSASHA2563072", { 0x4e1356c2, 0x0eed, 0x463F, 0x81, 0x47, 0x99, 0x33, 0xab, 0xdb, 0xc7, 0xd5 } },
-    { "EFI_FMP_CAPSULE", { 0x6dcbd5ed, 0xe82d, 0x4C44, 0xbd, 0xa1, 0x71, 0x94, 0x19, 0x9a, 0xd9, 0x2a } },
-    { "EFI_CERT_X509_SHA256", { 0x3bd2a492, 0x96c0, 0x4079, 0xb4, 0x20, 0xfc, 0xf9, 0x8e, 0xf1, 0x03, 0xed } },
-    { "EFI_CERT_X509_SHA384", { 0x7076876e, 0x80c2, 0x4EE6, 0xaa, 0xd2, 0x28, 0xb3, 0x49, 0xa6, 0x86, 0x5b } },
-    { "EFI_CERT_X509_SHA512", { 0x446dbf63, 0x2502, 0x4CDA, 0xbc, 0xfa, 0x24, 0x65, 0xd2, 0xb0, 0xfe, 0x9d } },
-    { "EFI_RNG_ALGORITHM_SP80090_HASH256", { 0xa7af67cb, 0x603b, 0x4D42, 0xba, 0x21, 0x70, 0xbf, 0xb6, 0x29, 0x3f, 0x96 } },
-    { "EFI_RNG_ALGORITHM_SP80090_HMAC256", { 0xc5149b43, 0xae85, 0x4F53, 0x99, 0x82, 0xb9, 0x43, 0x35, 0xd3, 0xa9, 0xe7 } },
-    { "EFI_RNG_ALGORITHM_SP80090_CTR256", { 0x44f0de6e, 0x4d8c, 0x4045, 0xa8, 0xc7, 0x4d, 0xd1, 0x68, 0x85, 0x6b, 0x9e } },
-    { "EFI_RNG_ALGORITHM_X9313_DES", { 0x63c4785a, 0xca34, 0x4012, 0xa3, 0xc8, 0x0b, 0x6a, 0x32, 0x4f, 0x55, 0x46 } },
-    { "EFI_RNG_ALGORITHM_X931_AES", { 0xacd03321, 0x777e, 0x4D3D, 0xb1, 0xc8, 0x20, 0xcf, 0xd8, 0x88, 0x20, 0xc9 } },
-    { "EFI_ADAPTER_INFO_MEDIA_STATE", { 0xd7c74207, 0xa831, 0x4A26, 0xb1, 0xf5, 0xd1, 0x93, 0x06, 0x5c, 0xe8, 0xb6 } },
-    { "EFI_ADAPTER_INFO_NETWORK_BOOT", { 0x1fbd2960, 0x4130, 0x41E5, 0x94, 0xac, 0xd2, 0xcf, 0x03, 0x7f, 0xb3, 0x7c } },
-    { "EFI_ADAPTER_INFO_SAN_MAC_ADDRESS", { 0x114da5ef, 0x2cf1, 0x4E12, 0x9b, 0xbb, 0xc4, 0x70, 0xb5, 0x52, 0x05, 0xd9 } },
-    { "EFI_VECTOR_HANDOFF_TABLE", { 0x996ec11c, 0x5397, 0x4E73, 0xb5, 0x8f, 0x82, 0x7e, 0x52, 0x90, 0x6d, 0xef } },
-    { "ADAPTER_INFO_PLATFORM_SECURITY", { 0x6be272c7, 0x1320, 0x4CCD, 0x90, 0x17, 0xd4, 0x61, 0x2c, 0x01, 0x2b, 0x25 } },
-    { "EFI_PEI_MASTER_BOOT_MODE_PPI", { 0x7408d748, 0xfc8c, 0x4EE6, 0x92, 0x88, 0xc4, 0xbe, 0xc0, 0x92, 0xa4, 0x10 } },
-    { "EFI_PEI_BOOT_IN_RECOVERY_MODE_PPI", { 0x17ee496a, 0xd8e4, 0x4B9A, 0x94, 0xd1, 0xce, 0x82, 0x72, 0x30, 0x08, 0x50 } },
-    { "GET_PCD_INFO_PPI", { 0x4d8b155b, 0xc059, 0x4C8F, 0x89, 0x26, 0x06, 0xfd, 0x43, 0x31, 0xdb, 0x8a } },
-    { "EFI_GET_PCD_INFO_PPI", { 0xa60c6b59, 0xe459, 0x425D, 0x9c, 0x69, 0x0b, 0xcc, 0x9c, 0xb2, 0x7d, 0x81 } },
-    { "EFI_PEI_I2C_MASTER_PPI", { 0xb3bfab9b, 0x9f9c, 0x4E8B, 0xad, 0x37, 0x7f, 0x8c, 0x51, 0xfc, 0x62, 0x80 } },
-    { "EFI_PEI_FIRMWARE_VOLUME_INFO2_PPI", { 0xea7ca24b, 0xded5, 0x4DAD, 0xa3, 0x89, 0xbf, 0x82, 0x7e, 0x8f, 0x9b, 0x38 } },
-    { "GET_PCD_INFO_PROTOCOL", { 0x5be40f57, 0xfa68, 0x4610, 0xbb, 0xbf, 0xe9, 0xc5, 0xfc, 0xda, 0xd3, 0x65 } },
-    { "EFI_GET_PCD_INFO_PROTOCOL", { 0xfd0f4478, 0x0efd, 0x461D, 0xba, 0x2d, 0xe5, 0x8c, 0x45, 0xfd, 0x5f, 0x5e } },
-    { "EFI_I2C_MASTER_PROTOCOL", { 0xcd72881f, 0x45b5, 0x4FEB, 0x98, 0xc8, 0x31, 0x3d, 0xa8, 0x11, 0x74, 0x62 } },
-    { "EFI_I2C_IO_PROTOCOL", { 0xb60a3e6b, 0x18c4, 0x46E5, 0xa2, 0x9a, 0xc9, 0xa1, 0x06, 0x65, 0xa2, 0x8e } },
-    { "EFI_I2C_ENUMERATE_PROTOCOL", { 0xda8cd7c4, 0x1c00, 0x49E2, 0x80, 0x3e, 0x52, 0x14, 0xe7, 0x01, 0x89, 0x4c } },
-    { "EFI_I2C_HOST_PROTOCOL", { 0xa5aab9e3, 0xc727, 0x48CD, 0x8b, 0xbf, 0x42, 0x72, 0x33, 0x85, 0x49, 0x48 } },
-    { "EFI_I2C_BUS_CONFIGURATION_MANAGEMENT_PROTOCOL", { 0x55b71fb5, 0x17c6, 0x410E, 0xb5, 0xbd, 0x5f, 0xa2, 0xe3, 0xd4, 0x46, 0x6b } },
-    { "EFI_TR_EEPROTOCOL", { 0x607f766c, 0x7455, 0x42BE, 0x93, 0x0b, 0xe4, 0xd7, 0x6d, 0xb2, 0x72, 0x0f } },
-    { "EFI_DISK_IO2_PROTOCOL", { 0x151c8eae, 0x7f2c, 0x472C, 0x9e, 0x54, 0x98, 0x28, 0x19, 0x4f, 0x6a, 0x88 } },
-    { "EFI_TIMESTAMP_PROTOCOL", { 0xafbfde41, 0x2e6e, 0x4262, 0xba, 0x65, 0x62, 0xb9, 0x23, 0x6e, 0x54, 0x95 } },
-    { "EFI_RNG_PROTOCOL", { 0x3152bca5, 0xeade, 0x433D, 0x86, 0x2e, 0xc0, 0x1c, 0xdc, 0x29, 0x1f, 0x44 } },
-    { "EFI_ADAPTER_INFORMATION_PROTOCOL", { 0xe5dd1403, 0xd622, 0xC24E, 0x84, 0x88, 0xc7, 0x1b, 0x17, 0xf5, 0xe8, 0x02 } },
-    { "EFI_NETWORK_PKG_TOKEN_SPACE", { 0x40e064b2, 0x0ae0, 0x48B1, 0xa0, 0x7d, 0xf8, 0xcf, 0x1e, 0x1a, 0x23, 0x10 } },
-    { "EFI_NT32_PKG_TOKEN_SPACE", { 0x0d79a645, 0x1d91, 0x40A6, 0xa8, 0x1f, 0x61, 0xe6, 0x98, 0x2b, 0x32, 0xb4 } },
-    { "PEI_NT_AUTO_SCAN_PPI", { 0x0dce384d, 0x007c, 0x4BA5, 0x94, 0xbd, 0x0f, 0x6e, 0xb6, 0x4d, 0x2a, 0xa9 } },
-    { "NT_PEI_LOAD_FILE_PPI", { 0xfd0c65eb, 0x0405, 0x4CD2, 0x8a, 0xee, 0xf4, 0x00, 0xef, 0x13, 0xba, 0xc2 } },
-    { "WIN_NT_BUS_DRIVER", { 0x0419f582, 0x0625, 0x4531, 0x8a, 0x33, 0x85, 0xa9, 0x96, 0x5c, 0x95, 0xbc } },
-    { "OMAP35XX_TOKEN_SPACE", { 0x24b09abe, 0x4e47, 0x481C, 0xa9, 0xad, 0xce, 0xf1, 0x2c, 0x39, 0x23, 0x27 } },
-    { "OPTION_ROM_PKG_TOKEN_SPACE", { 0x1e43298f, 0x3478, 0x41A7, 0xb5, 0x77, 0x86, 0x06, 0x46, 0x35, 0xc7, 0x28 } },
-    { "UEFI_OVMF_PKG_TOKEN_SPACE", { 0x93bb96af, 0xb9f2, 0x4EB8, 0x94, 0x62, 0xe0, 0xba, 0x74, 0x56, 0x42, 0x36 } },
-    { "OVMF_PLATFORM_CONFIG", { 0x7235c51c, 0x0c80, 0x4CAB, 0x87, 0xac, 0x3b, 0x08, 0x4a, 0x63, 0x04, 0xb1 } },
-    { "VIRTIO_MMIO_TRANSPORT", { 0x837dca9e, 0xe874, 0x4D82, 0xb2, 0x9a, 0x23, 0xfe, 0x0e, 0x23, 0xd1, 0xe2 } },
-    { "VIRTIO_DEVICE_PROTOCOL", { 0xfa920010, 0x6785, 0x4941, 0xb6, 0xec, 0x49, 0x8c, 0x57, 0x9f, 0x16, 0x0a } },
-    { "XEN_BUS_PROTOCOL", { 0x3d3ca290, 0xb9a5, 0x11E3, 0xb7, 0x5d, 0xb8, 0xac, 0x6f, 0x7d, 0x65, 0xe6 } },
-    { "DXE_DEBUGPORT_EXT_PROTOCOL", { 0x31a4878f, 0x230d, 0x4FC2, 0x90, 0xbb, 0xda, 0x5f, 0x41, 0xa4, 0x4b, 0x1b } },
-    { "DXE_DEBUG_CMD_PROTOCOL", { 0xca3b3a50, 0x5698, 0x4551, 0x8b, 0x18, 0xce, 0xae, 0xef, 0x91, 0x7d, 0x50 } },
-    { "DXE_DEBUG_DISPATCH_PROTOCOL", { 0x301af449, 0xe0d7, 0x43A3, 0x8b, 0x1b, 0xbc, 0x16, 0x72, 0x5d, 0x37, 0x4b } },
-    { "EFI_TCG_PRIVATE_INTERFACE", { 0x7a28436a, 0xe113, 0x406A, 0xaf, 0xf9, 0x0d, 0xbf, 0x7f, 0x64, 0x3e, 0x02 } },
-    { "PDM_WINDOW_BUTTON", { 0x5f65dfdb, 0xac20, 0x4F43, 0x9b, 0x21, 0x26, 0x9e, 0x81, 0xa0, 0xea, 0x7e } },
-    { "PDM_WINDOW_SPIN", { 0x60b27e1a, 0xd65e, 0x4DB0, 0xb2, 0xbb, 0xc1, 0x6f, 0xa7, 0x1e, 0x44, 0xab } },
-    { "PEI_DEBUG_DISPATCH_PPI", { 0xc9737920, 0xc2ad, 0x41C3, 0xb1, 0x33, 0x0f, 0x9c, 0x25, 0x1b, 0x67, 0x43 } },
-    { "PEI_POST_BOOT_SCRIPT_TABLE_PPI", { 0x88c9d306, 0x0900, 0x4EB5, 0x82, 0x60, 0x3e, 0x2d, 0xbe, 0xda, 0x1f, 0x89 } },
-    { "PHOENIX_DESKTOP_MESSAGE_PROTOCOL", { 0x87dd3539, 0x0667, 0x4BB7, 0x9f, 0xb2, 0x47, 0xd3, 0xc5, 0x0b, 0x02, 0x1b } },
-    { "PHOENIX_DESKTOP_WINDOW_PROTOCOL", { 0x6ffec78d, 0x7dbf, 0x4F8B, 0x96, 0x8d, 0x2f, 0x43, 0xa0, 0x80, 0xc1, 0x3f } },
-    { "PHOENIX_GDI_PROTOCOL", { 0x3f5a74b2, 0xbf80, 0x4850, 0x85, 0x91, 0x4f, 0x2d, 0xf5, 0xf9, 0xcb, 0x2b } },
-    { "PHOENIX_SMM_CORE_SERVICES_PROTOCOL", { 0x177e63c1, 0xaed6, 0x4D88, 0x91, 0x7e, 0x9b, 0x4f, 0xb9, 0xfe, 0x40, 0x92 } },
-    { "PHOENIX_EFI_SMM_SW_SMI_PROTOCOL", { 0xff052503, 0x1af9, 0x4AEB, 0x83, 0xc4, 0xc2, 0xd4, 0xce, 0xb1, 0x0c, 0xa3 } },
-    { "PHOENIX_SMM_WATCHDOG_TIMER_PROTOCOL", { 0x6fde3af8, 0x37ad, 0x43FC, 0xb7, 0x28, 0xf4, 0xd3, 0x41, 0xf3, 0x92, 0x40 } },
-    { "SCT_ISA_HC_PPI", { 0x8d48bd70, 0xc8a3, 0x4C06, 0x90, 0x1b, 0x74, 0x79, 0x46, 0xaa, 0xc3, 0x58 } },
-    { "SCT_ISA_HC_PROTOCOL", { 0x5fac7360, 0xd4f2, 0x4C9E, 0xa7, 0xed, 0xf2, 0x59, 0x5e, 0x67, 0x08, 0x89 } },
-    { "PEI_SPEAKER_INTERFACE_PPI", { 0x30ac275e, 0xbb30, 0x4B84, 0xa1, 0xcd, 0x0a, 0xf1, 0x32, 0x2c, 0x89, 0xc0 } },
-    { "PEI_MFG_MEMORY_TEST_PPI", { 0xab294a92, 0xeaf5, 0x4CF3, 0xab, 0x2b, 0x2d, 0x4b, 0xed, 0x4d, 0xb6, 0x3d } },
-    { "PEI_SHA256_HASH_PPI", { 0x950e191b, 0x8524, 0x4F51, 0x80, 0xa1, 0x5c, 0x4f, 0x1b, 0x03, 0xf3, 0x5c } },
-    { "EFI_PLATFORM_BOOT_MODE", { 0xce845704, 0x1683, 0x4D38, 0xa4, 0xf9, 0x7d, 0x0b, 0x50, 0x77, 0x57, 0x93 } },
-    { "EFI_PLATFORM_INFO", { 0x1e2acc41, 0xe26a, 0x483D, 0xaf, 0xc7, 0xa0, 0x56, 0xc3, 0x4e, 0x08, 0x7b } },
-    { "PLATFORM_MODULE_TOKEN_SPACE", { 0x69d13bf0, 0xaf91, 0x4D96, 0xaa, 0x9f, 0x21, 0x84, 0xc5, 0xce, 0x3b, 0xc0 } },
-    { "EFI_SERIAL_PORT_TOKEN_SPACE", { 0x5fad2389, 0x2bc7, 0x4BD2, 0x83, 0xd3, 0x42, 0x9f, 0xb6, 0xae, 0xa3, 0x3f } },
-    { "EFI_ICH_TOKEN_SPACE", { 0xe38c11e3, 0x968f, 0x47B8, 0xac, 0xef, 0xac, 0xc0, 0x69, 0x3d, 0xb9, 0xff } },
-    { "EFI_PCH_TOKEN_SPACE", { 0x89a1b278, 0xa1a1, 0x4DF7, 0xb1, 0x37, 0xde, 0x5a, 0xd7, 0xc4, 0x79, 0x13 } },
-    { "EFI_PLATFORM_CPU_INFO", { 0xbb9c7ab7, 0xb8d9, 0x4BF3, 0x9c, 0x29, 0x9b, 0xf3, 0x41, 0xe2, 0x17, 0xbc } },
-    { "EFI_BIOS_ID", { 0xc3e36d09, 0x8294, 0x4B97, 0xa8, 0x57, 0xd5, 0x28, 0x8f, 0xe3, 0x3e, 0x28 } },
-    { "EFI_BOARD_FEATURES", { 0x94b9e8ae, 0x8877, 0x479A, 0x98, 0x42, 0xf5, 0x97, 0x4b, 0x82, 0xce, 0xd3 } },
-    { "ITK_DATA_VAR", { 0x3812723d, 0x7e48, 0x4E29, 0xbc, 0x27, 0xf5, 0xa3, 0x9a, 0xc9, 0x4e, 0xf1 } },
-    { "DMI_DATA", { 0x70e56c5e, 0x280c, 0x44B0, 0xa4, 0x97, 0x09, 0x68, 0x1a, 0xbc, 0x37, 0x5e } },
-    { "IDCC_DATA_HUB", { 0x788e1d9f, 0x1eab, 0x47D2, 0xa2, 0xf3, 0x78, 0xca, 0xe8, 0x7d, 0x60, 0x12 } },
-    { "MFG_MODE_VARIABLE", { 0xef14fd78, 0x0793, 0x4E2B, 0xac, 0x6d, 0x06, 0x28, 0x47, 0xe0, 0x17, 0x91 } },
-    { "ACPIOSFRMFG_STRING_VARIABLE", { 0x72234213, 0x0fd7, 0x48A1, 0xa5, 0x9f, 0xb4, 0x1b, 0xc1, 0x07, 0xfb, 0xcd } },
-    { "ACPIOSFRREF_DATA_BLOCK_VARIABLE", { 0x72234213, 0x0fd7, 0x48A1, 0xa5, 0x9f, 0xb4, 0x1b, 0xc1, 0x07, 0xfb, 0xcd } },
-    { "ACPIOSFRMODEL_STRING_VARIABLE", { 0xca1bcad9, 0xe021, 0x4547, 0xa1, 0xb0, 0x5b, 0x22, 0xc7, 0xf6, 0x87, 0xf4 } },
-    { "EFI_PCI_LAN_INFO", { 0x0d9a1427, 0xe02a, 0x437D, 0x92, 0x6b, 0xaa, 0x52, 0x1f, 0xd7, 0x22, 0xba } },
-    { "FIRMWARE_ID", { 0x5e559c23, 0x1faa, 0x4AE1, 0x8d, 0x4a, 0xc6, 0xcf, 0x02, 0x6c, 0x76, 0x6f } },
-    { "OS_SELECTION_VARIABLE", { 0x86843f56, 0x675d, 0x40A5, 0x95, 0x30, 0xbc, 0x85, 0x83, 0x72, 0xf1, 0x03 } },
-    { "DXE_PCH_PLATFORM_POLICY_PROTOCOL", { 0x4b0165a9, 0x61d6, 0x4E23, 0xa0, 0xb5, 0x3e, 0xc7, 0x9c, 0x2e, 0x30, 0xd5 } },
-    { "EFI_LPC_WPCE791_POLICY_PROTOCOL", { 0xab2bee2f, 0xc1a6, 0x4399, 0x85, 0x3d, 0xc0, 0x7c, 0x77, 0x4f, 0xfd, 0x0d } },
-    { "USB_POLICY", { 0xf617b358, 0x12cf, 0x414A, 0xa0, 0x69, 0x60, 0x67, 0x7b, 0xda, 0x13, 0xb4 } },
-    { "DXE_VLV_PLATFORM_POLICY", { 0x5bab88ba, 0xe0e2, 0x4674, 0xb6, 0xad, 0xb8, 0x12, 0xf6, 0x88, 0x1c, 0xd6 } },
-    { "EFI_SMBIOS_SLOT_POPULATION", { 0xef7bf7d6, 0xf8ff, 0x4A76, 0x82, 0x47, 0xc0, 0xd0, 0xd1, 0xcc, 0x49, 0xc0 } },
-    { "OBSERVABLE_PROTOCOL", { 0xe227c522, 0xd5fe, 0x4A53, 0x87, 0xb1, 0x0f, 0xbe, 0x57, 0x0f, 0x98, 0xe9 } },
-    { "EFI_CK505_CLOCK_PLATFORM_INFO", { 0x3c485ea4, 0x449a, 0x46CE, 0xbb, 0x08, 0x2a, 0x33, 0x6e, 0xa9, 0x6b, 0x4e } },
-    { "EFI_LPC_WPC83627_POLICY_PROTOCOL", { 0xd3ecc567, 0x9fd5, 0x44C1, 0x86, 0xcf, 0x5d, 0xa7, 0xa2, 0x4f, 0x4b, 0x5d } },
-    { "EFI_TCO_RESET_PROTOCOL", { 0xa6a79162, 0xe325, 0x4C30, 0xbc, 0xc3, 0x59, 0x37, 0x30, 0x64, 0xef, 0xb3 } },
-    { "EFI_WATCHDOG_TIMER_DRIVER_PROTOCOL", { 0xd5b06d16, 0x2ea1, 0x4DEF, 0x98, 0xd0, 0xa0, 0x5d, 0x40, 0x72, 0x84, 0x17 } },
-    { "EFI_PLATFORM_IDE_INIT_PROTOCOL", { 0x377c66a3, 0x8fe7, 0x4EE8, 0x85, 0xb8, 0xf1, 0xa2, 0x82, 0x56, 0x9e, 0x3b } },
-    { "ENHANCED_SPEEDSTEP_PROTOCOL", { 0x91a1ddcf, 0x5374, 0x4939, 0x89, 0x51, 0xd7, 0x29, 0x3f, 0x1a, 0x78, 0x6f } },
-    { "EFI_GOP_DISPLAY_BRIGHTNESS_PROTOCOL", { 0x6ff23f1d, 0x877c, 0x4B1B, 0x93, 0xfc, 0xf1, 0x42, 0xb2, 0xee, 0xa6, 0xa7 } },
-    { "EFI_USB_KEYBOARD_CONNECT", { 0xad9c4381, 0x1ede, 0x430C, 0x8d, 0x42, 0x23, 0x76, 0x7c, 0x46, 0x5d, 0x52 } },
-    { "EFI_MMIO_DEVICE_PROTOCOL", { 0x24486226, 0xf8c2, 0x41F5, 0xb9, 0xdd, 0x78, 0x3e, 0x9e, 0x56, 0xde, 0xa0 } },
-    { "EFI_I2C_BUS_CONFIGURATION_MANAGEMENT_PROTOCOL2", { 0x75032015, 0xd156, 0x423E, 0xbf, 0xa3, 0x7a, 0x65, 0xab, 0xa4, 0x71, 0x05 } },
-    { "EFI_I2C_ACPI_PROTOCOL", { 0xf30c2915, 0x5782, 0x4E6A, 0xa8, 0x46, 0x05, 0xba, 0xbc, 0xe7, 0xb6, 0xa0 } },
-    { "EFI_I2C_MASTER_PROTOCOL2", { 0x578c315a, 0x68cf, 0x4E81, 0xb5, 0xc6, 0x22, 0xdb, 0x40, 0xd0, 0x10, 0xbc } },
-    { "EFI_I2C_HOST_PROTOCOL2", { 0x70b221af, 0xfdff, 0x4FDE, 0x99, 0x68, 0x1a, 0xf6, 0x23, 0xa9, 0x56, 0xd9 } },
-    { "EFI_I2C_BUS_PROTOCOL", { 0x9fa1b225, 0x3346, 0x461B, 0xa0, 0x69, 0xed, 0x01, 0xb6, 0x73, 0xd2, 0x40 } },
-    { "EFI_I2C_SLAVE_PROTOCOL", { 0xf2c1910e, 0xf5c9, 0x4B72, 0xb2, 0x43, 0x6d, 0x59, 0x09, 0x6a, 0x79, 0xf0 } },
-    { "EFI_SPI_ACPI_PROTOCOL", { 0x9f49a879, 0x3d71, 0x42B3, 0xa0, 0xad, 0xdd, 0xb1, 0xf3, 0x30, 0x10, 0xa3 } },
-    { "EFI_SPI_HOST_PROTOCOL", { 0x951b65e5, 0x8872, 0x41ED, 0xad, 0x1d, 0xd5, 0x68, 0x1f, 0x4a, 0xf0, 0x33 } },
-    { "EFI_SPI_BUS_PROTOCOL", { 0x137b3044, 0xf6d7, 0x473E, 0xa6, 0x25, 0x9f, 0xb9, 0x25, 0x05, 0xc1, 0x80 } },
-    { "LPSS_DUMMY_PROTOCOL", { 0xaf4cc162, 0xd41c, 0x455A, 0xab, 0x45, 0x6d, 0xbc, 0xc1, 0xcd, 0x32, 0xf3 } },
-    { "EFI_GPIO_OPERATION_PROTOCOL", { 0x38ddfe8f, 0x8991, 0x44AA, 0x98, 0x89, 0x83, 0xf4, 0x91, 0x84, 0x65, 0xb0 } },
-    { "EFI_ESRT_OPERATION_PROTOCOL", { 0x4549ab47, 0x6e60, 0x4293, 0xb9, 0x1d, 0x31, 0xb6, 0x10, 0xad, 0x80, 0x56 } },
-    { "EFI_FW_DISPLAY_CAPSULE", { 0x3b8c8162, 0x188c, 0x46A4, 0xae, 0xc9, 0xbe, 0x43, 0xf1, 0xd6, 0x56, 0x97 } },
-    { "EFI_FIRMWARE_CLASS", { 0xb122a262, 0x3551, 0x4F48, 0x88, 0x92, 0x55, 0xf6, 0xc0, 0x61, 0x42, 0x90 } },
-    { "EFI_DFUVER", { 0x0dc73aed, 0xcbf6, 0x4A25, 0xa6, 0x8d, 0x59, 0xc8, 0x0f, 0x44, 0xc7, 0xc3 } },
-    { "EFI_ESRT_TABLE", { 0xb122a263, 0x3661, 0x4F68, 0x99, 0x29, 0x78, 0xf8, 0xb0, 0xd6, 0x21, 0x80 } },
-    { "EFI_CAPSULE_CRASH_LOG_VAR", { 0xf3ff1468, 0x04ba, 0x4966, 0x9f, 0xb2, 0xe4, 0xa7, 0x90, 0x05, 0x46, 0x50 } },
-    { "EFI_CAPSULE_CRASH", { 0x0e1d2972, 0x65af, 0x4AC1, 0xbf, 0xa3, 0xce, 0xf4, 0xab, 0x0c, 0x38, 0xfe } },
-    { "EFI_SECURE_BOOT_ENABLE_DISABLE", { 0xf0a30bc7, 0xaf08, 0x4556, 0x99, 0xc4, 0x00, 0x10, 0x09, 0xc9, 0x3a, 0x44 } },
-    { "EFI_CUSTOM_MODE_ENABLE", { 0xc076ec0c, 0x7028, 0x4399, 0xa0, 0x72, 0x71, 0xee, 0x5c, 0x44, 0x8b, 0x9f } },
-    { "EFI_VENDOR_KEYS_NV", { 0x9073e4e0, 0x60ec, 0x4B6E, 0x99, 0x03, 0x4c, 0x22, 0x3c, 0x26, 0x0f, 0x3c } },
-    { "EFI_CERT_DB", { 0xd9bee56e, 0x75dc, 0x49D9, 0xb4, 0xd7, 0xb5, 0x34, 0x21, 0x0f, 0x63, 0x7a } },
-    { "TCG_EVENT_ENTRY_HOB", { 0x2b9ffb52, 0x1b13, 0x416F, 0xa8, 0x7b, 0xbc, 0x93, 0x0d, 0xef, 0x92, 0xa8 } },
-    { "TPM_ERROR_HOB", { 0xef598499, 0xb25e, 0x473A, 0xbf, 0xaf, 0xe7, 0xe5, 0x7d, 0xce, 0x82, 0xc4 } },
-    { "EFI_TR_EEPHYSICAL_PRESENCE", { 0xf24643c2, 0xc622, 0x494E, 0x8a, 0x0d, 0x46, 0x32, 0x57, 0x9c, 0x2d, 0x5b } },
-    { "EFI_TPM_DEVICE_INSTANCE_TPM12", { 0x8b01e5b6, 0x4f19, 0x46E8, 0xab, 0x93, 0x1c, 0x53, 0x67, 0x1b, 0x90, 0xcc } },
-    { "EFI_TPM_DEVICE_INSTANCE_TPM20_DTPM", { 0x286bf25a, 0xc2c3, 0x408C, 0xb3, 0xb4, 0x25, 0xe6, 0x75, 0x8b, 0x73, 0x17 } },
-    { "EFI_TPM_DEVICE_SELECTED", { 0x7f4158d3, 0x074d, 0x456D, 0x8c, 0xb2, 0x01, 0xf9, 0xc8, 0xf7, 0x9d, 0xaa } },
-    { "TR_EECONFIG_FORM_SET", { 0xc54b425f, 0xaa79, 0x48B4, 0x98, 0x1f, 0x99, 0x8b, 0x3c, 0x4b, 0x64, 0x1c } },
-    { "PEI_TPM_INITIALIZATION_DONE_PPI", { 0xa030d115, 0x54dd, 0x447B, 0x90, 0x64, 0xf2, 0x06, 0x88, 0x3d, 0x7c, 0xcc } },
-    { "EFI_PEI_FIRMWARE_VOLUME_INFO_MEASUREMENT_EXCLUDED_PPI", { 0x6e056ff9, 0xc695, 0x4364, 0x9e, 0x2c, 0x61, 0x26, 0xf5, 0xce, 0xea, 0xae } },
-    { "SHELL_BCFG_HII", { 0x5f5f605d, 0x1583, 0x4A2D, 0xa6, 0xb2, 0xeb, 0x12, 0xda, 0xb4, 0xa2, 0xb6 } },
-    { "EFI_SHELL_DYNAMIC_COMMAND_PROTOCOL", { 0x3c7200e9, 0x005f, 0x4EA4, 0x87, 0xde, 0xa3, 0xdf, 0xac, 0x8a, 0x27, 0xc3 } },
-    { "EFI_SOURCE_LEVEL_DEBUG_PKG_TOKEN_SPACE", { 0x865a5aab, 0xb85d, 0x474C, 0x84, 0x55, 0x65, 0xd1, 0xbe, 0x84, 0x4b, 0xe2 } },
-    { "STD_LIB_TOKEN_SPACE", { 0x447559f0, 0xd02e, 0x4CF1, 0x99, 0xbc, 0xca, 0x11, 0x65, 0x40, 0x54, 0xc2 } },
-    { "EFI_SOCKET_PROTOCOL", { 0x58e6ed63, 0x1694, 0x440B, 0x93, 0x88, 0xe9, 0x8f, 0xed, 0x6b, 0x65, 0xaf } },
-    { "EFI_SOCKET_SERVICE_BINDING_PROTOCOL", { 0x8aaedb2a, 0xa6bb, 0x47C6, 0x94, 0xce, 0x1b, 0x80, 0x96, 0x42, 0x3f, 0x2a } },
-    { "VLV_POLICY_PPI", { 0x7d84b2c2, 0x22a1, 0x4372, 0xb1, 0x2c, 0xeb, 0xb2, 0x32, 0xd3, 0xa6, 0xa3 } },
-    { "VLV_MMIO_POLICY_PPI", { 0xe767bf7f, 0x4db6, 0x5B34, 0x10, 0x11, 0x4f, 0xbe, 0x4c, 0xa7, 0xaf, 0xd2 } },
-    { "SE_CF_TPMPPI", { 0x10e26df1, 0x8775, 0x4EE1, 0xb5, 0x0a, 0x3a, 0xe8, 0x28, 0x93, 0x70, 0x3a } },
-    { "PCH_INIT_PPI", { 0x09ea894a, 0xbe0d, 0x4230, 0xa0, 0x03, 0xed, 0xc6, 0x93, 0xb4, 0x8e, 0x95 } },
-    { "PCH_PLATFORM_POLICY_PPI", { 0x15344673, 0xd365, 0x4BE2, 0x85, 0x13, 0x14, 0x97, 0xcc, 0x07, 0x61, 0x1d } },
-    { "PEI_SPI_PPI", { 0xa38c6898, 0x2b5c, 0x4FF6, 0x93, 0x26, 0x2e, 0x63, 0x21, 0x2e, 0x56, 0xc2 } },
-    { "SE_CUMA_PPI", { 0xcbd86677, 0x362f, 0x4C04, 0x94, 0x59, 0xa7, 0x41, 0x32, 0x6e, 0x05, 0xcf } },
-    { "PEI_SDHC_PPI", { 0xf4ef9d7a, 0x98c5, 0x4C1A, 0xb4, 0xd9, 0xd8, 0xd8, 0x72, 0x65, 0xbe, 0x0c } },
-    { "PEI_BLOCK_IO_PPI", { 0xbc5fa650, 0xedbb, 0x4D0D, 0xb3, 0xa3, 0xd9, 0x89, 0x07, 0xf8, 0x47, 0xdf } },
-    { "SE_CF_TPMPOLICY_PPI", { 0x4fd1ba49, 0x8f90, 0x471A, 0xa2, 0xc9, 0x17, 0x3c, 0x7a, 0x73, 0x2f, 0xd0 } },
-    { "PCH_PEI_INIT_PPI", { 0xacb93b08, 0x5cdc, 0x4A8F, 0x93, 0xd4, 0x06, 0xe3, 0x42, 0xdf, 0x18, 0x2e } },
-    { "PPM_PLATFORM_POLICY_PROTOCOL", { 0xddabfeac, 0xef63, 0x452C, 0x8f, 0x39, 0xed, 0x7f, 0xae, 0xd8, 0x26, 0x5e } },
-    { "EFI_SD_HOST_IO_PROTOCOL", { 0xb63f8ec7, 0xa9c9, 0x4472, 0xa4, 0xc0, 0x4d, 0x8b, 0xf3, 0x65, 0xcc, 0x51 } },
-    { "EFI_PCH_INFO_PROTOCOL", { 0xd31f0400, 0x7d16, 0x4316, 0xbf, 0x88, 0x60, 0x65, 0x88, 0x3b, 0x40, 0x2b } },
-    { "EFI_PCH_EXTENDED_RESET_PROTOCOL", { 0xf0bbfca0, 0x684e, 0x48B3, 0xba, 0xe2, 0x6c, 0x84, 0xb8, 0x9e, 0x53, 0x39 } },
-    { "DXE_ICH_PLATFORM_POLICY_PROTOCOL", { 0xf617b358, 0x12cf, 0x414A, 0xa0, 0x69, 0x60, 0x67, 0x7b, 0xda, 0x13, 0xb3 } },
-    { "EFI_ICH_INFO_PROTOCOL", { 0xd31f0400, 0x7d16, 0x4316, 0xbf, 0x88, 0x60, 0x65, 0x88, 0x3b, 0x40, 0x2b } },
-    { "EFI_EMMC_CARD_INFO_PROTOCOL", { 0x1ebe5ab9, 0x2129, 0x49E7, 0x84, 0xd7, 0xee, 0xb9, 0xfc, 0xe5, 0xde, 0xdd } },
-    { "EFI_TDT_OPERATION_PROTOCOL", { 0xfd301ba4, 0x5e62, 0x4679, 0xa0, 0x6f, 0xe0, 0x9a, 0xab, 0xdd, 0x2a, 0x91 } },
-    { "EFI_DFURESULT", { 0x14a7c46f, 0xbc02, 0x4047, 0x9f, 0x18, 0xa5, 0xd7, 0x25, 0xd8, 0xbd, 0x19 } }, 
-    { "EFI_CPTOKEN_SPACE", { 0x918211ce, 0xa1d2, 0x43A0, 0xa0, 0x4e, 0x75, 0xb5, 0xbf, 0x44, 0x50, 0x0e } }, 
-    { "EFI_VLVTOKEN_SPACE", { 0xca452c68, 0xdf0c, 0x45C9, 0x82, 0xfb, 0xea, 0xe4, 0x2b, 0x31, 0x29, 0x46 } }, 
-    { "DXE_PCH_POLICY_UPDATE_PROTOCOL", { 0x1a819e49, 0xd8ee, 0x48CB, 0x9a, 0x9c, 0x0a, 0xa0, 0xd2, 0x81, 0x0a, 0x38 } }, 
-    { "POWER_MANAGEMENT_ACPI_TABLE_STORAGE", { 0x161be597, 0xe9c5, 0x49DB, 0xae, 0x50, 0xc4, 0x62, 0xab, 0x54, 0xee, 0xda } }, 
-    { "VLV_REF_CODE_PKG_TOKEN_SPACE", { 0x85768e4a, 0x6cdc, 0x444E, 0x93, 0xdf, 0x93, 0x66, 0x85, 0xb5, 0xdf, 0xcc } }, 
-    { "SE_CPLATFORM_READY_TO_BOOT", { 0x03fdf171, 0x1d67, 0x4ACE, 0xa9, 0x04, 0x3e, 0x36, 0xd3, 0x38, 0xfa, 0x74 } }, 
-    { "EFI_VLV2_VARIABLE", { 0x10ba6bbe, 0xa97e, 0x41C3, 0x9a, 0x07, 0x60, 0x7a, 0xd9, 0xbd, 0x60, 0xe5 } },
-    
-    { "INVALID", { 0 } }
-};
+/* missing GUIDs merged from https://github.com/jethrogb/uefireverse/blob/master/guiddb/efi_guid.c */
 
-#endif /* efi_guids_h */
+GUID_ENTRY("APP_PKG_TOKEN_SPACE", 0xe7e1efa6, 0x7607, 0x4A78, 0xa7, 0xdd, 0x43, 0xe4, 0xbd, 0x72, 0xc0, 0x99)
+GUID_ENTRY("ARM_JUNO_TOKEN_SPACE", 0xa1147a20, 0x3144, 0x4F8D, 0x82, 0x95, 0xb4, 0x83, 0x11, 0xc8, 0xe4, 0xa4)
+GUID_ENTRY("ARM_TOKEN_SPACE", 0xbb11ecfe, 0x820f, 0x4968, 0xbb, 0xa6, 0xf7, 0x6a, 0xfe, 0x30, 0x25, 0x96)
+GUID_ENTRY("ARM_PLATFORM_TOKEN_SPACE", 0x9c0aaed4, 0x74c5, 0x4043, 0xb4, 0x17, 0xa3, 0x22, 0x38, 0x14, 0xce, 0x76)
+GUID_ENTRY("ARM_BOOT_MON_FS_FILE_INFO", 0x41e26b9c, 0xada6, 0x45B3, 0x80, 0x8e, 0x23, 0x57, 0xa3, 0x5b, 0x60, 0xd6)
+GUID_ENTRY("ARM_PLATFORM_UPDATE_FDT_EVENT", 0xaffe115b, 0x8589, 0x456D, 0xba, 0xb5, 0x8f, 0x2e, 0xda, 0x53, 0xae, 0xb7)
+GUID_ENTRY("ARM_REAL_VIEW_EB_PKG_TOKEN_SPACE", 0x44577a0d, 0x361a, 0x45B2, 0xb3, 0x3d, 0xbb, 0x9e, 0xe6, 0x0d, 0x5a, 0x4f)
+GUID_ENTRY("ARM_VEXPRESS_TOKEN_SPACE", 0x9c0aaed4, 0x74c5, 0x4043, 0xb4, 0x17, 0xa3, 0x22, 0x38, 0x14, 0xce, 0x76)
+GUID_ENTRY("ARM_VIRTUALIZATION_TOKEN_SPACE", 0x0b6f5ca7, 0x4f53, 0x445A, 0xb7, 0x6e, 0x2e, 0x36, 0x5b, 0x80, 0x63, 0x66)
+GUID_ENTRY("EARLY_PL011_BASE_ADDRESS", 0xb199dea9, 0xfd5c, 0x4A84, 0x80, 0x82, 0x2f, 0x41, 0x70, 0x78, 0x03, 0x05)
+GUID_ENTRY("BEAGLE_BOARD_TOKEN_SPACE", 0x6834fe45, 0x4aee, 0x4FC6, 0xbc, 0xb5, 0xff, 0x45, 0xb7, 0xa8, 0x71, 0xe2)
+GUID_ENTRY("EFI_ACPI_DESCRIPTION", 0x3c699197, 0x093c, 0x4C69, 0xb0, 0x6b, 0x12, 0x8a, 0xe3, 0x48, 0x1d, 0xc9)
+GUID_ENTRY("EFI_FLASH_MAP_HOB", 0xb091e7d2, 0x05a0, 0x4198, 0x94, 0xf0, 0x74, 0xb7, 0xb8, 0xc5, 0x54, 0x59)
+GUID_ENTRY("EFI_SMM_BASE_THUNK_COMMUNICATION", 0x6568a3d6, 0x015f, 0x4B4A, 0x9c, 0x89, 0x1d, 0x14, 0x63, 0x14, 0x13, 0x0a)
+GUID_ENTRY("EFI_BOOT_STATE", 0x60b5e939, 0x0fcf, 0x4227, 0xba, 0x83, 0x6b, 0xbe, 0xd4, 0x5b, 0xc0, 0xe3)
+GUID_ENTRY("EFI_EDK_COMPATIBILITY_PKG_TOKEN_SPACE", 0x2354d320, 0x3eb3, 0x4C81, 0x99, 0xf4, 0xcc, 0x4a, 0xe1, 0x43, 0x46, 0x3e)
+GUID_ENTRY("EMBEDDED_TOKEN_SPACE", 0xe0d8ca17, 0x4276, 0x4386, 0xbb, 0x79, 0x48, 0xcb, 0x81, 0x3d, 0x3c, 0x4f)
+GUID_ENTRY("FDT_TABLE", 0xb1b621d5, 0xf19c, 0x41A5, 0x83, 0x0b, 0xd9, 0x15, 0x2c, 0x69, 0xaa, 0xe0)
+GUID_ENTRY("HARDWARE_INTERRUPT_PROTOCOL", 0x2890b3ea, 0x053d, 0x1643, 0xad, 0x0c, 0xd6, 0x48, 0x08, 0xda, 0x3f, 0xf1)
+GUID_ENTRY("EMBEDDED_GPIO_PROTOCOL", 0x17a0a3d7, 0xc0a5, 0x4635, 0xbb, 0xd5, 0x07, 0x21, 0x87, 0xdf, 0xe2, 0xee)
+GUID_ENTRY("ANDROID_FASTBOOT_TRANSPORT_PROTOCOL", 0x74bd9fe0, 0x8902, 0x11E3, 0xb9, 0xd3, 0xf7, 0x22, 0x38, 0xfc, 0x9a, 0x31)
+GUID_ENTRY("ANDROID_FASTBOOT_PLATFORM_PROTOCOL", 0x524685a0, 0x89a0, 0x11E3, 0x9d, 0x4d, 0xbf, 0xa9, 0xf6, 0xa4, 0x03, 0x08)
+GUID_ENTRY("USB_DEVICE_PROTOCOL", 0x021bd2ca, 0x51d2, 0x11E3, 0x8e, 0x56, 0xb7, 0x54, 0x17, 0xc7, 0x0b, 0x44)
+GUID_ENTRY("EMU_THREAD_THUNK_PROTOCOL", 0x3b1e4b7c, 0x09d8, 0x944F, 0xa4, 0x08, 0x13, 0x09, 0xeb, 0x8b, 0x44, 0x27)
+GUID_ENTRY("EMU_THUNK_PPI", 0xe113f896, 0x75cf, 0xF640, 0x81, 0x7f, 0xc8, 0x5a, 0x79, 0xe8, 0xae, 0x67)
+GUID_ENTRY("EMULATOR_PKG_TOKEN_SPACE", 0x4f792e68, 0xe8c8, 0x794E, 0xb1, 0xd8, 0x37, 0x03, 0xf3, 0xf2, 0xd5, 0xa5)
+GUID_ENTRY("EMU_SYSTEM_CONFIG", 0xf8626165, 0x6ceb, 0x924A, 0xba, 0xfc, 0xf1, 0x3a, 0xb9, 0xd6, 0x57, 0x28)
+GUID_ENTRY("EXIT_PM_AUTH_PROTOCOL", 0xd088a413, 0x0a70, 0x4217, 0xba, 0x55, 0x9a, 0x3c, 0xb6, 0x5c, 0x41, 0xb3)
+GUID_ENTRY("EFI_SMM_PEI_SMRAM_MEMORY_RESERVE", 0x6dadf1d1, 0xd4cc, 0x4910, 0xbb, 0x6e, 0x82, 0xb1, 0xfd, 0x80, 0xff, 0x3d)
+GUID_ENTRY("EFI_PEI144_FLOPPY_BLOCK_IO_PPI", 0xda6855bd, 0x07b7, 0x4C05, 0x9e, 0xd8, 0xe2, 0x59, 0xfd, 0x36, 0x0e, 0x22)
+GUID_ENTRY("EFI_PEI_FV_FILE_LOADER_PPI", 0x7e1f0d85, 0x04ff, 0x4BB2, 0x86, 0x6a, 0x31, 0xa2, 0x99, 0x6a, 0x48, 0xa8)
+GUID_ENTRY("INTEL_FSP_PKG_TOKEN_SPACE", 0x834c0c5f, 0xadb3, 0x4372, 0xae, 0xeb, 0x03, 0xe4, 0xe9, 0xe6, 0xc5, 0x91)
+GUID_ENTRY("FSP_HEADER_FILE", 0x912740be, 0x2284, 0x4734, 0xb9, 0x71, 0x84, 0xb0, 0x27, 0x35, 0x3f, 0x0c)
+GUID_ENTRY("FSP_BOOT_LOADER_TEMPORARY_MEMORY", 0xbbcff46c, 0xc8d3, 0x4113, 0x89, 0x85, 0xb9, 0xd4, 0xf3, 0xb3, 0xf6, 0x4e)
+GUID_ENTRY("FSP_RESERVED_MEMORY_RESOURCE_HOB", 0x69a79759, 0x1373, 0x4367, 0xa6, 0xc4, 0xc7, 0xf5, 0x9e, 0xfd, 0x98, 0x6e)
+GUID_ENTRY("FSP_NON_VOLATILE_STORAGE_HOB", 0x721acf02, 0x4d77, 0x4C2A, 0xb3, 0xdc, 0x27, 0x0b, 0x7b, 0xa9, 0xe4, 0xb0)
+GUID_ENTRY("FSP_RESERVED_MEMORY_RESOURCE_HOB_TSEG", 0xd038747c, 0xd00c, 0x4980, 0xb3, 0x19, 0x49, 0x01, 0x99, 0xa4, 0x7d, 0x55)
+GUID_ENTRY("FSP_RESERVED_MEMORY_RESOURCE_HOB_GFX", 0x9c7c3aa7, 0x5332, 0x4917, 0x82, 0xb9, 0x56, 0xa5, 0xf3, 0xe6, 0x2a, 0x07)
+GUID_ENTRY("FSP_RESERVED_MEMORY_RESOURCE_HOB_MISC", 0x00d6b14b, 0x7dd0, 0x4062, 0x88, 0x21, 0xe5, 0xf9, 0x6a, 0x2a, 0x1b, 0x00)
+GUID_ENTRY("FSP_WRAPPER_TOKEN_SPACE", 0x2bc1c74a, 0x122f, 0x40B2, 0xb2, 0x23, 0x08, 0x2b, 0x74, 0x65, 0x22, 0x5d)
+GUID_ENTRY("FSP_INIT_DONE_PPI", 0xf5ef05e4, 0xd538, 0x4774, 0x8f, 0x1b, 0xe9, 0x77, 0x30, 0x11, 0xe0, 0x38)
+GUID_ENTRY("TOP_OF_TEMPORARY_RAM_PPI", 0x2f3962b2, 0x57c5, 0x44EC, 0x9e, 0xfc, 0xa6, 0x9f, 0xd3, 0x02, 0x03, 0x2b)
+GUID_ENTRY("PCD_DATA_BASE_SIGNATURE", 0x3c7d193c, 0x682c, 0x4C14, 0xa6, 0x8f, 0x55, 0x2d, 0xea, 0x4f, 0x43, 0x7e)
+GUID_ENTRY("EDKII_WORKING_BLOCK_SIGNATURE", 0x9e58292b, 0x7c68, 0x497D, 0xa0, 0xce, 0x65, 0x00, 0xfd, 0x9f, 0x1b, 0x95)
+GUID_ENTRY("EDKII_FAULT_TOLERANT_WRITE", 0x1d3e9cb8, 0x43af, 0x490B, 0x83, 0x0a, 0x35, 0x16, 0xaa, 0x53, 0x20, 0x47)
+GUID_ENTRY("USB_KEYBOARD_LAYOUT_KEY", 0x3a4d7a7c, 0x018a, 0x4B42, 0x81, 0xb3, 0xdc, 0x10, 0xe3, 0xb5, 0x91, 0xbd)
+GUID_ENTRY("FIRMWARE_PERFORMANCE_S3_POINTER", 0x0dc65adc, 0xa973, 0x4130, 0x8d, 0xf0, 0x2a, 0xdb, 0xeb, 0x9e, 0x4a, 0x31)
+GUID_ENTRY("EVENT_EXIT_BOOT_SERVICES_FAILED", 0x4f6c5507, 0x232f, 0x4787, 0xb9, 0x5e, 0x72, 0xf8, 0x62, 0x49, 0x0c, 0xb1)
+GUID_ENTRY("EDKII_STATUS_CODE_DATA_TYPE_VARIABLE", 0xf6ee6dbb, 0xd67f, 0x4EA0, 0x8b, 0x96, 0x6a, 0x71, 0xb1, 0x9d, 0x84, 0xad)
+GUID_ENTRY("EDKII_MEMORY_PROFILE", 0x821c9a09, 0x541a, 0x40F6, 0x9f, 0x43, 0x0a, 0xd1, 0x93, 0xa1, 0x2c, 0xfe)
+GUID_ENTRY("EDKII_VAR_ERROR_FLAG", 0x04b37fe8, 0xf6ae, 0x480B, 0xbd, 0xd5, 0x37, 0xd9, 0x8c, 0x5e, 0x89, 0xaa)
+GUID_ENTRY("PEI_USB2_HOST_CONTROLLER_PPI", 0xfedd6305, 0xe2d7, 0x4ED5, 0x9f, 0xaa, 0xda, 0x08, 0x0e, 0x33, 0x6c, 0x22)
+GUID_ENTRY("PEI_POST_SCRIPT_TABLE_PPI", 0x88c9d306, 0x0900, 0x4EB5, 0x82, 0x60, 0x3e, 0x2d, 0xbe, 0xda, 0x1f, 0x89)
+GUID_ENTRY("PEI_SERIAL_PORT_PPI", 0x490e9d85, 0x8aef, 0x4193, 0x8e, 0x56, 0xf7, 0x34, 0xa9, 0xff, 0xac, 0x8b)
+GUID_ENTRY("EDKII_VARIABLE_LOCK_PROTOCOL", 0xcd3d0a05, 0x9e24, 0x437C, 0xa8, 0x91, 0x1e, 0xe0, 0x53, 0xdb, 0x76, 0x38)
+GUID_ENTRY("EDKII_VAR_CHECK_PROTOCOL", 0xaf23b340, 0x97b4, 0x4685, 0x8d, 0x4f, 0xa3, 0xf2, 0x81, 0x69, 0xb2, 0x1d)
+GUID_ENTRY("EDKII_SMM_VAR_CHECK_PROTOCOL", 0xb0d8f3c1, 0xb7de, 0x4C11, 0xbc, 0x89, 0x2f, 0xb5, 0x62, 0xc8, 0xc4, 0x11)
+GUID_ENTRY("EDKII_FORM_DISPLAY_ENGINE_PROTOCOL", 0x9bbe29e9, 0xfda1, 0x41EC, 0xad, 0x52, 0x45, 0x22, 0x13, 0x74, 0x2d, 0x2e)
+GUID_ENTRY("EDKII_FORM_BROWSER_EX2_PROTOCOL", 0xa770c357, 0xb693, 0x4E6D, 0xa6, 0xcf, 0xd2, 0x1c, 0x72, 0x8e, 0x55, 0x0b)
+GUID_ENTRY("EFI_FILE_INFO", 0x09576e92, 0x6d3f, 0x11D2, 0x8e, 0x39, 0x00, 0xa0, 0xc9, 0x69, 0x72, 0x3b)
+GUID_ENTRY("EFI_EVENT_READY_TO_BOOT", 0x7ce88fb3, 0x4bd7, 0x4679, 0x87, 0xa8, 0xa8, 0xd8, 0xde, 0xe5, 0x0d, 0x2b)
+GUID_ENTRY("EFI_EVENT_MEMORY_MAP_CHANGE", 0x78bee926, 0x692f, 0x48FD, 0x9e, 0xdb, 0x01, 0x42, 0x2e, 0xf0, 0xd7, 0xab)
+GUID_ENTRY("EFI_EVENT_VIRTUAL_ADDRESS_CHANGE", 0x13fa7698, 0xc831, 0x49C7, 0x87, 0xea, 0x8f, 0x43, 0xfc, 0xc2, 0x51, 0x96)
+GUID_ENTRY("EFI_EVENT_EXIT_BOOT_SERVICES", 0x27abf055, 0xb1b8, 0x4C26, 0x80, 0x48, 0x74, 0x8f, 0x37, 0xba, 0xa2, 0xdf)
+GUID_ENTRY("EFI_EVENT_USER_PROFILE_CHANGED", 0xbaf1e6de, 0x209e, 0x4ADB, 0x8d, 0x96, 0xfd, 0x8b, 0x71, 0xf3, 0xf6, 0x83)
+GUID_ENTRY("EFI_USER_CREDENTIAL_CLASS_UNKNOWN", 0x5cf32e68, 0x7660, 0x449B, 0x80, 0xe6, 0x7e, 0xa3, 0x6e, 0x03, 0xf6, 0xa8)
+GUID_ENTRY("EFI_USER_CREDENTIAL_CLASS_PASSWORD", 0xf8e5058c, 0xccb6, 0x4714, 0xb2, 0x20, 0x3f, 0x7e, 0x3a, 0x64, 0x0b, 0xd1)
+GUID_ENTRY("EFI_USER_CREDENTIAL_CLASS_SMART_CARD", 0x5f03ba33, 0x8c6b, 0x4C24, 0xaa, 0x2e, 0x14, 0xa2, 0x65, 0x7b, 0xd4, 0x54)
+GUID_ENTRY("EFI_USER_CREDENTIAL_CLASS_FINGERPRINT", 0x32cba21f, 0xf308, 0x4CBC, 0x9a, 0xb5, 0xf5, 0xa3, 0x69, 0x9f, 0x04, 0x4a)
+GUID_ENTRY("EFI_USER_CREDENTIAL_CLASS_HANDPRINT", 0x5917ef16, 0xf723, 0x4BB9, 0xa6, 0x4b, 0xd8, 0xc5, 0x32, 0xf4, 0xd8, 0xb5)
+GUID_ENTRY("EFI_USER_CREDENTIAL_CLASS_SECURE_CARD", 0x8a6b4a83, 0x42fe, 0x45D2, 0xa2, 0xef, 0x46, 0xf0, 0x6c, 0x7d, 0x98, 0x52)
+GUID_ENTRY("EFI_KMS_FORMAT_RSASHA2563072", 0x4e1356c2, 0x0eed, 0x463F, 0x81, 0x47, 0x99, 0x33, 0xab, 0xdb, 0xc7, 0xd5)
+GUID_ENTRY("EFI_FMP_CAPSULE", 0x6dcbd5ed, 0xe82d, 0x4C44, 0xbd, 0xa1, 0x71, 0x94, 0x19, 0x9a, 0xd9, 0x2a)
+GUID_ENTRY("EFI_CERT_X509_SHA256", 0x3bd2a492, 0x96c0, 0x4079, 0xb4, 0x20, 0xfc, 0xf9, 0x8e, 0xf1, 0x03, 0xed)
+GUID_ENTRY("EFI_CERT_X509_SHA384", 0x7076876e, 0x80c2, 0x4EE6, 0xaa, 0xd2, 0x28, 0xb3, 0x49, 0xa6, 0x86, 0x5b)
+GUID_ENTRY("EFI_CERT_X509_SHA512", 0x446dbf63, 0x2502, 0x4CDA, 0xbc, 0xfa, 0x24, 0x65, 0xd2, 0xb0, 0xfe, 0x9d)
+GUID_ENTRY("EFI_RNG_ALGORITHM_SP80090_HASH256", 0xa7af67cb, 0x603b, 0x4D42, 0xba, 0x21, 0x70, 0xbf, 0xb6, 0x29, 0x3f, 0x96)
+GUID_ENTRY("EFI_RNG_ALGORITHM_SP80090_HMAC256", 0xc5149b43, 0xae85, 0x4F53, 0x99, 0x82, 0xb9, 0x43, 0x35, 0xd3, 0xa9, 0xe7)
+GUID_ENTRY("EFI_RNG_ALGORITHM_SP80090_CTR256", 0x44f0de6e, 0x4d8c, 0x4045, 0xa8, 0xc7, 0x4d, 0xd1, 0x68, 0x85, 0x6b, 0x9e)
+GUID_ENTRY("EFI_RNG_ALGORITHM_X9313_DES", 0x63c4785a, 0xca34, 0x4012, 0xa3, 0xc8, 0x0b, 0x6a, 0x32, 0x4f, 0x55, 0x46)
+GUID_ENTRY("EFI_RNG_ALGORITHM_X931_AES", 0xacd03321, 0x777e, 0x4D3D, 0xb1, 0xc8, 0x20, 0xcf, 0xd8, 0x88, 0x20, 0xc9)
+GUID_ENTRY("EFI_ADAPTER_INFO_MEDIA_STATE", 0xd7c74207, 0xa831, 0x4A26, 0xb1, 0xf5, 0xd1, 0x93, 0x06, 0x5c, 0xe8, 0xb6)
+GUID_ENTRY("EFI_ADAPTER_INFO_NETWORK_BOOT", 0x1fbd2960, 0x4130, 0x41E5, 0x94, 0xac, 0xd2, 0xcf, 0x03, 0x7f, 0xb3, 0x7c)
+GUID_ENTRY("EFI_ADAPTER_INFO_SAN_MAC_ADDRESS", 0x114da5ef, 0x2cf1, 0x4E12, 0x9b, 0xbb, 0xc4, 0x70, 0xb5, 0x52, 0x05, 0xd9)
+GUID_ENTRY("EFI_VECTOR_HANDOFF_TABLE", 0x996ec11c, 0x5397, 0x4E73, 0xb5, 0x8f, 0x82, 0x7e, 0x52, 0x90, 0x6d, 0xef)
+GUID_ENTRY("ADAPTER_INFO_PLATFORM_SECURITY", 0x6be272c7, 0x1320, 0x4CCD, 0x90, 0x17, 0xd4, 0x61, 0x2c, 0x01, 0x2b, 0x25)
+GUID_ENTRY("EFI_PEI_MASTER_BOOT_MODE_PPI", 0x7408d748, 0xfc8c, 0x4EE6, 0x92, 0x88, 0xc4, 0xbe, 0xc0, 0x92, 0xa4, 0x10)
+GUID_ENTRY("EFI_PEI_BOOT_IN_RECOVERY_MODE_PPI", 0x17ee496a, 0xd8e4, 0x4B9A, 0x94, 0xd1, 0xce, 0x82, 0x72, 0x30, 0x08, 0x50)
+GUID_ENTRY("GET_PCD_INFO_PPI", 0x4d8b155b, 0xc059, 0x4C8F, 0x89, 0x26, 0x06, 0xfd, 0x43, 0x31, 0xdb, 0x8a)
+GUID_ENTRY("EFI_GET_PCD_INFO_PPI", 0xa60c6b59, 0xe459, 0x425D, 0x9c, 0x69, 0x0b, 0xcc, 0x9c, 0xb2, 0x7d, 0x81)
+GUID_ENTRY("EFI_PEI_I2C_MASTER_PPI", 0xb3bfab9b, 0x9f9c, 0x4E8B, 0xad, 0x37, 0x7f, 0x8c, 0x51, 0xfc, 0x62, 0x80)
+GUID_ENTRY("EFI_PEI_FIRMWARE_VOLUME_INFO2_PPI", 0xea7ca24b, 0xded5, 0x4DAD, 0xa3, 0x89, 0xbf, 0x82, 0x7e, 0x8f, 0x9b, 0x38)
+GUID_ENTRY("GET_PCD_INFO_PROTOCOL", 0x5be40f57, 0xfa68, 0x4610, 0xbb, 0xbf, 0xe9, 0xc5, 0xfc, 0xda, 0xd3, 0x65)
+GUID_ENTRY("EFI_GET_PCD_INFO_PROTOCOL", 0xfd0f4478, 0x0efd, 0x461D, 0xba, 0x2d, 0xe5, 0x8c, 0x45, 0xfd, 0x5f, 0x5e)
+GUID_ENTRY("EFI_I2C_MASTER_PROTOCOL", 0xcd72881f, 0x45b5, 0x4FEB, 0x98, 0xc8, 0x31, 0x3d, 0xa8, 0x11, 0x74, 0x62)
+GUID_ENTRY("EFI_I2C_IO_PROTOCOL", 0xb60a3e6b, 0x18c4, 0x46E5, 0xa2, 0x9a, 0xc9, 0xa1, 0x06, 0x65, 0xa2, 0x8e)
+GUID_ENTRY("EFI_I2C_ENUMERATE_PROTOCOL", 0xda8cd7c4, 0x1c00, 0x49E2, 0x80, 0x3e, 0x52, 0x14, 0xe7, 0x01, 0x89, 0x4c)
+GUID_ENTRY("EFI_I2C_HOST_PROTOCOL", 0xa5aab9e3, 0xc727, 0x48CD, 0x8b, 0xbf, 0x42, 0x72, 0x33, 0x85, 0x49, 0x48)
+GUID_ENTRY("EFI_I2C_BUS_CONFIGURATION_MANAGEMENT_PROTOCOL", 0x55b71fb5, 0x17c6, 0x410E, 0xb5, 0xbd, 0x5f, 0xa2, 0xe3, 0xd4, 0x46, 0x6b)
+GUID_ENTRY("EFI_TR_EEPROTOCOL", 0x607f766c, 0x7455, 0x42BE, 0x93, 0x0b, 0xe4, 0xd7, 0x6d, 0xb2, 0x72, 0x0f)
+GUID_ENTRY("EFI_DISK_IO2_PROTOCOL", 0x151c8eae, 0x7f2c, 0x472C, 0x9e, 0x54, 0x98, 0x28, 0x19, 0x4f, 0x6a, 0x88)
+GUID_ENTRY("EFI_TIMESTAMP_PROTOCOL", 0xafbfde41, 0x2e6e, 0x4262, 0xba, 0x65, 0x62, 0xb9, 0x23, 0x6e, 0x54, 0x95)
+GUID_ENTRY("EFI_RNG_PROTOCOL", 0x3152bca5, 0xeade, 0x433D, 0x86, 0x2e, 0xc0, 0x1c, 0xdc, 0x29, 0x1f, 0x44)
+GUID_ENTRY("EFI_ADAPTER_INFORMATION_PROTOCOL", 0xe5dd1403, 0xd622, 0xC24E, 0x84, 0x88, 0xc7, 0x1b, 0x17, 0xf5, 0xe8, 0x02)
+GUID_ENTRY("EFI_NETWORK_PKG_TOKEN_SPACE", 0x40e064b2, 0x0ae0, 0x48B1, 0xa0, 0x7d, 0xf8, 0xcf, 0x1e, 0x1a, 0x23, 0x10)
+GUID_ENTRY("EFI_NT32_PKG_TOKEN_SPACE", 0x0d79a645, 0x1d91, 0x40A6, 0xa8, 0x1f, 0x61, 0xe6, 0x98, 0x2b, 0x32, 0xb4)
+GUID_ENTRY("PEI_NT_AUTO_SCAN_PPI", 0x0dce384d, 0x007c, 0x4BA5, 0x94, 0xbd, 0x0f, 0x6e, 0xb6, 0x4d, 0x2a, 0xa9)
+GUID_ENTRY("NT_PEI_LOAD_FILE_PPI", 0xfd0c65eb, 0x0405, 0x4CD2, 0x8a, 0xee, 0xf4, 0x00, 0xef, 0x13, 0xba, 0xc2)
+GUID_ENTRY("WIN_NT_BUS_DRIVER", 0x0419f582, 0x0625, 0x4531, 0x8a, 0x33, 0x85, 0xa9, 0x96, 0x5c, 0x95, 0xbc)
+GUID_ENTRY("OMAP35XX_TOKEN_SPACE", 0x24b09abe, 0x4e47, 0x481C, 0xa9, 0xad, 0xce, 0xf1, 0x2c, 0x39, 0x23, 0x27)
+GUID_ENTRY("OPTION_ROM_PKG_TOKEN_SPACE", 0x1e43298f, 0x3478, 0x41A7, 0xb5, 0x77, 0x86, 0x06, 0x46, 0x35, 0xc7, 0x28)
+GUID_ENTRY("UEFI_OVMF_PKG_TOKEN_SPACE", 0x93bb96af, 0xb9f2, 0x4EB8, 0x94, 0x62, 0xe0, 0xba, 0x74, 0x56, 0x42, 0x36)
+GUID_ENTRY("OVMF_PLATFORM_CONFIG", 0x7235c51c, 0x0c80, 0x4CAB, 0x87, 0xac, 0x3b, 0x08, 0x4a, 0x63, 0x04, 0xb1)
+GUID_ENTRY("VIRTIO_MMIO_TRANSPORT", 0x837dca9e, 0xe874, 0x4D82, 0xb2, 0x9a, 0x23, 0xfe, 0x0e, 0x23, 0xd1, 0xe2)
+GUID_ENTRY("VIRTIO_DEVICE_PROTOCOL", 0xfa920010, 0x6785, 0x4941, 0xb6, 0xec, 0x49, 0x8c, 0x57, 0x9f, 0x16, 0x0a)
+GUID_ENTRY("XEN_BUS_PROTOCOL", 0x3d3ca290, 0xb9a5, 0x11E3, 0xb7, 0x5d, 0xb8, 0xac, 0x6f, 0x7d, 0x65, 0xe6)
+GUID_ENTRY("DXE_DEBUGPORT_EXT_PROTOCOL", 0x31a4878f, 0x230d, 0x4FC2, 0x90, 0xbb, 0xda, 0x5f, 0x41, 0xa4, 0x4b, 0x1b)
+GUID_ENTRY("DXE_DEBUG_CMD_PROTOCOL", 0xca3b3a50, 0x5698, 0x4551, 0x8b, 0x18, 0xce, 0xae, 0xef, 0x91, 0x7d, 0x50)
+GUID_ENTRY("DXE_DEBUG_DISPATCH_PROTOCOL", 0x301af449, 0xe0d7, 0x43A3, 0x8b, 0x1b, 0xbc, 0x16, 0x72, 0x5d, 0x37, 0x4b)
+GUID_ENTRY("EFI_TCG_PRIVATE_INTERFACE", 0x7a28436a, 0xe113, 0x406A, 0xaf, 0xf9, 0x0d, 0xbf, 0x7f, 0x64, 0x3e, 0x02)
+GUID_ENTRY("PDM_WINDOW_BUTTON", 0x5f65dfdb, 0xac20, 0x4F43, 0x9b, 0x21, 0x26, 0x9e, 0x81, 0xa0, 0xea, 0x7e)
+GUID_ENTRY("PDM_WINDOW_SPIN", 0x60b27e1a, 0xd65e, 0x4DB0, 0xb2, 0xbb, 0xc1, 0x6f, 0xa7, 0x1e, 0x44, 0xab)
+GUID_ENTRY("PEI_DEBUG_DISPATCH_PPI", 0xc9737920, 0xc2ad, 0x41C3, 0xb1, 0x33, 0x0f, 0x9c, 0x25, 0x1b, 0x67, 0x43)
+GUID_ENTRY("PEI_POST_BOOT_SCRIPT_TABLE_PPI", 0x88c9d306, 0x0900, 0x4EB5, 0x82, 0x60, 0x3e, 0x2d, 0xbe, 0xda, 0x1f, 0x89)
+GUID_ENTRY("PHOENIX_DESKTOP_MESSAGE_PROTOCOL", 0x87dd3539, 0x0667, 0x4BB7, 0x9f, 0xb2, 0x47, 0xd3, 0xc5, 0x0b, 0x02, 0x1b)
+GUID_ENTRY("PHOENIX_DESKTOP_WINDOW_PROTOCOL", 0x6ffec78d, 0x7dbf, 0x4F8B, 0x96, 0x8d, 0x2f, 0x43, 0xa0, 0x80, 0xc1, 0x3f)
+GUID_ENTRY("PHOENIX_GDI_PROTOCOL", 0x3f5a74b2, 0xbf80, 0x4850, 0x85, 0x91, 0x4f, 0x2d, 0xf5, 0xf9, 0xcb, 0x2b)
+GUID_ENTRY("PHOENIX_SMM_CORE_SERVICES_PROTOCOL", 0x177e63c1, 0xaed6, 0x4D88, 0x91, 0x7e, 0x9b, 0x4f, 0xb9, 0xfe, 0x40, 0x92)
+GUID_ENTRY("PHOENIX_EFI_SMM_SW_SMI_PROTOCOL", 0xff052503, 0x1af9, 0x4AEB, 0x83, 0xc4, 0xc2, 0xd4, 0xce, 0xb1, 0x0c, 0xa3)
+GUID_ENTRY("PHOENIX_SMM_WATCHDOG_TIMER_PROTOCOL", 0x6fde3af8, 0x37ad, 0x43FC, 0xb7, 0x28, 0xf4, 0xd3, 0x41, 0xf3, 0x92, 0x40)
+GUID_ENTRY("SCT_ISA_HC_PPI", 0x8d48bd70, 0xc8a3, 0x4C06, 0x90, 0x1b, 0x74, 0x79, 0x46, 0xaa, 0xc3, 0x58)
+GUID_ENTRY("SCT_ISA_HC_PROTOCOL", 0x5fac7360, 0xd4f2, 0x4C9E, 0xa7, 0xed, 0xf2, 0x59, 0x5e, 0x67, 0x08, 0x89)
+GUID_ENTRY("PEI_SPEAKER_INTERFACE_PPI", 0x30ac275e, 0xbb30, 0x4B84, 0xa1, 0xcd, 0x0a, 0xf1, 0x32, 0x2c, 0x89, 0xc0)
+GUID_ENTRY("PEI_MFG_MEMORY_TEST_PPI", 0xab294a92, 0xeaf5, 0x4CF3, 0xab, 0x2b, 0x2d, 0x4b, 0xed, 0x4d, 0xb6, 0x3d)
+GUID_ENTRY("PEI_SHA256_HASH_PPI", 0x950e191b, 0x8524, 0x4F51, 0x80, 0xa1, 0x5c, 0x4f, 0x1b, 0x03, 0xf3, 0x5c)
+GUID_ENTRY("EFI_PLATFORM_BOOT_MODE", 0xce845704, 0x1683, 0x4D38, 0xa4, 0xf9, 0x7d, 0x0b, 0x50, 0x77, 0x57, 0x93)
+GUID_ENTRY("EFI_PLATFORM_INFO", 0x1e2acc41, 0xe26a, 0x483D, 0xaf, 0xc7, 0xa0, 0x56, 0xc3, 0x4e, 0x08, 0x7b)
+GUID_ENTRY("PLATFORM_MODULE_TOKEN_SPACE", 0x69d13bf0, 0xaf91, 0x4D96, 0xaa, 0x9f, 0x21, 0x84, 0xc5, 0xce, 0x3b, 0xc0)
+GUID_ENTRY("EFI_SERIAL_PORT_TOKEN_SPACE", 0x5fad2389, 0x2bc7, 0x4BD2, 0x83, 0xd3, 0x42, 0x9f, 0xb6, 0xae, 0xa3, 0x3f)
+GUID_ENTRY("EFI_ICH_TOKEN_SPACE", 0xe38c11e3, 0x968f, 0x47B8, 0xac, 0xef, 0xac, 0xc0, 0x69, 0x3d, 0xb9, 0xff)
+GUID_ENTRY("EFI_PCH_TOKEN_SPACE", 0x89a1b278, 0xa1a1, 0x4DF7, 0xb1, 0x37, 0xde, 0x5a, 0xd7, 0xc4, 0x79, 0x13)
+GUID_ENTRY("EFI_PLATFORM_CPU_INFO", 0xbb9c7ab7, 0xb8d9, 0x4BF3, 0x9c, 0x29, 0x9b, 0xf3, 0x41, 0xe2, 0x17, 0xbc)
+GUID_ENTRY("EFI_BIOS_ID", 0xc3e36d09, 0x8294, 0x4B97, 0xa8, 0x57, 0xd5, 0x28, 0x8f, 0xe3, 0x3e, 0x28)
+GUID_ENTRY("EFI_BOARD_FEATURES", 0x94b9e8ae, 0x8877, 0x479A, 0x98, 0x42, 0xf5, 0x97, 0x4b, 0x82, 0xce, 0xd3)
+GUID_ENTRY("ITK_DATA_VAR", 0x3812723d, 0x7e48, 0x4E29, 0xbc, 0x27, 0xf5, 0xa3, 0x9a, 0xc9, 0x4e, 0xf1)
+GUID_ENTRY("DMI_DATA", 0x70e56c5e, 0x280c, 0x44B0, 0xa4, 0x97, 0x09, 0x68, 0x1a, 0xbc, 0x37, 0x5e)
+GUID_ENTRY("IDCC_DATA_HUB", 0x788e1d9f, 0x1eab, 0x47D2, 0xa2, 0xf3, 0x78, 0xca, 0xe8, 0x7d, 0x60, 0x12)
+GUID_ENTRY("MFG_MODE_VARIABLE", 0xef14fd78, 0x0793, 0x4E2B, 0xac, 0x6d, 0x06, 0x28, 0x47, 0xe0, 0x17, 0x91)
+GUID_ENTRY("ACPIOSFRMFG_STRING_VARIABLE", 0x72234213, 0x0fd7, 0x48A1, 0xa5, 0x9f, 0xb4, 0x1b, 0xc1, 0x07, 0xfb, 0xcd)
+GUID_ENTRY("ACPIOSFRREF_DATA_BLOCK_VARIABLE", 0x72234213, 0x0fd7, 0x48A1, 0xa5, 0x9f, 0xb4, 0x1b, 0xc1, 0x07, 0xfb, 0xcd)
+GUID_ENTRY("ACPIOSFRMODEL_STRING_VARIABLE", 0xca1bcad9, 0xe021, 0x4547, 0xa1, 0xb0, 0x5b, 0x22, 0xc7, 0xf6, 0x87, 0xf4)
+GUID_ENTRY("EFI_PCI_LAN_INFO", 0x0d9a1427, 0xe02a, 0x437D, 0x92, 0x6b, 0xaa, 0x52, 0x1f, 0xd7, 0x22, 0xba)
+GUID_ENTRY("FIRMWARE_ID", 0x5e559c23, 0x1faa, 0x4AE1, 0x8d, 0x4a, 0xc6, 0xcf, 0x02, 0x6c, 0x76, 0x6f)
+GUID_ENTRY("OS_SELECTION_VARIABLE", 0x86843f56, 0x675d, 0x40A5, 0x95, 0x30, 0xbc, 0x85, 0x83, 0x72, 0xf1, 0x03)
+GUID_ENTRY("DXE_PCH_PLATFORM_POLICY_PROTOCOL", 0x4b0165a9, 0x61d6, 0x4E23, 0xa0, 0xb5, 0x3e, 0xc7, 0x9c, 0x2e, 0x30, 0xd5)
+GUID_ENTRY("EFI_LPC_WPCE791_POLICY_PROTOCOL", 0xab2bee2f, 0xc1a6, 0x4399, 0x85, 0x3d, 0xc0, 0x7c, 0x77, 0x4f, 0xfd, 0x0d)
+GUID_ENTRY("USB_POLICY", 0xf617b358, 0x12cf, 0x414A, 0xa0, 0x69, 0x60, 0x67, 0x7b, 0xda, 0x13, 0xb4)
+GUID_ENTRY("DXE_VLV_PLATFORM_POLICY", 0x5bab88ba, 0xe0e2, 0x4674, 0xb6, 0xad, 0xb8, 0x12, 0xf6, 0x88, 0x1c, 0xd6)
+GUID_ENTRY("EFI_SMBIOS_SLOT_POPULATION", 0xef7bf7d6, 0xf8ff, 0x4A76, 0x82, 0x47, 0xc0, 0xd0, 0xd1, 0xcc, 0x49, 0xc0)
+GUID_ENTRY("OBSERVABLE_PROTOCOL", 0xe227c522, 0xd5fe, 0x4A53, 0x87, 0xb1, 0x0f, 0xbe, 0x57, 0x0f, 0x98, 0xe9)
+GUID_ENTRY("EFI_CK505_CLOCK_PLATFORM_INFO", 0x3c485ea4, 0x449a, 0x46CE, 0xbb, 0x08, 0x2a, 0x33, 0x6e, 0xa9, 0x6b, 0x4e)
+GUID_ENTRY("EFI_LPC_WPC83627_POLICY_PROTOCOL", 0xd3ecc567, 0x9fd5, 0x44C1, 0x86, 0xcf, 0x5d, 0xa7, 0xa2, 0x4f, 0x4b, 0x5d)
+GUID_ENTRY("EFI_TCO_RESET_PROTOCOL", 0xa6a79162, 0xe325, 0x4C30, 0xbc, 0xc3, 0x59, 0x37, 0x30, 0x64, 0xef, 0xb3)
+GUID_ENTRY("EFI_WATCHDOG_TIMER_DRIVER_PROTOCOL", 0xd5b06d16, 0x2ea1, 0x4DEF, 0x98, 0xd0, 0xa0, 0x5d, 0x40, 0x72, 0x84, 0x17)
+GUID_ENTRY("EFI_PLATFORM_IDE_INIT_PROTOCOL", 0x377c66a3, 0x8fe7, 0x4EE8, 0x85, 0xb8, 0xf1, 0xa2, 0x82, 0x56, 0x9e, 0x3b)
+GUID_ENTRY("ENHANCED_SPEEDSTEP_PROTOCOL", 0x91a1ddcf, 0x5374, 0x4939, 0x89, 0x51, 0xd7, 0x29, 0x3f, 0x1a, 0x78, 0x6f)
+GUID_ENTRY("EFI_GOP_DISPLAY_BRIGHTNESS_PROTOCOL", 0x6ff23f1d, 0x877c, 0x4B1B, 0x93, 0xfc, 0xf1, 0x42, 0xb2, 0xee, 0xa6, 0xa7)
+GUID_ENTRY("EFI_USB_KEYBOARD_CONNECT", 0xad9c4381, 0x1ede, 0x430C, 0x8d, 0x42, 0x23, 0x76, 0x7c, 0x46, 0x5d, 0x52)
+GUID_ENTRY("EFI_MMIO_DEVICE_PROTOCOL", 0x24486226, 0xf8c2, 0x41F5, 0xb9, 0xdd, 0x78, 0x3e, 0x9e, 0x56, 0xde, 0xa0)
+GUID_ENTRY("EFI_I2C_BUS_CONFIGURATION_MANAGEMENT_PROTOCOL2", 0x75032015, 0xd156, 0x423E, 0xbf, 0xa3, 0x7a, 0x65, 0xab, 0xa4, 0x71, 0x05)
+GUID_ENTRY("EFI_I2C_ACPI_PROTOCOL", 0xf30c2915, 0x5782, 0x4E6A, 0xa8, 0x46, 0x05, 0xba, 0xbc, 0xe7, 0xb6, 0xa0)
+GUID_ENTRY("EFI_I2C_MASTER_PROTOCOL2", 0x578c315a, 0x68cf, 0x4E81, 0xb5, 0xc6, 0x22, 0xdb, 0x40, 0xd0, 0x10, 0xbc)
+GUID_ENTRY("EFI_I2C_HOST_PROTOCOL2", 0x70b221af, 0xfdff, 0x4FDE, 0x99, 0x68, 0x1a, 0xf6, 0x23, 0xa9, 0x56, 0xd9)
+GUID_ENTRY("EFI_I2C_BUS_PROTOCOL", 0x9fa1b225, 0x3346, 0x461B, 0xa0, 0x69, 0xed, 0x01, 0xb6, 0x73, 0xd2, 0x40)
+GUID_ENTRY("EFI_I2C_SLAVE_PROTOCOL", 0xf2c1910e, 0xf5c9, 0x4B72, 0xb2, 0x43, 0x6d, 0x59, 0x09, 0x6a, 0x79, 0xf0)
+GUID_ENTRY("EFI_SPI_ACPI_PROTOCOL", 0x9f49a879, 0x3d71, 0x42B3, 0xa0, 0xad, 0xdd, 0xb1, 0xf3, 0x30, 0x10, 0xa3)
+GUID_ENTRY("EFI_SPI_HOST_PROTOCOL", 0x951b65e5, 0x8872, 0x41ED, 0xad, 0x1d, 0xd5, 0x68, 0x1f, 0x4a, 0xf0, 0x33)
+GUID_ENTRY("EFI_SPI_BUS_PROTOCOL", 0x137b3044, 0xf6d7, 0x473E, 0xa6, 0x25, 0x9f, 0xb9, 0x25, 0x05, 0xc1, 0x80)
+GUID_ENTRY("LPSS_DUMMY_PROTOCOL", 0xaf4cc162, 0xd41c, 0x455A, 0xab, 0x45, 0x6d, 0xbc, 0xc1, 0xcd, 0x32, 0xf3)
+GUID_ENTRY("EFI_GPIO_OPERATION_PROTOCOL", 0x38ddfe8f, 0x8991, 0x44AA, 0x98, 0x89, 0x83, 0xf4, 0x91, 0x84, 0x65, 0xb0)
+GUID_ENTRY("EFI_ESRT_OPERATION_PROTOCOL", 0x4549ab47, 0x6e60, 0x4293, 0xb9, 0x1d, 0x31, 0xb6, 0x10, 0xad, 0x80, 0x56)
+GUID_ENTRY("EFI_FW_DISPLAY_CAPSULE", 0x3b8c8162, 0x188c, 0x46A4, 0xae, 0xc9, 0xbe, 0x43, 0xf1, 0xd6, 0x56, 0x97)
+GUID_ENTRY("EFI_FIRMWARE_CLASS", 0xb122a262, 0x3551, 0x4F48, 0x88, 0x92, 0x55, 0xf6, 0xc0, 0x61, 0x42, 0x90)
+GUID_ENTRY("EFI_DFUVER", 0x0dc73aed, 0xcbf6, 0x4A25, 0xa6, 0x8d, 0x59, 0xc8, 0x0f, 0x44, 0xc7, 0xc3)
+GUID_ENTRY("EFI_ESRT_TABLE", 0xb122a263, 0x3661, 0x4F68, 0x99, 0x29, 0x78, 0xf8, 0xb0, 0xd6, 0x21, 0x80)
+GUID_ENTRY("EFI_CAPSULE_CRASH_LOG_VAR", 0xf3ff1468, 0x04ba, 0x4966, 0x9f, 0xb2, 0xe4, 0xa7, 0x90, 0x05, 0x46, 0x50)
+GUID_ENTRY("EFI_CAPSULE_CRASH", 0x0e1d2972, 0x65af, 0x4AC1, 0xbf, 0xa3, 0xce, 0xf4, 0xab, 0x0c, 0x38, 0xfe)
+GUID_ENTRY("EFI_SECURE_BOOT_ENABLE_DISABLE", 0xf0a30bc7, 0xaf08, 0x4556, 0x99, 0xc4, 0x00, 0x10, 0x09, 0xc9, 0x3a, 0x44)
+GUID_ENTRY("EFI_CUSTOM_MODE_ENABLE", 0xc076ec0c, 0x7028, 0x4399, 0xa0, 0x72, 0x71, 0xee, 0x5c, 0x44, 0x8b, 0x9f)
+GUID_ENTRY("EFI_VENDOR_KEYS_NV", 0x9073e4e0, 0x60ec, 0x4B6E, 0x99, 0x03, 0x4c, 0x22, 0x3c, 0x26, 0x0f, 0x3c)
+GUID_ENTRY("EFI_CERT_DB", 0xd9bee56e, 0x75dc, 0x49D9, 0xb4, 0xd7, 0xb5, 0x34, 0x21, 0x0f, 0x63, 0x7a)
+GUID_ENTRY("TCG_EVENT_ENTRY_HOB", 0x2b9ffb52, 0x1b13, 0x416F, 0xa8, 0x7b, 0xbc, 0x93, 0x0d, 0xef, 0x92, 0xa8)
+GUID_ENTRY("TPM_ERROR_HOB", 0xef598499, 0xb25e, 0x473A, 0xbf, 0xaf, 0xe7, 0xe5, 0x7d, 0xce, 0x82, 0xc4)
+GUID_ENTRY("EFI_TR_EEPHYSICAL_PRESENCE", 0xf24643c2, 0xc622, 0x494E, 0x8a, 0x0d, 0x46, 0x32, 0x57, 0x9c, 0x2d, 0x5b)
+GUID_ENTRY("EFI_TPM_DEVICE_INSTANCE_TPM12", 0x8b01e5b6, 0x4f19, 0x46E8, 0xab, 0x93, 0x1c, 0x53, 0x67, 0x1b, 0x90, 0xcc)
+GUID_ENTRY("EFI_TPM_DEVICE_INSTANCE_TPM20_DTPM", 0x286bf25a, 0xc2c3, 0x408C, 0xb3, 0xb4, 0x25, 0xe6, 0x75, 0x8b, 0x73, 0x17)
+GUID_ENTRY("EFI_TPM_DEVICE_SELECTED", 0x7f4158d3, 0x074d, 0x456D, 0x8c, 0xb2, 0x01, 0xf9, 0xc8, 0xf7, 0x9d, 0xaa)
+GUID_ENTRY("TR_EECONFIG_FORM_SET", 0xc54b425f, 0xaa79, 0x48B4, 0x98, 0x1f, 0x99, 0x8b, 0x3c, 0x4b, 0x64, 0x1c)
+GUID_ENTRY("PEI_TPM_INITIALIZATION_DONE_PPI", 0xa030d115, 0x54dd, 0x447B, 0x90, 0x64, 0xf2, 0x06, 0x88, 0x3d, 0x7c, 0xcc)
+GUID_ENTRY("EFI_PEI_FIRMWARE_VOLUME_INFO_MEASUREMENT_EXCLUDED_PPI", 0x6e056ff9, 0xc695, 0x4364, 0x9e, 0x2c, 0x61, 0x26, 0xf5, 0xce, 0xea, 0xae)
+GUID_ENTRY("SHELL_BCFG_HII", 0x5f5f605d, 0x1583, 0x4A2D, 0xa6, 0xb2, 0xeb, 0x12, 0xda, 0xb4, 0xa2, 0xb6)
+GUID_ENTRY("EFI_SHELL_DYNAMIC_COMMAND_PROTOCOL", 0x3c7200e9, 0x005f, 0x4EA4, 0x87, 0xde, 0xa3, 0xdf, 0xac, 0x8a, 0x27, 0xc3)
+GUID_ENTRY("EFI_SOURCE_LEVEL_DEBUG_PKG_TOKEN_SPACE", 0x865a5aab, 0xb85d, 0x474C, 0x84, 0x55, 0x65, 0xd1, 0xbe, 0x84, 0x4b, 0xe2)
+GUID_ENTRY("STD_LIB_TOKEN_SPACE", 0x447559f0, 0xd02e, 0x4CF1, 0x99, 0xbc, 0xca, 0x11, 0x65, 0x40, 0x54, 0xc2)
+GUID_ENTRY("EFI_SOCKET_PROTOCOL", 0x58e6ed63, 0x1694, 0x440B, 0x93, 0x88, 0xe9, 0x8f, 0xed, 0x6b, 0x65, 0xaf)
+GUID_ENTRY("EFI_SOCKET_SERVICE_BINDING_PROTOCOL", 0x8aaedb2a, 0xa6bb, 0x47C6, 0x94, 0xce, 0x1b, 0x80, 0x96, 0x42, 0x3f, 0x2a)
+GUID_ENTRY("VLV_POLICY_PPI", 0x7d84b2c2, 0x22a1, 0x4372, 0xb1, 0x2c, 0xeb, 0xb2, 0x32, 0xd3, 0xa6, 0xa3)
+GUID_ENTRY("VLV_MMIO_POLICY_PPI", 0xe767bf7f, 0x4db6, 0x5B34, 0x10, 0x11, 0x4f, 0xbe, 0x4c, 0xa7, 0xaf, 0xd2)
+GUID_ENTRY("SE_CF_TPMPPI", 0x10e26df1, 0x8775, 0x4EE1, 0xb5, 0x0a, 0x3a, 0xe8, 0x28, 0x93, 0x70, 0x3a)
+GUID_ENTRY("PCH_INIT_PPI", 0x09ea894a, 0xbe0d, 0x4230, 0xa0, 0x03, 0xed, 0xc6, 0x93, 0xb4, 0x8e, 0x95)
+GUID_ENTRY("PCH_PLATFORM_POLICY_PPI", 0x15344673, 0xd365, 0x4BE2, 0x85, 0x13, 0x14, 0x97, 0xcc, 0x07, 0x61, 0x1d)
+GUID_ENTRY("PEI_SPI_PPI", 0xa38c6898, 0x2b5c, 0x4FF6, 0x93, 0x26, 0x2e, 0x63, 0x21, 0x2e, 0x56, 0xc2)
+GUID_ENTRY("SE_CUMA_PPI", 0xcbd86677, 0x362f, 0x4C04, 0x94, 0x59, 0xa7, 0x41, 0x32, 0x6e, 0x05, 0xcf)
+GUID_ENTRY("PEI_SDHC_PPI", 0xf4ef9d7a, 0x98c5, 0x4C1A, 0xb4, 0xd9, 0xd8, 0xd8, 0x72, 0x65, 0xbe, 0x0c)
+GUID_ENTRY("PEI_BLOCK_IO_PPI", 0xbc5fa650, 0xedbb, 0x4D0D, 0xb3, 0xa3, 0xd9, 0x89, 0x07, 0xf8, 0x47, 0xdf)
+GUID_ENTRY("SE_CF_TPMPOLICY_PPI", 0x4fd1ba49, 0x8f90, 0x471A, 0xa2, 0xc9, 0x17, 0x3c, 0x7a, 0x73, 0x2f, 0xd0)
+GUID_ENTRY("PCH_PEI_INIT_PPI", 0xacb93b08, 0x5cdc, 0x4A8F, 0x93, 0xd4, 0x06, 0xe3, 0x42, 0xdf, 0x18, 0x2e)
+GUID_ENTRY("PPM_PLATFORM_POLICY_PROTOCOL", 0xddabfeac, 0xef63, 0x452C, 0x8f, 0x39, 0xed, 0x7f, 0xae, 0xd8, 0x26, 0x5e)
+GUID_ENTRY("EFI_SD_HOST_IO_PROTOCOL", 0xb63f8ec7, 0xa9c9, 0x4472, 0xa4, 0xc0, 0x4d, 0x8b, 0xf3, 0x65, 0xcc, 0x51)
+GUID_ENTRY("EFI_PCH_INFO_PROTOCOL", 0xd31f0400, 0x7d16, 0x4316, 0xbf, 0x88, 0x60, 0x65, 0x88, 0x3b, 0x40, 0x2b)
+GUID_ENTRY("EFI_PCH_EXTENDED_RESET_PROTOCOL", 0xf0bbfca0, 0x684e, 0x48B3, 0xba, 0xe2, 0x6c, 0x84, 0xb8, 0x9e, 0x53, 0x39)
+GUID_ENTRY("DXE_ICH_PLATFORM_POLICY_PROTOCOL", 0xf617b358, 0x12cf, 0x414A, 0xa0, 0x69, 0x60, 0x67, 0x7b, 0xda, 0x13, 0xb3)
+GUID_ENTRY("EFI_ICH_INFO_PROTOCOL", 0xd31f0400, 0x7d16, 0x4316, 0xbf, 0x88, 0x60, 0x65, 0x88, 0x3b, 0x40, 0x2b)
+GUID_ENTRY("EFI_EMMC_CARD_INFO_PROTOCOL", 0x1ebe5ab9, 0x2129, 0x49E7, 0x84, 0xd7, 0xee, 0xb9, 0xfc, 0xe5, 0xde, 0xdd)
+GUID_ENTRY("EFI_TDT_OPERATION_PROTOCOL", 0xfd301ba4, 0x5e62, 0x4679, 0xa0, 0x6f, 0xe0, 0x9a, 0xab, 0xdd, 0x2a, 0x91)
+GUID_ENTRY("EFI_DFURESULT", 0x14a7c46f, 0xbc02, 0x4047, 0x9f, 0x18, 0xa5, 0xd7, 0x25, 0xd8, 0xbd, 0x19)
+GUID_ENTRY("EFI_CPTOKEN_SPACE", 0x918211ce, 0xa1d2, 0x43A0, 0xa0, 0x4e, 0x75, 0xb5, 0xbf, 0x44, 0x50, 0x0e)
+GUID_ENTRY("EFI_VLVTOKEN_SPACE", 0xca452c68, 0xdf0c, 0x45C9, 0x82, 0xfb, 0xea, 0xe4, 0x2b, 0x31, 0x29, 0x46)
+GUID_ENTRY("DXE_PCH_POLICY_UPDATE_PROTOCOL", 0x1a819e49, 0xd8ee, 0x48CB, 0x9a, 0x9c, 0x0a, 0xa0, 0xd2, 0x81, 0x0a, 0x38)
+GUID_ENTRY("POWER_MANAGEMENT_ACPI_TABLE_STORAGE", 0x161be597, 0xe9c5, 0x49DB, 0xae, 0x50, 0xc4, 0x62, 0xab, 0x54, 0xee, 0xda)
+GUID_ENTRY("VLV_REF_CODE_PKG_TOKEN_SPACE", 0x85768e4a, 0x6cdc, 0x444E, 0x93, 0xdf, 0x93, 0x66, 0x85, 0xb5, 0xdf, 0xcc)
+GUID_ENTRY("SE_CPLATFORM_READY_TO_BOOT", 0x03fdf171, 0x1d67, 0x4ACE, 0xa9, 0x04, 0x3e, 0x36, 0xd3, 0x38, 0xfa, 0x74)
+GUID_ENTRY("EFI_VLV2_VARIABLE", 0x10ba6bbe, 0xa97e, 0x41C3, 0x9a, 0x07, 0x60, 0x7a, 0xd9, 0xbd, 0x60, 0xe5)
@@ -39,153 +39,141 @@
 
 #include <stdint.h>
 
+/* EFI_PEI_PPI_DESCRIPTOR and EFI_PEI_NOTIFY_DESCRIPTOR flags */
+#define EFI_PEI_PPI_DESCRIPTOR_PPI                  0x00000010
+#define EFI_PEI_PPI_DESCRIPTOR_NOTIFY_CALLBACK      0x00000020
+#define EFI_PEI_PPI_DESCRIPTOR_NOTIFY_DISPATCH      0x00000040
+#define EFI_PEI_PPI_DESCRIPTOR_TERMINATE_LIST       0x80000000
+
+/* declared in the table initializers order, GCC wants designated initializers in order */
 struct pei_services_entry
 {
-    char description[1024];
-    char prototype[512];
     char name[256];
     uint32_t offset;
+    char description[1024];
     uint32_t nr_args;
-    uint32_t count;
+    char prototype[512];
 };
 
-struct pei_services_entry
-{
+const struct pei_services_entry pei_services_table[] = {
     {
         .name = "FAILED PEI PPI",
         .offset = 0x0,
         .description = "",
         .nr_args = 1,
-        .prototype = "",
-        .count = 0
+        .prototype = ""
     },
     {
         .name = "InstallPpi",
         .offset = 0x18,
         .description = "This service is the first one provided by the PEI Foundation. This function installs an interface in the PEI PPI database by GUID. The purpose of the service is to publish an interface that other parties can use to call additional PEIMs.",
         .nr_args = 2,
-        .prototype = "EFI_STATUS(EFIAPI * EFI_PEI_INSTALL_PPI) (IN CONST EFI_PEI_SERVICES **PeiServices, IN CONST EFI_PEI_PPI_DESCRIPTOR *PpiList)",
-        .count = 0
+        .prototype = "EFI_STATUS(EFIAPI * EFI_PEI_INSTALL_PPI) (IN CONST EFI_PEI_SERVICES **PeiServices, IN CONST EFI_PEI_PPI_DESCRIPTOR *PpiList)"
     },
     {
         .name = "ReInstallPpi",
         .offset = 0x1C,
         .description = "This function reinstalls an interface in the PEI PPI database by GUID. The purpose of the service is to publish an interface that other parties can use to replace a same-named interface in the protocol database with a different interface.",
         .nr_args = 3,
-        .prototype = "EFI_STATUS(EFIAPI * EFI_PEI_REINSTALL_PPI) (IN CONST EFI_PEI_SERVICES **PeiServices, IN CONST EFI_PEI_PPI_DESCRIPTOR *OldPpi, IN CONST EFI_PEI_PPI_DESCRIPTOR *NewPpi)",
-        .count = 0
+        .prototype = "EFI_STATUS(EFIAPI * EFI_PEI_REINSTALL_PPI) (IN CONST EFI_PEI_SERVICES **PeiServices, IN CONST EFI_PEI_PPI_DESCRIPTOR *OldPpi, IN CONST EFI_PEI_PPI_DESCRIPTOR *NewPpi)"
     },
     {
         .name = "LocatePpi",
         .offset = 0x20,
         .description = "This function locates an interface in the PEI PPI database by GUID.",
         .nr_args = 5,
-        .prototype = "EFI_STATUS(EFIAPI * EFI_PEI_LOCATE_PPI) (IN CONST EFI_PEI_SERVICES **PeiServices, IN CONST EFI_GUID *Guid, IN UINTN Instance, IN OUT EFI_PEI_PPI_DESCRIPTOR **PpiDescriptor OPTIONAL, IN OUT VOID **Ppi)",
-        .count = 0
+        .prototype = "EFI_STATUS(EFIAPI * EFI_PEI_LOCATE_PPI) (IN CONST EFI_PEI_SERVICES **PeiServices, IN CONST EFI_GUID *Guid, IN UINTN Instance, IN OUT EFI_PEI_PPI_DESCRIPTOR **PpiDescriptor OPTIONAL, IN OUT VOID **Ppi)"
     },
     {
         .name = "NotifyPpi",
         .offset = 0x24,
         .description = "This function installs a notification service to be called back when a given interface is installed or reinstalled. The purpose of the service is to publish an interface that other parties can use to call additional PPIs that may materialize later.",
         .nr_args = 2,
-        .prototype = "EFI_STATUS(EFIAPI * EFI_PEI_NOTIFY_PPI) (IN CONST EFI_PEI_SERVICES **PeiServices, IN CONST EFI_PEI_NOTIFY_DESCRIPTOR *NotifyList)",
-        .count = 0
+        .prototype = "EFI_STATUS(EFIAPI * EFI_PEI_NOTIFY_PPI) (IN CONST EFI_PEI_SERVICES **PeiServices, IN CONST EFI_PEI_NOTIFY_DESCRIPTOR *NotifyList)"
     },
     {
         .name = "GetBootMode",
         .offset = 0x28,
         .description = "This function returns the present value of the boot mode.",
         .nr_args = 2,
-        .prototype = "EFI_STATUS(EFIAPI * EFI_PEI_GET_BOOT_MODE) (IN CONST EFI_PEI_SERVICES **PeiServices, OUT EFI_BOOT_MODE *BootMode)",
-        .count = 0
+        .prototype = "EFI_STATUS(EFIAPI * EFI_PEI_GET_BOOT_MODE) (IN CONST EFI_PEI_SERVICES **PeiServices, OUT EFI_BOOT_MODE *BootMode)"
     },
     {
         .name = "SetBootMode",
         .offset = 0x2C,
         .description = "This function sets the value of the boot mode.",
         .nr_args = 2,
-        .prototype = "EFI_STATUS(EFIAPI * EFI_PEI_SET_BOOT_MODE) (IN CONST EFI_PEI_SERVICES **PeiServices, IN EFI_BOOT_MODE BootMode)",
-        .count = 0
+        .prototype = "EFI_STATUS(EFIAPI * EFI_PEI_SET_BOOT_MODE) (IN CONST EFI_PEI_SERVICES **PeiServices, IN EFI_BOOT_MODE BootMode)"
     },
     {
         .name = "GetHobList",
         .offset = 0x30,
         .description = "This function returns the pointer to the list of Hand-Off Blocks (HOBs) in memory.",
         .nr_args = 2,
-        .prototype = "EFI_STATUS(EFIAPI * EFI_PEI_GET_HOB_LIST) (IN CONST EFI_PEI_SERVICES **PeiServices, OUT VOID **HobList)",
-        .count = 0
+        .prototype = "EFI_STATUS(EFIAPI * EFI_PEI_GET_HOB_LIST) (IN CONST EFI_PEI_SERVICES **PeiServices, OUT VOID **HobList)"
     },
     {
         .name = "CreateHob",
         .offset = 0x34,
         .description = "This service, published by the PEI Foundation, abstracts the creation of a Hand-Off Block's (HOB's) headers.",
         .nr_args = 4,
-        .prototype = "EFI_STATUS(EFIAPI * EFI_PEI_CREATE_HOB) (IN CONST EFI_PEI_SERVICES **PeiServices, IN UINT16 Type, IN UINT16 Length, IN OUT VOID **Hob)",
-        .count = 0
+        .prototype = "EFI_STATUS(EFIAPI * EFI_PEI_CREATE_HOB) (IN CONST EFI_PEI_SERVICES **PeiServices, IN UINT16 Type, IN UINT16 Length, IN OUT VOID **Hob)"
     },
     {
         .name = "FfsFindNextVolume",
         .offset = 0x38,
         .description = "The purpose of the service is to abstract the capability of the PEI Foundation to discover instances of firmware volumes in the system. Given the input file pointer, this service searches for the next matching file in the Firmware File System (FFS) volume.",
         .nr_args = 3,
-        .prototype = "EFI_STATUS (EFIAPI *EFI_PEI_FFS_FIND_NEXT_VOLUME) (IN struct _EFI_PEI_SERVICES **PeiServices, IN UINTN Instance, IN OUT EFI_FIRMWARE_VOLUME_HEADER **FwVolHeader)",
-        .count = 0
+        .prototype = "EFI_STATUS (EFIAPI *EFI_PEI_FFS_FIND_NEXT_VOLUME) (IN struct _EFI_PEI_SERVICES **PeiServices, IN UINTN Instance, IN OUT EFI_FIRMWARE_VOLUME_HEADER **FwVolHeader)"
     },
     {
         .name = "FfsFindNextFile",
         .offset = 0x3C,
         .description = "The purpose of the service is to abstract the capability of the PEI Foundation to discover instances of firmware files in the system. Given the input file pointer, this service searches for the next matching file in the Firmware File System (FFS) volume.",
         .nr_args = 4,
-        .prototype = "EFI_STATUS (EFIAPI *EFI_PEI_FFS_FIND_NEXT_FILE) (IN struct _EFI_PEI_SERVICES **PeiServices, IN EFI_FV_FILETYPE SearchType, IN EFI_FIRMWARE_VOLUME_HEADER *FwVolHeader, IN OUT EFI_FFS_FILE_HEADER **FileHeader);",
-        .count = 0
+        .prototype = "EFI_STATUS (EFIAPI *EFI_PEI_FFS_FIND_NEXT_FILE) (IN struct _EFI_PEI_SERVICES **PeiServices, IN EFI_FV_FILETYPE SearchType, IN EFI_FIRMWARE_VOLUME_HEADER *FwVolHeader, IN OUT EFI_FFS_FILE_HEADER **FileHeader);"
     },
     {
         .name = "FfsFindSectionData",
         .offset = 0x40,
         .description = "Given the input file pointer, this service searches for the next matching file in the Firmware File System (FFS) volume.",
         .nr_args = 4,
-        .prototype = "EFI_STATUS (EFIAPI *EFI_PEI_FFS_FIND_SECTION_DATA) (IN struct _EFI_PEI_SERVICES **PeiServices, IN EFI_SECTION_TYPE SectionType, IN EFI_FFS_FILE_HEADER *FfsFileHeader, IN OUT VOID **SectionData);",
-        .count = 0
+        .prototype = "EFI_STATUS (EFIAPI *EFI_PEI_FFS_FIND_SECTION_DATA) (IN struct _EFI_PEI_SERVICES **PeiServices, IN EFI_SECTION_TYPE SectionType, IN EFI_FFS_FILE_HEADER *FfsFileHeader, IN OUT VOID **SectionData);"
     },
     {
         .name = "InstallPeiMemory",
         .offset = 0x44,
         .description = "This function registers the found memory configuration with the PEI Foundation.",
         .nr_args = 3,
-        .prototype = "EFI_STATUS(EFIAPI * EFI_PEI_INSTALL_PEI_MEMORY) (IN CONST EFI_PEI_SERVICES **PeiServices, IN EFI_PHYSICAL_ADDRESS MemoryBegin, IN UINT64 MemoryLength)",
-        .count = 0
+        .prototype = "EFI_STATUS(EFIAPI * EFI_PEI_INSTALL_PEI_MEMORY) (IN CONST EFI_PEI_SERVICES **PeiServices, IN EFI_PHYSICAL_ADDRESS MemoryBegin, IN UINT64 MemoryLength)"
     },
     {
         .name = "AllocatePages",
         .offset = 0x48,
         .description = "The purpose of the service is to publish an interface that allows PEIMs to allocate memory ranges that are managed by the PEI Foundation.",
         .nr_args = 4,
-        .prototype = "EFI_STATUS(EFIAPI * EFI_PEI_ALLOCATE_PAGES) (IN CONST EFI_PEI_SERVICES **PeiServices, IN EFI_MEMORY_TYPE MemoryType, IN UINTN Pages, OUT EFI_PHYSICAL_ADDRESS *Memory)",
-        .count = 0
+        .prototype = "EFI_STATUS(EFIAPI * EFI_PEI_ALLOCATE_PAGES) (IN CONST EFI_PEI_SERVICES **PeiServices, IN EFI_MEMORY_TYPE MemoryType, IN UINTN Pages, OUT EFI_PHYSICAL_ADDRESS *Memory)"
     },
     {
         .name = "AllocatePool",
         .offset = 0x4C,
         .description = "The purpose of this service is to publish an interface that allows PEIMs to allocate memory ranges that are managed by the PEI Foundation.",
         .nr_args = 3,
-        .prototype = " EFI_STATUS(EFIAPI * EFI_PEI_ALLOCATE_POOL) (IN CONST EFI_PEI_SERVICES **PeiServices, IN UINTN Size, OUT VOID **Buffer)",
-        .count = 0
+        .prototype = " EFI_STATUS(EFIAPI * EFI_PEI_ALLOCATE_POOL) (IN CONST EFI_PEI_SERVICES **PeiServices, IN UINTN Size, OUT VOID **Buffer)"
     },
     {
         .name = "CopyMem",
         .offset = 0x50,
         .description = "This service copies the contents of one buffer to another buffer.",
         .nr_args = 3,
-        .prototype = "VOID(EFIAPI * EFI_PEI_COPY_MEM) (IN VOID *Destination, IN VOID *Source, IN UINTN Length)",
-        .count = 0
+        .prototype = "VOID(EFIAPI * EFI_PEI_COPY_MEM) (IN VOID *Destination, IN VOID *Source, IN UINTN Length)"
     },
     {
         .name = "SetMem",
         .offset = 0x54,
         .description = "The service fills a buffer with a specified value.",
         .nr_args = 3,
-        .prototype = "VOID(EFIAPI * EFI_PEI_SET_MEM) (IN VOID *Buffer, IN UINTN Size, IN UINT8 Value)",
-        .count = 0
+        .prototype = "VOID(EFIAPI * EFI_PEI_SET_MEM) (IN VOID *Buffer, IN UINTN Size, IN UINT8 Value)"
     },
     {
         .name = "ReportStatusCode",
@@ -193,8 +181,7 @@ struct pei_services_entry
         .description = "This service publishes an interface that allows PEIMs to report status codes. \
         ReportStatusCode() is called by PEIMs that wish to report status information on their progress. The principal use model is for a PEIM to emit one of the standard 32-bit error codes. This will allow a platform owner to ascertain the state of the system, especially under conditions where the full consoles might not have been installed.",
         .nr_args = 6,
-        .prototype = "EFI_STATUS(EFIAPI * EFI_PEI_REPORT_STATUS_CODE) (IN CONST EFI_PEI_SERVICES **PeiServices, IN EFI_STATUS_CODE_TYPE Type, IN EFI_STATUS_CODE_VALUE Value, IN UINT32 Instance, IN CONST EFI_GUID *CallerId OPTIONAL, IN CONST EFI_STATUS_CODE_DATA *Data OPTIONAL)",
-        .count = 0
+        .prototype = "EFI_STATUS(EFIAPI * EFI_PEI_REPORT_STATUS_CODE) (IN CONST EFI_PEI_SERVICES **PeiServices, IN EFI_STATUS_CODE_TYPE Type, IN EFI_STATUS_CODE_VALUE Value, IN UINT32 Instance, IN CONST EFI_GUID *CallerId OPTIONAL, IN CONST EFI_STATUS_CODE_DATA *Data OPTIONAL)"
     },
     {
         .name = "ResetSystem",
@@ -202,32 +189,28 @@ struct pei_services_entry
         .description = "Resets the entire platform. \
         This service resets the entire platform, including all processors and devices, and reboots the system. This service will never return EFI_SUCCESS.",
         .nr_args = 1,
-        .prototype = "EFI_STATUS(EFIAPI * EFI_PEI_RESET_SYSTEM) (IN CONST EFI_PEI_SERVICES **PeiServices)",
-        .count = 0
+        .prototype = "EFI_STATUS(EFIAPI * EFI_PEI_RESET_SYSTEM) (IN CONST EFI_PEI_SERVICES **PeiServices)"
     },
     {
         .name = "CpuIo",
         .offset = 0x60,
         .description = "Provides an interface that a PEIM can call to execute an I/O transaction. This service is installed by an architectural PEI driver by copying the interface pointer into this table.",
         .nr_args = 1,
-        .prototype = "",
-        .count = 0
+        .prototype = ""
     },
     {
         .name = "PciCfg",
         .offset = 0x64,
         .description = "Provides an interface that a PEIM can call to execute PCI Configuration transactions. This service is installed by an architectural PEI driver by copying the interface pointer into this table.",
         .nr_args = 1,
-        .prototype = "",
-        .count = 0
+        .prototype = ""
     },
     {
         .name = "EMPTY PPI",
         .offset = 0x0,
         .description = "",
         .nr_args = 1,
-        .prototype = "",
-        .count = 0
+        .prototype = ""
     }
     
 };
@@ -39,12 +39,15 @@
 
 #include <stdint.h>
 
+/* declared in the tables initializers order, GCC wants designated initializers in order */
 struct services_entry
 {
-    char parameters[2048];
+    char name[256];
+    uint32_t offset;
     char description[1024];
+    uint32_t nr_args;
     char prototype[512];
-    char name[256];
+    char parameters[2048];
     char rcx_param[256];
     char rdx_param[256];
     char r8_param[256];
@@ -53,16 +56,13 @@ struct services_entry
     char stack2_param[256];
     char stack3_param[256];
     char stack4_param[256];
-    uint32_t offset;
-    uint32_t nr_args;
-    uint32_t count;
 };
 
 #pragma mark -
 #pragma mark Boot Services Table
 #pragma mark -
 
-struct services_entry boot_services_table[] = {
+const struct services_entry boot_services_table[] = {
     {
         .name = "FAILED BOOT SERVICE",
         .offset = 0x0,
@@ -77,8 +77,7 @@ struct services_entry boot_services_table[] = {
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "RaiseTPL",
@@ -94,8 +93,7 @@ struct services_entry boot_services_table[] = {
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "RestoreTPL",
@@ -111,8 +109,7 @@ struct services_entry boot_services_table[] = {
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "AllocatePages",
@@ -131,8 +128,7 @@ Memory      The pointer to a physical address. On input, the way in which the ad
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "FreePages",
@@ -149,8 +145,7 @@ Pages	The number of contiguous 4 KB pages to free.",
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "GetMemoryMap",
@@ -172,8 +167,7 @@ DescriptorVersion	A pointer to the location in which firmware returns the versio
         .stack1_param = "OUT UINT32 *DescriptorVersion",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "AllocatePool",
@@ -191,8 +185,7 @@ Buffer      A pointer to a pointer to the allocated buffer if the call succeeds;
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "FreePool",
@@ -208,8 +201,7 @@ Buffer      A pointer to a pointer to the allocated buffer if the call succeeds;
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "CreateEvent",
@@ -229,8 +221,7 @@ Event           The pointer to the newly created event if the call succeeds; und
         .stack1_param = "OUT EFI_EVENT *Event",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "SetTimer",
@@ -248,8 +239,7 @@ TriggerTime	The number of 100ns units until the timer expires. A TriggerTime of
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "WaitForEvent",
@@ -267,8 +257,7 @@ Index           The pointer to the index of the event which satisfied the wait c
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "SignalEvent",
@@ -284,8 +273,7 @@ Index           The pointer to the index of the event which satisfied the wait c
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "CloseEvent",
@@ -301,8 +289,7 @@ Index           The pointer to the index of the event which satisfied the wait c
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "CheckEvent",
@@ -318,8 +305,7 @@ Index           The pointer to the index of the event which satisfied the wait c
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "InstallProtocolInterface",
@@ -338,8 +324,7 @@ Interface       A pointer to the protocol interface.",
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "ReinstallProtocolInterface",
@@ -358,8 +343,7 @@ NewInterface	A pointer to the new interface.",
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "UninstallProtocolInterface",
@@ -377,8 +361,7 @@ Interface	A pointer to the interface.",
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "HandleProtocol",
@@ -396,8 +379,7 @@ Interface	Supplies the address where a pointer to the corresponding Protocol Int
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "Reserved",
@@ -413,8 +395,7 @@ Interface	Supplies the address where a pointer to the corresponding Protocol Int
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "RegisterProtocolNotify",
@@ -432,8 +413,7 @@ Registration	A pointer to a memory location to receive the registration value.",
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "LocateHandle",
@@ -453,8 +433,7 @@ Buffer      The buffer in which the array is returned.",
         .stack1_param = "OUT EFI_HANDLE *Buffer",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "LocateDevicePath",
@@ -472,8 +451,7 @@ Device      A pointer to the returned device handle.",
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "InstallConfigurationTable",
@@ -490,8 +468,7 @@ Table	A pointer to the configuration table for the entry to add, update, or remo
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "LoadImage",
@@ -512,8 +489,7 @@ ImageHandle     The pointer to the returned image handle that is created when th
         .stack1_param = "IN UINTN SourceSize",
         .stack2_param = "OUT EFI_HANDLE *ImageHandle",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "StartImage",
@@ -531,8 +507,7 @@ ExitData        The pointer to a pointer to a data buffer that includes a Null-t
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "Exit",
@@ -551,8 +526,7 @@ ExitData        The pointer to a data buffer that includes a Null-terminated str
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "UnloadImage",
@@ -568,8 +542,7 @@ ExitData        The pointer to a data buffer that includes a Null-terminated str
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "ExitBootServices",
@@ -586,8 +559,7 @@ MapKey      Key to the latest memory map.",
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "GetNextMonotonicCount",
@@ -603,8 +575,7 @@ MapKey      Key to the latest memory map.",
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "Stall",
@@ -620,8 +591,7 @@ MapKey      Key to the latest memory map.",
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "SetWatchdogTimer",
@@ -640,8 +610,7 @@ WatchdogData    A data buffer that includes a Null-terminated string, optionally
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "ConnectController",
@@ -660,8 +629,7 @@ Recursive           If TRUE, then ConnectController() is called recursively unti
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "DisconnectController",
@@ -679,8 +647,7 @@ ChildHandle         The handle of the child to destroy. If ChildHandle is NULL,
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "OpenProtocol",
@@ -701,8 +668,7 @@ Attributes          The open mode of the protocol interface specified by Handle
         .stack1_param = "IN EFI_HANDLE ControllerHandle",
         .stack2_param = "IN UINT32 Attributes",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "CloseProtocol",
@@ -721,8 +687,7 @@ ControllerHandle	If the agent that opened a protocol is a driver that follows th
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "OpenProtocolInformation",
@@ -741,8 +706,7 @@ EntryCount	A pointer to the number of entries in EntryBuffer.",
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "ProtocolsPerHandle",
@@ -760,8 +724,7 @@ ProtocolBufferCount	A pointer to the number of GUID pointers present in Protocol
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "LocateHandleBuffer",
@@ -781,8 +744,7 @@ Buffer	A pointer to the buffer to return the requested array of handles that sup
         .stack1_param = "OUT EFI_HANDLE **Buffer",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "LocateProtocol",
@@ -800,44 +762,41 @@ Interface       On return, a pointer to the first interface that matches Protoco
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "InstallMultipleProtocolInterfaces",
         .offset = 0x148,
         .description = "Installs one or more protocol interfaces into the boot services environment.",
-        .nr_args = 1,
+        .nr_args = 3,
         .prototype = "EFI_STATUS(EFIAPI * EFI_INSTALL_MULTIPLE_PROTOCOL_INTERFACES) (IN OUT EFI_HANDLE *Handle,...)",
         .parameters = "Handle	The pointer to a handle to install the new protocol interfaces on, or a pointer to NULL if a new handle is to be allocated.\n\
 ...     A variable argument list containing pairs of protocol GUIDs and protocol interfaces.",
         .rcx_param = "IN OUT EFI_HANDLE *Handle",
-        .rdx_param = "",
-        .r8_param = "",
+        .rdx_param = "IN EFI_GUID *Protocol",
+        .r8_param = "IN VOID *Interface",
         .r9_param = "",
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "UninstallMultipleProtocolInterfaces",
         .offset = 0x150,
         .description = "Removes one or more protocol interfaces into the boot services environment.",
-        .nr_args = 1,
+        .nr_args = 3,
         .prototype = "EFI_STATUS(EFIAPI * EFI_UNINSTALL_MULTIPLE_PROTOCOL_INTERFACES) (IN EFI_HANDLE Handle,...)",
         .parameters = "Handle	The handle to remove the protocol interfaces from.\n\
 ...     A variable argument list containing pairs of protocol GUIDs and protocol interfaces.",
         .rcx_param = "IN EFI_HANDLE Handle",
-        .rdx_param = "",
-        .r8_param = "",
+        .rdx_param = "IN EFI_GUID *Protocol",
+        .r8_param = "IN VOID *Interface",
         .r9_param = "",
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "CalculateCrc32",
@@ -855,8 +814,7 @@ Crc32       The 32-bit CRC that was computed for the data buffer specified by Da
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "CopyMem",
@@ -874,8 +832,7 @@ Length      Number of bytes to copy from Source to Destination.",
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "SetMem",
@@ -893,8 +850,7 @@ Value	Value to fill Buffer with.",
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "CreateEventEx",
@@ -915,8 +871,7 @@ Event           The pointer to the newly created event if the call succeeds; und
         .stack1_param = "IN CONST EFI_GUID *EventGroup OPTIONAL",
         .stack2_param = "OUT EFI_EVENT *Event",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "EMPTY SERVICE",
@@ -932,8 +887,7 @@ Event           The pointer to the newly created event if the call succeeds; und
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     }
 };
 
@@ -941,7 +895,7 @@ Event           The pointer to the newly created event if the call succeeds; und
 #pragma mark RunTime Services Table
 #pragma mark -
 
-struct services_entry runtime_services_table[] = {
+const struct services_entry runtime_services_table[] = {
     {
         .name = "FAILED RUNTIME SERVICE",
         .offset = 0x0,
@@ -956,8 +910,7 @@ struct services_entry runtime_services_table[] = {
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "GetTime",
@@ -974,8 +927,7 @@ Capabilities	An optional pointer to a buffer to receive the real time clock devi
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "SetTime",
@@ -991,8 +943,7 @@ Capabilities	An optional pointer to a buffer to receive the real time clock devi
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "GetWakeupTime",
@@ -1010,8 +961,7 @@ Time	The current alarm setting.",
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "SetWakeupTime",
@@ -1028,8 +978,7 @@ Time	If Enable is TRUE, the time to set the wakeup alarm for. If Enable is FALSE
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "SetVirtualAddressMap",
@@ -1048,8 +997,7 @@ VirtualMap          An array of memory descriptors which contain new virtual add
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "ConvertPointer",
@@ -1066,8 +1014,7 @@ Address             A pointer to a pointer that is to be fixed to be the value n
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "GetVariable",
@@ -1087,8 +1034,7 @@ Data            The buffer to return the contents of the variable.",
         .stack1_param = "OUT VOID *Data",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "GetNextVariableName",
@@ -1106,8 +1052,7 @@ VendorGuid          On input, supplies the last VendorGuid that was returned by
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "SetVariable",
@@ -1127,8 +1072,7 @@ Data            The contents for the variable.",
         .stack1_param = "IN VOID *Data",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "GetNextHighMonotonicCount",
@@ -1144,8 +1088,7 @@ Data            The contents for the variable.",
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "ResetSystem",
@@ -1164,8 +1107,7 @@ ResetData	For a ResetType of EfiResetCold, EfiResetWarm, or EfiResetShutdown the
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "UpdateCapsule",
@@ -1183,8 +1125,7 @@ ScatterGatherList	Physical pointer to a set of EFI_CAPSULE_BLOCK_DESCRIPTOR that
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "QueryCapsuleCapabilities",
@@ -1203,8 +1144,7 @@ ResetType           Returns the type of reset required for the capsule update.",
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     },
     {
         .name = "QueryVariableInfo",
@@ -1223,8 +1163,397 @@ MaximumVariableSize             Returns the maximum size of the individual EFI v
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
+    },
+    {
+        .name = "EMPTY SERVICE",
+        .offset = 0x0,
+        .description = "",
+        .nr_args = 1,
+        .prototype = "",
+        .parameters = "",
+        .rcx_param = "",
+        .rdx_param = "",
+        .r8_param = "",
+        .r9_param = "",
+        .stack1_param = "",
+        .stack2_param = "",
+        .stack3_param = "",
+        .stack4_param = ""
+    }
+};
+
+#pragma mark -
+#pragma mark SMM Services Table
+#pragma mark -
+
+const struct services_entry smm_services_table[] = {
+    {
+        .name = "FAILED SMM SERVICE",
+        .offset = 0x0,
+        .description = "",
+        .nr_args = 1,
+        .prototype = "",
+        .parameters = "",
+        .rcx_param = "",
+        .rdx_param = "",
+        .r8_param = "",
+        .r9_param = "",
+        .stack1_param = "",
+        .stack2_param = "",
+        .stack3_param = "",
+        .stack4_param = ""
+    },
+    {
+        .name = "SmmInstallConfigurationTable",
+        .offset = 0x28,
+        .description = "Adds, updates, or removes a configuration table entry from the System Management System Table.",
+        .nr_args = 4,
+        .prototype = "EFI_STATUS(EFIAPI * EFI_SMM_INSTALL_CONFIGURATION_TABLE2) (IN CONST EFI_SMM_SYSTEM_TABLE2 *SystemTable, IN CONST EFI_GUID *Guid, IN VOID *Table, IN UINTN TableSize)",
+        .parameters = "SystemTable     A pointer to the System Management System Table (SMST).\n\
+Guid            A pointer to the GUID for the entry to add, update, or remove.\n\
+Table           A pointer to the buffer of the table to add.\n\
+TableSize       The size of the table to install.",
+        .rcx_param = "IN CONST EFI_SMM_SYSTEM_TABLE2 *SystemTable",
+        .rdx_param = "IN CONST EFI_GUID *Guid",
+        .r8_param = "IN VOID *Table",
+        .r9_param = "IN UINTN TableSize",
+        .stack1_param = "",
+        .stack2_param = "",
+        .stack3_param = "",
+        .stack4_param = ""
+    },
+    {
+        .name = "SmmIo.Mem.Read",
+        .offset = 0x30,
+        .description = "Reads from memory space.",
+        .nr_args = 5,
+        .prototype = "EFI_STATUS(EFIAPI * EFI_SMM_CPU_IO2) (IN CONST EFI_SMM_CPU_IO2_PROTOCOL *This, IN EFI_SMM_IO_WIDTH Width, IN UINT64 Address, IN UINTN Count, IN OUT VOID *Buffer)",
+        .parameters = "This            The EFI_SMM_CPU_IO2_PROTOCOL instance.\n\
+Width           Signifies the width of the I/O operations.\n\
+Address         The base address of the I/O operations.\n\
+Count           The number of I/O operations to perform.\n\
+Buffer          For read operations, the destination buffer to store the results.",
+        .rcx_param = "IN CONST EFI_SMM_CPU_IO2_PROTOCOL *This",
+        .rdx_param = "IN EFI_SMM_IO_WIDTH Width",
+        .r8_param = "IN UINT64 Address",
+        .r9_param = "IN UINTN Count",
+        .stack1_param = "IN OUT VOID *Buffer",
+        .stack2_param = "",
+        .stack3_param = "",
+        .stack4_param = ""
+    },
+    {
+        .name = "SmmIo.Mem.Write",
+        .offset = 0x38,
+        .description = "Writes to memory space.",
+        .nr_args = 5,
+        .prototype = "EFI_STATUS(EFIAPI * EFI_SMM_CPU_IO2) (IN CONST EFI_SMM_CPU_IO2_PROTOCOL *This, IN EFI_SMM_IO_WIDTH Width, IN UINT64 Address, IN UINTN Count, IN OUT VOID *Buffer)",
+        .parameters = "This            The EFI_SMM_CPU_IO2_PROTOCOL instance.\n\
+Width           Signifies the width of the I/O operations.\n\
+Address         The base address of the I/O operations.\n\
+Count           The number of I/O operations to perform.\n\
+Buffer          For write operations, the source buffer from which to write data.",
+        .rcx_param = "IN CONST EFI_SMM_CPU_IO2_PROTOCOL *This",
+        .rdx_param = "IN EFI_SMM_IO_WIDTH Width",
+        .r8_param = "IN UINT64 Address",
+        .r9_param = "IN UINTN Count",
+        .stack1_param = "IN OUT VOID *Buffer",
+        .stack2_param = "",
+        .stack3_param = "",
+        .stack4_param = ""
+    },
+    {
+        .name = "SmmIo.Io.Read",
+        .offset = 0x40,
+        .description = "Reads from I/O space.",
+        .nr_args = 5,
+        .prototype = "EFI_STATUS(EFIAPI * EFI_SMM_CPU_IO2) (IN CONST EFI_SMM_CPU_IO2_PROTOCOL *This, IN EFI_SMM_IO_WIDTH Width, IN UINT64 Address, IN UINTN Count, IN OUT VOID *Buffer)",
+        .parameters = "This            The EFI_SMM_CPU_IO2_PROTOCOL instance.\n\
+Width           Signifies the width of the I/O operations.\n\
+Address         The base address of the I/O operations.\n\
+Count           The number of I/O operations to perform.\n\
+Buffer          For read operations, the destination buffer to store the results.",
+        .rcx_param = "IN CONST EFI_SMM_CPU_IO2_PROTOCOL *This",
+        .rdx_param = "IN EFI_SMM_IO_WIDTH Width",
+        .r8_param = "IN UINT64 Address",
+        .r9_param = "IN UINTN Count",
+        .stack1_param = "IN OUT VOID *Buffer",
+        .stack2_param = "",
+        .stack3_param = "",
+        .stack4_param = ""
+    },
+    {
+        .name = "SmmIo.Io.Write",
+        .offset = 0x48,
+        .description = "Writes to I/O space.",
+        .nr_args = 5,
+        .prototype = "EFI_STATUS(EFIAPI * EFI_SMM_CPU_IO2) (IN CONST EFI_SMM_CPU_IO2_PROTOCOL *This, IN EFI_SMM_IO_WIDTH Width, IN UINT64 Address, IN UINTN Count, IN OUT VOID *Buffer)",
+        .parameters = "This            The EFI_SMM_CPU_IO2_PROTOCOL instance.\n\
+Width           Signifies the width of the I/O operations.\n\
+Address         The base address of the I/O operations.\n\
+Count           The number of I/O operations to perform.\n\
+Buffer          For write operations, the source buffer from which to write data.",
+        .rcx_param = "IN CONST EFI_SMM_CPU_IO2_PROTOCOL *This",
+        .rdx_param = "IN EFI_SMM_IO_WIDTH Width",
+        .r8_param = "IN UINT64 Address",
+        .r9_param = "IN UINTN Count",
+        .stack1_param = "IN OUT VOID *Buffer",
+        .stack2_param = "",
+        .stack3_param = "",
+        .stack4_param = ""
+    },
+    {
+        .name = "SmmAllocatePool",
+        .offset = 0x50,
+        .description = "Allocates pool memory from SMRAM.",
+        .nr_args = 3,
+        .prototype = "EFI_STATUS(EFIAPI * EFI_ALLOCATE_POOL) (IN EFI_MEMORY_TYPE PoolType, IN UINTN Size, OUT VOID **Buffer)",
+        .parameters = "PoolType        The type of pool to allocate.\n\
+Size            The number of bytes to allocate from the pool.\n\
+Buffer          A pointer to a pointer to the allocated buffer if the call succeeds; undefined otherwise.",
+        .rcx_param = "IN EFI_MEMORY_TYPE PoolType",
+        .rdx_param = "IN UINTN Size",
+        .r8_param = "OUT VOID **Buffer",
+        .r9_param = "",
+        .stack1_param = "",
+        .stack2_param = "",
+        .stack3_param = "",
+        .stack4_param = ""
+    },
+    {
+        .name = "SmmFreePool",
+        .offset = 0x58,
+        .description = "Returns pool memory to SMRAM.",
+        .nr_args = 1,
+        .prototype = "EFI_STATUS(EFIAPI * EFI_FREE_POOL) (IN VOID *Buffer)",
+        .parameters = "Buffer          Pointer to the buffer to free.",
+        .rcx_param = "IN VOID *Buffer",
+        .rdx_param = "",
+        .r8_param = "",
+        .r9_param = "",
+        .stack1_param = "",
+        .stack2_param = "",
+        .stack3_param = "",
+        .stack4_param = ""
+    },
+    {
+        .name = "SmmAllocatePages",
+        .offset = 0x60,
+        .description = "Allocates pages from SMRAM.",
+        .nr_args = 4,
+        .prototype = "EFI_STATUS(EFIAPI * EFI_ALLOCATE_PAGES) (IN EFI_ALLOCATE_TYPE Type, IN EFI_MEMORY_TYPE MemoryType, IN UINTN Pages, IN OUT EFI_PHYSICAL_ADDRESS *Memory)",
+        .parameters = "Type            The type of allocation to perform.\n\
+MemoryType      The type of memory to allocate.\n\
+Pages           The number of contiguous 4 KiB pages to allocate.\n\
+Memory          Pointer to a physical address.",
+        .rcx_param = "IN EFI_ALLOCATE_TYPE Type",
+        .rdx_param = "IN EFI_MEMORY_TYPE MemoryType",
+        .r8_param = "IN UINTN Pages",
+        .r9_param = "IN OUT EFI_PHYSICAL_ADDRESS *Memory",
+        .stack1_param = "",
+        .stack2_param = "",
+        .stack3_param = "",
+        .stack4_param = ""
+    },
+    {
+        .name = "SmmFreePages",
+        .offset = 0x68,
+        .description = "Returns pages to SMRAM.",
+        .nr_args = 2,
+        .prototype = "EFI_STATUS(EFIAPI * EFI_FREE_PAGES) (IN EFI_PHYSICAL_ADDRESS Memory, IN UINTN Pages)",
+        .parameters = "Memory          The base physical address of the pages to be freed.\n\
+Pages           The number of contiguous 4 KiB pages to free.",
+        .rcx_param = "IN EFI_PHYSICAL_ADDRESS Memory",
+        .rdx_param = "IN UINTN Pages",
+        .r8_param = "",
+        .r9_param = "",
+        .stack1_param = "",
+        .stack2_param = "",
+        .stack3_param = "",
+        .stack4_param = ""
+    },
+    {
+        .name = "SmmStartupThisAp",
+        .offset = 0x70,
+        .description = "Initiates a procedure on a specific application processor.",
+        .nr_args = 3,
+        .prototype = "EFI_STATUS(EFIAPI * EFI_SMM_STARTUP_THIS_AP) (IN EFI_AP_PROCEDURE Procedure, IN UINTN CpuNumber, IN OUT VOID *ProcArguments OPTIONAL)",
+        .parameters = "Procedure       A pointer to the code stream to be run on the designated AP of the system.\n\
+CpuNumber       The zero-based index of the processor number of the AP on which the code stream is supposed to run.\n\
+ProcArguments   Allows the caller to pass a list of parameters to the code that is run by the AP.",
+        .rcx_param = "IN EFI_AP_PROCEDURE Procedure",
+        .rdx_param = "IN UINTN CpuNumber",
+        .r8_param = "IN OUT VOID *ProcArguments OPTIONAL",
+        .r9_param = "",
+        .stack1_param = "",
+        .stack2_param = "",
+        .stack3_param = "",
+        .stack4_param = ""
+    },
+    {
+        .name = "SmmInstallProtocolInterface",
+        .offset = 0xA8,
+        .description = "Installs a protocol interface on a device handle in the SMM handle database.",
+        .nr_args = 4,
+        .prototype = "EFI_STATUS(EFIAPI * EFI_INSTALL_PROTOCOL_INTERFACE) (IN OUT EFI_HANDLE *Handle, IN EFI_GUID *Protocol, IN EFI_INTERFACE_TYPE InterfaceType, IN VOID *Interface)",
+        .parameters = "Handle          A pointer to the EFI_HANDLE on which the interface is to be installed.\n\
+Protocol        The numeric ID of the protocol interface.\n\
+InterfaceType   Indicates whether Interface is supplied in native form.\n\
+Interface       A pointer to the protocol interface.",
+        .rcx_param = "IN OUT EFI_HANDLE *Handle",
+        .rdx_param = "IN EFI_GUID *Protocol",
+        .r8_param = "IN EFI_INTERFACE_TYPE InterfaceType",
+        .r9_param = "IN VOID *Interface",
+        .stack1_param = "",
+        .stack2_param = "",
+        .stack3_param = "",
+        .stack4_param = ""
+    },
+    {
+        .name = "SmmUninstallProtocolInterface",
+        .offset = 0xB0,
+        .description = "Removes a protocol interface from a device handle in the SMM handle database.",
+        .nr_args = 3,
+        .prototype = "EFI_STATUS(EFIAPI * EFI_UNINSTALL_PROTOCOL_INTERFACE) (IN EFI_HANDLE Handle, IN EFI_GUID *Protocol, IN VOID *Interface)",
+        .parameters = "Handle          The handle on which the interface was installed.\n\
+Protocol        The numeric ID of the interface.\n\
+Interface       A pointer to the interface.",
+        .rcx_param = "IN EFI_HANDLE Handle",
+        .rdx_param = "IN EFI_GUID *Protocol",
+        .r8_param = "IN VOID *Interface",
+        .r9_param = "",
+        .stack1_param = "",
+        .stack2_param = "",
+        .stack3_param = "",
+        .stack4_param = ""
+    },
+    {
+        .name = "SmmHandleProtocol",
+        .offset = 0xB8,
+        .description = "Queries a handle to determine if it supports a specified protocol.",
+        .nr_args = 3,
+        .prototype = "EFI_STATUS(EFIAPI * EFI_HANDLE_PROTOCOL) (IN EFI_HANDLE Handle, IN EFI_GUID *Protocol, OUT VOID **Interface)",
+        .parameters = "Handle          The handle being queried.\n\
+Protocol        The published unique identifier of the protocol.\n\
+Interface       Supplies the address where a pointer to the corresponding Protocol Interface is returned.",
+        .rcx_param = "IN EFI_HANDLE Handle",
+        .rdx_param = "IN EFI_GUID *Protocol",
+        .r8_param = "OUT VOID **Interface",
+        .r9_param = "",
+        .stack1_param = "",
+        .stack2_param = "",
+        .stack3_param = "",
+        .stack4_param = ""
+    },
+    {
+        .name = "SmmRegisterProtocolNotify",
+        .offset = 0xC0,
+        .description = "Registers a callback function to be called when a protocol interface is installed in the SMM handle database.",
+        .nr_args = 3,
+        .prototype = "EFI_STATUS(EFIAPI * EFI_SMM_REGISTER_PROTOCOL_NOTIFY) (IN CONST EFI_GUID *Protocol, IN EFI_SMM_NOTIFY_FN Function, OUT VOID **Registration)",
+        .parameters = "Protocol        The unique ID of the protocol for which the event is to be registered.\n\
+Function        Points to the notification function.\n\
+Registration    A pointer to a memory location to receive the registration value.",
+        .rcx_param = "IN CONST EFI_GUID *Protocol",
+        .rdx_param = "IN EFI_SMM_NOTIFY_FN Function",
+        .r8_param = "OUT VOID **Registration",
+        .r9_param = "",
+        .stack1_param = "",
+        .stack2_param = "",
+        .stack3_param = "",
+        .stack4_param = ""
+    },
+    {
+        .name = "SmmLocateHandle",
+        .offset = 0xC8,
+        .description = "Returns an array of handles in the SMM handle database that support a specified protocol.",
+        .nr_args = 5,
+        .prototype = "EFI_STATUS(EFIAPI * EFI_LOCATE_HANDLE) (IN EFI_LOCATE_SEARCH_TYPE SearchType, IN EFI_GUID *Protocol OPTIONAL, IN VOID *SearchKey OPTIONAL, IN OUT UINTN *BufferSize, OUT EFI_HANDLE *Buffer)",
+        .parameters = "SearchType      Specifies which handle(s) are to be returned.\n\
+Protocol        Specifies the protocol to search by.\n\
+SearchKey       Specifies the search key.\n\
+BufferSize      On input, the size in bytes of Buffer. On output, the size in bytes of the array returned in Buffer or the size needed to obtain the array.\n\
+Buffer          The buffer in which the array is returned.",
+        .rcx_param = "IN EFI_LOCATE_SEARCH_TYPE SearchType",
+        .rdx_param = "IN EFI_GUID *Protocol OPTIONAL",
+        .r8_param = "IN VOID *SearchKey OPTIONAL",
+        .r9_param = "IN OUT UINTN *BufferSize",
+        .stack1_param = "OUT EFI_HANDLE *Buffer",
+        .stack2_param = "",
+        .stack3_param = "",
+        .stack4_param = ""
+    },
+    {
+        .name = "SmmLocateProtocol",
+        .offset = 0xD0,
+        .description = "Returns the first SMM protocol instance that matches the given protocol.",
+        .nr_args = 3,
+        .prototype = "EFI_STATUS(EFIAPI * EFI_LOCATE_PROTOCOL) (IN EFI_GUID *Protocol, IN VOID *Registration OPTIONAL, OUT VOID **Interface)",
+        .parameters = "Protocol        Provides the protocol to search for.\n\
+Registration    Optional registration key returned from SmmRegisterProtocolNotify().\n\
+Interface       On return, a pointer to the first interface that matches Protocol and Registration.",
+        .rcx_param = "IN EFI_GUID *Protocol",
+        .rdx_param = "IN VOID *Registration OPTIONAL",
+        .r8_param = "OUT VOID **Interface",
+        .r9_param = "",
+        .stack1_param = "",
+        .stack2_param = "",
+        .stack3_param = "",
+        .stack4_param = ""
+    },
+    {
+        .name = "SmiManage",
+        .offset = 0xD8,
+        .description = "Manages SMI of a particular type.",
+        .nr_args = 4,
+        .prototype = "EFI_STATUS(EFIAPI * EFI_SMM_INTERRUPT_MANAGE) (IN CONST EFI_GUID *HandlerType, IN CONST VOID *Context OPTIONAL, IN OUT VOID *CommBuffer OPTIONAL, IN OUT UINTN *CommBufferSize OPTIONAL)",
+        .parameters = "HandlerType     Points to the handler type or NULL for root SMI handlers.\n\
+Context         Points to an optional context buffer.\n\
+CommBuffer      Points to the optional communication buffer.\n\
+CommBufferSize  Points to the size of the optional communication buffer.",
+        .rcx_param = "IN CONST EFI_GUID *HandlerType",
+        .rdx_param = "IN CONST VOID *Context OPTIONAL",
+        .r8_param = "IN OUT VOID *CommBuffer OPTIONAL",
+        .r9_param = "IN OUT UINTN *CommBufferSize OPTIONAL",
+        .stack1_param = "",
+        .stack2_param = "",
+        .stack3_param = "",
+        .stack4_param = ""
+    },
+    {
+        .name = "SmiHandlerRegister",
+        .offset = 0xE0,
+        .description = "Registers a handler to execute within SMM.",
+        .nr_args = 3,
+        .prototype = "EFI_STATUS(EFIAPI * EFI_SMM_INTERRUPT_REGISTER) (IN EFI_SMM_HANDLER_ENTRY_POINT2 Handler, IN CONST EFI_GUID *HandlerType OPTIONAL, OUT EFI_HANDLE *DispatchHandle)",
+        .parameters = "Handler         Handler service function pointer.\n\
+HandlerType     Points to the handler type or NULL for root SMI handlers.\n\
+DispatchHandle  On return, contains a unique handle which can be used to later unregister the handler function.",
+        .rcx_param = "IN EFI_SMM_HANDLER_ENTRY_POINT2 Handler",
+        .rdx_param = "IN CONST EFI_GUID *HandlerType OPTIONAL",
+        .r8_param = "OUT EFI_HANDLE *DispatchHandle",
+        .r9_param = "",
+        .stack1_param = "",
+        .stack2_param = "",
+        .stack3_param = "",
+        .stack4_param = ""
+    },
+    {
+        .name = "SmiHandlerUnRegister",
+        .offset = 0xE8,
+        .description = "Unregister a handler in SMM.",
+        .nr_args = 1,
+        .prototype = "EFI_STATUS(EFIAPI * EFI_SMM_INTERRUPT_UNREGISTER) (IN EFI_HANDLE DispatchHandle)",
+        .parameters = "DispatchHandle  The handle that was specified when the handler was registered.",
+        .rcx_param = "IN EFI_HANDLE DispatchHandle",
+        .rdx_param = "",
+        .r8_param = "",
+        .r9_param = "",
+        .stack1_param = "",
+        .stack2_param = "",
+        .stack3_param = "",
+        .stack4_param = ""
     },
     {
         .name = "EMPTY SERVICE",
@@ -1240,8 +1569,7 @@ MaximumVariableSize             Returns the maximum size of the individual EFI v
         .stack1_param = "",
         .stack2_param = "",
         .stack3_param = "",
-        .stack4_param = "",
-        .count = 0
+        .stack4_param = ""
     }
 };
 
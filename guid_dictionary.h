@@ -0,0 +1,106 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * guid_dictionary.h
+ *
+ */
+
+#ifndef efi_swiss_knife_guid_dictionary_h
+#define efi_swiss_knife_guid_dictionary_h
+
+#include <stdint.h>
+#include <string.h>
+
+#include "efi_types.h"
+
+/*
+ * binary GUID dictionary format
+ * built by tools/efi_guid_compiler out of efi_guids.h style sources and
+ * UEFITool style GUID CSVs, and mapped read only by the plugin so it can be
+ * updated without recompiling and all batch workers share a single copy
+ *
+ * all fields are little endian and all offsets are from the start of the file
+ *
+ * layout:
+ * header
+ * keys        - EFI_GUID[count + 1], Eytzinger (BFS) order, slot 0 is unused
+ * names       - uint32_t[count + 1], offset into the pool of each key name
+ * filter      - uint32_t[1 << filter_bits / 32], Data1 prefilter bitmap
+ * pool        - all names NUL terminated and packed back to back
+ */
+
+#define GUID_DICT_MAGIC     0x54434447  /* GDCT */
+#define GUID_DICT_VERSION   1
+
+struct guid_dict_header
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t count;
+    uint32_t filter_bits;
+    uint32_t keys_offset;
+    uint32_t names_offset;
+    uint32_t filter_offset;
+    uint32_t pool_offset;
+    uint32_t pool_size;
+    uint32_t reserved[3];
+};
+
+/* total ordering used to lay out and search the keys */
+static inline int
+guid_dict_compare(const EFI_GUID *a, const EFI_GUID *b)
+{
+    return memcmp(a, b, sizeof(EFI_GUID));
+}
+
+/*
+ * search the Eytzinger ordered keys
+ * returns the slot of the key or 0 if it doesn't exist
+ */
+static inline uint32_t
+guid_dict_search(const EFI_GUID *keys, uint32_t count, const EFI_GUID *guid)
+{
+    uint32_t k = 1;
+    while (k <= count)
+    {
+        k = 2 * k + (guid_dict_compare(&keys[k], guid) < 0);
+    }
+    /* drop the trailing right turns plus the last left one to get the lower bound */
+    k >>= __builtin_ffs(~k);
+    if (k != 0 && guid_dict_compare(&keys[k], guid) == 0)
+    {
+        return k;
+    }
+    return 0;
+}
+
+#endif /* guid_dictionary_h */
@@ -0,0 +1,126 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * guid_format.cpp
+ *
+ */
+
+#include "guid_format.h"
+
+#include "binary_view.h"
+
+#include "cpu_features.h"
+
+#ifdef HAVE_X86_SIMD
+#include <tmmintrin.h>
+#endif
+
+/*
+ * GUID to string without any printf machinery or shared buffers
+ * Data1/2/3 are little endian integers so their bytes are reversed first, then
+ * every byte becomes two hex digits and the dashes are added
+ * out_string must have room for GUID_STRING_SIZE bytes
+ */
+
+static const char g_hex_digits[] = "0123456789ABCDEF";
+
+/* order of the GUID bytes as they are displayed */
+static const uint8_t g_display_order[16] = { 3, 2, 1, 0, 5, 4, 7, 6, 8, 9, 10, 11, 12, 13, 14, 15 };
+
+static inline void
+insert_dashes(const char *hex, char *out_string)
+{
+    memcpy(out_string, hex, 8);
+    out_string[8] = '-';
+    memcpy(out_string + 9, hex + 8, 4);
+    out_string[13] = '-';
+    memcpy(out_string + 14, hex + 12, 4);
+    out_string[18] = '-';
+    memcpy(out_string + 19, hex + 16, 4);
+    out_string[23] = '-';
+    memcpy(out_string + 24, hex + 20, 12);
+    out_string[GUID_STRING_LENGTH] = '\0';
+}
+
+static void
+format_guid_scalar(const EFI_GUID *guid, char *out_string)
+{
+    const uint8_t *bytes = (const uint8_t*)guid;
+    char hex[32];
+    for (int i = 0; i < 16; i++)
+    {
+        uint8_t value = bytes[g_display_order[i]];
+        hex[i * 2] = g_hex_digits[value >> 4];
+        hex[i * 2 + 1] = g_hex_digits[value & 0xF];
+    }
+    insert_dashes(hex, out_string);
+}
+
+#ifdef HAVE_X86_SIMD
+
+/* one shuffle to get the display order, then nibbles to hex with a table lookup shuffle */
+__attribute__((target("ssse3")))
+static void
+format_guid_ssse3(const EFI_GUID *guid, char *out_string)
+{
+    const __m128i order = _mm_loadu_si128((const __m128i*)g_display_order);
+    const __m128i digits = _mm_loadu_si128((const __m128i*)g_hex_digits);
+    const __m128i nibble_mask = _mm_set1_epi8(0xF);
+    
+    __m128i bytes = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)guid), order);
+    __m128i high = _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(bytes, 4), nibble_mask));
+    __m128i low = _mm_shuffle_epi8(digits, _mm_and_si128(bytes, nibble_mask));
+    
+    char hex[32];
+    _mm_storeu_si128((__m128i*)hex, _mm_unpacklo_epi8(high, low));
+    _mm_storeu_si128((__m128i*)(hex + 16), _mm_unpackhi_epi8(high, low));
+    insert_dashes(hex, out_string);
+}
+
+#endif
+
+/*
+ * reentrant GUID formatting, returns out_string so it can be used inline
+ */
+char *
+format_guid(const EFI_GUID *guid, char *out_string)
+{
+#ifdef HAVE_X86_SIMD
+    if (cpu_has_ssse3() == 1)
+    {
+        format_guid_ssse3(guid, out_string);
+        return out_string;
+    }
+#endif
+    format_guid_scalar(guid, out_string);
+    return out_string;
+}
@@ -0,0 +1,340 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * guid_index.cpp
+ *
+ */
+
+#include "guid_index.h"
+
+#include "binary_view.h"
+
+#include <sys/mman.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+
+#include "config.h"
+#include "guid_dictionary.h"
+#include "logging.h"
+
+/*
+ * the GUIDs from efi_guids.h are stored as a struct of arrays
+ * a dense array with just the 16 bytes keys, which is what the lookups touch,
+ * and all the names packed back to back in a single string pool
+ */
+#define GUID_ENTRY(name, d1, d2, d3, b0, b1, b2, b3, b4, b5, b6, b7) { d1, d2, d3, { b0, b1, b2, b3, b4, b5, b6, b7 } },
+static const EFI_GUID g_guid_keys[] = {
+#include "efi_guids.h"
+};
+#undef GUID_ENTRY
+
+#define GUID_ENTRY(name, d1, d2, d3, b0, b1, b2, b3, b4, b5, b6, b7) name "\0"
+static const char g_guid_names[] =
+#include "efi_guids.h"
+;
+#undef GUID_ENTRY
+
+#define GUID_TABLE_COUNT    (sizeof(g_guid_keys) / sizeof(*g_guid_keys))
+
+/* offset of each name inside the string pool, filled when the index is built */
+static uint32_t g_guid_name_offsets[GUID_TABLE_COUNT];
+
+/*
+ * open addressing hash table over the 128 bit GUID keys
+ * the slots only hold an index into the keys array (+1 so zero means empty slot)
+ * the table is sized to at least twice the number of GUIDs so probe
+ * sequences are very short and every lookup is O(1), and there's always an
+ * empty slot to end them
+ */
+#define GUID_INDEX_FITS(bits)   (2 * GUID_TABLE_COUNT <= (1U << (bits)))
+#define GUID_INDEX_BITS     (GUID_INDEX_FITS(12) ? 12 : GUID_INDEX_FITS(13) ? 13 : GUID_INDEX_FITS(14) ? 14 : \
+                             GUID_INDEX_FITS(15) ? 15 : 16)
+#define GUID_INDEX_SIZE     (1U << GUID_INDEX_BITS)
+#define GUID_INDEX_MASK     (GUID_INDEX_SIZE - 1)
+
+/* the slots are 16 bits, past 32768 GUIDs efi_guids.h needs the external dictionary instead */
+typedef char guid_index_too_small[GUID_INDEX_FITS(GUID_INDEX_BITS) ? 1 : -1];
+
+struct guid_key
+{
+    uint64_t lo;
+    uint64_t hi;
+};
+
+static uint16_t g_guid_slots[GUID_INDEX_SIZE];
+static uint32_t g_guid_filter[GUID_FILTER_WORDS];
+static int g_guid_index_ready;
+
+/* the external dictionary, used instead of the built in table if it exists */
+struct guid_dictionary
+{
+    void *mapping;
+    size_t mapping_size;
+    uint32_t count;
+    const EFI_GUID *keys;
+    const uint32_t *names;
+    const uint32_t *filter;
+    const char *pool;
+};
+
+static struct guid_dictionary g_guid_dict;
+
+static inline void
+make_guid_key(const EFI_GUID *guid, struct guid_key *key)
+{
+    memcpy(&key->lo, (uint8_t*)guid, sizeof(uint64_t));
+    memcpy(&key->hi, (uint8_t*)guid + sizeof(uint64_t), sizeof(uint64_t));
+}
+
+/* Data1 is the most random part of a GUID so it dominates the mix */
+static inline uint32_t
+hash_guid_key(const struct guid_key *key)
+{
+    uint64_t h = key->lo ^ (key->hi * 0x9E3779B97F4A7C15ULL);
+    h ^= h >> 29;
+    h *= 0xBF58476D1CE4E5B9ULL;
+    h ^= h >> 32;
+    return (uint32_t)h & GUID_INDEX_MASK;
+}
+
+/* verify that a section of count items of item_size fits inside the file */
+static int
+valid_dict_section(size_t file_size, uint32_t offset, uint32_t count, size_t item_size)
+{
+    if (offset > file_size || (offset % sizeof(uint32_t)) != 0)
+    {
+        return 0;
+    }
+    return (uint64_t)count * item_size <= file_size - offset;
+}
+
+/*
+ * map the external dictionary read only
+ * everything is validated here so the lookups can trust the contents
+ * returns 0 if the dictionary is ready to use
+ */
+static int
+open_guid_dictionary(const char *path)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        return 1;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof(struct guid_dict_header) || st.st_size > UINT32_MAX)
+    {
+        ERROR_MSG("Invalid GUID dictionary file: %s.", path);
+        close(fd);
+        return 1;
+    }
+    size_t file_size = (size_t)st.st_size;
+    void *mapping = mmap(NULL, file_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED)
+    {
+        ERROR_MSG("Can't map GUID dictionary file: %s.", path);
+        return 1;
+    }
+    
+    const uint8_t *base = (const uint8_t*)mapping;
+    const struct guid_dict_header *header = (const struct guid_dict_header*)base;
+    if (header->magic != GUID_DICT_MAGIC || header->version != GUID_DICT_VERSION ||
+        header->filter_bits != GUID_FILTER_BITS || header->count == 0 || header->count >= UINT32_MAX ||
+        valid_dict_section(file_size, header->keys_offset, header->count + 1, sizeof(EFI_GUID)) == 0 ||
+        valid_dict_section(file_size, header->names_offset, header->count + 1, sizeof(uint32_t)) == 0 ||
+        valid_dict_section(file_size, header->filter_offset, GUID_FILTER_WORDS, sizeof(uint32_t)) == 0 ||
+        header->pool_offset > file_size || header->pool_size == 0 || header->pool_size > file_size - header->pool_offset)
+    {
+        ERROR_MSG("Invalid or unsupported GUID dictionary: %s.", path);
+        munmap(mapping, file_size);
+        return 1;
+    }
+    
+    const char *pool = (const char*)(base + header->pool_offset);
+    const uint32_t *names = (const uint32_t*)(base + header->names_offset);
+    int valid = pool[header->pool_size - 1] == '\0';
+    for (uint32_t i = 1; i <= header->count && valid == 1; i++)
+    {
+        valid = names[i] < header->pool_size;
+    }
+    if (valid == 0)
+    {
+        ERROR_MSG("Corrupted names in GUID dictionary: %s.", path);
+        munmap(mapping, file_size);
+        return 1;
+    }
+    
+    g_guid_dict.mapping = mapping;
+    g_guid_dict.mapping_size = file_size;
+    g_guid_dict.count = header->count;
+    g_guid_dict.keys = (const EFI_GUID*)(base + header->keys_offset);
+    g_guid_dict.names = names;
+    g_guid_dict.filter = (const uint32_t*)(base + header->filter_offset);
+    g_guid_dict.pool = pool;
+    DEBUG_MSG("Using GUID dictionary %s with %u entries.", path, header->count);
+    return 0;
+}
+
+/*
+ * build the GUID index out of the keys array and locate each name in the pool
+ * duplicated GUIDs keep the first name, same as the old linear lookups
+ */
+int
+build_guid_index(void)
+{
+    if (g_guid_index_ready == 1)
+    {
+        return 0;
+    }
+    
+    /* nothing to build if there's an external dictionary */
+    if (open_guid_dictionary(GUID_DICT_FILE) == 0)
+    {
+        g_guid_index_ready = 1;
+        return 0;
+    }
+    
+    memset(g_guid_slots, 0, sizeof(g_guid_slots));
+    memset(g_guid_filter, 0, sizeof(g_guid_filter));
+    int duplicates = 0;
+    uint32_t name_offset = 0;
+    for (uint32_t i = 0; i < GUID_TABLE_COUNT; i++)
+    {
+        g_guid_name_offsets[i] = name_offset;
+        name_offset += (uint32_t)strlen(g_guid_names + name_offset) + 1;
+        
+        uint32_t filter_bit = guid_filter_hash(g_guid_keys[i].Data1);
+        g_guid_filter[filter_bit / 32] |= 1U << (filter_bit % 32);
+        
+        struct guid_key key;
+        make_guid_key(&g_guid_keys[i], &key);
+        uint32_t slot = hash_guid_key(&key);
+        while (g_guid_slots[slot] != 0)
+        {
+            if (memcmp(&g_guid_keys[g_guid_slots[slot] - 1], &g_guid_keys[i], sizeof(EFI_GUID)) == 0)
+            {
+                duplicates++;
+                break;
+            }
+            slot = (slot + 1) & GUID_INDEX_MASK;
+        }
+        if (g_guid_slots[slot] == 0)
+        {
+            g_guid_slots[slot] = (uint16_t)(i + 1);
+        }
+    }
+    DEBUG_MSG("GUID index built with %lu entries (%d duplicates), %lu bytes of keys and %lu bytes of names.",
+              (unsigned long)GUID_TABLE_COUNT, duplicates, (unsigned long)sizeof(g_guid_keys), (unsigned long)sizeof(g_guid_names));
+    g_guid_index_ready = 1;
+    return 0;
+}
+
+/*
+ * return the name of a known GUID or NULL if it doesn't exist in efi_guids.h
+ */
+const char *
+lookup_guid_name(const EFI_GUID *guid)
+{
+    if (g_guid_index_ready == 0)
+    {
+        build_guid_index();
+    }
+    
+    if (g_guid_dict.mapping != NULL)
+    {
+        uint32_t dict_slot = guid_dict_search(g_guid_dict.keys, g_guid_dict.count, guid);
+        return dict_slot != 0 ? g_guid_dict.pool + g_guid_dict.names[dict_slot] : NULL;
+    }
+    
+    struct guid_key key;
+    make_guid_key(guid, &key);
+    uint32_t slot = hash_guid_key(&key);
+    while (g_guid_slots[slot] != 0)
+    {
+        uint32_t index = g_guid_slots[slot] - 1;
+        if (memcmp(&g_guid_keys[index], guid, sizeof(EFI_GUID)) == 0)
+        {
+            return g_guid_names + g_guid_name_offsets[index];
+        }
+        slot = (slot + 1) & GUID_INDEX_MASK;
+    }
+    /* failure */
+    return NULL;
+}
+
+/*
+ * the Data1 prefilter bitmap, GUID_FILTER_WORDS long
+ */
+const uint32_t *
+guid_data1_filter(void)
+{
+    if (g_guid_index_ready == 0)
+    {
+        build_guid_index();
+    }
+    if (g_guid_dict.mapping != NULL)
+    {
+        return g_guid_dict.filter;
+    }
+    return g_guid_filter;
+}
+
+/*
+ * release the external dictionary mapping, if any
+ */
+void
+close_guid_index(void)
+{
+    if (g_guid_dict.mapping != NULL)
+    {
+        munmap(g_guid_dict.mapping, g_guid_dict.mapping_size);
+        memset(&g_guid_dict, 0, sizeof(g_guid_dict));
+    }
+    g_guid_index_ready = 0;
+}
+
+/*
+ * the built in GUIDs, for the benchmarks to compare the index against a linear scan
+ */
+size_t
+builtin_guid_count(void)
+{
+    return GUID_TABLE_COUNT;
+}
+
+const EFI_GUID *
+builtin_guid_keys(void)
+{
+    return g_guid_keys;
+}
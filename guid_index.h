@@ -0,0 +1,65 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * guid_index.h
+ *
+ */
+
+#ifndef efi_swiss_knife_guid_index_h
+#define efi_swiss_knife_guid_index_h
+
+#include <stddef.h>
+
+#include "efi_types.h"
+
+/*
+ * bitmap over a hash of Data1 of every known GUID
+ * used by the scanners to reject candidates before the full lookup
+ */
+#define GUID_FILTER_BITS    16
+#define GUID_FILTER_WORDS   ((1 << GUID_FILTER_BITS) / 32)
+#define GUID_FILTER_MUL     0x9E3779B1
+
+static inline uint32_t
+guid_filter_hash(uint32_t data1)
+{
+    return (data1 * GUID_FILTER_MUL) >> (32 - GUID_FILTER_BITS);
+}
+
+int build_guid_index(void);
+const char * lookup_guid_name(const EFI_GUID *guid);
+const uint32_t * guid_data1_filter(void);
+void close_guid_index(void);
+size_t builtin_guid_count(void);
+const EFI_GUID * builtin_guid_keys(void);
+
+#endif /* guid_index_h */
@@ -0,0 +1,261 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * guid_scanner.cpp
+ *
+ */
+
+#include "guid_scanner.h"
+
+#include "binary_view.h"
+#include "cpu_features.h"
+
+#ifdef HAVE_X86_SIMD
+#include <immintrin.h>
+#endif
+
+#include "config.h"
+#include "guid_index.h"
+#include "logging.h"
+
+/*
+ * the scanner works over a snapshot of the whole segment so we don't pay a
+ * binary view call per position
+ * every candidate position is a possible Data1, which is rejected if it's empty
+ * (0x0 or 0xFFFFFFFF, the bulk of any data segment) or if its hash isn't set in
+ * the Data1 bitmap of known GUIDs. only the survivors go to the full index lookup
+ * the SIMD kernels do the rejection for many positions at once
+ */
+
+#define SNAPSHOT_CHUNK_SIZE 0x1000
+
+static inline int
+data1_candidate(uint32_t data1, const uint32_t *filter)
+{
+    if (data1 == 0x0 || data1 == 0xFFFFFFFF)
+    {
+        return 0;
+    }
+    uint32_t bit = guid_filter_hash(data1);
+    return (filter[bit / 32] >> (bit % 32)) & 1;
+}
+
+/* confirm a candidate position against the index, returns 1 if it's a known GUID */
+static inline int
+confirm_candidate(const uint8_t *buffer, size_t offset, guid_found_callback callback, void *context)
+{
+    EFI_GUID guid;
+    memcpy(&guid, buffer + offset, sizeof(EFI_GUID));
+    const char *name = lookup_guid_name(&guid);
+    if (name == NULL)
+    {
+        return 0;
+    }
+    if (callback != NULL)
+    {
+        callback(offset, &guid, name, context);
+    }
+    return 1;
+}
+
+/* handles the positions the vector kernels can't and the non x86 builds */
+static size_t
+scan_guid_scalar(const uint8_t *buffer, size_t start, size_t size, size_t stride, guid_found_callback callback, void *context)
+{
+    const uint32_t *filter = guid_data1_filter();
+    size_t found = 0;
+    for (size_t offset = start; offset + sizeof(EFI_GUID) <= size; offset += stride)
+    {
+        uint32_t data1 = 0;
+        memcpy(&data1, buffer + offset, sizeof(data1));
+        if (data1_candidate(data1, filter))
+        {
+            found += confirm_candidate(buffer, offset, callback, context);
+        }
+    }
+    return found;
+}
+
+#ifdef HAVE_X86_SIMD
+
+/*
+ * 8 dwords per iteration, the Data1 hash and the bitmap test are done with a gather
+ * lane_mask selects the dword lanes that are aligned to the stride
+ */
+__attribute__((target("avx2")))
+static size_t
+scan_guid_avx2(const uint8_t *buffer, size_t size, size_t stride, size_t *out_offset, guid_found_callback callback, void *context)
+{
+    const uint32_t *filter = guid_data1_filter();
+    const unsigned int lane_mask = (stride == 8) ? 0x55 : 0xFF;
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i ones = _mm256_set1_epi32(-1);
+    const __m256i mul = _mm256_set1_epi32((int)GUID_FILTER_MUL);
+    const __m256i bit_mask = _mm256_set1_epi32(31);
+    const __m256i one = _mm256_set1_epi32(1);
+    size_t found = 0;
+    size_t offset = 0;
+    /* the last candidate of a block reads 16 bytes starting at block + 28 */
+    for (; offset + 32 + 12 <= size; offset += 32)
+    {
+        __m256i data1 = _mm256_loadu_si256((const __m256i*)(buffer + offset));
+        __m256i empty = _mm256_or_si256(_mm256_cmpeq_epi32(data1, zero), _mm256_cmpeq_epi32(data1, ones));
+        unsigned int mask = ~(unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(empty)) & lane_mask;
+        if (mask == 0)
+        {
+            continue;
+        }
+        __m256i hash = _mm256_srli_epi32(_mm256_mullo_epi32(data1, mul), 32 - GUID_FILTER_BITS);
+        __m256i words = _mm256_i32gather_epi32((const int*)filter, _mm256_srli_epi32(hash, 5), 4);
+        __m256i bits = _mm256_and_si256(_mm256_srlv_epi32(words, _mm256_and_si256(hash, bit_mask)), one);
+        mask &= (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(bits, one)));
+        while (mask != 0)
+        {
+            unsigned int lane = __builtin_ctz(mask);
+            found += confirm_candidate(buffer, offset + lane * 4, callback, context);
+            mask &= mask - 1;
+        }
+    }
+    *out_offset = offset;
+    return found;
+}
+
+/*
+ * 4 dwords per iteration, only the empty rejection is vectorized
+ * SSE2 is always available so this is the fallback for CPUs without AVX2
+ */
+static size_t
+scan_guid_sse2(const uint8_t *buffer, size_t size, size_t stride, size_t *out_offset, guid_found_callback callback, void *context)
+{
+    const uint32_t *filter = guid_data1_filter();
+    const unsigned int lane_mask = (stride == 8) ? 0x5 : 0xF;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i ones = _mm_set1_epi32(-1);
+    size_t found = 0;
+    size_t offset = 0;
+    for (; offset + 16 + 12 <= size; offset += 16)
+    {
+        __m128i data1 = _mm_loadu_si128((const __m128i*)(buffer + offset));
+        __m128i empty = _mm_or_si128(_mm_cmpeq_epi32(data1, zero), _mm_cmpeq_epi32(data1, ones));
+        unsigned int mask = ~(unsigned int)_mm_movemask_ps(_mm_castsi128_ps(empty)) & lane_mask;
+        while (mask != 0)
+        {
+            unsigned int lane = __builtin_ctz(mask);
+            uint32_t value = 0;
+            memcpy(&value, buffer + offset + lane * 4, sizeof(value));
+            if (data1_candidate(value, filter))
+            {
+                found += confirm_candidate(buffer, offset + lane * 4, callback, context);
+            }
+            mask &= mask - 1;
+        }
+    }
+    *out_offset = offset;
+    return found;
+}
+
+#endif
+
+/*
+ * scan a buffer for known GUIDs at every stride bytes (4 or 8)
+ * returns the number of GUIDs found
+ */
+size_t
+scan_guid_buffer(const uint8_t *buffer, size_t size, size_t stride, guid_found_callback callback, void *context)
+{
+    if (buffer == NULL || size < sizeof(EFI_GUID) || (stride != 4 && stride != 8))
+    {
+        return 0;
+    }
+    
+    size_t found = 0;
+    size_t offset = 0;
+#ifdef HAVE_X86_SIMD
+    if (cpu_has_avx2() == 1)
+    {
+        found = scan_guid_avx2(buffer, size, stride, &offset, callback, context);
+    }
+    else
+    {
+        found = scan_guid_sse2(buffer, size, stride, &offset, callback, context);
+    }
+#endif
+    /* whatever is left at the end of the buffer */
+    found += scan_guid_scalar(buffer, offset, size, stride, callback, context);
+    return found;
+}
+
+/*
+ * the whole segment contents, straight from the backend if it has them mapped
+ * otherwise read in one go, and if that fails because some bytes aren't loaded
+ * (.bss like areas) we retry in smaller chunks and leave the missing ones zeroed
+ * *out_copy is the buffer the caller has to free, NULL if nothing was copied
+ */
+const uint8_t *
+snapshot_segment(const struct binary_segment *seg_info, size_t *out_size, uint8_t **out_copy)
+{
+    if (seg_info == NULL || out_size == NULL || out_copy == NULL || seg_info->end <= seg_info->start)
+    {
+        return NULL;
+    }
+    
+    size_t seg_size = (size_t)(seg_info->end - seg_info->start);
+    *out_copy = NULL;
+    const uint8_t *mapped = view_map_bytes(seg_info->start, seg_size);
+    if (mapped != NULL)
+    {
+        *out_size = seg_size;
+        return mapped;
+    }
+    uint8_t *seg_bytes = (uint8_t*)calloc(1, seg_size);
+    if (seg_bytes == NULL)
+    {
+        ERROR_MSG("Can't allocate memory for segment snapshot.");
+        return NULL;
+    }
+    
+    if (view_read_bytes(seg_info->start, seg_bytes, seg_size) != 0)
+    {
+        DEBUG_MSG("Segment at 0x%llx is not fully loaded, reading it in chunks.", seg_info->start);
+        for (size_t offset = 0; offset < seg_size; offset += SNAPSHOT_CHUNK_SIZE)
+        {
+            size_t chunk_size = seg_size - offset < SNAPSHOT_CHUNK_SIZE ? seg_size - offset : SNAPSHOT_CHUNK_SIZE;
+            if (view_read_bytes(seg_info->start + offset, seg_bytes + offset, chunk_size) != 0)
+            {
+                memset(seg_bytes + offset, 0, chunk_size);
+            }
+        }
+    }
+    *out_size = seg_size;
+    *out_copy = seg_bytes;
+    return seg_bytes;
+}
@@ -0,0 +1,52 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * guid_scanner.h
+ *
+ */
+
+#ifndef efi_swiss_knife_guid_scanner_h
+#define efi_swiss_knife_guid_scanner_h
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "binary_view.h"
+#include "efi_types.h"
+
+/* called for every known GUID found, offset is relative to the scanned buffer */
+typedef void (*guid_found_callback)(size_t offset, const EFI_GUID *guid, const char *name, void *context);
+
+size_t scan_guid_buffer(const uint8_t *buffer, size_t size, size_t stride, guid_found_callback callback, void *context);
+const uint8_t * snapshot_segment(const struct binary_segment *seg_info, size_t *out_size, uint8_t **out_copy);
+
+#endif /* guid_scanner_h */
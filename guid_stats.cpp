@@ -0,0 +1,133 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * guid_stats.cpp
+ *
+ */
+
+#include "guid_stats.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define GUID_STATS_MIN_SLOTS    64
+
+static inline uint32_t
+hash_guid_stats(int type, const EFI_GUID *guid)
+{
+    uint64_t lo = 0, hi = 0;
+    memcpy(&lo, (const uint8_t*)guid, sizeof(lo));
+    memcpy(&hi, (const uint8_t*)guid + sizeof(lo), sizeof(hi));
+    uint64_t h = (lo ^ ((uint64_t)(uint32_t)type << 56)) ^ (hi * 0x9E3779B97F4A7C15ULL);
+    h ^= h >> 29;
+    h *= 0xBF58476D1CE4E5B9ULL;
+    h ^= h >> 32;
+    return (uint32_t)h;
+}
+
+/* slots hold entry index + 1, zero is an empty slot */
+static int
+grow_guid_stats_slots(struct guid_stats_map *map)
+{
+    uint32_t new_size = map->slots_size ? map->slots_size * 2 : GUID_STATS_MIN_SLOTS;
+    uint32_t *new_slots = (uint32_t*)calloc(new_size, sizeof(uint32_t));
+    if (new_slots == NULL)
+    {
+        return 1;
+    }
+    for (uint32_t i = 0; i < map->count; i++)
+    {
+        uint32_t slot = hash_guid_stats(map->entries[i].type, &map->entries[i].guid) & (new_size - 1);
+        while (new_slots[slot] != 0)
+        {
+            slot = (slot + 1) & (new_size - 1);
+        }
+        new_slots[slot] = i + 1;
+    }
+    free(map->slots);
+    map->slots = new_slots;
+    map->slots_size = new_size;
+    return 0;
+}
+
+/*
+ * increase the count of (type, guid), creating the entry on first use
+ * returns the entry or NULL if we ran out of memory
+ */
+struct guid_stats *
+add_guid_stats(struct guid_stats_map *map, int type, const EFI_GUID *guid)
+{
+    /* keep the load factor under 50% */
+    if ((map->count + 1) * 2 > map->slots_size && grow_guid_stats_slots(map) != 0)
+    {
+        return NULL;
+    }
+    
+    uint32_t mask = map->slots_size - 1;
+    uint32_t slot = hash_guid_stats(type, guid) & mask;
+    while (map->slots[slot] != 0)
+    {
+        struct guid_stats *entry = &map->entries[map->slots[slot] - 1];
+        if (entry->type == type && memcmp(&entry->guid, guid, sizeof(EFI_GUID)) == 0)
+        {
+            entry->count++;
+            return entry;
+        }
+        slot = (slot + 1) & mask;
+    }
+    
+    if (map->count == map->capacity)
+    {
+        uint32_t new_capacity = map->capacity ? map->capacity * 2 : GUID_STATS_MIN_SLOTS / 2;
+        struct guid_stats *new_entries = (struct guid_stats*)realloc(map->entries, new_capacity * sizeof(struct guid_stats));
+        if (new_entries == NULL)
+        {
+            return NULL;
+        }
+        map->entries = new_entries;
+        map->capacity = new_capacity;
+    }
+    struct guid_stats *entry = &map->entries[map->count];
+    memcpy(&entry->guid, guid, sizeof(EFI_GUID));
+    entry->count = 1;
+    entry->type = type;
+    map->slots[slot] = ++map->count;
+    return entry;
+}
+
+void
+free_guid_stats(struct guid_stats_map *map)
+{
+    free(map->entries);
+    free(map->slots);
+    memset(map, 0, sizeof(struct guid_stats_map));
+}
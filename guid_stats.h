@@ -0,0 +1,71 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * guid_stats.h
+ *
+ */
+
+#ifndef efi_swiss_knife_guid_stats_h
+#define efi_swiss_knife_guid_stats_h
+
+#include <stdint.h>
+
+#include "efi_types.h"
+
+struct guid_stats
+{
+    EFI_GUID guid;
+    int count;
+    int type;
+};
+
+/*
+ * open addressing hash map keyed on (service type, GUID)
+ * the entries live in a dense array in insertion order, the slots only hold
+ * indexes into it, so iterating gives the same order the old linked list had
+ */
+struct guid_stats_map
+{
+    struct guid_stats *entries;
+    uint32_t count;
+    uint32_t capacity;
+    uint32_t *slots;
+    uint32_t slots_size;
+};
+
+#define GUID_STATS_FOREACH(map, entry) \
+    for ((entry) = (map)->entries; (entry) != NULL && (entry) < (map)->entries + (map)->count; (entry)++)
+
+struct guid_stats * add_guid_stats(struct guid_stats_map *map, int type, const EFI_GUID *guid);
+void free_guid_stats(struct guid_stats_map *map);
+
+#endif /* guid_stats_h */
@@ -0,0 +1,787 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * idioms.cpp
+ *
+ */
+
+#include "idioms.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "logging.h"
+
+/*
+ * the rules are compiled into a trie of steps so rules sharing their first
+ * steps share the nodes too. matching keeps a small set of threads, each
+ * one a node reached so far plus the registers bound on the way there.
+ * threads aren't consumed when they advance, so a call through a register
+ * completes a rule every time until the register is overwritten
+ */
+
+#define IDIOM_ANY_OPERAND   0xFF
+#define IDIOM_ANY_REG       0xFFFF
+#define IDIOM_NO_RULE       -1
+#define IDIOM_MAX_THREADS   32
+#define IDIOM_MAX_REPORTS   16
+#define NR_IDIOM_REGS       16
+
+/* registers not preserved across calls */
+#define IDIOM_VOLATILE_REGS ((1 << 0) | (1 << 1) | (1 << 2) | (1 << 8) | (1 << 9) | (1 << 10) | (1 << 11))
+
+struct idiom_operand
+{
+    /* insn_operand_type or IDIOM_ANY_OPERAND */
+    uint8_t type;
+    /* register variable + 1, 0 if none */
+    uint8_t var;
+    /* the address must pass the caller's filter */
+    uint8_t filtered;
+    uint16_t reg;
+    /* accepted range for the address, displacement or immediate */
+    uint64_t low;
+    uint64_t high;
+};
+
+struct idiom_step
+{
+    /* bitmask of insn_kind */
+    uint32_t kinds;
+    struct idiom_operand ops[2];
+};
+
+struct idiom_node
+{
+    struct idiom_step step;
+    int32_t parent;
+    int32_t first_child;
+    int32_t next_sibling;
+    /* rule completed by this node or IDIOM_NO_RULE */
+    int32_t rule;
+    /* kinds accepted by any child, to skip nodes quickly */
+    uint32_t child_kinds;
+    uint8_t depth;
+    /* variables referenced by the step */
+    uint8_t uses;
+    /* variables bound once this node is reached */
+    uint8_t bound;
+    /* bound variables the following steps still need */
+    uint8_t live;
+};
+
+struct idiom_thread
+{
+    int32_t node;
+    uint16_t regs[IDIOM_MAX_VARS];
+    const struct cached_insn *insns[IDIOM_MAX_STEPS];
+};
+
+struct idiom_parser
+{
+    const char *name;
+    const char *pos;
+    char vars[IDIOM_MAX_VARS];
+    int nr_vars;
+};
+
+static const struct
+{
+    const char *name;
+    uint16_t kind;
+} g_idiom_mnemonics[] =
+{
+    { "mov", kInsnMov },
+    { "lea", kInsnLea },
+    { "call", kInsnCall },
+    { "callni", kInsnCallIndirect },
+    { "jmpni", kInsnJmpIndirect },
+    { "jmp", kInsnJmp },
+    { "jcc", kInsnJcc },
+    { "ret", kInsnRet },
+    { "xor", kInsnXor },
+    { "push", kInsnPush },
+    { "pop", kInsnPop }
+};
+
+/* x86 encoding order */
+static const char *g_idiom_registers[NR_IDIOM_REGS] =
+{
+    "rax", "rcx", "rdx", "rbx", "rsp", "rbp", "rsi", "rdi",
+    "r8", "r9", "r10", "r11", "r12", "r13", "r14", "r15"
+};
+
+#pragma mark -
+#pragma mark Rules parser
+#pragma mark -
+
+static int
+parse_error(struct idiom_parser *parser, const char *what)
+{
+    ERROR_MSG("Bad idiom rule \"%s\": %s at \"%s\".", parser->name, what, parser->pos);
+    return 1;
+}
+
+static void
+skip_spaces(struct idiom_parser *parser)
+{
+    while (*parser->pos == ' ' || *parser->pos == '\t')
+    {
+        parser->pos++;
+    }
+}
+
+/* next lower case alphanumeric word */
+static int
+parse_word(struct idiom_parser *parser, char *out, size_t size)
+{
+    skip_spaces(parser);
+    size_t length = 0;
+    while ((*parser->pos >= 'a' && *parser->pos <= 'z') || (*parser->pos >= '0' && *parser->pos <= '9'))
+    {
+        if (length + 1 >= size)
+        {
+            return parse_error(parser, "word too long");
+        }
+        out[length++] = *parser->pos++;
+    }
+    out[length] = '\0';
+    return length == 0 ? parse_error(parser, "expected a word") : 0;
+}
+
+static int
+parse_number(struct idiom_parser *parser, uint64_t *out)
+{
+    skip_spaces(parser);
+    char *end = NULL;
+    *out = strtoull(parser->pos, &end, 0);
+    if (end == parser->pos)
+    {
+        return parse_error(parser, "expected a number");
+    }
+    parser->pos = end;
+    return 0;
+}
+
+/* a register variable or a named register */
+static int
+parse_register(struct idiom_parser *parser, struct idiom_operand *op)
+{
+    skip_spaces(parser);
+    if (*parser->pos == '%')
+    {
+        char name = parser->pos[1];
+        if (name < 'a' || name > 'z')
+        {
+            return parse_error(parser, "bad register variable");
+        }
+        parser->pos += 2;
+        for (int i = 0; i < parser->nr_vars; i++)
+        {
+            if (parser->vars[i] == name)
+            {
+                op->var = i + 1;
+                return 0;
+            }
+        }
+        if (parser->nr_vars == IDIOM_MAX_VARS)
+        {
+            return parse_error(parser, "too many register variables");
+        }
+        parser->vars[parser->nr_vars++] = name;
+        op->var = parser->nr_vars;
+        return 0;
+    }
+    
+    char word[8] = {0};
+    if (parse_word(parser, word, sizeof(word)) != 0)
+    {
+        return 1;
+    }
+    for (uint16_t i = 0; i < NR_IDIOM_REGS; i++)
+    {
+        if (strcmp(word, g_idiom_registers[i]) == 0)
+        {
+            op->reg = i;
+            return 0;
+        }
+    }
+    return parse_error(parser, "unknown register");
+}
+
+/* a value, a low-high range or * for anything */
+static int
+parse_range(struct idiom_parser *parser, struct idiom_operand *op)
+{
+    skip_spaces(parser);
+    if (*parser->pos == '*')
+    {
+        parser->pos++;
+        return 0;
+    }
+    if (parse_number(parser, &op->low) != 0)
+    {
+        return 1;
+    }
+    op->high = op->low;
+    skip_spaces(parser);
+    if (*parser->pos == '-')
+    {
+        parser->pos++;
+        return parse_number(parser, &op->high);
+    }
+    return 0;
+}
+
+static int
+parse_operand(struct idiom_parser *parser, struct idiom_operand *op)
+{
+    skip_spaces(parser);
+    switch (*parser->pos)
+    {
+        case '*':
+            parser->pos++;
+            return 0;
+        case '#':
+            parser->pos++;
+            op->type = kOpImm;
+            return parse_range(parser, op);
+        case '[':
+            break;
+        default:
+            op->type = kOpReg;
+            return parse_register(parser, op);
+    }
+    
+    /* memory operands */
+    parser->pos++;
+    skip_spaces(parser);
+    if (*parser->pos == '@' || *parser->pos == '*')
+    {
+        op->type = kOpMem;
+        op->filtered = *parser->pos == '@';
+        parser->pos++;
+    }
+    else
+    {
+        op->type = kOpPhrase;
+        if (parse_register(parser, op) != 0)
+        {
+            return 1;
+        }
+        skip_spaces(parser);
+        if (*parser->pos == '+')
+        {
+            parser->pos++;
+            op->type = kOpDispl;
+            if (parse_range(parser, op) != 0)
+            {
+                return 1;
+            }
+        }
+    }
+    skip_spaces(parser);
+    if (*parser->pos != ']')
+    {
+        return parse_error(parser, "expected ]");
+    }
+    parser->pos++;
+    return 0;
+}
+
+static int
+parse_step(struct idiom_parser *parser, struct idiom_step *step)
+{
+    memset(step, 0, sizeof(struct idiom_step));
+    for (int i = 0; i < 2; i++)
+    {
+        step->ops[i].type = IDIOM_ANY_OPERAND;
+        step->ops[i].reg = IDIOM_ANY_REG;
+        step->ops[i].high = ~0ULL;
+    }
+    
+    /* mnemonic alternatives */
+    for (;;)
+    {
+        char word[8] = {0};
+        if (parse_word(parser, word, sizeof(word)) != 0)
+        {
+            return 1;
+        }
+        size_t i = 0;
+        size_t nr_mnemonics = sizeof(g_idiom_mnemonics) / sizeof(*g_idiom_mnemonics);
+        while (i < nr_mnemonics && strcmp(word, g_idiom_mnemonics[i].name) != 0)
+        {
+            i++;
+        }
+        if (i == nr_mnemonics)
+        {
+            return parse_error(parser, "unknown mnemonic");
+        }
+        step->kinds |= 1u << g_idiom_mnemonics[i].kind;
+        skip_spaces(parser);
+        if (*parser->pos != '|')
+        {
+            break;
+        }
+        parser->pos++;
+    }
+    
+    for (int i = 0; i < 2; i++)
+    {
+        skip_spaces(parser);
+        if (*parser->pos == ';' || *parser->pos == '\0')
+        {
+            break;
+        }
+        if (i == 1)
+        {
+            if (*parser->pos != ',')
+            {
+                return parse_error(parser, "expected ,");
+            }
+            parser->pos++;
+        }
+        if (parse_operand(parser, &step->ops[i]) != 0)
+        {
+            return 1;
+        }
+    }
+    skip_spaces(parser);
+    if (*parser->pos != ';' && *parser->pos != '\0')
+    {
+        return parse_error(parser, "expected ; or end of rule");
+    }
+    return 0;
+}
+
+#pragma mark -
+#pragma mark Automaton construction
+#pragma mark -
+
+static int
+same_operand(const struct idiom_operand *a, const struct idiom_operand *b)
+{
+    return a->type == b->type && a->var == b->var && a->filtered == b->filtered &&
+           a->reg == b->reg && a->low == b->low && a->high == b->high;
+}
+
+static int
+same_step(const struct idiom_step *a, const struct idiom_step *b)
+{
+    return a->kinds == b->kinds && same_operand(&a->ops[0], &b->ops[0]) && same_operand(&a->ops[1], &b->ops[1]);
+}
+
+static int32_t
+add_node(struct idiom_automaton *automaton, int32_t parent, const struct idiom_step *step)
+{
+    if (automaton->nr_nodes == automaton->capacity)
+    {
+        size_t new_capacity = automaton->capacity ? automaton->capacity * 2 : 16;
+        struct idiom_node *new_nodes = (struct idiom_node*)realloc(automaton->nodes, new_capacity * sizeof(struct idiom_node));
+        if (new_nodes == NULL)
+        {
+            ERROR_MSG("Can't allocate memory for idioms automaton.");
+            return -1;
+        }
+        automaton->nodes = new_nodes;
+        automaton->capacity = new_capacity;
+    }
+    int32_t index = (int32_t)automaton->nr_nodes++;
+    struct idiom_node *node = &automaton->nodes[index];
+    memset(node, 0, sizeof(struct idiom_node));
+    node->parent = parent;
+    node->first_child = -1;
+    node->next_sibling = -1;
+    node->rule = IDIOM_NO_RULE;
+    if (step != NULL)
+    {
+        struct idiom_node *parent_node = &automaton->nodes[parent];
+        node->step = *step;
+        node->depth = parent_node->depth + 1;
+        for (int i = 0; i < 2; i++)
+        {
+            if (step->ops[i].var != 0)
+            {
+                node->uses |= 1 << (step->ops[i].var - 1);
+            }
+        }
+        node->bound = parent_node->bound | node->uses;
+        node->next_sibling = parent_node->first_child;
+        parent_node->first_child = index;
+        parent_node->child_kinds |= step->kinds;
+    }
+    return index;
+}
+
+/*
+ * compile the rules into an automaton, the rules must outlive it
+ * returns 0 on success, 1 on failure
+ */
+int
+compile_idioms(const struct idiom_rule *rules, size_t nr_rules, struct idiom_automaton *out)
+{
+    memset(out, 0, sizeof(struct idiom_automaton));
+    out->rules = rules;
+    if (add_node(out, -1, NULL) != 0)
+    {
+        return 1;
+    }
+    
+    for (size_t r = 0; r < nr_rules; r++)
+    {
+        struct idiom_parser parser;
+        memset(&parser, 0, sizeof(struct idiom_parser));
+        parser.name = rules[r].name;
+        parser.pos = rules[r].pattern;
+        
+        int32_t current = 0;
+        int nr_steps = 0;
+        int failed = 0;
+        while (failed == 0)
+        {
+            struct idiom_step step;
+            if (nr_steps == IDIOM_MAX_STEPS)
+            {
+                failed = parse_error(&parser, "too many steps");
+                break;
+            }
+            if (parse_step(&parser, &step) != 0)
+            {
+                failed = 1;
+                break;
+            }
+            nr_steps++;
+            /* share the node with a rule that starts the same way */
+            int32_t child = out->nodes[current].first_child;
+            while (child != -1 && !same_step(&out->nodes[child].step, &step))
+            {
+                child = out->nodes[child].next_sibling;
+            }
+            if (child == -1 && (child = add_node(out, current, &step)) == -1)
+            {
+                failed = 1;
+                break;
+            }
+            current = child;
+            if (*parser.pos == '\0')
+            {
+                break;
+            }
+            /* skip the ; */
+            parser.pos++;
+        }
+        if (failed == 0 && out->nodes[current].rule != IDIOM_NO_RULE)
+        {
+            failed = parse_error(&parser, "same steps as another rule");
+        }
+        if (failed != 0)
+        {
+            free_idioms(out);
+            return 1;
+        }
+        out->nodes[current].rule = (int32_t)r;
+    }
+    
+    /* children are always added after their parents */
+    for (size_t i = out->nr_nodes - 1; i > 0; i--)
+    {
+        struct idiom_node *node = &out->nodes[i];
+        struct idiom_node *parent = &out->nodes[node->parent];
+        parent->live |= (node->uses | node->live) & parent->bound;
+    }
+    return 0;
+}
+
+void
+free_idioms(struct idiom_automaton *automaton)
+{
+    free(automaton->nodes);
+    memset(automaton, 0, sizeof(struct idiom_automaton));
+}
+
+#pragma mark -
+#pragma mark Matching
+#pragma mark -
+
+static int
+match_register(const struct idiom_operand *pattern, uint16_t reg, uint16_t *regs, uint8_t *bound)
+{
+    if (pattern->var == 0)
+    {
+        return pattern->reg == IDIOM_ANY_REG || pattern->reg == reg;
+    }
+    uint8_t var = pattern->var - 1;
+    if (*bound & (1 << var))
+    {
+        return regs[var] == reg;
+    }
+    if (reg >= NR_IDIOM_REGS)
+    {
+        return 0;
+    }
+    regs[var] = reg;
+    *bound |= 1 << var;
+    return 1;
+}
+
+static int
+match_step(const struct idiom_step *step, const struct cached_insn *insn, uint16_t *regs, uint8_t *bound,
+           idiom_address_filter filter, void *context)
+{
+    if ((step->kinds & (1u << insn->kind)) == 0)
+    {
+        return 0;
+    }
+    for (int i = 0; i < 2; i++)
+    {
+        const struct idiom_operand *pattern = &step->ops[i];
+        const struct insn_operand *op = &insn->ops[i];
+        if (pattern->type == IDIOM_ANY_OPERAND)
+        {
+            continue;
+        }
+        if (op->type != pattern->type)
+        {
+            return 0;
+        }
+        switch (op->type)
+        {
+            case kOpReg:
+            case kOpPhrase:
+                if (!match_register(pattern, op->reg, regs, bound))
+                {
+                    return 0;
+                }
+                break;
+            case kOpDispl:
+                if (op->addr < pattern->low || op->addr > pattern->high || !match_register(pattern, op->reg, regs, bound))
+                {
+                    return 0;
+                }
+                break;
+            case kOpMem:
+                if (op->addr < pattern->low || op->addr > pattern->high)
+                {
+                    return 0;
+                }
+                if (pattern->filtered && filter != NULL && !filter(op->addr, context))
+                {
+                    return 0;
+                }
+                break;
+            case kOpImm:
+                if (op->value < pattern->low || op->value > pattern->high)
+                {
+                    return 0;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+    return 1;
+}
+
+static uint32_t
+clobbered_registers(const struct cached_insn *insn)
+{
+    uint32_t clobbered = 0;
+    if (insn->kind == kInsnCall || insn->kind == kInsnCallIndirect)
+    {
+        clobbered |= IDIOM_VOLATILE_REGS;
+    }
+    if ((insn->flags & INSN_CHANGES_OP0) && insn->ops[0].type == kOpReg && insn->ops[0].reg < NR_IDIOM_REGS)
+    {
+        clobbered |= 1u << insn->ops[0].reg;
+    }
+    return clobbered;
+}
+
+/* is any of the variables held in a clobbered register */
+static int
+vars_clobbered(const struct idiom_thread *thread, uint8_t vars, uint32_t clobbered)
+{
+    for (int var = 0; var < IDIOM_MAX_VARS; var++)
+    {
+        if ((vars & (1 << var)) && (clobbered & (1u << thread->regs[var])))
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static int
+same_thread(const struct idiom_node *nodes, const struct idiom_thread *a, const struct idiom_thread *b)
+{
+    if (a->node != b->node)
+    {
+        return 0;
+    }
+    for (int var = 0; var < IDIOM_MAX_VARS; var++)
+    {
+        if ((nodes[a->node].bound & (1 << var)) && a->regs[var] != b->regs[var])
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* add a thread as the newest one, replacing an older copy or the oldest thread if full */
+static void
+push_thread(const struct idiom_node *nodes, struct idiom_thread *threads, size_t *nr_threads, const struct idiom_thread *thread)
+{
+    size_t drop = *nr_threads;
+    for (size_t t = 0; t < *nr_threads; t++)
+    {
+        if (same_thread(nodes, &threads[t], thread))
+        {
+            drop = t;
+            break;
+        }
+    }
+    if (drop == *nr_threads && *nr_threads == IDIOM_MAX_THREADS)
+    {
+        drop = 0;
+    }
+    if (drop < *nr_threads)
+    {
+        memmove(&threads[drop], &threads[drop + 1], (*nr_threads - drop - 1) * sizeof(struct idiom_thread));
+        (*nr_threads)--;
+    }
+    threads[(*nr_threads)++] = *thread;
+}
+
+/*
+ * run all the rules over a block in one pass
+ */
+void
+match_idioms(const struct idiom_automaton *automaton, struct insn_cache *cache, const struct insn_block *block,
+             idiom_address_filter filter, idiom_callback callback, void *context)
+{
+    if (automaton->nr_nodes == 0 || block == NULL)
+    {
+        return;
+    }
+    
+    const struct idiom_node *nodes = automaton->nodes;
+    struct idiom_thread threads[IDIOM_MAX_THREADS];
+    struct idiom_thread spawned[IDIOM_MAX_THREADS];
+    size_t nr_threads = 0;
+    
+    for (size_t i = 0; i < block->count; i++)
+    {
+        const struct cached_insn *insn = cached_insn(cache, block, i);
+        uint32_t clobbered = clobbered_registers(insn);
+        size_t nr_spawned = 0;
+        int reported[IDIOM_MAX_REPORTS];
+        size_t nr_reported = 0;
+        
+        /* the newest threads first so the latest bindings win, then a fresh start from the root */
+        for (long t = (long)nr_threads; t >= 0; t--)
+        {
+            const struct idiom_thread *from = t < (long)nr_threads ? &threads[t] : NULL;
+            const struct idiom_node *node = &nodes[from != NULL ? from->node : 0];
+            if ((node->child_kinds & (1u << insn->kind)) == 0)
+            {
+                continue;
+            }
+            for (int32_t child = node->first_child; child != -1; child = nodes[child].next_sibling)
+            {
+                struct idiom_thread next;
+                if (from != NULL)
+                {
+                    next = *from;
+                }
+                else
+                {
+                    memset(&next, 0, sizeof(struct idiom_thread));
+                }
+                next.node = child;
+                uint8_t bound = node->bound;
+                if (!match_step(&nodes[child].step, insn, next.regs, &bound, filter, context))
+                {
+                    continue;
+                }
+                next.insns[nodes[child].depth - 1] = insn;
+                
+                int32_t rule = nodes[child].rule;
+                if (rule != IDIOM_NO_RULE && callback != NULL)
+                {
+                    int action = automaton->rules[rule].action;
+                    size_t r = 0;
+                    while (r < nr_reported && reported[r] != action)
+                    {
+                        r++;
+                    }
+                    if (r == nr_reported)
+                    {
+                        struct idiom_match match;
+                        match.rule = &automaton->rules[rule];
+                        match.nr_steps = nodes[child].depth;
+                        memcpy(match.insns, next.insns, sizeof(match.insns));
+                        callback(&match, context);
+                        if (nr_reported < IDIOM_MAX_REPORTS)
+                        {
+                            reported[nr_reported++] = action;
+                        }
+                    }
+                }
+                
+                /* registers bound by this instruction are its result, not clobbered by it */
+                uint8_t needed = nodes[child].live & ~(bound & ~node->bound);
+                if (nodes[child].first_child != -1 && nr_spawned < IDIOM_MAX_THREADS && !vars_clobbered(&next, needed, clobbered))
+                {
+                    spawned[nr_spawned++] = next;
+                }
+            }
+        }
+        
+        /* drop the threads whose registers were just overwritten */
+        size_t kept = 0;
+        for (size_t t = 0; t < nr_threads; t++)
+        {
+            if (!vars_clobbered(&threads[t], nodes[threads[t].node].live, clobbered))
+            {
+                threads[kept++] = threads[t];
+            }
+        }
+        nr_threads = kept;
+        /* spawned from the newest threads first, add them in reverse so they stay the newest */
+        for (size_t s = nr_spawned; s > 0; s--)
+        {
+            push_thread(nodes, threads, &nr_threads, &spawned[s - 1]);
+        }
+    }
+}
@@ -0,0 +1,109 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * idioms.h
+ *
+ */
+
+#ifndef efi_swiss_knife_idioms_h
+#define efi_swiss_knife_idioms_h
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "binary_view.h"
+
+#include "insn_cache.h"
+
+/*
+ * instruction sequence idioms described as text rules and compiled into
+ * a single automaton, so all of them are matched in one pass over a block
+ *
+ * a rule is a list of steps separated by ';', each step is one instruction:
+ *
+ *   mnemonic[|mnemonic...] [operand [, operand]]
+ *
+ * mnemonics: mov lea call callni jmpni jmp jcc ret xor
+ * operands:
+ *   *               anything
+ *   %a .. %z        register variable, bound by the first step using it
+ *   rax .. r15      that exact register
+ *   #* or #value    immediate
+ *   [@]             memory address accepted by the caller's address filter
+ *   [*]             any memory address
+ *   [base]          register indirect, base is a variable or a register
+ *   [base+disp]     displacement, disp is *, a value or a low-high range
+ *
+ * steps don't need to be adjacent, a partial match stays alive until one of
+ * the registers its remaining steps need is overwritten. every instruction
+ * completing a rule is reported, once per action
+ */
+
+#define IDIOM_MAX_STEPS     4
+#define IDIOM_MAX_VARS      4
+
+struct idiom_rule
+{
+    const char *name;
+    /* what the caller does with a match, rules can share it */
+    int action;
+    const char *pattern;
+};
+
+struct idiom_match
+{
+    const struct idiom_rule *rule;
+    size_t nr_steps;
+    /* the instruction matched by each step */
+    const struct cached_insn *insns[IDIOM_MAX_STEPS];
+};
+
+struct idiom_node;
+
+struct idiom_automaton
+{
+    const struct idiom_rule *rules;
+    struct idiom_node *nodes;
+    size_t nr_nodes;
+    size_t capacity;
+};
+
+/* accept or reject the address of a [@] operand */
+typedef int (*idiom_address_filter)(ea_t address, void *context);
+typedef void (*idiom_callback)(const struct idiom_match *match, void *context);
+
+int compile_idioms(const struct idiom_rule *rules, size_t nr_rules, struct idiom_automaton *out);
+void match_idioms(const struct idiom_automaton *automaton, struct insn_cache *cache, const struct insn_block *block,
+                  idiom_address_filter filter, idiom_callback callback, void *context);
+void free_idioms(struct idiom_automaton *automaton);
+
+#endif /* idioms_h */
@@ -0,0 +1,84 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * image_format.cpp
+ *
+ */
+
+#include "image_format.h"
+
+#include "logging.h"
+
+/*
+ * the format of the loaded module, from the signature at the start of the
+ * HEADER segment
+ */
+int
+current_image_format(void)
+{
+    struct binary_segment seg_info;
+    uint16_t signature = 0;
+    if (view_segment_by_name("HEADER", &seg_info) != 0 || view_read_bytes(seg_info.start, &signature, sizeof(signature)) != 0)
+    {
+        return kImageUnknown;
+    }
+    switch (signature)
+    {
+        case EFI_IMAGE_DOS_SIGNATURE:
+            return kImagePE;
+        case EFI_IMAGE_TE_SIGNATURE:
+            return kImageTE;
+        default:
+            return kImageUnknown;
+    }
+}
+
+/*
+ * the TE header and where it is loaded
+ * returns 0 on success
+ */
+int
+read_te_header(EFI_TE_IMAGE_HEADER *out, ea_t *address)
+{
+    struct binary_segment seg_info;
+    if (view_segment_by_name("HEADER", &seg_info) != 0 || view_read_bytes(seg_info.start, out, sizeof(EFI_TE_IMAGE_HEADER)) != 0)
+    {
+        return 1;
+    }
+    if (out->Signature != EFI_IMAGE_TE_SIGNATURE || out->StrippedSize < sizeof(EFI_TE_IMAGE_HEADER))
+    {
+        ERROR_MSG("Invalid TE header at 0x%llx.", seg_info.start);
+        return 1;
+    }
+    *address = seg_info.start;
+    return 0;
+}
@@ -0,0 +1,99 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * image_format.h
+ *
+ */
+
+#ifndef efi_swiss_knife_image_format_h
+#define efi_swiss_knife_image_format_h
+
+#include <stdint.h>
+
+#include "binary_view.h"
+
+/*
+ * PE and TE (Terse Executable) image definitions
+ * TE images are PE images with the DOS, PE and optional headers replaced by
+ * a 40 bytes header. StrippedSize is how many bytes were removed, so the TE
+ * header sits at RVA StrippedSize - sizeof(EFI_TE_IMAGE_HEADER) and every RVA,
+ * section headers included, keeps its PE value
+ */
+
+#define EFI_IMAGE_DOS_SIGNATURE     0x5A4D      /* MZ */
+#define EFI_IMAGE_PE_SIGNATURE      0x00004550  /* PE */
+#define EFI_IMAGE_TE_SIGNATURE      0x5A56      /* VZ */
+
+#define EFI_IMAGE_MACHINE_IA32      0x014C
+#define EFI_IMAGE_MACHINE_X64       0x8664
+
+#define EFI_IMAGE_NT_OPTIONAL_HDR32_MAGIC   0x10B
+#define EFI_IMAGE_NT_OPTIONAL_HDR64_MAGIC   0x20B
+
+#define EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC 5
+#define EFI_TE_IMAGE_DIRECTORY_ENTRY_BASERELOC  0
+
+#define EFI_IMAGE_REL_BASED_ABSOLUTE    0
+#define EFI_IMAGE_REL_BASED_HIGHLOW     3
+#define EFI_IMAGE_REL_BASED_DIR64       10
+
+#define EFI_IMAGE_SCN_CNT_CODE          0x00000020
+#define EFI_IMAGE_SCN_MEM_EXECUTE       0x20000000
+
+typedef struct __attribute__ ((__packed__)) {
+    uint32_t VirtualAddress;
+    uint32_t Size;
+} EFI_IMAGE_DATA_DIRECTORY;
+
+typedef struct __attribute__ ((__packed__)) {
+    uint16_t Signature;
+    uint16_t Machine;
+    uint8_t  NumberOfSections;
+    uint8_t  Subsystem;
+    uint16_t StrippedSize;
+    uint32_t AddressOfEntryPoint;
+    uint32_t BaseOfCode;
+    uint64_t ImageBase;
+    EFI_IMAGE_DATA_DIRECTORY DataDirectory[2];
+} EFI_TE_IMAGE_HEADER;
+
+enum image_format
+{
+    kImageUnknown = 0,
+    kImagePE,
+    kImageTE
+};
+
+int current_image_format(void);
+int read_te_header(EFI_TE_IMAGE_HEADER *out, ea_t *address);
+
+#endif /* image_format_h */
@@ -0,0 +1,236 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * image_guids.cpp
+ *
+ */
+
+#include "image_guids.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "config.h"
+#include "guid_scanner.h"
+#include "logging.h"
+
+/*
+ * single sweep over every loaded segment looking for known GUIDs
+ *
+ * each segment is snapshotted once and scanned at 4 bytes granularity
+ * the results go into an address sorted map that the call site analysis uses,
+ * and the snapshots are kept around so GUIDs that aren't known can also be read
+ * without going back to the binary view
+ */
+
+struct segment_snapshot
+{
+    ea_t start;
+    size_t size;
+    const uint8_t *bytes;
+    /* what to free, NULL if bytes point into the binary view's mapping */
+    uint8_t *copy;
+    size_t guids;
+    char name[SEGMENT_NAME_SIZE];
+};
+
+/* scanner callback context */
+struct sweep_state
+{
+    struct image_guids *images;
+    struct segment_snapshot *segment;
+};
+
+static void
+image_guid_found(size_t offset, const EFI_GUID *guid, const char *name, void *context)
+{
+    struct image_guids *images = ((struct sweep_state*)context)->images;
+    struct segment_snapshot *segment = ((struct sweep_state*)context)->segment;
+    if (images->locations_count == images->locations_capacity)
+    {
+        size_t new_capacity = images->locations_capacity ? images->locations_capacity * 2 : 64;
+        struct guid_location *new_locations = (struct guid_location*)realloc(images->locations, new_capacity * sizeof(struct guid_location));
+        if (new_locations == NULL)
+        {
+            ERROR_MSG("Can't allocate memory for GUID locations.");
+            return;
+        }
+        images->locations = new_locations;
+        images->locations_capacity = new_capacity;
+    }
+    struct guid_location *location = &images->locations[images->locations_count++];
+    location->address = segment->start + offset;
+    location->name = name;
+    memcpy(&location->guid, guid, sizeof(EFI_GUID));
+    segment->guids++;
+}
+
+/*
+ * snapshot and scan all segments
+ * segments are visited in address order so the map is built already sorted
+ */
+int
+sweep_image_guids(struct image_guids *images)
+{
+    free_image_guids(images);
+    
+    size_t seg_qty = view_segment_count();
+    if (seg_qty == 0)
+    {
+        ERROR_MSG("No segments to scan for GUIDs!");
+        return 1;
+    }
+    images->segments = (struct segment_snapshot*)calloc(seg_qty, sizeof(struct segment_snapshot));
+    if (images->segments == NULL)
+    {
+        ERROR_MSG("Can't allocate memory for segment snapshots.");
+        return 1;
+    }
+    
+    size_t total_bytes = 0;
+    for (size_t i = 0; i < seg_qty; i++)
+    {
+        struct binary_segment seg_info;
+        if (view_segment_at(i, &seg_info) != 0)
+        {
+            continue;
+        }
+        struct segment_snapshot *segment = &images->segments[images->segments_count];
+        segment->bytes = snapshot_segment(&seg_info, &segment->size, &segment->copy);
+        if (segment->bytes == NULL)
+        {
+            continue;
+        }
+        segment->start = seg_info.start;
+        if (seg_info.name[0] != '\0')
+        {
+            strlcpy(segment->name, seg_info.name, sizeof(segment->name));
+        }
+        else
+        {
+            qsnprintf(segment->name, sizeof(segment->name), "seg%d", (int)i);
+        }
+        images->segments_count++;
+        
+        struct sweep_state state = { images, segment };
+        scan_guid_buffer(segment->bytes, segment->size, 4, image_guid_found, &state);
+        total_bytes += segment->size;
+        DEBUG_MSG("GUID sweep: segment %-12s 0x%llx - 0x%llx %8lu bytes %4lu GUIDs", segment->name, segment->start,
+                  segment->start + segment->size, (unsigned long)segment->size, (unsigned long)segment->guids);
+    }
+    DEBUG_MSG("GUID sweep: %d segments, %lu bytes, %lu GUIDs found.", images->segments_count,
+              (unsigned long)total_bytes, (unsigned long)images->locations_count);
+    return 0;
+}
+
+/*
+ * all known GUIDs found in the image, sorted by address
+ */
+const struct guid_location *
+image_guid_locations(const struct image_guids *images, size_t *out_count)
+{
+    if (out_count != NULL)
+    {
+        *out_count = images->locations_count;
+    }
+    return images->locations;
+}
+
+/*
+ * known GUID at an exact address or NULL
+ */
+const struct guid_location *
+lookup_guid_location(const struct image_guids *images, ea_t address)
+{
+    size_t low = 0;
+    size_t high = images->locations_count;
+    while (low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+        if (images->locations[middle].address < address)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    if (low < images->locations_count && images->locations[low].address == address)
+    {
+        return &images->locations[low];
+    }
+    return NULL;
+}
+
+/*
+ * read the GUID at address, from the map if it's a known one or else from the
+ * segment snapshots. only falls back to IDA if the address isn't in any snapshot
+ * returns 0 on success
+ */
+int
+read_image_guid(const struct image_guids *images, ea_t address, EFI_GUID *out_guid)
+{
+    const struct guid_location *location = lookup_guid_location(images, address);
+    if (location != NULL)
+    {
+        memcpy(out_guid, &location->guid, sizeof(EFI_GUID));
+        return 0;
+    }
+    for (int i = 0; i < images->segments_count; i++)
+    {
+        const struct segment_snapshot *segment = &images->segments[i];
+        if (address >= segment->start && address - segment->start + sizeof(EFI_GUID) <= segment->size)
+        {
+            memcpy(out_guid, segment->bytes + (address - segment->start), sizeof(EFI_GUID));
+            return 0;
+        }
+    }
+    if (view_read_bytes(address, out_guid, sizeof(EFI_GUID)) != 0)
+    {
+        memset(out_guid, 0, sizeof(EFI_GUID));
+        return 1;
+    }
+    return 0;
+}
+
+void
+free_image_guids(struct image_guids *images)
+{
+    for (int i = 0; i < images->segments_count; i++)
+    {
+        free(images->segments[i].copy);
+    }
+    free(images->segments);
+    free(images->locations);
+    memset(images, 0, sizeof(struct image_guids));
+}
@@ -0,0 +1,70 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * image_guids.h
+ *
+ */
+
+#ifndef efi_swiss_knife_image_guids_h
+#define efi_swiss_knife_image_guids_h
+
+#include "binary_view.h"
+
+#include "efi_types.h"
+
+/* a known GUID found somewhere in the image */
+struct guid_location
+{
+    ea_t address;
+    const char *name;
+    EFI_GUID guid;
+};
+
+struct segment_snapshot;
+
+/* segment snapshots and the address sorted map of known GUIDs */
+struct image_guids
+{
+    struct segment_snapshot *segments;
+    int segments_count;
+    struct guid_location *locations;
+    size_t locations_count;
+    size_t locations_capacity;
+};
+
+int sweep_image_guids(struct image_guids *images);
+const struct guid_location * image_guid_locations(const struct image_guids *images, size_t *out_count);
+const struct guid_location * lookup_guid_location(const struct image_guids *images, ea_t address);
+int read_image_guid(const struct image_guids *images, ea_t address, EFI_GUID *out_guid);
+void free_image_guids(struct image_guids *images);
+
+#endif /* image_guids_h */
@@ -36,28 +36,30 @@
 
 #include "initial_checks.h"
 
-#include <ida.hpp>
-#include <idp.hpp>
-#include <loader.hpp>
-#include <bytes.hpp>
-#include <kernwin.hpp>
-#include <search.hpp>
-#include <allins.hpp>
-#include <segment.hpp>
+#include <stdlib.h>
 #include <limits.h>
-#include <auto.hpp>
-#include <name.hpp>
-#include <frame.hpp>
-#include <struct.hpp>
-#include <funcs.hpp>
-
 #include <libgen.h>
 #include <sqlite3.h>
 
+#include "binary_view.h"
 #include "config.h"
 #include "utlist.h"
-#include "efi_guids.h"
+#include "arena.h"
+#include "efi_types.h"
+#include "guid_format.h"
+#include "guid_index.h"
+#include "guid_scanner.h"
+#include "guid_stats.h"
+#include "image_guids.h"
+#include "insn_cache.h"
+#include "arg_dataflow.h"
+#include "table_aliases.h"
+#include "code_patterns.h"
+#include "module_arch.h"
+#include "image_format.h"
+#include "idioms.h"
 #include "efi_system_tables.h"
+#include "efi_pei_tables.h"
 #include "logging.h"
 #include "database.h"
 
@@ -100,13 +102,19 @@ enum FILE_TYPE
     kTE
 };
 
-enum ref_type
+/* which services table a reference goes through */
+enum table_kind
 {
-    kInvalid = -1,
-    kLoad,
-    kStore
+    kTableNone = 0,
+    kTableBoot,
+    kTableRunTime,
+    kTablePei,
+    kTableSmm
 };
 
+/* max number of instructions backwards we look for arguments outside of functions */
+#define MAX_ARGS_SEARCH     32
+
 struct address_list
 {
     struct address_list *next;
@@ -126,7 +134,20 @@ enum system_services
     /* run time services */
     kGetVariable,
     kSetVariable,
-    kInvalidRunTime
+    kInvalidRunTime,
+    /* PEI services */
+    kInstallPpi,
+    kReInstallPpi,
+    kLocatePpi,
+    kNotifyPpi,
+    kInvalidPei,
+    /* SMM services */
+    kSmmInstallProtocol,
+    kSmmHandleProtocol,
+    kSmmRegisterProtocol,
+    kSmmLocateProtocol,
+    kSmiHandlerRegister,
+    kInvalidSmm
 };
 
 struct analysis_entry
@@ -134,34 +155,51 @@ struct analysis_entry
     ea_t address;
     struct analysis_entry *next;
     enum system_services type;
-};
-
-struct guid_stats
-{
-    EFI_GUID guid;
-    struct guid_stats *next;
-    int count;
-    enum system_services type;
+    const struct services_entry *service;
 };
 
 struct boot_services_analysis
 {
     struct analysis_entry *analysis_head;
-    struct guid_stats *guid_stats_head;
+    struct analysis_entry *analysis_tail;
+    struct guid_stats_map guid_stats;
     int installed_protocols;
 };
 
-struct boot_services_analysis g_boot_services_stats;
-
 struct runtime_services_analysis
 {
     struct analysis_entry *analysis_head;
-    struct guid_stats *guid_stats_head;
+    struct analysis_entry *analysis_tail;
+    struct guid_stats_map guid_stats;
+};
+
+struct smm_services_analysis
+{
+    struct analysis_entry *analysis_head;
+    struct analysis_entry *analysis_tail;
+    struct guid_stats_map guid_stats;
+    int installed_protocols;
+    /* SMI handlers registered for a GUID */
+    int registered_handlers;
+};
+
+struct pei_analysis_entry
+{
+    ea_t address;
+    struct pei_analysis_entry *next;
+    enum system_services type;
+    const struct pei_services_entry *service;
 };
 
-struct runtime_services_analysis g_runtime_services_stats;
+struct pei_services_analysis
+{
+    struct pei_analysis_entry *analysis_head;
+    struct pei_analysis_entry *analysis_tail;
+    struct guid_stats_map guid_stats;
+    int installed_ppis;
+};
 
-/* a linked list to hold boot and runtime services references for further processing */
+/* a linked list to hold the services references for further processing */
 struct service_refs
 {
     ea_t offset;
@@ -169,207 +207,504 @@ struct service_refs
     struct service_refs *next;
 };
 
-/* a separate list for boot and runtime tables */
-struct service_refs *g_boot_refs_head;
-struct service_refs *g_runtime_refs_head;
-
-static int find_system_tables(void);
-static const struct services_entry lookup_boot_table(ea_t offset);
-static const struct services_entry lookup_runtime_table(ea_t offset);
-static int find_data_seg_guids(void);
-static void make_bootservice_cmts(void);
-static void make_runtimeservice_cmts(void);
-static char * string_guid(EFI_GUID *guid);
-static void add_guid_stats_entry(enum system_services type, EFI_GUID *guid);
-static void print_boot_services_usage(void);
-static void print_runtime_services_usage(void);
-static void analyse_interesting_boot_services(void);
-static void print_protocols_usage(void);
-static void log_boot_services_usage(FILE *output_file);
-static void log_runtime_services_usage(FILE *output_file);
-static void log_protocols_usage(FILE *output_file);
-static void sql_protocols_usage(void);
-static void sql_file_entry(void);
-static void sql_boot_services_usage(void);
-static void sql_runtime_services_usage(void);
-static int locate_boot_services_refs(void);
-static int locate_runtime_services_refs(void);
-static void analyse_boot_refs(void);
-static void analyse_runtime_refs(void);
-static void make_guid_cmt(EFI_GUID *guid, ea_t target_addr);
-static void print_guid(EFI_GUID *guid);
-static void analyse_interesting_runtime_services(void);
-
-ea_t bootservices_ptr = 0;
-ea_t runtimeservices_ptr = 0;
+/* a singly linked list with its tail, LL_APPEND walks the whole list on every insert */
+struct service_refs_list
+{
+    struct service_refs *head;
+    struct service_refs *tail;
+};
+
+/* append in O(1) to a list keeping a tail pointer next to its head */
+#define LL_APPEND_TAIL(head, tail, add)     \
+do {                                        \
+    (add)->next = NULL;                     \
+    if ((tail) != NULL)                     \
+    {                                       \
+        (tail)->next = (add);               \
+    }                                       \
+    else                                    \
+    {                                       \
+        (head) = (add);                     \
+    }                                       \
+    (tail) = (add);                         \
+} while (0)
+
+#define BOOT_SERVICES_ENTRIES       (sizeof(boot_services_table) / sizeof(*boot_services_table))
+#define RUNTIME_SERVICES_ENTRIES    (sizeof(runtime_services_table) / sizeof(*runtime_services_table))
+#define SMM_SERVICES_ENTRIES        (sizeof(smm_services_table) / sizeof(*smm_services_table))
+#define PEI_SERVICES_ENTRIES        (sizeof(pei_services_table) / sizeof(*pei_services_table))
+
+/* EFI_PEI_PPI_DESCRIPTOR and EFI_PEI_NOTIFY_DESCRIPTOR are three IA32 pointers */
+#define PPI_DESCRIPTOR_SIZE         12
+/* give up on descriptor lists without a terminator */
+#define MAX_PPI_DESCRIPTORS         32
+
+/*
+ * everything we find out about the module being analysed
+ * lives here and is passed through every stage so nothing carries over between runs
+ */
+struct analysis_context
+{
+    /* module identity used in the log and database output */
+    char *target_guid;
+    /* x64 or IA32, decides the pipeline and how the services calls look */
+    const struct module_arch *arch;
+    /* PE or TE, TE images are PEI phase modules */
+    int format;
+    /* every global holding one of the system tables, with the calls made through it */
+    struct table_aliases table_aliases;
+    /* a separate list for boot and runtime tables */
+    struct service_refs_list boot_refs;
+    struct service_refs_list runtime_refs;
+    struct boot_services_analysis boot_services_stats;
+    struct runtime_services_analysis runtime_services_stats;
+    /* usage counters kept apart from the big read only documentation records */
+    uint32_t boot_services_count[BOOT_SERVICES_ENTRIES];
+    uint32_t runtime_services_count[RUNTIME_SERVICES_ENTRIES];
+    /* SMM drivers, calls made through gSmst */
+    struct service_refs_list smm_refs;
+    struct smm_services_analysis smm_services_stats;
+    uint32_t smm_services_count[SMM_SERVICES_ENTRIES];
+    /* PEI modules only, calls made through (**PeiServices) */
+    struct service_refs_list pei_refs;
+    struct pei_services_analysis pei_services_stats;
+    uint32_t pei_services_count[PEI_SERVICES_ENTRIES];
+    struct image_guids image_guids;
+    /* raw byte candidates deciding which functions are worth decoding */
+    struct code_candidates code;
+    /* every function is decoded once and shared by all passes */
+    struct insn_cache insns;
+    /* argument registers at every call, solved once per function */
+    struct args_cache args;
+    /* backing store for the references and analysis lists */
+    struct arena records;
+};
+
+static int init_analysis_context(struct analysis_context *ctx);
+static void free_analysis_context(struct analysis_context *ctx);
+static void analyse_module(struct analysis_context *ctx);
+static int find_system_tables(struct analysis_context *ctx);
+static int has_services_table_loads(struct analysis_context *ctx);
+static void build_services_index(void);
+static int boot_service_index(ea_t offset);
+static int runtime_service_index(ea_t offset);
+static const struct services_entry * lookup_boot_table(ea_t offset);
+static const struct services_entry * lookup_runtime_table(ea_t offset);
+static int find_image_guids(struct analysis_context *ctx);
+static void make_bootservice_cmts(struct analysis_context *ctx);
+static void make_runtimeservice_cmts(struct analysis_context *ctx);
+static void print_boot_services_usage(struct analysis_context *ctx);
+static void print_runtime_services_usage(struct analysis_context *ctx);
+static void analyse_interesting_boot_services(struct analysis_context *ctx);
+static void print_protocols_usage(struct analysis_context *ctx);
+static void print_table_aliases_usage(struct analysis_context *ctx);
+static void log_boot_services_usage(struct analysis_context *ctx, FILE *output_file);
+static void log_runtime_services_usage(struct analysis_context *ctx, FILE *output_file);
+static void log_protocols_usage(struct analysis_context *ctx, FILE *output_file);
+static void log_table_aliases_usage(struct analysis_context *ctx, FILE *output_file);
+static void sql_protocols_usage(struct analysis_context *ctx);
+static void sql_file_entry(struct analysis_context *ctx);
+static void sql_boot_services_usage(struct analysis_context *ctx);
+static void sql_runtime_services_usage(struct analysis_context *ctx);
+static int locate_services_refs(struct analysis_context *ctx);
+static void analyse_boot_refs(struct analysis_context *ctx);
+static void analyse_runtime_refs(struct analysis_context *ctx);
+static void make_guid_cmt(const EFI_GUID *guid, ea_t target_addr);
+static void analyse_interesting_runtime_services(struct analysis_context *ctx);
+static int smm_service_index(ea_t offset);
+static const struct services_entry * lookup_smm_table(ea_t offset);
+static void make_smmservice_cmts(struct analysis_context *ctx);
+static void analyse_smm_refs(struct analysis_context *ctx);
+static void analyse_interesting_smm_services(struct analysis_context *ctx);
+static void print_smm_services_usage(struct analysis_context *ctx);
+static void print_smm_protocols_usage(struct analysis_context *ctx);
+static void log_smm_services_usage(struct analysis_context *ctx, FILE *output_file);
+static void log_smm_protocols_usage(struct analysis_context *ctx, FILE *output_file);
+static void sql_smm_services_usage(struct analysis_context *ctx);
+static void sql_smm_protocols_usage(struct analysis_context *ctx);
+static void analyse_pei_module(struct analysis_context *ctx);
+static void report_pei_module(struct analysis_context *ctx);
+static int locate_pei_services_refs(struct analysis_context *ctx);
+static void make_peiservice_cmts(struct analysis_context *ctx);
+static void analyse_pei_refs(struct analysis_context *ctx);
+static void analyse_interesting_pei_services(struct analysis_context *ctx);
+static void print_pei_services_usage(struct analysis_context *ctx);
+static void print_ppis_usage(struct analysis_context *ctx);
+static void log_pei_services_usage(struct analysis_context *ctx, FILE *output_file);
+static void log_ppis_usage(struct analysis_context *ctx, FILE *output_file);
+static void sql_pei_services_usage(struct analysis_context *ctx);
+static void sql_ppis_usage(struct analysis_context *ctx);
+
+/* x64 services tables are arrays of function pointers so offset / 8 is a direct index */
+#define SERVICES_INDEX_SLOTS        64
+
+/* table offset / 8 -> index into the services table, 0 is the failed service entry */
+static uint8_t g_boot_services_index[SERVICES_INDEX_SLOTS];
+static uint8_t g_runtime_services_index[SERVICES_INDEX_SLOTS];
+static uint8_t g_smm_services_index[SERVICES_INDEX_SLOTS];
+/* the PEI services table is IA32 so offset / 4 there */
+static uint8_t g_pei_services_index[SERVICES_INDEX_SLOTS];
+static int g_services_index_built;
+
+/* what the services idioms found */
+enum services_idiom
+{
+    kIdiomServicesCall = 0
+};
+
+/*
+ * calls through a services table held in a register
+ * the register was loaded from one of the table aliases or stored to it,
+ * maybe copied around first
+ */
+static const struct idiom_rule g_services_idioms[] =
+{
+    { "alias load", kIdiomServicesCall, "mov %a, [@] ; callni|jmpni [%a+*]" },
+    { "alias store", kIdiomServicesCall, "mov [@], %a ; callni|jmpni [%a+*]" },
+    { "alias load copy", kIdiomServicesCall, "mov %a, [@] ; mov %b, %a ; callni|jmpni [%b+*]" },
+    { "alias store copy", kIdiomServicesCall, "mov [@], %a ; mov %b, %a ; callni|jmpni [%b+*]" },
+    { "alias load copies", kIdiomServicesCall, "mov %a, [@] ; mov %b, %a ; mov %c, %b ; callni|jmpni [%c+*]" }
+};
+
+/* what the PEI idioms found */
+enum pei_idiom
+{
+    kIdiomPeiServicesCall = 0
+};
+
+/*
+ * calls through (**PeiServices), every PEI service takes the EFI_PEI_SERVICES**
+ * as its first argument so it's pushed last, next to the dereference
+ */
+static const struct idiom_rule g_pei_idioms[] =
+{
+    { "dereference then push", kIdiomPeiServicesCall, "mov %b, [%a] ; push %a ; callni [%b+0x18-0x64]" },
+    { "push then dereference", kIdiomPeiServicesCall, "push %a ; mov %b, [%a] ; callni [%b+0x18-0x64]" }
+};
+
+static struct idiom_automaton g_services_automaton;
+static struct idiom_automaton g_pei_automaton;
+static int g_services_automaton_built;
 
 extern sqlite3 *g_db_connection;
-char *g_target_guid;
 
+/*
+ * arg is the plugin run argument, the analysis is the same for every run mode
+ */
 void
-do_initial_checks(int arg)
+do_initial_checks(int /* arg */)
 {
-    /* get target name */
-    char *base_name = basename(command_line_file);
-    if (strcmp(base_name, "body.bin") == 0)
+    build_guid_index();
+    build_services_index();
+
+    struct analysis_context ctx;
+    if (init_analysis_context(&ctx) != 0)
     {
-        char *temp = basename(dirname(command_line_file));
-        size_t temp_len = strlen(temp);
-        g_target_guid = (char*)malloc(temp_len+1);
-        if (g_target_guid != NULL)
-        {
-            strlcpy(g_target_guid, temp, temp_len+1);
-        }
+        ERROR_MSG("Failed to initialize analysis context.");
+        return;
+    }
+    analyse_module(&ctx);
+    free_analysis_context(&ctx);
+}
+
+#pragma mark -
+#pragma mark Analysis context functions
+#pragma mark -
+
+/*
+ * start from a clean context and set the target name
+ */
+static int
+init_analysis_context(struct analysis_context *ctx)
+{
+    memset(ctx, 0, sizeof(struct analysis_context));
+    arena_init(&ctx->records, 0);
+    
+    /* get target name, from a copy since basename and dirname can modify it */
+    char input_path[QMAXPATH] = {0};
+    strlcpy(input_path, view_input_path(), sizeof(input_path));
+    char *base_name = basename(input_path);
+    /* modules taken out of a firmware volume know their own FFS GUID */
+    if (view_module_guid() != NULL)
+    {
+        base_name = (char*)view_module_guid();
+    }
+    /* otherwise the extractors name the directory after it */
+    else if (strcmp(base_name, "body.bin") == 0)
+    {
+        base_name = basename(dirname(input_path));
+    }
+    size_t temp_len = strlen(base_name);
+    ctx->target_guid = (char*)malloc(temp_len+1);
+    if (ctx->target_guid == NULL)
+    {
+        ERROR_MSG("Can't allocate memory for target name.");
+        return 1;
+    }
+    strlcpy(ctx->target_guid, base_name, temp_len+1);
+    return 0;
+}
+
+/*
+ * release everything the analysis stages allocated
+ */
+static void
+free_analysis_context(struct analysis_context *ctx)
+{
+    /* all list nodes live in the arena so they go away in one shot */
+    DEBUG_MSG("Analysis records arena: %lu bytes used (%lu reserved in %d blocks).",
+              (unsigned long)ctx->records.used, (unsigned long)ctx->records.reserved, ctx->records.nr_blocks);
+    arena_free(&ctx->records);
+    /* without the cache every instruction read is a decode_insn call */
+    DEBUG_MSG("Instruction cache: %lu decode_insn calls for %lu instruction reads in %u blocks.",
+              (unsigned long)ctx->insns.decoded, (unsigned long)ctx->insns.visited, ctx->insns.count);
+    free_args_cache(&ctx->args);
+    free_insn_cache(&ctx->insns);
+    free_guid_stats(&ctx->boot_services_stats.guid_stats);
+    free_guid_stats(&ctx->runtime_services_stats.guid_stats);
+    free_guid_stats(&ctx->smm_services_stats.guid_stats);
+    free_guid_stats(&ctx->pei_services_stats.guid_stats);
+    free_image_guids(&ctx->image_guids);
+    free_table_aliases(&ctx->table_aliases);
+    free_code_candidates(&ctx->code);
+    free(ctx->target_guid);
+    memset(ctx, 0, sizeof(struct analysis_context));
+}
+
+/*
+ * the output file lives next to the analysed binary
+ */
+static FILE *
+open_output_log(void)
+{
+    char input_path[QMAXPATH] = {0};
+    strlcpy(input_path, view_input_path(), sizeof(input_path));
+    char *input_dir = dirname(input_path);
+    char output_name[QMAXPATH] = {0};
+    /* a firmware image holds many modules, one output file each */
+    if (view_module_guid() != NULL)
+    {
+        qsnprintf(output_name, sizeof(output_name), "%s/%s.log", input_dir, view_module_guid());
     }
     else
     {
-        size_t temp_len = strlen(base_name);
-        g_target_guid = (char*)malloc(temp_len+1);
-        if (g_target_guid != NULL)
+        qsnprintf(output_name, sizeof(output_name), "%s/log", input_dir);
+    }
+    
+    FILE *output_file = qfopen(output_name, "w+");
+    if (output_file == NULL)
+    {
+        ERROR_MSG("Can't open log file: %s %s.", output_name, input_dir);
+    }
+    return output_file;
+}
+
+/*
+ * run all the analysis stages over the current IDA database
+ */
+static void
+analyse_module(struct analysis_context *ctx)
+{
+    ctx->arch = current_module_arch();
+    DEBUG_MSG("Module architecture: %s", ctx->arch->name);
+    find_image_guids(ctx);
+    /* not fatal, without candidates every function is decoded */
+    find_code_candidates(ctx->arch, &ctx->code);
+    ctx->format = current_image_format();
+    /* only SEC, PEI core and PEIMs are converted to TE */
+    if (ctx->format == kImageTE)
+    {
+        DEBUG_MSG("TE image, analysing as a PEI module.");
+        analyse_pei_module(ctx);
+        return;
+    }
+    /*
+     * 32 bit modules are PEIMs unless they load the services tables out of a system table
+     * the prefilter can miss a load so it only picks which one to try first
+     */
+    int pei_located = 0;
+    if (ctx->arch->stack_args && !has_services_table_loads(ctx))
+    {
+        if (locate_pei_services_refs(ctx) != 0)
         {
-            strlcpy(g_target_guid, base_name, temp_len+1);
+            ERROR_MSG("Failed to locate PEI services references.");
+            return;
+        }
+        if (ctx->pei_refs.head != NULL)
+        {
+            report_pei_module(ctx);
+            return;
         }
+        DEBUG_MSG("No PEI services calls found, looking for system tables.");
+        pei_located = 1;
     }
-
-    find_data_seg_guids();
-    if (find_system_tables() != 0)
+    if (find_system_tables(ctx) != 0)
     {
+        /* a 32 bit PEIM that happens to look like it */
+        if (ctx->arch->stack_args)
+        {
+            DEBUG_MSG("No system tables found, analysing as a PEI module.");
+            if (pei_located)
+            {
+                report_pei_module(ctx);
+            }
+            else
+            {
+                analyse_pei_module(ctx);
+            }
+            return;
+        }
         ERROR_MSG("Failed to find required system tables.");
         return;
     }
-    locate_boot_services_refs();
-    locate_runtime_services_refs();
-    make_bootservice_cmts();
-    make_runtimeservice_cmts();
+    locate_services_refs(ctx);
+    make_bootservice_cmts(ctx);
+    make_runtimeservice_cmts(ctx);
+    make_smmservice_cmts(ctx);
     
     if (g_config.generate_stats == 1)
     {
-        analyse_boot_refs();
-        analyse_runtime_refs();
-        analyse_interesting_boot_services();
-        analyse_interesting_runtime_services();
-        print_protocols_usage();
-        print_boot_services_usage();
-        print_runtime_services_usage();
+        analyse_boot_refs(ctx);
+        analyse_runtime_refs(ctx);
+        analyse_smm_refs(ctx);
+        analyse_interesting_boot_services(ctx);
+        analyse_interesting_runtime_services(ctx);
+        analyse_interesting_smm_services(ctx);
+        print_protocols_usage(ctx);
+        print_boot_services_usage(ctx);
+        print_runtime_services_usage(ctx);
+        print_table_aliases_usage(ctx);
+        /* only SMM drivers have gSmst */
+        if (ctx->smm_refs.head != NULL)
+        {
+            print_smm_protocols_usage(ctx);
+            print_smm_services_usage(ctx);
+        }
         
         if (g_config.output_log == 1)
         {
-            char output_name[QMAXPATH] = {0};
-            qsnprintf(output_name, sizeof(output_name), "%s/log", dirname(command_line_file));
-            
-            FILE *output_file = qfopen(output_name, "w+");
+            FILE *output_file = open_output_log();
             if (output_file == NULL)
             {
-                ERROR_MSG("Can't open log file: %s %s.", output_name, dirname(command_line_file) );
                 return;
             }
             
-            log_boot_services_usage(output_file);
-            log_runtime_services_usage(output_file);
-            log_protocols_usage(output_file);
+            log_boot_services_usage(ctx, output_file);
+            log_runtime_services_usage(ctx, output_file);
+            log_protocols_usage(ctx, output_file);
+            log_table_aliases_usage(ctx, output_file);
+            if (ctx->smm_refs.head != NULL)
+            {
+                log_smm_services_usage(ctx, output_file);
+                log_smm_protocols_usage(ctx, output_file);
+            }
             qfclose(output_file);
         }
     }
     if (g_config.output_sql)
     {
         open_db();
-        sql_file_entry();
-        sql_protocols_usage();
-        sql_boot_services_usage();
-        sql_runtime_services_usage();
+        sql_file_entry(ctx);
+        sql_protocols_usage(ctx);
+        sql_boot_services_usage(ctx);
+        sql_runtime_services_usage(ctx);
+        if (ctx->smm_refs.head != NULL)
+        {
+            sql_smm_protocols_usage(ctx);
+            sql_smm_services_usage(ctx);
+        }
         close_db();
     }
 }
 
-#pragma mark -
-#pragma mark Functions to locate system tables
-#pragma mark -
+/*
+ * the PEI version of the analysis stages
+ * PEIMs don't have system tables, every service call goes through the
+ * EFI_PEI_SERVICES** the PEI Foundation passes around
+ */
+static void
+analyse_pei_module(struct analysis_context *ctx)
+{
+    if (locate_pei_services_refs(ctx) != 0)
+    {
+        ERROR_MSG("Failed to locate PEI services references.");
+        return;
+    }
+    report_pei_module(ctx);
+}
 
 /*
- * auxiliary function to locate the Boot Services table
- * via the offsets
+ * comments, stats and database output for the PEI services references already located
  */
-static int
-locate_bootservices_table(ea_t start_addr, ea_t end_addr, ea_t *out_addr)
+static void
+report_pei_module(struct analysis_context *ctx)
 {
-    uint16_t boot_register = 0;
-    int found_boot = 0;
-    ea_t current_addr = start_addr;
-    /* locate the boot services table */
-    do
+    make_peiservice_cmts(ctx);
+    
+    if (g_config.generate_stats == 1)
     {
-        decode_insn(current_addr);
-        /* we are looking for a mov instruction that involves the RDX register and Boot Services offset in System table */
-        if (cmd.itype == NN_mov && cmd.Operands[1].type == o_displ && cmd.Operands[1].phrase == 0x2)
-        {
-            if (cmd.Operands[0].type == o_reg && cmd.Operands[1].addr == 0x60)
-            {
-                boot_register = cmd.Operands[0].reg;
-                found_boot = 1;
-            }
-        }
-        /* we found the correct offset so verify if it's the right instruction and label it */
-        if (found_boot)
+        analyse_pei_refs(ctx);
+        analyse_interesting_pei_services(ctx);
+        print_ppis_usage(ctx);
+        print_pei_services_usage(ctx);
+        
+        if (g_config.output_log == 1)
         {
-            if (cmd.itype == NN_mov && cmd.Operands[1].type == o_reg && cmd.Operands[1].reg == boot_register && cmd.Operands[0].type == o_mem)
+            FILE *output_file = open_output_log();
+            if (output_file == NULL)
             {
-                DEBUG_MSG("Found boot storage at 0x%llx Type: %x Address: 0x%llx", current_addr, cmd.Operands[0].type, cmd.Operands[0].addr);
-                set_name(cmd.Operands[0].addr, "BootServices_table", SN_CHECK);
-                *out_addr = cmd.Operands[0].addr;
-                break;
+                return;
             }
+            
+            log_pei_services_usage(ctx, output_file);
+            log_ppis_usage(ctx, output_file);
+            qfclose(output_file);
         }
-    } while ((current_addr = find_code(current_addr, SEARCH_DOWN)) != BADADDR && current_addr <= end_addr);
-    
-    /* failure */
-    if (found_boot == 0)
+    }
+    if (g_config.output_sql)
     {
-        return 1;
+        open_db();
+        sql_file_entry(ctx);
+        sql_ppis_usage(ctx);
+        sql_pei_services_usage(ctx);
+        close_db();
     }
-    /* success */
-    return 0;
 }
 
+#pragma mark -
+#pragma mark Functions to locate system tables
+#pragma mark -
+
 /*
- * auxiliary function to locate the RunTime Services table
- * via the offsets
+ * label a global holding a system table, numbering the extra aliases
  */
-static int
-locate_runtimeservices_table(ea_t start_addr, ea_t end_addr, ea_t *out_addr)
+static void
+name_table_alias(ea_t address, const char *name, int nr)
 {
-    uint16_t runtime_register = 0;
-    int found_runtime = 0;
-    ea_t current_addr = start_addr;
-
-    do
+    char alias_name[MAXNAMELEN] = {0};
+    if (nr == 0)
     {
-        decode_insn(current_addr);
-        if (cmd.itype == NN_mov && cmd.Operands[1].type == o_displ && cmd.Operands[1].phrase == 0x2)
-        {
-            if (cmd.Operands[0].type == o_reg && cmd.Operands[1].addr == 0x58)
-            {
-                runtime_register = cmd.Operands[0].reg;
-                found_runtime = 1;
-            }
-        }
-        if (found_runtime)
-        {
-            if (cmd.itype == NN_mov && cmd.Operands[1].type == o_reg && cmd.Operands[1].reg == runtime_register && cmd.Operands[0].type == o_mem)
-            {
-                DEBUG_MSG("Found runtime storage at 0x%llx", current_addr);
-                set_name(cmd.Operands[0].addr, "RunTimeServices_table", SN_CHECK);
-                *out_addr = cmd.Operands[0].addr;
-                break;
-            }
-        }
-    } while ((current_addr = find_code(current_addr, SEARCH_DOWN)) != BADADDR && current_addr <= end_addr);
-    
-    if (found_runtime == 0)
+        qsnprintf(alias_name, sizeof(alias_name), "%s", name);
+    }
+    else
     {
-        return 1;
+        qsnprintf(alias_name, sizeof(alias_name), "%s_%d", name, nr);
     }
-    /* success */
-    return 0;
+    view_set_name(address, alias_name);
+}
+
+/*
+ * is there any load of the boot or runtime services tables pointers in the code
+ */
+static int
+has_services_table_loads(struct analysis_context *ctx)
+{
+    struct binary_segment seg_info;
+    if (view_segment_by_name(".text", &seg_info) != 0)
+    {
+        return 0;
+    }
+    return has_code_candidates(&ctx->code, seg_info.start, seg_info.end, kPatternBootLoad | kPatternRuntimeLoad);
 }
 
 /*
@@ -378,26 +713,28 @@ locate_runtimeservices_table(ea_t start_addr, ea_t end_addr, ea_t *out_addr)
  *
  */
 static int
-find_system_tables(void)
+find_system_tables(struct analysis_context *ctx)
 {
-    segment_t *seg_info = get_segm_by_name(".text");
-    if (seg_info == NULL)
+    struct binary_segment seg_info;
+    if (view_segment_by_name(".text", &seg_info) != 0)
     {
         ERROR_MSG("Can't find a valid code segment!");
         return 1;
     }
     
     /* locate start() */
-    func_t *f = NULL;
+    struct binary_function f;
     int found = 0;
-    for (int idx = 0; idx < get_func_qty(); idx++)
+    for (size_t idx = 0; idx < view_function_count(); idx++)
     {
         char fname[1024] = {0};
-        f = getn_func(idx);
-        get_func_name(f->startEA, fname, sizeof(fname));
+        if (view_function_at(idx, &f) != 0 || view_get_name(f.start, fname, sizeof(fname)) != 0)
+        {
+            continue;
+        }
         if (strcmp(fname, "start") == 0 || strcmp(fname, "_ModuleEntryPoint") == 0)
         {
-            DEBUG_MSG("Found function %s at %llx", fname, f->startEA);
+            DEBUG_MSG("Found function %s at %llx", fname, f.start);
             found = 1;
             break;
         }
@@ -409,67 +746,51 @@ find_system_tables(void)
         return 1;
     }
     
-    /* we found start() so start looking for the tables */
+    /* we found start() so follow the system table from there */
+    if (find_table_aliases(&ctx->insns, ctx->arch, f.start, &ctx->table_aliases) != 0)
+    {
+        return 1;
+    }
     
-    int ret = 0;
-    ret = locate_bootservices_table(f->startEA, f->endEA, &bootservices_ptr);
-    /* try alternative method - there might be a call processing it */
-    if (ret != 0)
+    int nr_system = 0;
+    int nr_boot = 0;
+    int nr_runtime = 0;
+    int nr_smm = 0;
+    int nr_smm_base = 0;
+    for (size_t i = 0; i < ctx->table_aliases.count; i++)
     {
-        DEBUG_MSG("Trying to locate boot services inside functions");
-        ea_t current_addr = f->startEA;
-        while ((current_addr = find_code(current_addr, SEARCH_DOWN)) != BADADDR && current_addr <= f->endEA)
+        const struct table_alias *alias = &ctx->table_aliases.aliases[i];
+        DEBUG_MSG("Found system table alias at 0x%llx Tables: %x", (unsigned long long)alias->address, alias->tables);
+        /* a global that can hold different tables is most likely a generic pointer */
+        if (alias->tables == TABLE_SYSTEM)
         {
-            decode_insn(current_addr);
-            if (cmd.itype == NN_call) // XXX: call types? near? far?
-            {
-                func_t *call_f = NULL;
-                call_f = get_func(cmd.Operands[0].addr);
-                if (call_f == NULL)
-                {
-                    continue;
-                }
-                /* try to locate the boot table inside, stop if successful */
-                if (locate_bootservices_table(call_f->startEA, call_f->endEA, &bootservices_ptr) == 0)
-                {
-                    break;
-                }
-            }
+            name_table_alias(alias->address, "SystemTable", nr_system++);
+        }
+        else if (alias->tables == TABLE_BOOT)
+        {
+            name_table_alias(alias->address, "BootServices_table", nr_boot++);
+        }
+        else if (alias->tables == TABLE_RUNTIME)
+        {
+            name_table_alias(alias->address, "RunTimeServices_table", nr_runtime++);
+        }
+        else if (alias->tables == TABLE_SMM)
+        {
+            name_table_alias(alias->address, "gSmst", nr_smm++);
+        }
+        else if (alias->tables == TABLE_SMM_BASE2)
+        {
+            name_table_alias(alias->address, "SmmBase2", nr_smm_base++);
         }
     }
     
-    if (bootservices_ptr == 0)
+    if (nr_boot == 0)
     {
         ERROR_MSG("Can't locate boot services table pointer.");
         return 1;
     }
     
-    ret = locate_runtimeservices_table(f->startEA, f->endEA, &runtimeservices_ptr);
-    if (ret != 0)
-    {
-        DEBUG_MSG("Trying to locate runtime services inside functions");
-        ea_t current_addr = f->startEA;
-        while ((current_addr = find_code(current_addr, SEARCH_DOWN)) != BADADDR && current_addr <= f->endEA)
-        {
-            decode_insn(current_addr);
-            if (cmd.itype == NN_call) // XXX: call types? near? far?
-            {
-                func_t *call_f = NULL;
-                call_f = get_func(cmd.Operands[0].addr);
-                if (call_f == NULL)
-                {
-                    continue;
-                }
-                /* try to locate the runtime table inside, stop if successful */
-                if (locate_runtimeservices_table(call_f->startEA, call_f->endEA, &runtimeservices_ptr) == 0)
-                {
-                    break;
-                }
-            }
-        }
-    }
-    
-    if (runtimeservices_ptr == 0)
+    if (nr_runtime == 0)
     {
         ERROR_MSG("Can't locate runtime services table pointer.");
         return 1;
@@ -480,583 +801,1066 @@ find_system_tables(void)
 }
 
 /*
- * function to lookup the Boot Services table via offset
+ * build the offset to index tables for boot and runtime services
+ * the tables are static so this only needs to happen once
  */
-static const struct services_entry
-lookup_boot_table(ea_t offset)
+static void
+build_services_index(void)
 {
-    size_t array_size = sizeof(boot_services_table) / sizeof(*boot_services_table);
-    for (int i = 0; i < array_size; i++)
+    if (g_services_index_built)
+    {
+        return;
+    }
+    
+    /* skip the failed and empty entries, they all have offset 0 */
+    for (size_t i = 1; i < BOOT_SERVICES_ENTRIES; i++)
+    {
+        uint32_t slot = boot_services_table[i].offset / 8;
+        if (boot_services_table[i].offset != 0 && slot < SERVICES_INDEX_SLOTS)
+        {
+            g_boot_services_index[slot] = i;
+        }
+    }
+    for (size_t i = 1; i < RUNTIME_SERVICES_ENTRIES; i++)
+    {
+        uint32_t slot = runtime_services_table[i].offset / 8;
+        if (runtime_services_table[i].offset != 0 && slot < SERVICES_INDEX_SLOTS)
+        {
+            g_runtime_services_index[slot] = i;
+        }
+    }
+    for (size_t i = 1; i < SMM_SERVICES_ENTRIES; i++)
+    {
+        uint32_t slot = smm_services_table[i].offset / 8;
+        if (smm_services_table[i].offset != 0 && slot < SERVICES_INDEX_SLOTS)
+        {
+            g_smm_services_index[slot] = i;
+        }
+    }
+    for (size_t i = 1; i < PEI_SERVICES_ENTRIES; i++)
     {
-        if (boot_services_table[i].offset == offset)
+        uint32_t slot = pei_services_table[i].offset / 4;
+        if (pei_services_table[i].offset != 0 && slot < SERVICES_INDEX_SLOTS)
         {
-            return boot_services_table[i];
+            g_pei_services_index[slot] = i;
         }
     }
-    /* failure */
-    return boot_services_table[0];
+    g_services_index_built = 1;
 }
 
 /*
- * function to lookup the RunTime Services table via offset
- *
+ * return the Boot Services table index for an offset
+ * 0 (failed service) if the offset isn't a known service
  */
-static const struct services_entry
-lookup_runtime_table(ea_t offset)
+static int
+boot_service_index(ea_t offset)
 {
-    size_t array_size = sizeof(runtime_services_table) / sizeof(*runtime_services_table);
-    for (int i = 0; i < array_size; i++)
+    if ((offset & 7) != 0 || offset / 8 >= SERVICES_INDEX_SLOTS)
     {
-        if (runtime_services_table[i].offset == offset)
-        {
-            return runtime_services_table[i];
-        }
+        return 0;
     }
-    /* failure */
-    return runtime_services_table[0];
+    return g_boot_services_index[offset / 8];
 }
 
-static void
-add_guid_stats_entry(enum system_services type, EFI_GUID *guid)
+/*
+ * return the RunTime Services table index for an offset
+ * 0 (failed service) if the offset isn't a known service
+ */
+static int
+runtime_service_index(ea_t offset)
 {
-    struct guid_stats *stats_entry = NULL;
-    int found_stats = 0;
-    LL_FOREACH(g_boot_services_stats.guid_stats_head, stats_entry)
+    if ((offset & 7) != 0 || offset / 8 >= SERVICES_INDEX_SLOTS)
     {
-        if (stats_entry->type == type && memcmp((void*)&stats_entry->guid, (void*)guid, sizeof(EFI_GUID)) == 0)
-        {
-            stats_entry->count++;
-            found_stats = 1;
-        }
+        return 0;
     }
-    if (found_stats == 0)
+    return g_runtime_services_index[offset / 8];
+}
+
+/*
+ * return the SMM Services table index for an offset
+ * 0 (failed service) if the offset isn't a known service
+ */
+static int
+smm_service_index(ea_t offset)
+{
+    if ((offset & 7) != 0 || offset / 8 >= SERVICES_INDEX_SLOTS)
     {
-        struct guid_stats *stats_new_entry = (struct guid_stats*)malloc(sizeof(struct guid_stats));
-        if (stats_new_entry != NULL)
-        {
-            memcpy((void*)&stats_new_entry->guid, (void*)guid, sizeof(EFI_GUID));
-            stats_new_entry->count = 1;
-            stats_new_entry->type = type;
-            LL_APPEND(g_boot_services_stats.guid_stats_head, stats_new_entry);
-        }
+        return 0;
     }
+    return g_smm_services_index[offset / 8];
 }
 
 /*
- * function to process the calls to interesting boot services we want to gather stats on
+ * return the PEI Services table index for an offset
+ * 0 (failed service) if the offset isn't a known service
  */
-static void
-analyse_interesting_boot_services(void)
+static int
+pei_service_index(ea_t offset)
 {
-    struct analysis_entry *entry = NULL;
-    /* process LocateProtocol() Boot service */
+    if ((offset & 3) != 0 || offset / 4 >= SERVICES_INDEX_SLOTS)
+    {
+        return 0;
+    }
+    return g_pei_services_index[offset / 4];
+}
+
+/*
+ * function to lookup the Boot Services table via offset
+ */
+static const struct services_entry *
+lookup_boot_table(ea_t offset)
+{
+    return &boot_services_table[boot_service_index(offset)];
+}
+
+/*
+ * function to lookup the RunTime Services table via offset
+ *
+ */
+static const struct services_entry *
+lookup_runtime_table(ea_t offset)
+{
+    return &runtime_services_table[runtime_service_index(offset)];
+}
+
+static const struct services_entry *
+lookup_smm_table(ea_t offset)
+{
+    return &smm_services_table[smm_service_index(offset)];
+}
+
+static const struct pei_services_entry *
+lookup_pei_table(ea_t offset)
+{
+    return &pei_services_table[pei_service_index(offset)];
+}
+
+/*
+ * decoded instructions around a call site so we can solve its arguments
+ * outside of a function we go back max_nr_insts code heads at most
+ */
+static const struct insn_block *
+caller_insns(struct analysis_context *ctx, ea_t address, int max_nr_insts)
+{
+    const struct insn_block *block = cache_function_insns(&ctx->insns, address);
+    if (block == NULL)
+    {
+        ea_t start_addr = address;
+        for (int i = 0; i < max_nr_insts; i++)
+        {
+            ea_t prev_addr = view_prev_code(start_addr);
+            if (prev_addr == BADADDR)
+            {
+                break;
+            }
+            start_addr = prev_addr;
+        }
+        block = cache_range_insns(&ctx->insns, start_addr, address);
+    }
+    return block;
+}
+
+/*
+ * the description of the argument passed in each register
+ */
+static const char *
+register_param(const struct services_entry *service, int arg)
+{
+    switch (arg)
+    {
+        case kArgRCX:
+            return service->rcx_param;
+        case kArgRDX:
+            return service->rdx_param;
+        case kArgR8:
+            return service->r8_param;
+        case kArgR9:
+            return service->r9_param;
+        default:
+            return "";
+    }
+}
+
+/*
+ * a pointer to a single GUID and not to an array of them
+ */
+static int
+is_guid_param(const char *param)
+{
+    const char *guid = strstr(param, "EFI_GUID *");
+    return guid != NULL && guid[strlen("EFI_GUID *")] != '*';
+}
+
+/*
+ * retrieve the GUIDs passed to a service call
+ * the service prototype tells us which arguments are GUIDs and the
+ * argument registers dataflow where they point to
+ * returns the number of GUIDs found
+ */
+static int
+analyse_guid_args(struct analysis_context *ctx, const struct analysis_entry *entry, struct guid_stats_map *stats)
+{
+    const struct insn_block *block = caller_insns(ctx, entry->address, MAX_ARGS_SEARCH);
+    if (block == NULL)
+    {
+        return 0;
+    }
+    const struct call_args *args = lookup_call_args(&ctx->args, &ctx->insns, block, entry->address);
+    if (args == NULL)
+    {
+        return 0;
+    }
+    
+    /* IA32 pushes every argument, push offset guid is an immediate */
+    int stack_args = ctx->arch->stack_args;
+    const struct reg_value *values = stack_args ? args->stack : args->regs;
+    int max_args = stack_args ? NR_STACK_ARGS : NR_ARG_REGISTERS;
+    
+    int found = 0;
+    int nr_args = entry->service->nr_args < (uint32_t)max_args ? (int)entry->service->nr_args : max_args;
+    for (int i = 0; i < nr_args; i++)
+    {
+        const char *param = register_param(entry->service, i);
+        if (!is_guid_param(param))
+        {
+            continue;
+        }
+        const struct reg_value *value = &values[i];
+        if (value->kind != kValueAddress && !(stack_args && value->kind == kValueImmediate))
+        {
+            DEBUG_MSG("Can't resolve %s argument to %s() at 0x%llx", param, entry->service->name, entry->address);
+            continue;
+        }
+        /* retrieve the GUID being used */
+        EFI_GUID current_guid = {0, 0, 0, {0}};
+        read_image_guid(&ctx->image_guids, value->value, &current_guid);
+        if (current_guid.Data1 == 0x0 ||  current_guid.Data1 == 0xFFFFFFFF)
+        {
+            ERROR_MSG("Invalid data retrieved, failed to identify GUID? Address: 0x%llx", value->def_addr);
+            continue;
+        }
+        if (add_guid_stats(stats, entry->type, &current_guid) == NULL)
+        {
+            ERROR_MSG("Can't allocate memory for GUID stats.");
+        }
+        /* make a comment with the GUID where it's loaded */
+        if (g_config.comment_guid == 1)
+        {
+            make_guid_cmt(&current_guid, value->def_addr);
+        }
+        found++;
+    }
+    return found;
+}
+
+/*
+ * function to process the calls to interesting boot services we want to gather stats on
+ */
+static void
+analyse_interesting_boot_services(struct analysis_context *ctx)
+{
+    struct analysis_entry *entry = NULL;
+    LL_FOREACH(ctx->boot_services_stats.analysis_head, entry)
+    {
+        DEBUG_MSG("%s() entry at 0x%llx", entry->service->name, entry->address);
+        int found = analyse_guid_args(ctx, entry, &ctx->boot_services_stats.guid_stats);
+        /* XXX: for InstallMultipleProtocolInterfaces() let's assume only one protocol is installed
+         * because this version is recommended due to more error checking that InstallProtocol
+         */
+        if (found > 0 && (entry->type == kInstallProcotol || entry->type == kInstallMultiProtocol))
+        {
+            ctx->boot_services_stats.installed_protocols++;
+        }
+    }
+}
+
+/*
+ * function to go over all detected boot services references and comment it
+ * based on configuration settings
+ */
+static void
+make_bootservice_cmts(struct analysis_context *ctx)
+{
+    struct service_refs *ref_entry = NULL;
+    LL_FOREACH(ctx->boot_refs.head, ref_entry)
+    {
+        char address_string[4096] = {0};
+        int length = 0;
+        const struct services_entry *table_entry = lookup_boot_table(ref_entry->offset);
+        if (g_config.comment_description == 1 && g_config.comment_prototype == 0)
+        {
+            length = qsnprintf(address_string, sizeof(address_string), "BootServices->%s()\n\n%s", table_entry->name, table_entry->description);
+        }
+        else if (g_config.comment_description == 0 && g_config.comment_prototype == 1)
+        {
+            length = qsnprintf(address_string, sizeof(address_string), "BootServices->%s()\n\n%s\n\n%s", table_entry->name, table_entry->prototype, table_entry->parameters);
+        }
+        else if (g_config.comment_description == 1 && g_config.comment_prototype == 1)
+        {
+            length = qsnprintf(address_string, sizeof(address_string), "BootServices->%s()\n\n%s\n\n%s\n\n%s", table_entry->name, table_entry->prototype, table_entry->description, table_entry->parameters);
+        }
+        else
+        {
+            length = qsnprintf(address_string, sizeof(address_string), "BootServices->%s()", table_entry->name);
+        }
+        /* the longest descriptions don't fit, the comment is still useful without the end */
+        if (length < 0 || (size_t)length >= sizeof(address_string) - 1)
+        {
+            DEBUG_MSG("Comment for %s() at 0x%llx truncated.", table_entry->name, (unsigned long long)ref_entry->ref_addr);
+        }
         
-    /* first thing is to find out which GUIDs are used in LocateProtocol() */
-    LL_FOREACH(g_boot_services_stats.analysis_head, entry)
-    {
-        DEBUG_MSG("Locate protocol entry at 0x%llx", entry->address);
-        /* find and track the GUID */
-        ea_t current_addr = entry->address;
-        /* max number of instructions backwards we want to search */
-        int max_nr_insts = 32;
+        view_set_comment(ref_entry->ref_addr, address_string);
+    }
+}
+
+/*
+ * auxiliary function to comment a RunTime Service call
+ * based on configuration settings
+ */
+static void
+make_runtimeservice_cmts(struct analysis_context *ctx)
+{
+    struct service_refs *ref_entry = NULL;
+    LL_FOREACH(ctx->runtime_refs.head, ref_entry)
+    {
+        char address_string[4096] = {0};
+        int length = 0;
+        const struct services_entry *table_entry = lookup_runtime_table(ref_entry->offset);
+        if (g_config.comment_description == 1 && g_config.comment_prototype == 0)
+        {
+            length = qsnprintf(address_string, sizeof(address_string), "RunTimeServices->%s()\n\n%s", table_entry->name, table_entry->description);
+        }
+        else if (g_config.comment_description == 0 && g_config.comment_prototype == 1)
+        {
+            length = qsnprintf(address_string, sizeof(address_string), "RunTimeServices->%s()\n\n%s\n\n%s", table_entry->name, table_entry->prototype, table_entry->parameters);
+        }
+        else if (g_config.comment_description == 1 && g_config.comment_prototype == 1)
+        {
+            length = qsnprintf(address_string, sizeof(address_string), "RunTimeServices->%s()\n\n%s\n\n%s\n\n%s", table_entry->name, table_entry->prototype, table_entry->description, table_entry->parameters);
+        }
+        else
+        {
+            length = qsnprintf(address_string, sizeof(address_string), "RunTimeServices->%s()", table_entry->name);
+        }
+        /* the longest descriptions don't fit, the comment is still useful without the end */
+        if (length < 0 || (size_t)length >= sizeof(address_string) - 1)
+        {
+            DEBUG_MSG("Comment for %s() at 0x%llx truncated.", table_entry->name, (unsigned long long)ref_entry->ref_addr);
+        }
         
-        EFI_GUID current_guid = {0};
-        while ((current_addr = find_code(current_addr, SEARCH_UP)) != BADADDR && max_nr_insts > 0)
+        view_set_comment(ref_entry->ref_addr, address_string);
+    }
+}
+
+/*
+ * auxiliary function to comment a SMM Service call
+ * based on configuration settings
+ */
+static void
+make_smmservice_cmts(struct analysis_context *ctx)
+{
+    struct service_refs *ref_entry = NULL;
+    LL_FOREACH(ctx->smm_refs.head, ref_entry)
+    {
+        char address_string[4096] = {0};
+        int length = 0;
+        const struct services_entry *table_entry = lookup_smm_table(ref_entry->offset);
+        if (g_config.comment_description == 1 && g_config.comment_prototype == 0)
+        {
+            length = qsnprintf(address_string, sizeof(address_string), "gSmst->%s()\n\n%s", table_entry->name, table_entry->description);
+        }
+        else if (g_config.comment_description == 0 && g_config.comment_prototype == 1)
+        {
+            length = qsnprintf(address_string, sizeof(address_string), "gSmst->%s()\n\n%s\n\n%s", table_entry->name, table_entry->prototype, table_entry->parameters);
+        }
+        else if (g_config.comment_description == 1 && g_config.comment_prototype == 1)
+        {
+            length = qsnprintf(address_string, sizeof(address_string), "gSmst->%s()\n\n%s\n\n%s\n\n%s", table_entry->name, table_entry->prototype, table_entry->description, table_entry->parameters);
+        }
+        else
         {
-            decode_insn(current_addr);
-            /* LocateProtocol() */
-            if (entry->type == kLocateProtocol)
+            length = qsnprintf(address_string, sizeof(address_string), "gSmst->%s()", table_entry->name);
+        }
+        /* the longest descriptions don't fit, the comment is still useful without the end */
+        if (length < 0 || (size_t)length >= sizeof(address_string) - 1)
+        {
+            DEBUG_MSG("Comment for %s() at 0x%llx truncated.", table_entry->name, (unsigned long long)ref_entry->ref_addr);
+        }
+        
+        view_set_comment(ref_entry->ref_addr, address_string);
+    }
+}
+
+/*
+ * add a services call to its table references list
+ */
+static void
+add_service_ref(struct analysis_context *ctx, enum table_kind table, ea_t offset, ea_t ref_addr)
+{
+    struct service_refs *new_ref_entry = (struct service_refs*)arena_alloc(&ctx->records, sizeof(struct service_refs));
+    if (new_ref_entry == NULL)
+    {
+        ERROR_MSG("Can't allocate memory for service reference.");
+        return;
+    }
+    new_ref_entry->offset = offset;
+    new_ref_entry->ref_addr = ref_addr;
+    struct service_refs_list *refs = &ctx->runtime_refs;
+    if (table == kTableBoot)
+    {
+        refs = &ctx->boot_refs;
+    }
+    else if (table == kTableSmm)
+    {
+        refs = &ctx->smm_refs;
+    }
+    else if (table == kTablePei)
+    {
+        refs = &ctx->pei_refs;
+    }
+    LL_APPEND_TAIL(refs->head, refs->tail, new_ref_entry);
+}
+
+/*
+ * which services table an alias holds
+ * globals that can hold more than one table are of no use to us
+ */
+static enum table_kind
+alias_table_kind(const struct table_alias *alias)
+{
+    if (alias == NULL)
+    {
+        return kTableNone;
+    }
+    if (alias->tables == TABLE_BOOT)
+    {
+        return kTableBoot;
+    }
+    if (alias->tables == TABLE_RUNTIME)
+    {
+        return kTableRunTime;
+    }
+    if (alias->tables == TABLE_SMM)
+    {
+        return kTableSmm;
+    }
+    return kTableNone;
+}
+
+/*
+ * the table kind as printed in the aliases usage tables
+ */
+static const char *
+table_kind_name(enum table_kind table)
+{
+    switch (table)
+    {
+        case kTableBoot:
+            return "Boot";
+        case kTableRunTime:
+            return "RunTime";
+        case kTablePei:
+            return "PEI";
+        case kTableSmm:
+            return "SMST";
+        default:
+            return "";
+    }
+}
+
+/*
+ * the services table alias stored at address, if any
+ */
+static struct table_alias *
+table_at(struct analysis_context *ctx, ea_t address)
+{
+    struct table_alias *alias = lookup_table_alias(&ctx->table_aliases, address);
+    return alias_table_kind(alias) != kTableNone ? alias : NULL;
+}
+
+/*
+ * the services idioms automatons are static so this only needs to happen once
+ */
+static int
+build_services_idioms(void)
+{
+    if (g_services_automaton_built)
+    {
+        return 0;
+    }
+    if (compile_idioms(g_services_idioms, sizeof(g_services_idioms) / sizeof(*g_services_idioms), &g_services_automaton) != 0)
+    {
+        return 1;
+    }
+    if (compile_idioms(g_pei_idioms, sizeof(g_pei_idioms) / sizeof(*g_pei_idioms), &g_pei_automaton) != 0)
+    {
+        free_idioms(&g_services_automaton);
+        return 1;
+    }
+    g_services_automaton_built = 1;
+    return 0;
+}
+
+/* the [@] operands of the services idioms are the table aliases */
+static int
+services_alias_filter(ea_t address, void *context)
+{
+    return table_at((struct analysis_context*)context, address) != NULL;
+}
+
+static void
+services_idiom_found(const struct idiom_match *match, void *context)
+{
+    struct analysis_context *ctx = (struct analysis_context*)context;
+    if (match->rule->action != kIdiomServicesCall)
+    {
+        return;
+    }
+    /* the alias is the memory operand of the first step, the call is the last one */
+    const struct cached_insn *first = match->insns[0];
+    const struct cached_insn *call = match->insns[match->nr_steps - 1];
+    struct table_alias *alias = table_at(ctx, first->ops[0].type == kOpMem ? first->ops[0].addr : first->ops[1].addr);
+    if (alias == NULL)
+    {
+        return;
+    }
+    /* the IA32 tables have 4 bytes entries, the services tables are described with the x64 offsets */
+    ea_t offset = canonical_service_offset(ctx->arch, call->ops[0].addr);
+    if (offset == BADADDR)
+    {
+        return;
+    }
+    alias->hits++;
+    add_service_ref(ctx, alias_table_kind(alias), offset, call->ea);
+}
+
+/* code swept for services calls, [start, end) */
+struct sweep_range
+{
+    ea_t start;
+    ea_t end;
+};
+
+static int
+compare_sweep_ranges(const void *a, const void *b)
+{
+    const struct sweep_range *range_a = (const struct sweep_range *)a;
+    const struct sweep_range *range_b = (const struct sweep_range *)b;
+    if (range_a->start != range_b->start)
+    {
+        return range_a->start < range_b->start ? -1 : 1;
+    }
+    if (range_a->end != range_b->end)
+    {
+        return range_a->end < range_b->end ? -1 : 1;
+    }
+    return 0;
+}
+
+/*
+ * locate call references to the boot, runtime and SMM services tables
+ * this is what we use to find out where are all the calls to the services
+ *
+ * the xrefs of every table alias are gathered first so a function that
+ * references several of them is still swept only once
+ */
+static int
+locate_services_refs(struct analysis_context *ctx)
+{
+    DEBUG_MSG("Looking up Boot, RunTime and SMM Services references...");
+    
+    if (build_services_idioms() != 0)
+    {
+        return 1;
+    }
+    
+    struct sweep_range *ranges = NULL;
+    size_t nr_ranges = 0;
+    size_t capacity = 0;
+    
+    for (size_t t = 0; t < ctx->table_aliases.count; t++)
+    {
+        const struct table_alias *alias = &ctx->table_aliases.aliases[t];
+        if (alias_table_kind(alias) == kTableNone)
+        {
+            continue;
+        }
+        for (ea_t ref_to_table = view_first_ref_to(alias->address); ref_to_table != BADADDR;
+             ref_to_table = view_next_ref_to(alias->address, ref_to_table))
+        {
+            if (nr_ranges == capacity)
             {
-                /* GUID pointer is loaded into RCX, the first argument to LocateProtocol() */
-                if (cmd.itype == NN_lea && cmd.Operands[0].type == o_reg && cmd.Operands[0].reg == REG_RCX)
+                size_t new_capacity = capacity ? capacity * 2 : 64;
+                struct sweep_range *new_ranges = (struct sweep_range*)realloc(ranges, new_capacity * sizeof(struct sweep_range));
+                if (new_ranges == NULL)
                 {
-                    ea_t target_guid_addr = cmd.Operands[1].addr;
-                    /* retrieve the GUID being used and store in the structure field */
-                    get_many_bytes(target_guid_addr, (void*)&current_guid, sizeof(EFI_GUID));
-                    if (current_guid.Data1 == 0x0 ||  current_guid.Data1 == 0xFFFFFFFF)
-                    {
-                        ERROR_MSG("Invalid data retrieved, failed to identify GUID? Address: 0x%llx", current_addr);
-                        break;
-                    }
-                    add_guid_stats_entry(kLocateProtocol, &current_guid);
-                    /* make a comment with the GUID where it's loaded */
-                    if (g_config.comment_guid == 1)
-                    {
-                        make_guid_cmt(&current_guid, current_addr);
-                    }
-                    break;
+                    ERROR_MSG("Can't allocate memory for services references sweep.");
+                    free(ranges);
+                    return 1;
                 }
+                ranges = new_ranges;
+                capacity = new_capacity;
+            }
+            /* sweep the reference's function, or the next 64 bytes if there's none */
+            struct binary_function f;
+            int has_function = view_function_containing(ref_to_table, &f) == 0;
+            ranges[nr_ranges].start = has_function ? f.start : ref_to_table;
+            ranges[nr_ranges].end = has_function ? f.end : ref_to_table + 64;
+            nr_ranges++;
+        }
+    }
+    
+    /*
+     * sweep in address order, overlapping ranges are merged so no call is
+     * matched twice when references share a function or sit close together
+     */
+    if (nr_ranges > 0)
+    {
+        qsort(ranges, nr_ranges, sizeof(struct sweep_range), compare_sweep_ranges);
+    }
+    size_t i = 0;
+    while (i < nr_ranges)
+    {
+        ea_t start = ranges[i].start;
+        ea_t end = ranges[i].end;
+        for (i++; i < nr_ranges && ranges[i].start < end; i++)
+        {
+            if (ranges[i].end > end)
+            {
+                end = ranges[i].end;
+            }
+        }
+        /* only decode it if there's something that looks like a services call */
+        if (has_code_candidates(&ctx->code, start, end, kPatternServiceCall) == 0)
+        {
+            continue;
+        }
+        const struct insn_block *block = cache_range_insns(&ctx->insns, start, end - 1);
+        if (block != NULL)
+        {
+            match_idioms(&g_services_automaton, &ctx->insns, block, services_alias_filter, services_idiom_found, ctx);
+        }
+    }
+    free(ranges);
+    
+    /* success */
+    return 0;
+}
+
+/*
+ * helper function to add to analysis linked list
+ * the interesting services we want to extract more data later on
+ */
+static void
+add_boot_analysis_entry(struct analysis_context *ctx, ea_t address, ea_t offset, enum system_services type)
+{
+    struct analysis_entry *new_entry = (struct analysis_entry*)arena_alloc(&ctx->records, sizeof(struct analysis_entry));
+    if (new_entry != NULL)
+    {
+        new_entry->address = address;
+        new_entry->type = type;
+        new_entry->service = lookup_boot_table(offset);
+        LL_APPEND_TAIL(ctx->boot_services_stats.analysis_head, ctx->boot_services_stats.analysis_tail, new_entry);
+    }
+}
+
+/*
+ * iterate over all detected locations with references to boot services table
+ * and generate usage stats
+ * and also another data set of installed/used protocol GUIDs
+ */
+static void
+analyse_boot_refs(struct analysis_context *ctx)
+{
+    struct service_refs *ref_entry = NULL;
+    LL_FOREACH(ctx->boot_refs.head, ref_entry)
+    {
+        /* increase the count for this service so we can have stats about each used service */
+        int service_index = boot_service_index(ref_entry->offset);
+        if (service_index != 0)
+        {
+            ctx->boot_services_count[service_index]++;
+        }
+        
+        /* add the interesting entries to another table for further analysis
+         * we are essentially interested in services that install or use protocol GUIDs 
+         * from other EFI binaries
+         */
+        switch (ref_entry->offset)
+        {
+            /* InstallProtocolInterface */
+        case 0x80:
+            {
+                add_boot_analysis_entry(ctx, ref_entry->ref_addr, ref_entry->offset, kInstallProcotol);
+                break;
             }
-            /* HandleProtocol() */
-            else if (entry->type == kHandleProtocol)
+            /* ReinstallProtocolInterface */
+        case 0x88:
             {
-                /* GUID pointer is loaded into RDX, the second argument to HandleProtocol() */
-                if (cmd.itype == NN_lea && cmd.Operands[0].type == o_reg && cmd.Operands[0].reg == REG_RDX)
-                {
-                    ea_t target_guid_addr = cmd.Operands[1].addr;
-                    /* retrieve the GUID being used and store in the structure field */
-                    get_many_bytes(target_guid_addr, (void*)&current_guid, sizeof(EFI_GUID));
-                    if (current_guid.Data1 == 0x0 ||  current_guid.Data1 == 0xFFFFFFFF)
-                    {
-                        ERROR_MSG("Invalid data retrieved, failed to identify GUID? Address: 0x%llx", current_addr);
-                        break;
-                    }
-                    add_guid_stats_entry(kHandleProtocol, &current_guid);
-                    /* make a comment with the GUID where it's loaded */
-                    if (g_config.comment_guid == 1)
-                    {
-                        make_guid_cmt(&current_guid, current_addr);
-                    }
-                    break;
-                }
+                add_boot_analysis_entry(ctx, ref_entry->ref_addr, ref_entry->offset, kReinstallProtocol);
+                break;
             }
-            /* RegisterProtocolNotify() */
-            else if (entry->type == kRegisterProtocol)
+            /* HandleProtocol */
+        case 0x98:
             {
-                /* GUID pointer is loaded into RCX, the first argument to RegisterProtocolNotify() */
-                if (cmd.itype == NN_lea && cmd.Operands[0].type == o_reg && cmd.Operands[0].reg == REG_RCX)
-                {
-                    ea_t target_guid_addr = cmd.Operands[1].addr;
-                    /* retrieve the GUID being used and store in the structure field */
-                    get_many_bytes(target_guid_addr, (void*)&current_guid, sizeof(EFI_GUID));
-                    if (current_guid.Data1 == 0x0 ||  current_guid.Data1 == 0xFFFFFFFF)
-                    {
-                        ERROR_MSG("Invalid data retrieved, failed to identify GUID? Address: 0x%llx", current_addr);
-                        break;
-                    }
-                    add_guid_stats_entry(kRegisterProtocol, &current_guid);
-                    /* make a comment with the GUID where it's loaded */
-                    if (g_config.comment_guid == 1)
-                    {
-                        make_guid_cmt(&current_guid, current_addr);
-                    }
-                    break;
-                }
+                add_boot_analysis_entry(ctx, ref_entry->ref_addr, ref_entry->offset, kHandleProtocol);
+                break;
             }
-            /* InstallProtocolInterface () */
-            else if (entry->type == kInstallProcotol)
+            /* RegisterProtocolNotify */
+        case 0xA8:
             {
-                /* GUID pointer is loaded into RDX, the second argument to InstallProtocolInterface() */
-                if (cmd.itype == NN_lea && cmd.Operands[0].type == o_reg && cmd.Operands[0].reg == REG_RDX)
-                {
-                    ea_t target_guid_addr = cmd.Operands[1].addr;
-                    /* retrieve the GUID being used and store in the structure field */
-                    get_many_bytes(target_guid_addr, (void*)&current_guid, sizeof(EFI_GUID));
-                    if (current_guid.Data1 == 0x0 ||  current_guid.Data1 == 0xFFFFFFFF)
-                    {
-                        ERROR_MSG("Invalid data retrieved, failed to identify GUID? Address: 0x%llx", current_addr);
-                        break;
-                    }
-                    add_guid_stats_entry(kInstallProcotol, &current_guid);
-                    /* make a comment with the GUID where it's loaded */
-                    if (g_config.comment_guid == 1)
-                    {
-                        make_guid_cmt(&current_guid, current_addr);
-                    }
-                    g_boot_services_stats.installed_protocols++;
-                    break;
-                }
+                add_boot_analysis_entry(ctx, ref_entry->ref_addr, ref_entry->offset, kRegisterProtocol);
+                break;
             }
-            /* ReinstallProtocolInterface() */
-            else if (entry->type == kReinstallProtocol)
+            /* OpenProtocol */
+        case 0x118:
             {
-                /* GUID pointer is loaded into RDX, the second argument to ReinstallProtocolInterface() */
-                if (cmd.itype == NN_lea && cmd.Operands[0].type == o_reg && cmd.Operands[0].reg == REG_RDX)
-                {
-                    ea_t target_guid_addr = cmd.Operands[1].addr;
-                    /* retrieve the GUID being used and store in the structure field */
-                    get_many_bytes(target_guid_addr, (void*)&current_guid, sizeof(EFI_GUID));
-                    if (current_guid.Data1 == 0x0 ||  current_guid.Data1 == 0xFFFFFFFF)
-                    {
-                        ERROR_MSG("Invalid data retrieved, failed to identify GUID? Address: 0x%llx", current_addr);
-                        break;
-                    }
-                    add_guid_stats_entry(kReinstallProtocol, &current_guid);
-                    /* make a comment with the GUID where it's loaded */
-                    if (g_config.comment_guid == 1)
-                    {
-                        make_guid_cmt(&current_guid, current_addr);
-                    }
-                    break;
-                }
+                add_boot_analysis_entry(ctx, ref_entry->ref_addr, ref_entry->offset, kOpenProtocol);
+                break;
             }
-            /* OpenProtocol() */
-            else if (entry->type == kOpenProtocol)
+            /* LocateProtocol */
+        case 0x140:
             {
-                /* GUID pointer is loaded into RDX, the second argument to OpenProtocol() */
-                if (cmd.itype == NN_lea && cmd.Operands[0].type == o_reg && cmd.Operands[0].reg == REG_RDX)
-                {
-                    ea_t target_guid_addr = cmd.Operands[1].addr;
-                    /* retrieve the GUID being used and store in the structure field */
-                    get_many_bytes(target_guid_addr, (void*)&current_guid, sizeof(EFI_GUID));
-                    if (current_guid.Data1 == 0x0 ||  current_guid.Data1 == 0xFFFFFFFF)
-                    {
-                        ERROR_MSG("Invalid data retrieved, failed to identify GUID? Address: 0x%llx", current_addr);
-                        break;
-                    }
-                    add_guid_stats_entry(kOpenProtocol, &current_guid);
-                    /* make a comment with the GUID where it's loaded */
-                    if (g_config.comment_guid == 1)
-                    {
-                        make_guid_cmt(&current_guid, current_addr);
-                    }
-                    break;
-                }
+                add_boot_analysis_entry(ctx, ref_entry->ref_addr, ref_entry->offset, kLocateProtocol);
+                break;
             }
-            /* XXX: kInstallMultiProtocol */
-            /* let's assume only one protocol is installed because this version
-             * is recommended due to more error checking that InstallProtocol
-             */
-            else if (entry->type == kInstallMultiProtocol)
+            /* InstallMultipleProtocolInterfaces */
+        case 0x148:
             {
-                /* GUID pointer is loaded into RDX, the second argument to OpenProtocol() */
-                if (cmd.itype == NN_lea && cmd.Operands[0].type == o_reg && cmd.Operands[0].reg == REG_RDX)
-                {
-                    ea_t target_guid_addr = cmd.Operands[1].addr;
-                    /* retrieve the GUID being used and store in the structure field */
-                    get_many_bytes(target_guid_addr, (void*)&current_guid, sizeof(EFI_GUID));
-                    if (current_guid.Data1 == 0x0 ||  current_guid.Data1 == 0xFFFFFFFF)
-                    {
-                        ERROR_MSG("Invalid data retrieved, failed to identify GUID? Address: 0x%llx", current_addr);
-                        break;
-                    }
-                    add_guid_stats_entry(kInstallMultiProtocol, &current_guid);
-                    /* make a comment with the GUID where it's loaded */
-                    if (g_config.comment_guid == 1)
-                    {
-                        make_guid_cmt(&current_guid, current_addr);
-                    }
-                    g_boot_services_stats.installed_protocols++;
-                    break;
-                }
+                add_boot_analysis_entry(ctx, ref_entry->ref_addr, ref_entry->offset, kInstallMultiProtocol);
+                break;
             }
-            max_nr_insts--;
+        default:
+            break;
         }
     }
 }
 
 /*
- * function to go over all detected boot services references and comment it
- * based on configuration settings
+ * helper function to add to analysis linked list
+ * the interesting services we want to extract more data later on
+ */
+static void
+add_runtime_analysis_entry(struct analysis_context *ctx, ea_t address, ea_t offset, enum system_services type)
+{
+    struct analysis_entry *new_entry = (struct analysis_entry*)arena_alloc(&ctx->records, sizeof(struct analysis_entry));
+    if (new_entry != NULL)
+    {
+        new_entry->address = address;
+        new_entry->type = type;
+        new_entry->service = lookup_runtime_table(offset);
+        LL_APPEND_TAIL(ctx->runtime_services_stats.analysis_head, ctx->runtime_services_stats.analysis_tail, new_entry);
+    }
+}
+
+/*
+ * iterate over all detected locations with references to runtime services table
+ * and generate usage stats
+ * and also another data set of interesting services for further analysis
  */
 static void
-make_bootservice_cmts(void)
+analyse_runtime_refs(struct analysis_context *ctx)
 {
     struct service_refs *ref_entry = NULL;
-    LL_FOREACH(g_boot_refs_head, ref_entry)
+    LL_FOREACH(ctx->runtime_refs.head, ref_entry)
     {
-        char address_string[4096] = {0};
-        struct services_entry table_entry = lookup_boot_table(ref_entry->offset);
-        if (g_config.comment_description == 1 && g_config.comment_prototype == 0)
-        {
-            qsnprintf(address_string, sizeof(address_string), "BootServices->%s()\n\n%s", table_entry.name, table_entry.description);
-        }
-        else if (g_config.comment_description == 0 && g_config.comment_prototype == 1)
-        {
-            qsnprintf(address_string, sizeof(address_string), "BootServices->%s()\n\n%s\n\n%s", table_entry.name, table_entry.prototype, table_entry.parameters);
-        }
-        else if (g_config.comment_description == 1 && g_config.comment_prototype == 1)
+        int service_index = runtime_service_index(ref_entry->offset);
+        if (service_index != 0)
         {
-            qsnprintf(address_string, sizeof(address_string), "BootServices->%s()\n\n%s\n\n%s\n\n%s", table_entry.name, table_entry.prototype, table_entry.description, table_entry.parameters);
+            ctx->runtime_services_count[service_index]++;
         }
-        else
+        /* add the interesting entries to another table for further analysis
+         * we are essentially interested in services that deal with EFI variables
+         */
+        switch (ref_entry->offset)
         {
-            qsnprintf(address_string, sizeof(address_string), "BootServices->%s()", table_entry.name);
+            /* GetVariable */
+            case 0x48:
+                add_runtime_analysis_entry(ctx, ref_entry->ref_addr, ref_entry->offset, kGetVariable);
+                break;
+            /* SetVariable */
+            case 0x58:
+                add_runtime_analysis_entry(ctx, ref_entry->ref_addr, ref_entry->offset, kSetVariable);
+                break;
+            default:
+                break;
         }
-        
-        set_cmt(ref_entry->ref_addr, address_string, 0);
     }
 }
 
 /*
- * auxiliary function to comment a RunTime Service call
- * based on configuration settings
+ * it's harder to keep track of Get/SetVariable because many times the GUID is an argument
+ * to a function
+ */
+static void
+analyse_interesting_runtime_services(struct analysis_context *ctx)
+{
+    struct analysis_entry *entry = NULL;
+    LL_FOREACH(ctx->runtime_services_stats.analysis_head, entry)
+    {
+        DEBUG_MSG("%s() runtime service entry at 0x%llx", entry->service->name, entry->address);
+        analyse_guid_args(ctx, entry, &ctx->runtime_services_stats.guid_stats);
+    }
+}
+
+/*
+ * helper function to add to analysis linked list
+ * the interesting services we want to extract more data later on
+ */
+static void
+add_smm_analysis_entry(struct analysis_context *ctx, ea_t address, ea_t offset, enum system_services type)
+{
+    struct analysis_entry *new_entry = (struct analysis_entry*)arena_alloc(&ctx->records, sizeof(struct analysis_entry));
+    if (new_entry != NULL)
+    {
+        new_entry->address = address;
+        new_entry->type = type;
+        new_entry->service = lookup_smm_table(offset);
+        LL_APPEND_TAIL(ctx->smm_services_stats.analysis_head, ctx->smm_services_stats.analysis_tail, new_entry);
+    }
+}
+
+/*
+ * iterate over all detected locations with references to the SMM services table
+ * and generate usage stats
+ * the interesting ones are the protocol services and the SMI handlers registration
  */
 static void
-make_runtimeservice_cmts(void)
+analyse_smm_refs(struct analysis_context *ctx)
 {
     struct service_refs *ref_entry = NULL;
-    LL_FOREACH(g_runtime_refs_head, ref_entry)
+    LL_FOREACH(ctx->smm_refs.head, ref_entry)
     {
-        char address_string[4096] = {0};
-        struct services_entry table_entry = lookup_runtime_table(ref_entry->offset);
-        if (g_config.comment_description == 1 && g_config.comment_prototype == 0)
+        int service_index = smm_service_index(ref_entry->offset);
+        if (service_index != 0)
         {
-            qsnprintf(address_string, sizeof(address_string), "RunTimeServices->%s()\n\n%s", table_entry.name, table_entry.description);
+            ctx->smm_services_count[service_index]++;
         }
-        else if (g_config.comment_description == 0 && g_config.comment_prototype == 1)
+        
+        switch (ref_entry->offset)
         {
-            qsnprintf(address_string, sizeof(address_string), "RunTimeServices->%s()\n\n%s\n\n%s", table_entry.name, table_entry.prototype, table_entry.parameters);
+            /* SmmInstallProtocolInterface */
+            case 0xA8:
+                add_smm_analysis_entry(ctx, ref_entry->ref_addr, ref_entry->offset, kSmmInstallProtocol);
+                break;
+            /* SmmHandleProtocol */
+            case 0xB8:
+                add_smm_analysis_entry(ctx, ref_entry->ref_addr, ref_entry->offset, kSmmHandleProtocol);
+                break;
+            /* SmmRegisterProtocolNotify */
+            case 0xC0:
+                add_smm_analysis_entry(ctx, ref_entry->ref_addr, ref_entry->offset, kSmmRegisterProtocol);
+                break;
+            /* SmmLocateProtocol */
+            case 0xD0:
+                add_smm_analysis_entry(ctx, ref_entry->ref_addr, ref_entry->offset, kSmmLocateProtocol);
+                break;
+            /* SmiHandlerRegister */
+            case 0xE0:
+                add_smm_analysis_entry(ctx, ref_entry->ref_addr, ref_entry->offset, kSmiHandlerRegister);
+                break;
+            default:
+                break;
         }
-        else if (g_config.comment_description == 1 && g_config.comment_prototype == 1)
+    }
+}
+
+static void
+analyse_interesting_smm_services(struct analysis_context *ctx)
+{
+    struct analysis_entry *entry = NULL;
+    LL_FOREACH(ctx->smm_services_stats.analysis_head, entry)
+    {
+        DEBUG_MSG("%s() SMM service entry at 0x%llx", entry->service->name, entry->address);
+        int found = analyse_guid_args(ctx, entry, &ctx->smm_services_stats.guid_stats);
+        if (found > 0 && entry->type == kSmmInstallProtocol)
         {
-            qsnprintf(address_string, sizeof(address_string), "RunTimeServices->%s()\n\n%s\n\n%s\n\n%s", table_entry.name, table_entry.prototype, table_entry.description, table_entry.parameters);
+            ctx->smm_services_stats.installed_protocols++;
         }
-        else
+        else if (found > 0 && entry->type == kSmiHandlerRegister)
         {
-            qsnprintf(address_string, sizeof(address_string), "RunTimeServices->%s()", table_entry.name);
+            ctx->smm_services_stats.registered_handlers++;
         }
-        
-        set_cmt(ref_entry->ref_addr, address_string, 0);
     }
 }
 
 /*
- * locate call references to the boot services table
- * this is what we use to find out where are all the calls to boot services
+ * sweep all segments for known GUIDs and label the ones that are data
+ * the call site analysis later reads the GUIDs from the same sweep
  */
 static int
-locate_boot_services_refs(void)
+find_image_guids(struct analysis_context *ctx)
 {
-    func_t *f = NULL;
-
-    if (bootservices_ptr != 0)
+    if (sweep_image_guids(&ctx->image_guids) != 0)
+    {
+        return 1;
+    }
+    
+    size_t count = 0;
+    const struct guid_location *locations = image_guid_locations(&ctx->image_guids, &count);
+    for (size_t i = 0; i < count; i++)
     {
-        DEBUG_MSG("Looking up Boot Services references...");
-        xrefblk_t xb;
-        for ( bool ok=xb.first_to(bootservices_ptr, XREF_ALL); ok; ok=xb.next_to() )
+        /* don't label matches that fall inside instructions */
+        if (view_is_code(locations[i].address))
         {
-            ea_t ref_to_table = xb.from;
-            /* disassemble and process each reference */
-            f = get_func(ref_to_table);
-            ea_t current_addr = ref_to_table;
-            
-            enum ref_type type;
-            uint16_t boot_src_reg = 0;
-            uint16_t boot_dst_reg = 0;
-            
-            decode_insn(ref_to_table);
-            /* find the type of reference */
-            if (cmd.itype == NN_mov)
-            {
-                /* loading the boot table pointer into a register */
-                if (cmd.Operands[1].type == o_mem && cmd.Operands[1].addr == bootservices_ptr)
-                {
-                    type = kLoad;
-                    boot_dst_reg = cmd.Operands[0].reg;
-                }
-                /* storing the boot table pointer */
-                else if (cmd.Operands[0].type == o_mem && cmd.Operands[0].addr == bootservices_ptr)
-                {
-                    type = kStore;
-                    boot_src_reg = cmd.Operands[1].reg;
-                }
-            }
-            if (type == kInvalid)
-            {
-                continue;
-            }
-            
-            ea_t function_end = 0;
-            if (f == NULL)
-            {
-                function_end = current_addr + 64;
-            }
-            else
-            {
-                function_end = f->endEA;
-            }
-            while ((current_addr = find_code(current_addr, SEARCH_DOWN)) != BADADDR && current_addr <= function_end)
-            {
-                decode_insn(current_addr);
-                /* verify if register was modified before the call so we give up in that case */
-                if (type == kStore && cmd.Operands[0].type == o_reg && cmd.Operands[0].reg == boot_src_reg)
-                {
-                    break;
-                }
-                if ((cmd.itype == NN_callni  || cmd.itype == NN_jmpni) && cmd.Operands[0].type == o_displ)
-                {
-                    if ((type == kStore && cmd.Operands[0].phrase == boot_src_reg) ||
-                        (type == kLoad && cmd.Operands[0].phrase == boot_dst_reg))
-                    {
-                        struct service_refs *new_ref_entry = (struct service_refs*)malloc(sizeof(struct service_refs));
-                        if (new_ref_entry != NULL)
-                        {
-                            new_ref_entry->offset = cmd.Operands[0].addr;
-                            new_ref_entry->ref_addr = current_addr;
-                            LL_APPEND(g_boot_refs_head, new_ref_entry);
-                            break;
-                        }
-                    }
-                }
-            }
+            continue;
         }
+        DEBUG_MSG("Found GUID at 0x%llx - %s", locations[i].address, locations[i].name);
+        make_guid_cmt(&locations[i].guid, locations[i].address);
+        view_set_name(locations[i].address, locations[i].name);
     }
     
-    /* success */
     return 0;
 }
 
+#pragma mark -
+#pragma mark PEI modules functions
+#pragma mark -
+
+static void
+pei_idiom_found(const struct idiom_match *match, void *context)
+{
+    struct analysis_context *ctx = (struct analysis_context*)context;
+    if (match->rule->action != kIdiomPeiServicesCall)
+    {
+        return;
+    }
+    const struct cached_insn *call = match->insns[match->nr_steps - 1];
+    if (pei_service_index(call->ops[0].addr) != 0)
+    {
+        add_service_ref(ctx, kTablePei, call->ops[0].addr, call->ea);
+    }
+}
+
 /*
- * locate call references to the runtime services table
- * this is what we use to find out where are all the calls to runtime services
+ * locate the calls through (**PeiServices) in every function
+ * PEIMs are small and the services pointer comes from the entry point, a
+ * library getter or the IDT so we just look for how it's used
  */
 static int
-locate_runtime_services_refs(void)
+locate_pei_services_refs(struct analysis_context *ctx)
 {
-    func_t *f = NULL;
-
-    if (runtimeservices_ptr != 0)
+    DEBUG_MSG("Looking up PEI Services references...");
+    
+    if (build_services_idioms() != 0)
+    {
+        return 1;
+    }
+    
+    for (size_t idx = 0; idx < view_function_count(); idx++)
     {
-        DEBUG_MSG("Looking up RunTime Services references...");
-        xrefblk_t xb;
-        for ( bool ok=xb.first_to(runtimeservices_ptr, XREF_ALL); ok; ok=xb.next_to() )
+        struct binary_function f;
+        if (view_function_at(idx, &f) != 0 || has_code_candidates(&ctx->code, f.start, f.end, kPatternServiceCall) == 0)
         {
-            ea_t ref_to_table = xb.from;
-            /* disassemble and process each reference */
-            f = get_func(ref_to_table);
-            ea_t current_addr = ref_to_table;
-            
-            enum ref_type type = kInvalid;
-            uint16_t runtime_src_reg = 0;
-            uint16_t runtime_dst_reg = 0;
-            
-            decode_insn(ref_to_table);
-            /* find the type of reference */
-            if (cmd.itype == NN_mov)
-            {
-                /* loading the boot table pointer into a register */
-                if (cmd.Operands[1].type == o_mem && cmd.Operands[1].addr == runtimeservices_ptr)
-                {
-                    type = kLoad;
-                    runtime_dst_reg = cmd.Operands[0].reg;
-                }
-                /* storing the boot table pointer */
-                else if (cmd.Operands[0].type == o_mem && cmd.Operands[0].addr == runtimeservices_ptr)
-                {
-                    type = kStore;
-                    runtime_src_reg = cmd.Operands[1].reg;
-                }
-            }
-            if (type == kInvalid)
-            {
-                continue;
-            }
-            ea_t function_end = 0;
-            if (f == NULL)
-            {
-                function_end = current_addr + 64;
-            }
-            else
-            {
-                function_end = f->endEA;
-            }
-
-            while ((current_addr = find_code(current_addr, SEARCH_DOWN)) != BADADDR && current_addr <= function_end)
-            {
-                decode_insn(current_addr);
-                /* verify if register was modified before the call so we give up in that case */
-                if (type == kStore && cmd.Operands[0].type == o_reg && cmd.Operands[0].reg == runtime_src_reg)
-                {
-                    break;
-                }
-                if ((cmd.itype == NN_callni || cmd.itype == NN_jmpni) && cmd.Operands[0].type == o_displ)
-                {
-                    if ((type == kStore && cmd.Operands[0].phrase == runtime_src_reg) ||
-                        (type == kLoad && cmd.Operands[0].phrase == runtime_dst_reg))
-                    {
-                        struct service_refs *new_ref_entry = (struct service_refs*)malloc(sizeof(struct service_refs));
-                        if (new_ref_entry != NULL)
-                        {
-                            new_ref_entry->offset = cmd.Operands[0].addr;
-                            new_ref_entry->ref_addr = current_addr;
-                            LL_APPEND(g_runtime_refs_head, new_ref_entry);
-                            break;
-                        }
-                    }
-                }
-            }
+            continue;
+        }
+        const struct insn_block *block = cache_function_insns(&ctx->insns, f.start);
+        if (block != NULL)
+        {
+            match_idioms(&g_pei_automaton, &ctx->insns, block, NULL, pei_idiom_found, ctx);
         }
     }
-
+    
     /* success */
     return 0;
 }
 
 /*
- * helper function to add to analysis linked list
- * the interesting services we want to extract more data later on
+ * comment every PEI service call
+ * based on configuration settings
+ */
+static void
+make_peiservice_cmts(struct analysis_context *ctx)
+{
+    struct service_refs *ref_entry = NULL;
+    LL_FOREACH(ctx->pei_refs.head, ref_entry)
+    {
+        char address_string[4096] = {0};
+        int length = 0;
+        const struct pei_services_entry *table_entry = lookup_pei_table(ref_entry->offset);
+        if (g_config.comment_description == 1 && g_config.comment_prototype == 0)
+        {
+            length = qsnprintf(address_string, sizeof(address_string), "PeiServices->%s()\n\n%s", table_entry->name, table_entry->description);
+        }
+        else if (g_config.comment_description == 0 && g_config.comment_prototype == 1)
+        {
+            length = qsnprintf(address_string, sizeof(address_string), "PeiServices->%s()\n\n%s", table_entry->name, table_entry->prototype);
+        }
+        else if (g_config.comment_description == 1 && g_config.comment_prototype == 1)
+        {
+            length = qsnprintf(address_string, sizeof(address_string), "PeiServices->%s()\n\n%s\n\n%s", table_entry->name, table_entry->prototype, table_entry->description);
+        }
+        else
+        {
+            length = qsnprintf(address_string, sizeof(address_string), "PeiServices->%s()", table_entry->name);
+        }
+        /* the longest descriptions don't fit, the comment is still useful without the end */
+        if (length < 0 || (size_t)length >= sizeof(address_string) - 1)
+        {
+            DEBUG_MSG("Comment for %s() at 0x%llx truncated.", table_entry->name, (unsigned long long)ref_entry->ref_addr);
+        }
+        
+        view_set_comment(ref_entry->ref_addr, address_string);
+    }
+}
+
+/*
+ * helper function to add to the PEI analysis linked list
+ * the services dealing with PPI GUIDs
  */
 static void
-add_boot_analysis_entry(ea_t address, enum system_services type)
+add_pei_analysis_entry(struct analysis_context *ctx, ea_t address, ea_t offset, enum system_services type)
 {
-    struct analysis_entry *new_entry = (struct analysis_entry*)malloc(sizeof(struct analysis_entry));
+    struct pei_analysis_entry *new_entry = (struct pei_analysis_entry*)arena_alloc(&ctx->records, sizeof(struct pei_analysis_entry));
     if (new_entry != NULL)
     {
         new_entry->address = address;
         new_entry->type = type;
-        LL_APPEND(g_boot_services_stats.analysis_head, new_entry);
+        new_entry->service = lookup_pei_table(offset);
+        LL_APPEND_TAIL(ctx->pei_services_stats.analysis_head, ctx->pei_services_stats.analysis_tail, new_entry);
+    }
+    else
+    {
+        ERROR_MSG("Can't allocate memory for PEI analysis entry.");
     }
 }
 
-/*
- * iterate over all detected locations with references to boot services table
- * and generate usage stats
- * and also another data set of installed/used protocol GUIDs
- */
 static void
-analyse_boot_refs(void)
+analyse_pei_refs(struct analysis_context *ctx)
 {
     struct service_refs *ref_entry = NULL;
-    LL_FOREACH(g_boot_refs_head, ref_entry)
+    LL_FOREACH(ctx->pei_refs.head, ref_entry)
     {
-        /* increase the count for this service so we can have stats about each used service */
-        size_t array_size = sizeof(boot_services_table) / sizeof(*boot_services_table);
-        for (int i = 0; i < array_size; i++)
+        int service_index = pei_service_index(ref_entry->offset);
+        if (service_index != 0)
         {
-            if (boot_services_table[i].offset == ref_entry->offset)
-            {
-                boot_services_table[i].count++;
-                break;
-            }
+            ctx->pei_services_count[service_index]++;
         }
         
-        /* add the interesting entries to another table for further analysis
-         * we are essentially interested in services that install or use protocol GUIDs 
-         * from other EFI binaries
-         */
         switch (ref_entry->offset)
         {
-            /* InstallProtocolInterface */
-        case 0x80:
-            {
-                add_boot_analysis_entry(ref_entry->ref_addr, kInstallProcotol);
-                break;
-            }
-            /* ReinstallProtocolInterface */
-        case 0x88:
-            {
-                add_boot_analysis_entry(ref_entry->ref_addr, kReinstallProtocol);
-                break;
-            }
-            /* HandleProtocol */
-        case 0x98:
-            {
-                add_boot_analysis_entry(ref_entry->ref_addr, kHandleProtocol);
-                break;
-            }
-            /* RegisterProtocolNotify */
-        case 0xA8:
+            /* InstallPpi */
+        case 0x18:
             {
-                add_boot_analysis_entry(ref_entry->ref_addr, kRegisterProtocol);
+                add_pei_analysis_entry(ctx, ref_entry->ref_addr, ref_entry->offset, kInstallPpi);
                 break;
             }
-            /* OpenProtocol */
-        case 0x118:
+            /* ReInstallPpi */
+        case 0x1C:
             {
-                add_boot_analysis_entry(ref_entry->ref_addr, kOpenProtocol);
+                add_pei_analysis_entry(ctx, ref_entry->ref_addr, ref_entry->offset, kReInstallPpi);
                 break;
             }
-            /* LocateProtocol */
-        case 0x140:
+            /* LocatePpi */
+        case 0x20:
             {
-                add_boot_analysis_entry(ref_entry->ref_addr, kLocateProtocol);
+                add_pei_analysis_entry(ctx, ref_entry->ref_addr, ref_entry->offset, kLocatePpi);
                 break;
             }
-            /* InstallMultipleProtocolInterfaces */
-        case 0x148:
+            /* NotifyPpi */
+        case 0x24:
             {
-                add_boot_analysis_entry(ref_entry->ref_addr, kInstallMultiProtocol);
+                add_pei_analysis_entry(ctx, ref_entry->ref_addr, ref_entry->offset, kNotifyPpi);
                 break;
             }
         default:
@@ -1066,305 +1870,538 @@ analyse_boot_refs(void)
 }
 
 /*
- * helper function to add to analysis linked list
- * the interesting services we want to extract more data later on
+ * a pointer pushed as an argument, either push offset X or a register set by lea or mov
+ */
+static int
+pointer_arg(const struct reg_value *value, ea_t *out)
+{
+    if (value->kind != kValueAddress && value->kind != kValueImmediate)
+    {
+        return 0;
+    }
+    *out = (ea_t)value->value;
+    return 1;
+}
+
+/*
+ * record the PPI GUID at guid_address, commenting it at cmt_address
+ * returns 1 if it's a valid GUID
+ */
+static int
+add_ppi_guid(struct analysis_context *ctx, const struct pei_analysis_entry *entry, ea_t guid_address, ea_t cmt_address)
+{
+    EFI_GUID current_guid = {0, 0, 0, {0}};
+    read_image_guid(&ctx->image_guids, guid_address, &current_guid);
+    if (current_guid.Data1 == 0x0 || current_guid.Data1 == 0xFFFFFFFF)
+    {
+        DEBUG_MSG("No PPI GUID at 0x%llx for %s() at 0x%llx", guid_address, entry->service->name, entry->address);
+        return 0;
+    }
+    if (add_guid_stats(&ctx->pei_services_stats.guid_stats, entry->type, &current_guid) == NULL)
+    {
+        ERROR_MSG("Can't allocate memory for GUID stats.");
+    }
+    if (g_config.comment_guid == 1)
+    {
+        make_guid_cmt(&current_guid, cmt_address);
+    }
+    return 1;
+}
+
+/*
+ * go over an EFI_PEI_PPI_DESCRIPTOR or EFI_PEI_NOTIFY_DESCRIPTOR list
+ * both start with the flags and the GUID pointer, the list ends with the terminate flag
+ * returns the number of GUIDs found
+ */
+static int
+analyse_ppi_descriptors(struct analysis_context *ctx, const struct pei_analysis_entry *entry, ea_t list)
+{
+    int found = 0;
+    for (int i = 0; i < MAX_PPI_DESCRIPTORS; i++)
+    {
+        ea_t descriptor = list + i * PPI_DESCRIPTOR_SIZE;
+        /* flags and GUID pointer */
+        uint32_t fields[2] = {0};
+        if (view_read_bytes(descriptor, fields, sizeof(fields)) != 0)
+        {
+            break;
+        }
+        uint32_t flags = fields[0];
+        if ((flags & (EFI_PEI_PPI_DESCRIPTOR_PPI | EFI_PEI_PPI_DESCRIPTOR_NOTIFY_CALLBACK | EFI_PEI_PPI_DESCRIPTOR_NOTIFY_DISPATCH)) == 0)
+        {
+            DEBUG_MSG("Invalid PPI descriptor at 0x%llx for %s() at 0x%llx", descriptor, entry->service->name, entry->address);
+            break;
+        }
+        found += add_ppi_guid(ctx, entry, fields[1], descriptor);
+        if (flags & EFI_PEI_PPI_DESCRIPTOR_TERMINATE_LIST)
+        {
+            break;
+        }
+    }
+    return found;
+}
+
+/*
+ * retrieve the PPI GUIDs used by the PEI service calls
+ * the GUIDs are either passed directly or through descriptor lists
  */
 static void
-add_runtime_analysis_entry(ea_t address, enum system_services type)
+analyse_interesting_pei_services(struct analysis_context *ctx)
 {
-    struct analysis_entry *new_entry = (struct analysis_entry*)malloc(sizeof(struct analysis_entry));
-    if (new_entry != NULL)
+    struct pei_analysis_entry *entry = NULL;
+    LL_FOREACH(ctx->pei_services_stats.analysis_head, entry)
     {
-        new_entry->address = address;
-        new_entry->type = type;
-        LL_APPEND(g_runtime_services_stats.analysis_head, new_entry);
+        DEBUG_MSG("%s() entry at 0x%llx", entry->service->name, entry->address);
+        const struct insn_block *block = caller_insns(ctx, entry->address, MAX_ARGS_SEARCH);
+        if (block == NULL)
+        {
+            continue;
+        }
+        const struct call_args *args = lookup_call_args(&ctx->args, &ctx->insns, block, entry->address);
+        if (args == NULL)
+        {
+            continue;
+        }
+        
+        /* the first argument is always PeiServices */
+        const struct reg_value *value = &args->stack[1];
+        /* ReInstallPpi(PeiServices, OldPpi, NewPpi) */
+        if (entry->type == kReInstallPpi)
+        {
+            value = &args->stack[2];
+        }
+        ea_t pointer = 0;
+        if (!pointer_arg(value, &pointer))
+        {
+            DEBUG_MSG("Can't resolve PPI argument to %s() at 0x%llx", entry->service->name, entry->address);
+            continue;
+        }
+        
+        if (entry->type == kLocatePpi)
+        {
+            add_ppi_guid(ctx, entry, pointer, value->def_addr);
+        }
+        else
+        {
+            int found = analyse_ppi_descriptors(ctx, entry, pointer);
+            if (entry->type == kInstallPpi)
+            {
+                ctx->pei_services_stats.installed_ppis += found;
+            }
+        }
     }
 }
 
+#pragma mark -
+#pragma mark Output to screen functions
+#pragma mark -
+
 /*
- * iterate over all detected locations with references to runtime services table
- * and generate usage stats
- * and also another data set of interesting services for further analysis
+ * go over the tables and display each service usage count
  */
 static void
-analyse_runtime_refs(void)
+print_boot_services_usage(struct analysis_context *ctx)
 {
-    struct service_refs *ref_entry = NULL;
-    LL_FOREACH(g_runtime_refs_head, ref_entry)
+    OUTPUT_MSG(".---------------------------------------------.");
+    OUTPUT_MSG("|         Boot services global usage          |");
+    OUTPUT_MSG(".---------------------------------------------.");
+    size_t array_size = BOOT_SERVICES_ENTRIES;
+    for (size_t i = 0; i < array_size; i++)
     {
-        size_t array_size = sizeof(runtime_services_table) / sizeof(*runtime_services_table);
-        for (int i = 0; i < array_size; i++)
+        if (ctx->boot_services_count[i] > 0)
         {
-            if (runtime_services_table[i].offset == ref_entry->offset)
-            {
-                runtime_services_table[i].count++;
-                break;
-            }
+            OUTPUT_MSG("| %-36s | %4d |", boot_services_table[i].name, ctx->boot_services_count[i]);
         }
-        /* add the interesting entries to another table for further analysis
-         * we are essentially interested in services that deal with EFI variables
-         */
-        switch (ref_entry->offset)
+    }
+    OUTPUT_MSG("`---------------------------------------------´");
+}
+
+static void
+print_runtime_services_usage(struct analysis_context *ctx)
+{
+    OUTPUT_MSG(".----------------------------------.");
+    OUTPUT_MSG("|   RunTime services global usage  |");
+    OUTPUT_MSG(".----------------------------------.");
+    size_t array_size = RUNTIME_SERVICES_ENTRIES;
+    for (size_t i = 0; i < array_size; i++)
+    {
+        if (ctx->runtime_services_count[i] > 0)
         {
-            /* GetVariable */
-            case 0x48:
-                add_runtime_analysis_entry(ref_entry->ref_addr, kGetVariable);
-                break;
-            /* SetVariable */
-            case 0x58:
-                add_runtime_analysis_entry(ref_entry->ref_addr, kSetVariable);
-                break;
-            default:
-                break;
+            OUTPUT_MSG("| %-25s | %4d |", runtime_services_table[i].name, ctx->runtime_services_count[i]);
         }
     }
+    OUTPUT_MSG("`----------------------------------´");
 }
 
-/*
- * it's harder to keep track of Get/SetVariable because many times the GUID is an argument
- * to a function
- */
 static void
-analyse_interesting_runtime_services(void)
+print_protocols_usage(struct analysis_context *ctx)
 {
-    struct analysis_entry *entry = NULL;
+    /* InstallProtocolInterface */
+    
+    OUTPUT_MSG(".-------------------------------------------------------------------------------------------------.");
+    OUTPUT_MSG("|                                  Global Protocols Usage                                         |");
+    OUTPUT_MSG(".-------.--------------------------------------.--------------------------------------------------.");
+    OUTPUT_MSG("| Count |                GUID                  |                    Description                   |");
+    OUTPUT_MSG(".-------'--------------------------------------'--------------------------------------------------.");
+    struct guid_stats *stats_entry = NULL;
+    char guid_string[GUID_STRING_SIZE] = {0};
+    GUID_STATS_FOREACH(&ctx->boot_services_stats.guid_stats, stats_entry)
+    {
+        /* try to see if it's a known GUID */
+        const char *guid_name = lookup_guid_name(&stats_entry->guid);
+        if (guid_name != NULL)
+        {
+            OUTPUT_MSG("| %5d | %-36s | %-48s |", stats_entry->count, format_guid(&stats_entry->guid, guid_string), guid_name);
+        }
+        else
+        {
+            OUTPUT_MSG("| %5d | %-36s | N/A                                              |", stats_entry->count, format_guid(&stats_entry->guid, guid_string));
+        }
+    }
+    OUTPUT_MSG("`-------------------------------------------------------------------------------------------------´");
     
-    /* first thing is to find out which GUIDs are used in LocateProtocol() */
-    LL_FOREACH(g_runtime_services_stats.analysis_head, entry)
+    /* output information about installed protocols, if any exist */
+    if (ctx->boot_services_stats.installed_protocols > 0)
     {
-        /* find and track the GUID */
-        ea_t current_addr = entry->address;
-        /* max number of instructions backwards we want to search */
-        int max_nr_insts = 32;
+        OUTPUT_MSG(".-----------------------------------------------------------------------------------------.");
+        OUTPUT_MSG("|                               Installed Protocols                                       |");
+        OUTPUT_MSG(".--------------------------------------.--------------------------------------------------.");
+        OUTPUT_MSG("|                GUID                  |                    Description                   |");
+        OUTPUT_MSG(".--------------------------------------'--------------------------------------------------.");
         
-        EFI_GUID current_guid = {0};
-        while ((current_addr = find_code(current_addr, SEARCH_UP)) != BADADDR && max_nr_insts > 0)
+        GUID_STATS_FOREACH(&ctx->boot_services_stats.guid_stats, stats_entry)
         {
-            decode_insn(current_addr);
-            /* GetVariable() */
-            if (entry->type == kGetVariable)
+            if (stats_entry->type == kInstallProcotol || stats_entry->type == kInstallMultiProtocol)
             {
-                DEBUG_MSG("Locate GetVariable() runtime service entry at 0x%llx", entry->address);
-                /* GUID pointer is loaded into RDX, the second argument to GetVariable() */
-                if (cmd.itype == NN_lea && cmd.Operands[0].type == o_reg && cmd.Operands[0].reg == REG_RDX)
+                /* try to see if it's a known GUID */
+                const char *guid_name = lookup_guid_name(&stats_entry->guid);
+                if (guid_name != NULL)
                 {
-                    ea_t target_guid_addr = cmd.Operands[1].addr;
-                    /* retrieve the GUID being used and store in the structure field */
-                    get_many_bytes(target_guid_addr, (void*)&current_guid, sizeof(EFI_GUID));
-                    if (current_guid.Data1 == 0x0 ||  current_guid.Data1 == 0xFFFFFFFF)
-                    {
-                        ERROR_MSG("Invalid data retrieved, failed to identify GUID? Address: 0x%llx", current_addr);
-                        break;
-                    }
-                    /* make a comment with the GUID where it's loaded */
-                    if (g_config.comment_guid == 1)
-                    {
-                        make_guid_cmt(&current_guid, current_addr);
-                    }
-                    break;
+                    OUTPUT_MSG("| %-36s | %-48s |", format_guid(&stats_entry->guid, guid_string), guid_name);
+                }
+                else
+                {
+                    OUTPUT_MSG("| %-36s | N/A                                              |", format_guid(&stats_entry->guid, guid_string));
                 }
             }
-            /* SetVariable() */
-            else if (entry->type == kSetVariable)
-            {
-//                DEBUG_MSG("Locate SetVariable() runtime service entry at 0x%llx", entry->address);
-            }
-            /* continue to preceeding instruction */
-            max_nr_insts--;
         }
+        OUTPUT_MSG("`-----------------------------------------------------------------------------------------´");
     }
-
+    
+#if 0
+    LL_FOREACH(boot_services_stats.locate_protocol_head, entry)
+    {
+        const char *guid_name = lookup_guid_name(&entry->guid);
+        if (guid_name != NULL)
+        {
+            DEBUG_MSG("Found known GUID at 0x%llx - %s", entry->address, guid_name);
+        }
+        else
+        {
+            char guid_string[GUID_STRING_SIZE] = {0};
+            DEBUG_MSG("Unknown GUID: %s", format_guid(&entry->guid, guid_string));
+        }
+    }
+#endif
 }
 
 /*
- * go over the data segment and try to locate valid GUIDs
- *
+ * services calls made through each table alias
  */
-static int
-find_data_seg_guids(void)
+static void
+print_table_aliases_usage(struct analysis_context *ctx)
 {
-    segment_t *seg_info = get_segm_by_name(".data");
-    if (seg_info == NULL)
-    {
-        ERROR_MSG("Can't find a valid code segment!");
-        return 1;
-    }
-    ea_t current_addr = seg_info->startEA;
-    
-    while (current_addr != BADADDR && current_addr <= seg_info->endEA)
+    OUTPUT_MSG(".--------------------------------------------------------------.");
+    OUTPUT_MSG("|                 Services table aliases usage                 |");
+    OUTPUT_MSG(".--------------------------------------------------------------.");
+    char alias_name[MAXNAMELEN] = {0};
+    for (size_t i = 0; i < ctx->table_aliases.count; i++)
     {
-        EFI_GUID guid = {0};
-        
-        get_many_bytes(current_addr, (void*)&guid, sizeof(EFI_GUID));
-
-        /* ignore invalid/empty GUIDs */
-        if (guid.Data1 == 0x0 || guid.Data1 == 0xFFFFFFFF)
-        {
-            current_addr += 8;
-            continue;
-        }
-
-        for (int i = 0; i < sizeof(guid_table) / sizeof(*guid_table) - 1; i++)
+        const struct table_alias *alias = &ctx->table_aliases.aliases[i];
+        enum table_kind table = alias_table_kind(alias);
+        if (table != kTableNone)
         {
-            if (memcmp((void*)&guid_table[i].guid, (void*)&guid, sizeof(EFI_GUID)) == 0)
-            {
-                DEBUG_MSG("Found GUID at 0x%llx - %s", current_addr, guid_table[i].name);
-                make_guid_cmt(&guid_table[i].guid, current_addr);
-                set_name(current_addr, guid_table[i].name, SN_CHECK);
-            }
+            view_get_name(alias->address, alias_name, sizeof(alias_name));
+            OUTPUT_MSG("| %-24s | %-7s | 0x%-14llx | %4d |", alias_name, table_kind_name(table),
+                       (unsigned long long)alias->address, alias->hits);
         }
-        current_addr += 8;
     }
-    
-    return 0;
+    OUTPUT_MSG("`--------------------------------------------------------------´");
 }
 
 #pragma mark -
-#pragma mark Output to screen functions
+#pragma mark Output to file functions
 #pragma mark -
 
-/*
- * go over the tables and display each service usage count
- */
+static const char *
+smm_service_type_name(int type)
+{
+    switch (type)
+    {
+        case kSmmInstallProtocol:
+            return "SmmInstallProtocol";
+        case kSmmHandleProtocol:
+            return "SmmHandleProtocol";
+        case kSmmRegisterProtocol:
+            return "SmmRegisterProtocol";
+        case kSmmLocateProtocol:
+            return "SmmLocateProtocol";
+        case kSmiHandlerRegister:
+            return "SmiHandlerRegister";
+        default:
+            return "N/A";
+    }
+}
+
 static void
-print_boot_services_usage(void)
+print_smm_services_usage(struct analysis_context *ctx)
 {
     OUTPUT_MSG(".---------------------------------------------.");
-    OUTPUT_MSG("|         Boot services global usage          |");
+    OUTPUT_MSG("|          SMM services global usage          |");
     OUTPUT_MSG(".---------------------------------------------.");
-    size_t array_size = sizeof(boot_services_table) / sizeof(*boot_services_table);
-    for (int i = 0; i < array_size; i++)
+    size_t array_size = SMM_SERVICES_ENTRIES;
+    for (size_t i = 0; i < array_size; i++)
     {
-        if (boot_services_table[i].count > 0)
+        if (ctx->smm_services_count[i] > 0)
         {
-            OUTPUT_MSG("| %-36s | %4d |", boot_services_table[i].name, boot_services_table[i].count);
+            OUTPUT_MSG("| %-36s | %4d |", smm_services_table[i].name, ctx->smm_services_count[i]);
         }
     }
     OUTPUT_MSG("`---------------------------------------------´");
 }
 
+/*
+ * the protocols and SMI handler types used through gSmst
+ */
+static void
+print_smm_protocols_usage(struct analysis_context *ctx)
+{
+    OUTPUT_MSG(".----------------------------------------------------------------------------------------------------------------------------.");
+    OUTPUT_MSG("|                                                  SMM Protocols Usage                                                       |");
+    OUTPUT_MSG(".-------.--------------------------------------.--------------------------------------------------.--------------------------.");
+    OUTPUT_MSG("| Count |                GUID                  |                    Description                   |         Service          |");
+    OUTPUT_MSG(".-------'--------------------------------------'--------------------------------------------------'--------------------------.");
+    struct guid_stats *stats_entry = NULL;
+    char guid_string[GUID_STRING_SIZE] = {0};
+    GUID_STATS_FOREACH(&ctx->smm_services_stats.guid_stats, stats_entry)
+    {
+        const char *guid_name = lookup_guid_name(&stats_entry->guid);
+        OUTPUT_MSG("| %5d | %-36s | %-48s | %-24s |", stats_entry->count, format_guid(&stats_entry->guid, guid_string),
+                   guid_name != NULL ? guid_name : "N/A", smm_service_type_name(stats_entry->type));
+    }
+    OUTPUT_MSG("`----------------------------------------------------------------------------------------------------------------------------´");
+    OUTPUT_MSG("SMM protocols installed: %d SMI handlers registered: %d", ctx->smm_services_stats.installed_protocols, ctx->smm_services_stats.registered_handlers);
+}
+
 static void
-print_runtime_services_usage(void)
+print_pei_services_usage(struct analysis_context *ctx)
 {
     OUTPUT_MSG(".----------------------------------.");
-    OUTPUT_MSG("|   RunTime services global usage  |");
+    OUTPUT_MSG("|     PEI services global usage    |");
     OUTPUT_MSG(".----------------------------------.");
-    size_t array_size = sizeof(runtime_services_table) / sizeof(*runtime_services_table);
-    for (int i = 0; i < array_size; i++)
+    size_t array_size = PEI_SERVICES_ENTRIES;
+    for (size_t i = 0; i < array_size; i++)
     {
-        if (runtime_services_table[i].count > 0)
+        if (ctx->pei_services_count[i] > 0)
         {
-            OUTPUT_MSG("| %-25s | %4d |", runtime_services_table[i].name, runtime_services_table[i].count);
+            OUTPUT_MSG("| %-25s | %4d |", pei_services_table[i].name, ctx->pei_services_count[i]);
         }
     }
     OUTPUT_MSG("`----------------------------------´");
 }
 
 static void
-print_protocols_usage(void)
+print_ppis_usage(struct analysis_context *ctx)
 {
-    /* InstallProtocolInterface */
-    
     OUTPUT_MSG(".-------------------------------------------------------------------------------------------------.");
-    OUTPUT_MSG("|                                  Global Protocols Usage                                         |");
+    OUTPUT_MSG("|                                     Global PPIs Usage                                           |");
     OUTPUT_MSG(".-------.--------------------------------------.--------------------------------------------------.");
     OUTPUT_MSG("| Count |                GUID                  |                    Description                   |");
     OUTPUT_MSG(".-------'--------------------------------------'--------------------------------------------------.");
     struct guid_stats *stats_entry = NULL;
-    LL_FOREACH(g_boot_services_stats.guid_stats_head, stats_entry)
+    char guid_string[GUID_STRING_SIZE] = {0};
+    GUID_STATS_FOREACH(&ctx->pei_services_stats.guid_stats, stats_entry)
     {
         /* try to see if it's a known GUID */
-        int found = 0;
-        int index = 0;
-        for (int i = 0; i < sizeof(guid_table) / sizeof(*guid_table) - 1; i++)
-        {
-            if (memcmp((void*)&guid_table[i].guid, (void*)&stats_entry->guid, sizeof(EFI_GUID)) == 0)
-            {
-                found = 1;
-                index = i;
-                break;
-            }
-        }
-        if (found)
+        const char *guid_name = lookup_guid_name(&stats_entry->guid);
+        if (guid_name != NULL)
         {
-            OUTPUT_MSG("| %5d | %-36s | %-48s |", stats_entry->count, string_guid(&stats_entry->guid), guid_table[index].name);
+            OUTPUT_MSG("| %5d | %-36s | %-48s |", stats_entry->count, format_guid(&stats_entry->guid, guid_string), guid_name);
         }
         else
         {
-            OUTPUT_MSG("| %5d | %-36s | N/A                                              |", stats_entry->count, string_guid(&stats_entry->guid));
+            OUTPUT_MSG("| %5d | %-36s | N/A                                              |", stats_entry->count, format_guid(&stats_entry->guid, guid_string));
         }
     }
     OUTPUT_MSG("`-------------------------------------------------------------------------------------------------´");
     
-    /* output information about installed protocols, if any exist */
-    if (g_boot_services_stats.installed_protocols > 0)
+    /* output information about installed PPIs, if any exist */
+    if (ctx->pei_services_stats.installed_ppis > 0)
     {
         OUTPUT_MSG(".-----------------------------------------------------------------------------------------.");
-        OUTPUT_MSG("|                               Installed Protocols                                       |");
+        OUTPUT_MSG("|                                  Installed PPIs                                         |");
         OUTPUT_MSG(".--------------------------------------.--------------------------------------------------.");
         OUTPUT_MSG("|                GUID                  |                    Description                   |");
         OUTPUT_MSG(".--------------------------------------'--------------------------------------------------.");
         
-        LL_FOREACH(g_boot_services_stats.guid_stats_head, stats_entry)
+        GUID_STATS_FOREACH(&ctx->pei_services_stats.guid_stats, stats_entry)
         {
-            if (stats_entry->type == kInstallProcotol || stats_entry->type == kInstallMultiProtocol)
+            if (stats_entry->type == kInstallPpi)
             {
                 /* try to see if it's a known GUID */
-                int found = 0;
-                int index = 0;
-                for (int i = 0; i < sizeof(guid_table) / sizeof(*guid_table) - 1; i++)
+                const char *guid_name = lookup_guid_name(&stats_entry->guid);
+                if (guid_name != NULL)
+                {
+                    OUTPUT_MSG("| %-36s | %-48s |", format_guid(&stats_entry->guid, guid_string), guid_name);
+                }
+                else
                 {
-                    if (memcmp((void*)&guid_table[i].guid, (void*)&stats_entry->guid, sizeof(EFI_GUID)) == 0)
-                    {
-                        found = 1;
-                        index = i;
-                        break;
-                    }
+                    OUTPUT_MSG("| %-36s | N/A                                              |", format_guid(&stats_entry->guid, guid_string));
                 }
-                if (found)
+            }
+        }
+        OUTPUT_MSG("`-----------------------------------------------------------------------------------------´");
+    }
+}
+
+/*
+ * go over the tables and display each service usage count
+ */
+static void
+log_boot_services_usage(struct analysis_context *ctx, FILE *output_file)
+{
+    if (output_file == NULL)
+    {
+        ERROR_MSG("Invalid file handle.");
+        return;
+    }
+    
+    qfprintf(output_file, ".---------------------------------------------.\n");
+    qfprintf(output_file, "|         Boot services global usage          |\n");
+    qfprintf(output_file, ".---------------------------------------------.\n");
+    size_t array_size = BOOT_SERVICES_ENTRIES;
+    for (size_t i = 0; i < array_size; i++)
+    {
+        if (ctx->boot_services_count[i] > 0)
+        {
+            qfprintf(output_file, "| %-36s | %4d |\n", boot_services_table[i].name, ctx->boot_services_count[i]);
+        }
+    }
+    qfprintf(output_file, "`---------------------------------------------´\n");
+}
+
+static void
+log_runtime_services_usage(struct analysis_context *ctx, FILE *output_file)
+{
+    if (output_file == NULL)
+    {
+        ERROR_MSG("Invalid file handle.");
+        return;
+    }
+
+    qfprintf(output_file, ".----------------------------------.\n");
+    qfprintf(output_file, "|   RunTime services global usage  |\n");
+    qfprintf(output_file, ".----------------------------------.\n");
+    size_t array_size = RUNTIME_SERVICES_ENTRIES;
+    for (size_t i = 0; i < array_size; i++)
+    {
+        if (ctx->runtime_services_count[i] > 0)
+        {
+            qfprintf(output_file, "| %-25s | %4d |\n", runtime_services_table[i].name, ctx->runtime_services_count[i]);
+        }
+    }
+    qfprintf(output_file, "`----------------------------------´\n");
+}
+
+static void
+log_protocols_usage(struct analysis_context *ctx, FILE *output_file)
+{
+    if (output_file == NULL)
+    {
+        ERROR_MSG("Invalid file handle.");
+        return;
+    }
+    
+    qfprintf(output_file, ".--------------------------------------------------------------------------------------------------.\n");
+    qfprintf(output_file, "|                                  Global Protocols Usage                                          |\n");
+    qfprintf(output_file, ".-------.--------------------------------------.----------------------------------------------------.\n");
+    qfprintf(output_file, "| Count |                GUID                  |                    Description                    |\n");
+    qfprintf(output_file, ".-------'--------------------------------------'---------------------------------------------------.\n");
+    struct guid_stats *stats_entry = NULL;
+    char guid_string[GUID_STRING_SIZE] = {0};
+    GUID_STATS_FOREACH(&ctx->boot_services_stats.guid_stats, stats_entry)
+    {
+        /* try to see if it's a known GUID */
+        const char *guid_name = lookup_guid_name(&stats_entry->guid);
+        if (guid_name != NULL)
+        {
+            qfprintf(output_file, "| %5d | %-36s | %-49s |\n", stats_entry->count, format_guid(&stats_entry->guid, guid_string), guid_name);
+        }
+        else
+        {
+            qfprintf(output_file, "| %5d | %-36s | N/A                                               |\n", stats_entry->count, format_guid(&stats_entry->guid, guid_string));
+        }
+    }
+    qfprintf(output_file, "`--------------------------------------------------------------------------------------------------´\n");
+    
+    /* output information about installed protocols, if any exist */
+    if (ctx->boot_services_stats.installed_protocols > 0)
+    {
+        qfprintf(output_file, ".------------------------------------------------------------------------------------------.\n");
+        qfprintf(output_file, "|                               Installed Protocols                                        |\n");
+        qfprintf(output_file, ".--------------------------------------.----------------------------------------------------.\n");
+        qfprintf(output_file, "|                GUID                  |                    Description                    |\n");
+        qfprintf(output_file, ".--------------------------------------'----------------------------------.----------------.\n");
+        
+        GUID_STATS_FOREACH(&ctx->boot_services_stats.guid_stats, stats_entry)
+        {
+            if (stats_entry->type == kInstallProcotol || stats_entry->type == kInstallMultiProtocol)
+            {
+                /* try to see if it's a known GUID */
+                const char *guid_name = lookup_guid_name(&stats_entry->guid);
+                if (guid_name != NULL)
                 {
-                    OUTPUT_MSG("| %-36s | %-48s |", string_guid(&stats_entry->guid), guid_table[index].name);
+                    qfprintf(output_file, "| %-36s | %-49s |\n", format_guid(&stats_entry->guid, guid_string), guid_name);
                 }
                 else
                 {
-                    OUTPUT_MSG("| %-36s | N/A                                              |", string_guid(&stats_entry->guid));
+                    qfprintf(output_file, "| %-36s | N/A                                               |\n", format_guid(&stats_entry->guid, guid_string));
                 }
             }
         }
-        OUTPUT_MSG("`-----------------------------------------------------------------------------------------´");
+        qfprintf(output_file, "`------------------------------------------------------------------------------------------´\n");
+    }
+}
+
+static void
+log_table_aliases_usage(struct analysis_context *ctx, FILE *output_file)
+{
+    if (output_file == NULL)
+    {
+        ERROR_MSG("Invalid file handle.");
+        return;
     }
     
-#if 0
-    LL_FOREACH(boot_services_stats.locate_protocol_head, entry)
+    qfprintf(output_file, ".--------------------------------------------------------------.\n");
+    qfprintf(output_file, "|                 Services table aliases usage                 |\n");
+    qfprintf(output_file, ".--------------------------------------------------------------.\n");
+    char alias_name[MAXNAMELEN] = {0};
+    for (size_t i = 0; i < ctx->table_aliases.count; i++)
     {
-        int found = 0;
-        for (int i = 0; i < sizeof(guid_table) / sizeof(*guid_table) - 1; i++)
-        {
-            if (memcmp((void*)&guid_table[i].guid, (void*)&entry->guid, sizeof(EFI_GUID)) == 0)
-            {
-                DEBUG_MSG("Found known GUID at 0x%llx - %s", entry->address, guid_table[i].name);
-                found = 1;
-                break;
-            }
-        }
-        if (found == 0)
+        const struct table_alias *alias = &ctx->table_aliases.aliases[i];
+        enum table_kind table = alias_table_kind(alias);
+        if (table != kTableNone)
         {
-            DEBUG_MSG("Unknown GUID:");
-            print_guid(&entry->guid);
+            view_get_name(alias->address, alias_name, sizeof(alias_name));
+            qfprintf(output_file, "| %-24s | %-7s | 0x%-14llx | %4d |\n", alias_name, table_kind_name(table),
+                     (unsigned long long)alias->address, alias->hits);
         }
     }
-#endif
+    qfprintf(output_file, "`--------------------------------------------------------------´\n");
 }
 
-#pragma mark -
-#pragma mark Output to file functions
-#pragma mark -
-
-/*
- * go over the tables and display each service usage count
- */
 static void
-log_boot_services_usage(FILE *output_file)
+log_smm_services_usage(struct analysis_context *ctx, FILE *output_file)
 {
     if (output_file == NULL)
     {
@@ -1373,44 +2410,70 @@ log_boot_services_usage(FILE *output_file)
     }
     
     qfprintf(output_file, ".---------------------------------------------.\n");
-    qfprintf(output_file, "|         Boot services global usage          |\n");
+    qfprintf(output_file, "|          SMM services global usage          |\n");
     qfprintf(output_file, ".---------------------------------------------.\n");
-    size_t array_size = sizeof(boot_services_table) / sizeof(*boot_services_table);
-    for (int i = 0; i < array_size; i++)
+    size_t array_size = SMM_SERVICES_ENTRIES;
+    for (size_t i = 0; i < array_size; i++)
     {
-        if (boot_services_table[i].count > 0)
+        if (ctx->smm_services_count[i] > 0)
         {
-            qfprintf(output_file, "| %-36s | %4d |\n", boot_services_table[i].name, boot_services_table[i].count);
+            qfprintf(output_file, "| %-36s | %4d |\n", smm_services_table[i].name, ctx->smm_services_count[i]);
         }
     }
     qfprintf(output_file, "`---------------------------------------------´\n");
 }
 
 static void
-log_runtime_services_usage(FILE *output_file)
+log_smm_protocols_usage(struct analysis_context *ctx, FILE *output_file)
 {
     if (output_file == NULL)
     {
         ERROR_MSG("Invalid file handle.");
         return;
     }
+    
+    qfprintf(output_file, ".----------------------------------------------------------------------------------------------------------------------------.\n");
+    qfprintf(output_file, "|                                                  SMM Protocols Usage                                                       |\n");
+    qfprintf(output_file, ".-------.--------------------------------------.--------------------------------------------------.--------------------------.\n");
+    qfprintf(output_file, "| Count |                GUID                  |                    Description                   |         Service          |\n");
+    qfprintf(output_file, ".-------'--------------------------------------'--------------------------------------------------'--------------------------.\n");
+    struct guid_stats *stats_entry = NULL;
+    char guid_string[GUID_STRING_SIZE] = {0};
+    GUID_STATS_FOREACH(&ctx->smm_services_stats.guid_stats, stats_entry)
+    {
+        const char *guid_name = lookup_guid_name(&stats_entry->guid);
+        qfprintf(output_file, "| %5d | %-36s | %-48s | %-24s |\n", stats_entry->count, format_guid(&stats_entry->guid, guid_string),
+                 guid_name != NULL ? guid_name : "N/A", smm_service_type_name(stats_entry->type));
+    }
+    qfprintf(output_file, "`----------------------------------------------------------------------------------------------------------------------------´\n");
+    qfprintf(output_file, "SMM protocols installed: %d SMI handlers registered: %d\n", ctx->smm_services_stats.installed_protocols, ctx->smm_services_stats.registered_handlers);
+}
 
+static void
+log_pei_services_usage(struct analysis_context *ctx, FILE *output_file)
+{
+    if (output_file == NULL)
+    {
+        ERROR_MSG("Invalid file handle.");
+        return;
+    }
+    
     qfprintf(output_file, ".----------------------------------.\n");
-    qfprintf(output_file, "|   RunTime services global usage  |\n");
+    qfprintf(output_file, "|     PEI services global usage    |\n");
     qfprintf(output_file, ".----------------------------------.\n");
-    size_t array_size = sizeof(runtime_services_table) / sizeof(*runtime_services_table);
-    for (int i = 0; i < array_size; i++)
+    size_t array_size = PEI_SERVICES_ENTRIES;
+    for (size_t i = 0; i < array_size; i++)
     {
-        if (runtime_services_table[i].count > 0)
+        if (ctx->pei_services_count[i] > 0)
         {
-            qfprintf(output_file, "| %-25s | %4d |\n", runtime_services_table[i].name, runtime_services_table[i].count);
+            qfprintf(output_file, "| %-25s | %4d |\n", pei_services_table[i].name, ctx->pei_services_count[i]);
         }
     }
     qfprintf(output_file, "`----------------------------------´\n");
 }
 
 static void
-log_protocols_usage(FILE *output_file)
+log_ppis_usage(struct analysis_context *ctx, FILE *output_file)
 {
     if (output_file == NULL)
     {
@@ -1419,68 +2482,49 @@ log_protocols_usage(FILE *output_file)
     }
     
     qfprintf(output_file, ".--------------------------------------------------------------------------------------------------.\n");
-    qfprintf(output_file, "|                                  Global Protocols Usage                                          |\n");
-    qfprintf(output_file, ".-------.--------------------------------------.---------------------------------------------------.\n");
+    qfprintf(output_file, "|                                     Global PPIs Usage                                            |\n");
+    qfprintf(output_file, ".-------.--------------------------------------.----------------------------------------------------.\n");
     qfprintf(output_file, "| Count |                GUID                  |                    Description                    |\n");
     qfprintf(output_file, ".-------'--------------------------------------'---------------------------------------------------.\n");
     struct guid_stats *stats_entry = NULL;
-    LL_FOREACH(g_boot_services_stats.guid_stats_head, stats_entry)
+    char guid_string[GUID_STRING_SIZE] = {0};
+    GUID_STATS_FOREACH(&ctx->pei_services_stats.guid_stats, stats_entry)
     {
         /* try to see if it's a known GUID */
-        int found = 0;
-        int index = 0;
-        for (int i = 0; i < sizeof(guid_table) / sizeof(*guid_table) - 1; i++)
-        {
-            if (memcmp((void*)&guid_table[i].guid, (void*)&stats_entry->guid, sizeof(EFI_GUID)) == 0)
-            {
-                found = 1;
-                index = i;
-                break;
-            }
-        }
-        if (found)
+        const char *guid_name = lookup_guid_name(&stats_entry->guid);
+        if (guid_name != NULL)
         {
-            qfprintf(output_file, "| %5d | %-36s | %-49s |\n", stats_entry->count, string_guid(&stats_entry->guid), guid_table[index].name);
+            qfprintf(output_file, "| %5d | %-36s | %-49s |\n", stats_entry->count, format_guid(&stats_entry->guid, guid_string), guid_name);
         }
         else
         {
-            qfprintf(output_file, "| %5d | %-36s | N/A                                               |\n", stats_entry->count, string_guid(&stats_entry->guid));
+            qfprintf(output_file, "| %5d | %-36s | N/A                                               |\n", stats_entry->count, format_guid(&stats_entry->guid, guid_string));
         }
     }
     qfprintf(output_file, "`--------------------------------------------------------------------------------------------------´\n");
     
-    /* output information about installed protocols, if any exist */
-    if (g_boot_services_stats.installed_protocols > 0)
+    /* output information about installed PPIs, if any exist */
+    if (ctx->pei_services_stats.installed_ppis > 0)
     {
         qfprintf(output_file, ".------------------------------------------------------------------------------------------.\n");
-        qfprintf(output_file, "|                               Installed Protocols                                        |\n");
-        qfprintf(output_file, ".--------------------------------------.---------------------------------------------------.\n");
+        qfprintf(output_file, "|                                  Installed PPIs                                          |\n");
+        qfprintf(output_file, ".--------------------------------------.----------------------------------------------------.\n");
         qfprintf(output_file, "|                GUID                  |                    Description                    |\n");
-        qfprintf(output_file, ".--------------------------------------'----------------------------------.----------------.\n");
+        qfprintf(output_file, ".--------------------------------------'----------------------------------------------------.\n");
         
-        LL_FOREACH(g_boot_services_stats.guid_stats_head, stats_entry)
+        GUID_STATS_FOREACH(&ctx->pei_services_stats.guid_stats, stats_entry)
         {
-            if (stats_entry->type == kInstallProcotol || stats_entry->type == kInstallMultiProtocol)
+            if (stats_entry->type == kInstallPpi)
             {
                 /* try to see if it's a known GUID */
-                int found = 0;
-                int index = 0;
-                for (int i = 0; i < sizeof(guid_table) / sizeof(*guid_table) - 1; i++)
-                {
-                    if (memcmp((void*)&guid_table[i].guid, (void*)&stats_entry->guid, sizeof(EFI_GUID)) == 0)
-                    {
-                        found = 1;
-                        index = i;
-                        break;
-                    }
-                }
-                if (found)
+                const char *guid_name = lookup_guid_name(&stats_entry->guid);
+                if (guid_name != NULL)
                 {
-                    qfprintf(output_file, "| %-36s | %-49s |\n", string_guid(&stats_entry->guid), guid_table[index].name);
+                    qfprintf(output_file, "| %-36s | %-49s |\n", format_guid(&stats_entry->guid, guid_string), guid_name);
                 }
                 else
                 {
-                    qfprintf(output_file, "| %-36s | N/A                                               |\n", string_guid(&stats_entry->guid));
+                    qfprintf(output_file, "| %-36s | N/A                                               |\n", format_guid(&stats_entry->guid, guid_string));
                 }
             }
         }
@@ -1493,7 +2537,7 @@ log_protocols_usage(FILE *output_file)
 #pragma mark -
 
 static void
-sql_file_entry(void)
+sql_file_entry(struct analysis_context *ctx)
 {
     if (g_db_connection == NULL)
     {
@@ -1510,8 +2554,8 @@ sql_file_entry(void)
         ERROR_MSG("Failed prepare statement.");
         return;
     }
-    sqlite3_bind_text(sqlStatement, 1, g_target_guid, -1, SQLITE_STATIC);
-    sqlite3_bind_text(sqlStatement, 2, command_line_file, -1, SQLITE_STATIC);
+    sqlite3_bind_text(sqlStatement, 1, ctx->target_guid, -1, SQLITE_STATIC);
+    sqlite3_bind_text(sqlStatement, 2, view_input_path(), -1, SQLITE_STATIC);
     /* XXX: fix type */
     sqlite3_bind_int(sqlStatement, 3, 0);
     /* XXX: fix error */
@@ -1535,7 +2579,7 @@ sql_file_entry(void)
  * go over the tables and display each service usage count
  */
 static void
-sql_protocols_usage(void)
+sql_protocols_usage(struct analysis_context *ctx)
 {
     if (g_db_connection == NULL)
     {
@@ -1553,28 +2597,19 @@ sql_protocols_usage(void)
         ERROR_MSG("Failed prepare statement.");
         return;
     }
-    sqlite3_bind_text(sqlStatement, 1, g_target_guid, -1, SQLITE_STATIC);
+    sqlite3_bind_text(sqlStatement, 1, ctx->target_guid, -1, SQLITE_STATIC);
 
     struct guid_stats *stats_entry = NULL;
-    LL_FOREACH(g_boot_services_stats.guid_stats_head, stats_entry)
+    char guid_string[GUID_STRING_SIZE] = {0};
+    GUID_STATS_FOREACH(&ctx->boot_services_stats.guid_stats, stats_entry)
     {
         /* try to see if it's a known GUID */
-        int found = 0;
-        int index = 0;
-        for (int i = 0; i < sizeof(guid_table) / sizeof(*guid_table) - 1; i++)
-        {
-            if (memcmp((void*)&guid_table[i].guid, (void*)&stats_entry->guid, sizeof(EFI_GUID)) == 0)
-            {
-                found = 1;
-                index = i;
-                break;
-            }
-        }
-        sqlite3_bind_text(sqlStatement, 2, string_guid(&stats_entry->guid), -1, SQLITE_STATIC);
+        const char *guid_name = lookup_guid_name(&stats_entry->guid);
+        sqlite3_bind_text(sqlStatement, 2, format_guid(&stats_entry->guid, guid_string), -1, SQLITE_STATIC);
 
-        if (found)
+        if (guid_name != NULL)
         {
-            sqlite3_bind_text(sqlStatement, 3, guid_table[index].name, -1, SQLITE_STATIC);
+            sqlite3_bind_text(sqlStatement, 3, guid_name, -1, SQLITE_STATIC);
 
         }
         else
@@ -1598,7 +2633,7 @@ sql_protocols_usage(void)
     }
     sqlite3_finalize(sqlStatement);
     
-    if (g_boot_services_stats.installed_protocols > 0)
+    if (ctx->boot_services_stats.installed_protocols > 0)
     {
         DEBUG_MSG("Preparing to insert installed protocols data...");
         ret = sqlite3_prepare_v2(g_db_connection, "INSERT INTO installed_protocols VALUES (?,?,?)", -1, &sqlStatement, NULL);
@@ -1608,25 +2643,13 @@ sql_protocols_usage(void)
             return;
         }
 
-        sqlite3_bind_text(sqlStatement, 1, g_target_guid, -1, SQLITE_STATIC);
+        sqlite3_bind_text(sqlStatement, 1, ctx->target_guid, -1, SQLITE_STATIC);
 
-        LL_FOREACH(g_boot_services_stats.guid_stats_head, stats_entry)
+        GUID_STATS_FOREACH(&ctx->boot_services_stats.guid_stats, stats_entry)
         {
             if (stats_entry->type == kInstallProcotol || stats_entry->type == kInstallMultiProtocol)
             {
-                /* try to see if it's a known GUID */
-                int found = 0;
-                int index = 0;
-                for (int i = 0; i < sizeof(guid_table) / sizeof(*guid_table) - 1; i++)
-                {
-                    if (memcmp((void*)&guid_table[i].guid, (void*)&stats_entry->guid, sizeof(EFI_GUID)) == 0)
-                    {
-                        found = 1;
-                        index = i;
-                        break;
-                    }
-                }
-                sqlite3_bind_text(sqlStatement, 2, string_guid(&stats_entry->guid), -1, SQLITE_STATIC);
+                sqlite3_bind_text(sqlStatement, 2, format_guid(&stats_entry->guid, guid_string), -1, SQLITE_STATIC);
                 sqlite3_bind_int(sqlStatement, 3, stats_entry->type);
                 
                 DEBUG_MSG("Executing statement...");
@@ -1647,7 +2670,7 @@ sql_protocols_usage(void)
 }
 
 static void
-sql_boot_services_usage(void)
+sql_boot_services_usage(struct analysis_context *ctx)
 {
     if (g_db_connection == NULL)
     {
@@ -1666,12 +2689,12 @@ sql_boot_services_usage(void)
         ERROR_MSG("Failed prepare statement: %d.", ret);
         return;
     }
-    sqlite3_bind_text(sqlStatement, 1, g_target_guid, -1, SQLITE_STATIC);
+    sqlite3_bind_text(sqlStatement, 1, ctx->target_guid, -1, SQLITE_STATIC);
 
-    size_t array_size = sizeof(boot_services_table) / sizeof(*boot_services_table);
-    for (int i = 1; i < array_size-1; i++)
+    size_t array_size = BOOT_SERVICES_ENTRIES;
+    for (size_t i = 1; i < array_size-1; i++)
     {
-        sqlite3_bind_int(sqlStatement, i+1, boot_services_table[i].count);
+        sqlite3_bind_int(sqlStatement, i+1, ctx->boot_services_count[i]);
     }
     DEBUG_MSG("Executing statement...");
     while ((ret = sqlite3_step(sqlStatement)) == SQLITE_ROW)
@@ -1688,7 +2711,7 @@ sql_boot_services_usage(void)
 }
 
 static void
-sql_runtime_services_usage(void)
+sql_runtime_services_usage(struct analysis_context *ctx)
 {
     if (g_db_connection == NULL)
     {
@@ -1707,12 +2730,12 @@ sql_runtime_services_usage(void)
         ERROR_MSG("Failed prepare statement: %d.", ret);
         return;
     }
-    sqlite3_bind_text(sqlStatement, 1, g_target_guid, -1, SQLITE_STATIC);
+    sqlite3_bind_text(sqlStatement, 1, ctx->target_guid, -1, SQLITE_STATIC);
     
-    size_t array_size = sizeof(runtime_services_table) / sizeof(*runtime_services_table);
-    for (int i = 1; i < array_size-1; i++)
+    size_t array_size = RUNTIME_SERVICES_ENTRIES;
+    for (size_t i = 1; i < array_size-1; i++)
     {
-        sqlite3_bind_int(sqlStatement, i+1, runtime_services_table[i].count);
+        sqlite3_bind_int(sqlStatement, i+1, ctx->runtime_services_count[i]);
     }
 
     DEBUG_MSG("Executing statement...");
@@ -1729,43 +2752,271 @@ sql_runtime_services_usage(void)
     DEBUG_MSG("Ret value %d", ret);
 }
 
-#pragma mark -
-#pragma mark GUID printing related functions
-#pragma mark -
+static void
+sql_smm_services_usage(struct analysis_context *ctx)
+{
+    if (g_db_connection == NULL)
+    {
+        ERROR_MSG("Invalid database handle.");
+        return;
+    }
+    
+    DEBUG_MSG("Preparing to insert SMM services usage data...");
+    
+    sqlite3_stmt *sqlStatement = NULL;
+    int ret = 0;
+    
+    ret = sqlite3_prepare_v2(g_db_connection, "INSERT INTO smm_service_stats VALUES (?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?)", -1, &sqlStatement, NULL);
+    if (ret != SQLITE_OK)
+    {
+        ERROR_MSG("Failed prepare statement: %d.", ret);
+        return;
+    }
+    sqlite3_bind_text(sqlStatement, 1, ctx->target_guid, -1, SQLITE_STATIC);
+    
+    size_t array_size = SMM_SERVICES_ENTRIES;
+    for (size_t i = 1; i < array_size-1; i++)
+    {
+        sqlite3_bind_int(sqlStatement, i+1, ctx->smm_services_count[i]);
+    }
+    
+    DEBUG_MSG("Executing statement...");
+    while ((ret = sqlite3_step(sqlStatement)) == SQLITE_ROW)
+    {
+        
+    }
+    if (ret != SQLITE_DONE)
+    {
+        ERROR_MSG("Error inserting db record.");
+        return;
+    }
+    sqlite3_reset(sqlStatement);
+    DEBUG_MSG("Ret value %d", ret);
+    sqlite3_finalize(sqlStatement);
+}
+
+/*
+ * the SMM protocols go to the same tables as the boot services ones, with their own types
+ */
+static void
+sql_smm_protocols_usage(struct analysis_context *ctx)
+{
+    if (g_db_connection == NULL)
+    {
+        ERROR_MSG("Invalid database handle.");
+        return;
+    }
+    
+    DEBUG_MSG("Preparing to insert SMM protocols usage data...");
+    sqlite3_stmt *sqlStatement = NULL;
+    int ret = 0;
+    
+    ret = sqlite3_prepare_v2(g_db_connection, "INSERT INTO protocols_usage VALUES (?,?,?,?)", -1, &sqlStatement, NULL);
+    if (ret != SQLITE_OK)
+    {
+        ERROR_MSG("Failed prepare statement.");
+        return;
+    }
+    sqlite3_bind_text(sqlStatement, 1, ctx->target_guid, -1, SQLITE_STATIC);
+    
+    struct guid_stats *stats_entry = NULL;
+    char guid_string[GUID_STRING_SIZE] = {0};
+    GUID_STATS_FOREACH(&ctx->smm_services_stats.guid_stats, stats_entry)
+    {
+        const char *guid_name = lookup_guid_name(&stats_entry->guid);
+        sqlite3_bind_text(sqlStatement, 2, format_guid(&stats_entry->guid, guid_string), -1, SQLITE_STATIC);
+        sqlite3_bind_text(sqlStatement, 3, guid_name != NULL ? guid_name : "N/A", -1, SQLITE_STATIC);
+        sqlite3_bind_int(sqlStatement, 4, stats_entry->type);
+        
+        DEBUG_MSG("Executing statement...");
+        while ((ret = sqlite3_step(sqlStatement)) == SQLITE_ROW)
+        {
+            
+        }
+        if (ret != SQLITE_DONE)
+        {
+            ERROR_MSG("Error inserting db record.");
+            return;
+        }
+        sqlite3_reset(sqlStatement);
+        DEBUG_MSG("Ret value %d", ret);
+    }
+    sqlite3_finalize(sqlStatement);
+    
+    if (ctx->smm_services_stats.installed_protocols > 0)
+    {
+        DEBUG_MSG("Preparing to insert installed SMM protocols data...");
+        ret = sqlite3_prepare_v2(g_db_connection, "INSERT INTO installed_protocols VALUES (?,?,?)", -1, &sqlStatement, NULL);
+        if (ret != SQLITE_OK)
+        {
+            ERROR_MSG("Failed to prepare installed protocols statement: %d", ret);
+            return;
+        }
+        
+        sqlite3_bind_text(sqlStatement, 1, ctx->target_guid, -1, SQLITE_STATIC);
+        
+        GUID_STATS_FOREACH(&ctx->smm_services_stats.guid_stats, stats_entry)
+        {
+            if (stats_entry->type == kSmmInstallProtocol)
+            {
+                sqlite3_bind_text(sqlStatement, 2, format_guid(&stats_entry->guid, guid_string), -1, SQLITE_STATIC);
+                sqlite3_bind_int(sqlStatement, 3, stats_entry->type);
+                
+                DEBUG_MSG("Executing statement...");
+                while ((ret = sqlite3_step(sqlStatement)) == SQLITE_ROW)
+                {
+                    
+                }
+                if (ret != SQLITE_DONE)
+                {
+                    ERROR_MSG("Error inserting db record.");
+                    return;
+                }
+                sqlite3_reset(sqlStatement);
+                DEBUG_MSG("Ret value %d", ret);
+            }
+        }
+        sqlite3_finalize(sqlStatement);
+    }
+}
 
-static char *
-string_guid(EFI_GUID *guid)
+static void
+sql_pei_services_usage(struct analysis_context *ctx)
 {
-    static char guid_string[256] = {0};
-    qsnprintf(guid_string, sizeof(guid_string), "%08X-%04X-%04X-%02X%02X-%02X%02X%02X%02X%02X%02X",
-              guid->Data1, guid->Data2, guid->Data3,
-              guid->Data4[0], guid->Data4[1], guid->Data4[2], guid->Data4[3],
-              guid->Data4[4], guid->Data4[5], guid->Data4[6], guid->Data4[7]);
+    if (g_db_connection == NULL)
+    {
+        ERROR_MSG("Invalid database handle.");
+        return;
+    }
+    
+    DEBUG_MSG("Preparing to insert PEI services usage data...");
+    
+    sqlite3_stmt *sqlStatement = NULL;
+    int ret = 0;
+    
+    ret = sqlite3_prepare_v2(g_db_connection, "INSERT INTO pei_service_stats VALUES (?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?,?)", -1, &sqlStatement, NULL);
+    if (ret != SQLITE_OK)
+    {
+        ERROR_MSG("Failed prepare statement: %d.", ret);
+        return;
+    }
+    sqlite3_bind_text(sqlStatement, 1, ctx->target_guid, -1, SQLITE_STATIC);
+    
+    size_t array_size = PEI_SERVICES_ENTRIES;
+    for (size_t i = 1; i < array_size-1; i++)
+    {
+        sqlite3_bind_int(sqlStatement, i+1, ctx->pei_services_count[i]);
+    }
     
-    return guid_string;
+    DEBUG_MSG("Executing statement...");
+    while ((ret = sqlite3_step(sqlStatement)) == SQLITE_ROW)
+    {
+        
+    }
+    if (ret != SQLITE_DONE)
+    {
+        ERROR_MSG("Error inserting db record.");
+        return;
+    }
+    sqlite3_reset(sqlStatement);
+    DEBUG_MSG("Ret value %d", ret);
+    sqlite3_finalize(sqlStatement);
 }
 
-/* helper to just print the GUID */
 static void
-print_guid(EFI_GUID *guid)
+sql_ppis_usage(struct analysis_context *ctx)
 {
-    OUTPUT_MSG("%08X-%04X-%04X-%02X%02X-%02X%02X%02X%02X%02X%02X",
-               guid->Data1, guid->Data2, guid->Data3,
-               guid->Data4[0], guid->Data4[1], guid->Data4[2], guid->Data4[3],
-               guid->Data4[4], guid->Data4[5], guid->Data4[6], guid->Data4[7]);
+    if (g_db_connection == NULL)
+    {
+        ERROR_MSG("Invalid database handle.");
+        return;
+    }
+    
+    DEBUG_MSG("Preparing to insert PPIs usage data...");
+    sqlite3_stmt *sqlStatement = NULL;
+    int ret = 0;
+    
+    ret = sqlite3_prepare_v2(g_db_connection, "INSERT INTO ppis_usage VALUES (?,?,?,?)", -1, &sqlStatement, NULL);
+    if (ret != SQLITE_OK)
+    {
+        ERROR_MSG("Failed prepare statement.");
+        return;
+    }
+    sqlite3_bind_text(sqlStatement, 1, ctx->target_guid, -1, SQLITE_STATIC);
+    
+    struct guid_stats *stats_entry = NULL;
+    char guid_string[GUID_STRING_SIZE] = {0};
+    GUID_STATS_FOREACH(&ctx->pei_services_stats.guid_stats, stats_entry)
+    {
+        /* try to see if it's a known GUID */
+        const char *guid_name = lookup_guid_name(&stats_entry->guid);
+        sqlite3_bind_text(sqlStatement, 2, format_guid(&stats_entry->guid, guid_string), -1, SQLITE_STATIC);
+        sqlite3_bind_text(sqlStatement, 3, guid_name != NULL ? guid_name : "N/A", -1, SQLITE_STATIC);
+        sqlite3_bind_int(sqlStatement, 4, stats_entry->type);
+        
+        DEBUG_MSG("Executing statement...");
+        while ((ret = sqlite3_step(sqlStatement)) == SQLITE_ROW)
+        {
+            
+        }
+        if (ret != SQLITE_DONE)
+        {
+            ERROR_MSG("Error inserting db record.");
+            return;
+        }
+        sqlite3_reset(sqlStatement);
+        DEBUG_MSG("Ret value %d", ret);
+    }
+    sqlite3_finalize(sqlStatement);
+    
+    if (ctx->pei_services_stats.installed_ppis > 0)
+    {
+        DEBUG_MSG("Preparing to insert installed PPIs data...");
+        ret = sqlite3_prepare_v2(g_db_connection, "INSERT INTO installed_ppis VALUES (?,?,?)", -1, &sqlStatement, NULL);
+        if (ret != SQLITE_OK)
+        {
+            ERROR_MSG("Failed to prepare installed PPIs statement: %d", ret);
+            return;
+        }
+        
+        sqlite3_bind_text(sqlStatement, 1, ctx->target_guid, -1, SQLITE_STATIC);
+        
+        GUID_STATS_FOREACH(&ctx->pei_services_stats.guid_stats, stats_entry)
+        {
+            if (stats_entry->type == kInstallPpi)
+            {
+                sqlite3_bind_text(sqlStatement, 2, format_guid(&stats_entry->guid, guid_string), -1, SQLITE_STATIC);
+                sqlite3_bind_int(sqlStatement, 3, stats_entry->type);
+                
+                DEBUG_MSG("Executing statement...");
+                while ((ret = sqlite3_step(sqlStatement)) == SQLITE_ROW)
+                {
+                    
+                }
+                if (ret != SQLITE_DONE)
+                {
+                    ERROR_MSG("Error inserting db record.");
+                    return;
+                }
+                sqlite3_reset(sqlStatement);
+                DEBUG_MSG("Ret value %d", ret);
+            }
+        }
+        sqlite3_finalize(sqlStatement);
+    }
 }
 
+#pragma mark -
+#pragma mark GUID printing related functions
+#pragma mark -
+
 static void
-make_guid_cmt(EFI_GUID *guid, ea_t target_addr)
+make_guid_cmt(const EFI_GUID *guid, ea_t target_addr)
 {
     if (guid->Data1 == 0x00000000)
     {
         return;
     }
-    char cmt_string[1024] = {0};
-    qsnprintf(cmt_string, sizeof(cmt_string), "%08X-%04X-%04X-%02X%02X-%02X%02X%02X%02X%02X%02X",
-              guid->Data1, guid->Data2, guid->Data3,
-              guid->Data4[0], guid->Data4[1], guid->Data4[2], guid->Data4[3],
-              guid->Data4[4], guid->Data4[5], guid->Data4[6], guid->Data4[7]);
-    set_cmt(target_addr, cmt_string, 0);
+    char cmt_string[GUID_STRING_SIZE] = {0};
+    view_set_comment(target_addr, format_guid(guid, cmt_string));
 }
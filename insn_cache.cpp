@@ -0,0 +1,223 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * insn_cache.cpp
+ *
+ */
+
+#include "insn_cache.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define INSN_CACHE_MIN_SLOTS    256
+
+/*
+ * decode all code heads in [start, end] into a new block
+ */
+static struct insn_block *
+decode_block(struct insn_cache *cache, ea_t start, ea_t end)
+{
+    struct insn_block *block = (struct insn_block*)calloc(1, sizeof(struct insn_block));
+    if (block == NULL)
+    {
+        return NULL;
+    }
+    block->start = start;
+    block->end = end;
+    
+    size_t capacity = 0;
+    ea_t current_addr = start;
+    if (!view_is_code(current_addr))
+    {
+        current_addr = view_next_code(current_addr);
+    }
+    while (current_addr != BADADDR && current_addr <= end)
+    {
+        if (block->count == capacity)
+        {
+            size_t new_capacity = capacity ? capacity * 2 : 64;
+            struct cached_insn *new_insns = (struct cached_insn*)realloc(block->insns, new_capacity * sizeof(struct cached_insn));
+            if (new_insns == NULL)
+            {
+                break;
+            }
+            block->insns = new_insns;
+            capacity = new_capacity;
+        }
+        cache->decoded++;
+        if (view_decode_insn(current_addr, &block->insns[block->count]) != 0)
+        {
+            block->count++;
+        }
+        current_addr = view_next_code(current_addr);
+    }
+    return block;
+}
+
+static inline uint32_t
+hash_range(ea_t start, ea_t end)
+{
+    uint64_t h = ((uint64_t)start * 0x9E3779B97F4A7C15ULL) ^ (uint64_t)end;
+    h ^= h >> 32;
+    return (uint32_t)h;
+}
+
+/* slots hold block index + 1, zero is an empty slot */
+static int
+grow_insn_cache_slots(struct insn_cache *cache)
+{
+    uint32_t new_size = cache->slots_size ? cache->slots_size * 2 : INSN_CACHE_MIN_SLOTS;
+    uint32_t *new_slots = (uint32_t*)calloc(new_size, sizeof(uint32_t));
+    if (new_slots == NULL)
+    {
+        return 1;
+    }
+    for (uint32_t i = 0; i < cache->count; i++)
+    {
+        uint32_t slot = hash_range(cache->blocks[i]->start, cache->blocks[i]->end) & (new_size - 1);
+        while (new_slots[slot] != 0)
+        {
+            slot = (slot + 1) & (new_size - 1);
+        }
+        new_slots[slot] = i + 1;
+    }
+    free(cache->slots);
+    cache->slots = new_slots;
+    cache->slots_size = new_size;
+    return 0;
+}
+
+/*
+ * decoded instructions for [start, end], decoding only the first time the range is asked for
+ * returns NULL if out of memory
+ */
+const struct insn_block *
+cache_range_insns(struct insn_cache *cache, ea_t start, ea_t end)
+{
+    /* keep the load factor under 1/2 */
+    if ((cache->count + 1) * 2 > cache->slots_size)
+    {
+        if (grow_insn_cache_slots(cache) != 0)
+        {
+            return NULL;
+        }
+    }
+    
+    uint32_t mask = cache->slots_size - 1;
+    uint32_t slot = hash_range(start, end) & mask;
+    while (cache->slots[slot] != 0)
+    {
+        struct insn_block *block = cache->blocks[cache->slots[slot] - 1];
+        if (block->start == start && block->end == end)
+        {
+            return block;
+        }
+        slot = (slot + 1) & mask;
+    }
+    
+    if (cache->count == cache->capacity)
+    {
+        uint32_t new_capacity = cache->capacity ? cache->capacity * 2 : 64;
+        struct insn_block **new_blocks = (struct insn_block**)realloc(cache->blocks, new_capacity * sizeof(struct insn_block*));
+        if (new_blocks == NULL)
+        {
+            return NULL;
+        }
+        cache->blocks = new_blocks;
+        cache->capacity = new_capacity;
+    }
+    struct insn_block *block = decode_block(cache, start, end);
+    if (block == NULL)
+    {
+        return NULL;
+    }
+    cache->blocks[cache->count++] = block;
+    cache->slots[slot] = cache->count;
+    return block;
+}
+
+/*
+ * decoded instructions of the function containing address
+ * returns NULL if address isn't inside a function
+ */
+const struct insn_block *
+cache_function_insns(struct insn_cache *cache, ea_t address)
+{
+    struct binary_function f;
+    if (view_function_containing(address, &f) != 0)
+    {
+        return NULL;
+    }
+    /* the end is exclusive */
+    return cache_range_insns(cache, f.start, f.end - 1);
+}
+
+/*
+ * index of the instruction at address or -1 if it's not an instruction head in the block
+ */
+long
+find_cached_insn(const struct insn_block *block, ea_t address)
+{
+    size_t low = 0;
+    size_t high = block->count;
+    while (low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+        if (block->insns[middle].ea < address)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    if (low < block->count && block->insns[low].ea == address)
+    {
+        return (long)low;
+    }
+    return -1;
+}
+
+void
+free_insn_cache(struct insn_cache *cache)
+{
+    for (uint32_t i = 0; i < cache->count; i++)
+    {
+        free(cache->blocks[i]->insns);
+        free(cache->blocks[i]);
+    }
+    free(cache->blocks);
+    free(cache->slots);
+    memset(cache, 0, sizeof(struct insn_cache));
+}
@@ -0,0 +1,145 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * insn_cache.h
+ *
+ */
+
+#ifndef efi_swiss_knife_insn_cache_h
+#define efi_swiss_knife_insn_cache_h
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "binary_view.h"
+
+/*
+ * compact decoded instructions so each function is only disassembled once
+ * and every analysis pass walks the same arrays
+ *
+ * the kinds and operand types are our own so the passes don't depend on
+ * the disassembler, register numbers follow the x86 encoding
+ */
+
+enum insn_kind
+{
+    kInsnOther = 0,
+    kInsnMov,
+    kInsnLea,
+    kInsnCall,
+    kInsnCallIndirect,
+    kInsnJmpIndirect,
+    kInsnJmp,
+    /* conditional branches and loops, anything else with a near target */
+    kInsnJcc,
+    kInsnRet,
+    kInsnXor,
+    /* stack arguments on IA32 */
+    kInsnPush,
+    kInsnPop,
+    /* only interesting for the stack pointer adjustments */
+    kInsnAdd,
+    kInsnSub
+};
+
+enum insn_operand_type
+{
+    kOpNone = 0,
+    kOpReg,
+    kOpMem,
+    kOpPhrase,
+    kOpDispl,
+    kOpImm,
+    kOpNear,
+    kOpOther
+};
+
+struct insn_operand
+{
+    uint8_t type;
+    /* register for kOpReg, base register for kOpPhrase and kOpDispl */
+    uint16_t reg;
+    /* memory address, displacement or branch target */
+    ea_t addr;
+    uint64_t value;
+};
+
+/* cached_insn flags */
+#define INSN_CHANGES_OP0    0x1
+/* execution doesn't continue to the next instruction */
+#define INSN_STOPS_FLOW     0x2
+
+struct cached_insn
+{
+    ea_t ea;
+    uint16_t kind;
+    uint16_t size;
+    uint16_t flags;
+    struct insn_operand ops[2];
+};
+
+/* all code heads between start and end, in address order */
+struct insn_block
+{
+    ea_t start;
+    ea_t end;
+    struct cached_insn *insns;
+    size_t count;
+};
+
+struct insn_cache
+{
+    struct insn_block **blocks;
+    uint32_t count;
+    uint32_t capacity;
+    uint32_t *slots;
+    uint32_t slots_size;
+    /* number of decode_insn calls made to fill the cache */
+    size_t decoded;
+    /* number of instructions read by the analysis passes, what decoding every time would cost */
+    size_t visited;
+};
+
+const struct insn_block * cache_function_insns(struct insn_cache *cache, ea_t address);
+const struct insn_block * cache_range_insns(struct insn_cache *cache, ea_t start, ea_t end);
+long find_cached_insn(const struct insn_block *block, ea_t address);
+void free_insn_cache(struct insn_cache *cache);
+
+/* read an instruction from a block, counted so we can compare against decoding every time */
+static inline const struct cached_insn *
+cached_insn(struct insn_cache *cache, const struct insn_block *block, size_t index)
+{
+    cache->visited++;
+    return &block->insns[index];
+}
+
+#endif /* insn_cache_h */
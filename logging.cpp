@@ -36,23 +36,12 @@
 
 #include "logging.h"
 
-#include <ida.hpp>
-#include <idp.hpp>
-#include <loader.hpp>
-#include <bytes.hpp>
-#include <kernwin.hpp>
-#include <search.hpp>
-#include <allins.hpp>
-#include <segment.hpp>
 #include <limits.h>
-#include <auto.hpp>
-#include <name.hpp>
-#include <frame.hpp>
-#include <struct.hpp>
-#include <funcs.hpp>
-
+#include <stdarg.h>
 #include <time.h>
 
+#include "binary_view.h"
+
 #include "config.h"
 
 static FILE *g_log_file;
@@ -63,7 +52,7 @@ open_log_file(void)
     g_log_file = qfopen(LOG_FILE, "a+");
     if (g_log_file == NULL)
     {
-        ERROR_MSG("Can't open log file: %s %s.", LOG_FILE);
+        ERROR_MSG("Can't open log file: %s.", LOG_FILE);
         return 1;
     }
     /* time stamp start of log */
@@ -82,7 +71,7 @@ open_log_file(void)
         }
     }
     qfprintf(g_log_file, "---[ Start @ %s ]---\n", logtime_string);
-    qfprintf(g_log_file, "---[ Target: %s ]---\n", command_line_file);
+    qfprintf(g_log_file, "---[ Target: %s ]---\n", view_input_path());
     return 0;
 }
 
@@ -106,8 +95,9 @@ close_log_file(void)
             }
         }
         qfprintf(g_log_file, "---[ End @ %s ]---\n", logtime_string);
-        qfprintf(g_log_file, "---[ Target: %s ]---\n\n", command_line_file);
+        qfprintf(g_log_file, "---[ Target: %s ]---\n\n", view_input_path());
         qfclose(g_log_file);
+        g_log_file = NULL;
     }
     return 0;
 }
@@ -117,7 +107,8 @@ log_error_msg(const char *format, ...)
 {
     va_list args;
     va_start(args, format);
-    if (g_config.generate_log == 1)
+    /* errors can come before the log is opened or after it's closed */
+    if (g_config.generate_log == 1 && g_log_file != NULL)
     {
         qvfprintf(g_log_file, format, args);
     }
@@ -136,7 +127,7 @@ log_debug_msg(const char *format, ...)
     {
         va_list args;
         va_start(args, format);
-        if (g_config.generate_log == 1)
+        if (g_config.generate_log == 1 && g_log_file != NULL)
         {
             qvfprintf(g_log_file, format, args);
         }
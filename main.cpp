@@ -47,13 +47,11 @@
 #include "initial_checks.h"
 #include "config.h"
 #include "logging.h"
+#include "guid_index.h"
+#include "image_format.h"
 
 #define VERSION "1.0"
 
-#define EFI_IMAGE_DOS_SIGNATURE     0x5A4D     // MZ
-#define EFI_IMAGE_PE_SIGNATURE      0x00004550 // PE
-#define EFI_IMAGE_TE_SIGNATURE      0x5A56     // VZ
-
 /* default options set */
 struct config g_config = { .comment_prototype = 1, .comment_description = 0, .comment_guid = 1, .generate_stats = 1, .generate_log = 0, .output_log = 0, .output_sql = 0, .debug_msgs = 0};
 
@@ -73,6 +71,7 @@ int IDAP_init(void)
 
 void IDAP_term(void)
 {
+    close_guid_index();
     if (g_config.generate_log == 1)
     {
         close_log_file();
@@ -80,6 +79,36 @@ void IDAP_term(void)
     return;
 }
 
+/*
+ * loaders that map a TE image from its file offsets leave every address
+ * StrippedSize - sizeof(EFI_TE_IMAGE_HEADER) bytes below the one the image
+ * was linked for, so absolute addresses in the code point nowhere
+ * the entry point tells us where the image really is, rebase if needed
+ */
+static int
+fix_te_addresses(void)
+{
+    EFI_TE_IMAGE_HEADER te_header;
+    ea_t header_addr = BADADDR;
+    if (read_te_header(&te_header, &header_addr) != 0)
+    {
+        return 1;
+    }
+    ea_t expected_entry = (ea_t)te_header.ImageBase + te_header.AddressOfEntryPoint;
+    if (inf.beginEA == BADADDR || inf.beginEA == expected_entry)
+    {
+        return 0;
+    }
+    adiff_t delta = (adiff_t)(expected_entry - inf.beginEA);
+    OUTPUT_MSG("TE image loaded at the wrong address, rebasing by 0x%llx.", (uint64_t)delta);
+    if (rebase_program(delta, MSF_FIXONCE) != MOVE_SEGM_OK)
+    {
+        ERROR_MSG("Failed to rebase TE image.");
+        return 1;
+    }
+    return 0;
+}
+
 /*
  * where all the fun starts!
  *
@@ -97,19 +126,20 @@ void IDAP_run(int arg)
     extern plugin_t PLUGIN;
 	PLUGIN.flags |= PLUGIN_UNL;
     
-    /* XXX: TE binaries not supported at the moment */
     segment_t *seg_info = get_segm_by_name("HEADER");
     if (seg_info == NULL)
     {
         ERROR_MSG("Can't find a valid code segment!");
         return;
     }
-    ea_t current_addr = seg_info->startEA;
-    uint16_t header_bytes = 0;
-    get_many_bytes(current_addr, &header_bytes, sizeof(header_bytes));
-    if (header_bytes == EFI_IMAGE_TE_SIGNATURE)
+    int format = current_image_format();
+    if (format == kImageUnknown)
+    {
+        ERROR_MSG("Unknown image format, only PE and TE binaries are supported.");
+        return;
+    }
+    if (format == kImageTE && fix_te_addresses() != 0)
     {
-        ERROR_MSG("TE Binaries not supported at the moment.");
         return;
     }
     
@@ -0,0 +1,86 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * module_arch.h
+ *
+ */
+
+#ifndef efi_swiss_knife_module_arch_h
+#define efi_swiss_knife_module_arch_h
+
+#include <stdint.h>
+
+#include "binary_view.h"
+
+/*
+ * everything that differs between IA32 and x64 modules
+ * picked once when the analysis starts so the passes never ask IDA again
+ */
+struct module_arch
+{
+    const char *name;
+    /* 4 or 8, the size of every services table entry */
+    uint8_t pointer_size;
+    /* EFIAPI is cdecl on IA32, all arguments are pushed */
+    uint8_t stack_args;
+    /* offsets of the services tables pointers inside EFI_SYSTEM_TABLE */
+    ea_t system_table_boot;
+    ea_t system_table_runtime;
+};
+
+/* the services tables all start with an EFI_TABLE_HEADER */
+#define SERVICES_TABLE_HEADER_SIZE  0x18
+
+extern const struct module_arch g_arch_x64;
+extern const struct module_arch g_arch_ia32;
+
+const struct module_arch * current_module_arch(void);
+
+/*
+ * the x64 offset of a services table entry, which is what the services tables are indexed by
+ * returns BADADDR for offsets that can't be an entry
+ */
+static inline ea_t
+canonical_service_offset(const struct module_arch *arch, ea_t offset)
+{
+    if (arch->pointer_size == 8 || offset < SERVICES_TABLE_HEADER_SIZE)
+    {
+        return offset;
+    }
+    if ((offset - SERVICES_TABLE_HEADER_SIZE) % arch->pointer_size != 0)
+    {
+        return BADADDR;
+    }
+    return SERVICES_TABLE_HEADER_SIZE + (offset - SERVICES_TABLE_HEADER_SIZE) / arch->pointer_size * 8;
+}
+
+#endif /* module_arch_h */
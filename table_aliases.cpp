@@ -0,0 +1,1066 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * table_aliases.cpp
+ *
+ */
+
+#include "table_aliases.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "efi_types.h"
+#include "logging.h"
+
+/*
+ * interprocedural search for every global holding gST, gBS or gRT
+ *
+ * each function reachable from the entry point is decoded and summarised once,
+ * the summary is what it stores into globals and what it passes to its callees
+ * in terms of its own arguments and of values loaded from globals, e.g.
+ * "stores [arg2 + 0x60] into global X" or "calls Y with arg2 as its second argument"
+ *
+ * a worklist then pushes the tables known to be in the entry point arguments through
+ * the summaries until nothing changes, without going back to the instructions
+ *
+ * gSmst doesn't come from the system table but from the EFI_SMM_BASE2_PROTOCOL,
+ * so the summaries also keep the LocateProtocol calls for it and the GetSmstLocation
+ * calls made through whatever they returned
+ *
+ * on IA32 the arguments are on the stack, the summary follows the pushes and the
+ * stack pointer adjustments so [esp+d] and [ebp+d] resolve to an argument or to
+ * a slot the function wrote itself, which is also where its callees arguments are
+ */
+
+#define SUMMARY_REGS        16
+
+#define REG_RAX             0x0
+#define REG_RCX             0x1
+#define REG_RDX             0x2
+#define REG_RSP             0x4
+#define REG_RBP             0x5
+#define REG_R8              0x8
+#define REG_R9              0x9
+#define REG_R10             0xA
+#define REG_R11             0xB
+
+#define NR_SUMMARY_ARGS     4
+
+static const uint16_t g_summary_args[NR_SUMMARY_ARGS] = { REG_RCX, REG_RDX, REG_R8, REG_R9 };
+static const uint16_t g_summary_volatile[] = { REG_RAX, REG_RCX, REG_RDX, REG_R8, REG_R9, REG_R10, REG_R11 };
+static const uint16_t g_summary_volatile_ia32[] = { REG_RAX, REG_RCX, REG_RDX };
+
+/* stack slots followed on IA32, anything deeper in the frame is unknown */
+#define SUMMARY_STACK_SLOTS     64
+
+/* EFI_SMM_BASE2_PROTOCOL_GUID */
+static const EFI_GUID g_smm_base2_guid = { 0xf4ccbfb7, 0xf6e0, 0x47fd, { 0x9d, 0xd4, 0x10, 0xa8, 0xf1, 0x50, 0xc1, 0x91 } };
+
+/* a function doesn't locate the SMM base protocol more than a couple of times */
+#define MAX_SUMMARY_LOCATES     255
+
+enum sym_base
+{
+    kSymNone = 0,
+    kSymParam,
+    kSymGlobal,
+    /* lea of a global, the global in global */
+    kSymGlobalAddress,
+    /* lea of a stack slot, the base register in param and the displacement in global */
+    kSymStackAddress,
+    /* loaded from a stack slot a LocateProtocol call wrote, the call index in param */
+    kSymLocated
+};
+
+/* a value in terms of the function arguments or a global, optionally through a system table field */
+struct sym_value
+{
+    uint8_t base;
+    uint8_t param;
+    /* 0, TABLE_BOOT or TABLE_RUNTIME if the value was loaded from that system table field */
+    uint8_t field;
+    ea_t global;
+};
+
+struct summary_store
+{
+    struct sym_value value;
+    ea_t global;
+};
+
+struct summary_call
+{
+    ea_t callee;
+    struct sym_value args[NR_SUMMARY_ARGS];
+};
+
+/* LocateProtocol(&gEfiSmmBase2ProtocolGuid, NULL, out) through table */
+struct summary_locate
+{
+    struct sym_value table;
+    struct sym_value out;
+};
+
+/* GetSmstLocation(This, &smst) through protocol */
+struct summary_smst
+{
+    struct sym_value protocol;
+    ea_t smst;
+};
+
+struct function_summary
+{
+    ea_t start;
+    int summarised;
+    int queued;
+    /* tables each argument can hold */
+    uint8_t params[NR_SUMMARY_ARGS];
+    struct summary_store *stores;
+    size_t nr_stores;
+    struct summary_call *calls;
+    size_t nr_calls;
+    struct summary_locate *locates;
+    size_t nr_locates;
+    struct summary_smst *smsts;
+    size_t nr_smsts;
+};
+
+/*
+ * IA32 stack while summarising a function, positions are counted in bytes
+ * below the stack pointer at entry: the return address is at 0 and the
+ * arguments at -4, -8, ...
+ */
+struct stack_frame
+{
+    /* bytes pushed or allocated since the entry point */
+    int64_t depth;
+    /* depth when ebp was set up */
+    int64_t frame_depth;
+    int has_frame;
+    struct sym_value slots[SUMMARY_STACK_SLOTS];
+};
+
+/* function that reads a global in its summary, chained per global */
+struct global_reader
+{
+    struct function_summary *function;
+    /* next reader of the same global + 1, zero ends the chain */
+    uint32_t next;
+};
+
+/* address -> array index + 1, zero is an empty slot */
+struct address_slot
+{
+    ea_t address;
+    uint32_t index;
+};
+
+/* open addressing over the addresses, the load factor is kept under 1/2 */
+struct address_map
+{
+    struct address_slot *slots;
+    uint32_t size;
+    uint32_t count;
+};
+
+#define ADDRESS_MAP_MIN_SLOTS   64
+
+struct alias_search
+{
+    struct insn_cache *insns;
+    const struct module_arch *arch;
+    struct table_aliases *out;
+    /* in the order they were reached, found by start address through function_map */
+    struct function_summary **functions;
+    size_t nr_functions;
+    size_t functions_capacity;
+    struct address_map function_map;
+    struct function_summary **worklist;
+    size_t worklist_count;
+    size_t worklist_capacity;
+    struct global_reader *readers;
+    size_t nr_readers;
+    size_t readers_capacity;
+    /* global -> first reader of its chain */
+    struct address_map reader_map;
+};
+
+/* grow an array of elements by doubling, returns 0 on success */
+static int
+grow_array(void **array, size_t *capacity, size_t element_size)
+{
+    size_t new_capacity = *capacity ? *capacity * 2 : 32;
+    void *new_array = realloc(*array, new_capacity * element_size);
+    if (new_array == NULL)
+    {
+        return 1;
+    }
+    *array = new_array;
+    *capacity = new_capacity;
+    return 0;
+}
+
+static inline uint32_t
+hash_address(ea_t address)
+{
+    uint64_t h = (uint64_t)address * 0x9E3779B97F4A7C15ULL;
+    return (uint32_t)(h >> 32);
+}
+
+static int
+grow_address_map(struct address_map *map)
+{
+    uint32_t new_size = map->size ? map->size * 2 : ADDRESS_MAP_MIN_SLOTS;
+    struct address_slot *new_slots = (struct address_slot*)calloc(new_size, sizeof(struct address_slot));
+    if (new_slots == NULL)
+    {
+        return 1;
+    }
+    for (uint32_t i = 0; i < map->size; i++)
+    {
+        if (map->slots[i].index == 0)
+        {
+            continue;
+        }
+        uint32_t slot = hash_address(map->slots[i].address) & (new_size - 1);
+        while (new_slots[slot].index != 0)
+        {
+            slot = (slot + 1) & (new_size - 1);
+        }
+        new_slots[slot] = map->slots[i];
+    }
+    free(map->slots);
+    map->slots = new_slots;
+    map->size = new_size;
+    return 0;
+}
+
+/*
+ * index + 1 stored for address, zero if there's none yet
+ * with create the slot is claimed so the caller can store the index in it
+ * returns NULL if address isn't there and create is 0, or if out of memory
+ */
+static uint32_t *
+map_address(struct address_map *map, ea_t address, int create)
+{
+    if (create && (map->count + 1) * 2 > map->size && grow_address_map(map) != 0)
+    {
+        return NULL;
+    }
+    if (map->size == 0)
+    {
+        return NULL;
+    }
+    uint32_t mask = map->size - 1;
+    uint32_t slot = hash_address(address) & mask;
+    while (map->slots[slot].index != 0)
+    {
+        if (map->slots[slot].address == address)
+        {
+            return &map->slots[slot].index;
+        }
+        slot = (slot + 1) & mask;
+    }
+    if (!create)
+    {
+        return NULL;
+    }
+    /* claimed once the caller stores a non zero index */
+    map->slots[slot].address = address;
+    map->count++;
+    return &map->slots[slot].index;
+}
+
+#pragma mark -
+#pragma mark Function summaries
+#pragma mark -
+
+static int
+add_store(struct function_summary *function, size_t *capacity, const struct sym_value *value, ea_t global)
+{
+    if (function->nr_stores == *capacity && grow_array((void**)&function->stores, capacity, sizeof(struct summary_store)) != 0)
+    {
+        return 1;
+    }
+    struct summary_store *store = &function->stores[function->nr_stores++];
+    store->value = *value;
+    store->global = global;
+    return 0;
+}
+
+/* calls are kept even without arguments we track, the callee might use the globals */
+static int
+add_call(struct function_summary *function, size_t *capacity, ea_t callee, const struct sym_value *args)
+{
+    if (function->nr_calls == *capacity && grow_array((void**)&function->calls, capacity, sizeof(struct summary_call)) != 0)
+    {
+        return 1;
+    }
+    struct summary_call *call = &function->calls[function->nr_calls++];
+    call->callee = callee;
+    memcpy(call->args, args, sizeof(call->args));
+    return 0;
+}
+
+#pragma mark -
+#pragma mark IA32 stack
+#pragma mark -
+
+/*
+ * position of [reg+displacement], returns 0 if it's not relative to the stack pointer we know
+ */
+static int
+stack_position(const struct stack_frame *frame, uint16_t reg, ea_t displacement, int64_t *position)
+{
+    if (reg == REG_RSP)
+    {
+        *position = frame->depth - (int32_t)displacement;
+        return 1;
+    }
+    if (reg == REG_RBP && frame->has_frame)
+    {
+        *position = frame->frame_depth - (int32_t)displacement;
+        return 1;
+    }
+    return 0;
+}
+
+static void
+stack_load(const struct stack_frame *frame, int64_t position, struct sym_value *out)
+{
+    memset(out, 0, sizeof(struct sym_value));
+    if (position % 4 != 0)
+    {
+        return;
+    }
+    if (position < 0 && (-position - 4) / 4 < NR_SUMMARY_ARGS)
+    {
+        out->base = kSymParam;
+        out->param = (-position - 4) / 4;
+    }
+    else if (position > 0 && position / 4 < SUMMARY_STACK_SLOTS)
+    {
+        *out = frame->slots[position / 4];
+    }
+}
+
+/* writes over the arguments are ignored, the callers keep their copy */
+static void
+stack_store(struct stack_frame *frame, int64_t position, const struct sym_value *value)
+{
+    if (position > 0 && position % 4 == 0 && position / 4 < SUMMARY_STACK_SLOTS)
+    {
+        frame->slots[position / 4] = *value;
+    }
+}
+
+/* the value of a push or of a store to the stack */
+static void
+operand_value(const struct stack_frame *frame, const struct sym_value *regs, const struct insn_operand *op, struct sym_value *out)
+{
+    int64_t position;
+    memset(out, 0, sizeof(struct sym_value));
+    if (op->type == kOpReg && op->reg < SUMMARY_REGS)
+    {
+        *out = regs[op->reg];
+    }
+    else if (op->type == kOpMem)
+    {
+        out->base = kSymGlobal;
+        out->global = op->addr;
+    }
+    else if ((op->type == kOpDispl || op->type == kOpPhrase) &&
+             stack_position(frame, op->reg, op->type == kOpDispl ? op->addr : 0, &position))
+    {
+        stack_load(frame, position, out);
+    }
+}
+
+/*
+ * follow the instructions moving the stack pointer or going through the stack
+ * returns 1 if the instruction was fully handled
+ */
+static int
+track_stack(struct stack_frame *frame, struct sym_value *regs, const struct cached_insn *insn)
+{
+    const struct insn_operand *dst = &insn->ops[0];
+    const struct insn_operand *src = &insn->ops[1];
+    int64_t position;
+    struct sym_value value;
+    
+    switch (insn->kind)
+    {
+        case kInsnPush:
+            operand_value(frame, regs, dst, &value);
+            frame->depth += 4;
+            stack_store(frame, frame->depth, &value);
+            return 1;
+        case kInsnPop:
+            if (dst->type == kOpReg && dst->reg < SUMMARY_REGS)
+            {
+                stack_load(frame, frame->depth, &regs[dst->reg]);
+            }
+            frame->depth -= 4;
+            return 1;
+        case kInsnAdd:
+        case kInsnSub:
+            if (dst->type != kOpReg || dst->reg != REG_RSP || src->type != kOpImm)
+            {
+                return 0;
+            }
+            frame->depth += insn->kind == kInsnSub ? (int32_t)src->value : -(int32_t)src->value;
+            return 1;
+        case kInsnMov:
+            if (dst->type == kOpReg && src->type == kOpReg && dst->reg == REG_RBP && src->reg == REG_RSP)
+            {
+                frame->has_frame = 1;
+                frame->frame_depth = frame->depth;
+                return 1;
+            }
+            if (dst->type == kOpReg && src->type == kOpReg && dst->reg == REG_RSP && src->reg == REG_RBP && frame->has_frame)
+            {
+                frame->depth = frame->frame_depth;
+                return 1;
+            }
+            if ((dst->type == kOpDispl || dst->type == kOpPhrase) &&
+                stack_position(frame, dst->reg, dst->type == kOpDispl ? dst->addr : 0, &position))
+            {
+                operand_value(frame, regs, src, &value);
+                stack_store(frame, position, &value);
+                return 1;
+            }
+            if (dst->type == kOpReg && dst->reg < SUMMARY_REGS && (src->type == kOpDispl || src->type == kOpPhrase) &&
+                stack_position(frame, src->reg, src->type == kOpDispl ? src->addr : 0, &position))
+            {
+                stack_load(frame, position, &regs[dst->reg]);
+                return 1;
+            }
+            return 0;
+        default:
+            return 0;
+    }
+}
+
+static int
+is_smm_base2_guid(ea_t address)
+{
+    EFI_GUID guid;
+    if (view_read_bytes(address, &guid, sizeof(EFI_GUID)) != 0)
+    {
+        return 0;
+    }
+    return memcmp(&guid, &g_smm_base2_guid, sizeof(EFI_GUID)) == 0;
+}
+
+/*
+ * the SMM base protocol interface pointer, if it's the first argument to LocateProtocol
+ * a pointer stored into a global becomes a store so the global can be followed like any alias
+ */
+static int
+add_locate(struct function_summary *function, size_t *capacity, size_t *stores_capacity, const struct sym_value *regs, uint16_t table_reg)
+{
+    const struct sym_value *guid = &regs[REG_RCX];
+    const struct sym_value *out = &regs[REG_R8];
+    if (guid->base != kSymGlobalAddress || (out->base != kSymGlobalAddress && out->base != kSymStackAddress) ||
+        regs[table_reg].base == kSymNone || function->nr_locates == MAX_SUMMARY_LOCATES || !is_smm_base2_guid(guid->global))
+    {
+        return 0;
+    }
+    if (function->nr_locates == *capacity && grow_array((void**)&function->locates, capacity, sizeof(struct summary_locate)) != 0)
+    {
+        return 1;
+    }
+    struct summary_locate *locate = &function->locates[function->nr_locates];
+    locate->table = regs[table_reg];
+    locate->out = *out;
+    if (out->base == kSymGlobalAddress)
+    {
+        struct sym_value located;
+        memset(&located, 0, sizeof(struct sym_value));
+        located.base = kSymLocated;
+        located.param = function->nr_locates;
+        if (add_store(function, stores_capacity, &located, out->global) != 0)
+        {
+            return 1;
+        }
+    }
+    function->nr_locates++;
+    return 0;
+}
+
+static int
+add_smst(struct function_summary *function, size_t *capacity, const struct sym_value *regs, uint16_t protocol_reg)
+{
+    if (regs[REG_RDX].base != kSymGlobalAddress || regs[protocol_reg].base == kSymNone)
+    {
+        return 0;
+    }
+    if (function->nr_smsts == *capacity && grow_array((void**)&function->smsts, capacity, sizeof(struct summary_smst)) != 0)
+    {
+        return 1;
+    }
+    struct summary_smst *smst = &function->smsts[function->nr_smsts++];
+    smst->protocol = regs[protocol_reg];
+    smst->smst = regs[REG_RDX].global;
+    return 0;
+}
+
+/*
+ * the last LocateProtocol result written to a stack slot, unknown if there's none
+ */
+static void
+located_slot(const struct function_summary *function, uint16_t base, ea_t displacement, struct sym_value *out)
+{
+    memset(out, 0, sizeof(struct sym_value));
+    for (size_t i = function->nr_locates; i > 0; i--)
+    {
+        const struct sym_value *slot = &function->locates[i - 1].out;
+        if (slot->base == kSymStackAddress && slot->param == base && slot->global == displacement)
+        {
+            out->base = kSymLocated;
+            out->param = i - 1;
+            return;
+        }
+    }
+}
+
+/*
+ * one linear pass over the function collecting its stores and calls
+ * returns 0 on success
+ */
+static int
+summarise_function(struct alias_search *search, struct function_summary *function)
+{
+    function->summarised = 1;
+    const struct insn_block *block = cache_function_insns(search->insns, function->start);
+    if (block == NULL)
+    {
+        return 0;
+    }
+    
+    int stack_args = search->arch->stack_args;
+    const uint16_t *volatile_regs = stack_args ? g_summary_volatile_ia32 : g_summary_volatile;
+    size_t nr_volatile = stack_args ? sizeof(g_summary_volatile_ia32) / sizeof(*g_summary_volatile_ia32) :
+                                      sizeof(g_summary_volatile) / sizeof(*g_summary_volatile);
+    struct stack_frame frame;
+    memset(&frame, 0, sizeof(frame));
+    struct sym_value regs[SUMMARY_REGS];
+    memset(regs, 0, sizeof(regs));
+    for (int i = 0; i < NR_SUMMARY_ARGS && !stack_args; i++)
+    {
+        regs[g_summary_args[i]].base = kSymParam;
+        regs[g_summary_args[i]].param = i;
+    }
+    
+    size_t stores_capacity = 0;
+    size_t calls_capacity = 0;
+    size_t locates_capacity = 0;
+    size_t smsts_capacity = 0;
+    for (size_t i = 0; i < block->count; i++)
+    {
+        const struct cached_insn *insn = cached_insn(search->insns, block, i);
+        const struct insn_operand *dst = &insn->ops[0];
+        const struct insn_operand *src = &insn->ops[1];
+        
+        /* direct calls and tail calls out of the function */
+        if ((insn->kind == kInsnCall || (insn->kind == kInsnJmp && (dst->addr < block->start || dst->addr > block->end))) &&
+            dst->type == kOpNear)
+        {
+            /* the callee sees its arguments right above the return address */
+            struct sym_value args[NR_SUMMARY_ARGS];
+            for (int a = 0; a < NR_SUMMARY_ARGS; a++)
+            {
+                if (stack_args)
+                {
+                    stack_load(&frame, frame.depth - 4 * a - (insn->kind == kInsnJmp ? 4 : 0), &args[a]);
+                }
+                else
+                {
+                    args[a] = regs[g_summary_args[a]];
+                }
+            }
+            if (add_call(function, &calls_capacity, dst->addr, args) != 0)
+            {
+                return 1;
+            }
+        }
+        /* the two calls gSmst comes out of, the SMM services tables are only followed on x64 */
+        if (insn->kind == kInsnCallIndirect && dst->type == kOpDispl && dst->reg < SUMMARY_REGS && !stack_args)
+        {
+            if (dst->addr == BOOT_SERVICES_LOCATE_PROTOCOL && add_locate(function, &locates_capacity, &stores_capacity, regs, dst->reg) != 0)
+            {
+                return 1;
+            }
+            if (dst->addr == SMM_BASE2_GET_SMST_LOCATION && add_smst(function, &smsts_capacity, regs, dst->reg) != 0)
+            {
+                return 1;
+            }
+        }
+        if (insn->kind == kInsnCall || insn->kind == kInsnCallIndirect)
+        {
+            for (size_t r = 0; r < nr_volatile; r++)
+            {
+                memset(&regs[volatile_regs[r]], 0, sizeof(struct sym_value));
+            }
+            continue;
+        }
+        if (stack_args && track_stack(&frame, regs, insn))
+        {
+            continue;
+        }
+        
+        if (insn->kind == kInsnMov)
+        {
+            /* storing something we track into a global */
+            if (dst->type == kOpMem && src->type == kOpReg && src->reg < SUMMARY_REGS)
+            {
+                if (regs[src->reg].base != kSymNone && add_store(function, &stores_capacity, &regs[src->reg], dst->addr) != 0)
+                {
+                    return 1;
+                }
+                continue;
+            }
+            if (dst->type == kOpReg && dst->reg < SUMMARY_REGS)
+            {
+                struct sym_value *reg = &regs[dst->reg];
+                if (src->type == kOpReg && src->reg < SUMMARY_REGS)
+                {
+                    *reg = regs[src->reg];
+                }
+                else if (src->type == kOpMem)
+                {
+                    memset(reg, 0, sizeof(struct sym_value));
+                    reg->base = kSymGlobal;
+                    reg->global = src->addr;
+                }
+                /* loading a services table pointer out of something that might be the system table */
+                else if (src->type == kOpDispl && src->reg < SUMMARY_REGS && regs[src->reg].base != kSymNone &&
+                         regs[src->reg].field == 0 &&
+                         (src->addr == search->arch->system_table_boot || src->addr == search->arch->system_table_runtime))
+                {
+                    *reg = regs[src->reg];
+                    reg->field = src->addr == search->arch->system_table_boot ? TABLE_BOOT : TABLE_RUNTIME;
+                }
+                /* the SMM base protocol kept in a local, anything else on the stack is unknown */
+                else if (src->type == kOpDispl && (src->reg == REG_RSP || src->reg == REG_RBP))
+                {
+                    located_slot(function, src->reg, src->addr, reg);
+                }
+                else
+                {
+                    memset(reg, 0, sizeof(struct sym_value));
+                }
+                continue;
+            }
+        }
+        /* pointers to globals and locals, they are only used as the LocateProtocol and GetSmstLocation arguments */
+        if (insn->kind == kInsnLea && dst->type == kOpReg && dst->reg < SUMMARY_REGS)
+        {
+            struct sym_value *reg = &regs[dst->reg];
+            memset(reg, 0, sizeof(struct sym_value));
+            if (src->type == kOpMem)
+            {
+                reg->base = kSymGlobalAddress;
+                reg->global = src->addr;
+            }
+            else if ((src->type == kOpDispl || src->type == kOpPhrase) && (src->reg == REG_RSP || src->reg == REG_RBP))
+            {
+                reg->base = kSymStackAddress;
+                reg->param = src->reg;
+                reg->global = src->type == kOpDispl ? src->addr : 0;
+            }
+            continue;
+        }
+        if ((insn->flags & INSN_CHANGES_OP0) && dst->type == kOpReg && dst->reg < SUMMARY_REGS)
+        {
+            memset(&regs[dst->reg], 0, sizeof(struct sym_value));
+        }
+    }
+    return 0;
+}
+
+#pragma mark -
+#pragma mark Worklist
+#pragma mark -
+
+/*
+ * summary entry for a function, created empty the first time
+ */
+static struct function_summary *
+get_function(struct alias_search *search, ea_t start)
+{
+    uint32_t *index = map_address(&search->function_map, start, 1);
+    if (index == NULL)
+    {
+        return NULL;
+    }
+    if (*index != 0)
+    {
+        return search->functions[*index - 1];
+    }
+    
+    if (search->nr_functions == search->functions_capacity &&
+        grow_array((void**)&search->functions, &search->functions_capacity, sizeof(struct function_summary*)) != 0)
+    {
+        return NULL;
+    }
+    struct function_summary *function = (struct function_summary*)calloc(1, sizeof(struct function_summary));
+    if (function == NULL)
+    {
+        return NULL;
+    }
+    function->start = start;
+    search->functions[search->nr_functions++] = function;
+    *index = (uint32_t)search->nr_functions;
+    return function;
+}
+
+static int
+enqueue(struct alias_search *search, struct function_summary *function)
+{
+    if (function->queued)
+    {
+        return 0;
+    }
+    if (search->worklist_count == search->worklist_capacity &&
+        grow_array((void**)&search->worklist, &search->worklist_capacity, sizeof(struct function_summary*)) != 0)
+    {
+        return 1;
+    }
+    function->queued = 1;
+    search->worklist[search->worklist_count++] = function;
+    return 0;
+}
+
+static struct table_alias *
+get_alias(struct table_aliases *aliases, ea_t address, int create)
+{
+    size_t low = 0;
+    size_t high = aliases->count;
+    while (low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+        if (aliases->aliases[middle].address < address)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    if (low < aliases->count && aliases->aliases[low].address == address)
+    {
+        return &aliases->aliases[low];
+    }
+    if (!create)
+    {
+        return NULL;
+    }
+    if (aliases->count == aliases->capacity && grow_array((void**)&aliases->aliases, &aliases->capacity, sizeof(struct table_alias)) != 0)
+    {
+        return NULL;
+    }
+    memmove(&aliases->aliases[low + 1], &aliases->aliases[low], (aliases->count - low) * sizeof(struct table_alias));
+    aliases->aliases[low].address = address;
+    aliases->aliases[low].tables = 0;
+    aliases->aliases[low].hits = 0;
+    aliases->count++;
+    return &aliases->aliases[low];
+}
+
+/*
+ * tables a symbolic value can hold with what we know so far
+ */
+static uint8_t
+resolve(struct alias_search *search, const struct function_summary *function, const struct sym_value *value)
+{
+    uint8_t tables = 0;
+    if (value->base == kSymParam)
+    {
+        tables = function->params[value->param];
+    }
+    else if (value->base == kSymGlobal)
+    {
+        const struct table_alias *alias = get_alias(search->out, value->global, 0);
+        tables = alias != NULL ? alias->tables : 0;
+    }
+    /* only if it was located through the boot services */
+    else if (value->base == kSymLocated)
+    {
+        tables = (resolve(search, function, &function->locates[value->param].table) & TABLE_BOOT) ? TABLE_SMM_BASE2 : 0;
+    }
+    if (value->field != 0)
+    {
+        tables = (tables & TABLE_SYSTEM) ? value->field : 0;
+    }
+    return tables;
+}
+
+static int
+add_reader(struct alias_search *search, ea_t global, struct function_summary *function)
+{
+    if (search->nr_readers == search->readers_capacity &&
+        grow_array((void**)&search->readers, &search->readers_capacity, sizeof(struct global_reader)) != 0)
+    {
+        return 1;
+    }
+    uint32_t *first = map_address(&search->reader_map, global, 1);
+    if (first == NULL)
+    {
+        return 1;
+    }
+    search->readers[search->nr_readers].function = function;
+    search->readers[search->nr_readers].next = *first;
+    search->nr_readers++;
+    *first = (uint32_t)search->nr_readers;
+    return 0;
+}
+
+/*
+ * remember which globals the function summary depends on so it's revisited when they change
+ */
+static int
+register_readers(struct alias_search *search, struct function_summary *function)
+{
+    for (size_t i = 0; i < function->nr_stores; i++)
+    {
+        if (function->stores[i].value.base == kSymGlobal && add_reader(search, function->stores[i].value.global, function) != 0)
+        {
+            return 1;
+        }
+    }
+    for (size_t i = 0; i < function->nr_calls; i++)
+    {
+        for (int a = 0; a < NR_SUMMARY_ARGS; a++)
+        {
+            if (function->calls[i].args[a].base == kSymGlobal && add_reader(search, function->calls[i].args[a].global, function) != 0)
+            {
+                return 1;
+            }
+        }
+    }
+    for (size_t i = 0; i < function->nr_locates; i++)
+    {
+        if (function->locates[i].table.base == kSymGlobal && add_reader(search, function->locates[i].table.global, function) != 0)
+        {
+            return 1;
+        }
+    }
+    for (size_t i = 0; i < function->nr_smsts; i++)
+    {
+        if (function->smsts[i].protocol.base == kSymGlobal && add_reader(search, function->smsts[i].protocol.global, function) != 0)
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/*
+ * a global can now hold more tables
+ * everyone depending on it has to be looked at again
+ */
+static int
+add_alias_tables(struct alias_search *search, ea_t global, uint8_t tables)
+{
+    struct table_alias *alias = get_alias(search->out, global, 1);
+    if (alias == NULL)
+    {
+        return 1;
+    }
+    if ((alias->tables | tables) == alias->tables)
+    {
+        return 0;
+    }
+    alias->tables |= tables;
+    const uint32_t *first = map_address(&search->reader_map, global, 0);
+    for (uint32_t r = first != NULL ? *first : 0; r != 0; r = search->readers[r - 1].next)
+    {
+        if (enqueue(search, search->readers[r - 1].function) != 0)
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/*
+ * apply a function summary with the tables currently known in its arguments and globals
+ */
+static int
+apply_summary(struct alias_search *search, struct function_summary *function)
+{
+    for (size_t i = 0; i < function->nr_stores; i++)
+    {
+        uint8_t tables = resolve(search, function, &function->stores[i].value);
+        if (tables != 0 && add_alias_tables(search, function->stores[i].global, tables) != 0)
+        {
+            return 1;
+        }
+    }
+    for (size_t i = 0; i < function->nr_smsts; i++)
+    {
+        if ((resolve(search, function, &function->smsts[i].protocol) & TABLE_SMM_BASE2) &&
+            add_alias_tables(search, function->smsts[i].smst, TABLE_SMM) != 0)
+        {
+            return 1;
+        }
+    }
+    
+    for (size_t i = 0; i < function->nr_calls; i++)
+    {
+        struct binary_function f;
+        if (view_function_containing(function->calls[i].callee, &f) != 0 || f.start != function->calls[i].callee)
+        {
+            continue;
+        }
+        struct function_summary *callee = get_function(search, function->calls[i].callee);
+        if (callee == NULL)
+        {
+            return 1;
+        }
+        /* first time we reach it */
+        if (!callee->summarised && enqueue(search, callee) != 0)
+        {
+            return 1;
+        }
+        for (int a = 0; a < NR_SUMMARY_ARGS; a++)
+        {
+            uint8_t tables = resolve(search, function, &function->calls[i].args[a]);
+            if ((callee->params[a] | tables) != callee->params[a])
+            {
+                callee->params[a] |= tables;
+                if (enqueue(search, callee) != 0)
+                {
+                    return 1;
+                }
+            }
+        }
+    }
+    return 0;
+}
+
+#pragma mark -
+#pragma mark Exported functions
+#pragma mark -
+
+static int
+run_worklist(struct alias_search *search, ea_t entry_point)
+{
+    struct function_summary *entry = get_function(search, entry_point);
+    if (entry == NULL)
+    {
+        return 1;
+    }
+    /* EFI_STATUS EFIAPI _ModuleEntryPoint(IN EFI_HANDLE ImageHandle, IN EFI_SYSTEM_TABLE *SystemTable) */
+    entry->params[1] = TABLE_SYSTEM;
+    if (enqueue(search, entry) != 0)
+    {
+        return 1;
+    }
+    
+    while (search->worklist_count > 0)
+    {
+        struct function_summary *function = search->worklist[--search->worklist_count];
+        function->queued = 0;
+        if (!function->summarised)
+        {
+            if (summarise_function(search, function) != 0 || register_readers(search, function) != 0)
+            {
+                return 1;
+            }
+        }
+        if (apply_summary(search, function) != 0)
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/*
+ * find every global holding the system table, the boot and runtime services tables or gSmst
+ * starting from the module entry point where the second argument is the system table
+ * returns 0 on success
+ */
+int
+find_table_aliases(struct insn_cache *insns, const struct module_arch *arch, ea_t entry_point, struct table_aliases *out)
+{
+    struct alias_search search;
+    memset(&search, 0, sizeof(search));
+    search.insns = insns;
+    search.arch = arch;
+    search.out = out;
+    
+    int ret = run_worklist(&search, entry_point);
+    if (ret != 0)
+    {
+        ERROR_MSG("Can't allocate memory for table aliases search.");
+    }
+    else
+    {
+        DEBUG_MSG("Table aliases: %lu functions summarised, %lu aliases found.", (unsigned long)search.nr_functions, (unsigned long)out->count);
+    }
+    
+    for (size_t i = 0; i < search.nr_functions; i++)
+    {
+        free(search.functions[i]->stores);
+        free(search.functions[i]->calls);
+        free(search.functions[i]->locates);
+        free(search.functions[i]->smsts);
+        free(search.functions[i]);
+    }
+    free(search.functions);
+    free(search.function_map.slots);
+    free(search.worklist);
+    free(search.readers);
+    free(search.reader_map.slots);
+    return ret;
+}
+
+/*
+ * alias at an exact address or NULL
+ */
+struct table_alias *
+lookup_table_alias(struct table_aliases *aliases, ea_t address)
+{
+    return get_alias(aliases, address, 0);
+}
+
+void
+free_table_aliases(struct table_aliases *aliases)
+{
+    free(aliases->aliases);
+    memset(aliases, 0, sizeof(struct table_aliases));
+}
@@ -0,0 +1,81 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * table_aliases.h
+ *
+ */
+
+#ifndef efi_swiss_knife_table_aliases_h
+#define efi_swiss_knife_table_aliases_h
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "binary_view.h"
+
+#include "insn_cache.h"
+#include "module_arch.h"
+
+/* which system tables a global can hold */
+#define TABLE_SYSTEM        0x1
+#define TABLE_BOOT          0x2
+#define TABLE_RUNTIME       0x4
+#define TABLE_SMM           0x8
+/* not a table, the EFI_SMM_BASE2_PROTOCOL interface gSmst is retrieved from */
+#define TABLE_SMM_BASE2     0x10
+
+/* the calls that lead to gSmst */
+#define BOOT_SERVICES_LOCATE_PROTOCOL   0x140
+#define SMM_BASE2_GET_SMST_LOCATION     0x8
+
+/* a global variable holding a pointer to one of the system tables */
+struct table_alias
+{
+    ea_t address;
+    uint8_t tables;
+    /* services calls made through it, filled by the references sweep */
+    uint32_t hits;
+};
+
+/* sorted by address */
+struct table_aliases
+{
+    struct table_alias *aliases;
+    size_t count;
+    size_t capacity;
+};
+
+int find_table_aliases(struct insn_cache *insns, const struct module_arch *arch, ea_t entry_point, struct table_aliases *out);
+struct table_alias * lookup_table_alias(struct table_aliases *aliases, ea_t address);
+void free_table_aliases(struct table_aliases *aliases);
+
+#endif /* table_aliases_h */
@@ -0,0 +1,257 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * efi_analyzer.cpp
+ *
+ */
+
+/*
+ * standalone analyzer, runs the plugin analysis without IDA
+ *
+ * the modules are loaded by the native binary view: PE32+, PE32 and TE images,
+ * functions found by recursive descent from the entry point. the output is the
+ * same as the plugin's, names and comments are printed with -a instead of
+ * going into an IDA database
+ *
+ * anything that isn't a PE or TE image is walked as a firmware image, every
+ * module in its volumes is analysed in place with its FFS file GUID as the
+ * module name. compressed sections are decompressed by a pool of threads while
+ * the volumes are walked and the modules already found are analysed
+ *
+ * to compile:
+ * c++ -O2 -DEFI_STANDALONE -o efi_analyzer tools/efi_analyzer.cpp tools/efi_decompress.cpp tools/fv_walker.cpp \
+ *     tools/lzma_decoder.cpp tools/native_view.cpp tools/pe_loader.cpp tools/x86_decoder.cpp arena.cpp arg_dataflow.cpp code_patterns.cpp cpu_features.cpp \
+ *     database.cpp guid_format.cpp guid_index.cpp guid_scanner.cpp guid_stats.cpp idioms.cpp image_format.cpp \
+ *     image_guids.cpp initial_checks.cpp insn_cache.cpp logging.cpp module_arch.cpp table_aliases.cpp -lsqlite3 -lpthread
+ *
+ * usage:
+ * efi_analyzer [-a] [-d] [-j threads] [-l] [-o] [-s] module.efi|firmware.bin ...
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../binary_view.h"
+#include "../config.h"
+#include "../guid_index.h"
+#include "../initial_checks.h"
+#include "../logging.h"
+#include "fv_walker.h"
+#include "native_view.h"
+#include "pe_loader.h"
+
+/* same defaults as the plugin */
+struct config g_config = { .comment_prototype = 1, .comment_description = 0, .comment_guid = 1, .generate_stats = 1, .generate_log = 0, .output_log = 0, .output_sql = 0, .debug_msgs = 0};
+
+static uint64_t
+time_usec(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static void
+usage(const char *name)
+{
+    fprintf(stderr, "Usage: %s [options] module.efi|firmware.bin ...\n", name);
+    fprintf(stderr, "  -a  print the names and comments the analysis made\n");
+    fprintf(stderr, "  -d  debug messages\n");
+    fprintf(stderr, "  -j  number of decompression threads for firmware images, default is one per CPU\n");
+    fprintf(stderr, "  -l  generate log file\n");
+    fprintf(stderr, "  -o  generate output file next to each module\n");
+    fprintf(stderr, "  -s  database output\n");
+}
+
+/* the firmware image being walked */
+struct module_run
+{
+    const char *path;
+    int print_annotations;
+    int failed;
+};
+
+/*
+ * analyse the module loaded in the native view, same as one plugin run
+ */
+static void
+analyse_loaded_module(const char *label, int print_annotations, uint64_t start)
+{
+    uint64_t loaded = time_usec();
+    /* one log session per module, like one plugin run per database */
+    if (g_config.generate_log == 1)
+    {
+        open_log_file();
+    }
+    msg("---[ %s ]---\n", label);
+    do_initial_checks(0);
+    if (print_annotations)
+    {
+        print_native_annotations();
+    }
+    uint64_t done = time_usec();
+    msg("---[ %s: load %llu us, analysis %llu us ]---\n", label,
+        (unsigned long long)(loaded - start), (unsigned long long)(done - loaded));
+    if (g_config.generate_log == 1)
+    {
+        close_log_file();
+    }
+    close_native_view();
+}
+
+/*
+ * firmware volume walker callback, every module is analysed in place
+ */
+static int
+analyse_fv_module(const struct fv_module *module, void *context)
+{
+    struct module_run *run = (struct module_run*)context;
+    uint64_t start = time_usec();
+    char label[PATH_MAX + GUID_STRING_SIZE + FV_MODULE_NAME_SIZE + 4] = {0};
+    if (module->name[0] != '\0')
+    {
+        snprintf(label, sizeof(label), "%s:%s %s", run->path, module->guid_string, module->name);
+    }
+    else
+    {
+        snprintf(label, sizeof(label), "%s:%s", run->path, module->guid_string);
+    }
+    if (open_native_view_buffer(run->path, module->guid_string, module->data, module->size) != 0)
+    {
+        ERROR_MSG("Can't load %s.", label);
+        run->failed++;
+        return 0;
+    }
+    analyse_loaded_module(label, run->print_annotations, start);
+    return 0;
+}
+
+/*
+ * a module on its own, or a firmware image to walk for modules
+ */
+static int
+analyse_file(const char *path, int print_annotations, uint32_t threads)
+{
+    uint64_t start = time_usec();
+    const uint8_t *data = NULL;
+    size_t size = 0;
+    if (map_input_file(path, &data, &size) != 0)
+    {
+        return 1;
+    }
+    uint16_t signature = size >= 2 ? (uint16_t)(data[0] | data[1] << 8) : 0;
+    if (signature == EFI_IMAGE_DOS_SIGNATURE || signature == EFI_IMAGE_TE_SIGNATURE)
+    {
+        if (open_native_view_buffer(path, NULL, data, size) != 0)
+        {
+            ERROR_MSG("Can't load %s.", path);
+            unmap_input_file(data, size);
+            return 1;
+        }
+        analyse_loaded_module(path, print_annotations, start);
+        unmap_input_file(data, size);
+        return 0;
+    }
+    
+    struct module_run run = { path, print_annotations, 0 };
+    struct fv_walk_stats stats;
+    int ret = walk_firmware_image(data, size, threads, analyse_fv_module, &run, &stats);
+    unmap_input_file(data, size);
+    if (ret != 0)
+    {
+        ERROR_MSG("Can't load %s.", path);
+        return 1;
+    }
+    /* the walk and the decompression overlap the analysis, so the stages don't add up to the total */
+    msg("---[ %s: %u modules in %llu us, walk %llu us, %u sections decompressed by %u threads %llu us (%llu to %llu bytes), analysis %llu us ]---\n",
+        path, stats.modules, (unsigned long long)stats.total_usec, (unsigned long long)stats.walk_usec,
+        stats.decompressed, stats.threads, (unsigned long long)stats.decompress_usec,
+        (unsigned long long)stats.compressed_bytes, (unsigned long long)stats.decompressed_bytes,
+        (unsigned long long)stats.analysis_usec);
+    return run.failed ? 1 : 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+    int print_annotations = 0;
+    uint32_t threads = 0;
+    int first_module = 1;
+    for (; first_module < argc && argv[first_module][0] == '-'; first_module++)
+    {
+        const char *option = argv[first_module];
+        if (strcmp(option, "-a") == 0)
+        {
+            print_annotations = 1;
+        }
+        else if (strcmp(option, "-d") == 0)
+        {
+            g_config.debug_msgs = 1;
+        }
+        else if (strcmp(option, "-j") == 0 && first_module + 1 < argc)
+        {
+            threads = (uint32_t)strtoul(argv[++first_module], NULL, 10);
+        }
+        else if (strcmp(option, "-l") == 0)
+        {
+            g_config.generate_log = 1;
+        }
+        else if (strcmp(option, "-o") == 0)
+        {
+            g_config.output_log = 1;
+        }
+        else if (strcmp(option, "-s") == 0)
+        {
+            g_config.output_sql = 1;
+        }
+        else
+        {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (first_module == argc)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+    
+    int failed = 0;
+    for (int i = first_module; i < argc; i++)
+    {
+        failed += analyse_file(argv[i], print_annotations, threads);
+    }
+    close_guid_index();
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,330 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * efi_benchmark.cpp
+ *
+ */
+
+/*
+ * microbenchmarks for the lookup and scanning code, each one against the code
+ * it replaced. they used to run inside the analysis of debug builds, this
+ * keeps them out of the analysis path
+ *
+ * the code prefilter is timed on the .text of each module given
+ *
+ * to compile:
+ * c++ -O2 -DEFI_STANDALONE -o efi_benchmark tools/efi_benchmark.cpp tools/native_view.cpp tools/pe_loader.cpp \
+ *     tools/x86_decoder.cpp code_patterns.cpp cpu_features.cpp guid_format.cpp guid_index.cpp guid_scanner.cpp \
+ *     image_format.cpp logging.cpp module_arch.cpp
+ *
+ * usage:
+ * efi_benchmark [module.efi ...]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../binary_view.h"
+#include "../code_patterns.h"
+#include "../config.h"
+#include "../guid_format.h"
+#include "../guid_index.h"
+#include "../guid_scanner.h"
+#include "../insn_cache.h"
+#include "../module_arch.h"
+#include "native_view.h"
+
+/* the GUID index reads the dictionary path and logs through the configuration */
+struct config g_config = { .comment_prototype = 1, .comment_description = 0, .comment_guid = 1, .generate_stats = 0, .generate_log = 0, .output_log = 0, .output_sql = 0, .debug_msgs = 0};
+
+static uint64_t
+time_usec(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+#pragma mark -
+#pragma mark GUID index
+#pragma mark -
+
+/* the linear lookup we had before the index */
+static int
+linear_guid_lookup(const EFI_GUID *guid)
+{
+    const EFI_GUID *keys = builtin_guid_keys();
+    for (size_t i = 0; i < builtin_guid_count(); i++)
+    {
+        if (memcmp(&keys[i], guid, sizeof(EFI_GUID)) == 0)
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/*
+ * compare the index against the old linear scan
+ * half of the probes are known GUIDs and the other half are misses, which is
+ * the common case when sweeping a data segment
+ */
+static void
+benchmark_guid_index(void)
+{
+    const int rounds = 64;
+    const EFI_GUID *keys = builtin_guid_keys();
+    size_t count = builtin_guid_count();
+    uint32_t found_linear = 0;
+    uint32_t found_index = 0;
+    EFI_GUID probe = {0, 0, 0, {0}};
+    
+    build_guid_index();
+    
+    uint64_t start = time_usec();
+    for (int r = 0; r < rounds; r++)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            found_linear += linear_guid_lookup(&keys[i]);
+            memcpy(&probe, &keys[i], sizeof(EFI_GUID));
+            probe.Data4[7] ^= 0x5A;
+            found_linear += linear_guid_lookup(&probe);
+        }
+    }
+    uint64_t linear_time = time_usec() - start;
+    
+    start = time_usec();
+    for (int r = 0; r < rounds; r++)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            found_index += lookup_guid_name(&keys[i]) != NULL;
+            memcpy(&probe, &keys[i], sizeof(EFI_GUID));
+            probe.Data4[7] ^= 0x5A;
+            found_index += lookup_guid_name(&probe) != NULL;
+        }
+    }
+    uint64_t index_time = time_usec() - start;
+    
+    printf("GUID lookup: %llu lookups, linear %llu us (%u hits), index %llu us (%u hits)\n",
+           (unsigned long long)rounds * count * 2, (unsigned long long)linear_time, found_linear,
+           (unsigned long long)index_time, found_index);
+}
+
+#pragma mark -
+#pragma mark GUID scanner
+#pragma mark -
+
+/* the GUID lookup at every position, what find_data_seg_guids used to do */
+static size_t
+scan_guid_naive(const uint8_t *buffer, size_t size, size_t stride)
+{
+    size_t found = 0;
+    for (size_t offset = 0; offset + sizeof(EFI_GUID) <= size; offset += stride)
+    {
+        EFI_GUID guid;
+        memcpy(&guid, buffer + offset, sizeof(EFI_GUID));
+        if (guid.Data1 == 0x0 || guid.Data1 == 0xFFFFFFFF)
+        {
+            continue;
+        }
+        found += lookup_guid_name(&guid) != NULL;
+    }
+    return found;
+}
+
+/*
+ * throughput of the scanner over a synthetic 4MB data segment
+ * mostly zeroes with some pointer like values and a known GUID every 4KB
+ */
+static void
+benchmark_guid_scanner(void)
+{
+    const size_t size = 4 * 1024 * 1024;
+    uint8_t *buffer = (uint8_t*)calloc(1, size);
+    if (buffer == NULL)
+    {
+        return;
+    }
+    
+    uint32_t seed = 0x1337;
+    for (size_t offset = 0; offset < size; offset += 8)
+    {
+        seed = seed * 1103515245 + 12345;
+        if ((seed >> 16) % 4 == 0)
+        {
+            uint64_t value = 0x10000000ULL + (seed & 0xFFFF0);
+            memcpy(buffer + offset, &value, sizeof(value));
+        }
+    }
+    /* ACPI_TABLE_GUID */
+    EFI_GUID known = { 0xeb9d2d30, 0x2d88, 0x11d3, { 0x9a, 0x16, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d } };
+    for (size_t offset = 0; offset + sizeof(EFI_GUID) <= size; offset += 0x1000)
+    {
+        memcpy(buffer + offset, &known, sizeof(EFI_GUID));
+    }
+    
+    build_guid_index();
+    uint64_t start = time_usec();
+    size_t naive_found = scan_guid_naive(buffer, size, 8);
+    uint64_t naive_time = time_usec() - start;
+    
+    start = time_usec();
+    size_t found = scan_guid_buffer(buffer, size, 8, NULL, NULL);
+    uint64_t scan_time = time_usec() - start;
+    
+    printf("GUID scanner: naive %llu MB/s (%lu GUIDs), scanner %llu MB/s (%lu GUIDs)\n",
+           naive_time ? (unsigned long long)size / naive_time : 0, (unsigned long)naive_found,
+           scan_time ? (unsigned long long)size / scan_time : 0, (unsigned long)found);
+    free(buffer);
+}
+
+#pragma mark -
+#pragma mark GUID format
+#pragma mark -
+
+/*
+ * format a few million GUIDs with snprintf (what we used before) and with
+ * format_guid
+ */
+static void
+benchmark_guid_format(void)
+{
+    const int iterations = 2 * 1000 * 1000;
+    EFI_GUID guid = { 0xeb9d2d30, 0x2d88, 0x11d3, { 0x9a, 0x16, 0x0, 0x90, 0x27, 0x3f, 0xc1, 0x4d } };
+    char guid_string[GUID_STRING_SIZE] = {0};
+    uint32_t checksum = 0;
+    
+    uint64_t start = time_usec();
+    for (int i = 0; i < iterations; i++)
+    {
+        guid.Data1 = i;
+        snprintf(guid_string, sizeof(guid_string), "%08X-%04X-%04X-%02X%02X-%02X%02X%02X%02X%02X%02X",
+                 guid.Data1, guid.Data2, guid.Data3,
+                 guid.Data4[0], guid.Data4[1], guid.Data4[2], guid.Data4[3],
+                 guid.Data4[4], guid.Data4[5], guid.Data4[6], guid.Data4[7]);
+        checksum += guid_string[7];
+    }
+    uint64_t printf_time = time_usec() - start;
+    
+    start = time_usec();
+    for (int i = 0; i < iterations; i++)
+    {
+        guid.Data1 = i;
+        format_guid(&guid, guid_string);
+        checksum -= guid_string[7];
+    }
+    uint64_t format_time = time_usec() - start;
+    
+    printf("GUID format: %d GUIDs, snprintf %llu us, format_guid %llu us (checksum %u)\n",
+           iterations, (unsigned long long)printf_time, (unsigned long long)format_time, checksum);
+}
+
+#pragma mark -
+#pragma mark Code prefilter
+#pragma mark -
+
+/*
+ * prefilter against decoding every instruction of the code segment, which is
+ * what the services passes need to do without it
+ */
+static int
+benchmark_code_patterns(const char *path)
+{
+    if (open_native_view(path) != 0)
+    {
+        fprintf(stderr, "Can't load %s.\n", path);
+        return 1;
+    }
+    struct binary_segment seg_info;
+    if (view_segment_by_name(".text", &seg_info) != 0)
+    {
+        fprintf(stderr, "No .text segment in %s.\n", path);
+        close_native_view();
+        return 1;
+    }
+    size_t size = 0;
+    uint8_t *copy = NULL;
+    const uint8_t *buffer = snapshot_segment(&seg_info, &size, &copy);
+    if (buffer == NULL)
+    {
+        close_native_view();
+        return 1;
+    }
+    
+    uint64_t start = time_usec();
+    size_t nr_insns = 0;
+    for (ea_t address = seg_info.start; address < seg_info.end; nr_insns++)
+    {
+        struct cached_insn insn;
+        int length = view_decode_insn(address, &insn);
+        address += length > 0 ? length : 1;
+    }
+    uint64_t decode_time = time_usec() - start;
+    
+    struct code_candidates candidates;
+    memset(&candidates, 0, sizeof(struct code_candidates));
+    start = time_usec();
+    scan_code_patterns(buffer, size, seg_info.start, current_module_arch(), &candidates);
+    uint64_t scan_time = time_usec() - start;
+    
+    printf("Code prefilter %s: decoder %llu MB/s (%lu instructions), prefilter %llu MB/s (%lu candidates)\n", path,
+           decode_time ? (unsigned long long)size / decode_time : 0, (unsigned long)nr_insns,
+           scan_time ? (unsigned long long)size / scan_time : 0, (unsigned long)candidates.count);
+    free_code_candidates(&candidates);
+    free(copy);
+    close_native_view();
+    return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+    if (argc > 1 && argv[1][0] == '-')
+    {
+        fprintf(stderr, "Usage: %s [module.efi ...]\n", argv[0]);
+        return 1;
+    }
+    benchmark_guid_index();
+    benchmark_guid_scanner();
+    benchmark_guid_format();
+    int failed = 0;
+    for (int i = 1; i < argc; i++)
+    {
+        failed += benchmark_code_patterns(argv[i]);
+    }
+    close_guid_index();
+    return failed ? 1 : 0;
+}
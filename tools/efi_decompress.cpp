@@ -0,0 +1,463 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * efi_decompress.cpp
+ *
+ */
+
+#include "efi_decompress.h"
+
+#include <string.h>
+
+/*
+ * the compressed stream is a list of blocks, each starts with the number of
+ * codes in it and three Huffman code length arrays:
+ * T (extra set) codes the C lengths, C (char and length set) has the literals
+ * and match lengths, P (position set) has the match distance bit lengths
+ */
+
+#define BITBUFSIZ       32
+#define MAXMATCH        256
+#define THRESHOLD       3
+#define CODE_BIT        16
+#define BAD_TABLE       0xFFFF
+
+#define NC              (0xFF + MAXMATCH + 2 - THRESHOLD)
+#define CBIT            9
+#define MAXPBIT         5
+#define TBIT            5
+#define MAXNP           ((1U << MAXPBIT) - 1)
+#define NT              (CODE_BIT + 3)
+#define NPT             (NT > MAXNP ? NT : MAXNP)
+
+#define C_TABLE_BITS    12
+#define PT_TABLE_BITS   8
+
+/* worst case sizes for the header fields */
+#define EFI_HEADER_SIZE         8
+#define EFI_MAX_ORIGINAL_SIZE   (256 * 1024 * 1024)
+
+struct efi_decoder
+{
+    const uint8_t *src;
+    size_t src_size;
+    size_t in_pos;
+    uint8_t *dst;
+    uint32_t dst_size;
+    uint32_t out_pos;
+    
+    uint32_t bit_buf;
+    uint32_t sub_bit_buf;
+    uint16_t bit_count;
+    uint16_t block_size;
+    int bad_table;
+    /* 4 for EFI, 5 for Tiano */
+    uint16_t pbit;
+    
+    uint16_t left[2 * NC - 1];
+    uint16_t right[2 * NC - 1];
+    uint8_t c_len[NC];
+    uint8_t pt_len[NPT];
+    uint16_t c_table[1 << C_TABLE_BITS];
+    uint16_t pt_table[1 << PT_TABLE_BITS];
+};
+
+/*
+ * shift bits out of the top of the bit buffer and refill it, past the end
+ * of the input it's filled with zeros
+ */
+static void
+fill_buf(struct efi_decoder *d, uint16_t bits)
+{
+    d->bit_buf = (uint32_t)((uint64_t)d->bit_buf << bits);
+    while (bits > d->bit_count)
+    {
+        bits = (uint16_t)(bits - d->bit_count);
+        d->bit_buf |= (uint32_t)((uint64_t)d->sub_bit_buf << bits);
+        d->sub_bit_buf = d->in_pos < d->src_size ? d->src[d->in_pos++] : 0;
+        d->bit_count = 8;
+    }
+    d->bit_count = (uint16_t)(d->bit_count - bits);
+    d->bit_buf |= d->sub_bit_buf >> d->bit_count;
+}
+
+static uint32_t
+get_bits(struct efi_decoder *d, uint16_t bits)
+{
+    uint32_t out = bits ? d->bit_buf >> (BITBUFSIZ - bits) : 0;
+    fill_buf(d, bits);
+    return out;
+}
+
+/*
+ * build the lookup table for a canonical Huffman code, codes longer than
+ * table_bits continue in the left/right tree
+ * returns 0 on success
+ */
+static int
+make_table(struct efi_decoder *d, uint16_t nr_chars, const uint8_t *bit_len, uint16_t table_bits, uint16_t *table)
+{
+    uint16_t count[17] = {0};
+    uint16_t weight[17];
+    uint16_t start[18];
+    
+    for (uint16_t i = 0; i < nr_chars; i++)
+    {
+        if (bit_len[i] > 16)
+        {
+            return 1;
+        }
+        count[bit_len[i]]++;
+    }
+    start[0] = 0;
+    start[1] = 0;
+    for (uint16_t i = 1; i <= 16; i++)
+    {
+        start[i + 1] = (uint16_t)(start[i] + (count[i] << (16 - i)));
+    }
+    /* the lengths must describe a complete code */
+    if (start[17] != 0)
+    {
+        return 1;
+    }
+    
+    uint16_t ju_bits = (uint16_t)(16 - table_bits);
+    weight[0] = 0;
+    for (uint16_t i = 1; i <= 16; i++)
+    {
+        if (i <= table_bits)
+        {
+            start[i] >>= ju_bits;
+            weight[i] = (uint16_t)(1U << (table_bits - i));
+        }
+        else
+        {
+            weight[i] = (uint16_t)(1U << (16 - i));
+        }
+    }
+    uint32_t table_size = 1U << table_bits;
+    uint32_t unused = (uint16_t)(start[table_bits + 1] >> ju_bits);
+    if (unused != 0 && unused < table_size)
+    {
+        for (uint32_t i = unused; i < table_size; i++)
+        {
+            table[i] = 0;
+        }
+    }
+    
+    uint16_t avail = nr_chars;
+    uint16_t mask = (uint16_t)(1U << (15 - table_bits));
+    for (uint16_t c = 0; c < nr_chars; c++)
+    {
+        uint16_t len = bit_len[c];
+        if (len == 0)
+        {
+            continue;
+        }
+        uint32_t next_code = (uint32_t)start[len] + weight[len];
+        if (len <= table_bits)
+        {
+            if (start[len] >= next_code || next_code > table_size)
+            {
+                return 1;
+            }
+            for (uint32_t i = start[len]; i < next_code; i++)
+            {
+                table[i] = c;
+            }
+        }
+        else
+        {
+            uint16_t code = start[len];
+            uint16_t *pointer = &table[code >> ju_bits];
+            for (uint16_t i = (uint16_t)(len - table_bits); i != 0; i--)
+            {
+                if (*pointer == 0 && avail < 2 * NC - 1)
+                {
+                    d->right[avail] = 0;
+                    d->left[avail] = 0;
+                    *pointer = avail++;
+                }
+                if (*pointer < 2 * NC - 1)
+                {
+                    pointer = (code & mask) ? &d->right[*pointer] : &d->left[*pointer];
+                }
+                code <<= 1;
+            }
+            *pointer = c;
+        }
+        start[len] = (uint16_t)next_code;
+    }
+    return 0;
+}
+
+/*
+ * follow the tree for codes longer than the lookup table
+ * a value of at least limit is an inner node
+ */
+static uint16_t
+walk_tree(struct efi_decoder *d, uint16_t value, uint16_t limit, uint16_t table_bits)
+{
+    uint32_t mask = 1U << (BITBUFSIZ - 1 - table_bits);
+    while (value >= limit)
+    {
+        if (mask == 0 || value >= 2 * NC - 1)
+        {
+            d->bad_table = 1;
+            return 0;
+        }
+        value = (d->bit_buf & mask) ? d->right[value] : d->left[value];
+        mask >>= 1;
+    }
+    return value;
+}
+
+/* a match distance, minus one */
+static uint32_t
+decode_p(struct efi_decoder *d)
+{
+    uint16_t value = d->pt_table[d->bit_buf >> (BITBUFSIZ - PT_TABLE_BITS)];
+    value = walk_tree(d, value, MAXNP, PT_TABLE_BITS);
+    fill_buf(d, d->pt_len[value]);
+    uint32_t position = value;
+    if (value > 1)
+    {
+        position = (1U << (value - 1)) + get_bits(d, (uint16_t)(value - 1));
+    }
+    return position;
+}
+
+/*
+ * code lengths for the T and P sets
+ * lengths under 7 take 3 bits, longer ones are 7 followed by a unary count
+ * special is the index after which a 2 bits count of zero lengths follows
+ * returns 0 on success
+ */
+static int
+read_pt_len(struct efi_decoder *d, uint16_t nn, uint16_t nbit, uint16_t special)
+{
+    uint16_t number = (uint16_t)get_bits(d, nbit);
+    if (number == 0)
+    {
+        /* a single code used everywhere */
+        uint16_t c = (uint16_t)get_bits(d, nbit);
+        if (c >= nn)
+        {
+            return 1;
+        }
+        for (size_t i = 0; i < sizeof(d->pt_table) / sizeof(d->pt_table[0]); i++)
+        {
+            d->pt_table[i] = c;
+        }
+        memset(d->pt_len, 0, nn);
+        return 0;
+    }
+    
+    uint16_t index = 0;
+    while (index < number && index < NPT)
+    {
+        uint16_t c = (uint16_t)(d->bit_buf >> (BITBUFSIZ - 3));
+        if (c == 7)
+        {
+            uint32_t mask = 1U << (BITBUFSIZ - 1 - 3);
+            while (mask & d->bit_buf)
+            {
+                mask >>= 1;
+                c++;
+            }
+        }
+        fill_buf(d, (uint16_t)(c < 7 ? 3 : c - 3));
+        d->pt_len[index++] = (uint8_t)c;
+        if (index == special)
+        {
+            uint16_t zeros = (uint16_t)get_bits(d, 2);
+            while (zeros-- > 0 && index < NPT)
+            {
+                d->pt_len[index++] = 0;
+            }
+        }
+    }
+    while (index < nn && index < NPT)
+    {
+        d->pt_len[index++] = 0;
+    }
+    return make_table(d, nn, d->pt_len, PT_TABLE_BITS, d->pt_table);
+}
+
+/*
+ * code lengths for the C set, coded with the T set
+ * T codes 0 to 2 are runs of zero lengths, the rest are lengths plus 2
+ * returns 0 on success
+ */
+static int
+read_c_len(struct efi_decoder *d)
+{
+    uint16_t number = (uint16_t)get_bits(d, CBIT);
+    if (number == 0)
+    {
+        uint16_t c = (uint16_t)get_bits(d, CBIT);
+        if (c >= NC)
+        {
+            return 1;
+        }
+        memset(d->c_len, 0, NC);
+        for (size_t i = 0; i < sizeof(d->c_table) / sizeof(d->c_table[0]); i++)
+        {
+            d->c_table[i] = c;
+        }
+        return 0;
+    }
+    
+    uint16_t index = 0;
+    while (index < number && index < NC)
+    {
+        uint16_t c = d->pt_table[d->bit_buf >> (BITBUFSIZ - PT_TABLE_BITS)];
+        c = walk_tree(d, c, NT, PT_TABLE_BITS);
+        if (d->bad_table)
+        {
+            return 1;
+        }
+        fill_buf(d, d->pt_len[c]);
+        if (c <= 2)
+        {
+            uint16_t zeros = 1;
+            if (c == 1)
+            {
+                zeros = (uint16_t)(get_bits(d, 4) + 3);
+            }
+            else if (c == 2)
+            {
+                zeros = (uint16_t)(get_bits(d, CBIT) + 20);
+            }
+            while (zeros-- > 0 && index < NC)
+            {
+                d->c_len[index++] = 0;
+            }
+        }
+        else
+        {
+            d->c_len[index++] = (uint8_t)(c - 2);
+        }
+    }
+    memset(d->c_len + index, 0, NC - index);
+    return make_table(d, NC, d->c_len, C_TABLE_BITS, d->c_table);
+}
+
+/* a literal, or a match length plus 253 */
+static uint16_t
+decode_c(struct efi_decoder *d)
+{
+    if (d->block_size == 0)
+    {
+        d->block_size = (uint16_t)get_bits(d, 16);
+        if (read_pt_len(d, NT, TBIT, 3) != 0 || read_c_len(d) != 0 ||
+            read_pt_len(d, MAXNP, d->pbit, BAD_TABLE) != 0)
+        {
+            d->bad_table = 1;
+            return 0;
+        }
+    }
+    d->block_size--;
+    uint16_t value = d->c_table[d->bit_buf >> (BITBUFSIZ - C_TABLE_BITS)];
+    value = walk_tree(d, value, NC, C_TABLE_BITS);
+    fill_buf(d, d->c_len[value]);
+    return value;
+}
+
+/*
+ * the compressed and original sizes are the first two fields
+ * returns 0 on success
+ */
+int
+efi_decompressed_size(const uint8_t *src, size_t src_size, uint32_t *out_size)
+{
+    if (src_size < EFI_HEADER_SIZE)
+    {
+        return 1;
+    }
+    uint32_t compressed_size = (uint32_t)src[0] | (uint32_t)src[1] << 8 | (uint32_t)src[2] << 16 | (uint32_t)src[3] << 24;
+    *out_size = (uint32_t)src[4] | (uint32_t)src[5] << 8 | (uint32_t)src[6] << 16 | (uint32_t)src[7] << 24;
+    if (compressed_size > src_size - EFI_HEADER_SIZE || *out_size > EFI_MAX_ORIGINAL_SIZE)
+    {
+        return 1;
+    }
+    return 0;
+}
+
+/*
+ * decompress src into dst, which must be efi_decompressed_size bytes
+ * returns 0 on success
+ */
+int
+efi_decompress(const uint8_t *src, size_t src_size, uint8_t *dst, uint32_t dst_size, int version)
+{
+    uint32_t original_size = 0;
+    if (efi_decompressed_size(src, src_size, &original_size) != 0 || original_size != dst_size)
+    {
+        return 1;
+    }
+    struct efi_decoder d;
+    memset(&d, 0, sizeof(struct efi_decoder));
+    d.src = src + EFI_HEADER_SIZE;
+    d.src_size = (uint32_t)src[0] | (uint32_t)src[1] << 8 | (uint32_t)src[2] << 16 | (uint32_t)src[3] << 24;
+    d.dst = dst;
+    d.dst_size = dst_size;
+    d.pbit = version == EFI_COMPRESSION_TIANO ? 5 : 4;
+    fill_buf(&d, BITBUFSIZ);
+    
+    while (d.out_pos < d.dst_size)
+    {
+        uint16_t c = decode_c(&d);
+        if (d.bad_table)
+        {
+            return 1;
+        }
+        if (c < 256)
+        {
+            d.dst[d.out_pos++] = (uint8_t)c;
+            continue;
+        }
+        uint32_t length = c - (256 - THRESHOLD);
+        uint32_t distance = decode_p(&d) + 1;
+        if (d.bad_table || distance > d.out_pos)
+        {
+            return 1;
+        }
+        uint32_t from = d.out_pos - distance;
+        /* the tail of the last match can be past the end, the reference decoder drops it */
+        while (length-- > 0 && d.out_pos < d.dst_size)
+        {
+            d.dst[d.out_pos++] = d.dst[from++];
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,57 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * efi_decompress.h
+ *
+ */
+
+#ifndef efi_swiss_knife_efi_decompress_h
+#define efi_swiss_knife_efi_decompress_h
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * EFI 1.1 and Tiano decompression, the LZ77 plus Huffman format of
+ * EFI_STANDARD_COMPRESSION sections and of Tiano custom GUID defined sections
+ * both are the same format, Tiano has a bigger window so position set sizes
+ * are 5 bits instead of 4
+ * the compressed data starts with its compressed and original sizes
+ */
+
+#define EFI_COMPRESSION_EFI     1
+#define EFI_COMPRESSION_TIANO   2
+
+int efi_decompressed_size(const uint8_t *src, size_t src_size, uint32_t *out_size);
+int efi_decompress(const uint8_t *src, size_t src_size, uint8_t *dst, uint32_t dst_size, int version);
+
+#endif /* efi_decompress_h */
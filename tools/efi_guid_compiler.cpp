@@ -0,0 +1,407 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * efi_guid_compiler.cpp
+ *
+ */
+
+/*
+ * standalone tool to build the binary GUID dictionary used by the plugin
+ *
+ * accepts any mix of:
+ * - efi_guids.h style sources, GUID_ENTRY("NAME", 0x..., ...) or { "NAME", { 0x..., ... } } lines
+ * - UEFITool style CSVs, one XXXXXXXX-XXXX-XXXX-XXXX-XXXXXXXXXXXX,NAME per line
+ * if the same GUID shows up more than once the first name wins, so list the
+ * preferred sources first
+ *
+ * to compile:
+ * c++ -O2 -o efi_guid_compiler tools/efi_guid_compiler.cpp
+ *
+ * usage:
+ * efi_guid_compiler -o efi_guids.dict efi_guids.h guids.csv ...
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "../efi_types.h"
+#include "../guid_dictionary.h"
+#include "../guid_index.h"
+
+#define MAX_NAME_SIZE   256
+
+struct dict_entry
+{
+    EFI_GUID guid;
+    uint32_t order;
+    char name[MAX_NAME_SIZE];
+};
+
+struct entry_list
+{
+    struct dict_entry *entries;
+    uint32_t count;
+    uint32_t capacity;
+};
+
+static int
+add_entry(struct entry_list *list, const EFI_GUID *guid, const char *name, size_t name_len)
+{
+    if (name_len == 0 || name_len >= MAX_NAME_SIZE)
+    {
+        return 1;
+    }
+    if (list->count == list->capacity)
+    {
+        uint32_t new_capacity = list->capacity ? list->capacity * 2 : 4096;
+        struct dict_entry *new_entries = (struct dict_entry*)realloc(list->entries, new_capacity * sizeof(struct dict_entry));
+        if (new_entries == NULL)
+        {
+            return 1;
+        }
+        list->entries = new_entries;
+        list->capacity = new_capacity;
+    }
+    struct dict_entry *entry = &list->entries[list->count];
+    memcpy(&entry->guid, guid, sizeof(EFI_GUID));
+    memcpy(entry->name, name, name_len);
+    entry->name[name_len] = '\0';
+    entry->order = list->count;
+    list->count++;
+    return 0;
+}
+
+/* GUID_ENTRY("NAME", 11 numbers) or { "NAME", { 11 numbers } } */
+static int
+parse_source_line(const char *line, EFI_GUID *guid, const char **name, size_t *name_len)
+{
+    const char *p = strstr(line, "GUID_ENTRY(");
+    if (p == NULL)
+    {
+        p = line;
+        while (isspace((unsigned char)*p))
+        {
+            p++;
+        }
+        if (*p != '{')
+        {
+            return 1;
+        }
+    }
+    p = strchr(p, '"');
+    if (p == NULL)
+    {
+        return 1;
+    }
+    const char *name_end = strchr(p + 1, '"');
+    if (name_end == NULL)
+    {
+        return 1;
+    }
+    *name = p + 1;
+    *name_len = name_end - (p + 1);
+    
+    unsigned long values[11] = {0};
+    p = name_end + 1;
+    for (int i = 0; i < 11; i++)
+    {
+        while (*p == ',' || *p == '{' || isspace((unsigned char)*p))
+        {
+            p++;
+        }
+        char *end = NULL;
+        values[i] = strtoul(p, &end, 0);
+        if (end == p)
+        {
+            return 1;
+        }
+        /* integer suffixes like 0x12345678L */
+        while (*end == 'u' || *end == 'U' || *end == 'l' || *end == 'L')
+        {
+            end++;
+        }
+        p = end;
+    }
+    guid->Data1 = (uint32_t)values[0];
+    guid->Data2 = (uint16_t)values[1];
+    guid->Data3 = (uint16_t)values[2];
+    for (int i = 0; i < 8; i++)
+    {
+        guid->Data4[i] = (uint8_t)values[3 + i];
+    }
+    return 0;
+}
+
+static int
+parse_hex(const char *p, int digits, uint32_t *out)
+{
+    uint32_t value = 0;
+    for (int i = 0; i < digits; i++)
+    {
+        if (isxdigit((unsigned char)p[i]) == 0)
+        {
+            return 1;
+        }
+        value = value << 4 | (uint32_t)(isdigit((unsigned char)p[i]) ? p[i] - '0' : (tolower((unsigned char)p[i]) - 'a' + 10));
+    }
+    *out = value;
+    return 0;
+}
+
+/* XXXXXXXX-XXXX-XXXX-XXXX-XXXXXXXXXXXX,NAME */
+static int
+parse_csv_line(const char *line, EFI_GUID *guid, const char **name, size_t *name_len)
+{
+    const char *p = line;
+    while (isspace((unsigned char)*p) || *p == '"')
+    {
+        p++;
+    }
+    if (strlen(p) < 37 || p[8] != '-' || p[13] != '-' || p[18] != '-' || p[23] != '-')
+    {
+        return 1;
+    }
+    uint32_t value = 0;
+    if (parse_hex(p, 8, &value) != 0)
+    {
+        return 1;
+    }
+    guid->Data1 = value;
+    if (parse_hex(p + 9, 4, &value) != 0)
+    {
+        return 1;
+    }
+    guid->Data2 = (uint16_t)value;
+    if (parse_hex(p + 14, 4, &value) != 0)
+    {
+        return 1;
+    }
+    guid->Data3 = (uint16_t)value;
+    static const int byte_pos[8] = { 19, 21, 24, 26, 28, 30, 32, 34 };
+    for (int i = 0; i < 8; i++)
+    {
+        if (parse_hex(p + byte_pos[i], 2, &value) != 0)
+        {
+            return 1;
+        }
+        guid->Data4[i] = (uint8_t)value;
+    }
+    p += 36;
+    while (*p == '"' || isspace((unsigned char)*p))
+    {
+        p++;
+    }
+    if (*p != ',')
+    {
+        return 1;
+    }
+    p++;
+    while (*p == '"' || isspace((unsigned char)*p))
+    {
+        p++;
+    }
+    const char *end = p;
+    while (*end != '\0' && *end != ',' && *end != '"' && *end != '\r' && *end != '\n')
+    {
+        end++;
+    }
+    while (end > p && isspace((unsigned char)end[-1]))
+    {
+        end--;
+    }
+    *name = p;
+    *name_len = end - p;
+    return 0;
+}
+
+static int
+load_file(const char *path, struct entry_list *list)
+{
+    FILE *input = fopen(path, "r");
+    if (input == NULL)
+    {
+        fprintf(stderr, "[ERROR] Can't open %s.\n", path);
+        return 1;
+    }
+    char line[4096];
+    uint32_t added = 0;
+    while (fgets(line, sizeof(line), input) != NULL)
+    {
+        EFI_GUID guid;
+        const char *name = NULL;
+        size_t name_len = 0;
+        if (parse_source_line(line, &guid, &name, &name_len) != 0 &&
+            parse_csv_line(line, &guid, &name, &name_len) != 0)
+        {
+            continue;
+        }
+        if (add_entry(list, &guid, name, name_len) == 0)
+        {
+            added++;
+        }
+    }
+    fclose(input);
+    printf("[INFO] %u GUIDs read from %s\n", added, path);
+    return 0;
+}
+
+static int
+compare_entries(const void *a, const void *b)
+{
+    const struct dict_entry *entry_a = (const struct dict_entry*)a;
+    const struct dict_entry *entry_b = (const struct dict_entry*)b;
+    int ret = guid_dict_compare(&entry_a->guid, &entry_b->guid);
+    if (ret != 0)
+    {
+        return ret;
+    }
+    return entry_a->order < entry_b->order ? -1 : entry_a->order > entry_b->order;
+}
+
+/* in order walk of the implicit tree so the sorted entries land in BFS order */
+static uint32_t
+eytzinger_layout(const struct dict_entry *sorted, struct dict_entry **out, uint32_t i, uint32_t k, uint32_t count)
+{
+    if (k <= count)
+    {
+        i = eytzinger_layout(sorted, out, i, 2 * k, count);
+        out[k] = (struct dict_entry*)&sorted[i++];
+        i = eytzinger_layout(sorted, out, i, 2 * k + 1, count);
+    }
+    return i;
+}
+
+static int
+write_dictionary(const char *path, struct entry_list *list)
+{
+    qsort(list->entries, list->count, sizeof(struct dict_entry), compare_entries);
+    /* remove duplicates, keeping the first one read */
+    uint32_t unique = 0;
+    for (uint32_t i = 0; i < list->count; i++)
+    {
+        if (unique == 0 || guid_dict_compare(&list->entries[unique - 1].guid, &list->entries[i].guid) != 0)
+        {
+            list->entries[unique++] = list->entries[i];
+        }
+    }
+    
+    struct dict_entry **layout = (struct dict_entry**)calloc(unique + 1, sizeof(struct dict_entry*));
+    EFI_GUID *keys = (EFI_GUID*)calloc(unique + 1, sizeof(EFI_GUID));
+    uint32_t *names = (uint32_t*)calloc(unique + 1, sizeof(uint32_t));
+    uint32_t *filter = (uint32_t*)calloc(GUID_FILTER_WORDS, sizeof(uint32_t));
+    if (layout == NULL || keys == NULL || names == NULL || filter == NULL)
+    {
+        fprintf(stderr, "[ERROR] Out of memory.\n");
+        return 1;
+    }
+    eytzinger_layout(list->entries, layout, 0, 1, unique);
+    
+    uint32_t pool_size = 0;
+    for (uint32_t k = 1; k <= unique; k++)
+    {
+        memcpy(&keys[k], &layout[k]->guid, sizeof(EFI_GUID));
+        names[k] = pool_size;
+        pool_size += (uint32_t)strlen(layout[k]->name) + 1;
+        uint32_t filter_bit = guid_filter_hash(layout[k]->guid.Data1);
+        filter[filter_bit / 32] |= 1U << (filter_bit % 32);
+    }
+    
+    struct guid_dict_header header;
+    memset(&header, 0, sizeof(header));
+    header.magic = GUID_DICT_MAGIC;
+    header.version = GUID_DICT_VERSION;
+    header.count = unique;
+    header.filter_bits = GUID_FILTER_BITS;
+    header.keys_offset = sizeof(header);
+    header.names_offset = header.keys_offset + (unique + 1) * sizeof(EFI_GUID);
+    header.filter_offset = header.names_offset + (unique + 1) * sizeof(uint32_t);
+    header.pool_offset = header.filter_offset + GUID_FILTER_WORDS * sizeof(uint32_t);
+    header.pool_size = pool_size;
+    
+    FILE *output = fopen(path, "wb");
+    if (output == NULL)
+    {
+        fprintf(stderr, "[ERROR] Can't create %s.\n", path);
+        return 1;
+    }
+    int ok = fwrite(&header, sizeof(header), 1, output) == 1 &&
+             fwrite(keys, sizeof(EFI_GUID), unique + 1, output) == unique + 1 &&
+             fwrite(names, sizeof(uint32_t), unique + 1, output) == unique + 1 &&
+             fwrite(filter, sizeof(uint32_t), GUID_FILTER_WORDS, output) == GUID_FILTER_WORDS;
+    for (uint32_t k = 1; k <= unique && ok; k++)
+    {
+        ok = fwrite(layout[k]->name, strlen(layout[k]->name) + 1, 1, output) == 1;
+    }
+    if (fclose(output) != 0 || ok == 0)
+    {
+        fprintf(stderr, "[ERROR] Failed to write %s.\n", path);
+        return 1;
+    }
+    printf("[INFO] Wrote %u unique GUIDs (%u duplicates dropped) to %s\n", unique, list->count - unique, path);
+    
+    free(layout);
+    free(keys);
+    free(names);
+    free(filter);
+    return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+    const char *output_path = NULL;
+    struct entry_list list = { NULL, 0, 0 };
+    
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-o") == 0 && i + 1 < argc)
+        {
+            output_path = argv[++i];
+            continue;
+        }
+        if (load_file(argv[i], &list) != 0)
+        {
+            return 1;
+        }
+    }
+    if (output_path == NULL || list.count == 0)
+    {
+        fprintf(stderr, "Usage: %s -o output.dict efi_guids.h [guids.csv ...]\n", argv[0]);
+        return 1;
+    }
+    
+    int ret = write_dictionary(output_path, &list);
+    free(list.entries);
+    return ret;
+}
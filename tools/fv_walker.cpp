@@ -0,0 +1,963 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * fv_walker.cpp
+ *
+ */
+
+#include "fv_walker.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include "../logging.h"
+#include "efi_decompress.h"
+#include "lzma_decoder.h"
+
+/*
+ * the walk is a pipeline: the calling thread walks the volumes, compressed
+ * sections go to a pool of workers that decompress them and walk the result
+ * in place, and every module is handed to the callback on the calling thread
+ * once its file is complete, in the order a serial walk would find them
+ *
+ * whoever walks a file or a decompressed section is the only writer of its
+ * list of items, and the calling thread only reads a list after the file it
+ * belongs to is complete, so the lists need no locking
+ */
+
+/* EFI_FIRMWARE_VOLUME_HEADER up to the block map */
+#define FV_LENGTH_OFFSET            32
+#define FV_SIGNATURE_OFFSET         40
+#define FV_ATTRIBUTES_OFFSET        44
+#define FV_HEADER_LENGTH_OFFSET     48
+#define FV_EXT_HEADER_OFFSET        52
+#define FV_HEADER_SIZE              56
+/* the block map ends with a zero entry */
+#define FV_BLOCK_MAP_ENTRY_SIZE     8
+#define FV_EXT_HEADER_SIZE_OFFSET   16
+
+/* EFI_FFS_FILE_HEADER and EFI_FFS_FILE_HEADER2 */
+#define FFS_TYPE_OFFSET             18
+#define FFS_ATTRIBUTES_OFFSET       19
+#define FFS_SIZE_OFFSET             20
+#define FFS_STATE_OFFSET            23
+#define FFS_EXTENDED_SIZE_OFFSET    24
+#define FFS_HEADER_SIZE             24
+#define FFS_HEADER2_SIZE            32
+
+/* EFI_COMMON_SECTION_HEADER and EFI_COMMON_SECTION_HEADER2 */
+#define SECTION_HEADER_SIZE         4
+#define SECTION_HEADER2_SIZE        8
+#define SECTION_SIZE_MASK           0xFFFFFF
+/* after the common header */
+#define GUID_SECTION_DATA_OFFSET    16
+#define GUID_SECTION_ATTRIBUTES     18
+#define GUID_SECTION_HEADER_SIZE    20
+#define COMPRESSION_TYPE_OFFSET     4
+#define COMPRESSION_HEADER_SIZE     5
+
+/* volumes inside sections inside volumes, a bad image can loop forever */
+#define FV_MAX_DEPTH                8
+#define FV_MAX_THREADS              32
+
+static const EFI_GUID g_ffs1_guid = { 0x7A9354D9, 0x0468, 0x444A, { 0x81, 0xCE, 0x0B, 0xF6, 0x17, 0xD8, 0x90, 0xDF } };
+static const EFI_GUID g_ffs2_guid = { 0x8C8CE578, 0x8A3D, 0x4F1C, { 0x99, 0x35, 0x89, 0x61, 0x85, 0xC3, 0x2D, 0xD3 } };
+static const EFI_GUID g_ffs3_guid = { 0x5473C07A, 0x3DCB, 0x4DCA, { 0xBD, 0x6F, 0x1E, 0x96, 0x89, 0xE7, 0x34, 0x9A } };
+/* Apple uses the FFS2 format with its own file system GUIDs */
+static const EFI_GUID g_apple_ffs_guid = { 0x04ADEEAD, 0x61FF, 0x4D31, { 0xB6, 0xBA, 0x64, 0xF8, 0xBF, 0x90, 0x1F, 0x5A } };
+static const EFI_GUID g_apple_ffs2_guid = { 0xBD001B8C, 0x6A71, 0x487B, { 0xA1, 0x4F, 0x0C, 0x2A, 0x2D, 0xCF, 0x7A, 0x5D } };
+
+/* GUID defined sections we can decode */
+static const EFI_GUID g_lzma_guid = { 0xEE4E5898, 0x3914, 0x4259, { 0x9D, 0x6E, 0xDC, 0x7B, 0xD7, 0x94, 0x03, 0xCF } };
+static const EFI_GUID g_lzma_f86_guid = { 0xD42AE6BD, 0x1352, 0x4BFB, { 0x90, 0x9A, 0xCA, 0x72, 0xA6, 0xEA, 0xE8, 0x89 } };
+static const EFI_GUID g_tiano_guid = { 0xA31280AD, 0x481E, 0x41B6, { 0x95, 0xE8, 0x12, 0x7F, 0x4C, 0x98, 0x47, 0x79 } };
+/* only a checksum in front of plain sections, even when marked as needing processing */
+static const EFI_GUID g_crc32_guid = { 0xFC1BCDB0, 0x7D31, 0x49AA, { 0x93, 0x6A, 0xA4, 0x60, 0x0D, 0x9D, 0xD0, 0x83 } };
+
+enum compression_kind
+{
+    /* EFI_STANDARD_COMPRESSION, some vendors use Tiano instead of EFI */
+    kCompressionStandard = 0,
+    /* EFI_CUSTOMIZED_COMPRESSION, usually LZMA, else Tiano */
+    kCompressionCustom,
+    kCompressionTiano,
+    kCompressionLzma,
+    kCompressionLzmaX86
+};
+
+enum item_kind
+{
+    kItemModule = 0,
+    kItemFile,
+    kItemJob
+};
+
+struct ffs_file;
+struct decompress_job;
+
+/* a module, a nested file or a decompressed section, in walk order */
+struct fv_item
+{
+    int kind;
+    struct fv_module module;
+    struct ffs_file *file;
+    struct decompress_job *job;
+    struct fv_item *next;
+};
+
+struct item_list
+{
+    struct fv_item *head;
+    struct fv_item *tail;
+};
+
+struct ffs_file
+{
+    const uint8_t *header;
+    uint8_t type;
+    char name[FV_MODULE_NAME_SIZE];
+    struct item_list items;
+    /* the walk of its sections plus its unfinished jobs, under the walk lock */
+    uint32_t pending;
+};
+
+struct decompress_job
+{
+    /* the file the compressed section belongs to */
+    struct ffs_file *file;
+    int kind;
+    int depth;
+    int failed;
+    const uint8_t *src;
+    size_t src_size;
+    /* the decompressed sections, modules and nested files point into it */
+    uint8_t *output;
+    uint32_t output_size;
+    struct item_list items;
+    struct decompress_job *next_queued;
+};
+
+struct fv_walk
+{
+    fv_module_callback callback;
+    void *context;
+    struct fv_walk_stats *stats;
+    int stopped;
+    
+    pthread_mutex_t lock;
+    /* workers wait for jobs, the calling thread for complete files */
+    pthread_cond_t job_ready;
+    pthread_cond_t file_done;
+    struct decompress_job *queue_head;
+    struct decompress_job *queue_tail;
+    int shutdown;
+    pthread_t threads[FV_MAX_THREADS];
+    uint32_t nr_threads;
+};
+
+/* a thread walking sections, its counters are merged under the lock when done */
+struct section_walker
+{
+    struct fv_walk *walk;
+    struct fv_walk_stats counts;
+    int worker;
+};
+
+/* the log file is opened and closed around each module on the calling thread, workers stay quiet */
+#define WALK_DEBUG_MSG(walker, fmt, ...) do { if ((walker)->worker == 0) DEBUG_MSG(fmt, ## __VA_ARGS__); } while (0)
+
+static int walk_volumes(struct section_walker *walker, struct item_list *items, const uint8_t *data, size_t size, int depth);
+
+static inline uint16_t
+read16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | p[1] << 8);
+}
+
+static inline uint32_t
+read24(const uint8_t *p)
+{
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16;
+}
+
+static inline uint32_t
+read32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static inline uint64_t
+read64(const uint8_t *p)
+{
+    return (uint64_t)read32(p) | (uint64_t)read32(p + 4) << 32;
+}
+
+static inline size_t
+align_up(size_t value, size_t alignment)
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+static uint64_t
+time_usec(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static void
+merge_counts(struct fv_walk_stats *stats, const struct fv_walk_stats *counts)
+{
+    stats->volumes += counts->volumes;
+    stats->files += counts->files;
+    stats->sections += counts->sections;
+    stats->skipped += counts->skipped;
+    stats->decompressed += counts->decompressed;
+    stats->compressed_bytes += counts->compressed_bytes;
+    stats->decompressed_bytes += counts->decompressed_bytes;
+    stats->decompress_usec += counts->decompress_usec;
+}
+
+static int
+is_ffs_volume(const uint8_t *file_system, int *ffs3)
+{
+    *ffs3 = memcmp(file_system, &g_ffs3_guid, sizeof(EFI_GUID)) == 0;
+    return *ffs3 ||
+           memcmp(file_system, &g_ffs2_guid, sizeof(EFI_GUID)) == 0 ||
+           memcmp(file_system, &g_ffs1_guid, sizeof(EFI_GUID)) == 0 ||
+           memcmp(file_system, &g_apple_ffs_guid, sizeof(EFI_GUID)) == 0 ||
+           memcmp(file_system, &g_apple_ffs2_guid, sizeof(EFI_GUID)) == 0;
+}
+
+/*
+ * the user interface section is a NUL terminated UTF-16 string
+ * anything outside printable ASCII is replaced, it's only used for display
+ */
+static void
+copy_ui_name(const uint8_t *data, size_t size, char *out)
+{
+    size_t i = 0;
+    for (; i < FV_MODULE_NAME_SIZE - 1 && (i + 1) * 2 <= size; i++)
+    {
+        uint16_t c = read16(data + i * 2);
+        if (c == 0)
+        {
+            break;
+        }
+        out[i] = c >= 0x20 && c < 0x7F ? (char)c : '?';
+    }
+    out[i] = '\0';
+}
+
+static struct fv_item *
+add_item(struct item_list *items, int kind)
+{
+    struct fv_item *item = (struct fv_item*)calloc(1, sizeof(struct fv_item));
+    if (item == NULL)
+    {
+        ERROR_MSG("Can't allocate memory for the firmware walk.");
+        return NULL;
+    }
+    item->kind = kind;
+    if (items->tail != NULL)
+    {
+        items->tail->next = item;
+    }
+    else
+    {
+        items->head = item;
+    }
+    items->tail = item;
+    return item;
+}
+
+static int
+add_module(struct item_list *items, const struct ffs_file *file, uint8_t section_type, const uint8_t *data, size_t size)
+{
+    struct fv_item *item = add_item(items, kItemModule);
+    if (item == NULL)
+    {
+        return 1;
+    }
+    memcpy(&item->module.file_guid, file->header, sizeof(EFI_GUID));
+    item->module.file_type = file->type;
+    item->module.section_type = section_type;
+    item->module.data = data;
+    item->module.size = size;
+    return 0;
+}
+
+/*
+ * one less thing before the file is complete
+ * call with the walk lock held
+ */
+static void
+release_file(struct fv_walk *walk, struct ffs_file *file)
+{
+    if (--file->pending == 0)
+    {
+        pthread_cond_broadcast(&walk->file_done);
+    }
+}
+
+/*
+ * queue a compressed section, its items go where the section was found
+ * returns 0 on success
+ */
+static int
+submit_job(struct section_walker *walker, struct ffs_file *file, struct item_list *items, int kind,
+           const uint8_t *src, size_t src_size, int depth)
+{
+    struct decompress_job *job = (struct decompress_job*)calloc(1, sizeof(struct decompress_job));
+    if (job == NULL)
+    {
+        ERROR_MSG("Can't allocate memory for the firmware walk.");
+        return 1;
+    }
+    struct fv_item *item = add_item(items, kItemJob);
+    if (item == NULL)
+    {
+        free(job);
+        return 1;
+    }
+    item->job = job;
+    job->file = file;
+    job->kind = kind;
+    job->src = src;
+    job->src_size = src_size;
+    job->depth = depth;
+    
+    struct fv_walk *walk = walker->walk;
+    pthread_mutex_lock(&walk->lock);
+    file->pending++;
+    if (walk->queue_tail != NULL)
+    {
+        walk->queue_tail->next_queued = job;
+    }
+    else
+    {
+        walk->queue_head = job;
+    }
+    walk->queue_tail = job;
+    pthread_cond_signal(&walk->job_ready);
+    pthread_mutex_unlock(&walk->lock);
+    return 0;
+}
+
+/*
+ * the sections of a file, or of an encapsulation section
+ * a bad section ends the walk of its list but not of the volume
+ */
+static int
+walk_sections(struct section_walker *walker, struct ffs_file *file, struct item_list *items, const uint8_t *data, size_t size, int depth)
+{
+    if (depth > FV_MAX_DEPTH)
+    {
+        WALK_DEBUG_MSG(walker, "Sections nested too deep, skipping.");
+        return 0;
+    }
+    size_t offset = 0;
+    while (offset < size && size - offset >= SECTION_HEADER_SIZE)
+    {
+        const uint8_t *section = data + offset;
+        size_t section_size = read24(section);
+        size_t header_size = SECTION_HEADER_SIZE;
+        uint8_t type = section[3];
+        if (section_size == SECTION_SIZE_MASK)
+        {
+            if (size - offset < SECTION_HEADER2_SIZE)
+            {
+                break;
+            }
+            section_size = read32(section + 4);
+            header_size = SECTION_HEADER2_SIZE;
+        }
+        if (section_size < header_size || section_size > size - offset)
+        {
+            WALK_DEBUG_MSG(walker, "Invalid section of type 0x%x.", type);
+            break;
+        }
+        walker->counts.sections++;
+        const uint8_t *body = section + header_size;
+        size_t body_size = section_size - header_size;
+        int ret = 0;
+        switch (type)
+        {
+            case EFI_SECTION_PE32:
+            case EFI_SECTION_TE:
+            {
+                ret = add_module(items, file, type, body, body_size);
+                break;
+            }
+            case EFI_SECTION_USER_INTERFACE:
+            {
+                copy_ui_name(body, body_size, file->name);
+                break;
+            }
+            case EFI_SECTION_FIRMWARE_VOLUME_IMAGE:
+            {
+                ret = walk_volumes(walker, items, body, body_size, depth + 1);
+                break;
+            }
+            case EFI_SECTION_GUID_DEFINED:
+            {
+                if (body_size < GUID_SECTION_HEADER_SIZE)
+                {
+                    break;
+                }
+                size_t data_offset = read16(body + GUID_SECTION_DATA_OFFSET);
+                uint16_t attributes = read16(body + GUID_SECTION_ATTRIBUTES);
+                if (data_offset < header_size + GUID_SECTION_HEADER_SIZE || data_offset > section_size)
+                {
+                    WALK_DEBUG_MSG(walker, "Invalid GUID defined section data offset 0x%lx.", (unsigned long)data_offset);
+                    break;
+                }
+                const uint8_t *section_data = section + data_offset;
+                size_t section_data_size = section_size - data_offset;
+                /* the data is plain sections, the GUID only authenticates them */
+                if (!(attributes & EFI_GUIDED_SECTION_PROCESSING_REQUIRED) || memcmp(body, &g_crc32_guid, sizeof(EFI_GUID)) == 0)
+                {
+                    ret = walk_sections(walker, file, items, section_data, section_data_size, depth + 1);
+                }
+                else if (memcmp(body, &g_lzma_guid, sizeof(EFI_GUID)) == 0)
+                {
+                    ret = submit_job(walker, file, items, kCompressionLzma, section_data, section_data_size, depth + 1);
+                }
+                else if (memcmp(body, &g_lzma_f86_guid, sizeof(EFI_GUID)) == 0)
+                {
+                    ret = submit_job(walker, file, items, kCompressionLzmaX86, section_data, section_data_size, depth + 1);
+                }
+                else if (memcmp(body, &g_tiano_guid, sizeof(EFI_GUID)) == 0)
+                {
+                    ret = submit_job(walker, file, items, kCompressionTiano, section_data, section_data_size, depth + 1);
+                }
+                else
+                {
+                    char guid_string[GUID_STRING_SIZE] = {0};
+                    EFI_GUID guid;
+                    memcpy(&guid, body, sizeof(EFI_GUID));
+                    WALK_DEBUG_MSG(walker, "Skipping GUID defined section %s.", format_guid(&guid, guid_string));
+                    walker->counts.skipped++;
+                }
+                break;
+            }
+            case EFI_SECTION_COMPRESSION:
+            {
+                if (body_size < COMPRESSION_HEADER_SIZE)
+                {
+                    break;
+                }
+                const uint8_t *compressed = body + COMPRESSION_HEADER_SIZE;
+                size_t compressed_size = body_size - COMPRESSION_HEADER_SIZE;
+                switch (body[COMPRESSION_TYPE_OFFSET])
+                {
+                    case EFI_NOT_COMPRESSED:
+                        ret = walk_sections(walker, file, items, compressed, compressed_size, depth + 1);
+                        break;
+                    case EFI_STANDARD_COMPRESSION:
+                        ret = submit_job(walker, file, items, kCompressionStandard, compressed, compressed_size, depth + 1);
+                        break;
+                    case EFI_CUSTOMIZED_COMPRESSION:
+                        ret = submit_job(walker, file, items, kCompressionCustom, compressed, compressed_size, depth + 1);
+                        break;
+                    default:
+                        WALK_DEBUG_MSG(walker, "Skipping compressed section of type %d.", body[COMPRESSION_TYPE_OFFSET]);
+                        walker->counts.skipped++;
+                        break;
+                }
+                break;
+            }
+            default:
+                break;
+        }
+        if (ret != 0)
+        {
+            return 1;
+        }
+        offset = align_up(offset + section_size, 4);
+    }
+    return 0;
+}
+
+/*
+ * a file is complete once its sections and every compressed section in
+ * them are walked
+ */
+static int
+walk_file(struct section_walker *walker, struct item_list *items, const uint8_t *header, const uint8_t *data, size_t size, int depth)
+{
+    struct ffs_file *file = (struct ffs_file*)calloc(1, sizeof(struct ffs_file));
+    if (file == NULL)
+    {
+        ERROR_MSG("Can't allocate memory for the firmware walk.");
+        return 1;
+    }
+    struct fv_item *item = add_item(items, kItemFile);
+    if (item == NULL)
+    {
+        free(file);
+        return 1;
+    }
+    item->file = file;
+    file->header = header;
+    file->type = header[FFS_TYPE_OFFSET];
+    file->pending = 1;
+    int ret = walk_sections(walker, file, &file->items, data, size, depth);
+    pthread_mutex_lock(&walker->walk->lock);
+    release_file(walker->walk, file);
+    pthread_mutex_unlock(&walker->walk->lock);
+    return ret;
+}
+
+/*
+ * the files of one volume, fv_size bytes at fv already validated
+ */
+static int
+walk_volume(struct section_walker *walker, struct item_list *items, const uint8_t *fv, size_t fv_size, int ffs3, int depth)
+{
+    uint8_t erase_byte = (read32(fv + FV_ATTRIBUTES_OFFSET) & EFI_FVB2_ERASE_POLARITY) ? 0xFF : 0x00;
+    size_t offset = read16(fv + FV_HEADER_LENGTH_OFFSET);
+    uint16_t ext_header = read16(fv + FV_EXT_HEADER_OFFSET);
+    if (ext_header != 0)
+    {
+        if (ext_header > fv_size || fv_size - ext_header < FV_EXT_HEADER_SIZE_OFFSET + 4)
+        {
+            WALK_DEBUG_MSG(walker, "Invalid volume extended header.");
+            return 0;
+        }
+        offset = ext_header + (size_t)read32(fv + ext_header + FV_EXT_HEADER_SIZE_OFFSET);
+    }
+    offset = align_up(offset, 8);
+    while (offset < fv_size && fv_size - offset >= FFS_HEADER_SIZE)
+    {
+        const uint8_t *header = fv + offset;
+        /* the rest of the volume is free space */
+        size_t i = 0;
+        while (i < FFS_HEADER_SIZE && header[i] == erase_byte)
+        {
+            i++;
+        }
+        if (i == FFS_HEADER_SIZE)
+        {
+            break;
+        }
+        size_t file_size = read24(header + FFS_SIZE_OFFSET);
+        size_t header_size = FFS_HEADER_SIZE;
+        if (ffs3 && (header[FFS_ATTRIBUTES_OFFSET] & FFS_ATTRIB_LARGE_FILE))
+        {
+            if (fv_size - offset < FFS_HEADER2_SIZE)
+            {
+                break;
+            }
+            uint64_t extended_size = read64(header + FFS_EXTENDED_SIZE_OFFSET);
+            file_size = extended_size > fv_size ? 0 : (size_t)extended_size;
+            header_size = FFS_HEADER2_SIZE;
+        }
+        if (file_size < header_size || file_size > fv_size - offset)
+        {
+            WALK_DEBUG_MSG(walker, "Invalid file at volume offset 0x%lx.", (unsigned long)offset);
+            break;
+        }
+        walker->counts.files++;
+        uint8_t state = header[FFS_STATE_OFFSET];
+        if (erase_byte)
+        {
+            state = ~state;
+        }
+        uint8_t type = header[FFS_TYPE_OFFSET];
+        if ((state & EFI_FILE_DATA_VALID) && !(state & (EFI_FILE_DELETED | EFI_FILE_HEADER_INVALID)) &&
+            type >= EFI_FV_FILETYPE_FREEFORM && type <= EFI_FV_FILETYPE_MM_CORE_STANDALONE)
+        {
+            if (walk_file(walker, items, header, header + header_size, file_size - header_size, depth) != 0)
+            {
+                return 1;
+            }
+        }
+        offset = align_up(offset + file_size, 8);
+    }
+    return 0;
+}
+
+/*
+ * find the volumes in data, at 8 bytes boundaries like inside an FFS file
+ */
+static int
+walk_volumes(struct section_walker *walker, struct item_list *items, const uint8_t *data, size_t size, int depth)
+{
+    if (depth > FV_MAX_DEPTH)
+    {
+        WALK_DEBUG_MSG(walker, "Volumes nested too deep, skipping.");
+        return 0;
+    }
+    size_t offset = 0;
+    while (offset < size && size - offset >= FV_HEADER_SIZE + FV_BLOCK_MAP_ENTRY_SIZE)
+    {
+        const uint8_t *fv = data + offset;
+        if (read32(fv + FV_SIGNATURE_OFFSET) != EFI_FVH_SIGNATURE)
+        {
+            offset += 8;
+            continue;
+        }
+        uint64_t fv_length = read64(fv + FV_LENGTH_OFFSET);
+        uint16_t header_length = read16(fv + FV_HEADER_LENGTH_OFFSET);
+        int ffs3 = 0;
+        if (header_length < FV_HEADER_SIZE + FV_BLOCK_MAP_ENTRY_SIZE || fv_length < header_length ||
+            fv_length > size - offset || is_ffs_volume(fv + 16, &ffs3) == 0)
+        {
+            /* a volume with another file system, or just a match in some data */
+            offset += 8;
+            continue;
+        }
+        uint16_t checksum = 0;
+        for (uint16_t i = 0; i + 1 < header_length; i += 2)
+        {
+            checksum += read16(fv + i);
+        }
+        if (checksum != 0)
+        {
+            WALK_DEBUG_MSG(walker, "Volume at offset 0x%lx has a bad header checksum.", (unsigned long)offset);
+        }
+        walker->counts.volumes++;
+        if (walk_volume(walker, items, fv, (size_t)fv_length, ffs3, depth) != 0)
+        {
+            return 1;
+        }
+        offset += align_up((size_t)fv_length, 8);
+    }
+    return 0;
+}
+
+#pragma mark -
+#pragma mark Decompression workers
+#pragma mark -
+
+/*
+ * decompress into a buffer of the exact size, it's walked and loaded in place
+ * returns 0 on success
+ */
+static int
+decompress_section(struct decompress_job *job)
+{
+    uint32_t size = 0;
+    int lzma = job->kind == kCompressionLzma || job->kind == kCompressionLzmaX86 || job->kind == kCompressionCustom;
+    if (lzma && lzma_decompressed_size(job->src, job->src_size, &size) == 0)
+    {
+        job->output = (uint8_t*)malloc(size ? size : 1);
+        if (job->output != NULL && lzma_decompress(job->src, job->src_size, job->output, size) == 0)
+        {
+            if (job->kind == kCompressionLzmaX86)
+            {
+                x86_filter_decode(job->output, size);
+            }
+            job->output_size = size;
+            return 0;
+        }
+        free(job->output);
+        job->output = NULL;
+    }
+    if (job->kind == kCompressionLzma || job->kind == kCompressionLzmaX86)
+    {
+        return 1;
+    }
+    
+    if (efi_decompressed_size(job->src, job->src_size, &size) != 0)
+    {
+        return 1;
+    }
+    job->output = (uint8_t*)malloc(size ? size : 1);
+    if (job->output == NULL)
+    {
+        return 1;
+    }
+    /* the two formats only differ in one field size, try the expected one first */
+    if ((job->kind == kCompressionStandard && efi_decompress(job->src, job->src_size, job->output, size, EFI_COMPRESSION_EFI) == 0) ||
+        efi_decompress(job->src, job->src_size, job->output, size, EFI_COMPRESSION_TIANO) == 0)
+    {
+        job->output_size = size;
+        return 0;
+    }
+    free(job->output);
+    job->output = NULL;
+    return 1;
+}
+
+static void *
+decompress_worker(void *argument)
+{
+    struct fv_walk *walk = (struct fv_walk*)argument;
+    pthread_mutex_lock(&walk->lock);
+    for (;;)
+    {
+        while (walk->queue_head == NULL && walk->shutdown == 0)
+        {
+            pthread_cond_wait(&walk->job_ready, &walk->lock);
+        }
+        if (walk->queue_head == NULL)
+        {
+            break;
+        }
+        struct decompress_job *job = walk->queue_head;
+        walk->queue_head = job->next_queued;
+        if (walk->queue_head == NULL)
+        {
+            walk->queue_tail = NULL;
+        }
+        int stopped = walk->stopped;
+        pthread_mutex_unlock(&walk->lock);
+        
+        struct section_walker walker;
+        memset(&walker, 0, sizeof(struct section_walker));
+        walker.walk = walk;
+        walker.worker = 1;
+        if (stopped == 0)
+        {
+            uint64_t start = time_usec();
+            if (decompress_section(job) == 0)
+            {
+                walker.counts.decompress_usec = time_usec() - start;
+                walker.counts.decompressed = 1;
+                walker.counts.compressed_bytes = job->src_size;
+                walker.counts.decompressed_bytes = job->output_size;
+                walk_sections(&walker, job->file, &job->items, job->output, job->output_size, job->depth);
+            }
+            else
+            {
+                job->failed = 1;
+                walker.counts.skipped = 1;
+            }
+        }
+        
+        pthread_mutex_lock(&walk->lock);
+        merge_counts(walk->stats, &walker.counts);
+        release_file(walk, job->file);
+    }
+    pthread_mutex_unlock(&walk->lock);
+    return NULL;
+}
+
+static uint32_t
+default_threads(void)
+{
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    return cpus > 0 ? (uint32_t)cpus : 1;
+}
+
+static int
+start_workers(struct fv_walk *walk, uint32_t threads)
+{
+    if (threads == 0)
+    {
+        threads = default_threads();
+    }
+    if (threads > FV_MAX_THREADS)
+    {
+        threads = FV_MAX_THREADS;
+    }
+    pthread_mutex_init(&walk->lock, NULL);
+    pthread_cond_init(&walk->job_ready, NULL);
+    pthread_cond_init(&walk->file_done, NULL);
+    for (uint32_t i = 0; i < threads; i++)
+    {
+        if (pthread_create(&walk->threads[walk->nr_threads], NULL, decompress_worker, walk) != 0)
+        {
+            break;
+        }
+        walk->nr_threads++;
+    }
+    if (walk->nr_threads == 0)
+    {
+        ERROR_MSG("Can't start the decompression threads.");
+        return 1;
+    }
+    return 0;
+}
+
+static void
+stop_workers(struct fv_walk *walk)
+{
+    pthread_mutex_lock(&walk->lock);
+    walk->shutdown = 1;
+    pthread_cond_broadcast(&walk->job_ready);
+    pthread_mutex_unlock(&walk->lock);
+    for (uint32_t i = 0; i < walk->nr_threads; i++)
+    {
+        pthread_join(walk->threads[i], NULL);
+    }
+    pthread_cond_destroy(&walk->file_done);
+    pthread_cond_destroy(&walk->job_ready);
+    pthread_mutex_destroy(&walk->lock);
+}
+
+#pragma mark -
+#pragma mark Reporting
+#pragma mark -
+
+static void report_file(struct fv_walk *walk, struct ffs_file *file);
+
+/*
+ * hand the modules to the callback in walk order and free the items
+ * decompressed buffers go once everything found in them was reported
+ */
+static void
+report_items(struct fv_walk *walk, struct ffs_file *file, struct item_list *items)
+{
+    struct fv_item *item = items->head;
+    while (item != NULL)
+    {
+        switch (item->kind)
+        {
+            case kItemModule:
+            {
+                struct fv_module *module = &item->module;
+                memcpy(module->name, file->name, sizeof(module->name));
+                format_guid(&module->file_guid, module->guid_string);
+                if (walk->stopped == 0)
+                {
+                    walk->stats->modules++;
+                    uint64_t start = time_usec();
+                    if (walk->callback(module, walk->context) != 0)
+                    {
+                        pthread_mutex_lock(&walk->lock);
+                        walk->stopped = 1;
+                        pthread_mutex_unlock(&walk->lock);
+                    }
+                    walk->stats->analysis_usec += time_usec() - start;
+                }
+                break;
+            }
+            case kItemFile:
+            {
+                report_file(walk, item->file);
+                break;
+            }
+            case kItemJob:
+            {
+                if (item->job->failed)
+                {
+                    DEBUG_MSG("Failed to decompress section of %lu bytes.", (unsigned long)item->job->src_size);
+                }
+                report_items(walk, file, &item->job->items);
+                free(item->job->output);
+                free(item->job);
+                break;
+            }
+        }
+        struct fv_item *next = item->next;
+        free(item);
+        item = next;
+    }
+    items->head = NULL;
+    items->tail = NULL;
+}
+
+/*
+ * wait for the file to be complete, its name can be in a compressed section
+ */
+static void
+report_file(struct fv_walk *walk, struct ffs_file *file)
+{
+    pthread_mutex_lock(&walk->lock);
+    while (file->pending != 0)
+    {
+        pthread_cond_wait(&walk->file_done, &walk->lock);
+    }
+    pthread_mutex_unlock(&walk->lock);
+    report_items(walk, file, &file->items);
+    free(file);
+}
+
+/*
+ * report every PE32 and TE section found in the volumes of a firmware image
+ * module data points into data or into decompressed buffers only valid
+ * during the callback
+ * threads is the number of decompression workers, 0 for one per CPU
+ * returns 0 if there was at least one volume
+ */
+int
+walk_firmware_image(const uint8_t *data, size_t size, uint32_t threads, fv_module_callback callback, void *context, struct fv_walk_stats *stats)
+{
+    memset(stats, 0, sizeof(struct fv_walk_stats));
+    struct fv_walk walk;
+    memset(&walk, 0, sizeof(struct fv_walk));
+    walk.callback = callback;
+    walk.context = context;
+    walk.stats = stats;
+    uint64_t start = time_usec();
+    if (start_workers(&walk, threads) != 0)
+    {
+        return 1;
+    }
+    stats->threads = walk.nr_threads;
+    
+    /* top level files belong to no file, they only need the list */
+    struct section_walker walker;
+    memset(&walker, 0, sizeof(struct section_walker));
+    walker.walk = &walk;
+    struct item_list items = { NULL, NULL };
+    int ret = walk_volumes(&walker, &items, data, size, 0);
+    stats->walk_usec = time_usec() - start;
+    pthread_mutex_lock(&walk.lock);
+    merge_counts(stats, &walker.counts);
+    if (ret != 0)
+    {
+        walk.stopped = 1;
+    }
+    pthread_mutex_unlock(&walk.lock);
+    
+    struct fv_item *item = items.head;
+    while (item != NULL)
+    {
+        struct fv_item *next = item->next;
+        report_file(&walk, item->file);
+        free(item);
+        item = next;
+    }
+    stop_workers(&walk);
+    stats->total_usec = time_usec() - start;
+    
+    DEBUG_MSG("Firmware image: %u volumes, %u files, %u sections, %u modules, %u sections decompressed, %u sections skipped.",
+              stats->volumes, stats->files, stats->sections, stats->modules, stats->decompressed, stats->skipped);
+    if (ret != 0)
+    {
+        return 1;
+    }
+    if (stats->volumes == 0)
+    {
+        ERROR_MSG("No firmware volumes found.");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,134 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * fv_walker.h
+ *
+ */
+
+#ifndef efi_swiss_knife_fv_walker_h
+#define efi_swiss_knife_fv_walker_h
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "../efi_types.h"
+#include "../guid_format.h"
+
+/*
+ * firmware volume walker for the standalone analyzer
+ * finds every firmware volume in a flash dump, walks their FFS files and
+ * sections, nested volumes, GUID defined and compressed sections included,
+ * and hands each PE32 and TE section to a callback straight from the mapping
+ * or from the decompressed section it was found in
+ */
+
+#define EFI_FVH_SIGNATURE                   0x4856465F  /* _FVH */
+#define EFI_FVB2_ERASE_POLARITY             0x00000800
+
+#define EFI_FV_FILETYPE_RAW                 0x01
+#define EFI_FV_FILETYPE_FREEFORM            0x02
+#define EFI_FV_FILETYPE_SECURITY_CORE       0x03
+#define EFI_FV_FILETYPE_PEI_CORE            0x04
+#define EFI_FV_FILETYPE_DXE_CORE            0x05
+#define EFI_FV_FILETYPE_PEIM                0x06
+#define EFI_FV_FILETYPE_DRIVER              0x07
+#define EFI_FV_FILETYPE_COMBINED_PEIM_DRIVER    0x08
+#define EFI_FV_FILETYPE_APPLICATION         0x09
+#define EFI_FV_FILETYPE_SMM                 0x0A
+#define EFI_FV_FILETYPE_FIRMWARE_VOLUME_IMAGE   0x0B
+#define EFI_FV_FILETYPE_COMBINED_SMM_DXE    0x0C
+#define EFI_FV_FILETYPE_SMM_CORE            0x0D
+#define EFI_FV_FILETYPE_MM_STANDALONE       0x0E
+#define EFI_FV_FILETYPE_MM_CORE_STANDALONE  0x0F
+#define EFI_FV_FILETYPE_FFS_PAD             0xF0
+
+#define FFS_ATTRIB_LARGE_FILE               0x01
+
+#define EFI_FILE_DATA_VALID                 0x04
+#define EFI_FILE_DELETED                    0x10
+#define EFI_FILE_HEADER_INVALID             0x20
+
+#define EFI_SECTION_COMPRESSION             0x01
+#define EFI_SECTION_GUID_DEFINED            0x02
+#define EFI_SECTION_PE32                    0x10
+#define EFI_SECTION_TE                      0x12
+#define EFI_SECTION_USER_INTERFACE          0x15
+#define EFI_SECTION_FIRMWARE_VOLUME_IMAGE   0x17
+
+#define EFI_NOT_COMPRESSED                  0x00
+#define EFI_STANDARD_COMPRESSION            0x01
+#define EFI_CUSTOMIZED_COMPRESSION          0x02
+#define EFI_GUIDED_SECTION_PROCESSING_REQUIRED  0x01
+
+/* the module name from the file's user interface section, ASCII only */
+#define FV_MODULE_NAME_SIZE                 64
+
+struct fv_module
+{
+    EFI_GUID file_guid;
+    char guid_string[GUID_STRING_SIZE];
+    char name[FV_MODULE_NAME_SIZE];
+    uint8_t file_type;
+    /* EFI_SECTION_PE32 or EFI_SECTION_TE */
+    uint8_t section_type;
+    /* the image, inside the walked buffer */
+    const uint8_t *data;
+    size_t size;
+};
+
+struct fv_walk_stats
+{
+    uint32_t volumes;
+    uint32_t files;
+    uint32_t sections;
+    uint32_t modules;
+    /* sections that need a decoder we don't have or failed to decode */
+    uint32_t skipped;
+    uint32_t decompressed;
+    uint64_t compressed_bytes;
+    uint64_t decompressed_bytes;
+    uint32_t threads;
+    /* time spent walking the volumes, before waiting for the workers */
+    uint64_t walk_usec;
+    /* decompression time summed over the workers */
+    uint64_t decompress_usec;
+    /* time spent in the callback */
+    uint64_t analysis_usec;
+    uint64_t total_usec;
+};
+
+/* called for every module found, in walk order, a non zero return stops the walk */
+typedef int (*fv_module_callback)(const struct fv_module *module, void *context);
+
+int walk_firmware_image(const uint8_t *data, size_t size, uint32_t threads, fv_module_callback callback, void *context, struct fv_walk_stats *stats);
+
+#endif /* fv_walker_h */
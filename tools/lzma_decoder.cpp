@@ -0,0 +1,512 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * lzma_decoder.cpp
+ *
+ */
+
+#include "lzma_decoder.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define LZMA_PROPS_SIZE         5
+#define LZMA_HEADER_SIZE        (LZMA_PROPS_SIZE + 8)
+#define LZMA_MAX_OUTPUT_SIZE    (256 * 1024 * 1024)
+
+#define NUM_BIT_MODEL_TOTAL_BITS    11
+#define BIT_MODEL_TOTAL         (1 << NUM_BIT_MODEL_TOTAL_BITS)
+#define NUM_MOVE_BITS           5
+#define TOP_VALUE               (1U << 24)
+
+#define NUM_STATES              12
+#define NUM_POS_BITS_MAX        4
+#define NUM_LEN_TO_POS_STATES   4
+#define NUM_ALIGN_BITS          4
+#define START_POS_MODEL_INDEX   4
+#define END_POS_MODEL_INDEX     14
+#define NUM_FULL_DISTANCES      (1 << (END_POS_MODEL_INDEX >> 1))
+#define MATCH_MIN_LEN           2
+
+#define LEN_LOW_BITS            3
+#define LEN_MID_BITS            3
+#define LEN_HIGH_BITS           8
+
+typedef uint16_t lzma_prob;
+
+struct range_decoder
+{
+    const uint8_t *src;
+    size_t size;
+    size_t pos;
+    uint32_t range;
+    uint32_t code;
+    int corrupted;
+};
+
+struct len_decoder
+{
+    lzma_prob choice;
+    lzma_prob choice2;
+    lzma_prob low[1 << NUM_POS_BITS_MAX][1 << LEN_LOW_BITS];
+    lzma_prob mid[1 << NUM_POS_BITS_MAX][1 << LEN_MID_BITS];
+    lzma_prob high[1 << LEN_HIGH_BITS];
+};
+
+/* everything but the literal probabilities, their size depends on lc and lp */
+struct lzma_model
+{
+    lzma_prob is_match[NUM_STATES << NUM_POS_BITS_MAX];
+    lzma_prob is_rep[NUM_STATES];
+    lzma_prob is_rep_g0[NUM_STATES];
+    lzma_prob is_rep_g1[NUM_STATES];
+    lzma_prob is_rep_g2[NUM_STATES];
+    lzma_prob is_rep0_long[NUM_STATES << NUM_POS_BITS_MAX];
+    lzma_prob pos_slot[NUM_LEN_TO_POS_STATES][1 << 6];
+    lzma_prob pos_decoders[1 + NUM_FULL_DISTANCES - END_POS_MODEL_INDEX];
+    lzma_prob align[1 << NUM_ALIGN_BITS];
+    struct len_decoder len;
+    struct len_decoder rep_len;
+};
+
+static inline uint8_t
+next_byte(struct range_decoder *rc)
+{
+    if (rc->pos >= rc->size)
+    {
+        rc->corrupted = 1;
+        return 0;
+    }
+    return rc->src[rc->pos++];
+}
+
+static inline void
+normalize(struct range_decoder *rc)
+{
+    if (rc->range < TOP_VALUE)
+    {
+        rc->range <<= 8;
+        rc->code = (rc->code << 8) | next_byte(rc);
+    }
+}
+
+static inline uint32_t
+decode_bit(struct range_decoder *rc, lzma_prob *prob)
+{
+    uint32_t v = *prob;
+    uint32_t bound = (rc->range >> NUM_BIT_MODEL_TOTAL_BITS) * v;
+    uint32_t symbol = 0;
+    if (rc->code < bound)
+    {
+        v += (BIT_MODEL_TOTAL - v) >> NUM_MOVE_BITS;
+        rc->range = bound;
+    }
+    else
+    {
+        v -= v >> NUM_MOVE_BITS;
+        rc->code -= bound;
+        rc->range -= bound;
+        symbol = 1;
+    }
+    *prob = (lzma_prob)v;
+    normalize(rc);
+    return symbol;
+}
+
+static uint32_t
+decode_direct_bits(struct range_decoder *rc, unsigned bits)
+{
+    uint32_t result = 0;
+    do
+    {
+        rc->range >>= 1;
+        rc->code -= rc->range;
+        uint32_t t = 0 - (rc->code >> 31);
+        rc->code += rc->range & t;
+        if (rc->code == rc->range)
+        {
+            rc->corrupted = 1;
+        }
+        normalize(rc);
+        result = (result << 1) + (t + 1);
+    } while (--bits);
+    return result;
+}
+
+static uint32_t
+bit_tree_decode(struct range_decoder *rc, lzma_prob *probs, unsigned bits)
+{
+    uint32_t m = 1;
+    for (unsigned i = 0; i < bits; i++)
+    {
+        m = (m << 1) + decode_bit(rc, &probs[m]);
+    }
+    return m - (1U << bits);
+}
+
+static uint32_t
+bit_tree_reverse_decode(struct range_decoder *rc, lzma_prob *probs, unsigned bits)
+{
+    uint32_t m = 1;
+    uint32_t symbol = 0;
+    for (unsigned i = 0; i < bits; i++)
+    {
+        uint32_t bit = decode_bit(rc, &probs[m]);
+        m = (m << 1) + bit;
+        symbol |= bit << i;
+    }
+    return symbol;
+}
+
+static uint32_t
+decode_len(struct range_decoder *rc, struct len_decoder *len, uint32_t pos_state)
+{
+    if (decode_bit(rc, &len->choice) == 0)
+    {
+        return bit_tree_decode(rc, len->low[pos_state], LEN_LOW_BITS);
+    }
+    if (decode_bit(rc, &len->choice2) == 0)
+    {
+        return (1 << LEN_LOW_BITS) + bit_tree_decode(rc, len->mid[pos_state], LEN_MID_BITS);
+    }
+    return (1 << LEN_LOW_BITS) + (1 << LEN_MID_BITS) + bit_tree_decode(rc, len->high, LEN_HIGH_BITS);
+}
+
+static uint32_t
+decode_distance(struct range_decoder *rc, struct lzma_model *model, uint32_t len)
+{
+    uint32_t len_state = len < NUM_LEN_TO_POS_STATES - 1 ? len : NUM_LEN_TO_POS_STATES - 1;
+    uint32_t pos_slot = bit_tree_decode(rc, model->pos_slot[len_state], 6);
+    if (pos_slot < START_POS_MODEL_INDEX)
+    {
+        return pos_slot;
+    }
+    unsigned direct_bits = (unsigned)((pos_slot >> 1) - 1);
+    uint32_t distance = (2 | (pos_slot & 1)) << direct_bits;
+    if (pos_slot < END_POS_MODEL_INDEX)
+    {
+        return distance + bit_tree_reverse_decode(rc, model->pos_decoders + distance - pos_slot, direct_bits);
+    }
+    distance += decode_direct_bits(rc, direct_bits - NUM_ALIGN_BITS) << NUM_ALIGN_BITS;
+    return distance + bit_tree_reverse_decode(rc, model->align, NUM_ALIGN_BITS);
+}
+
+static void
+init_probs(lzma_prob *probs, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        probs[i] = BIT_MODEL_TOTAL >> 1;
+    }
+}
+
+/*
+ * the uncompressed size after the properties
+ * returns 0 on success
+ */
+int
+lzma_decompressed_size(const uint8_t *src, size_t src_size, uint32_t *out_size)
+{
+    if (src_size < LZMA_HEADER_SIZE)
+    {
+        return 1;
+    }
+    uint64_t size = 0;
+    for (int i = 7; i >= 0; i--)
+    {
+        size = (size << 8) | src[LZMA_PROPS_SIZE + i];
+    }
+    /* an unknown size means an end marker, EDK2 never writes those */
+    if (size > LZMA_MAX_OUTPUT_SIZE)
+    {
+        return 1;
+    }
+    *out_size = (uint32_t)size;
+    return 0;
+}
+
+/*
+ * decode src into dst, which must be lzma_decompressed_size bytes
+ * returns 0 on success
+ */
+int
+lzma_decompress(const uint8_t *src, size_t src_size, uint8_t *dst, uint32_t dst_size)
+{
+    uint32_t expected_size = 0;
+    if (lzma_decompressed_size(src, src_size, &expected_size) != 0 || expected_size != dst_size)
+    {
+        return 1;
+    }
+    unsigned properties = src[0];
+    if (properties >= 9 * 5 * 5)
+    {
+        return 1;
+    }
+    unsigned lc = properties % 9;
+    properties /= 9;
+    unsigned lp = properties % 5;
+    unsigned pb = properties / 5;
+    
+    size_t nr_literal_probs = (size_t)0x300 << (lc + lp);
+    lzma_prob *literal_probs = (lzma_prob*)malloc(nr_literal_probs * sizeof(lzma_prob));
+    struct lzma_model *model = (struct lzma_model*)malloc(sizeof(struct lzma_model));
+    if (literal_probs == NULL || model == NULL)
+    {
+        free(literal_probs);
+        free(model);
+        return 1;
+    }
+    init_probs(literal_probs, nr_literal_probs);
+    init_probs((lzma_prob*)model, sizeof(struct lzma_model) / sizeof(lzma_prob));
+    
+    struct range_decoder rc;
+    memset(&rc, 0, sizeof(struct range_decoder));
+    rc.src = src + LZMA_HEADER_SIZE;
+    rc.size = src_size - LZMA_HEADER_SIZE;
+    rc.range = 0xFFFFFFFF;
+    /* the first byte is always zero */
+    if (next_byte(&rc) != 0)
+    {
+        rc.corrupted = 1;
+    }
+    for (int i = 0; i < 4; i++)
+    {
+        rc.code = (rc.code << 8) | next_byte(&rc);
+    }
+    if (rc.code == rc.range)
+    {
+        rc.corrupted = 1;
+    }
+    
+    uint32_t pos_mask = (1U << pb) - 1;
+    uint32_t literal_pos_mask = (1U << lp) - 1;
+    uint32_t state = 0;
+    uint32_t rep0 = 0;
+    uint32_t rep1 = 0;
+    uint32_t rep2 = 0;
+    uint32_t rep3 = 0;
+    uint32_t out = 0;
+    while (out < dst_size && rc.corrupted == 0)
+    {
+        uint32_t pos_state = out & pos_mask;
+        if (decode_bit(&rc, &model->is_match[(state << NUM_POS_BITS_MAX) + pos_state]) == 0)
+        {
+            uint32_t previous = out > 0 ? dst[out - 1] : 0;
+            lzma_prob *probs = &literal_probs[0x300 * (((out & literal_pos_mask) << lc) + (previous >> (8 - lc)))];
+            uint32_t symbol = 1;
+            if (state >= 7)
+            {
+                if (rep0 >= out)
+                {
+                    break;
+                }
+                uint32_t match_byte = dst[out - rep0 - 1];
+                do
+                {
+                    uint32_t match_bit = (match_byte >> 7) & 1;
+                    match_byte <<= 1;
+                    uint32_t bit = decode_bit(&rc, &probs[((1 + match_bit) << 8) + symbol]);
+                    symbol = (symbol << 1) | bit;
+                    if (match_bit != bit)
+                    {
+                        break;
+                    }
+                } while (symbol < 0x100);
+            }
+            while (symbol < 0x100)
+            {
+                symbol = (symbol << 1) | decode_bit(&rc, &probs[symbol]);
+            }
+            dst[out++] = (uint8_t)(symbol - 0x100);
+            state = state < 4 ? 0 : state < 10 ? state - 3 : state - 6;
+            continue;
+        }
+        
+        uint32_t len = 0;
+        if (decode_bit(&rc, &model->is_rep[state]) != 0)
+        {
+            if (out == 0)
+            {
+                break;
+            }
+            if (decode_bit(&rc, &model->is_rep_g0[state]) == 0)
+            {
+                /* a single byte at rep0 */
+                if (decode_bit(&rc, &model->is_rep0_long[(state << NUM_POS_BITS_MAX) + pos_state]) == 0)
+                {
+                    state = state < 7 ? 9 : 11;
+                    dst[out] = dst[out - rep0 - 1];
+                    out++;
+                    continue;
+                }
+            }
+            else
+            {
+                uint32_t distance = 0;
+                if (decode_bit(&rc, &model->is_rep_g1[state]) == 0)
+                {
+                    distance = rep1;
+                }
+                else
+                {
+                    if (decode_bit(&rc, &model->is_rep_g2[state]) == 0)
+                    {
+                        distance = rep2;
+                    }
+                    else
+                    {
+                        distance = rep3;
+                        rep3 = rep2;
+                    }
+                    rep2 = rep1;
+                }
+                rep1 = rep0;
+                rep0 = distance;
+            }
+            len = decode_len(&rc, &model->rep_len, pos_state);
+            state = state < 7 ? 8 : 11;
+        }
+        else
+        {
+            rep3 = rep2;
+            rep2 = rep1;
+            rep1 = rep0;
+            len = decode_len(&rc, &model->len, pos_state);
+            state = state < 7 ? 7 : 10;
+            rep0 = decode_distance(&rc, model, len);
+            /* the end marker, before all the output is there */
+            if (rep0 == 0xFFFFFFFF)
+            {
+                break;
+            }
+        }
+        if (rep0 >= out)
+        {
+            break;
+        }
+        len += MATCH_MIN_LEN;
+        uint32_t from = out - rep0 - 1;
+        while (len-- > 0 && out < dst_size)
+        {
+            dst[out++] = dst[from++];
+        }
+    }
+    free(literal_probs);
+    free(model);
+    return out == dst_size && rc.corrupted == 0 ? 0 : 1;
+}
+
+#define TEST_86_MS_BYTE(b)  ((b) == 0 || (b) == 0xFF)
+
+static const uint8_t g_mask_to_allowed_status[8] = { 1, 1, 1, 0, 1, 0, 0, 0 };
+static const uint8_t g_mask_to_bit_number[8] = { 0, 1, 2, 2, 3, 3, 3, 3 };
+
+/*
+ * undo the x86 filter, relative CALL and JMP targets were made absolute
+ * before compression so they compress better
+ * same conversion as the LZMA SDK Bra86.c that EDK2 uses
+ */
+void
+x86_filter_decode(uint8_t *data, size_t size)
+{
+    if (size < 5)
+    {
+        return;
+    }
+    uint32_t ip = 5;
+    uint32_t previous_mask = 0;
+    size_t position = 0;
+    size_t previous_position = (size_t)0 - 1;
+    for (;;)
+    {
+        uint8_t *p = data + position;
+        const uint8_t *limit = data + size - 4;
+        while (p < limit && (*p & 0xFE) != 0xE8)
+        {
+            p++;
+        }
+        position = (size_t)(p - data);
+        if (p >= limit)
+        {
+            return;
+        }
+        size_t distance = position - previous_position;
+        if (distance > 3)
+        {
+            previous_mask = 0;
+        }
+        else
+        {
+            previous_mask = (previous_mask << ((int)distance - 1)) & 0x7;
+            if (previous_mask != 0)
+            {
+                uint8_t b = p[4 - g_mask_to_bit_number[previous_mask]];
+                if (!g_mask_to_allowed_status[previous_mask] || TEST_86_MS_BYTE(b))
+                {
+                    previous_position = position;
+                    previous_mask = ((previous_mask << 1) & 0x7) | 1;
+                    position++;
+                    continue;
+                }
+            }
+        }
+        previous_position = position;
+        
+        if (!TEST_86_MS_BYTE(p[4]))
+        {
+            previous_mask = ((previous_mask << 1) & 0x7) | 1;
+            position++;
+            continue;
+        }
+        uint32_t source = (uint32_t)p[4] << 24 | (uint32_t)p[3] << 16 | (uint32_t)p[2] << 8 | (uint32_t)p[1];
+        uint32_t destination = 0;
+        for (;;)
+        {
+            destination = source - (ip + (uint32_t)position);
+            if (previous_mask == 0)
+            {
+                break;
+            }
+            unsigned index = g_mask_to_bit_number[previous_mask] * 8;
+            if (!TEST_86_MS_BYTE((uint8_t)(destination >> (24 - index))))
+            {
+                break;
+            }
+            source = destination ^ ((1U << (32 - index)) - 1);
+        }
+        p[4] = (uint8_t)~(((destination >> 24) & 1) - 1);
+        p[3] = (uint8_t)(destination >> 16);
+        p[2] = (uint8_t)(destination >> 8);
+        p[1] = (uint8_t)destination;
+        position += 5;
+    }
+}
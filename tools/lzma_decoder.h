@@ -0,0 +1,55 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * lzma_decoder.h
+ *
+ */
+
+#ifndef efi_swiss_knife_lzma_decoder_h
+#define efi_swiss_knife_lzma_decoder_h
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * LZMA decoder for the LZMA custom GUID defined sections
+ * the data is in the .lzma format: 5 bytes of properties, the 64 bits
+ * uncompressed size and the stream. EDK2 always stores the size so the
+ * whole output is decoded into one buffer, which is also the dictionary
+ * the x86 filter reverses the call and jump conversion of the LZMAF86 sections
+ */
+
+int lzma_decompressed_size(const uint8_t *src, size_t src_size, uint32_t *out_size);
+int lzma_decompress(const uint8_t *src, size_t src_size, uint8_t *dst, uint32_t dst_size);
+void x86_filter_decode(uint8_t *data, size_t size);
+
+#endif /* lzma_decoder_h */
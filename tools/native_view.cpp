@@ -0,0 +1,1130 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * native_view.cpp
+ *
+ */
+
+#include "native_view.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "../insn_cache.h"
+#include "../logging.h"
+#include "pe_loader.h"
+#include "x86_decoder.h"
+
+/* per byte state of the image */
+enum byte_state
+{
+    kByteUnknown = 0,
+    kByteHead,
+    kByteTail,
+    /* decoded by a function we aren't sure about yet */
+    kBytePendingHead,
+    kBytePendingTail
+};
+
+struct native_ref
+{
+    ea_t to;
+    ea_t from;
+};
+
+struct native_note
+{
+    ea_t address;
+    char *text;
+};
+
+struct note_list
+{
+    struct native_note *notes;
+    size_t count;
+    size_t capacity;
+};
+
+/* functions waiting to be explored */
+struct function_start
+{
+    ea_t address;
+    /* only keep it if every path decodes cleanly */
+    int strict;
+};
+
+struct native_view
+{
+    char *path;
+    char *module_guid;
+    struct pe_image pe;
+    uint8_t *bytes;
+    struct binary_segment *segments;
+    size_t nr_segments;
+    struct binary_function *functions;
+    size_t nr_functions;
+    size_t functions_capacity;
+    struct native_ref *refs;
+    size_t nr_refs;
+    size_t refs_capacity;
+    struct note_list names;
+    struct note_list comments;
+};
+
+static struct native_view g_native;
+
+/* the state of one function exploration, thrown away if it fails */
+struct exploration
+{
+    ea_t *worklist;
+    size_t worklist_count;
+    size_t worklist_capacity;
+    ea_t *heads;
+    size_t heads_count;
+    size_t heads_capacity;
+    struct native_ref *refs;
+    size_t refs_count;
+    size_t refs_capacity;
+    struct function_start *calls;
+    size_t calls_count;
+    size_t calls_capacity;
+};
+
+#pragma mark -
+#pragma mark Helpers
+#pragma mark -
+
+/*
+ * make room for one more item
+ * returns the array, which may have moved, or NULL if out of memory
+ */
+static void *
+grow_array(void *array, size_t count, size_t *capacity, size_t item_size)
+{
+    if (count < *capacity)
+    {
+        return array;
+    }
+    size_t new_capacity = *capacity ? *capacity * 2 : 64;
+    void *new_array = realloc(array, new_capacity * item_size);
+    if (new_array == NULL)
+    {
+        ERROR_MSG("Can't allocate memory for the native view.");
+        return NULL;
+    }
+    *capacity = new_capacity;
+    return new_array;
+}
+
+static inline int
+in_image(ea_t address)
+{
+    return address >= g_native.pe.image_base && address - g_native.pe.image_base < g_native.pe.image_size;
+}
+
+static inline uint8_t
+byte_state(ea_t address)
+{
+    return g_native.bytes[address - g_native.pe.image_base];
+}
+
+static int
+in_code_section(ea_t address)
+{
+    if (!in_image(address))
+    {
+        return 0;
+    }
+    uint32_t rva = (uint32_t)(address - g_native.pe.image_base);
+    for (uint16_t i = 0; i < g_native.pe.nr_sections; i++)
+    {
+        const struct pe_section *section = &g_native.pe.sections[i];
+        if (rva >= section->virtual_address && rva - section->virtual_address < section->virtual_size)
+        {
+            return (section->characteristics & (EFI_IMAGE_SCN_CNT_CODE | EFI_IMAGE_SCN_MEM_EXECUTE)) != 0;
+        }
+    }
+    return 0;
+}
+
+/*
+ * copy bytes out of the mapping, the zero filled ends of sections included
+ * returns how many bytes were copied before an unmapped address
+ */
+static size_t
+copy_image_bytes(ea_t address, uint8_t *buffer, size_t size)
+{
+    size_t copied = 0;
+    while (copied < size && in_image(address + copied))
+    {
+        size_t available = 0;
+        const uint8_t *span = pe_image_span(&g_native.pe, (uint32_t)(address + copied - g_native.pe.image_base), &available);
+        if (available == 0)
+        {
+            break;
+        }
+        size_t chunk = available < size - copied ? available : size - copied;
+        if (span != NULL)
+        {
+            memcpy(buffer + copied, span, chunk);
+        }
+        else
+        {
+            memset(buffer + copied, 0, chunk);
+        }
+        copied += chunk;
+    }
+    return copied;
+}
+
+/*
+ * decode straight from the mapping, only instructions running past the end of
+ * a span are decoded from a copy
+ */
+static int
+decode_at(ea_t address, struct cached_insn *out)
+{
+    if (!in_image(address))
+    {
+        return 0;
+    }
+    size_t available = 0;
+    const uint8_t *code = pe_image_span(&g_native.pe, (uint32_t)(address - g_native.pe.image_base), &available);
+    if (code != NULL && available >= X86_MAX_INSN_SIZE)
+    {
+        return decode_x86_insn(code, available, address, g_native.pe.is_64bit, out);
+    }
+    uint8_t buffer[X86_MAX_INSN_SIZE];
+    size_t size = copy_image_bytes(address, buffer, sizeof(buffer));
+    return decode_x86_insn(buffer, size, address, g_native.pe.is_64bit, out);
+}
+
+static int
+compare_refs(const void *a, const void *b)
+{
+    const struct native_ref *ra = (const struct native_ref*)a;
+    const struct native_ref *rb = (const struct native_ref*)b;
+    if (ra->to != rb->to)
+    {
+        return ra->to < rb->to ? -1 : 1;
+    }
+    if (ra->from != rb->from)
+    {
+        return ra->from < rb->from ? -1 : 1;
+    }
+    return 0;
+}
+
+static int
+compare_functions(const void *a, const void *b)
+{
+    const struct binary_function *fa = (const struct binary_function*)a;
+    const struct binary_function *fb = (const struct binary_function*)b;
+    if (fa->start != fb->start)
+    {
+        return fa->start < fb->start ? -1 : 1;
+    }
+    return 0;
+}
+
+#pragma mark -
+#pragma mark Names and comments
+#pragma mark -
+
+/* index of the first note at or after address */
+static size_t
+find_note(const struct note_list *list, ea_t address)
+{
+    size_t low = 0;
+    size_t high = list->count;
+    while (low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+        if (list->notes[middle].address < address)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+static const char *
+get_note(const struct note_list *list, ea_t address)
+{
+    size_t index = find_note(list, address);
+    if (index < list->count && list->notes[index].address == address)
+    {
+        return list->notes[index].text;
+    }
+    return NULL;
+}
+
+static void
+set_note(struct note_list *list, ea_t address, const char *text)
+{
+    char *copy = strdup(text);
+    if (copy == NULL)
+    {
+        return;
+    }
+    size_t index = find_note(list, address);
+    if (index < list->count && list->notes[index].address == address)
+    {
+        free(list->notes[index].text);
+        list->notes[index].text = copy;
+        return;
+    }
+    struct native_note *notes = (struct native_note*)grow_array(list->notes, list->count, &list->capacity, sizeof(struct native_note));
+    if (notes == NULL)
+    {
+        free(copy);
+        return;
+    }
+    list->notes = notes;
+    memmove(&list->notes[index + 1], &list->notes[index], (list->count - index) * sizeof(struct native_note));
+    list->notes[index].address = address;
+    list->notes[index].text = copy;
+    list->count++;
+}
+
+static void
+free_notes(struct note_list *list)
+{
+    for (size_t i = 0; i < list->count; i++)
+    {
+        free(list->notes[i].text);
+    }
+    free(list->notes);
+    memset(list, 0, sizeof(struct note_list));
+}
+
+#pragma mark -
+#pragma mark Function discovery
+#pragma mark -
+
+static void
+free_exploration(struct exploration *e)
+{
+    free(e->worklist);
+    free(e->heads);
+    free(e->refs);
+    free(e->calls);
+    memset(e, 0, sizeof(struct exploration));
+}
+
+static int
+push_address(struct exploration *e, ea_t address)
+{
+    ea_t *worklist = (ea_t*)grow_array(e->worklist, e->worklist_count, &e->worklist_capacity, sizeof(ea_t));
+    if (worklist == NULL)
+    {
+        return 1;
+    }
+    e->worklist = worklist;
+    e->worklist[e->worklist_count++] = address;
+    return 0;
+}
+
+static int
+add_function_start(struct exploration *e, ea_t address, int strict)
+{
+    struct function_start *calls = (struct function_start*)grow_array(e->calls, e->calls_count, &e->calls_capacity, sizeof(struct function_start));
+    if (calls == NULL)
+    {
+        return 1;
+    }
+    e->calls = calls;
+    e->calls[e->calls_count].address = address;
+    e->calls[e->calls_count].strict = strict;
+    e->calls_count++;
+    return 0;
+}
+
+/*
+ * record the instruction's heads, memory references and function starts
+ * returns 0 on success
+ */
+static int
+record_insn(struct exploration *e, const struct cached_insn *insn, int strict)
+{
+    ea_t *heads = (ea_t*)grow_array(e->heads, e->heads_count, &e->heads_capacity, sizeof(ea_t));
+    if (heads == NULL)
+    {
+        return 1;
+    }
+    e->heads = heads;
+    e->heads[e->heads_count++] = insn->ea;
+    uint8_t *state = &g_native.bytes[insn->ea - g_native.pe.image_base];
+    state[0] = kBytePendingHead;
+    memset(state + 1, kBytePendingTail, insn->size - 1);
+    
+    for (int i = 0; i < 2; i++)
+    {
+        const struct insn_operand *op = &insn->ops[i];
+        if (op->type == kOpMem && in_image(op->addr))
+        {
+            struct native_ref *refs = (struct native_ref*)grow_array(e->refs, e->refs_count, &e->refs_capacity, sizeof(struct native_ref));
+            if (refs == NULL)
+            {
+                return 1;
+            }
+            e->refs = refs;
+            e->refs[e->refs_count].to = op->addr;
+            e->refs[e->refs_count].from = insn->ea;
+            e->refs_count++;
+        }
+        /*
+         * code addresses taken by lea, or pushed as immediates on IA32, might
+         * be callbacks. if the image has relocations an immediate is only an
+         * address if there's a fixup for it
+         */
+        ea_t pointer = BADADDR;
+        if (insn->kind == kInsnLea && op->type == kOpMem)
+        {
+            pointer = op->addr;
+        }
+        else if (op->type == kOpImm && (g_native.pe.nr_relocations == 0 ||
+                                        has_pe_relocation(&g_native.pe, (uint32_t)(insn->ea - g_native.pe.image_base),
+                                                          (uint32_t)(insn->ea - g_native.pe.image_base + insn->size))))
+        {
+            pointer = (ea_t)op->value;
+        }
+        if (pointer != BADADDR && in_code_section(pointer) && add_function_start(e, pointer, 1) != 0)
+        {
+            return 1;
+        }
+    }
+    /* direct calls are sure to be functions */
+    if (insn->kind == kInsnCall && insn->ops[0].type == kOpNear && in_code_section(insn->ops[0].addr))
+    {
+        return add_function_start(e, insn->ops[0].addr, strict);
+    }
+    return 0;
+}
+
+/*
+ * follow every path from start until it stops or reaches code already seen
+ * strict explorations fail on anything that doesn't look like code
+ * returns 0 if the function is good, *end is the end of the furthest instruction
+ */
+static int
+explore_paths(struct exploration *e, ea_t start, int strict, ea_t *end)
+{
+    *end = start;
+    if (push_address(e, start) != 0)
+    {
+        return 1;
+    }
+    while (e->worklist_count > 0)
+    {
+        ea_t current = e->worklist[--e->worklist_count];
+        for (;;)
+        {
+            if (!in_code_section(current))
+            {
+                if (strict)
+                {
+                    return 1;
+                }
+                break;
+            }
+            uint8_t state = byte_state(current);
+            if (state == kByteHead || state == kBytePendingHead)
+            {
+                break;
+            }
+            if (state == kByteTail || state == kBytePendingTail)
+            {
+                /* jump into the middle of an instruction */
+                if (strict)
+                {
+                    return 1;
+                }
+                break;
+            }
+            size_t offset = current - g_native.pe.image_base;
+            struct cached_insn insn;
+            if (decode_at(current, &insn) == 0)
+            {
+                if (strict)
+                {
+                    return 1;
+                }
+                break;
+            }
+            /* an instruction overlapping one we have already seen */
+            int overlaps = 0;
+            for (size_t i = 1; i < insn.size; i++)
+            {
+                if (g_native.bytes[offset + i] != kByteUnknown)
+                {
+                    overlaps = 1;
+                    break;
+                }
+            }
+            if (overlaps)
+            {
+                if (strict)
+                {
+                    return 1;
+                }
+                break;
+            }
+            if (record_insn(e, &insn, strict) != 0)
+            {
+                return 1;
+            }
+            if (current + insn.size > *end)
+            {
+                *end = current + insn.size;
+            }
+            if ((insn.kind == kInsnJcc || insn.kind == kInsnJmp) && insn.ops[0].type == kOpNear)
+            {
+                if (push_address(e, insn.ops[0].addr) != 0)
+                {
+                    return 1;
+                }
+            }
+            if (insn.flags & INSN_STOPS_FLOW)
+            {
+                break;
+            }
+            current += insn.size;
+        }
+    }
+    return 0;
+}
+
+static int
+add_function(ea_t start, ea_t end)
+{
+    struct binary_function *functions = (struct binary_function*)grow_array(g_native.functions, g_native.nr_functions,
+                                                                            &g_native.functions_capacity, sizeof(struct binary_function));
+    if (functions == NULL)
+    {
+        return 1;
+    }
+    g_native.functions = functions;
+    g_native.functions[g_native.nr_functions].start = start;
+    g_native.functions[g_native.nr_functions].end = end;
+    g_native.nr_functions++;
+    return 0;
+}
+
+static int
+queue_function(ea_t address, int strict, struct function_start **queue, size_t *queue_count, size_t *queue_capacity)
+{
+    struct function_start *new_queue = (struct function_start*)grow_array(*queue, *queue_count, queue_capacity, sizeof(struct function_start));
+    if (new_queue == NULL)
+    {
+        return 1;
+    }
+    *queue = new_queue;
+    (*queue)[*queue_count].address = address;
+    (*queue)[*queue_count].strict = strict;
+    (*queue_count)++;
+    return 0;
+}
+
+/*
+ * explore one function and keep or roll back what it decoded
+ * new function starts found in it are appended to the queue
+ */
+static int
+explore_function(const struct function_start *function, struct function_start **queue, size_t *queue_count, size_t *queue_capacity)
+{
+    struct exploration e;
+    memset(&e, 0, sizeof(struct exploration));
+    ea_t end = function->address;
+    int failed = explore_paths(&e, function->address, function->strict, &end);
+    
+    for (size_t i = 0; i < e.heads_count; i++)
+    {
+        size_t offset = e.heads[i] - g_native.pe.image_base;
+        g_native.bytes[offset++] = failed ? kByteUnknown : kByteHead;
+        while (offset < g_native.pe.image_size && g_native.bytes[offset] == kBytePendingTail)
+        {
+            g_native.bytes[offset++] = failed ? kByteUnknown : kByteTail;
+        }
+    }
+    if (failed || e.heads_count == 0)
+    {
+        free_exploration(&e);
+        return 0;
+    }
+    
+    int ret = add_function(function->address, end);
+    if (ret == 0 && e.refs_count > 0)
+    {
+        size_t needed = g_native.nr_refs + e.refs_count;
+        if (needed > g_native.refs_capacity)
+        {
+            size_t new_capacity = needed * 2;
+            struct native_ref *refs = (struct native_ref*)realloc(g_native.refs, new_capacity * sizeof(struct native_ref));
+            if (refs == NULL)
+            {
+                ERROR_MSG("Can't allocate memory for the native view.");
+                ret = 1;
+            }
+            else
+            {
+                g_native.refs = refs;
+                g_native.refs_capacity = new_capacity;
+            }
+        }
+        if (ret == 0)
+        {
+            memcpy(&g_native.refs[g_native.nr_refs], e.refs, e.refs_count * sizeof(struct native_ref));
+            g_native.nr_refs += e.refs_count;
+        }
+    }
+    for (size_t i = 0; ret == 0 && i < e.calls_count; i++)
+    {
+        if (byte_state(e.calls[i].address) != kByteUnknown)
+        {
+            continue;
+        }
+        ret = queue_function(e.calls[i].address, e.calls[i].strict, queue, queue_count, queue_capacity);
+    }
+    free_exploration(&e);
+    return ret;
+}
+
+/*
+ * code pointers in the data fixups, protocol interfaces and callbacks tables
+ * fixups inside the code are instruction immediates, explore_paths sees those
+ */
+static int
+queue_relocated_pointers(struct function_start **queue, size_t *queue_count, size_t *queue_capacity)
+{
+    for (size_t i = 0; i < g_native.pe.nr_relocations; i++)
+    {
+        const struct pe_relocation *relocation = &g_native.pe.relocations[i];
+        ea_t location = g_native.pe.image_base + relocation->rva;
+        if (in_code_section(location))
+        {
+            continue;
+        }
+        uint64_t pointer = 0;
+        size_t pointer_size = relocation->type == EFI_IMAGE_REL_BASED_DIR64 ? 8 : 4;
+        if (copy_image_bytes(location, (uint8_t*)&pointer, pointer_size) != pointer_size || !in_code_section(pointer) ||
+            byte_state(pointer) != kByteUnknown)
+        {
+            continue;
+        }
+        if (queue_function(pointer, 1, queue, queue_count, queue_capacity) != 0)
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/*
+ * recursive descent from the entry point, direct call targets are always
+ * functions, code addresses taken by lea, immediates or data fixups are only
+ * kept if they decode cleanly
+ */
+static int
+discover_functions(void)
+{
+    struct function_start *queue = NULL;
+    size_t queue_count = 0;
+    size_t queue_capacity = 0;
+    if (queue_function(g_native.pe.image_base + g_native.pe.entry_point, 0, &queue, &queue_count, &queue_capacity) != 0)
+    {
+        return 1;
+    }
+    
+    /*
+     * breadth first so the sure functions go before the guesses they point to,
+     * the data pointers are only tried once everything reachable is explored
+     */
+    size_t next = 0;
+    int ret = 0;
+    int relocations_queued = 0;
+    while (ret == 0)
+    {
+        if (next == queue_count)
+        {
+            if (relocations_queued)
+            {
+                break;
+            }
+            relocations_queued = 1;
+            ret = queue_relocated_pointers(&queue, &queue_count, &queue_capacity);
+            continue;
+        }
+        struct function_start function = queue[next++];
+        if (!in_code_section(function.address) || byte_state(function.address) != kByteUnknown)
+        {
+            continue;
+        }
+        ret = explore_function(&function, &queue, &queue_count, &queue_capacity);
+    }
+    free(queue);
+    if (ret != 0)
+    {
+        return ret;
+    }
+    
+    /* a function ends where the next one starts, shared tails belong to the first */
+    if (g_native.nr_functions > 0)
+    {
+        qsort(g_native.functions, g_native.nr_functions, sizeof(struct binary_function), compare_functions);
+    }
+    for (size_t i = 0; i + 1 < g_native.nr_functions; i++)
+    {
+        if (g_native.functions[i].end > g_native.functions[i + 1].start)
+        {
+            g_native.functions[i].end = g_native.functions[i + 1].start;
+        }
+    }
+    if (g_native.nr_refs > 0)
+    {
+        qsort(g_native.refs, g_native.nr_refs, sizeof(struct native_ref), compare_refs);
+    }
+    return 0;
+}
+
+#pragma mark -
+#pragma mark Binary view backend
+#pragma mark -
+
+static const char *
+native_input_path(void)
+{
+    return g_native.path;
+}
+
+static const char *
+native_module_guid(void)
+{
+    return g_native.module_guid;
+}
+
+static int
+native_is_64bit(void)
+{
+    return g_native.pe.is_64bit;
+}
+
+static size_t
+native_segment_count(void)
+{
+    return g_native.nr_segments;
+}
+
+static int
+native_segment_at(size_t index, struct binary_segment *out)
+{
+    if (index >= g_native.nr_segments)
+    {
+        return 1;
+    }
+    *out = g_native.segments[index];
+    return 0;
+}
+
+static int
+native_segment_by_name(const char *name, struct binary_segment *out)
+{
+    for (size_t i = 0; i < g_native.nr_segments; i++)
+    {
+        if (strcmp(g_native.segments[i].name, name) == 0)
+        {
+            *out = g_native.segments[i];
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int
+native_read_bytes(ea_t address, void *buffer, size_t size)
+{
+    if (!in_image(address) || size > g_native.pe.image_size - (address - g_native.pe.image_base))
+    {
+        return 1;
+    }
+    return copy_image_bytes(address, (uint8_t*)buffer, size) == size ? 0 : 1;
+}
+
+static const uint8_t *
+native_map_bytes(ea_t address, size_t size)
+{
+    if (!in_image(address))
+    {
+        return NULL;
+    }
+    size_t available = 0;
+    const uint8_t *span = pe_image_span(&g_native.pe, (uint32_t)(address - g_native.pe.image_base), &available);
+    return span != NULL && available >= size ? span : NULL;
+}
+
+static int
+native_is_code(ea_t address)
+{
+    return in_image(address) && byte_state(address) == kByteHead;
+}
+
+static ea_t
+native_next_code(ea_t address)
+{
+    if (address < g_native.pe.image_base)
+    {
+        address = g_native.pe.image_base;
+    }
+    else
+    {
+        address++;
+    }
+    for (; in_image(address); address++)
+    {
+        if (byte_state(address) == kByteHead)
+        {
+            return address;
+        }
+    }
+    return BADADDR;
+}
+
+static ea_t
+native_prev_code(ea_t address)
+{
+    if (address == BADADDR || address <= g_native.pe.image_base)
+    {
+        return BADADDR;
+    }
+    ea_t last = g_native.pe.image_base + g_native.pe.image_size;
+    for (address = address > last ? last - 1 : address - 1; ; address--)
+    {
+        if (byte_state(address) == kByteHead)
+        {
+            return address;
+        }
+        if (address == g_native.pe.image_base)
+        {
+            return BADADDR;
+        }
+    }
+}
+
+static int
+native_decode_insn(ea_t address, struct cached_insn *out)
+{
+    return decode_at(address, out);
+}
+
+static size_t
+native_function_count(void)
+{
+    return g_native.nr_functions;
+}
+
+static int
+native_function_at(size_t index, struct binary_function *out)
+{
+    if (index >= g_native.nr_functions)
+    {
+        return 1;
+    }
+    *out = g_native.functions[index];
+    return 0;
+}
+
+static int
+native_function_containing(ea_t address, struct binary_function *out)
+{
+    /* last function starting at or before address */
+    size_t low = 0;
+    size_t high = g_native.nr_functions;
+    while (low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+        if (g_native.functions[middle].start <= address)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    if (low == 0 || address >= g_native.functions[low - 1].end)
+    {
+        return 1;
+    }
+    *out = g_native.functions[low - 1];
+    return 0;
+}
+
+/* index of the first reference after (to, from) */
+static size_t
+find_ref_after(ea_t to, ea_t from)
+{
+    size_t low = 0;
+    size_t high = g_native.nr_refs;
+    while (low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+        const struct native_ref *ref = &g_native.refs[middle];
+        if (ref->to < to || (ref->to == to && ref->from <= from))
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+static ea_t
+native_next_ref_to(ea_t address, ea_t current)
+{
+    size_t index = find_ref_after(address, current);
+    if (index < g_native.nr_refs && g_native.refs[index].to == address)
+    {
+        return g_native.refs[index].from;
+    }
+    return BADADDR;
+}
+
+static ea_t
+native_first_ref_to(ea_t address)
+{
+    if (address == 0)
+    {
+        return BADADDR;
+    }
+    /* everything referencing address comes after (address - 1, BADADDR) */
+    size_t index = find_ref_after(address - 1, BADADDR);
+    if (index < g_native.nr_refs && g_native.refs[index].to == address)
+    {
+        return g_native.refs[index].from;
+    }
+    return BADADDR;
+}
+
+static int
+native_get_name(ea_t address, char *buffer, size_t size)
+{
+    const char *name = get_note(&g_native.names, address);
+    if (name != NULL)
+    {
+        strlcpy(buffer, name, size);
+        return 0;
+    }
+    struct binary_function f;
+    if (native_function_containing(address, &f) == 0 && f.start == address)
+    {
+        snprintf(buffer, size, "sub_%llX", (unsigned long long)address);
+        return 0;
+    }
+    return 1;
+}
+
+static void
+native_set_name(ea_t address, const char *name)
+{
+    set_note(&g_native.names, address, name);
+}
+
+static void
+native_set_comment(ea_t address, const char *comment)
+{
+    set_note(&g_native.comments, address, comment);
+}
+
+static const struct binary_view g_native_view =
+{
+    .name = "native",
+    .input_path = native_input_path,
+    .module_guid = native_module_guid,
+    .is_64bit = native_is_64bit,
+    .segment_count = native_segment_count,
+    .segment_at = native_segment_at,
+    .segment_by_name = native_segment_by_name,
+    .read_bytes = native_read_bytes,
+    .map_bytes = native_map_bytes,
+    .is_code = native_is_code,
+    .next_code = native_next_code,
+    .prev_code = native_prev_code,
+    .decode_insn = native_decode_insn,
+    .function_count = native_function_count,
+    .function_at = native_function_at,
+    .function_containing = native_function_containing,
+    .first_ref_to = native_first_ref_to,
+    .next_ref_to = native_next_ref_to,
+    .get_name = native_get_name,
+    .set_name = native_set_name,
+    .set_comment = native_set_comment
+};
+
+const struct binary_view *g_binary_view = &g_native_view;
+
+#pragma mark -
+#pragma mark Exported functions
+#pragma mark -
+
+/*
+ * segments like IDA creates them for a PE, the headers and one per section
+ */
+static int
+build_segments(void)
+{
+    g_native.segments = (struct binary_segment*)calloc(g_native.pe.nr_sections + 1, sizeof(struct binary_segment));
+    if (g_native.segments == NULL)
+    {
+        ERROR_MSG("Can't allocate memory for the segments.");
+        return 1;
+    }
+    if (g_native.pe.headers_size > 0)
+    {
+        struct binary_segment *segment = &g_native.segments[g_native.nr_segments++];
+        segment->start = g_native.pe.image_base + g_native.pe.headers_rva;
+        segment->end = segment->start + g_native.pe.headers_size;
+        strlcpy(segment->name, "HEADER", sizeof(segment->name));
+    }
+    for (uint16_t i = 0; i < g_native.pe.nr_sections; i++)
+    {
+        const struct pe_section *section = &g_native.pe.sections[i];
+        struct binary_segment *segment = &g_native.segments[g_native.nr_segments++];
+        segment->start = g_native.pe.image_base + section->virtual_address;
+        segment->end = segment->start + section->virtual_size;
+        strlcpy(segment->name, section->name, sizeof(segment->name));
+    }
+    return 0;
+}
+
+/*
+ * everything after the image is loaded
+ * returns 0 on success
+ */
+static int
+build_native_view(void)
+{
+    g_native.bytes = (uint8_t*)calloc(1, g_native.pe.image_size);
+    if (g_native.bytes == NULL || build_segments() != 0 || discover_functions() != 0)
+    {
+        close_native_view();
+        return 1;
+    }
+    set_note(&g_native.names, g_native.pe.image_base + g_native.pe.entry_point, "_ModuleEntryPoint");
+    DEBUG_MSG("Loaded %s%s%s: %s image at 0x%llx, %lu segments, %lu functions, %lu references.", g_native.path,
+              g_native.module_guid ? ":" : "", g_native.module_guid ? g_native.module_guid : "",
+              g_native.pe.is_64bit ? "x64" : "IA32", (unsigned long long)g_native.pe.image_base,
+              (unsigned long)g_native.nr_segments, (unsigned long)g_native.nr_functions, (unsigned long)g_native.nr_refs);
+    return 0;
+}
+
+/*
+ * load path and make it the current binary view
+ * returns 0 on success
+ */
+int
+open_native_view(const char *path)
+{
+    memset(&g_native, 0, sizeof(struct native_view));
+    g_native.path = strdup(path);
+    if (g_native.path == NULL || load_pe_image(path, &g_native.pe) != 0)
+    {
+        close_native_view();
+        return 1;
+    }
+    return build_native_view();
+}
+
+/*
+ * make an image already in memory the current binary view, data must stay
+ * mapped until close_native_view
+ * path is the file the image came from and module_guid its FFS file GUID, if any
+ * returns 0 on success
+ */
+int
+open_native_view_buffer(const char *path, const char *module_guid, const uint8_t *data, size_t size)
+{
+    memset(&g_native, 0, sizeof(struct native_view));
+    g_native.path = strdup(path);
+    g_native.module_guid = module_guid ? strdup(module_guid) : NULL;
+    if (g_native.path == NULL || (module_guid != NULL && g_native.module_guid == NULL) ||
+        load_pe_buffer(data, size, &g_native.pe) != 0)
+    {
+        close_native_view();
+        return 1;
+    }
+    return build_native_view();
+}
+
+void
+close_native_view(void)
+{
+    free(g_native.path);
+    free(g_native.module_guid);
+    free_pe_image(&g_native.pe);
+    free(g_native.bytes);
+    free(g_native.segments);
+    free(g_native.functions);
+    free(g_native.refs);
+    free_notes(&g_native.names);
+    free_notes(&g_native.comments);
+    memset(&g_native, 0, sizeof(struct native_view));
+}
+
+/*
+ * what the analysis would have left in the IDA database
+ */
+void
+print_native_annotations(void)
+{
+    size_t n = 0;
+    size_t c = 0;
+    while (n < g_native.names.count || c < g_native.comments.count)
+    {
+        if (c == g_native.comments.count || (n < g_native.names.count && g_native.names.notes[n].address <= g_native.comments.notes[c].address))
+        {
+            msg("0x%llx name    %s\n", (unsigned long long)g_native.names.notes[n].address, g_native.names.notes[n].text);
+            n++;
+        }
+        else
+        {
+            msg("0x%llx comment %s\n", (unsigned long long)g_native.comments.notes[c].address, g_native.comments.notes[c].text);
+            c++;
+        }
+    }
+}
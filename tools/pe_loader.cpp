@@ -0,0 +1,530 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * pe_loader.cpp
+ *
+ */
+
+#include "pe_loader.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+
+#include "../logging.h"
+
+/* file and optional header offsets we care about */
+#define DOS_LFANEW_OFFSET           0x3C
+#define PE_FILE_HEADER_SIZE         20
+#define PE_SECTION_HEADER_SIZE      40
+#define PE_RELOC_BLOCK_HEADER_SIZE  8
+#define OPT_ENTRY_POINT_OFFSET      16
+#define OPT_IMAGE_BASE32_OFFSET     28
+#define OPT_IMAGE_BASE64_OFFSET     24
+#define OPT_IMAGE_SIZE_OFFSET       56
+#define OPT_HEADERS_SIZE_OFFSET     60
+#define OPT_NR_DIRECTORIES32_OFFSET 92
+#define OPT_NR_DIRECTORIES64_OFFSET 108
+
+/* anything bigger than this isn't a module */
+#define PE_MAX_IMAGE_SIZE           (256 * 1024 * 1024)
+
+static inline uint16_t
+read16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | p[1] << 8);
+}
+
+static inline uint32_t
+read32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | (uint32_t)p[1] << 8 | (uint32_t)p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static inline uint64_t
+read64(const uint8_t *p)
+{
+    return (uint64_t)read32(p) | (uint64_t)read32(p + 4) << 32;
+}
+
+static int
+compare_relocations(const void *a, const void *b)
+{
+    uint32_t ra = ((const struct pe_relocation*)a)->rva;
+    uint32_t rb = ((const struct pe_relocation*)b)->rva;
+    return ra < rb ? -1 : ra > rb ? 1 : 0;
+}
+
+/*
+ * the section table, same layout for PE and TE images
+ * returns 0 on success
+ */
+static int
+parse_section_headers(const uint8_t *file, size_t file_size, const uint8_t *headers, uint16_t nr_sections, uint32_t raw_adjust, struct pe_image *out)
+{
+    out->sections = (struct pe_section*)calloc(nr_sections ? nr_sections : 1, sizeof(struct pe_section));
+    if (out->sections == NULL)
+    {
+        ERROR_MSG("Can't allocate memory for the sections.");
+        return 1;
+    }
+    for (uint16_t i = 0; i < nr_sections; i++)
+    {
+        const uint8_t *header = headers + (size_t)i * PE_SECTION_HEADER_SIZE;
+        uint32_t virtual_size = read32(header + 8);
+        uint32_t virtual_address = read32(header + 12);
+        uint32_t raw_size = read32(header + 16);
+        uint32_t raw_offset = read32(header + 20);
+        /* some toolchains leave the virtual size empty */
+        if (virtual_size == 0)
+        {
+            virtual_size = raw_size;
+        }
+        if (virtual_address >= out->image_size)
+        {
+            ERROR_MSG("Section %d outside of the image.", i);
+            continue;
+        }
+        if (virtual_size > out->image_size - virtual_address)
+        {
+            virtual_size = out->image_size - virtual_address;
+        }
+        if (raw_size > virtual_size)
+        {
+            raw_size = virtual_size;
+        }
+        /* TE images keep the PE file offsets */
+        if (raw_size == 0)
+        {
+            raw_offset = raw_adjust;
+        }
+        else if (raw_offset < raw_adjust)
+        {
+            ERROR_MSG("Section %d raw data inside the stripped headers.", i);
+            return 1;
+        }
+        raw_offset -= raw_adjust;
+        if (raw_offset > file_size || raw_size > file_size - raw_offset)
+        {
+            ERROR_MSG("Section %d raw data outside of the file.", i);
+            return 1;
+        }
+        
+        struct pe_section *section = &out->sections[out->nr_sections++];
+        memcpy(section->name, header, PE_SECTION_NAME_SIZE);
+        section->name[PE_SECTION_NAME_SIZE] = '\0';
+        section->virtual_address = virtual_address;
+        section->virtual_size = virtual_size;
+        section->characteristics = read32(header + 36);
+        section->data = file + raw_offset;
+        section->raw_size = raw_size;
+    }
+    return 0;
+}
+
+/*
+ * validate the headers and find the sections in the mapping
+ * returns 0 on success
+ */
+static int
+parse_pe_headers(const uint8_t *file, size_t file_size, struct pe_image *out, uint32_t *reloc_rva, uint32_t *reloc_size)
+{
+    if (file_size < DOS_LFANEW_OFFSET + 4 || read16(file) != EFI_IMAGE_DOS_SIGNATURE)
+    {
+        ERROR_MSG("Not a PE image.");
+        return 1;
+    }
+    uint32_t pe_offset = read32(file + DOS_LFANEW_OFFSET);
+    if (pe_offset > file_size || file_size - pe_offset < 4 + PE_FILE_HEADER_SIZE || read32(file + pe_offset) != EFI_IMAGE_PE_SIGNATURE)
+    {
+        ERROR_MSG("Invalid PE header.");
+        return 1;
+    }
+    const uint8_t *file_header = file + pe_offset + 4;
+    out->machine = read16(file_header);
+    uint16_t nr_sections = read16(file_header + 2);
+    uint16_t optional_size = read16(file_header + 16);
+    if (out->machine != EFI_IMAGE_MACHINE_X64 && out->machine != EFI_IMAGE_MACHINE_IA32)
+    {
+        ERROR_MSG("Unsupported machine type 0x%x.", out->machine);
+        return 1;
+    }
+    
+    size_t optional_offset = pe_offset + 4 + PE_FILE_HEADER_SIZE;
+    size_t sections_offset = optional_offset + optional_size;
+    if (optional_size < OPT_HEADERS_SIZE_OFFSET + 4 ||
+        sections_offset + (size_t)nr_sections * PE_SECTION_HEADER_SIZE > file_size)
+    {
+        ERROR_MSG("Truncated PE headers.");
+        return 1;
+    }
+    const uint8_t *optional = file + optional_offset;
+    uint16_t magic = read16(optional);
+    size_t directories_offset = 0;
+    if (magic == EFI_IMAGE_NT_OPTIONAL_HDR64_MAGIC)
+    {
+        out->is_64bit = 1;
+        out->image_base = read64(optional + OPT_IMAGE_BASE64_OFFSET);
+        directories_offset = OPT_NR_DIRECTORIES64_OFFSET;
+    }
+    else if (magic == EFI_IMAGE_NT_OPTIONAL_HDR32_MAGIC)
+    {
+        out->is_64bit = 0;
+        out->image_base = read32(optional + OPT_IMAGE_BASE32_OFFSET);
+        directories_offset = OPT_NR_DIRECTORIES32_OFFSET;
+    }
+    else
+    {
+        ERROR_MSG("Invalid optional header magic 0x%x.", magic);
+        return 1;
+    }
+    out->entry_point = read32(optional + OPT_ENTRY_POINT_OFFSET);
+    out->image_size = read32(optional + OPT_IMAGE_SIZE_OFFSET);
+    out->headers_size = read32(optional + OPT_HEADERS_SIZE_OFFSET);
+    if (out->image_size == 0 || out->image_size > PE_MAX_IMAGE_SIZE || out->headers_size > out->image_size ||
+        out->entry_point >= out->image_size)
+    {
+        ERROR_MSG("Invalid image size 0x%x.", out->image_size);
+        return 1;
+    }
+    
+    /* the relocations directory, if the optional header has one */
+    *reloc_rva = 0;
+    *reloc_size = 0;
+    size_t reloc_offset = directories_offset + 4 + EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC * 8;
+    if (optional_size >= reloc_offset + 8 && read32(optional + directories_offset) > EFI_IMAGE_DIRECTORY_ENTRY_BASERELOC)
+    {
+        *reloc_rva = read32(optional + reloc_offset);
+        *reloc_size = read32(optional + reloc_offset + 4);
+    }
+    
+    return parse_section_headers(file, file_size, file + sections_offset, nr_sections, 0, out);
+}
+
+/*
+ * TE headers are the PE file header fields the loader needs followed by the
+ * PE section table, the image size isn't kept so it's where the last section ends
+ * returns 0 on success
+ */
+static int
+parse_te_headers(const uint8_t *file, size_t file_size, struct pe_image *out, uint32_t *reloc_rva, uint32_t *reloc_size)
+{
+    if (file_size < sizeof(EFI_TE_IMAGE_HEADER) || read16(file) != EFI_IMAGE_TE_SIGNATURE)
+    {
+        ERROR_MSG("Not a TE image.");
+        return 1;
+    }
+    out->machine = read16(file + offsetof(EFI_TE_IMAGE_HEADER, Machine));
+    if (out->machine == EFI_IMAGE_MACHINE_X64)
+    {
+        out->is_64bit = 1;
+    }
+    else if (out->machine == EFI_IMAGE_MACHINE_IA32)
+    {
+        out->is_64bit = 0;
+    }
+    else
+    {
+        ERROR_MSG("Unsupported machine type 0x%x.", out->machine);
+        return 1;
+    }
+    uint16_t nr_sections = file[offsetof(EFI_TE_IMAGE_HEADER, NumberOfSections)];
+    uint16_t stripped_size = read16(file + offsetof(EFI_TE_IMAGE_HEADER, StrippedSize));
+    out->headers_size = sizeof(EFI_TE_IMAGE_HEADER) + nr_sections * PE_SECTION_HEADER_SIZE;
+    if (stripped_size < sizeof(EFI_TE_IMAGE_HEADER) || out->headers_size > file_size)
+    {
+        ERROR_MSG("Invalid TE header.");
+        return 1;
+    }
+    out->headers_rva = stripped_size - sizeof(EFI_TE_IMAGE_HEADER);
+    out->image_base = read64(file + offsetof(EFI_TE_IMAGE_HEADER, ImageBase));
+    out->entry_point = read32(file + offsetof(EFI_TE_IMAGE_HEADER, AddressOfEntryPoint));
+    
+    const uint8_t *headers = file + sizeof(EFI_TE_IMAGE_HEADER);
+    uint64_t image_end = out->headers_rva + out->headers_size;
+    for (uint16_t i = 0; i < nr_sections; i++)
+    {
+        const uint8_t *header = headers + (size_t)i * PE_SECTION_HEADER_SIZE;
+        uint32_t virtual_size = read32(header + 8);
+        uint32_t raw_size = read32(header + 16);
+        uint64_t end = (uint64_t)read32(header + 12) + (virtual_size > raw_size ? virtual_size : raw_size);
+        if (end > image_end)
+        {
+            image_end = end;
+        }
+    }
+    out->image_size = (uint32_t)image_end;
+    if (image_end > PE_MAX_IMAGE_SIZE || out->entry_point >= out->image_size)
+    {
+        ERROR_MSG("Invalid image size 0x%llx.", image_end);
+        return 1;
+    }
+    
+    const uint8_t *directory = file + offsetof(EFI_TE_IMAGE_HEADER, DataDirectory) + EFI_TE_IMAGE_DIRECTORY_ENTRY_BASERELOC * sizeof(EFI_IMAGE_DATA_DIRECTORY);
+    *reloc_rva = read32(directory);
+    *reloc_size = read32(directory + 4);
+    return parse_section_headers(file, file_size, headers, nr_sections, out->headers_rva, out);
+}
+
+/*
+ * collect the pointer sized fixups of the base relocations blocks
+ * a bad block stops the walk but isn't fatal, the image is still usable
+ */
+static int
+parse_relocations(struct pe_image *image, uint32_t reloc_rva, uint32_t reloc_size)
+{
+    size_t available = 0;
+    const uint8_t *blocks = pe_image_span(image, reloc_rva, &available);
+    if (blocks == NULL || reloc_size == 0)
+    {
+        return 0;
+    }
+    if (reloc_size > available)
+    {
+        reloc_size = (uint32_t)available;
+    }
+    /* every entry is two bytes, so this is enough for all of them */
+    image->relocations = (struct pe_relocation*)malloc((reloc_size / 2 + 1) * sizeof(struct pe_relocation));
+    if (image->relocations == NULL)
+    {
+        ERROR_MSG("Can't allocate memory for the relocations.");
+        return 1;
+    }
+    int sorted = 1;
+    for (uint32_t offset = 0; reloc_size - offset >= PE_RELOC_BLOCK_HEADER_SIZE; )
+    {
+        uint32_t page = read32(blocks + offset);
+        uint32_t block_size = read32(blocks + offset + 4);
+        if (block_size < PE_RELOC_BLOCK_HEADER_SIZE || block_size > reloc_size - offset)
+        {
+            DEBUG_MSG("Invalid relocations block at 0x%x.", reloc_rva + offset);
+            break;
+        }
+        for (uint32_t entry = PE_RELOC_BLOCK_HEADER_SIZE; entry + 2 <= block_size; entry += 2)
+        {
+            uint16_t value = read16(blocks + offset + entry);
+            uint8_t type = value >> 12;
+            if (type != EFI_IMAGE_REL_BASED_HIGHLOW && type != EFI_IMAGE_REL_BASED_DIR64)
+            {
+                continue;
+            }
+            struct pe_relocation *relocation = &image->relocations[image->nr_relocations];
+            relocation->rva = page + (value & 0xFFF);
+            relocation->type = type;
+            if (image->nr_relocations > 0 && relocation->rva < relocation[-1].rva)
+            {
+                sorted = 0;
+            }
+            image->nr_relocations++;
+        }
+        offset += block_size;
+    }
+    /* linkers emit them in order but nothing requires it */
+    if (sorted == 0)
+    {
+        qsort(image->relocations, image->nr_relocations, sizeof(struct pe_relocation), compare_relocations);
+    }
+    return 0;
+}
+
+/*
+ * map a whole file read only
+ * returns 0 on success, release with unmap_input_file
+ */
+int
+map_input_file(const char *path, const uint8_t **data, size_t *size)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        ERROR_MSG("Can't open %s.", path);
+        return 1;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0 || st.st_size > PE_MAX_IMAGE_SIZE)
+    {
+        ERROR_MSG("Invalid file size for %s.", path);
+        close(fd);
+        return 1;
+    }
+    void *mapping = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED)
+    {
+        ERROR_MSG("Can't map %s.", path);
+        return 1;
+    }
+    *data = (const uint8_t*)mapping;
+    *size = (size_t)st.st_size;
+    return 0;
+}
+
+void
+unmap_input_file(const uint8_t *data, size_t size)
+{
+    if (data != NULL)
+    {
+        munmap((void*)data, size);
+    }
+}
+
+/*
+ * parse a PE or TE image already in memory, the buffer must outlive the image
+ * returns 0 on success, free with free_pe_image
+ */
+int
+load_pe_buffer(const uint8_t *data, size_t size, struct pe_image *out)
+{
+    memset(out, 0, sizeof(struct pe_image));
+    out->mapping = data;
+    out->mapping_size = size;
+    
+    uint32_t reloc_rva = 0;
+    uint32_t reloc_size = 0;
+    int status = 0;
+    if (size >= 2 && read16(data) == EFI_IMAGE_TE_SIGNATURE)
+    {
+        status = parse_te_headers(data, size, out, &reloc_rva, &reloc_size);
+    }
+    else
+    {
+        status = parse_pe_headers(data, size, out, &reloc_rva, &reloc_size);
+    }
+    if (status != 0 || parse_relocations(out, reloc_rva, reloc_size) != 0)
+    {
+        free_pe_image(out);
+        return 1;
+    }
+    return 0;
+}
+
+/*
+ * map a PE or TE image from disk
+ * returns 0 on success, free with free_pe_image
+ */
+int
+load_pe_image(const char *path, struct pe_image *out)
+{
+    const uint8_t *data = NULL;
+    size_t size = 0;
+    if (map_input_file(path, &data, &size) != 0)
+    {
+        memset(out, 0, sizeof(struct pe_image));
+        return 1;
+    }
+    if (load_pe_buffer(data, size, out) != 0)
+    {
+        unmap_input_file(data, size);
+        return 1;
+    }
+    out->owns_mapping = 1;
+    return 0;
+}
+
+void
+free_pe_image(struct pe_image *image)
+{
+    if (image->owns_mapping)
+    {
+        unmap_input_file(image->mapping, image->mapping_size);
+    }
+    free(image->sections);
+    free(image->relocations);
+    memset(image, 0, sizeof(struct pe_image));
+}
+
+/*
+ * the bytes at an RVA straight from the mapping
+ * *available is how many bytes the span has, if it's NULL with bytes available
+ * they are the zero filled end of a section, with none the RVA isn't mapped
+ */
+const uint8_t *
+pe_image_span(const struct pe_image *image, uint32_t rva, size_t *available)
+{
+    *available = 0;
+    if (rva >= image->headers_rva && rva - image->headers_rva < image->headers_size)
+    {
+        uint32_t offset = rva - image->headers_rva;
+        size_t mapped = image->headers_size < image->mapping_size ? image->headers_size : image->mapping_size;
+        if (offset < mapped)
+        {
+            *available = mapped - offset;
+            return image->mapping + offset;
+        }
+        *available = image->headers_size - offset;
+        return NULL;
+    }
+    for (uint16_t i = 0; i < image->nr_sections; i++)
+    {
+        const struct pe_section *section = &image->sections[i];
+        if (rva < section->virtual_address || rva - section->virtual_address >= section->virtual_size)
+        {
+            continue;
+        }
+        uint32_t offset = rva - section->virtual_address;
+        if (offset < section->raw_size)
+        {
+            *available = section->raw_size - offset;
+            return section->data + offset;
+        }
+        *available = section->virtual_size - offset;
+        return NULL;
+    }
+    return NULL;
+}
+
+/*
+ * is there a fixup starting in [start, end)
+ */
+int
+has_pe_relocation(const struct pe_image *image, uint32_t start, uint32_t end)
+{
+    size_t low = 0;
+    size_t high = image->nr_relocations;
+    while (low < high)
+    {
+        size_t middle = low + (high - low) / 2;
+        if (image->relocations[middle].rva < start)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    return low < image->nr_relocations && image->relocations[low].rva < end;
+}
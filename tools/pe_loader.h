@@ -0,0 +1,103 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * pe_loader.h
+ *
+ */
+
+#ifndef efi_swiss_knife_pe_loader_h
+#define efi_swiss_knife_pe_loader_h
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "../image_format.h"
+
+/*
+ * PE32, PE32+ and TE loader for the standalone analyzer
+ * the file is mapped read only and nothing is copied, sections are spans of
+ * the mapping found by RVA so addresses are the same ones IDA shows for the
+ * module at its preferred image base
+ */
+
+#define PE_SECTION_NAME_SIZE            8
+
+struct pe_section
+{
+    char name[PE_SECTION_NAME_SIZE + 1];
+    uint32_t virtual_address;
+    uint32_t virtual_size;
+    uint32_t characteristics;
+    /* the section's bytes in the mapping, anything after raw_size reads as zero */
+    const uint8_t *data;
+    uint32_t raw_size;
+};
+
+/* a pointer sized fixup, where the image holds an absolute address */
+struct pe_relocation
+{
+    uint32_t rva;
+    uint8_t type;
+};
+
+struct pe_image
+{
+    /* the whole image, mapped read only */
+    const uint8_t *mapping;
+    size_t mapping_size;
+    /* images found inside a firmware volume point into the volume's mapping */
+    int owns_mapping;
+    uint64_t image_base;
+    uint32_t image_size;
+    /* RVA of the file's first byte, TE headers replace StrippedSize bytes of PE headers */
+    uint32_t headers_rva;
+    uint32_t headers_size;
+    /* RVA */
+    uint32_t entry_point;
+    uint16_t machine;
+    int is_64bit;
+    struct pe_section *sections;
+    uint16_t nr_sections;
+    /* sorted by RVA */
+    struct pe_relocation *relocations;
+    size_t nr_relocations;
+};
+
+int map_input_file(const char *path, const uint8_t **data, size_t *size);
+void unmap_input_file(const uint8_t *data, size_t size);
+int load_pe_image(const char *path, struct pe_image *out);
+int load_pe_buffer(const uint8_t *data, size_t size, struct pe_image *out);
+void free_pe_image(struct pe_image *image);
+const uint8_t * pe_image_span(const struct pe_image *image, uint32_t rva, size_t *available);
+int has_pe_relocation(const struct pe_image *image, uint32_t start, uint32_t end);
+
+#endif /* pe_loader_h */
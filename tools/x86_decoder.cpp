@@ -0,0 +1,881 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * x86_decoder.cpp
+ *
+ */
+
+#include "x86_decoder.h"
+
+#include <string.h>
+
+/*
+ * table driven length decoding: legacy prefixes, REX, VEX and the one, two
+ * and three byte opcode maps. the tables only say if there's a ModRM byte and
+ * which immediate follows, the few opcodes where that depends on something
+ * else (moffs, far pointers, F6/F7 test, enter) are handled in the code
+ */
+
+/* opcode table flags */
+#define OP_MODRM        0x01
+#define OP_IB           0x02
+#define OP_IW           0x04
+#define OP_IZ           0x08
+#define OP_IV           0x10
+#define OP_JB           0x20
+#define OP_JZ           0x40
+#define OP_BAD          0x80
+
+#define M       OP_MODRM
+#define MB      (OP_MODRM | OP_IB)
+#define MZ      (OP_MODRM | OP_IZ)
+#define IB      OP_IB
+#define IW      OP_IW
+#define IZ      OP_IZ
+#define IV      OP_IV
+#define JB      OP_JB
+#define JZ      OP_JZ
+#define XX      OP_BAD
+
+static const uint8_t g_one_byte_map[256] =
+{
+    /* 0x00 */ M,  M,  M,  M,  IB, IZ, 0,  0,  M,  M,  M,  M,  IB, IZ, 0,  0,
+    /* 0x10 */ M,  M,  M,  M,  IB, IZ, 0,  0,  M,  M,  M,  M,  IB, IZ, 0,  0,
+    /* 0x20 */ M,  M,  M,  M,  IB, IZ, 0,  0,  M,  M,  M,  M,  IB, IZ, 0,  0,
+    /* 0x30 */ M,  M,  M,  M,  IB, IZ, 0,  0,  M,  M,  M,  M,  IB, IZ, 0,  0,
+    /* 0x40 */ 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    /* 0x50 */ 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    /* 0x60 */ 0,  0,  M,  M,  0,  0,  0,  0,  IZ, MZ, IB, MB, 0,  0,  0,  0,
+    /* 0x70 */ JB, JB, JB, JB, JB, JB, JB, JB, JB, JB, JB, JB, JB, JB, JB, JB,
+    /* 0x80 */ MB, MZ, MB, MB, M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,
+    /* 0x90 */ 0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    /* 0xA0 */ 0,  0,  0,  0,  0,  0,  0,  0,  IB, IZ, 0,  0,  0,  0,  0,  0,
+    /* 0xB0 */ IB, IB, IB, IB, IB, IB, IB, IB, IV, IV, IV, IV, IV, IV, IV, IV,
+    /* 0xC0 */ MB, MB, IW, 0,  M,  M,  MB, MZ, IW | IB, 0, IW, 0, 0, IB, 0, 0,
+    /* 0xD0 */ M,  M,  M,  M,  IB, IB, 0,  0,  M,  M,  M,  M,  M,  M,  M,  M,
+    /* 0xE0 */ JB, JB, JB, JB, IB, IB, IB, IB, JZ, JZ, 0,  JB, 0,  0,  0,  0,
+    /* 0xF0 */ 0,  0,  0,  0,  0,  0,  M,  M,  0,  0,  0,  0,  0,  0,  M,  M
+};
+
+static const uint8_t g_two_byte_map[256] =
+{
+    /* 0x00 */ M,  M,  M,  M,  XX, 0,  0,  0,  0,  0,  XX, 0,  XX, M,  0,  MB,
+    /* 0x10 */ M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,
+    /* 0x20 */ M,  M,  M,  M,  XX, XX, XX, XX, M,  M,  M,  M,  M,  M,  M,  M,
+    /* 0x30 */ 0,  0,  0,  0,  0,  0,  XX, 0,  0,  XX, 0,  XX, XX, XX, XX, XX,
+    /* 0x40 */ M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,
+    /* 0x50 */ M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,
+    /* 0x60 */ M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,
+    /* 0x70 */ MB, MB, MB, MB, M,  M,  M,  0,  M,  M,  M,  M,  M,  M,  M,  M,
+    /* 0x80 */ JZ, JZ, JZ, JZ, JZ, JZ, JZ, JZ, JZ, JZ, JZ, JZ, JZ, JZ, JZ, JZ,
+    /* 0x90 */ M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,
+    /* 0xA0 */ 0,  0,  0,  M,  MB, M,  XX, XX, 0,  0,  0,  M,  MB, M,  M,  M,
+    /* 0xB0 */ M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  MB, M,  M,  M,  M,  M,
+    /* 0xC0 */ M,  M,  MB, M,  MB, MB, MB, M,  0,  0,  0,  0,  0,  0,  0,  0,
+    /* 0xD0 */ M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,
+    /* 0xE0 */ M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,
+    /* 0xF0 */ M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M,  M
+};
+
+#undef M
+#undef MB
+#undef MZ
+#undef IB
+#undef IW
+#undef IZ
+#undef IV
+#undef JB
+#undef JZ
+#undef XX
+
+/* opcode maps */
+enum x86_map
+{
+    kMapOneByte = 0,
+    kMap0F,
+    kMap0F38,
+    kMap0F3A
+};
+
+/* the ALU operations of 00-3F and of the 80-83 group */
+enum x86_alu
+{
+    kAluAdd = 0,
+    kAluOr,
+    kAluAdc,
+    kAluSbb,
+    kAluAnd,
+    kAluSub,
+    kAluXor,
+    kAluCmp
+};
+
+struct x86_state
+{
+    const uint8_t *code;
+    size_t size;
+    size_t pos;
+    int is_64bit;
+    uint8_t rex;
+    int vex;
+    int operand_size;
+    int address_size;
+    /* ModRM fields, reg and rm already extended with REX */
+    int has_modrm;
+    uint8_t mod;
+    uint8_t reg;
+    uint8_t rm;
+    /* the r/m operand, memory or register */
+    struct insn_operand rm_op;
+    int rip_relative;
+    int64_t displacement;
+    uint64_t immediate;
+    int64_t relative;
+};
+
+#define REX_B(s)    (((s)->rex & 0x1) != 0)
+#define REX_X(s)    (((s)->rex & 0x2) != 0)
+#define REX_R(s)    (((s)->rex & 0x4) != 0)
+#define REX_W(s)    (((s)->rex & 0x8) != 0)
+
+/* little endian read of n bytes, returns 0 on success */
+static int
+fetch(struct x86_state *s, size_t n, uint64_t *value)
+{
+    if (s->pos + n > s->size || s->pos + n > X86_MAX_INSN_SIZE)
+    {
+        return 1;
+    }
+    uint64_t v = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        v |= (uint64_t)s->code[s->pos + i] << (8 * i);
+    }
+    s->pos += n;
+    *value = v;
+    return 0;
+}
+
+static int64_t
+sign_extend(uint64_t value, size_t size)
+{
+    switch (size)
+    {
+        case 1:
+            return (int8_t)value;
+        case 2:
+            return (int16_t)value;
+        case 4:
+            return (int32_t)value;
+        default:
+            return (int64_t)value;
+    }
+}
+
+static uint64_t
+truncate(uint64_t value, int size)
+{
+    return size >= 8 ? value : value & ((1ULL << (8 * size)) - 1);
+}
+
+static void
+set_reg(struct insn_operand *op, int reg, int byte_reg)
+{
+    memset(op, 0, sizeof(struct insn_operand));
+    op->type = kOpReg;
+    op->reg = byte_reg ? X86_REG_BYTE + reg : reg;
+}
+
+static void
+set_other(struct insn_operand *op)
+{
+    memset(op, 0, sizeof(struct insn_operand));
+    op->type = kOpOther;
+}
+
+static void
+set_imm(struct insn_operand *op, uint64_t value)
+{
+    memset(op, 0, sizeof(struct insn_operand));
+    op->type = kOpImm;
+    op->value = value;
+}
+
+/*
+ * ModRM, SIB and displacement
+ * returns 0 on success
+ */
+static int
+decode_modrm(struct x86_state *s, int byte_op)
+{
+    uint64_t byte = 0;
+    if (fetch(s, 1, &byte) != 0)
+    {
+        return 1;
+    }
+    s->has_modrm = 1;
+    s->mod = (byte >> 6) & 3;
+    s->reg = ((byte >> 3) & 7) | (REX_R(s) ? 8 : 0);
+    uint8_t rm = byte & 7;
+    s->rm = rm | (REX_B(s) ? 8 : 0);
+    memset(&s->rm_op, 0, sizeof(struct insn_operand));
+    
+    if (s->mod == 3)
+    {
+        set_reg(&s->rm_op, s->rm, byte_op);
+        return 0;
+    }
+    
+    uint64_t disp = 0;
+    /* 16 bit addressing, never seen in modules but the length must be right */
+    if (s->address_size == 2)
+    {
+        size_t disp_size = s->mod == 1 ? 1 : (s->mod == 2 || (s->mod == 0 && rm == 6)) ? 2 : 0;
+        set_other(&s->rm_op);
+        return fetch(s, disp_size, &disp);
+    }
+    
+    int base = -1;
+    int index = -1;
+    size_t disp_size = s->mod == 1 ? 1 : s->mod == 2 ? 4 : 0;
+    if (rm == 4)
+    {
+        uint64_t sib = 0;
+        if (fetch(s, 1, &sib) != 0)
+        {
+            return 1;
+        }
+        index = ((sib >> 3) & 7) | (REX_X(s) ? 8 : 0);
+        if (index == 4)
+        {
+            index = -1;
+        }
+        if ((sib & 7) == 5 && s->mod == 0)
+        {
+            disp_size = 4;
+        }
+        else
+        {
+            base = (sib & 7) | (REX_B(s) ? 8 : 0);
+        }
+    }
+    else if (rm == 5 && s->mod == 0)
+    {
+        disp_size = 4;
+        s->rip_relative = s->is_64bit;
+    }
+    else
+    {
+        base = s->rm;
+    }
+    if (fetch(s, disp_size, &disp) != 0)
+    {
+        return 1;
+    }
+    s->displacement = sign_extend(disp, disp_size);
+    
+    if (index != -1)
+    {
+        s->rm_op.type = kOpOther;
+    }
+    else if (base == -1)
+    {
+        /* absolute address, or RIP relative fixed up once the length is known */
+        s->rm_op.type = kOpMem;
+        s->rm_op.addr = s->is_64bit ? (ea_t)s->displacement : (ea_t)(uint32_t)s->displacement;
+    }
+    else
+    {
+        s->rm_op.type = s->mod == 0 ? kOpPhrase : kOpDispl;
+        s->rm_op.reg = base;
+        s->rm_op.addr = (ea_t)s->displacement;
+    }
+    return 0;
+}
+
+/* the operand size of the instructions defaulting to 64 bits in long mode */
+static int
+stack_operand_size(const struct x86_state *s)
+{
+    if (s->operand_size == 2)
+    {
+        return 2;
+    }
+    return s->is_64bit ? 8 : 4;
+}
+
+/*
+ * kinds and operands for the one byte map, only what the passes use
+ */
+static void
+describe_one_byte(struct x86_state *s, uint8_t opcode, ea_t next, struct cached_insn *out)
+{
+    struct insn_operand *op0 = &out->ops[0];
+    struct insn_operand *op1 = &out->ops[1];
+    int alu = -1;
+    
+    if (opcode < 0x40 && (opcode & 7) < 6)
+    {
+        alu = opcode >> 3;
+        switch (opcode & 7)
+        {
+            case 0:
+            case 1:
+                *op0 = s->rm_op;
+                set_reg(op1, s->reg, (opcode & 1) == 0);
+                break;
+            case 2:
+            case 3:
+                set_reg(op0, s->reg, (opcode & 1) == 0);
+                *op1 = s->rm_op;
+                break;
+            case 4:
+                set_reg(op0, 0, 1);
+                set_imm(op1, s->immediate);
+                break;
+            default:
+                set_reg(op0, 0, 0);
+                set_imm(op1, truncate(sign_extend(s->immediate, s->operand_size == 2 ? 2 : 4), s->operand_size));
+                break;
+        }
+    }
+    else if (opcode >= 0x80 && opcode <= 0x83)
+    {
+        alu = s->reg & 7;
+        *op0 = s->rm_op;
+        set_imm(op1, opcode == 0x81 ? truncate(sign_extend(s->immediate, s->operand_size == 2 ? 2 : 4), s->operand_size) :
+                                      truncate(sign_extend(s->immediate, 1), s->operand_size));
+    }
+    if (alu != -1)
+    {
+        out->kind = alu == kAluAdd ? kInsnAdd : alu == kAluSub ? kInsnSub : alu == kAluXor ? kInsnXor : kInsnOther;
+        out->flags = alu != kAluCmp ? INSN_CHANGES_OP0 : 0;
+        return;
+    }
+    
+    if (opcode >= 0x50 && opcode <= 0x5F)
+    {
+        set_reg(op0, (opcode & 7) | (REX_B(s) ? 8 : 0), 0);
+        out->kind = opcode < 0x58 ? kInsnPush : kInsnPop;
+        out->flags = opcode < 0x58 ? 0 : INSN_CHANGES_OP0;
+        return;
+    }
+    if (opcode >= 0x70 && opcode <= 0x7F)
+    {
+        out->kind = kInsnJcc;
+        op0->type = kOpNear;
+        op0->addr = next + s->relative;
+        return;
+    }
+    if (opcode >= 0xB0 && opcode <= 0xBF)
+    {
+        out->kind = kInsnMov;
+        out->flags = INSN_CHANGES_OP0;
+        set_reg(op0, (opcode & 7) | (REX_B(s) ? 8 : 0), opcode < 0xB8);
+        set_imm(op1, s->immediate);
+        return;
+    }
+    switch (opcode)
+    {
+        case 0x63:
+        case 0x69:
+        case 0x6B:
+            /* movsxd / arpl and imul, the destination is the reg field */
+            set_reg(op0, s->reg, 0);
+            *op1 = s->rm_op;
+            out->flags = INSN_CHANGES_OP0;
+            break;
+        case 0x68:
+        case 0x6A:
+            out->kind = kInsnPush;
+            set_imm(op0, truncate(sign_extend(s->immediate, opcode == 0x6A ? 1 : s->operand_size == 2 ? 2 : 4), stack_operand_size(s)));
+            break;
+        case 0x86:
+        case 0x87:
+            *op0 = s->rm_op;
+            set_reg(op1, s->reg, opcode == 0x86);
+            out->flags = INSN_CHANGES_OP0;
+            break;
+        case 0x88:
+        case 0x89:
+            out->kind = kInsnMov;
+            out->flags = INSN_CHANGES_OP0;
+            *op0 = s->rm_op;
+            set_reg(op1, s->reg, opcode == 0x88);
+            break;
+        case 0x8A:
+        case 0x8B:
+            out->kind = kInsnMov;
+            out->flags = INSN_CHANGES_OP0;
+            set_reg(op0, s->reg, opcode == 0x8A);
+            *op1 = s->rm_op;
+            break;
+        case 0x8C:
+            out->kind = kInsnMov;
+            out->flags = INSN_CHANGES_OP0;
+            *op0 = s->rm_op;
+            set_other(op1);
+            break;
+        case 0x8E:
+            out->kind = kInsnMov;
+            out->flags = INSN_CHANGES_OP0;
+            set_other(op0);
+            *op1 = s->rm_op;
+            break;
+        case 0x8D:
+            out->kind = kInsnLea;
+            out->flags = INSN_CHANGES_OP0;
+            set_reg(op0, s->reg, 0);
+            *op1 = s->rm_op;
+            break;
+        case 0x8F:
+            out->kind = kInsnPop;
+            out->flags = INSN_CHANGES_OP0;
+            *op0 = s->rm_op;
+            break;
+        case 0xA0:
+        case 0xA1:
+        case 0xA2:
+        case 0xA3:
+            out->kind = kInsnMov;
+            out->flags = INSN_CHANGES_OP0;
+            set_reg(opcode < 0xA2 ? op0 : op1, 0, (opcode & 1) == 0);
+            {
+                struct insn_operand *mem = opcode < 0xA2 ? op1 : op0;
+                memset(mem, 0, sizeof(struct insn_operand));
+                mem->type = kOpMem;
+                mem->addr = (ea_t)s->immediate;
+            }
+            break;
+        case 0xC0:
+        case 0xC1:
+        case 0xD0:
+        case 0xD1:
+        case 0xD2:
+        case 0xD3:
+            *op0 = s->rm_op;
+            out->flags = INSN_CHANGES_OP0;
+            break;
+        case 0xC2:
+        case 0xC3:
+        case 0xCA:
+        case 0xCB:
+            out->kind = kInsnRet;
+            out->flags = INSN_STOPS_FLOW;
+            break;
+        case 0xC6:
+        case 0xC7:
+            out->kind = (s->reg & 7) == 0 ? kInsnMov : kInsnOther;
+            out->flags = INSN_CHANGES_OP0;
+            *op0 = s->rm_op;
+            set_imm(op1, opcode == 0xC6 ? s->immediate : truncate(sign_extend(s->immediate, s->operand_size == 2 ? 2 : 4), s->operand_size));
+            break;
+        case 0xCF:
+        case 0xF4:
+            out->flags = INSN_STOPS_FLOW;
+            break;
+        case 0xE0:
+        case 0xE1:
+        case 0xE2:
+        case 0xE3:
+            out->kind = kInsnJcc;
+            op0->type = kOpNear;
+            op0->addr = next + s->relative;
+            break;
+        case 0xE8:
+        case 0xE9:
+        case 0xEB:
+            out->kind = opcode == 0xE8 ? kInsnCall : kInsnJmp;
+            out->flags = opcode == 0xE8 ? 0 : INSN_STOPS_FLOW;
+            op0->type = kOpNear;
+            op0->addr = s->is_64bit ? next + s->relative : (ea_t)(uint32_t)(next + s->relative);
+            break;
+        case 0xF6:
+        case 0xF7:
+            *op0 = s->rm_op;
+            /* not and neg */
+            out->flags = (s->reg & 7) == 2 || (s->reg & 7) == 3 ? INSN_CHANGES_OP0 : 0;
+            break;
+        case 0xFE:
+            *op0 = s->rm_op;
+            out->flags = (s->reg & 7) < 2 ? INSN_CHANGES_OP0 : 0;
+            break;
+        case 0xFF:
+            *op0 = s->rm_op;
+            switch (s->reg & 7)
+            {
+                case 0:
+                case 1:
+                    out->flags = INSN_CHANGES_OP0;
+                    break;
+                case 2:
+                    out->kind = kInsnCallIndirect;
+                    break;
+                case 4:
+                    out->kind = kInsnJmpIndirect;
+                    out->flags = INSN_STOPS_FLOW;
+                    break;
+                case 5:
+                    out->flags = INSN_STOPS_FLOW;
+                    break;
+                case 6:
+                    out->kind = kInsnPush;
+                    break;
+                default:
+                    break;
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+/*
+ * kinds and operands for the 0F map
+ */
+static void
+describe_two_byte(struct x86_state *s, uint8_t opcode, ea_t next, struct cached_insn *out)
+{
+    struct insn_operand *op0 = &out->ops[0];
+    struct insn_operand *op1 = &out->ops[1];
+    
+    if (opcode >= 0x80 && opcode <= 0x8F)
+    {
+        out->kind = kInsnJcc;
+        op0->type = kOpNear;
+        op0->addr = s->is_64bit ? next + s->relative : (ea_t)(uint32_t)(next + s->relative);
+        return;
+    }
+    /* cmovcc, imul, bsf, bsr, popcnt, movzx and movsx write the reg field */
+    if ((opcode >= 0x40 && opcode <= 0x4F) || opcode == 0xAF || opcode == 0xB6 || opcode == 0xB7 ||
+        opcode == 0xB8 || opcode == 0xBC || opcode == 0xBD || opcode == 0xBE || opcode == 0xBF)
+    {
+        set_reg(op0, s->reg, 0);
+        *op1 = s->rm_op;
+        out->flags = INSN_CHANGES_OP0;
+        return;
+    }
+    /* setcc, the bit tests that write, shld, shrd, cmpxchg and xadd write the r/m operand */
+    if ((opcode >= 0x90 && opcode <= 0x9F) || opcode == 0xAB || opcode == 0xB3 || opcode == 0xBB ||
+        opcode == 0xA4 || opcode == 0xA5 || opcode == 0xAC || opcode == 0xAD ||
+        opcode == 0xB0 || opcode == 0xB1 || opcode == 0xC0 || opcode == 0xC1)
+    {
+        *op0 = s->rm_op;
+        out->flags = INSN_CHANGES_OP0;
+        return;
+    }
+    if (opcode == 0xBA)
+    {
+        *op0 = s->rm_op;
+        out->flags = (s->reg & 7) > 4 ? INSN_CHANGES_OP0 : 0;
+        return;
+    }
+    if (opcode >= 0xC8 && opcode <= 0xCF)
+    {
+        set_reg(op0, (opcode & 7) | (REX_B(s) ? 8 : 0), 0);
+        out->flags = INSN_CHANGES_OP0;
+        return;
+    }
+    switch (opcode)
+    {
+        case 0x20:
+        case 0x21:
+            /* mov reg, crN / drN */
+            set_reg(op0, s->rm, 0);
+            set_other(op1);
+            out->flags = INSN_CHANGES_OP0;
+            break;
+        case 0x0B:
+            out->flags = INSN_STOPS_FLOW;
+            break;
+        case 0xA0:
+        case 0xA8:
+            out->kind = kInsnPush;
+            set_other(op0);
+            break;
+        case 0xA1:
+        case 0xA9:
+            out->kind = kInsnPop;
+            set_other(op0);
+            out->flags = INSN_CHANGES_OP0;
+            break;
+        default:
+            break;
+    }
+}
+
+/*
+ * decode one instruction at address from the bytes in code
+ * returns its size or 0 if it's not a valid instruction
+ */
+int
+decode_x86_insn(const uint8_t *code, size_t size, ea_t address, int is_64bit, struct cached_insn *out)
+{
+    struct x86_state s;
+    memset(&s, 0, sizeof(s));
+    s.code = code;
+    s.size = size;
+    s.is_64bit = is_64bit;
+    
+    memset(out, 0, sizeof(struct cached_insn));
+    out->ea = address;
+    out->kind = kInsnOther;
+    
+    /* legacy prefixes, REX has to be the last one */
+    int opsize_prefix = 0;
+    int addrsize_prefix = 0;
+    uint64_t byte = 0;
+    for (;;)
+    {
+        if (fetch(&s, 1, &byte) != 0)
+        {
+            return 0;
+        }
+        if (byte == 0x66)
+        {
+            opsize_prefix = 1;
+        }
+        else if (byte == 0x67)
+        {
+            addrsize_prefix = 1;
+        }
+        else if (byte == 0xF0 || byte == 0xF2 || byte == 0xF3 || byte == 0x26 || byte == 0x2E ||
+                 byte == 0x36 || byte == 0x3E || byte == 0x64 || byte == 0x65)
+        {
+        }
+        else if (is_64bit && (byte & 0xF0) == 0x40)
+        {
+            s.rex = (uint8_t)byte;
+            if (fetch(&s, 1, &byte) != 0)
+            {
+                return 0;
+            }
+            break;
+        }
+        else
+        {
+            break;
+        }
+        s.rex = 0;
+    }
+    
+    if (is_64bit)
+    {
+        s.operand_size = REX_W(&s) ? 8 : opsize_prefix ? 2 : 4;
+        s.address_size = addrsize_prefix ? 4 : 8;
+    }
+    else
+    {
+        s.operand_size = opsize_prefix ? 2 : 4;
+        s.address_size = addrsize_prefix ? 2 : 4;
+    }
+    
+    uint8_t opcode = (uint8_t)byte;
+    int map = kMapOneByte;
+    uint8_t flags = 0;
+    
+    /*
+     * VEX and EVEX, outside of long mode C4, C5 and 62 are only a prefix if
+     * ModRM would be a register
+     */
+    if ((opcode == 0xC4 || opcode == 0xC5 || opcode == 0x62) && (is_64bit || (s.pos < size && (code[s.pos] & 0xC0) == 0xC0)))
+    {
+        uint64_t vex = 0;
+        if (fetch(&s, opcode == 0x62 ? 3 : opcode == 0xC4 ? 2 : 1, &vex) != 0)
+        {
+            return 0;
+        }
+        s.vex = 1;
+        /* both carry inverted R, X and B bits */
+        if (opcode == 0xC5)
+        {
+            s.rex = (vex & 0x80) ? 0 : 0x4;
+            map = kMap0F;
+        }
+        else
+        {
+            s.rex = (uint8_t)(((~vex & 0x80) ? 0x4 : 0) | ((~vex & 0x40) ? 0x2 : 0) | ((~vex & 0x20) ? 0x1 : 0));
+            uint64_t select = vex & (opcode == 0x62 ? 0x7 : 0x1F);
+            map = select == 1 ? kMap0F : select == 2 ? kMap0F38 : select == 3 ? kMap0F3A : -1;
+            if (map == -1)
+            {
+                return 0;
+            }
+        }
+        if (!is_64bit)
+        {
+            s.rex = 0;
+        }
+        if (fetch(&s, 1, &byte) != 0)
+        {
+            return 0;
+        }
+        opcode = (uint8_t)byte;
+        flags = OP_MODRM;
+        if (map == kMap0F3A || (map == kMap0F && ((opcode >= 0x70 && opcode <= 0x73) || opcode == 0xC2 || opcode == 0xC4 ||
+                                                  opcode == 0xC5 || opcode == 0xC6)))
+        {
+            flags |= OP_IB;
+        }
+        /* vzeroupper and vzeroall */
+        if (map == kMap0F && opcode == 0x77)
+        {
+            flags = 0;
+        }
+    }
+    else if (opcode == 0x0F)
+    {
+        if (fetch(&s, 1, &byte) != 0)
+        {
+            return 0;
+        }
+        opcode = (uint8_t)byte;
+        if (opcode == 0x38 || opcode == 0x3A)
+        {
+            map = opcode == 0x38 ? kMap0F38 : kMap0F3A;
+            if (fetch(&s, 1, &byte) != 0)
+            {
+                return 0;
+            }
+            opcode = (uint8_t)byte;
+            flags = map == kMap0F38 ? OP_MODRM : OP_MODRM | OP_IB;
+        }
+        else
+        {
+            map = kMap0F;
+            flags = g_two_byte_map[opcode];
+        }
+    }
+    else
+    {
+        flags = g_one_byte_map[opcode];
+        /* gone in long mode */
+        if (is_64bit && (opcode == 0x06 || opcode == 0x07 || opcode == 0x0E || opcode == 0x16 || opcode == 0x17 ||
+                         opcode == 0x1E || opcode == 0x1F || opcode == 0x27 || opcode == 0x2F || opcode == 0x37 ||
+                         opcode == 0x3F || opcode == 0x60 || opcode == 0x61 || opcode == 0x82 ||
+                         opcode == 0x9A || opcode == 0xCE || opcode == 0xD4 || opcode == 0xD5 || opcode == 0xD6 ||
+                         opcode == 0xEA))
+        {
+            return 0;
+        }
+        if ((opcode >= 0x50 && opcode <= 0x5F) || opcode == 0x8F || opcode == 0x68 || opcode == 0x6A)
+        {
+            s.operand_size = stack_operand_size(&s);
+        }
+    }
+    if (flags & OP_BAD)
+    {
+        return 0;
+    }
+    
+    int byte_op = map == kMapOneByte && opcode < 0xC0 ? ((opcode < 0x40 && (opcode & 1) == 0 && (opcode & 7) < 4) ||
+                                                         opcode == 0x80 || opcode == 0x82 || opcode == 0x84 || opcode == 0x86 ||
+                                                         opcode == 0x88 || opcode == 0x8A) :
+                  map == kMapOneByte && (opcode == 0xC0 || opcode == 0xC6 || opcode == 0xD0 || opcode == 0xD2 ||
+                                         opcode == 0xF6 || opcode == 0xFE);
+    if (!s.vex && map == kMap0F && ((opcode >= 0x90 && opcode <= 0x9F) || opcode == 0xB0 || opcode == 0xC0))
+    {
+        byte_op = 1;
+    }
+    if ((flags & OP_MODRM) && decode_modrm(&s, byte_op) != 0)
+    {
+        return 0;
+    }
+    
+    /* immediates */
+    size_t imm_size = 0;
+    if (flags & OP_IB)
+    {
+        imm_size += 1;
+    }
+    if (flags & OP_IW)
+    {
+        imm_size += 2;
+    }
+    if (flags & OP_IZ)
+    {
+        imm_size += s.operand_size == 2 ? 2 : 4;
+    }
+    if (flags & OP_IV)
+    {
+        imm_size += s.operand_size;
+    }
+    if (map == kMapOneByte && (opcode == 0xF6 || opcode == 0xF7) && (s.reg & 7) < 2)
+    {
+        imm_size += opcode == 0xF6 ? 1 : s.operand_size == 2 ? 2 : 4;
+    }
+    if (map == kMapOneByte && opcode >= 0xA0 && opcode <= 0xA3)
+    {
+        imm_size = s.address_size;
+    }
+    if (map == kMapOneByte && (opcode == 0x9A || opcode == 0xEA))
+    {
+        imm_size = (s.operand_size == 2 ? 2 : 4) + 2;
+    }
+    if (imm_size > 8)
+    {
+        return 0;
+    }
+    if (fetch(&s, imm_size, &s.immediate) != 0)
+    {
+        return 0;
+    }
+    
+    /* relative branches */
+    if (flags & (OP_JB | OP_JZ))
+    {
+        size_t rel_size = (flags & OP_JB) ? 1 : (!is_64bit && s.operand_size == 2) ? 2 : 4;
+        uint64_t rel = 0;
+        if (fetch(&s, rel_size, &rel) != 0)
+        {
+            return 0;
+        }
+        s.relative = sign_extend(rel, rel_size);
+    }
+    
+    ea_t next = address + s.pos;
+    if (s.rip_relative)
+    {
+        s.rm_op.addr = next + s.displacement;
+    }
+    out->size = (uint16_t)s.pos;
+    
+    if (!s.vex && map == kMapOneByte)
+    {
+        describe_one_byte(&s, opcode, next, out);
+    }
+    else if (!s.vex && map == kMap0F)
+    {
+        describe_two_byte(&s, opcode, next, out);
+    }
+    return (int)s.pos;
+}
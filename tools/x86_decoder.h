@@ -0,0 +1,61 @@
+/*
+ * ______________________.___
+ * \_   _____/\_   _____/|   |
+ *  |    __)_  |    __)  |   |
+ *  |        \ |     \   |   |
+ * /_______  / \___  /   |___|
+ *         \/      \/
+ *   _________       .__                 ____  __.      .__  _____
+ *  /   _____/_  _  _|__| ______ _____  |    |/ _| ____ |__|/ ____\____
+ *  \_____  \\ \/ \/ /  |/  ___//  ___/ |      <  /    \|  \   __\/ __ \
+ *  /        \\     /|  |\___ \ \___ \  |    |  \|   |  \  ||  | \  ___/
+ * /_______  / \/\_/ |__/____  >____  > |____|__ \___|  /__||__|  \___  >
+ *         \/                \/     \/          \/    \/              \/
+ *
+ * EFI Swiss Knife
+ * An IDA plugin to improve (U)EFI reversing
+ *
+ * Copyright (C) 2016, 2017  Pedro Vilaça (fG!) - reverser@put.as - https://reverse.put.as
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * x86_decoder.h
+ *
+ */
+
+#ifndef efi_swiss_knife_x86_decoder_h
+#define efi_swiss_knife_x86_decoder_h
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "../insn_cache.h"
+
+/*
+ * minimal x86 and x86-64 decoder for the standalone analyzer
+ *
+ * every instruction gets its exact length, but only the instructions the
+ * analysis passes care about get a kind and operands, the same ones the IDA
+ * backend reports. registers follow the IDA numbering for the general purpose
+ * ones (0-15), byte registers are 16 and up, anything else is kOpOther
+ */
+
+/* register operands that aren't general purpose registers */
+#define X86_REG_BYTE        16
+
+#define X86_MAX_INSN_SIZE   15
+
+int decode_x86_insn(const uint8_t *code, size_t size, ea_t address, int is_64bit, struct cached_insn *out);
+
+#endif /* x86_decoder_h */